@@ -51,6 +51,41 @@ public:
   }
 };
 
+/*
+ * Damping of an absorbing layer of the given thickness along the boundary of the ball, increasing
+ * quadratically from zero at the inner radius of the layer.
+ */
+template<int dim>
+class AbsorbingLayerDamping : public dealii::Function<dim>
+{
+public:
+  AbsorbingLayerDamping(double const radius_in,
+                        double const thickness_in,
+                        double const max_damping_in)
+    : dealii::Function<dim>(1, 0.0),
+      radius(radius_in),
+      thickness(thickness_in),
+      max_damping(max_damping_in)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    double const distance = p.norm() - (radius - thickness);
+
+    if(distance <= 0.0)
+      return 0.0;
+
+    return max_damping * std::pow(distance / thickness, 2.0);
+  }
+
+private:
+  double const radius;
+  double const thickness;
+  double const max_damping;
+};
+
 template<int dim, typename Number>
 class Application : public ApplicationBase<dim, Number>
 {
@@ -81,6 +116,11 @@ public:
 
       prm.add_parameter("Radius", radius, "Radius of domain.", dealii::Patterns::Double(1.0e-12));
 
+      prm.add_parameter("AbsorbingLayerThickness",
+                        absorbing_layer_thickness,
+                        "Thickness of the absorbing layer (0: no absorbing layer).",
+                        dealii::Patterns::Double(0.0));
+
       prm.add_parameter("AnalyticalSolutionAvailable",
                         analytical_solution_is_available,
                         "We know the analytical solution for Y=1 after the wave left domain?",
@@ -96,6 +136,7 @@ private:
     // MATHEMATICAL MODEL
     this->param.formulation     = Formulation::SkewSymmetric;
     this->param.right_hand_side = false;
+    this->param.absorbing_layer = absorbing_layer_thickness > 0.0;
 
     // PHYSICAL QUANTITIES
     this->param.start_time     = 0.0;
@@ -164,6 +205,15 @@ private:
 
     this->field_functions->right_hand_side =
       std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+
+    // the damping rate at the boundary is chosen such that a wave of normal incidence is
+    // attenuated by about exp(-4) when travelling through the layer and back
+    if(absorbing_layer_thickness > 0.0)
+      this->field_functions->absorbing_layer_damping =
+        std::make_shared<AbsorbingLayerDamping<dim>>(radius,
+                                                     absorbing_layer_thickness,
+                                                     6.0 * speed_of_sound /
+                                                       absorbing_layer_thickness);
   }
 
   std::shared_ptr<PostProcessorBase<dim, Number>>
@@ -228,6 +278,9 @@ private:
   double end_time       = 1.0;
   double radius         = 1.0;
 
+  // thickness of the absorbing layer inside the ball
+  double absorbing_layer_thickness = 0.0;
+
   // analytical solution only known for first oder ABC and after
   // the wave left the domain
   bool analytical_solution_is_available = false;
@@ -124,7 +124,7 @@ public:
 
     // inflow data
     if(pp_data_bfs.inflow_data.write_inflow_data)
-      inflow_data_calculator->calculate(velocity);
+      inflow_data_calculator->calculate(velocity, time);
 
     // line plot statistics
     if(line_plot_calculator_statistics)
@@ -133,7 +133,7 @@ public:
       if(pp_data_fda.inflow_data.write_inflow_data) // to be done for precursor domain
       {
         // inflow data
-        inflow_data_calculator->calculate(velocity);
+        inflow_data_calculator->calculate(velocity, time);
       }
 
       if(pp_data_fda.mean_velocity_data.calculate) // to be done for precursor domain
@@ -52,6 +52,35 @@ public:
     prm.enter_subsection("Application");
     {
       prm.add_parameter("MeshType", mesh_type, "Type of mesh (Cartesian versus curvilinear).");
+      prm.add_parameter("UseMergedGeometryCoefficients",
+                        use_merged_geometry_coefficients,
+                        "Precompute merged geometry coefficients for cell integrals.");
+      prm.add_parameter("UseFixedDegreeKernels",
+                        use_fixed_degree_kernels,
+                        "Use cell integrals with polynomial degree known at compile time.");
+      prm.add_parameter("UseDenseSimplexKernels",
+                        use_dense_simplex_kernels,
+                        "Use dense reference-cell matrices for cell integrals on simplex meshes.");
+      prm.add_parameter("TaskParallelScheme",
+                        task_parallel_scheme,
+                        "Shared-memory parallelization of the matrix-free loops.");
+      prm.add_parameter("OverlapCommunicationComputation",
+                        overlap_communication_computation,
+                        "Overlap the ghost exchange with work on interior cells and faces.");
+      prm.add_parameter("NumberOfThreads",
+                        n_threads,
+                        "Number of threads per MPI process (0 = all cores of the process).");
+      prm.add_parameter("PinThreads",
+                        pin_threads,
+                        "Pin the threads to the cores of the process.");
+    }
+    prm.leave_subsection();
+
+    prm.enter_subsection("Throughput");
+    {
+      prm.add_parameter("SpatialDiscretization",
+                        spatial_discretization,
+                        "Spatial discretization (CG vs. DG).");
     }
     prm.leave_subsection();
   }
@@ -79,12 +108,23 @@ private:
     this->param.mapping_degree              = 1;
     this->param.mapping_degree_coarse_grids = this->param.mapping_degree;
 
-    this->param.spatial_discretization = SpatialDiscretization::DG;
+    this->param.spatial_discretization = spatial_discretization;
     this->param.IP_factor              = 1.0e0;
 
     // SOLVER
     this->param.solver         = LinearSolver::CG;
     this->param.preconditioner = Preconditioner::None;
+
+    // NUMERICAL PARAMETERS
+    this->param.use_merged_geometry_coefficients = use_merged_geometry_coefficients;
+    this->param.use_fixed_degree_kernels         = use_fixed_degree_kernels;
+    this->param.use_dense_simplex_kernels        = use_dense_simplex_kernels;
+
+    this->param.parallelization.task_parallel_scheme = task_parallel_scheme;
+    this->param.parallelization.overlap_communication_computation =
+      overlap_communication_computation;
+    this->param.parallelization.n_threads   = n_threads;
+    this->param.parallelization.pin_threads = pin_threads;
   }
 
   void
@@ -196,8 +236,19 @@ private:
     return pp;
   }
 
+  SpatialDiscretization spatial_discretization = SpatialDiscretization::DG;
+
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
+
+  bool use_merged_geometry_coefficients = false;
+  bool use_fixed_degree_kernels         = false;
+  bool use_dense_simplex_kernels        = false;
+
+  TaskParallelScheme task_parallel_scheme              = TaskParallelScheme::None;
+  bool               overlap_communication_computation = true;
+  unsigned int       n_threads                         = 1;
+  bool               pin_threads                       = false;
 };
 
 } // namespace Poisson
@@ -0,0 +1,63 @@
+#########################################################################
+# 
+#                 #######               ######  #######
+#                 ##                    ##   ## ##
+#                 #####   ##  ## #####  ##   ## ## ####
+#                 ##       ####  ## ##  ##   ## ##   ##
+#                 ####### ##  ## ###### ######  #######
+#
+#  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+#
+#  Copyright (C) 2021 by the ExaDG authors
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+#########################################################################
+
+# EXADG_ADD_BENCHMARK(<name> <target> <input>)
+#
+# Adds the benchmark <name> running the application target <target> with the input file <input>,
+# which has to write the performance report <name>.json ("PerformanceReport" in subsection
+# "General"). The report is compared against the reference report references/<name>.json in the
+# current source directory using the tolerances EXADG_BENCHMARK_TOLERANCE (relative deviation of
+# throughput numbers and wall times) and EXADG_BENCHMARK_TOLERANCE_ITERATIONS (relative increase of
+# the average number of iterations). The benchmark is available as ctest test with label
+# "benchmark" and as target <name>, which builds the application and runs the benchmark.
+MACRO(EXADG_ADD_BENCHMARK NAME TARGET INPUT)
+
+  ADD_TEST(NAME ${NAME}
+    COMMAND ${CMAKE_COMMAND}
+      -DCOMPARE=$<TARGET_FILE:compare_performance_report>
+      -DEXECUTABLE=$<TARGET_FILE:${TARGET}>
+      -DINPUT=${CMAKE_CURRENT_SOURCE_DIR}/${INPUT}
+      -DREPORT=${CMAKE_CURRENT_BINARY_DIR}/${NAME}.json
+      -DREFERENCE=${CMAKE_CURRENT_SOURCE_DIR}/references/${NAME}.json
+      -DTOLERANCE=${EXADG_BENCHMARK_TOLERANCE}
+      -DTOLERANCE_ITERATIONS=${EXADG_BENCHMARK_TOLERANCE_ITERATIONS}
+      -DUPDATE_REFERENCE=${EXADG_BENCHMARK_UPDATE_REFERENCES}
+      -P ${CMAKE_SOURCE_DIR}/tests/benchmarks/run_benchmark.cmake
+    WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+
+  SET_TESTS_PROPERTIES(${NAME} PROPERTIES LABELS "benchmark" RUN_SERIAL TRUE)
+
+  ADD_CUSTOM_TARGET(${NAME}
+    COMMAND ${CMAKE_CTEST_COMMAND} -R "^${NAME}$" --output-on-failure
+    DEPENDS ${TARGET} compare_performance_report
+    WORKING_DIRECTORY ${CMAKE_BINARY_DIR})
+
+  IF(TARGET benchmarks)
+    ADD_DEPENDENCIES(benchmarks ${NAME})
+  ENDIF()
+
+ENDMACRO(EXADG_ADD_BENCHMARK)
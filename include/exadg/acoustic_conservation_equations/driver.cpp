@@ -27,6 +27,7 @@
 // ExaDG
 #include <exadg/acoustic_conservation_equations/driver.h>
 #include <exadg/operators/throughput_parameters.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -83,6 +84,9 @@ Driver<dim, Number>::setup()
   }
 
   timer_tree.insert({"Acoustic conservation equations", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -115,6 +119,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -0,0 +1,507 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_FFOWCS_WILLIAMS_HAWKINGS_CALCULATOR_H_
+#define EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_FFOWCS_WILLIAMS_HAWKINGS_CALCULATOR_H_
+
+// C/C++
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <set>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace Acoustics
+{
+template<int dim>
+struct FfowcsWilliamsHawkingsData
+{
+  FfowcsWilliamsHawkingsData()
+    : directory("output/"),
+      filename("ffowcs_williams_hawkings.csv"),
+      speed_of_sound(-1.0),
+      observer_time_step(-1.0)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout) const
+  {
+    if(time_control_data.is_active)
+    {
+      pcout << std::endl << "  Ffowcs Williams-Hawkings far-field pressure:" << std::endl;
+
+      // only implemented for unsteady problem
+      time_control_data.print(pcout, true /*unsteady*/);
+
+      print_parameter(pcout, "Directory of output files", directory);
+      print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Number of surface boundary IDs", surface_boundary_ids.size());
+      print_parameter(pcout, "Number of observers", observer_points.size());
+      print_parameter(pcout, "Observer time step", observer_time_step);
+    }
+  }
+
+  TimeControlData time_control_data;
+
+  // directory and filename
+  std::string directory;
+  std::string filename;
+
+  // boundary IDs of the faces forming the closed permeable integration surface. The normal vectors
+  // of these faces have to point away from the sound sources.
+  std::set<dealii::types::boundary_id> surface_boundary_ids;
+
+  // far-field observer locations, which are typically outside the computational domain
+  std::vector<dealii::Point<dim>> observer_points;
+
+  double speed_of_sound;
+
+  // spacing of the observer time bins into which the surface contributions are sorted
+  double observer_time_step;
+};
+
+/*
+ * Far-field pressure by the Ffowcs Williams-Hawkings equation (formulation 1A of Farassat) for a
+ * stationary permeable surface in a medium at rest. Since the acoustic equations are linear, the
+ * mass flux and the momentum flux through the surface are Q = u * n and L = p n, with the
+ * velocity variable u = rho u' of the acoustic equations, and the pressure in the observer point x
+ * reads
+ *
+ *   4 pi p(x,t) = int_S [ dQ/dt / r + (n * r/|r|) (dp/dt / (c r) + p / r^2) ]_tau dS,
+ *
+ * with the distance r = |x - y| between the observer x and the surface point y, evaluated at the
+ * retarded time tau = t - r/c. The integral is accumulated incrementally: Each evaluation adds the
+ * contribution of the surface integrand emitted between the previous and the current evaluation,
+ * where the time derivatives are approximated by central differences at the midpoint, to the time
+ * bins of the observers in which this contribution is received. The received contributions are
+ * distributed to the two neighboring time bins by linear interpolation, such that the
+ * interpolation in retarded time is exact if the time between two evaluations equals the observer
+ * time step. The integrand is vectorized over the observers. Time bins that cannot receive further
+ * contributions are written to file and released, such that only the bins within the range of
+ * propagation times of the surface are stored. The formulation holds for three-dimensional
+ * problems only.
+ */
+template<int dim, typename Number>
+class FfowcsWilliamsHawkingsCalculator
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+  using scalar = dealii::VectorizedArray<Number>;
+  using vector = dealii::Tensor<1, dim, scalar>;
+
+  using FaceIntegratorU = FaceIntegrator<dim, dim, Number>;
+  using FaceIntegratorP = FaceIntegrator<dim, 1, Number>;
+
+public:
+  FfowcsWilliamsHawkingsCalculator(MPI_Comm const & comm)
+    : mpi_comm(comm),
+      clear_files(true),
+      matrix_free(nullptr),
+      dof_index_pressure(0),
+      dof_index_velocity(1),
+      quad_index(0),
+      n_q_points(0),
+      min_propagation_time(std::numeric_limits<double>::max()),
+      first_evaluation(true),
+      previous_time(0.0),
+      start_time_bins(0.0),
+      first_open_bin(0)
+  {
+  }
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        FfowcsWilliamsHawkingsData<dim> const & data_in,
+        unsigned int const                      dof_index_pressure_in,
+        unsigned int const                      dof_index_velocity_in,
+        unsigned int const                      quad_index_in)
+  {
+    time_control.setup(data_in.time_control_data);
+
+    matrix_free = &matrix_free_in;
+    data        = data_in;
+
+    dof_index_pressure = dof_index_pressure_in;
+    dof_index_velocity = dof_index_velocity_in;
+    quad_index         = quad_index_in;
+
+    if(data_in.time_control_data.is_active)
+    {
+      AssertThrow(dim == 3,
+                  dealii::ExcMessage("The Ffowcs Williams-Hawkings calculator is only implemented "
+                                     "for dim = 3."));
+      AssertThrow(data_in.speed_of_sound > 0.0,
+                  dealii::ExcMessage("Speed of sound not set in FfowcsWilliamsHawkingsData."));
+      AssertThrow(data_in.observer_time_step > 0.0,
+                  dealii::ExcMessage("Observer time step not set in FfowcsWilliamsHawkingsData."));
+      AssertThrow(data_in.observer_points.size() > 0 and data_in.surface_boundary_ids.size() > 0,
+                  dealii::ExcMessage("Observers and integration surface have to be specified in "
+                                     "FfowcsWilliamsHawkingsData."));
+
+      create_directories(data_in.directory, mpi_comm);
+
+      initialize_surface();
+    }
+  }
+
+  void
+  evaluate(VectorType const & pressure,
+           VectorType const & velocity,
+           double const &     time,
+           bool const         unsteady)
+  {
+    AssertThrow(unsteady,
+                dealii::ExcMessage(
+                  "This postprocessing tool can only be used for unsteady problems."));
+
+    do_evaluate(pressure, velocity, time);
+  }
+
+  TimeControl time_control;
+
+private:
+  void
+  initialize_surface()
+  {
+    unsigned int const n_lanes = scalar::size();
+
+    // observers in batches of the vectorization width, filled up with the last observer
+    unsigned int const n_observers = data.observer_points.size();
+    observer_batches.resize((n_observers + n_lanes - 1) / n_lanes);
+    for(unsigned int b = 0; b < observer_batches.size(); ++b)
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        unsigned int const o = std::min(b * n_lanes + v, n_observers - 1);
+        for(unsigned int d = 0; d < dim; ++d)
+          observer_batches[b][d][v] = data.observer_points[o][d];
+      }
+
+    unsigned int const begin = matrix_free->n_inner_face_batches();
+    unsigned int const end   = begin + matrix_free->n_boundary_face_batches();
+    for(unsigned int face = begin; face < end; ++face)
+      if(data.surface_boundary_ids.find(matrix_free->get_boundary_id(face)) !=
+         data.surface_boundary_ids.end())
+        surface_faces.push_back(face);
+
+    // the contributions received at an observer time t have been emitted after t - r_min/c
+    FaceIntegratorP integrator(*matrix_free, true, dof_index_pressure, quad_index);
+    n_q_points = integrator.n_q_points;
+
+    double min_distance = std::numeric_limits<double>::max();
+    for(unsigned int const face : surface_faces)
+    {
+      integrator.reinit(face);
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        dealii::Point<dim, scalar> const y = integrator.quadrature_point(q);
+        for(unsigned int v = 0; v < matrix_free->n_active_entries_per_face_batch(face); ++v)
+          for(dealii::Point<dim> const & x : data.observer_points)
+          {
+            double distance_square = 0.0;
+            for(unsigned int d = 0; d < dim; ++d)
+              distance_square += (x[d] - y[d][v]) * (x[d] - y[d][v]);
+            min_distance = std::min(min_distance, std::sqrt(distance_square));
+          }
+      }
+    }
+    min_distance = dealii::Utilities::MPI::min(min_distance, mpi_comm);
+
+    AssertThrow(min_distance < std::numeric_limits<double>::max(),
+                dealii::ExcMessage("No faces found with the given surface boundary IDs."));
+    AssertThrow(min_distance > 0.0,
+                dealii::ExcMessage("Observers must not be located on the integration surface."));
+
+    min_propagation_time = min_distance / data.speed_of_sound;
+
+    previous_pressure.resize(surface_faces.size() * n_q_points);
+    previous_flux.resize(surface_faces.size() * n_q_points);
+  }
+
+  void
+  do_evaluate(VectorType const & pressure, VectorType const & velocity, double const time)
+  {
+    if(first_evaluation)
+    {
+      start_time_bins = time;
+    }
+    else
+    {
+      AssertThrow(time > previous_time,
+                  dealii::ExcMessage("The Ffowcs Williams-Hawkings calculator requires increasing "
+                                     "evaluation times."));
+    }
+
+    integrate_surface(pressure, velocity, time);
+
+    first_evaluation = false;
+    previous_time    = time;
+
+    write_completed_bins(time);
+  }
+
+  /*
+   *  Adds the contributions emitted between the previous and the current evaluation, and stores
+   *  the current surface data for the next evaluation.
+   */
+  void
+  integrate_surface(VectorType const & pressure, VectorType const & velocity, double const time)
+  {
+    FaceIntegratorP pressure_integrator(*matrix_free, true, dof_index_pressure, quad_index);
+    FaceIntegratorU velocity_integrator(*matrix_free, true, dof_index_velocity, quad_index);
+
+    double const time_step     = time - previous_time;
+    double const emission_time = 0.5 * (time + previous_time);
+
+    for(unsigned int i = 0; i < surface_faces.size(); ++i)
+    {
+      unsigned int const face = surface_faces[i];
+
+      pressure_integrator.reinit(face);
+      pressure_integrator.gather_evaluate(pressure, dealii::EvaluationFlags::values);
+      velocity_integrator.reinit(face);
+      velocity_integrator.gather_evaluate(velocity, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        unsigned int const index = i * n_q_points + q;
+
+        vector const normal = pressure_integrator.normal_vector(q);
+        scalar const p      = pressure_integrator.get_value(q);
+        scalar const flux   = velocity_integrator.get_value(q) * normal;
+
+        if(not first_evaluation)
+        {
+          Number const time_step_inv = static_cast<Number>(1.0 / time_step);
+
+          SurfaceData surface_data;
+          surface_data.y         = pressure_integrator.quadrature_point(q);
+          surface_data.normal    = normal;
+          surface_data.JxW       = pressure_integrator.JxW(q);
+          surface_data.p         = Number{0.5} * (p + previous_pressure[index]);
+          surface_data.dp_dt     = (p - previous_pressure[index]) * time_step_inv;
+          surface_data.dflux_dt  = (flux - previous_flux[index]) * time_step_inv;
+          surface_data.n_active  = matrix_free->n_active_entries_per_face_batch(face);
+          surface_data.weight    = time_step / data.observer_time_step;
+          surface_data.emit_time = emission_time;
+
+          add_contributions(surface_data);
+        }
+
+        previous_pressure[index] = p;
+        previous_flux[index]     = flux;
+      }
+    }
+  }
+
+  struct SurfaceData
+  {
+    dealii::Point<dim, scalar> y;
+    vector                     normal;
+    scalar                     JxW;
+    scalar                     p;
+    scalar                     dp_dt;
+    scalar                     dflux_dt;
+    unsigned int               n_active;
+    double                     weight;
+    double                     emit_time;
+  };
+
+  /*
+   *  Evaluates the integrand of one batch of surface points for all observers, vectorized over
+   *  the observers, and sorts the contributions into the observer time bins.
+   */
+  void
+  add_contributions(SurfaceData const & s)
+  {
+    unsigned int const n_lanes     = scalar::size();
+    unsigned int const n_observers = data.observer_points.size();
+
+    Number const c_inv       = static_cast<Number>(1.0 / data.speed_of_sound);
+    Number const factor      = static_cast<Number>(0.25 / dealii::numbers::PI);
+    double const bin_inverse = 1.0 / data.observer_time_step;
+
+    for(unsigned int v = 0; v < s.n_active; ++v)
+    {
+      vector y, normal;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        y[d]      = s.y[d][v];
+        normal[d] = s.normal[d][v];
+      }
+
+      Number const JxW      = s.JxW[v];
+      Number const p        = s.p[v];
+      Number const dp_dt    = s.dp_dt[v];
+      Number const dflux_dt = s.dflux_dt[v];
+
+      for(unsigned int b = 0; b < observer_batches.size(); ++b)
+      {
+        vector const distance_vector = observer_batches[b] - y;
+        scalar const distance        = distance_vector.norm();
+        scalar const distance_inv    = Number{1.0} / distance;
+        scalar const cos_angle       = (distance_vector * normal) * distance_inv;
+
+        scalar const value =
+          factor * JxW * distance_inv *
+          (dflux_dt + cos_angle * (dp_dt * c_inv + p * distance_inv));
+
+        for(unsigned int l = 0; l < n_lanes and b * n_lanes + l < n_observers; ++l)
+        {
+          double const reception_time = s.emit_time + distance[l] * c_inv;
+
+          double const       position = (reception_time - start_time_bins) * bin_inverse;
+          unsigned int const bin      = static_cast<unsigned int>(std::floor(position));
+          double const       fraction = position - bin;
+
+          add_to_bin(bin, b * n_lanes + l, (1.0 - fraction) * s.weight * value[l]);
+          add_to_bin(bin + 1, b * n_lanes + l, fraction * s.weight * value[l]);
+        }
+      }
+    }
+  }
+
+  void
+  add_to_bin(unsigned int const bin, unsigned int const observer, double const value)
+  {
+    AssertThrow(bin >= first_open_bin,
+                dealii::ExcMessage("Contribution to a time bin that has already been written."));
+
+    while(signal.size() <= bin - first_open_bin)
+      signal.emplace_back(data.observer_points.size(), 0.0);
+
+    signal[bin - first_open_bin][observer] += value;
+  }
+
+  /*
+   *  Time bins t_b = start + b dt_obs are complete once all contributions emitted after the
+   *  current time arrive after t_b + dt_obs, i.e., for t_b <= time + r_min/c - dt_obs.
+   */
+  void
+  write_completed_bins(double const time)
+  {
+    double const last_complete_time =
+      time + min_propagation_time - data.observer_time_step - start_time_bins;
+    if(last_complete_time < 0.0)
+      return;
+
+    unsigned int const n_observers = data.observer_points.size();
+    unsigned int const end_bin =
+      1 + static_cast<unsigned int>(std::floor(last_complete_time / data.observer_time_step));
+    unsigned int const n_complete_bins = end_bin > first_open_bin ? end_bin - first_open_bin : 0;
+    if(n_complete_bins == 0)
+      return;
+
+    std::vector<double> values(n_complete_bins * n_observers, 0.0);
+    for(unsigned int b = 0; b < n_complete_bins and b < signal.size(); ++b)
+      for(unsigned int o = 0; o < n_observers; ++o)
+        values[b * n_observers + o] = signal[b][o];
+
+    dealii::Utilities::MPI::sum(values, mpi_comm, values);
+
+    // write output file
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      std::ostringstream filename;
+      filename << data.directory + data.filename;
+
+      std::ofstream f;
+      if(clear_files == true)
+      {
+        f.open(filename.str().c_str(), std::ios::trunc);
+        f << "Ffowcs Williams-Hawkings far-field pressure" << std::endl;
+        for(unsigned int o = 0; o < n_observers; ++o)
+          f << "Observer " << o << ": " << data.observer_points[o] << std::endl;
+        f << "Time, pressure at observers" << std::endl;
+        clear_files = false;
+      }
+      else
+      {
+        f.open(filename.str().c_str(), std::ios::app);
+      }
+
+      unsigned int precision = 12;
+      for(unsigned int b = 0; b < n_complete_bins; ++b)
+      {
+        f << std::scientific << std::setprecision(precision) << std::setw(precision + 8)
+          << start_time_bins + (first_open_bin + b) * data.observer_time_step;
+        for(unsigned int o = 0; o < n_observers; ++o)
+          f << ", " << std::setw(precision + 8) << values[b * n_observers + o];
+        f << std::endl;
+      }
+    }
+
+    // release the written bins
+    for(unsigned int b = 0; b < n_complete_bins and not signal.empty(); ++b)
+      signal.pop_front();
+    first_open_bin = end_bin;
+  }
+
+  MPI_Comm const mpi_comm;
+
+  bool clear_files;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+  FfowcsWilliamsHawkingsData<dim>         data;
+
+  unsigned int dof_index_pressure;
+  unsigned int dof_index_velocity;
+  unsigned int quad_index;
+
+  // boundary face batches of the integration surface
+  std::vector<unsigned int> surface_faces;
+  unsigned int              n_q_points;
+
+  std::vector<vector> observer_batches;
+
+  double min_propagation_time;
+
+  // surface data of the previous evaluation for the time derivatives
+  bool                          first_evaluation;
+  double                        previous_time;
+  dealii::AlignedVector<scalar> previous_pressure;
+  dealii::AlignedVector<scalar> previous_flux;
+
+  // observer signal of the time bins that have not been written yet, starting with first_open_bin
+  double                          start_time_bins;
+  unsigned int                    first_open_bin;
+  std::deque<std::vector<double>> signal;
+};
+
+} // namespace Acoustics
+} // namespace ExaDG
+
+#endif /* EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_FFOWCS_WILLIAMS_HAWKINGS_CALCULATOR_H_ \
+        */
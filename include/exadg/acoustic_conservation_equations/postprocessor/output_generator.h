@@ -22,6 +22,7 @@
 #ifndef EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 #define EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 
+#include <exadg/postprocessor/output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
@@ -79,6 +80,9 @@ private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  // mutable since the output is written in a const function
+  mutable OutputWriter<dim> output_writer;
 };
 
 } // namespace Acoustics
@@ -34,7 +34,8 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
     pointwise_output_generator(comm),
     error_calculator_p(comm),
     error_calculator_u(comm),
-    sound_energy_calculator(comm)
+    sound_energy_calculator(comm),
+    ffowcs_williams_hawkings_calculator(comm)
 
 {
 }
@@ -66,6 +67,22 @@ PostProcessor<dim, Number>::setup(AcousticsOperator const & pde_operator)
                                 pde_operator.get_dof_index_pressure(),
                                 pde_operator.get_dof_index_velocity(),
                                 pde_operator.get_quad_index_pressure());
+
+  if(pp_data.sound_energy_data.time_control_data.is_active and
+     pp_data.sound_energy_data.accumulate_during_operator_evaluation)
+  {
+    pde_operator.enable_sound_energy_accumulation();
+    sound_energy_calculator.set_energy_of_operator_evaluation(
+      [&pde_operator](double & energy, double const time) {
+        return pde_operator.get_sound_energy_of_last_evaluation(energy, time);
+      });
+  }
+
+  ffowcs_williams_hawkings_calculator.setup(pde_operator.get_matrix_free(),
+                                            pp_data.ffowcs_williams_hawkings_data,
+                                            pde_operator.get_dof_index_pressure(),
+                                            pde_operator.get_dof_index_velocity(),
+                                            pde_operator.get_quad_index_pressure());
 }
 
 template<int dim, typename Number>
@@ -116,6 +133,15 @@ PostProcessor<dim, Number>::do_postprocessing(BlockVectorType const & solution,
                                      solution.block(block_index_velocity),
                                      time,
                                      Utilities::is_unsteady_timestep(time_step_number));
+
+  /*
+   *  calculate far-field pressure
+   */
+  if(ffowcs_williams_hawkings_calculator.time_control.needs_evaluation(time, time_step_number))
+    ffowcs_williams_hawkings_calculator.evaluate(solution.block(block_index_pressure),
+                                                 solution.block(block_index_velocity),
+                                                 time,
+                                                 Utilities::is_unsteady_timestep(time_step_number));
 }
 
 template class PostProcessor<2, float>;
@@ -22,6 +22,7 @@
 #ifndef EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_POSTPROCESSOR_H_
 #define EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_POSTPROCESSOR_H_
 
+#include <exadg/acoustic_conservation_equations/postprocessor/ffowcs_williams_hawkings_calculator.h>
 #include <exadg/acoustic_conservation_equations/postprocessor/output_generator.h>
 #include <exadg/acoustic_conservation_equations/postprocessor/pointwise_output_generator.h>
 #include <exadg/acoustic_conservation_equations/postprocessor/postprocessor_base.h>
@@ -38,11 +39,12 @@ struct PostProcessorData
 {
   PostProcessorData() = default;
 
-  OutputData                output_data;
-  PointwiseOutputData<dim>  pointwise_output_data;
-  ErrorCalculationData<dim> error_data_p;
-  ErrorCalculationData<dim> error_data_u;
-  SoundEnergyCalculatorData sound_energy_data;
+  OutputData                      output_data;
+  PointwiseOutputData<dim>        pointwise_output_data;
+  ErrorCalculationData<dim>       error_data_p;
+  ErrorCalculationData<dim>       error_data_u;
+  SoundEnergyCalculatorData       sound_energy_data;
+  FfowcsWilliamsHawkingsData<dim> ffowcs_williams_hawkings_data;
 };
 
 template<int dim, typename Number>
@@ -86,6 +88,9 @@ private:
 
   // calculates the sound energy in the computational domain
   SoundEnergyCalculator<dim, Number> sound_energy_calculator;
+
+  // calculates the far-field pressure by a Ffowcs Williams-Hawkings surface integral
+  FfowcsWilliamsHawkingsCalculator<dim, Number> ffowcs_williams_hawkings_calculator;
 };
 
 
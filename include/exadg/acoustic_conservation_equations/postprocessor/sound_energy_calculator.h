@@ -30,6 +30,7 @@
 #include <exadg/utilities/print_functions.h>
 
 #include <fstream>
+#include <functional>
 
 namespace ExaDG
 {
@@ -41,6 +42,7 @@ struct SoundEnergyCalculatorData
     : directory("output/"),
       filename("sound_energy.csv"),
       clear_file(true),
+      accumulate_during_operator_evaluation(false),
       density(-1.0),
       speed_of_sound(-1.0)
   {
@@ -58,6 +60,9 @@ struct SoundEnergyCalculatorData
 
       print_parameter(pcout, "Directory of output files", directory);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout,
+                      "Accumulate during operator evaluation",
+                      accumulate_during_operator_evaluation);
     }
   }
 
@@ -68,6 +73,10 @@ struct SoundEnergyCalculatorData
   std::string filename;
   bool        clear_file;
 
+  // use the sound energy accumulated during the last evaluation of the acoustic operator if it has
+  // been evaluated for the solution to be postprocessed, instead of a separate loop over all cells
+  bool accumulate_during_operator_evaluation;
+
   double density;
   double speed_of_sound;
 };
@@ -136,13 +145,28 @@ public:
     do_evaluate(pressure, velocity, time);
   }
 
+  /*
+   * Sets a function returning true and the integral (1, p^2/(2 c^2) + u^2/2)_Omega of the solution
+   * at the given time if it is available from the last evaluation of the acoustic operator.
+   */
+  void
+  set_energy_of_operator_evaluation(
+    std::function<bool(double &, double const)> const & energy_of_operator_evaluation_in)
+  {
+    energy_of_operator_evaluation = energy_of_operator_evaluation_in;
+  }
+
   TimeControl time_control;
 
 private:
   void
   do_evaluate(VectorType const & pressure, VectorType const & velocity, double const time)
   {
-    double sound_energy = calculate_sound_energy(pressure, velocity);
+    double sound_energy = 0.0;
+    if(energy_of_operator_evaluation and energy_of_operator_evaluation(sound_energy, time))
+      sound_energy /= data.density;
+    else
+      sound_energy = calculate_sound_energy(pressure, velocity);
 
     // write output file
     if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
@@ -250,6 +274,8 @@ private:
   unsigned int dof_index_pressure;
   unsigned int dof_index_velocity;
   unsigned int quad_index;
+
+  std::function<bool(double &, double const)> energy_of_operator_evaluation;
 };
 
 } // namespace Acoustics
@@ -29,6 +29,8 @@
 #include <exadg/operators/resolution_parameters.h>
 #include <exadg/time_integration/resolution_parameters.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
 
 // application
 #include <exadg/acoustic_conservation_equations/user_interface/declare_get_application.h>
@@ -97,6 +99,8 @@ main(int argc, char ** argv)
 {
   dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
 
+  ExaDG::ProfilingSession profiling;
+
   MPI_Comm mpi_comm(MPI_COMM_WORLD);
 
   // new communicator
@@ -199,6 +203,9 @@ main(int argc, char ** argv)
   MPI_Comm_free(&sub_comm);
 #endif
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
   return 0;
 }
 
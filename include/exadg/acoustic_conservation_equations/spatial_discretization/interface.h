@@ -54,6 +54,16 @@ public:
 
   virtual double
   calculate_time_step_cfl() const = 0;
+
+  // local time stepping: evaluate, where the result only needs to be correct for the fine level
+  virtual void
+  evaluate_fine_level(BlockVectorType &       dst,
+                      BlockVectorType const & src,
+                      double const            time) const = 0;
+
+  // local time stepping: one for the degrees of freedom of the fine level, zero else
+  virtual void
+  initialize_fine_level_mask(BlockVectorType & mask) const = 0;
 };
 
 } // namespace Interface
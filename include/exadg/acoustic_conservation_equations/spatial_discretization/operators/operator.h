@@ -29,6 +29,7 @@
 #include <exadg/acoustic_conservation_equations/user_interface/enum_types.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/integrator_flags.h>
+#include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/mapping_flags.h>
 
 namespace ExaDG
@@ -176,6 +177,7 @@ class Operator
   using This = Operator<dim, Number>;
 
   using BlockVectorType = dealii::LinearAlgebra::distributed::BlockVector<Number>;
+  using VectorType      = dealii::LinearAlgebra::distributed::Vector<Number>;
 
   using scalar = dealii::VectorizedArray<Number>;
   using vector = dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>;
@@ -189,7 +191,20 @@ class Operator
   using FaceIntegratorP = FaceIntegrator<dim, 1, Number>;
 
 public:
-  Operator() : evaluation_time(Number{0.0}), tau(Number{0.0}), gamma(Number{0.0})
+  Operator()
+    : evaluation_time(Number{0.0}),
+      tau(Number{0.0}),
+      gamma(Number{0.0}),
+      fine_level_only(false),
+      inverse_mass_pressure(nullptr),
+      inverse_mass_velocity(nullptr),
+      quad_index_inverse_mass_pressure(0),
+      quad_index_inverse_mass_velocity(0),
+      pressure_source(nullptr),
+      accumulate_energy(false),
+      energy_is_valid(false),
+      energy_time(0.0),
+      energy(Number{0.0})
   {
   }
 
@@ -260,7 +275,233 @@ public:
     do_evaluate(dst, src, time, true);
   }
 
+  /*
+   * Local time stepping: determines the cell batches containing cells of the fine level, i.e.,
+   * cell_is_fine[cell->active_cell_index()] == true, and the face batches adjacent to these cells.
+   */
+  void
+  initialize_fine_level(std::vector<bool> const & cell_is_fine)
+  {
+    cell_batch_is_fine.assign(matrix_free->n_cell_batches(), false);
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+        if(cell_is_fine[matrix_free->get_cell_iterator(cell, v)->active_cell_index()])
+          cell_batch_is_fine[cell] = true;
+
+    unsigned int const n_inner_faces    = matrix_free->n_inner_face_batches();
+    unsigned int const n_boundary_faces = matrix_free->n_boundary_face_batches();
+    unsigned int const n_faces =
+      n_inner_faces + n_boundary_faces + matrix_free->n_ghost_inner_face_batches();
+
+    face_batch_is_fine.assign(n_faces, false);
+    for(unsigned int face = 0; face < n_faces; ++face)
+    {
+      bool const is_boundary_face =
+        face >= n_inner_faces and face < n_inner_faces + n_boundary_faces;
+
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_face_batch(face); ++v)
+      {
+        if(cell_is_fine[matrix_free->get_face_iterator(face, v, true).first->active_cell_index()])
+          face_batch_is_fine[face] = true;
+
+        if(not is_boundary_face and
+           cell_is_fine[matrix_free->get_face_iterator(face, v, false).first->active_cell_index()])
+          face_batch_is_fine[face] = true;
+      }
+    }
+  }
+
+  /*
+   * Same as evaluate(), but skips all cell and face batches not adjacent to the fine level, see
+   * initialize_fine_level(). The result is only correct for the degrees of freedom of the fine
+   * level.
+   */
+  void
+  evaluate_fine_level(BlockVectorType & dst, BlockVectorType const & src, double const time) const
+  {
+    AssertThrow(cell_batch_is_fine.size() == matrix_free->n_cell_batches(),
+                dealii::ExcMessage("The fine level has not been initialized."));
+
+    fine_level_only = true;
+    do_evaluate(dst, src, time, true);
+    fine_level_only = false;
+  }
+
+  /*
+   * Absorbing layer: stores the damping coefficient sigma(x) at the quadrature points of those
+   * cell batches where sigma does not vanish. The damping terms (q, sigma/c^2 p) and (v, sigma u)
+   * are added to the acoustic operator, i.e., the acoustic waves decay with the rate sigma inside
+   * the layer. For all other cell batches, neither memory nor work is spent on the layer.
+   */
+  void
+  initialize_absorbing_layer(dealii::Function<dim> const & damping)
+  {
+    CellIntegratorP integrator(*matrix_free, data.dof_index_pressure, data.quad_index);
+
+    layer_batch_index.assign(matrix_free->n_cell_batches(), dealii::numbers::invalid_unsigned_int);
+    layer_damping.clear();
+
+    dealii::AlignedVector<scalar> sigma(integrator.n_q_points);
+
+    unsigned int n_layer_batches = 0;
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+
+      bool is_in_layer = false;
+      for(unsigned int q : integrator.quadrature_point_indices())
+      {
+        sigma[q] =
+          FunctionEvaluator<0, dim, Number>::value(damping, integrator.quadrature_point(q));
+
+        for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+        {
+          AssertThrow(sigma[q][v] >= 0.0,
+                      dealii::ExcMessage("The damping of the absorbing layer has to be "
+                                         "non-negative."));
+
+          if(sigma[q][v] > 0.0)
+            is_in_layer = true;
+        }
+      }
+
+      if(is_in_layer)
+      {
+        layer_batch_index[cell] = n_layer_batches++;
+        layer_damping.insert_back(sigma.begin(), sigma.end());
+      }
+    }
+  }
+
+  /*
+   * Cell-based face loops: sets the inverse mass operators applied by
+   * evaluate_scaled_inverse_mass(). The inverse mass operators have to be cell-local, see
+   * InverseMassOperator::is_cell_local(), and are initialized with the quadrature rules
+   * quad_index_pressure and quad_index_velocity.
+   */
+  void
+  initialize_inverse_mass(InverseMassOperator<dim, 1, Number> const &   inverse_mass_pressure_in,
+                          unsigned int const                            quad_index_pressure,
+                          InverseMassOperator<dim, dim, Number> const & inverse_mass_velocity_in,
+                          unsigned int const                            quad_index_velocity)
+  {
+    AssertThrow(inverse_mass_pressure_in.is_cell_local() and
+                  inverse_mass_velocity_in.is_cell_local(),
+                dealii::ExcMessage("The inverse mass operators can not be applied cell by cell."));
+
+    inverse_mass_pressure            = &inverse_mass_pressure_in;
+    inverse_mass_velocity            = &inverse_mass_velocity_in;
+    quad_index_inverse_mass_pressure = quad_index_pressure;
+    quad_index_inverse_mass_velocity = quad_index_velocity;
+  }
+
+  /*
+   * Evaluates the acoustic operator A and the inverse mass operators in a single loop over the
+   * cells,
+   *
+   *   dst = diag(c^2 M_p^-1, M_u^-1) (b - A(src)),
+   *
+   * where the optional vector source_pressure b contains the right-hand side of the pressure
+   * equation. The face integrals are computed from the perspective of each cell such that the
+   * residual of a cell is complete after its faces have been visited and can be multiplied by the
+   * cell-local inverse mass before it is written to dst. Hence, the pressure and velocity vectors
+   * are streamed from memory only once. This requires a MatrixFree object set up for cell-based
+   * face loops, see Categorization::do_cell_based_loops(), and initialize_inverse_mass(). src and
+   * dst must not be the same vector.
+   */
+  void
+  evaluate_scaled_inverse_mass(BlockVectorType &       dst,
+                               BlockVectorType const & src,
+                               VectorType const *      source_pressure,
+                               double const            time) const
+  {
+    AssertThrow(inverse_mass_pressure != nullptr and inverse_mass_velocity != nullptr,
+                dealii::ExcMessage("The inverse mass operators have not been initialized."));
+    AssertThrow(&dst != &src, dealii::ExcMessage("src and dst must not be the same vector."));
+
+    evaluation_time = (Number)time;
+    pressure_source = source_pressure;
+    reset_energy(time);
+
+    matrix_free->loop_cell_centric(&This::cell_based_loop_inverse_mass,
+                                   this,
+                                   dst,
+                                   src,
+                                   false /* the cells overwrite their entries of dst */,
+                                   dealii::MatrixFree<dim, Number>::DataAccessOnFaces::values);
+
+    pressure_source = nullptr;
+  }
+
+  /*
+   * Sound energy: the integral (1, p^2/(2 c^2) + u^2/2)_Omega of src, i.e., the sound energy
+   * multiplied by the density, is accumulated on the fly during each subsequent evaluation of the
+   * operator. Since the values of p and u are available at the quadrature points of the cell
+   * integrals anyway, this is much cheaper than a separate loop over all cells.
+   */
+  void
+  enable_energy_accumulation() const
+  {
+    accumulate_energy = true;
+  }
+
+  /*
+   * Returns false if the last evaluation did not compute the integral of src over all cells.
+   * Otherwise, energy_out holds the contribution of the locally owned cells and time_out the
+   * evaluation time.
+   */
+  bool
+  get_energy_of_last_evaluation(double & energy_out, double & time_out) const
+  {
+    energy_out = energy;
+    time_out   = energy_time;
+
+    return energy_is_valid;
+  }
+
 private:
+  void
+  reset_energy(double const time) const
+  {
+    energy          = Number{0.0};
+    energy_time     = time;
+    energy_is_valid = accumulate_energy and not fine_level_only;
+  }
+
+  /*
+   * Additional evaluation flags of the cell integrators needed for the sound energy.
+   */
+  dealii::EvaluationFlags::EvaluationFlags
+  get_energy_evaluation_flags() const
+  {
+    return energy_is_valid ? dealii::EvaluationFlags::values : dealii::EvaluationFlags::nothing;
+  }
+
+  /*
+   * Adds the sound energy of the cell batch to energy. This has to be called before the values at
+   * the quadrature points are overwritten by do_cell_integral().
+   */
+  void
+  do_cell_integral_energy(CellIntegratorP const & pressure,
+                          CellIntegratorU const & velocity,
+                          unsigned int const      cell) const
+  {
+    Number const inverse_c_square = (Number)(1.0 / (data.speed_of_sound * data.speed_of_sound));
+
+    scalar energy_batch = Number{0.0};
+    for(unsigned int q : pressure.quadrature_point_indices())
+    {
+      scalar const p = pressure.get_value(q);
+      vector const u = velocity.get_value(q);
+
+      energy_batch += Number{0.5} * (inverse_c_square * p * p + u * u) * pressure.JxW(q);
+    }
+
+    // sum over active entries of dealii::VectorizedArray
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      energy += energy_batch[v];
+  }
+
   void
   do_evaluate(BlockVectorType &       dst,
               BlockVectorType const & src,
@@ -268,6 +509,7 @@ private:
               bool const              zero_dst_vector) const
   {
     evaluation_time = (Number)time;
+    reset_energy(time);
 
     matrix_free->loop(&This::cell_loop,
                       &This::face_loop,
@@ -394,6 +636,39 @@ private:
     }
   }
 
+  bool
+  batch_is_in_layer(unsigned int const cell) const
+  {
+    return not layer_batch_index.empty() and
+           layer_batch_index[cell] != dealii::numbers::invalid_unsigned_int;
+  }
+
+  /*
+   * Absorbing layer: replaces the DoF values of the integrators, which have been reinitialized for
+   * a cell batch in the layer, by the integrated damping terms.
+   */
+  void
+  do_cell_integral_absorbing_layer(CellIntegratorP &  pressure,
+                                   CellIntegratorU &  velocity,
+                                   unsigned int const cell) const
+  {
+    scalar const * sigma = &layer_damping[layer_batch_index[cell] * pressure.n_q_points];
+
+    Number const inverse_c_square = (Number)(1.0 / (data.speed_of_sound * data.speed_of_sound));
+
+    pressure.evaluate(dealii::EvaluationFlags::values);
+    velocity.evaluate(dealii::EvaluationFlags::values);
+
+    for(unsigned int q : pressure.quadrature_point_indices())
+    {
+      pressure.submit_value(inverse_c_square * sigma[q] * pressure.get_value(q), q);
+      velocity.submit_value(sigma[q] * velocity.get_value(q), q);
+    }
+
+    pressure.integrate(dealii::EvaluationFlags::values);
+    velocity.integrate(dealii::EvaluationFlags::values);
+  }
+
   void
   cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free_in,
             BlockVectorType &                       dst,
@@ -405,13 +680,19 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(fine_level_only and not cell_batch_is_fine[cell])
+        continue;
+
       pressure.reinit(cell);
       pressure.gather_evaluate(src.block(data.block_index_pressure),
-                               integrator_flags_p.cell_evaluate);
+                               integrator_flags_p.cell_evaluate | get_energy_evaluation_flags());
 
       velocity.reinit(cell);
       velocity.gather_evaluate(src.block(data.block_index_velocity),
-                               integrator_flags_u.cell_evaluate);
+                               integrator_flags_u.cell_evaluate | get_energy_evaluation_flags());
+
+      if(energy_is_valid)
+        do_cell_integral_energy(pressure, velocity, cell);
 
       do_cell_integral(pressure, velocity);
 
@@ -419,6 +700,17 @@ private:
                                  dst.block(data.block_index_pressure));
       velocity.integrate_scatter(integrator_flags_u.cell_integrate,
                                  dst.block(data.block_index_velocity));
+
+      if(batch_is_in_layer(cell))
+      {
+        pressure.read_dof_values(src.block(data.block_index_pressure));
+        velocity.read_dof_values(src.block(data.block_index_velocity));
+
+        do_cell_integral_absorbing_layer(pressure, velocity, cell);
+
+        pressure.distribute_local_to_global(dst.block(data.block_index_pressure));
+        velocity.distribute_local_to_global(dst.block(data.block_index_velocity));
+      }
     }
   }
 
@@ -436,6 +728,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(fine_level_only and not face_batch_is_fine[face])
+        continue;
+
       pressure_m.reinit(face);
       pressure_m.gather_evaluate(src.block(data.block_index_pressure),
                                  integrator_flags_p.face_evaluate);
@@ -481,6 +776,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(fine_level_only and not face_batch_is_fine[face])
+        continue;
+
       pressure_m.reinit(face);
       pressure_m.gather_evaluate(src.block(data.block_index_pressure),
                                  integrator_flags_p.face_evaluate);
@@ -500,6 +798,163 @@ private:
     }
   }
 
+  void
+  cell_based_loop_inverse_mass(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                               BlockVectorType &                       dst,
+                               BlockVectorType const &                 src,
+                               Range const &                           cell_range) const
+  {
+    CellIntegratorP pressure(matrix_free_in, data.dof_index_pressure, data.quad_index);
+    CellIntegratorU velocity(matrix_free_in, data.dof_index_velocity, data.quad_index);
+
+    FaceIntegratorP pressure_m(matrix_free_in, true, data.dof_index_pressure, data.quad_index);
+    FaceIntegratorP pressure_p(matrix_free_in, false, data.dof_index_pressure, data.quad_index);
+
+    FaceIntegratorU velocity_m(matrix_free_in, true, data.dof_index_velocity, data.quad_index);
+    FaceIntegratorU velocity_p(matrix_free_in, false, data.dof_index_velocity, data.quad_index);
+
+    BoundaryFaceIntegratorP<dim, Number> pressure_bc(pressure_m, *data.bc);
+    BoundaryFaceIntegratorU<dim, Number> velocity_bc(velocity_m,
+                                                     pressure_m,
+                                                     data.speed_of_sound,
+                                                     *data.bc);
+
+    // the inverse mass operators require integrators with their own quadrature rules
+    CellIntegratorP pressure_mass(matrix_free_in,
+                                  data.dof_index_pressure,
+                                  quad_index_inverse_mass_pressure);
+    CellIntegratorU velocity_mass(matrix_free_in,
+                                  data.dof_index_velocity,
+                                  quad_index_inverse_mass_velocity);
+
+    unsigned int const dofs_per_cell_p = pressure.dofs_per_cell;
+    unsigned int const dofs_per_cell_u = velocity.dofs_per_cell;
+
+    // DoF values of the cell read from src and the residual of the cell
+    dealii::AlignedVector<scalar> src_p(dofs_per_cell_p), src_u(dofs_per_cell_u);
+    dealii::AlignedVector<scalar> residual_p(dofs_per_cell_p), residual_u(dofs_per_cell_u);
+
+    Number const c_square = (Number)(data.speed_of_sound * data.speed_of_sound);
+
+    unsigned int const n_faces = dealii::ReferenceCells::template get_hypercube<dim>().n_faces();
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      pressure.reinit(cell);
+      pressure.read_dof_values(src.block(data.block_index_pressure));
+      for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+        src_p[i] = pressure.begin_dof_values()[i];
+      pressure.evaluate(integrator_flags_p.cell_evaluate | get_energy_evaluation_flags());
+
+      velocity.reinit(cell);
+      velocity.read_dof_values(src.block(data.block_index_velocity));
+      for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+        src_u[i] = velocity.begin_dof_values()[i];
+      velocity.evaluate(integrator_flags_u.cell_evaluate | get_energy_evaluation_flags());
+
+      if(energy_is_valid)
+        do_cell_integral_energy(pressure, velocity, cell);
+
+      do_cell_integral(pressure, velocity);
+
+      pressure.integrate(integrator_flags_p.cell_integrate);
+      for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+        residual_p[i] = pressure.begin_dof_values()[i];
+
+      velocity.integrate(integrator_flags_u.cell_integrate);
+      for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+        residual_u[i] = velocity.begin_dof_values()[i];
+
+      if(batch_is_in_layer(cell))
+      {
+        for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+          pressure.begin_dof_values()[i] = src_p[i];
+        for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+          velocity.begin_dof_values()[i] = src_u[i];
+
+        do_cell_integral_absorbing_layer(pressure, velocity, cell);
+
+        for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+          residual_p[i] += pressure.begin_dof_values()[i];
+        for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+          residual_u[i] += velocity.begin_dof_values()[i];
+      }
+
+      // face integrals, reusing the DoF values of the cell for the interior side
+      for(unsigned int face = 0; face < n_faces; ++face)
+      {
+        auto const bid = matrix_free_in.get_faces_by_cells_boundary_id(cell, face)[0];
+
+        pressure_m.reinit(cell, face);
+        for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+          pressure_m.begin_dof_values()[i] = src_p[i];
+        pressure_m.evaluate(integrator_flags_p.face_evaluate);
+
+        velocity_m.reinit(cell, face);
+        for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+          velocity_m.begin_dof_values()[i] = src_u[i];
+        velocity_m.evaluate(integrator_flags_u.face_evaluate);
+
+        if(bid == dealii::numbers::internal_face_boundary_id) // internal face
+        {
+          pressure_p.reinit(cell, face);
+          pressure_p.gather_evaluate(src.block(data.block_index_pressure),
+                                     integrator_flags_p.face_evaluate);
+
+          velocity_p.reinit(cell, face);
+          velocity_p.gather_evaluate(src.block(data.block_index_velocity),
+                                     integrator_flags_u.face_evaluate);
+
+          do_face_integral<false>(pressure_m, pressure_p, velocity_m, velocity_p);
+        }
+        else // boundary face
+        {
+          pressure_bc.reinit(cell, face, evaluation_time);
+          velocity_bc.reinit(cell, face, evaluation_time);
+
+          do_face_integral<false>(pressure_m, pressure_bc, velocity_m, velocity_bc);
+        }
+
+        pressure_m.integrate(integrator_flags_p.face_integrate);
+        for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+          residual_p[i] += pressure_m.begin_dof_values()[i];
+
+        velocity_m.integrate(integrator_flags_u.face_integrate);
+        for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+          residual_u[i] += velocity_m.begin_dof_values()[i];
+      }
+
+      // pressure: c^2 M_p^-1 (b - A(src))
+      pressure_mass.reinit(cell);
+      if(pressure_source != nullptr)
+      {
+        pressure_mass.read_dof_values(*pressure_source);
+        for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+          pressure_mass.begin_dof_values()[i] -= residual_p[i];
+      }
+      else
+      {
+        for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+          pressure_mass.begin_dof_values()[i] = -residual_p[i];
+      }
+
+      inverse_mass_pressure->apply_on_cell(pressure_mass);
+
+      for(unsigned int i = 0; i < dofs_per_cell_p; ++i)
+        pressure_mass.begin_dof_values()[i] *= c_square;
+      pressure_mass.set_dof_values(dst.block(data.block_index_pressure));
+
+      // velocity: M_u^-1 (- A(src))
+      velocity_mass.reinit(cell);
+      for(unsigned int i = 0; i < dofs_per_cell_u; ++i)
+        velocity_mass.begin_dof_values()[i] = -residual_u[i];
+
+      inverse_mass_velocity->apply_on_cell(velocity_mass);
+
+      velocity_mass.set_dof_values(dst.block(data.block_index_velocity));
+    }
+  }
+
   Operators::Kernel<dim, Number> kernel;
 
   mutable Number evaluation_time;
@@ -512,6 +967,29 @@ private:
 
   IntegratorFlags integrator_flags_p;
   IntegratorFlags integrator_flags_u;
+
+  // local time stepping
+  std::vector<bool> cell_batch_is_fine;
+  std::vector<bool> face_batch_is_fine;
+  mutable bool      fine_level_only;
+
+  // absorbing layer: index of the cell batches in layer_damping (invalid_unsigned_int outside the
+  // layer) and the damping coefficient at the quadrature points of the cell batches in the layer
+  std::vector<unsigned int>     layer_batch_index;
+  dealii::AlignedVector<scalar> layer_damping;
+
+  // cell-based face loops with fused inverse mass operators
+  InverseMassOperator<dim, 1, Number> const *   inverse_mass_pressure;
+  InverseMassOperator<dim, dim, Number> const * inverse_mass_velocity;
+  unsigned int                                  quad_index_inverse_mass_pressure;
+  unsigned int                                  quad_index_inverse_mass_velocity;
+  mutable VectorType const *                    pressure_source;
+
+  // sound energy of src accumulated during the evaluation
+  mutable bool   accumulate_energy;
+  mutable bool   energy_is_valid;
+  mutable double energy_time;
+  mutable Number energy;
 };
 
 } // namespace Acoustics
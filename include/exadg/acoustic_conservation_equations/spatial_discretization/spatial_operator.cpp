@@ -25,6 +25,7 @@
 // ExaDG
 #include <exadg/acoustic_conservation_equations/spatial_discretization/spatial_operator.h>
 #include <exadg/grid/mapping_dof_vector.h>
+#include <exadg/matrix_free/categorization.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
@@ -53,6 +54,9 @@ SpatialOperator<dim, Number>::SpatialOperator(
     dof_handler_p(*grid_in->triangulation),
     dof_handler_u(*grid_in->triangulation),
     aero_acoustic_source_term(nullptr),
+    aero_acoustic_source_term_previous(nullptr),
+    time_source_term(0.0),
+    time_source_term_previous(0.0),
     mpi_comm(mpi_comm_in),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0)
 {
@@ -62,6 +66,12 @@ SpatialOperator<dim, Number>::SpatialOperator(
 
   initialize_dof_handler_and_constraints();
 
+  if(param.local_time_stepping)
+    initialize_local_time_stepping_levels();
+
+  if(param.absorbing_layer)
+    initialize_absorbing_layer_cells();
+
   pcout << std::endl << "... done!" << std::endl << std::flush;
 }
 
@@ -85,6 +95,30 @@ SpatialOperator<dim, Number>::fill_matrix_free_data(
     matrix_free_data.append_mapping_flags(flags_cfl);
   }
 
+  // mapping flags required for the damping of the absorbing layer
+  if(param.absorbing_layer)
+  {
+    MappingFlags flags_layer;
+    flags_layer.cells = dealii::update_quadrature_points;
+    matrix_free_data.append_mapping_flags(flags_layer);
+  }
+
+  // group the cells of the fine level in cell batches to reduce the work of evaluate_fine_level(),
+  // and the cells of the absorbing layer to reduce the work and memory of the damping terms
+  if(param.local_time_stepping or param.absorbing_layer)
+  {
+    std::vector<unsigned int> & category = matrix_free_data.data.cell_vectorization_category;
+    category.assign(grid->triangulation->n_active_cells(), 0);
+    for(unsigned int i = 0; i < category.size(); ++i)
+    {
+      if(param.local_time_stepping and cell_is_fine[i])
+        category[i] += 1;
+      if(param.absorbing_layer and cell_is_in_layer[i])
+        category[i] += 2;
+    }
+    matrix_free_data.data.cell_vectorization_categories_strict = false;
+  }
+
   // dof handler
   matrix_free_data.insert_dof_handler(&dof_handler_p, field + dof_index_p);
   matrix_free_data.insert_dof_handler(&dof_handler_u, field + dof_index_u);
@@ -121,12 +155,17 @@ SpatialOperator<dim, Number>::setup()
 
   fill_matrix_free_data(*mf_data);
 
+  if(param.use_cell_based_face_loops)
+    Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
+
   mf->reinit(*get_mapping(),
              mf_data->get_dof_handler_vector(),
              mf_data->get_constraint_vector(),
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
+  memory_matrix_free.set(mf->memory_consumption());
+
   // Subsequently, call the other setup function with MatrixFree/MatrixFreeData objects as
   // arguments.
   this->setup(mf, mf_data);
@@ -320,7 +359,51 @@ void
 SpatialOperator<dim, Number>::set_aero_acoustic_source_term(
   VectorType const & aero_acoustic_source_term_in)
 {
-  aero_acoustic_source_term = &aero_acoustic_source_term_in;
+  aero_acoustic_source_term          = &aero_acoustic_source_term_in;
+  aero_acoustic_source_term_previous = nullptr;
+}
+
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::set_aero_acoustic_source_term(
+  VectorType const & aero_acoustic_source_term_in,
+  double const       time_in,
+  VectorType const & aero_acoustic_source_term_previous_in,
+  double const       time_previous_in)
+{
+  AssertThrow(time_in > time_previous_in,
+              dealii::ExcMessage("The source terms have to be given at increasing times."));
+
+  aero_acoustic_source_term          = &aero_acoustic_source_term_in;
+  aero_acoustic_source_term_previous = &aero_acoustic_source_term_previous_in;
+  time_source_term                   = time_in;
+  time_source_term_previous          = time_previous_in;
+}
+
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::add_aero_acoustic_source_term(VectorType & dst,
+                                                            double const time) const
+{
+  AssertThrow(aero_acoustic_source_term,
+              dealii::ExcMessage("Aero-acoustic source term not valid."));
+
+  if(aero_acoustic_source_term_previous == nullptr)
+  {
+    dst += *aero_acoustic_source_term;
+  }
+  else
+  {
+    // linear interpolation in time, which turns into an extrapolation for times beyond the time of
+    // the latest source term
+    double const factor =
+      (time - time_source_term_previous) / (time_source_term - time_source_term_previous);
+
+    dst.add(static_cast<Number>(factor),
+            *aero_acoustic_source_term,
+            static_cast<Number>(1.0 - factor),
+            *aero_acoustic_source_term_previous);
+  }
 }
 
 template<int dim, typename Number>
@@ -329,6 +412,28 @@ SpatialOperator<dim, Number>::evaluate(BlockVectorType &       dst,
                                        BlockVectorType const & src,
                                        double const            time) const
 {
+  if(param.use_cell_based_face_loops)
+  {
+    // the right-hand side of the pressure equation is added within the fused loop
+    VectorType const * source_pressure = nullptr;
+    if(param.right_hand_side or param.aero_acoustic_source_term)
+    {
+      pressure_source = 0.0;
+
+      if(param.right_hand_side)
+        rhs_operator.evaluate_add(pressure_source, time);
+
+      if(param.aero_acoustic_source_term)
+        add_aero_acoustic_source_term(pressure_source, time);
+
+      source_pressure = &pressure_source;
+    }
+
+    acoustic_operator.evaluate_scaled_inverse_mass(dst, src, source_pressure, time);
+
+    return;
+  }
+
   evaluate_acoustic_operator(dst, src, time);
 
   // shift to the right-hand side of the equation
@@ -338,15 +443,67 @@ SpatialOperator<dim, Number>::evaluate(BlockVectorType &       dst,
     rhs_operator.evaluate_add(dst.block(block_index_pressure), time);
 
   if(param.aero_acoustic_source_term)
-  {
-    AssertThrow(aero_acoustic_source_term,
-                dealii::ExcMessage("Aero-acoustic source term not valid."));
-    dst.block(block_index_pressure) += *aero_acoustic_source_term;
-  }
+    add_aero_acoustic_source_term(dst.block(block_index_pressure), time);
 
   apply_scaled_inverse_mass_operator(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::evaluate_fine_level(BlockVectorType &       dst,
+                                                  BlockVectorType const & src,
+                                                  double const            time) const
+{
+  acoustic_operator.evaluate_fine_level(dst, src, time);
+
+  // shift to the right-hand side of the equation
+  dst *= -1.0;
+
+  if(param.right_hand_side)
+    rhs_operator.evaluate_add(dst.block(block_index_pressure), time);
+
+  if(param.aero_acoustic_source_term)
+    add_aero_acoustic_source_term(dst.block(block_index_pressure), time);
+
+  apply_scaled_inverse_mass_operator(dst, dst);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::initialize_fine_level_mask(BlockVectorType & mask) const
+{
+  AssertThrow(param.local_time_stepping,
+              dealii::ExcMessage("Local time stepping has not been enabled."));
+
+  initialize_dof_vector(mask);
+
+  CellIntegrator<dim, 1, Number>   pressure(*matrix_free,
+                                          get_dof_index_pressure(),
+                                          get_quad_index_pressure());
+  CellIntegrator<dim, dim, Number> velocity(*matrix_free,
+                                            get_dof_index_velocity(),
+                                            get_quad_index_velocity());
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    dealii::VectorizedArray<Number> is_fine = 0.0;
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      if(cell_is_fine[matrix_free->get_cell_iterator(cell, v)->active_cell_index()])
+        is_fine[v] = 1.0;
+
+    // the degrees of freedom are not shared between cells for discontinuous elements
+    pressure.reinit(cell);
+    for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+      pressure.begin_dof_values()[i] = is_fine;
+    pressure.set_dof_values(mask.block(block_index_pressure));
+
+    velocity.reinit(cell);
+    for(unsigned int i = 0; i < velocity.dofs_per_cell; ++i)
+      velocity.begin_dof_values()[i] = is_fine;
+    velocity.set_dof_values(mask.block(block_index_velocity));
+  }
+}
+
 template<int dim, typename Number>
 void
 SpatialOperator<dim, Number>::evaluate_acoustic_operator(BlockVectorType &       dst,
@@ -367,6 +524,35 @@ SpatialOperator<dim, Number>::apply_scaled_inverse_mass_operator(BlockVectorType
   inverse_mass_velocity.apply(dst.block(block_index_velocity), src.block(block_index_velocity));
 }
 
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::enable_sound_energy_accumulation() const
+{
+  AssertThrow(not param.local_time_stepping and not param.exponential_integrator,
+              dealii::ExcMessage("The sound energy can only be accumulated during the operator "
+                                 "evaluation for the Adams-Bashforth-Moulton scheme without "
+                                 "local time stepping."));
+
+  acoustic_operator.enable_energy_accumulation();
+}
+
+template<int dim, typename Number>
+bool
+SpatialOperator<dim, Number>::get_sound_energy_of_last_evaluation(double &     energy,
+                                                                  double const time) const
+{
+  double     energy_time = 0.0;
+  bool const is_valid    = acoustic_operator.get_energy_of_last_evaluation(energy, energy_time);
+
+  // the same time step sizes are added up in the time integrator and for the evaluation time
+  if(not is_valid or std::abs(energy_time - time) > 1.e-12 * std::max(1.0, std::abs(time)))
+    return false;
+
+  energy = dealii::Utilities::MPI::sum(energy, mpi_comm);
+
+  return true;
+}
+
 template<int dim, typename Number>
 double
 SpatialOperator<dim, Number>::calculate_time_step_cfl() const
@@ -425,6 +611,77 @@ SpatialOperator<dim, Number>::initialize_dof_handler_and_constraints()
   pcout << std::flush;
 }
 
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::initialize_local_time_stepping_levels()
+{
+  dealii::Triangulation<dim> const & triangulation = *grid->triangulation;
+
+  double h_min = std::numeric_limits<double>::max();
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned())
+      h_min = std::min(h_min, cell->minimum_vertex_distance());
+  h_min = dealii::Utilities::MPI::min(h_min, mpi_comm);
+
+  // ghost cells are included since the fine level determines the work on faces between processes
+  cell_is_fine.assign(triangulation.n_active_cells(), false);
+  unsigned int n_cells_fine = 0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_artificial())
+      continue;
+
+    bool const is_fine =
+      cell->minimum_vertex_distance() < param.n_substeps_local_time_stepping * h_min;
+
+    cell_is_fine[cell->active_cell_index()] = is_fine;
+
+    if(is_fine and cell->is_locally_owned())
+      ++n_cells_fine;
+  }
+
+  n_cells_fine = dealii::Utilities::MPI::sum(n_cells_fine, mpi_comm);
+
+  pcout << std::endl << "Local time stepping:" << std::endl;
+  print_parameter(pcout, "number of cells (fine level)", n_cells_fine);
+  print_parameter(pcout, "number of cells (total)", triangulation.n_global_active_cells());
+}
+
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::initialize_absorbing_layer_cells()
+{
+  AssertThrow(field_functions->absorbing_layer_damping,
+              dealii::ExcMessage("The damping of the absorbing layer has not been specified."));
+
+  dealii::Function<dim> const & damping = *field_functions->absorbing_layer_damping;
+
+  dealii::Triangulation<dim> const & triangulation = *grid->triangulation;
+
+  cell_is_in_layer.assign(triangulation.n_active_cells(), false);
+  unsigned int n_cells_layer = 0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_artificial())
+      continue;
+
+    bool is_in_layer = damping.value(cell->center()) > 0.0;
+    for(unsigned int const v : cell->vertex_indices())
+      is_in_layer = is_in_layer or damping.value(cell->vertex(v)) > 0.0;
+
+    cell_is_in_layer[cell->active_cell_index()] = is_in_layer;
+
+    if(is_in_layer and cell->is_locally_owned())
+      ++n_cells_layer;
+  }
+
+  n_cells_layer = dealii::Utilities::MPI::sum(n_cells_layer, mpi_comm);
+
+  pcout << std::endl << "Absorbing layer:" << std::endl;
+  print_parameter(pcout, "number of cells (layer)", n_cells_layer);
+  print_parameter(pcout, "number of cells (total)", triangulation.n_global_active_cells());
+}
+
 template<int dim, typename Number>
 void
 SpatialOperator<dim, Number>::initialize_operators()
@@ -457,6 +714,24 @@ SpatialOperator<dim, Number>::initialize_operators()
     data.formulation          = param.formulation;
     data.bc                   = boundary_descriptor;
     acoustic_operator.initialize(*matrix_free, data);
+
+    if(param.local_time_stepping)
+      acoustic_operator.initialize_fine_level(cell_is_fine);
+
+    if(param.absorbing_layer)
+      acoustic_operator.initialize_absorbing_layer(*field_functions->absorbing_layer_damping);
+  }
+
+  // fused evaluation of the acoustic operator and the inverse mass operators
+  if(param.use_cell_based_face_loops)
+  {
+    acoustic_operator.initialize_inverse_mass(inverse_mass_pressure,
+                                              get_quad_index_pressure(),
+                                              inverse_mass_velocity,
+                                              get_quad_index_velocity());
+
+    if(param.right_hand_side or param.aero_acoustic_source_term)
+      initialize_dof_vector_pressure(pressure_source);
   }
 
   // rhs operator
@@ -38,6 +38,7 @@
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/rhs_operator.h>
 #include <exadg/utilities/lazy_ptr.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -164,16 +165,42 @@ public:
   void
   set_aero_acoustic_source_term(VectorType const & aero_acoustic_source_term_in);
 
+  /*
+   * Set aero-acoustic source terms at two instants of time. Whenever the operator is evaluated,
+   * the source term is interpolated linearly in time between these two source terms, or
+   * extrapolated for times beyond time_in. This allows to perform several time steps of the
+   * acoustic solver between two evaluations of the source term.
+   */
+  void
+  set_aero_acoustic_source_term(VectorType const & aero_acoustic_source_term_in,
+                                double const       time_in,
+                                VectorType const & aero_acoustic_source_term_previous_in,
+                                double const       time_previous_in);
+
   /*
    *  This function is used in case of explicit time integration:
    *  This function evaluates the right-hand side operator, the
    *  convective and viscous terms (subsequently multiplied by -1.0 in order
    *  to shift these terms to the right-hand side of the equations)
-   *  and finally applies the inverse mass operator.
+   *  and finally applies the inverse mass operator. With cell-based face loops, the acoustic
+   *  operator and the inverse mass operator are evaluated in a single loop.
    */
   void
   evaluate(BlockVectorType & dst, BlockVectorType const & src, double const time) const final;
 
+  /*
+   * Local time stepping: same as evaluate(), but the acoustic operator is only evaluated for the
+   * cell and face batches adjacent to the fine level. The result is only correct for the degrees
+   * of freedom of the fine level.
+   */
+  void
+  evaluate_fine_level(BlockVectorType &       dst,
+                      BlockVectorType const & src,
+                      double const            time) const final;
+
+  void
+  initialize_fine_level_mask(BlockVectorType & mask) const final;
+
   /*
    * Operators.
    */
@@ -198,6 +225,25 @@ public:
   double
   calculate_time_step_cfl() const final;
 
+  /*
+   * Sound energy as a by-product of the operator evaluation: after calling this function, each
+   * evaluate() accumulates the integral (1, p^2/(2 c^2) + u^2/2)_Omega of src. The
+   * Adams-Bashforth-Moulton scheme in PECE mode evaluates the operator with the corrected solution
+   * at the end of each time step, such that the sound energy of the solution handed over to the
+   * postprocessor is available without another loop over all cells. This is not the case for local time stepping
+   * and the exponential integrator, which are therefore not supported.
+   */
+  void
+  enable_sound_energy_accumulation() const;
+
+  /*
+   * Returns true if the last evaluation of the operator computed the above integral of src for the
+   * given time, which is then returned in energy after summation over all processes. Needs to be
+   * called by all processes.
+   */
+  bool
+  get_sound_energy_of_last_evaluation(double & energy, double const time) const;
+
 private:
   void
   initialize_dof_handler_and_constraints();
@@ -205,6 +251,26 @@ private:
   void
   initialize_operators();
 
+  /*
+   * Adds the aero-acoustic source term at the given time to dst.
+   */
+  void
+  add_aero_acoustic_source_term(VectorType & dst, double const time) const;
+
+  /*
+   * Local time stepping: cells with a minimum vertex distance below n_substeps times the global
+   * minimum form the fine level.
+   */
+  void
+  initialize_local_time_stepping_levels();
+
+  /*
+   * Absorbing layer: cells with a non-vanishing damping coefficient at one of the vertices or at
+   * the center are grouped in separate cell batches.
+   */
+  void
+  initialize_absorbing_layer_cells();
+
   /*
    * Grid
    */
@@ -257,6 +323,9 @@ private:
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
 
+  // memory of the MatrixFree object created in setup(), see MemoryReport
+  MemoryReport::Entry memory_matrix_free{MemoryCategory::MatrixFree};
+
   /*
    * Basic operators.
    */
@@ -276,6 +345,20 @@ private:
   // The aero-acoustic source term has been computed externally.
   VectorType const * aero_acoustic_source_term;
 
+  // Optional source term at a previous time used for the interpolation in time.
+  VectorType const * aero_acoustic_source_term_previous;
+  double             time_source_term;
+  double             time_source_term_previous;
+
+  // cell-based face loops: right-hand side of the pressure equation passed to the fused loop
+  mutable VectorType pressure_source;
+
+  // local time stepping: fine level indexed by the active cell index
+  std::vector<bool> cell_is_fine;
+
+  // absorbing layer: cells of the layer indexed by the active cell index
+  std::vector<bool> cell_is_in_layer;
+
   MPI_Comm const mpi_comm;
 
   dealii::ConditionalOStream pcout;
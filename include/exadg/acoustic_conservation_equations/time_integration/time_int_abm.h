@@ -60,6 +60,12 @@ public:
       pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
       initial_time_step_size(std::numeric_limits<double>::max())
   {
+    if(param.local_time_stepping)
+      this->enable_local_time_stepping(param.n_substeps_local_time_stepping);
+
+    if(param.exponential_integrator)
+      this->enable_exponential_integrator(param.krylov_dimension_exponential_integrator,
+                                          param.tolerance_exponential_integrator);
   }
 
   bool
@@ -70,6 +76,12 @@ public:
                                         this->time_step_number);
   }
 
+  bool
+  print_memory_consumption() const final
+  {
+    return param.solver_info_data.print_memory_consumption;
+  }
+
 private:
   double
   calculate_time_step_size() final
@@ -88,6 +100,10 @@ private:
 
       initial_time_step_size = cfl * this->get_underlying_operator().calculate_time_step_cfl();
 
+      // the CFL condition is determined by the smallest cells, which belong to the fine level
+      if(param.local_time_stepping)
+        initial_time_step_size *= param.n_substeps_local_time_stepping;
+
       this->pcout << std::endl
                   << "Calculation of time step size according to CFL condition:" << std::endl
                   << std::endl;
@@ -47,6 +47,14 @@ struct FieldFunctions
    * Thus, the right_hand_side is scalar and acts on the pressure DoFs.
    */
   std::shared_ptr<dealii::Function<dim>> right_hand_side;
+
+  /*
+   * The function absorbing_layer_damping describes the non-negative damping coefficient sigma(x)
+   * of the absorbing layer, see Parameters::absorbing_layer. The function has to vanish outside
+   * the layer and should increase smoothly from zero at the interface to the computational domain
+   * to avoid reflections. The layer is only evaluated for cells where sigma does not vanish.
+   */
+  std::shared_ptr<dealii::Function<dim>> absorbing_layer_damping;
 };
 
 } // namespace Acoustics
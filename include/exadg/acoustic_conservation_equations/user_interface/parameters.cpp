@@ -36,6 +36,7 @@ Parameters::Parameters()
     formulation(Formulation::Undefined),
     right_hand_side(false),
     aero_acoustic_source_term(false),
+    absorbing_layer(false),
 
     // PHYSICAL QUANTITIES
     start_time(0.),
@@ -53,6 +54,11 @@ Parameters::Parameters()
     start_with_low_order(true),
     restarted_simulation(false),
     adaptive_time_stepping(false),
+    local_time_stepping(false),
+    n_substeps_local_time_stepping(2),
+    exponential_integrator(false),
+    krylov_dimension_exponential_integrator(30),
+    tolerance_exponential_integrator(1.e-8),
     restart_data(RestartData()),
     solver_info_data(SolverInfoData()),
 
@@ -60,7 +66,10 @@ Parameters::Parameters()
     grid(GridData()),
     mapping_degree(1),
     degree_u(1),
-    degree_p(1)
+    degree_p(1),
+
+    // NUMERICAL PARAMETERS
+    use_cell_based_face_loops(false)
 {
 }
 
@@ -88,8 +97,40 @@ Parameters::check() const
     AssertThrow(cfl_exponent_fe_degree > 0., dealii::ExcMessage("cfl_exponent_fe_degree > 0."));
   }
 
+  if(local_time_stepping)
+  {
+    AssertThrow(n_substeps_local_time_stepping >= 2,
+                dealii::ExcMessage("Local time stepping requires at least 2 sub-steps."));
+    AssertThrow(not adaptive_time_stepping,
+                dealii::ExcMessage("Local time stepping requires a constant time step size."));
+    AssertThrow(start_with_low_order,
+                dealii::ExcMessage("Local time stepping requires start_with_low_order = true."));
+  }
+
+  if(exponential_integrator)
+  {
+    AssertThrow(not local_time_stepping,
+                dealii::ExcMessage(
+                  "Local time stepping can not be combined with the exponential integrator."));
+    AssertThrow(krylov_dimension_exponential_integrator >= 2,
+                dealii::ExcMessage("Krylov dimension has to be at least 2."));
+    AssertThrow(tolerance_exponential_integrator > 0.0,
+                dealii::ExcMessage("parameter must be defined"));
+  }
+
   // SPATIAL DISCRETIZATION
   grid.check();
+
+  // NUMERICAL PARAMETERS
+  if(use_cell_based_face_loops)
+  {
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("Cell-based face loops are only implemented for hypercube "
+                                   "elements."));
+    AssertThrow(not local_time_stepping,
+                dealii::ExcMessage("Cell-based face loops can not be combined with local time "
+                                   "stepping."));
+  }
 }
 
 void
@@ -108,6 +149,9 @@ Parameters::print(dealii::ConditionalOStream const & pcout, std::string const &
 
   // SPATIAL DISCRETIZATION
   print_parameters_spatial_discretization(pcout);
+
+  // NUMERICAL PARAMETERS
+  print_parameters_numerical_parameters(pcout);
 }
 
 void
@@ -117,6 +161,7 @@ Parameters::print_parameters_mathematical_model(dealii::ConditionalOStream const
 
   print_parameter(pcout, "Formulation", formulation);
   print_parameter(pcout, "Right-hand side", right_hand_side);
+  print_parameter(pcout, "Absorbing layer", absorbing_layer);
 }
 
 
@@ -155,6 +200,19 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   // adaptive time-stepping
   print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
+
+  // local time-stepping
+  print_parameter(pcout, "Local time stepping", local_time_stepping);
+  if(local_time_stepping)
+    print_parameter(pcout, "Number of sub-steps fine level", n_substeps_local_time_stepping);
+
+  // exponential integrator
+  print_parameter(pcout, "Exponential integrator", exponential_integrator);
+  if(exponential_integrator)
+  {
+    print_parameter(pcout, "Krylov dimension", krylov_dimension_exponential_integrator);
+    print_parameter(pcout, "Krylov tolerance", tolerance_exponential_integrator);
+  }
 }
 
 void
@@ -170,5 +228,13 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
   print_parameter(pcout, "Polynomial degree velocity", degree_u);
 }
 
+void
+Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream const & pcout) const
+{
+  pcout << std::endl << "Numerical parameters:" << std::endl;
+
+  print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
+}
+
 } // namespace Acoustics
 } // namespace ExaDG
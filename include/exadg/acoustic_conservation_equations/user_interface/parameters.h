@@ -62,6 +62,9 @@ private:
   void
   print_parameters_spatial_discretization(dealii::ConditionalOStream const & pcout) const;
 
+  void
+  print_parameters_numerical_parameters(dealii::ConditionalOStream const & pcout) const;
+
 public:
   /**************************************************************************************/
   /*                                                                                    */
@@ -78,6 +81,12 @@ public:
   // Use the aero-acoustic source term that is internally computed from the fluid solution
   bool aero_acoustic_source_term;
 
+  // Absorbing layer surrounding the computational domain, in which the acoustic waves are damped
+  // according to FieldFunctions::absorbing_layer_damping. This allows to truncate open domains
+  // close to the region of interest, since the first-order absorbing boundary conditions
+  // (admittance) only absorb waves of normal incidence.
+  bool absorbing_layer;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                 PHYSICAL QUANTITIES                                */
@@ -132,6 +141,28 @@ public:
   // use adaptive timestepping
   bool adaptive_time_stepping;
 
+  // Local time stepping with the multirate Adams-Bashforth method of order order_time_integrator.
+  // Cells with a minimum vertex distance below n_substeps_local_time_stepping times the global
+  // minimum form the fine level, which is advanced with n_substeps_local_time_stepping sub-steps
+  // per time step. The time step size according to the CFL condition refers to the smallest cells
+  // and is multiplied by n_substeps_local_time_stepping.
+  bool local_time_stepping;
+
+  // number of sub-steps of the fine level per time step
+  unsigned int n_substeps_local_time_stepping;
+
+  // Use a second-order exponential integrator instead of the Adams-Bashforth-Moulton method. Since
+  // the time step size is not limited by the CFL condition, the time step size can be chosen
+  // according to the temporal resolution of the source terms, e.g. via a large cfl number.
+  bool exponential_integrator;
+
+  // maximum dimension of the Krylov subspace of the exponential integrator
+  unsigned int krylov_dimension_exponential_integrator;
+
+  // tolerance of the error estimate of the Krylov approximation relative to the norm of the start
+  // vector, the time step is split into sub-steps if this tolerance is exceeded
+  double tolerance_exponential_integrator;
+
   // restart
   RestartData restart_data;
 
@@ -155,6 +186,18 @@ public:
 
   // Polynomial degree of pressure shape functions
   unsigned int degree_p;
+
+  /**************************************************************************************/
+  /*                                                                                    */
+  /*                                NUMERICAL PARAMETERS                                */
+  /*                                                                                    */
+  /**************************************************************************************/
+
+  // Evaluate the face integrals cell by cell instead of face by face. With this loop structure,
+  // all contributions to a cell are available at the end of the cell's face loop, and the explicit
+  // time integrator applies the acoustic operator and the cell-local inverse mass operators in a
+  // single pass over the pressure and velocity vectors.
+  bool use_cell_based_face_loops;
 };
 
 } // namespace Acoustics
@@ -24,6 +24,10 @@ struct SourceTermCalculatorData
   // function if blend in is required.
   bool                                                  blend_in;
   std::shared_ptr<Utilities::SpatialAwareFunction<dim>> blend_in_function;
+
+  // Evaluate the source term only for the cell batches where the blend-in function does not vanish
+  // for all times, see Utilities::SpatialAwareFunction::vanishes_for_all_times().
+  bool restrict_to_source_region = false;
 };
 
 /**
@@ -59,6 +63,9 @@ public:
   {
     matrix_free = &matrix_free_in;
     data        = data_in;
+
+    if(data.restrict_to_source_region)
+      initialize_source_region();
   }
 
   void
@@ -101,6 +108,45 @@ public:
   }
 
 private:
+  /*
+   * Determines the cell batches where the blend-in function does not vanish at one of the
+   * quadrature points of one of the cells of the batch.
+   */
+  void
+  initialize_source_region()
+  {
+    AssertThrow(data.blend_in and data.blend_in_function != nullptr,
+                dealii::ExcMessage("The source region is defined by the blend-in function, which "
+                                   "has not been provided."));
+
+    CellIntegratorScalar integrator(*matrix_free, data.dof_index_pressure, data.quad_index);
+
+    cell_batch_in_source_region.assign(matrix_free->n_cell_batches(), false);
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      {
+        qpoint const q_points = integrator.quadrature_point(q);
+        for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+        {
+          dealii::Point<dim> point;
+          for(unsigned int d = 0; d < dim; ++d)
+            point[d] = q_points[d][v];
+
+          if(not data.blend_in_function->vanishes_for_all_times(point))
+            cell_batch_in_source_region[cell] = true;
+        }
+      }
+    }
+  }
+
+  bool
+  skip_cell_batch(unsigned int const cell) const
+  {
+    return not cell_batch_in_source_region.empty() and not cell_batch_in_source_region[cell];
+  }
+
   void
   compute_source_term(dealii::MatrixFree<dim, Number> const &       matrix_free_in,
                       VectorType &                                  dst,
@@ -117,6 +163,10 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      // dst has been zeroed by the cell loop
+      if(skip_cell_batch(cell))
+        continue;
+
       dpdt.reinit(cell);
       dpdt.gather_evaluate(dp_cfd_dt, dealii::EvaluationFlags::values);
 
@@ -168,6 +218,10 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      // dst has been zeroed by the cell loop
+      if(skip_cell_batch(cell))
+        continue;
+
       dpdt.reinit(cell);
 
       for(unsigned int q = 0; q < dpdt.n_q_points; ++q)
@@ -224,6 +278,9 @@ private:
   lazy_ptr<VectorType> velocity_cfd;
   lazy_ptr<VectorType> pressure_cfd;
 
+  // cell batches of the source region, empty if the source term is evaluated everywhere
+  std::vector<bool> cell_batch_in_source_region;
+
   double time;
 };
 } // namespace AeroAcoustic
@@ -19,8 +19,12 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <cmath>
+
 // ExaDG
 #include <exadg/aero_acoustic/driver.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_general_infos.h>
 
 namespace ExaDG
@@ -37,7 +41,9 @@ Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
     application(app),
     acoustic(std::make_shared<SolverAcoustic<dim, Number>>()),
     fluid(std::make_shared<SolverFluid<dim, Number>>()),
-    time_solvers_side_by_side(std::numeric_limits<double>::min())
+    time_solvers_side_by_side(std::numeric_limits<double>::min()),
+    time_fluid_side_by_side(0.0),
+    time_acoustic_side_by_side(0.0)
 {
   print_general_info<Number>(pcout, mpi_comm, is_test);
 }
@@ -75,6 +81,9 @@ Driver<dim, Number>::setup()
   setup_volume_coupling();
 
   timer_tree.insert({"AeroAcoustic", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -159,9 +168,13 @@ Driver<dim, Number>::solve()
     // The acoustic simulation uses explicit time-stepping while the fluid solver
     // uses implicit time-stepping. Therefore, we advance the acoustic solver to
     // t^(n+1) first and directly use the result in the fluid solver.
+    dealii::Timer timer_acoustic;
     if(acoustic_starts_during_present_timestep)
       couple_fluid_to_acoustic();
-    acoustic->advance_multiple_timesteps(fluid->time_integrator->get_time_step_size());
+    acoustic->advance_multiple_timesteps(fluid->time_integrator->get_time_step_size(),
+                                         application->parameters.acoustic_sub_time_steps);
+    if(timer.first)
+      time_acoustic_side_by_side += timer_acoustic.wall_time();
 
     // We can not simply check acoustic->time_integrator->started() since acoustic might start
     // during a sub-stepping sweep. To check if the acoustic might be started during the next
@@ -172,8 +185,11 @@ Driver<dim, Number>::solve()
       fluid->time_integrator->get_next_time() + fluid->max_next_time_step_size() >
       application->acoustic->get_parameters().start_time;
 
+    dealii::Timer timer_fluid;
     fluid->advance_one_timestep_and_compute_pressure_time_derivative(
       acoustic_might_start_during_next_timestep);
+    if(timer.first)
+      time_fluid_side_by_side += timer_fluid.wall_time();
   }
 
   time_solvers_side_by_side = timer.second.wall_time();
@@ -209,6 +225,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core (during the time both
   // solvers ran side by side)
   dealii::Utilities::MPI::MinMaxAvg time_solvers_side_by_side_data =
@@ -236,7 +257,25 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
                             acoustic->get_number_of_sub_time_steps(),
                             N_mpi_processes);
 
-
+  // The solvers run one after the other on all processes. For a concurrent execution on disjoint
+  // groups of processes with similar parallel efficiencies, the processes have to be distributed
+  // according to the measured costs of both solvers, such that both groups need the same time.
+  double const time_fluid_avg =
+    dealii::Utilities::MPI::min_max_avg(time_fluid_side_by_side, mpi_comm).avg;
+  double const time_acoustic_avg =
+    dealii::Utilities::MPI::min_max_avg(time_acoustic_side_by_side, mpi_comm).avg;
+  if(time_fluid_avg + time_acoustic_avg > 0.0)
+  {
+    double const fraction_acoustic = time_acoustic_avg / (time_fluid_avg + time_acoustic_avg);
+
+    pcout << std::endl << "Cost distribution while both solvers ran side by side:" << std::endl;
+    print_parameter(pcout, "Wall time fluid", time_fluid_avg);
+    print_parameter(pcout, "Wall time acoustic", time_acoustic_avg);
+    print_parameter(pcout, "Fraction of costs acoustic", fraction_acoustic);
+    print_parameter(pcout,
+                    "Balanced number of processes acoustic",
+                    static_cast<unsigned int>(std::round(fraction_acoustic * N_mpi_processes)));
+  }
 
   // computational costs in CPUh
   dealii::Utilities::MPI::MinMaxAvg total_time_data =
@@ -86,6 +86,11 @@ private:
 
   // wall time fluid and acoustic solvers ran together
   double time_solvers_side_by_side;
+
+  // wall times of the fluid and acoustic solvers while both solvers ran together, used to
+  // estimate the distribution of MPI processes for a concurrent execution of both solvers
+  double time_fluid_side_by_side;
+  double time_acoustic_side_by_side;
 };
 
 } // namespace AeroAcoustic
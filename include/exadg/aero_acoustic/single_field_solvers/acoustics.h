@@ -68,14 +68,21 @@ public:
     time_integrator->setup(application->get_parameters().restarted_simulation);
   }
 
+  /*
+   * Advances the acoustic solver by macro_dt. With n_sub_time_steps_prescribed = 0, the number of
+   * sub-steps follows from the acoustic time step size, otherwise the given number of sub-steps
+   * is performed.
+   */
   void
-  advance_multiple_timesteps(double const macro_dt)
+  advance_multiple_timesteps(double const macro_dt, unsigned int const n_sub_time_steps_prescribed)
   {
     // in case the macro time step is smaller than the acoustic timestep, simply run
     // with macro time step, otherwise, ensure that n_sub_time_steps * sub_dt = macro_dt
     double const dt = time_integrator->get_time_step_size();
     double const sub_dt =
-      (macro_dt < dt) ? macro_dt : adjust_time_step_to_hit_end_time(0.0, macro_dt, dt);
+      (n_sub_time_steps_prescribed > 0) ?
+        macro_dt / n_sub_time_steps_prescribed :
+        ((macro_dt < dt) ? macro_dt : adjust_time_step_to_hit_end_time(0.0, macro_dt, dt));
 
 
     // define epsilon dependent on time-step size to avoid
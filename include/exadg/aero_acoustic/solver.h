@@ -30,6 +30,8 @@
 #include <exadg/aero_acoustic/user_interface/declare_get_application.h>
 #include <exadg/utilities/enum_patterns.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
 
 namespace ExaDG
 {
@@ -79,6 +81,8 @@ main(int argc, char ** argv)
 {
   dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
 
+  ExaDG::ProfilingSession profiling;
+
   MPI_Comm mpi_comm(MPI_COMM_WORLD);
 
   std::string input_file;
@@ -133,6 +137,9 @@ main(int argc, char ** argv)
                 dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
   }
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
   return 0;
 }
 
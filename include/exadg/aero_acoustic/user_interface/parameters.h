@@ -58,8 +58,11 @@ public:
     : density(-1.0),
       source_term_with_convection(false),
       blend_in_source_term(false),
+      restrict_source_term_to_blend_in_region(false),
       fluid_to_acoustic_coupling_strategy(FluidToAcousticCouplingStrategy::Undefined),
-      acoustic_source_term_computation(AcousticSourceTermComputation::Undefined)
+      acoustic_source_term_computation(AcousticSourceTermComputation::Undefined),
+      interpolate_source_term_in_time(false),
+      acoustic_sub_time_steps(0)
   {
   }
 
@@ -73,6 +76,11 @@ public:
 
     AssertThrow(acoustic_source_term_computation != AcousticSourceTermComputation::Undefined,
                 dealii::ExcMessage("Source term computation has to be set."));
+
+    if(restrict_source_term_to_blend_in_region)
+      AssertThrow(blend_in_source_term,
+                  dealii::ExcMessage("The source region is defined by the blend-in function, "
+                                     "which requires blend_in_source_term = true."));
   }
 
   void
@@ -82,8 +90,14 @@ public:
     print_parameter(pcout, "Density", density);
     print_parameter(pcout, "Source term has convective part", source_term_with_convection);
     print_parameter(pcout, "Blend in source term", blend_in_source_term);
+    if(blend_in_source_term)
+      print_parameter(pcout,
+                      "Restrict source term to blend-in region",
+                      restrict_source_term_to_blend_in_region);
     print_parameter(pcout, "Fluid to acoustic coupling", fluid_to_acoustic_coupling_strategy);
     print_parameter(pcout, "Acoustic source term compuation", acoustic_source_term_computation);
+    print_parameter(pcout, "Interpolate source term in time", interpolate_source_term_in_time);
+    print_parameter(pcout, "Acoustic sub-time steps (0: automatic)", acoustic_sub_time_steps);
   }
 
   void
@@ -106,6 +120,12 @@ public:
                         dealii::Patterns::Bool(),
                         true);
 
+      prm.add_parameter("RestrictSourceTermToBlendInRegion",
+                        restrict_source_term_to_blend_in_region,
+                        "Evaluate the source term only where the blend-in function is non-zero.",
+                        dealii::Patterns::Bool(),
+                        false);
+
       prm.add_parameter("FluidToAcousticCouplingStrategy",
                         fluid_to_acoustic_coupling_strategy,
                         "Volume coupling strategy from the fluid to the acoustic field.",
@@ -117,6 +137,18 @@ public:
                         "How to compute the acustic source term.",
                         Patterns::Enum<AcousticSourceTermComputation>(),
                         true);
+
+      prm.add_parameter("InterpolateSourceTermInTime",
+                        interpolate_source_term_in_time,
+                        "Interpolate the source term in time during the acoustic sub-steps.",
+                        dealii::Patterns::Bool(),
+                        false);
+
+      prm.add_parameter("AcousticSubTimeSteps",
+                        acoustic_sub_time_steps,
+                        "Acoustic time steps per fluid time step (0: from acoustic CFL).",
+                        dealii::Patterns::Integer(0),
+                        false);
     }
     prm.leave_subsection();
   }
@@ -132,11 +164,32 @@ public:
   // Blend in aero-acoustic source terms in time or space?
   bool blend_in_source_term;
 
+  // Evaluate the source term on the fluid mesh only for the cells where the blend-in function
+  // does not vanish for all times, which is cheaper if the source region is a small part of the
+  // fluid domain. See Utilities::SpatialAwareFunction::vanishes_for_all_times().
+  bool restrict_source_term_to_blend_in_region;
+
   // Strategy to couple from fluid to acoustic
   FluidToAcousticCouplingStrategy fluid_to_acoustic_coupling_strategy;
 
   // How to compute the acustic source term
   AcousticSourceTermComputation acoustic_source_term_computation;
+
+  // The source term is computed once per fluid time step, while the acoustic solver performs
+  // several sub-steps within a fluid time step. By default, the source term is kept constant
+  // during the sub-steps. If this parameter is set, the source term is interpolated linearly in
+  // time from the source terms of the last two fluid time steps instead. Since the acoustic
+  // solver is advanced before the fluid solver, this is an extrapolation to the times of the
+  // sub-steps, which comes at the cost of one additional vector on the acoustic mesh, but neither
+  // requires further evaluations of the source term nor further grid transfers.
+  bool interpolate_source_term_in_time;
+
+  // Number of acoustic time steps per fluid time step. With the default value 0, the number of
+  // sub-steps is the smallest number such that the acoustic time step size according to the
+  // acoustic CFL condition is not exceeded. A value > 0 prescribes the ratio of the time step
+  // sizes, e.g. to run the acoustic solver at a smaller CFL number. The user is responsible for
+  // the stability of the acoustic solver in this case.
+  unsigned int acoustic_sub_time_steps;
 };
 
 } // namespace AeroAcoustic
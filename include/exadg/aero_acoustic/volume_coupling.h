@@ -52,6 +52,9 @@ public:
     field_functions = field_functions_in;
 
     acoustic_solver_in->pde_operator->initialize_dof_vector_pressure(source_term_acoustic);
+    if(parameters.interpolate_source_term_in_time)
+      acoustic_solver_in->pde_operator->initialize_dof_vector_pressure(
+        source_term_acoustic_previous);
     fluid_solver_in->pde_operator->initialize_vector_pressure(source_term_fluid);
 
     // setup the transfer operator
@@ -78,12 +81,25 @@ public:
     data.blend_in            = parameters.blend_in_source_term;
     data.blend_in_function   = field_functions_in->source_term_blend_in;
 
+    data.restrict_to_source_region = parameters_in.restrict_source_term_to_blend_in_region;
+
     source_term_calculator.setup(fluid_solver_in->pde_operator->get_matrix_free(), data);
   }
 
   void
   fluid_to_acoustic()
   {
+    // keep the source term of the previous fluid time step for the interpolation in time, the
+    // vector filled below then holds an outdated source term, which is reset
+    if(parameters.interpolate_source_term_in_time)
+    {
+      source_term_acoustic_previous.swap(source_term_acoustic);
+      time_source_term_previous = time_source_term;
+      source_term_acoustic      = 0.0;
+    }
+
+    time_source_term = fluid_solver->time_integrator->get_time();
+
     if(parameters.fluid_to_acoustic_coupling_strategy ==
        FluidToAcousticCouplingStrategy::ConservativeInterpolation)
     {
@@ -116,7 +132,19 @@ public:
       AssertThrow(false, dealii::ExcMessage("FluidToAcousticCouplingStrategy not implemented."));
     }
 
-    acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic);
+    if(parameters.interpolate_source_term_in_time and n_source_terms > 0)
+    {
+      acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic,
+                                                                   time_source_term,
+                                                                   source_term_acoustic_previous,
+                                                                   time_source_term_previous);
+    }
+    else
+    {
+      acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic);
+    }
+
+    ++n_source_terms;
   }
 
 private:
@@ -142,6 +170,16 @@ private:
   // Aeroacoustic source term defined on the acoustic mesh
   VectorType source_term_acoustic;
 
+  // Aeroacoustic source term of the previous fluid time step defined on the acoustic mesh, needed
+  // for the interpolation in time
+  VectorType source_term_acoustic_previous;
+
+  // times of the fluid solution the source terms have been computed from
+  double time_source_term          = 0.0;
+  double time_source_term_previous = 0.0;
+
+  unsigned int n_source_terms = 0;
+
   // Aeroacoustic source term defined on the fluid mesh
   VectorType source_term_fluid;
 };
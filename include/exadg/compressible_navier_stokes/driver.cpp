@@ -27,6 +27,7 @@
 // ExaDG
 #include <exadg/compressible_navier_stokes/driver.h>
 #include <exadg/operators/throughput_parameters.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -82,6 +83,9 @@ Driver<dim, Number>::setup()
   }
 
   timer_tree.insert({"Compressible flow", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -113,6 +117,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -156,6 +165,10 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
       pde_operator->evaluate_viscous(dst, src, 0.0);
     else if(operator_type == OperatorType::ViscousAndConvectiveTerms)
       pde_operator->evaluate_convective_and_viscous(dst, src, 0.0);
+    else if(operator_type == OperatorType::ViscousAndConvectiveTermsSeparate)
+      pde_operator->evaluate_convective_and_viscous_separately(dst, src, 0.0);
+    else if(operator_type == OperatorType::ShockCapturingIndicator)
+      pde_operator->update_shock_capturing_indicator(src);
     else if(operator_type == OperatorType::InverseMassOperator)
       pde_operator->apply_inverse_mass(dst, src);
     else if(operator_type == OperatorType::InverseMassOperatorDstDst)
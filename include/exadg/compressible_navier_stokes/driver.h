@@ -44,6 +44,8 @@ enum class OperatorType
   ConvectiveTerm,
   ViscousTerm,
   ViscousAndConvectiveTerms,
+  ViscousAndConvectiveTermsSeparate, // separate loops also if the combined operator is used
+  ShockCapturingIndicator,
   InverseMassOperator,
   InverseMassOperatorDstDst,
   VectorUpdate,
@@ -19,8 +19,12 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <cmath>
+
 // deal.II
 #include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/data_postprocessor.h>
 
 // ExaDG
 #include <exadg/compressible_navier_stokes/postprocessor/output_generator.h>
@@ -31,6 +35,181 @@ namespace ExaDG
 {
 namespace CompNS
 {
+/*
+ * Writes the conserved variables and evaluates the derived quantities requested in OutputData
+ * pointwise from the values and gradients of the conserved variables at the points of the
+ * patches. In contrast to the L2-projected fields of the postprocessor, no DoF vectors have to be
+ * computed and stored for the output.
+ */
+template<int dim>
+class DerivedQuantitiesPostprocessor : public dealii::DataPostprocessor<dim>
+{
+  typedef dealii::DataComponentInterpretation::DataComponentInterpretation Interpretation;
+
+public:
+  DerivedQuantitiesPostprocessor(OutputData const & output_data_in,
+                                 double const       heat_capacity_ratio_in,
+                                 double const       specific_gas_constant_in)
+    : output_data(output_data_in),
+      gamma(heat_capacity_ratio_in),
+      R(specific_gas_constant_in)
+  {
+  }
+
+  void
+  evaluate_vector_field(dealii::DataPostprocessorInputs::Vector<dim> const & inputs,
+                        std::vector<dealii::Vector<double>> & computed_quantities) const final
+  {
+    for(unsigned int q = 0; q < inputs.solution_values.size(); ++q)
+    {
+      dealii::Vector<double> const & values = inputs.solution_values[q];
+      dealii::Vector<double> &       result = computed_quantities[q];
+
+      double const rho   = values[0];
+      double const rho_E = values[1 + dim];
+
+      dealii::Tensor<1, dim> rho_u, u;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        rho_u[d] = values[1 + d];
+        u[d]     = rho_u[d] / rho;
+      }
+
+      double const p = (gamma - 1.0) * (rho_E - 0.5 * rho_u * u);
+
+      unsigned int c = 0;
+
+      // conserved variables
+      for(unsigned int i = 0; i < dim + 2; ++i)
+        result[c++] = values[i];
+
+      if(output_data.write_pressure)
+        result[c++] = p;
+
+      if(output_data.write_velocity)
+        for(unsigned int d = 0; d < dim; ++d)
+          result[c++] = u[d];
+
+      if(needs_gradients())
+      {
+        // grad(u) = (grad(rho_u) - u x grad(rho)) / rho
+        std::vector<dealii::Tensor<1, dim>> const & gradients = inputs.solution_gradients[q];
+
+        dealii::Tensor<2, dim> grad_u;
+        for(unsigned int i = 0; i < dim; ++i)
+          grad_u[i] = (gradients[1 + i] - u[i] * gradients[0]) / rho;
+
+        if(output_data.write_vorticity)
+        {
+          // for dim=2, the vorticity is stored in the first component
+          if(dim == 2)
+          {
+            result[c++] = grad_u[1][0] - grad_u[0][1];
+            result[c++] = 0.0;
+          }
+          else
+          {
+            result[c++] = grad_u[2][1] - grad_u[1][2];
+            result[c++] = grad_u[0][2] - grad_u[2][0];
+            result[c++] = grad_u[1][0] - grad_u[0][1];
+          }
+        }
+
+        if(output_data.write_divergence)
+          result[c++] = dealii::trace(grad_u);
+
+        if(output_data.write_shear_rate)
+        {
+          dealii::Tensor<2, dim> const sym_grad_u = 0.5 * (grad_u + dealii::transpose(grad_u));
+          result[c++] = std::sqrt(2.0 * dealii::scalar_product(sym_grad_u, sym_grad_u));
+        }
+      }
+
+      if(output_data.write_temperature)
+        result[c++] = p / (rho * R);
+    }
+  }
+
+  std::vector<std::string>
+  get_names() const final
+  {
+    std::vector<std::string> names;
+
+    names.push_back("rho");
+    for(unsigned int d = 0; d < dim; ++d)
+      names.push_back("rho_u");
+    names.push_back("rho_E");
+
+    if(output_data.write_pressure)
+      names.push_back("pressure");
+    if(output_data.write_velocity)
+      for(unsigned int d = 0; d < dim; ++d)
+        names.push_back("velocity");
+    if(output_data.write_vorticity)
+      for(unsigned int d = 0; d < dim; ++d)
+        names.push_back("vorticity");
+    if(output_data.write_divergence)
+      names.push_back("velocity_divergence");
+    if(output_data.write_shear_rate)
+      names.push_back("shear_rate");
+    if(output_data.write_temperature)
+      names.push_back("temperature");
+
+    return names;
+  }
+
+  std::vector<Interpretation>
+  get_data_component_interpretation() const final
+  {
+    Interpretation const scalar = dealii::DataComponentInterpretation::component_is_scalar;
+    Interpretation const vector = dealii::DataComponentInterpretation::component_is_part_of_vector;
+
+    std::vector<Interpretation> interpretation;
+
+    interpretation.push_back(scalar);
+    for(unsigned int d = 0; d < dim; ++d)
+      interpretation.push_back(vector);
+    interpretation.push_back(scalar);
+
+    if(output_data.write_pressure)
+      interpretation.push_back(scalar);
+    if(output_data.write_velocity)
+      for(unsigned int d = 0; d < dim; ++d)
+        interpretation.push_back(vector);
+    if(output_data.write_vorticity)
+      for(unsigned int d = 0; d < dim; ++d)
+        interpretation.push_back(vector);
+    if(output_data.write_divergence)
+      interpretation.push_back(scalar);
+    if(output_data.write_shear_rate)
+      interpretation.push_back(scalar);
+    if(output_data.write_temperature)
+      interpretation.push_back(scalar);
+
+    return interpretation;
+  }
+
+  dealii::UpdateFlags
+  get_needed_update_flags() const final
+  {
+    return needs_gradients() ? dealii::update_values | dealii::update_gradients :
+                               dealii::update_values;
+  }
+
+private:
+  bool
+  needs_gradients() const
+  {
+    return output_data.write_vorticity or output_data.write_divergence or
+           output_data.write_shear_rate;
+  }
+
+  OutputData const & output_data;
+
+  double const gamma;
+  double const R;
+};
+
 template<int dim, typename Number, typename VectorType>
 void
 write_output(
@@ -39,34 +218,28 @@ write_output(
   dealii::Mapping<dim> const &                                          mapping,
   VectorType const &                                                    solution_conserved,
   std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> const & additional_fields,
+  double const                                                          heat_capacity_ratio,
+  double const                                                          specific_gas_constant,
   unsigned int const                                                    output_counter,
-  MPI_Comm const &                                                      mpi_comm)
+  double const                                                          time,
+  MPI_Comm const &                                                      mpi_comm,
+  OutputWriter<dim> &                                                   output_writer)
 {
   std::string folder = output_data.directory, file = output_data.filename;
 
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
+  flags.compression_level        = get_vtk_compression_level(output_data.compression);
 
-  dealii::DataOut<dim> data_out;
+  SnapshotDataOut<dim> data_out;
   data_out.set_flags(flags);
 
-  // conserved variables
-  std::vector<std::string> solution_names_conserved(dim + 2, "rho_u");
-  solution_names_conserved[0]       = "rho";
-  solution_names_conserved[1 + dim] = "rho_E";
+  // conserved variables and derived quantities, which are computed while building the patches
+  DerivedQuantitiesPostprocessor<dim> const derived_quantities(output_data,
+                                                               heat_capacity_ratio,
+                                                               specific_gas_constant);
 
-  std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
-    solution_component_interpretation(
-      dim + 2, dealii::DataComponentInterpretation::component_is_part_of_vector);
-
-  solution_component_interpretation[0] = dealii::DataComponentInterpretation::component_is_scalar;
-  solution_component_interpretation[1 + dim] =
-    dealii::DataComponentInterpretation::component_is_scalar;
-
-  data_out.add_data_vector(dof_handler,
-                           solution_conserved,
-                           solution_names_conserved,
-                           solution_component_interpretation);
+  data_out.add_data_vector(dof_handler, solution_conserved, derived_quantities);
 
   // additional solution fields
   for(auto & additional_field : additional_fields)
@@ -95,9 +268,10 @@ write_output(
     }
   }
 
+  select_output_cells(data_out, output_data.material_ids);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  output_writer.write(data_out, folder, file, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -109,14 +283,20 @@ template<int dim, typename Number>
 void
 OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_in,
                                     dealii::Mapping<dim> const &    mapping_in,
-                                    OutputData const &              output_data_in)
+                                    OutputData const &              output_data_in,
+                                    double const                    heat_capacity_ratio_in,
+                                    double const                    specific_gas_constant_in)
 {
-  dof_handler = &dof_handler_in;
-  mapping     = &mapping_in;
-  output_data = output_data_in;
+  dof_handler           = &dof_handler_in;
+  mapping               = &mapping_in;
+  output_data           = output_data_in;
+  heat_capacity_ratio   = heat_capacity_ratio_in;
+  specific_gas_constant = specific_gas_constant_in;
 
   time_control.setup(output_data_in.time_control_data);
 
+  output_writer.setup(output_data_in);
+
   if(output_data_in.time_control_data.is_active)
   {
     create_directories(output_data.directory, mpi_comm);
@@ -183,8 +363,12 @@ OutputGenerator<dim, Number>::evaluate(
                                         *mapping,
                                         solution_conserved,
                                         additional_fields,
+                                        heat_capacity_ratio,
+                                        specific_gas_constant,
                                         time_control.get_counter(),
-                                        mpi_comm);
+                                        time,
+                                        mpi_comm,
+                                        output_writer);
 }
 
 
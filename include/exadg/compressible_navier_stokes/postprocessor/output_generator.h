@@ -26,6 +26,7 @@
 #include <fstream>
 
 // ExaDG
+#include <exadg/postprocessor/output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
@@ -95,8 +96,14 @@ public:
   void
   setup(dealii::DoFHandler<dim> const & dof_handler_in,
         dealii::Mapping<dim> const &    mapping_in,
-        OutputData const &              output_data_in);
-
+        OutputData const &              output_data_in,
+        double const                    heat_capacity_ratio_in,
+        double const                    specific_gas_constant_in);
+
+  /*
+   * Writes the conserved variables, the derived quantities requested in OutputData, which are
+   * evaluated from the conserved variables while writing the output, and additional fields.
+   */
   void
   evaluate(VectorType const &                                                    solution_conserved,
            std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> const & additional_fields,
@@ -111,6 +118,12 @@ private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
   OutputData                                          output_data;
+
+  OutputWriter<dim> output_writer;
+
+  // needed to compute pressure and temperature from the conserved variables
+  double heat_capacity_ratio;
+  double specific_gas_constant;
 };
 
 } // namespace CompNS
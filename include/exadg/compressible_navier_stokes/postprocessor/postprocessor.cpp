@@ -57,7 +57,9 @@ PostProcessor<dim, Number>::setup(Operator<dim, Number> const & pde_operator)
 
   output_generator.setup(pde_operator.get_dof_handler(),
                          pde_operator.get_mapping(),
-                         pp_data.output_data);
+                         pp_data.output_data,
+                         pde_operator.get_heat_capacity_ratio(),
+                         pde_operator.get_specific_gas_constant());
 
   pointwise_output_generator.setup(pde_operator.get_dof_handler(),
                                    pde_operator.get_mapping(),
@@ -101,39 +103,9 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
    */
   if(output_generator.time_control.needs_evaluation(time, time_step_number))
   {
+    // the derived quantities are computed by the output generator from the conserved variables
     std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> additional_fields_vtu;
 
-    if(pp_data.output_data.write_pressure)
-    {
-      pressure.evaluate(solution);
-      additional_fields_vtu.push_back(&pressure);
-    }
-    if(pp_data.output_data.write_velocity)
-    {
-      velocity.evaluate(solution);
-      additional_fields_vtu.push_back(&velocity);
-    }
-    if(pp_data.output_data.write_vorticity)
-    {
-      vorticity.evaluate(velocity.evaluate_get(solution));
-      additional_fields_vtu.push_back(&vorticity);
-    }
-    if(pp_data.output_data.write_divergence)
-    {
-      divergence.evaluate(velocity.evaluate_get(solution));
-      additional_fields_vtu.push_back(&divergence);
-    }
-    if(pp_data.output_data.write_shear_rate)
-    {
-      shear_rate.evaluate(velocity.evaluate_get(solution));
-      additional_fields_vtu.push_back(&shear_rate);
-    }
-    if(pp_data.output_data.write_temperature)
-    {
-      temperature.evaluate(solution);
-      additional_fields_vtu.push_back(&temperature);
-    }
-
     output_generator.evaluate(solution,
                               additional_fields_vtu,
                               time,
@@ -194,8 +166,10 @@ template<int dim, typename Number>
 void
 PostProcessor<dim, Number>::initialize_derived_fields()
 {
-  if(pp_data.output_data.write_pressure or pp_data.lift_and_drag_data.time_control_data.is_active or
-     pp_data.pressure_difference_data.time_control_data.is_active)
+  // The DoF vectors of the derived fields are only allocated once a field is evaluated for the
+  // first time, i.e., fields not needed by any of the postprocessing tools do not require memory.
+
+  // pressure
   {
     pressure.type              = SolutionFieldType::scalar;
     pressure.name              = "pressure";
@@ -206,16 +180,9 @@ PostProcessor<dim, Number>::initialize_derived_fields()
     pressure.recompute_solution_field = [&](VectorType & dst, VectorType const & src) {
       navier_stokes_operator->compute_pressure(dst, src);
     };
-
-    pressure.reinit();
   }
 
   // velocity
-  if(pp_data.output_data.write_velocity or pp_data.output_data.write_vorticity or
-     pp_data.output_data.write_divergence or pp_data.output_data.write_shear_rate or
-     pp_data.lift_and_drag_data.time_control_data.is_active or
-     pp_data.kinetic_energy_data.time_control_data.is_active or
-     pp_data.kinetic_energy_spectrum_data.time_control_data.is_active)
   {
     velocity.type              = SolutionFieldType::vector;
     velocity.name              = "velocity";
@@ -226,12 +193,9 @@ PostProcessor<dim, Number>::initialize_derived_fields()
     velocity.recompute_solution_field = [&](VectorType & dst, VectorType const & src) {
       navier_stokes_operator->compute_velocity(dst, src);
     };
-
-    velocity.reinit();
   }
 
   // vorticity
-  if(pp_data.output_data.write_vorticity)
   {
     vorticity.type              = SolutionFieldType::vector;
     vorticity.name              = "vorticity";
@@ -242,12 +206,9 @@ PostProcessor<dim, Number>::initialize_derived_fields()
     vorticity.recompute_solution_field = [&](VectorType & dst, VectorType const & src) {
       navier_stokes_operator->compute_vorticity(dst, src);
     };
-
-    vorticity.reinit();
   }
 
   // divergence
-  if(pp_data.output_data.write_divergence)
   {
     divergence.type              = SolutionFieldType::scalar;
     divergence.name              = "velocity_divergence";
@@ -258,12 +219,9 @@ PostProcessor<dim, Number>::initialize_derived_fields()
     divergence.recompute_solution_field = [&](VectorType & dst, VectorType const & src) {
       navier_stokes_operator->compute_divergence(dst, src);
     };
-
-    divergence.reinit();
   }
 
   // shear rate
-  if(pp_data.output_data.write_shear_rate)
   {
     shear_rate.type              = SolutionFieldType::scalar;
     shear_rate.name              = "shear_rate";
@@ -274,12 +232,9 @@ PostProcessor<dim, Number>::initialize_derived_fields()
     shear_rate.recompute_solution_field = [&](VectorType & dst, VectorType const & src) {
       navier_stokes_operator->compute_shear_rate(dst, src);
     };
-
-    shear_rate.reinit();
   }
 
   // temperature
-  if(pp_data.output_data.write_temperature)
   {
     temperature.type              = SolutionFieldType::scalar;
     temperature.name              = "temperature";
@@ -290,8 +245,6 @@ PostProcessor<dim, Number>::initialize_derived_fields()
     temperature.recompute_solution_field = [&](VectorType & dst, VectorType const & src) {
       navier_stokes_operator->compute_temperature(dst, src);
     };
-
-    temperature.reinit();
   }
 }
 
@@ -29,6 +29,8 @@
 #include <exadg/operators/resolution_parameters.h>
 #include <exadg/time_integration/resolution_parameters.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
 
 // application
 #include <exadg/compressible_navier_stokes/user_interface/declare_get_application.h>
@@ -94,6 +96,8 @@ main(int argc, char ** argv)
 {
   dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
 
+  ExaDG::ProfilingSession profiling;
+
   MPI_Comm mpi_comm(MPI_COMM_WORLD);
 
   std::string input_file;
@@ -170,6 +174,9 @@ main(int argc, char ** argv)
     }
   }
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
   return 0;
 }
 
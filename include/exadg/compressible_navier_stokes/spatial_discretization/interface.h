@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// C/C++
+#include <functional>
+
+// deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
 namespace ExaDG
@@ -64,6 +68,16 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // explicit time integration: evaluate operator and call operation_after_loop(start, end) for
+  // ranges of DoFs of dst once they are computed, dst and src may be the same vector
+  virtual void
+  evaluate_and_update(
+    VectorType &                                                        dst,
+    VectorType const &                                                  src,
+    Number const                                                        evaluation_time,
+    std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
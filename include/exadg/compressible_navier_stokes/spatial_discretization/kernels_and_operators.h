@@ -23,9 +23,15 @@
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_KERNELS_AND_OPERATORS_H_
 
 // C/C++
+#include <cmath>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
 // deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -34,6 +40,7 @@
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/interior_penalty_parameter.h>
+#include <exadg/utilities/vectorized_math.h>
 
 namespace ExaDG
 {
@@ -281,6 +288,99 @@ inline DEAL_II_ALWAYS_INLINE //
   return std::max(lambda_m, lambda_p);
 }
 
+/*
+ * Logarithmic mean (a - b) / (log(a) - log(b)) of positive numbers a and b with given logarithms.
+ * If a and b are close to each other, a series expansion is used to avoid cancellation (Ranocha
+ * (2018), "Comparison of some entropy conservative numerical fluxes for the Euler equations").
+ */
+template<typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::VectorizedArray<Number>
+  calculate_logarithmic_mean(dealii::VectorizedArray<Number> const & a,
+                             dealii::VectorizedArray<Number> const & b,
+                             dealii::VectorizedArray<Number> const & log_a,
+                             dealii::VectorizedArray<Number> const & log_b)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  // the truncation error of the series is of order u^4/9
+  scalar const threshold = std::is_same<Number, float>::value ? 1.e-2 : 1.e-4;
+
+  // log(a) - log(b) = 2 f (1 + u/3 + u^2/5 + u^3/7 + ...) with f = (a - b)/(a + b), u = f^2
+  scalar const f = (a - b) / (a + b);
+  scalar const u = f * f;
+
+  scalar const series =
+    (a + b) / (2.0 * (1.0 + u * (1.0 / 3.0 + u * (1.0 / 5.0 + u * (1.0 / 7.0)))));
+
+  scalar const denominator = dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(
+    u, threshold, scalar(1.0), log_a - log_b);
+
+  return dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(u,
+                                                                           threshold,
+                                                                           series,
+                                                                           (a - b) / denominator);
+}
+
+/*
+ * Quantities at a point required by the entropy-conserving two-point flux. The logarithms are
+ * computed once per point instead of once per pair of points.
+ */
+template<int dim, typename Number>
+struct TwoPointFluxState
+{
+  dealii::VectorizedArray<Number>                         rho;
+  dealii::VectorizedArray<Number>                         log_rho;
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> u;
+  dealii::VectorizedArray<Number>                         p;
+  dealii::VectorizedArray<Number>                         rho_over_p;
+  dealii::VectorizedArray<Number>                         log_rho_over_p;
+};
+
+/*
+ * Entropy-conserving and kinetic-energy-preserving two-point flux for the Euler equations in the
+ * direction of the vector normal, which does not need to be normalized (Ranocha (2020), "Entropy
+ * conserving and kinetic energy preserving numerical methods for the Euler equations using
+ * summation-by-parts operators"). For identical states, the flux reduces to the physical flux in
+ * this direction.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+  calculate_two_point_flux(TwoPointFluxState<dim, Number> const &                          state_i,
+                           TwoPointFluxState<dim, Number> const &                          state_j,
+                           dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normal,
+                           Number const &                                                  gamma)
+{
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+
+  scalar const rho_log =
+    calculate_logarithmic_mean(state_i.rho, state_j.rho, state_i.log_rho, state_j.log_rho);
+  scalar const rho_over_p_log = calculate_logarithmic_mean(state_i.rho_over_p,
+                                                           state_j.rho_over_p,
+                                                           state_i.log_rho_over_p,
+                                                           state_j.log_rho_over_p);
+
+  vector const u_average = 0.5 * (state_i.u + state_j.u);
+  scalar const p_average = 0.5 * (state_i.p + state_j.p);
+
+  scalar const u_n_i = state_i.u * normal;
+  scalar const u_n_j = state_j.u * normal;
+
+  scalar const flux_density = rho_log * 0.5 * (u_n_i + u_n_j);
+
+  vector const flux_momentum = flux_density * u_average + p_average * normal;
+
+  scalar const flux_energy =
+    flux_density * (1.0 / ((gamma - 1.0) * rho_over_p_log) + 0.5 * (state_i.u * state_j.u)) +
+    0.5 * (state_i.p * u_n_j + state_j.p * u_n_i);
+
+  return std::make_tuple(flux_density, flux_momentum, flux_energy);
+}
+
 template<int dim>
 struct BodyForceOperatorData
 {
@@ -488,17 +588,87 @@ private:
   MassOperatorData                        data;
 };
 
+/*
+ * Conserved variables and the derived primitive variables at a quadrature point on one side of a
+ * face or in a cell. The combined evaluation of convective and viscous terms computes these
+ * quantities once per point and passes them to all flux kernels. The gradients are only filled by
+ * calculate_primitive_gradients().
+ */
+template<int dim, typename Number>
+struct PrimitiveState
+{
+  dealii::VectorizedArray<Number>                         rho;
+  dealii::VectorizedArray<Number>                         rho_inv;
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> rho_u;
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> u;
+  dealii::VectorizedArray<Number>                         rho_E;
+  dealii::VectorizedArray<Number>                         p;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> grad_u;
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> grad_T;
+};
+
+template<int dim, typename Number, typename IntegratorScalar, typename IntegratorVector>
+inline DEAL_II_ALWAYS_INLINE //
+  void
+  calculate_primitive_values(PrimitiveState<dim, Number> & state,
+                             IntegratorScalar const &      density,
+                             IntegratorVector const &      momentum,
+                             IntegratorScalar const &      energy,
+                             unsigned int const            q,
+                             Number const &                gamma)
+{
+  state.rho     = density.get_value(q);
+  state.rho_inv = 1.0 / state.rho;
+  state.rho_u   = momentum.get_value(q);
+  state.u       = state.rho_inv * state.rho_u;
+  state.rho_E   = energy.get_value(q);
+  state.p       = calculate_pressure(state.rho_u, state.u, state.rho_E, gamma);
+}
+
+/*
+ * Requires the values of state to be filled by calculate_primitive_values().
+ */
+template<int dim, typename Number, typename IntegratorScalar, typename IntegratorVector>
+inline DEAL_II_ALWAYS_INLINE //
+  void
+  calculate_primitive_gradients(PrimitiveState<dim, Number> & state,
+                                IntegratorScalar const &      density,
+                                IntegratorVector const &      momentum,
+                                IntegratorScalar const &      energy,
+                                unsigned int const            q,
+                                Number const &                gamma,
+                                Number const &                R)
+{
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const grad_rho = density.get_gradient(q);
+
+  state.grad_u = calculate_grad_u(state.rho_inv, state.rho_u, grad_rho, momentum.get_gradient(q));
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const grad_E =
+    calculate_grad_E(state.rho_inv, state.rho_E, grad_rho, energy.get_gradient(q));
+
+  state.grad_T = calculate_grad_T(grad_E, state.u, state.grad_u, gamma, R);
+}
+
 template<int dim>
 struct ConvectiveOperatorData
 {
   ConvectiveOperatorData()
-    : dof_index(0), quad_index(0), heat_capacity_ratio(1.4), specific_gas_constant(287.0)
+    : dof_index(0),
+      quad_index(0),
+      use_flux_differencing(false),
+      heat_capacity_ratio(1.4),
+      specific_gas_constant(287.0)
   {
   }
 
   unsigned int dof_index;
   unsigned int quad_index;
 
+  // entropy-stable flux differencing of the volume term, which requires quad_index to refer to a
+  // Gauss-Lobatto quadrature with degree + 1 points
+  bool use_flux_differencing;
+
   std::shared_ptr<BoundaryDescriptor<dim> const> bc;
 
   double heat_capacity_ratio;
@@ -537,6 +707,32 @@ public:
     gamma = data.heat_capacity_ratio;
     R     = data.specific_gas_constant;
     c_v   = R / (gamma - 1.0);
+
+    if(data.use_flux_differencing)
+    {
+      n_q_points_1d =
+        matrix_free_in.get_shape_info(data.dof_index, data.quad_index).data[0].n_q_points_1d;
+
+      // derivatives D_ij = l_j'(x_i) of the Lagrange polynomials in the Gauss-Lobatto points
+      dealii::QGaussLobatto<1> const quadrature(n_q_points_1d);
+
+      std::vector<dealii::Polynomials::Polynomial<double>> const lagrange_polynomials =
+        dealii::Polynomials::generate_complete_Lagrange_basis(quadrature.get_points());
+
+      flux_differencing_matrix.resize(n_q_points_1d * n_q_points_1d);
+      std::vector<double> values(2);
+      for(unsigned int i = 0; i < n_q_points_1d; ++i)
+      {
+        for(unsigned int j = 0; j < n_q_points_1d; ++j)
+        {
+          lagrange_polynomials[j].value(quadrature.point(i)[0], values);
+          flux_differencing_matrix[i * n_q_points_1d + j] = 2.0 * values[1];
+        }
+      }
+
+      // the logarithms enter the two-point flux via differences of close values
+      log_accuracy = VectorizedMath::Accuracy<Number>(std::numeric_limits<Number>::epsilon());
+    }
   }
 
   void
@@ -551,8 +747,20 @@ public:
   {
     this->eval_time = evaluation_time;
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    if(data.use_flux_differencing)
+    {
+      matrix_free->loop(&This::cell_loop_flux_differencing,
+                        &This::face_loop,
+                        &This::boundary_face_loop,
+                        this,
+                        dst,
+                        src);
+    }
+    else
+    {
+      matrix_free->loop(
+        &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
   }
 
   void
@@ -740,7 +948,134 @@ public:
     return std::make_tuple(flux_density, flux_momentum, flux_energy);
   }
 
+  /*
+   * The following functions evaluate the fluxes for primitive states computed once per quadrature
+   * point, see CombinedOperator.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<vector, tensor, vector>
+    get_volume_flux(PrimitiveState<dim, Number> const & state) const
+  {
+    tensor momentum_flux = outer_product(state.rho_u, state.u);
+    for(unsigned int d = 0; d < dim; ++d)
+      momentum_flux[d][d] += state.p;
+
+    vector energy_flux = (state.rho_E + state.p) * state.u;
+
+    return std::make_tuple(state.rho_u, momentum_flux, energy_flux);
+  }
+
+  /*
+   * Numerical flux for the states on both sides of an interior face, or for the interior state and
+   * the exterior state provided by get_exterior_state() on boundary faces.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_flux(PrimitiveState<dim, Number> const & state_m,
+             PrimitiveState<dim, Number> const & state_p,
+             vector const &                      normal) const
+  {
+    scalar lambda = calculate_lambda(
+      state_m.rho, state_p.rho, state_m.u, state_p.u, state_m.p, state_p.p, gamma);
+
+    scalar u_n_M = state_m.u * normal;
+    scalar u_n_P = state_p.u * normal;
+
+    // average of the physical fluxes in normal direction and jump of the conserved variables
+    scalar flux_density = 0.5 * (state_m.rho_u * normal + state_p.rho_u * normal) +
+                          0.5 * lambda * (state_m.rho - state_p.rho);
+
+    vector flux_momentum =
+      0.5 * (u_n_M * state_m.rho_u + u_n_P * state_p.rho_u + (state_m.p + state_p.p) * normal) +
+      0.5 * lambda * (state_m.rho_u - state_p.rho_u);
+
+    scalar flux_energy =
+      0.5 * ((state_m.rho_E + state_m.p) * u_n_M + (state_p.rho_E + state_p.p) * u_n_P) +
+      0.5 * lambda * (state_m.rho_E - state_p.rho_E);
+
+    return std::make_tuple(flux_density, flux_momentum, flux_energy);
+  }
+
+  /*
+   * Exterior state on boundary faces, shared by the convective and viscous fluxes. As in
+   * get_flux_boundary(), the pressure is prescribed independently of the energy.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    PrimitiveState<dim, Number>
+    get_exterior_state(PrimitiveState<dim, Number> const & state_m,
+                       point const &                       q_point,
+                       BoundaryType const &                boundary_type_density,
+                       BoundaryType const &                boundary_type_velocity,
+                       BoundaryType const &                boundary_type_pressure,
+                       BoundaryType const &                boundary_type_energy,
+                       EnergyBoundaryVariable const &      boundary_variable,
+                       dealii::types::boundary_id const &  boundary_id) const
+  {
+    PrimitiveState<dim, Number> state_p;
+
+    state_p.rho = calculate_exterior_value<dim, Number, 0>(
+      state_m.rho, boundary_type_density, data.bc->density, boundary_id, q_point, this->eval_time);
+
+    state_p.u = calculate_exterior_value<dim, Number, 1>(
+      state_m.u, boundary_type_velocity, data.bc->velocity, boundary_id, q_point, this->eval_time);
+
+    state_p.rho_u = state_p.rho * state_p.u;
+
+    state_p.p = calculate_exterior_value<dim, Number, 0>(state_m.p,
+                                                         boundary_type_pressure,
+                                                         data.bc->pressure,
+                                                         boundary_id,
+                                                         q_point,
+                                                         this->eval_time);
+
+    scalar E_P = dealii::make_vectorized_array<Number>(0.0);
+    if(boundary_variable == EnergyBoundaryVariable::Energy)
+    {
+      E_P = calculate_exterior_value<dim, Number, 0>(state_m.rho_inv * state_m.rho_E,
+                                                     boundary_type_energy,
+                                                     data.bc->energy,
+                                                     boundary_id,
+                                                     q_point,
+                                                     this->eval_time);
+    }
+    else if(boundary_variable == EnergyBoundaryVariable::Temperature)
+    {
+      scalar T_M = calculate_temperature(state_m.p, state_m.rho, R);
+      scalar T_P = calculate_exterior_value<dim, Number, 0>(
+        T_M, boundary_type_energy, data.bc->energy, boundary_id, q_point, this->eval_time);
+
+      E_P = calculate_energy(T_P, state_p.u, c_v);
+    }
+    state_p.rho_E = state_p.rho * E_P;
+
+    state_p.rho_inv = 1.0 / state_p.rho;
+
+    return state_p;
+  }
+
 private:
+  /*
+   * Physical flux in normal direction, which is subtracted from the numerical flux in the face
+   * integrals of the strong form used with flux differencing.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_normal_flux(FaceIntegratorScalar & density,
+                    FaceIntegratorVector & momentum,
+                    FaceIntegratorScalar & energy,
+                    vector const &         normal,
+                    unsigned int const     q) const
+  {
+    scalar rho_inv = 1.0 / density.get_value(q);
+    vector rho_u   = momentum.get_value(q);
+    scalar rho_E   = energy.get_value(q);
+    vector u       = rho_inv * rho_u;
+    scalar p       = calculate_pressure(rho_u, u, rho_E, gamma);
+    scalar u_n     = u * normal;
+
+    return std::make_tuple(rho_u * normal, u_n * rho_u + p * normal, (rho_E + p) * u_n);
+  }
+
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
             VectorType &                                  dst,
@@ -777,6 +1112,137 @@ private:
     }
   }
 
+  /*
+   * Volume term in strong form by flux differencing on Gauss-Lobatto points (Gassner, Winters,
+   * Kopriva (2016), "Split form nodal discontinuous Galerkin schemes with summation-by-parts
+   * property for the compressible Euler equations"),
+   *
+   *   div(F)(x_i) = 1/J_i sum_d sum_j 2 D_ij F#(u_i, u_j) * (J a^d_i + J a^d_j) / 2,
+   *
+   * where the sum over j runs over the points on the line through x_i in direction d, D is the
+   * derivative matrix of the Lagrange polynomials in the Gauss-Lobatto points, J a^d are the
+   * contravariant metric terms, and F# is the entropy-conserving two-point flux. The face
+   * integrals of the strong form are obtained by subtracting the physical normal flux from the
+   * entropy-stable Lax-Friedrichs flux in face_loop() and boundary_face_loop(). Together with the
+   * mass matrix integrated on the same points, the scheme is entropy-stable without
+   * over-integration. All operations act on VectorizedArray, i.e., on several cells at once.
+   */
+  void
+  cell_loop_flux_differencing(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                              VectorType &                                  dst,
+                              VectorType const &                            src,
+                              std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+
+    unsigned int const n_q_points = density.n_q_points;
+
+    dealii::AlignedVector<TwoPointFluxState<dim, Number>> states(n_q_points);
+
+    // metric_terms[q][d] = J a^d at quadrature point q
+    dealii::AlignedVector<tensor> metric_terms(n_q_points);
+    dealii::AlignedVector<scalar> inverse_jacobian_determinant(n_q_points);
+
+    dealii::AlignedVector<scalar> divergence_density(n_q_points);
+    dealii::AlignedVector<vector> divergence_momentum(n_q_points);
+    dealii::AlignedVector<scalar> divergence_energy(n_q_points);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      density.reinit(cell);
+      density.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      momentum.reinit(cell);
+      momentum.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      energy.reinit(cell);
+      energy.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        scalar rho   = density.get_value(q);
+        vector rho_u = momentum.get_value(q);
+        scalar rho_E = energy.get_value(q);
+
+        TwoPointFluxState<dim, Number> & state = states[q];
+
+        state.rho            = rho;
+        state.log_rho        = VectorizedMath::log(rho, log_accuracy);
+        state.u              = rho_u / rho;
+        state.p              = calculate_pressure(rho_u, state.u, rho_E, gamma);
+        state.rho_over_p     = rho / state.p;
+        state.log_rho_over_p = VectorizedMath::log(state.rho_over_p, log_accuracy);
+
+        // inverse_jacobian() returns the inverse and transposed Jacobian J^{-T}
+        tensor const inv_jac_transposed = density.inverse_jacobian(q);
+        inverse_jacobian_determinant[q] = determinant(inv_jac_transposed);
+
+        scalar const jacobian_determinant = 1.0 / inverse_jacobian_determinant[q];
+        for(unsigned int d = 0; d < dim; ++d)
+          for(unsigned int e = 0; e < dim; ++e)
+            metric_terms[q][d][e] = jacobian_determinant * inv_jac_transposed[e][d];
+
+        divergence_density[q]  = dealii::make_vectorized_array<Number>(0.0);
+        divergence_momentum[q] = vector();
+        divergence_energy[q]   = dealii::make_vectorized_array<Number>(0.0);
+      }
+
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        unsigned int const stride = dealii::Utilities::pow(n_q_points_1d, d);
+
+        for(unsigned int q = 0; q < n_q_points; ++q)
+        {
+          // only start from the first point of each line in direction d
+          if((q / stride) % n_q_points_1d != 0)
+            continue;
+
+          // the two-point flux is symmetric, so that each pair of points is visited once
+          for(unsigned int i = 0; i < n_q_points_1d; ++i)
+          {
+            unsigned int const q_i = q + i * stride;
+
+            for(unsigned int j = i; j < n_q_points_1d; ++j)
+            {
+              unsigned int const q_j = q + j * stride;
+
+              vector const normal = 0.5 * (metric_terms[q_i][d] + metric_terms[q_j][d]);
+
+              std::tuple<scalar, vector, scalar> const flux =
+                calculate_two_point_flux(states[q_i], states[q_j], normal, gamma);
+
+              Number const D_ij = flux_differencing_matrix[i * n_q_points_1d + j];
+              divergence_density[q_i] += D_ij * std::get<0>(flux);
+              divergence_momentum[q_i] += D_ij * std::get<1>(flux);
+              divergence_energy[q_i] += D_ij * std::get<2>(flux);
+
+              if(j != i)
+              {
+                Number const D_ji = flux_differencing_matrix[j * n_q_points_1d + i];
+                divergence_density[q_j] += D_ji * std::get<0>(flux);
+                divergence_momentum[q_j] += D_ji * std::get<1>(flux);
+                divergence_energy[q_j] += D_ji * std::get<2>(flux);
+              }
+            }
+          }
+        }
+      }
+
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        density.submit_value(inverse_jacobian_determinant[q] * divergence_density[q], q);
+        momentum.submit_value(inverse_jacobian_determinant[q] * divergence_momentum[q], q);
+        energy.submit_value(inverse_jacobian_determinant[q] * divergence_energy[q], q);
+      }
+
+      density.integrate_scatter(dealii::EvaluationFlags::values, dst);
+      momentum.integrate_scatter(dealii::EvaluationFlags::values, dst);
+      energy.integrate_scatter(dealii::EvaluationFlags::values, dst);
+    }
+  }
+
   void
   face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
             VectorType &                                  dst,
@@ -820,17 +1286,42 @@ private:
         std::tuple<scalar, vector, scalar> flux =
           get_flux(density_m, density_p, momentum_m, momentum_p, energy_m, energy_p, q);
 
-        density_m.submit_value(std::get<0>(flux), q);
-        // - sign since n⁺ = -n⁻
-        density_p.submit_value(-std::get<0>(flux), q);
-
-        momentum_m.submit_value(std::get<1>(flux), q);
-        // - sign since n⁺ = -n⁻
-        momentum_p.submit_value(-std::get<1>(flux), q);
-
-        energy_m.submit_value(std::get<2>(flux), q);
-        // - sign since n⁺ = -n⁻
-        energy_p.submit_value(-std::get<2>(flux), q);
+        if(data.use_flux_differencing)
+        {
+          // strong form, see cell_loop_flux_differencing()
+          vector normal = momentum_m.get_normal_vector(q);
+
+          std::tuple<scalar, vector, scalar> flux_M =
+            get_normal_flux(density_m, momentum_m, energy_m, normal, q);
+          std::tuple<scalar, vector, scalar> flux_P =
+            get_normal_flux(density_p, momentum_p, energy_p, normal, q);
+
+          density_m.submit_value(std::get<0>(flux) - std::get<0>(flux_M), q);
+          // - sign since n⁺ = -n⁻
+          density_p.submit_value(-std::get<0>(flux) + std::get<0>(flux_P), q);
+
+          momentum_m.submit_value(std::get<1>(flux) - std::get<1>(flux_M), q);
+          // - sign since n⁺ = -n⁻
+          momentum_p.submit_value(-std::get<1>(flux) + std::get<1>(flux_P), q);
+
+          energy_m.submit_value(std::get<2>(flux) - std::get<2>(flux_M), q);
+          // - sign since n⁺ = -n⁻
+          energy_p.submit_value(-std::get<2>(flux) + std::get<2>(flux_P), q);
+        }
+        else
+        {
+          density_m.submit_value(std::get<0>(flux), q);
+          // - sign since n⁺ = -n⁻
+          density_p.submit_value(-std::get<0>(flux), q);
+
+          momentum_m.submit_value(std::get<1>(flux), q);
+          // - sign since n⁺ = -n⁻
+          momentum_p.submit_value(-std::get<1>(flux), q);
+
+          energy_m.submit_value(std::get<2>(flux), q);
+          // - sign since n⁺ = -n⁻
+          energy_p.submit_value(-std::get<2>(flux), q);
+        }
       }
 
       density_m.integrate_scatter(dealii::EvaluationFlags::values, dst);
@@ -887,9 +1378,22 @@ private:
                                                                     boundary_id,
                                                                     q);
 
-        density.submit_value(std::get<0>(flux), q);
-        momentum.submit_value(std::get<1>(flux), q);
-        energy.submit_value(std::get<2>(flux), q);
+        if(data.use_flux_differencing)
+        {
+          // strong form, see cell_loop_flux_differencing()
+          std::tuple<scalar, vector, scalar> flux_M =
+            get_normal_flux(density, momentum, energy, momentum.get_normal_vector(q), q);
+
+          density.submit_value(std::get<0>(flux) - std::get<0>(flux_M), q);
+          momentum.submit_value(std::get<1>(flux) - std::get<1>(flux_M), q);
+          energy.submit_value(std::get<2>(flux) - std::get<2>(flux_M), q);
+        }
+        else
+        {
+          density.submit_value(std::get<0>(flux), q);
+          momentum.submit_value(std::get<1>(flux), q);
+          energy.submit_value(std::get<2>(flux), q);
+        }
       }
 
       density.integrate_scatter(dealii::EvaluationFlags::values, dst);
@@ -912,6 +1416,14 @@ private:
   Number c_v;
 
   mutable Number eval_time;
+
+  // flux differencing: number of Gauss-Lobatto points per direction, the matrix 2 D_ij stored
+  // row-wise, and the accuracy of the logarithms in the two-point flux
+  unsigned int n_q_points_1d;
+
+  std::vector<Number> flux_differencing_matrix;
+
+  VectorizedMath::Accuracy<Number> log_accuracy;
 };
 
 
@@ -986,6 +1498,17 @@ public:
     IP::calculate_penalty_parameter<dim, Number>(array_penalty_parameter,
                                                  *matrix_free,
                                                  data.dof_index);
+
+    // the kinematic viscosity is constant and can be included in the penalty parameter of the faces
+    Number const penalty_factor = IP::get_penalty_factor<dim, Number>(
+      degree,
+      get_element_type(matrix_free->get_dof_handler(data.dof_index).get_triangulation()),
+      data.IP_factor);
+
+    IP::calculate_face_penalty_parameter<dim, Number>(array_face_penalty_parameter,
+                                                      array_penalty_parameter,
+                                                      *matrix_free,
+                                                      penalty_factor * nu);
   }
 
   void
@@ -1010,36 +1533,26 @@ public:
     eval_time = evaluation_time;
   }
 
+  /*
+   * Returns the penalty parameter of an interior face batch of a face loop.
+   */
   inline DEAL_II_ALWAYS_INLINE //
     scalar
     get_penalty_parameter(FaceIntegratorScalar & fe_eval_m, FaceIntegratorScalar & fe_eval_p) const
   {
-    scalar tau =
-      std::max(fe_eval_m.read_cell_data(array_penalty_parameter),
-               fe_eval_p.read_cell_data(array_penalty_parameter)) *
-      IP::get_penalty_factor<dim, Number>(
-        degree,
-        get_element_type(
-          fe_eval_m.get_matrix_free().get_dof_handler(data.dof_index).get_triangulation()),
-        data.IP_factor) *
-      nu;
+    (void)fe_eval_p;
 
-    return tau;
+    return array_face_penalty_parameter[fe_eval_m.get_current_cell_index()];
   }
 
+  /*
+   * Returns the penalty parameter of a boundary face batch of a face loop.
+   */
   inline DEAL_II_ALWAYS_INLINE //
     scalar
     get_penalty_parameter(FaceIntegratorScalar & fe_eval) const
   {
-    scalar tau = fe_eval.read_cell_data(array_penalty_parameter) *
-                 IP::get_penalty_factor<dim, Number>(
-                   degree,
-                   get_element_type(
-                     fe_eval.get_matrix_free().get_dof_handler(data.dof_index).get_triangulation()),
-                   data.IP_factor) *
-                 nu;
-
-    return tau;
+    return array_face_penalty_parameter[fe_eval.get_current_cell_index()];
   }
 
   inline DEAL_II_ALWAYS_INLINE //
@@ -1425,6 +1938,107 @@ public:
     return std::make_tuple(vector() /*dummy*/, value_flux_momentum_M, value_flux_energy_M);
   }
 
+  /*
+   * The following functions evaluate the fluxes for primitive states computed once per quadrature
+   * point including the gradients, see CombinedOperator.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<tensor, vector>
+    get_volume_flux(PrimitiveState<dim, Number> const & state) const
+  {
+    tensor tau = calculate_stress_tensor(state.grad_u, mu);
+
+    return std::make_tuple(tau, tau * state.u + lambda * state.grad_T);
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_gradient_flux(PrimitiveState<dim, Number> const & state_m,
+                      PrimitiveState<dim, Number> const & state_p,
+                      vector const &                      normal,
+                      scalar const &                      tau_IP) const
+  {
+    vector tau_M_normal = calculate_stress_tensor(state_m.grad_u, mu) * normal;
+    vector tau_P_normal = calculate_stress_tensor(state_p.grad_u, mu) * normal;
+
+    scalar gradient_flux_density = -tau_IP * (state_m.rho - state_p.rho);
+
+    vector gradient_flux_momentum =
+      0.5 * (tau_M_normal + tau_P_normal) - tau_IP * (state_m.rho_u - state_p.rho_u);
+
+    scalar gradient_flux_energy =
+      0.5 * (state_m.u * tau_M_normal + state_p.u * tau_P_normal +
+             lambda * (state_m.grad_T + state_p.grad_T) * normal) -
+      tau_IP * (state_m.rho_E - state_p.rho_E);
+
+    return std::make_tuple(gradient_flux_density, gradient_flux_momentum, gradient_flux_energy);
+  }
+
+  /*
+   * The exterior state only contains values, the exterior normal gradients are obtained from the
+   * boundary conditions.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_gradient_flux_boundary(PrimitiveState<dim, Number> const & state_m,
+                               PrimitiveState<dim, Number> const & state_p,
+                               vector const &                      normal,
+                               scalar const &                      tau_IP,
+                               point const &                       q_point,
+                               BoundaryType const &                boundary_type_velocity,
+                               BoundaryType const &                boundary_type_energy,
+                               dealii::types::boundary_id const &  boundary_id) const
+  {
+    scalar gradient_flux_density = -tau_IP * (state_m.rho - state_p.rho);
+
+    vector tau_M_normal = calculate_stress_tensor(state_m.grad_u, mu) * normal;
+    vector tau_P_normal = calculate_exterior_normal_grad<dim, Number, 1>(
+      tau_M_normal, boundary_type_velocity, data.bc->velocity, boundary_id, q_point, eval_time);
+
+    vector gradient_flux_momentum =
+      0.5 * (tau_M_normal + tau_P_normal) - tau_IP * (state_m.rho_u - state_p.rho_u);
+
+    scalar grad_T_M_normal = state_m.grad_T * normal;
+    scalar grad_T_P_normal = calculate_exterior_normal_grad<dim, Number, 0>(
+      grad_T_M_normal, boundary_type_energy, data.bc->energy, boundary_id, q_point, eval_time);
+
+    scalar gradient_flux_energy = 0.5 * (state_m.u * tau_M_normal + state_p.u * tau_P_normal +
+                                         lambda * (grad_T_M_normal + grad_T_P_normal)) -
+                                  tau_IP * (state_m.rho_E - state_p.rho_E);
+
+    return std::make_tuple(gradient_flux_density, gradient_flux_momentum, gradient_flux_energy);
+  }
+
+  /*
+   * Value flux of one side of a face for the jumps of the conserved variables multiplied by the
+   * normal vector, which are computed once for both sides. Only the values of state are needed.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<tensor /*value_flux_momentum*/, vector /*value_flux_energy*/>
+    get_value_flux(PrimitiveState<dim, Number> const & state,
+                   vector const &                      jump_rho,
+                   tensor const &                      jump_rho_u,
+                   vector const &                      jump_rho_E) const
+  {
+    tensor grad_u_using_jumps = calculate_grad_u(state.rho_inv,
+                                                 state.rho_u,
+                                                 jump_rho /*instead of grad_rho*/,
+                                                 jump_rho_u /*instead of grad_rho_u*/);
+
+    tensor tau_using_jumps = calculate_stress_tensor(grad_u_using_jumps, mu);
+
+    vector grad_E_using_jumps = calculate_grad_E(state.rho_inv,
+                                                 state.rho_E,
+                                                 jump_rho /*instead of grad_rho*/,
+                                                 jump_rho_E /*instead of grad_rho_E*/);
+
+    vector grad_T_using_jumps =
+      calculate_grad_T(grad_E_using_jumps, state.u, grad_u_using_jumps, gamma, R);
+
+    return std::make_tuple(-0.5 * tau_using_jumps,
+                           -0.5 * (tau_using_jumps * state.u + lambda * grad_T_using_jumps));
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
@@ -1668,13 +2282,426 @@ private:
 
   dealii::AlignedVector<dealii::VectorizedArray<Number>> array_penalty_parameter;
 
+  // penalty parameter of each face batch including the penalty factor and the viscosity
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> array_face_penalty_parameter;
+
   mutable Number eval_time;
 };
 
+template<int dim>
+struct ArtificialViscosityOperatorData
+{
+  ArtificialViscosityOperatorData()
+    : dof_index(0),
+      dof_index_scalar(0),
+      quad_index(0),
+      IP_factor(1.0),
+      viscosity_factor(1.0),
+      kappa(1.0),
+      max_wave_speed(1.0)
+  {
+  }
+
+  unsigned int dof_index;
+  unsigned int dof_index_scalar;
+
+  // quad_index has to refer to a Gauss quadrature with at least degree + 1 points
+  unsigned int quad_index;
+
+  double IP_factor;
+
+  // the viscosity of troubled cells is viscosity_factor * max_wave_speed * h / degree
+  double viscosity_factor;
+
+  // width of the transition of the smoothness indicator in log10 scale
+  double kappa;
+
+  double max_wave_speed;
+};
+
+/*
+ * Artificial viscosity for shock capturing (Persson, Peraire (2006), "Sub-cell shock capturing for
+ * discontinuous Galerkin methods"). The smoothness of the density in a cell is measured by the
+ * fraction s of its L2 norm contained in the modes of degree p of an orthonormal Legendre basis,
+ * and the cellwise constant viscosity is ramped up from zero for log10(s) < s_0 - kappa to its
+ * maximum for log10(s) > s_0 + kappa with s_0 = log10(1/p^4). The resulting Laplacian on all
+ * conserved variables is discretized by the symmetric interior penalty method with homogeneous
+ * Neumann boundary conditions.
+ *
+ * The indicator only reads the density of each cell and applies a 1D transformation in each
+ * direction. The diffusive term is skipped for cell batches and faces without troubled cells, and
+ * completely if there are no troubled cells at all.
+ */
+template<int dim, typename Number>
+class ArtificialViscosityOperator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef ArtificialViscosityOperator<dim, Number> This;
+
+  typedef CellIntegrator<dim, 1, Number>       CellIntegratorScalar;
+  typedef FaceIntegrator<dim, 1, Number>       FaceIntegratorScalar;
+  typedef CellIntegrator<dim, dim + 2, Number> CellIntegratorAll;
+  typedef FaceIntegrator<dim, dim + 2, Number> FaceIntegratorAll;
+
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+
+  typedef typename FaceIntegratorAll::value_type    value_type;
+  typedef typename FaceIntegratorAll::gradient_type gradient_type;
+
+  ArtificialViscosityOperator() : matrix_free(nullptr), degree(1), has_troubled_cells(false)
+  {
+  }
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const &      matrix_free_in,
+             ArtificialViscosityOperatorData<dim> const & data_in)
+  {
+    this->matrix_free = &matrix_free_in;
+    this->data        = data_in;
+
+    dealii::FiniteElement<dim> const & fe = matrix_free->get_dof_handler(data.dof_index).get_fe();
+    degree                                = fe.degree;
+
+    IP::calculate_penalty_parameter<dim, Number>(array_penalty_parameter,
+                                                 *matrix_free,
+                                                 data.dof_index);
+
+    IP::calculate_face_penalty_parameter<dim, Number>(
+      array_face_penalty_parameter,
+      array_penalty_parameter,
+      *matrix_free,
+      IP::get_penalty_factor<dim, Number>(
+        degree,
+        get_element_type(matrix_free->get_dof_handler(data.dof_index).get_triangulation()),
+        data.IP_factor));
+
+    matrix_free->initialize_dof_vector(viscosity, data.dof_index_scalar);
+
+    // maximum viscosity of each cell
+    array_viscosity.resize(matrix_free->n_cell_batches());
+    array_max_viscosity.resize(matrix_free->n_cell_batches());
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      scalar h = dealii::make_vectorized_array<Number>(1.0);
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+        h[v] = matrix_free->get_cell_iterator(cell, v)->minimum_vertex_distance();
+
+      array_max_viscosity[cell] = data.viscosity_factor * data.max_wave_speed / degree * h;
+    }
+
+    // transformation of the nodal values in 1D to the coefficients of the orthonormal Legendre
+    // polynomials on [0,1], computed with the Gauss quadrature of the shape info
+    auto const & shape_data = matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+
+    n_dofs_1d                        = degree + 1;
+    unsigned int const n_q_points_1d = shape_data.n_q_points_1d;
+
+    AssertThrow(n_q_points_1d >= n_dofs_1d,
+                dealii::ExcMessage("The shock indicator requires a quadrature with at least "
+                                   "degree + 1 points."));
+
+    legendre_transform.resize(n_dofs_1d * n_dofs_1d);
+    for(unsigned int k = 0; k < n_dofs_1d; ++k)
+    {
+      dealii::Polynomials::Legendre const legendre(k);
+
+      double norm = 0.0;
+      for(unsigned int q = 0; q < n_q_points_1d; ++q)
+      {
+        double const value = legendre.value(shape_data.quadrature.point(q)[0]);
+        norm += shape_data.quadrature.weight(q) * value * value;
+      }
+      norm = std::sqrt(norm);
+
+      for(unsigned int j = 0; j < n_dofs_1d; ++j)
+      {
+        double coefficient = 0.0;
+        for(unsigned int q = 0; q < n_q_points_1d; ++q)
+          coefficient += shape_data.quadrature.weight(q) *
+                         legendre.value(shape_data.quadrature.point(q)[0]) *
+                         shape_data.shape_values[j * n_q_points_1d + q];
+
+        legendre_transform[k * n_dofs_1d + j] = coefficient / norm;
+      }
+    }
+
+    // modes of degree p in at least one direction, which are not contained in Q_{p-1}
+    unsigned int const n_dofs = dealii::Utilities::pow(n_dofs_1d, dim);
+    is_highest_mode.resize(n_dofs);
+    for(unsigned int i = 0; i < n_dofs; ++i)
+    {
+      is_highest_mode[i] = false;
+      for(unsigned int d = 0, index = i; d < dim; ++d, index /= n_dofs_1d)
+        if(index % n_dofs_1d == degree)
+          is_highest_mode[i] = true;
+    }
+  }
+
+  void
+  evaluate_add(VectorType & dst, VectorType const & src, Number const /*evaluation_time*/) const
+  {
+    update_viscosity(src);
+
+    if(has_troubled_cells)
+    {
+      matrix_free->loop(
+        &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
+  }
+
+  /*
+   * Evaluates the smoothness indicator for src and updates the cellwise viscosity.
+   */
+  void
+  update_viscosity(VectorType const & src) const
+  {
+    CellIntegratorScalar density(*matrix_free, data.dof_index, data.quad_index, 0);
+    CellIntegratorScalar viscosity_integrator(*matrix_free,
+                                              data.dof_index_scalar,
+                                              data.quad_index);
+
+    unsigned int const n_dofs = density.dofs_per_cell;
+    std::vector<scalar> modes(n_dofs), line(n_dofs_1d);
+
+    double const s_0 = -4.0 * std::log10(static_cast<double>(degree));
+
+    viscosity.zero_out_ghost_values();
+
+    Number max_viscosity = 0.0;
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      density.reinit(cell);
+      density.read_dof_values(src);
+
+      for(unsigned int i = 0; i < n_dofs; ++i)
+        modes[i] = density.begin_dof_values()[i];
+
+      // sum factorization of the transformation to the Legendre coefficients
+      for(unsigned int d = 0, stride = 1; d < dim; ++d, stride *= n_dofs_1d)
+      {
+        for(unsigned int i = 0; i < n_dofs; ++i)
+        {
+          if((i / stride) % n_dofs_1d != 0)
+            continue;
+
+          for(unsigned int k = 0; k < n_dofs_1d; ++k)
+          {
+            line[k] = dealii::make_vectorized_array<Number>(0.0);
+            for(unsigned int j = 0; j < n_dofs_1d; ++j)
+              line[k] += legendre_transform[k * n_dofs_1d + j] * modes[i + j * stride];
+          }
+
+          for(unsigned int k = 0; k < n_dofs_1d; ++k)
+            modes[i + k * stride] = line[k];
+        }
+      }
+
+      scalar norm_square         = dealii::make_vectorized_array<Number>(0.0);
+      scalar norm_square_highest = dealii::make_vectorized_array<Number>(0.0);
+      for(unsigned int i = 0; i < n_dofs; ++i)
+      {
+        scalar const mode_square = modes[i] * modes[i];
+        norm_square += mode_square;
+        if(is_highest_mode[i])
+          norm_square_highest += mode_square;
+      }
+
+      scalar ramp = dealii::make_vectorized_array<Number>(0.0);
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      {
+        if(norm_square_highest[v] <= 0.0 or norm_square[v] <= 0.0)
+          continue;
+
+        double const s = std::log10(norm_square_highest[v] / norm_square[v]);
+
+        if(s > s_0 + data.kappa)
+          ramp[v] = 1.0;
+        else if(s > s_0 - data.kappa)
+          ramp[v] = 0.5 * (1.0 + std::sin(0.5 * dealii::numbers::PI * (s - s_0) / data.kappa));
+      }
+
+      array_viscosity[cell] = ramp * array_max_viscosity[cell];
+
+      for(unsigned int v = 0; v < scalar::size(); ++v)
+        max_viscosity = std::max(max_viscosity, array_viscosity[cell][v]);
+
+      viscosity_integrator.reinit(cell);
+      for(unsigned int i = 0; i < viscosity_integrator.dofs_per_cell; ++i)
+        viscosity_integrator.begin_dof_values()[i] = array_viscosity[cell];
+      viscosity_integrator.set_dof_values(viscosity);
+    }
+
+    has_troubled_cells =
+      dealii::Utilities::MPI::max(max_viscosity, viscosity.get_mpi_communicator()) > 0.0;
+
+    // the viscosity of neighboring cells is needed on faces
+    if(has_troubled_cells)
+      viscosity.update_ghost_values();
+  }
+
+  /*
+   * Cellwise viscosity of the last call of update_viscosity().
+   */
+  VectorType const &
+  get_viscosity() const
+  {
+    return viscosity;
+  }
+
+private:
+  static bool
+  is_zero(scalar const & value)
+  {
+    for(unsigned int v = 0; v < scalar::size(); ++v)
+      if(value[v] > 0.0)
+        return false;
+
+    return true;
+  }
+
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            VectorType &                                  dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorAll integrator(matrix_free, data.dof_index, data.quad_index, 0);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      scalar const epsilon = array_viscosity[cell];
+
+      if(is_zero(epsilon))
+        continue;
+
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src, dealii::EvaluationFlags::gradients);
+
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      {
+        gradient_type gradient = integrator.get_gradient(q);
+        for(unsigned int c = 0; c < dim + 2; ++c)
+          gradient[c] *= epsilon;
+
+        integrator.submit_gradient(gradient, q);
+      }
+
+      integrator.integrate_scatter(dealii::EvaluationFlags::gradients, dst);
+    }
+  }
+
+  void
+  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            VectorType &                                  dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & face_range) const
+  {
+    FaceIntegratorAll integrator_m(matrix_free, true, data.dof_index, data.quad_index, 0);
+    FaceIntegratorAll integrator_p(matrix_free, false, data.dof_index, data.quad_index, 0);
+
+    FaceIntegratorScalar viscosity_m(matrix_free, true, data.dof_index_scalar, data.quad_index);
+    FaceIntegratorScalar viscosity_p(matrix_free, false, data.dof_index_scalar, data.quad_index);
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    for(unsigned int face = face_range.first; face < face_range.second; face++)
+    {
+      viscosity_m.reinit(face);
+      viscosity_m.gather_evaluate(viscosity, dealii::EvaluationFlags::values);
+      viscosity_p.reinit(face);
+      viscosity_p.gather_evaluate(viscosity, dealii::EvaluationFlags::values);
+
+      // the viscosity is constant per cell
+      scalar const epsilon_M = viscosity_m.get_value(0);
+      scalar const epsilon_P = viscosity_p.get_value(0);
+
+      if(is_zero(epsilon_M) and is_zero(epsilon_P))
+        continue;
+
+      integrator_m.reinit(face);
+      integrator_m.gather_evaluate(src, flags);
+      integrator_p.reinit(face);
+      integrator_p.gather_evaluate(src, flags);
+
+      scalar const tau_IP = array_face_penalty_parameter[face] * std::max(epsilon_M, epsilon_P);
+
+      for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+      {
+        vector const normal = integrator_m.get_normal_vector(q);
+
+        value_type const    jump       = integrator_m.get_value(q) - integrator_p.get_value(q);
+        gradient_type const gradient_M = integrator_m.get_gradient(q);
+        gradient_type const gradient_P = integrator_p.get_gradient(q);
+
+        value_type    flux;
+        gradient_type gradient_flux_M, gradient_flux_P;
+        for(unsigned int c = 0; c < dim + 2; ++c)
+        {
+          flux[c] = 0.5 * (epsilon_M * gradient_M[c] + epsilon_P * gradient_P[c]) * normal -
+                    tau_IP * jump[c];
+
+          gradient_flux_M[c] = (-0.5 * epsilon_M * jump[c]) * normal;
+          gradient_flux_P[c] = (-0.5 * epsilon_P * jump[c]) * normal;
+        }
+
+        integrator_m.submit_value(-flux, q);
+        integrator_p.submit_value(flux, q);
+
+        integrator_m.submit_gradient(gradient_flux_M, q);
+        integrator_p.submit_gradient(gradient_flux_P, q);
+      }
+
+      integrator_m.integrate_scatter(flags, dst);
+      integrator_p.integrate_scatter(flags, dst);
+    }
+  }
+
+  /*
+   * Homogeneous Neumann boundary conditions for the artificial viscosity.
+   */
+  void
+  boundary_face_loop(dealii::MatrixFree<dim, Number> const & /*matrix_free*/,
+                     VectorType & /*dst*/,
+                     VectorType const & /*src*/,
+                     std::pair<unsigned int, unsigned int> const & /*face_range*/) const
+  {
+  }
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  ArtificialViscosityOperatorData<dim> data;
+
+  unsigned int degree;
+
+  dealii::AlignedVector<scalar> array_penalty_parameter;
+
+  // penalty parameter of each face batch including the penalty factor
+  dealii::AlignedVector<scalar> array_face_penalty_parameter;
+
+  // viscosity of troubled cells
+  dealii::AlignedVector<scalar> array_max_viscosity;
+
+  // viscosity of the current solution, per cell batch and as a vector for the neighbors on faces
+  mutable dealii::AlignedVector<scalar> array_viscosity;
+  mutable VectorType                    viscosity;
+
+  mutable bool has_troubled_cells;
+
+  // transformation to the Legendre coefficients in 1D
+  unsigned int        n_dofs_1d;
+  std::vector<Number> legendre_transform;
+  std::vector<bool>   is_highest_mode;
+};
+
 template<int dim>
 struct CombinedOperatorData
 {
-  CombinedOperatorData() : dof_index(0), quad_index(0)
+  CombinedOperatorData()
+    : dof_index(0), quad_index(0), heat_capacity_ratio(1.4), specific_gas_constant(287.0)
   {
   }
 
@@ -1682,8 +2709,18 @@ struct CombinedOperatorData
   unsigned int quad_index;
 
   std::shared_ptr<BoundaryDescriptor<dim> const> bc;
+
+  double heat_capacity_ratio;
+  double specific_gas_constant;
 };
 
+/*
+ * Evaluates convective and viscous terms in a single pass over cells and faces. The conversion
+ * from conserved to primitive variables and their gradients is performed once per quadrature point
+ * and side of a face, and the resulting states are shared by the convective flux, the viscous
+ * fluxes, and the penalty terms.
+ */
+
 template<int dim, typename Number>
 class CombinedOperator
 {
@@ -1704,7 +2741,14 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  CombinedOperator() : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr)
+  typedef PrimitiveState<dim, Number> State;
+
+  CombinedOperator()
+    : matrix_free(nullptr),
+      convective_operator(nullptr),
+      viscous_operator(nullptr),
+      gamma(1.4),
+      R(287.0)
   {
   }
 
@@ -1719,6 +2763,9 @@ public:
 
     this->convective_operator = &convective_operator_in;
     this->viscous_operator    = &viscous_operator_in;
+
+    gamma = data.heat_capacity_ratio;
+    R     = data.specific_gas_constant;
   }
 
   void
@@ -1769,15 +2816,17 @@ private:
 
       for(unsigned int q = 0; q < momentum.n_q_points; ++q)
       {
-        std::tuple<vector, tensor, vector> conv_flux =
-          convective_operator->get_volume_flux(density, momentum, energy, q);
+        State state;
+        calculate_primitive_values(state, density, momentum, energy, q, gamma);
+        calculate_primitive_gradients(state, density, momentum, energy, q, gamma, R);
+
+        std::tuple<vector, tensor, vector> conv_flux = convective_operator->get_volume_flux(state);
 
-        std::tuple<vector, tensor, vector> visc_flux =
-          viscous_operator->get_volume_flux(density, momentum, energy, q);
+        std::tuple<tensor, vector> visc_flux = viscous_operator->get_volume_flux(state);
 
         density.submit_gradient(-std::get<0>(conv_flux), q);
-        momentum.submit_gradient(-std::get<1>(conv_flux) + std::get<1>(visc_flux), q);
-        energy.submit_gradient(-std::get<2>(conv_flux) + std::get<2>(visc_flux), q);
+        momentum.submit_gradient(-std::get<1>(conv_flux) + std::get<0>(visc_flux), q);
+        energy.submit_gradient(-std::get<2>(conv_flux) + std::get<1>(visc_flux), q);
       }
 
       density.integrate_scatter(dealii::EvaluationFlags::gradients, dst);
@@ -1838,15 +2887,28 @@ private:
 
       for(unsigned int q = 0; q < density_m.n_q_points; ++q)
       {
-        std::tuple<scalar, vector, scalar> conv_flux = convective_operator->get_flux(
-          density_m, density_p, momentum_m, momentum_p, energy_m, energy_p, q);
+        vector normal = momentum_m.get_normal_vector(q);
 
-        std::tuple<scalar, vector, scalar> visc_grad_flux = viscous_operator->get_gradient_flux(
-          density_m, density_p, momentum_m, momentum_p, energy_m, energy_p, tau_IP, q);
+        State state_m, state_p;
+        calculate_primitive_values(state_m, density_m, momentum_m, energy_m, q, gamma);
+        calculate_primitive_gradients(state_m, density_m, momentum_m, energy_m, q, gamma, R);
+        calculate_primitive_values(state_p, density_p, momentum_p, energy_p, q, gamma);
+        calculate_primitive_gradients(state_p, density_p, momentum_p, energy_p, q, gamma, R);
 
-        std::tuple<vector, tensor, vector, vector, tensor, vector> visc_value_flux =
-          viscous_operator->get_value_flux(
-            density_m, density_p, momentum_m, momentum_p, energy_m, energy_p, q);
+        std::tuple<scalar, vector, scalar> conv_flux =
+          convective_operator->get_flux(state_m, state_p, normal);
+
+        std::tuple<scalar, vector, scalar> visc_grad_flux =
+          viscous_operator->get_gradient_flux(state_m, state_p, normal, tau_IP);
+
+        vector jump_rho   = (state_m.rho - state_p.rho) * normal;
+        tensor jump_rho_u = outer_product(state_m.rho_u - state_p.rho_u, normal);
+        vector jump_rho_E = (state_m.rho_E - state_p.rho_E) * normal;
+
+        std::tuple<tensor, vector> visc_value_flux_m =
+          viscous_operator->get_value_flux(state_m, jump_rho, jump_rho_u, jump_rho_E);
+        std::tuple<tensor, vector> visc_value_flux_p =
+          viscous_operator->get_value_flux(state_p, jump_rho, jump_rho_u, jump_rho_E);
 
         density_m.submit_value(std::get<0>(conv_flux) - std::get<0>(visc_grad_flux), q);
         // - sign since n⁺ = -n⁻
@@ -1856,17 +2918,17 @@ private:
         // - sign since n⁺ = -n⁻
         momentum_p.submit_value(-std::get<1>(conv_flux) + std::get<1>(visc_grad_flux), q);
 
-        momentum_m.submit_gradient(std::get<1>(visc_value_flux), q);
+        momentum_m.submit_gradient(std::get<0>(visc_value_flux_m), q);
         // note that value_flux_momentum is not conservative
-        momentum_p.submit_gradient(std::get<4>(visc_value_flux), q);
+        momentum_p.submit_gradient(std::get<0>(visc_value_flux_p), q);
 
         energy_m.submit_value(std::get<2>(conv_flux) - std::get<2>(visc_grad_flux), q);
         // - sign since n⁺ = -n⁻
         energy_p.submit_value(-std::get<2>(conv_flux) + std::get<2>(visc_grad_flux), q);
 
-        energy_m.submit_gradient(std::get<2>(visc_value_flux), q);
+        energy_m.submit_gradient(std::get<1>(visc_value_flux_m), q);
         // note that value_flux_energy is not conservative
-        energy_p.submit_gradient(std::get<5>(visc_value_flux), q);
+        energy_p.submit_gradient(std::get<1>(visc_value_flux_p), q);
       }
 
       density_m.integrate_scatter(dealii::EvaluationFlags::values, dst);
@@ -1926,48 +2988,48 @@ private:
 
       for(unsigned int q = 0; q < density.n_q_points; ++q)
       {
+        vector normal  = momentum.get_normal_vector(q);
+        point  q_point = density.quadrature_point(q);
+
+        State state_m;
+        calculate_primitive_values(state_m, density, momentum, energy, q, gamma);
+        calculate_primitive_gradients(state_m, density, momentum, energy, q, gamma, R);
+
+        State state_p = convective_operator->get_exterior_state(state_m,
+                                                                q_point,
+                                                                boundary_type_density,
+                                                                boundary_type_velocity,
+                                                                boundary_type_pressure,
+                                                                boundary_type_energy,
+                                                                boundary_variable,
+                                                                boundary_id);
+
         std::tuple<scalar, vector, scalar> conv_flux =
-          convective_operator->get_flux_boundary(density,
-                                                 momentum,
-                                                 energy,
-                                                 boundary_type_density,
-                                                 boundary_type_velocity,
-                                                 boundary_type_pressure,
-                                                 boundary_type_energy,
-                                                 boundary_variable,
-                                                 boundary_id,
-                                                 q);
+          convective_operator->get_flux(state_m, state_p, normal);
 
         std::tuple<scalar, vector, scalar> visc_grad_flux =
-          viscous_operator->get_gradient_flux_boundary(density,
-                                                       momentum,
-                                                       energy,
+          viscous_operator->get_gradient_flux_boundary(state_m,
+                                                       state_p,
+                                                       normal,
                                                        tau_IP,
-                                                       boundary_type_density,
+                                                       q_point,
                                                        boundary_type_velocity,
                                                        boundary_type_energy,
-                                                       boundary_variable,
-                                                       boundary_id,
-                                                       q);
-
-        std::tuple<vector, tensor, vector> visc_value_flux =
-          viscous_operator->get_value_flux_boundary(density,
-                                                    momentum,
-                                                    energy,
-                                                    boundary_type_density,
-                                                    boundary_type_velocity,
-                                                    boundary_type_energy,
-                                                    boundary_variable,
-                                                    boundary_id,
-                                                    q);
+                                                       boundary_id);
+
+        std::tuple<tensor, vector> visc_value_flux =
+          viscous_operator->get_value_flux(state_m,
+                                           (state_m.rho - state_p.rho) * normal,
+                                           outer_product(state_m.rho_u - state_p.rho_u, normal),
+                                           (state_m.rho_E - state_p.rho_E) * normal);
 
         density.submit_value(std::get<0>(conv_flux) - std::get<0>(visc_grad_flux), q);
 
         momentum.submit_value(std::get<1>(conv_flux) - std::get<1>(visc_grad_flux), q);
-        momentum.submit_gradient(std::get<1>(visc_value_flux), q);
+        momentum.submit_gradient(std::get<0>(visc_value_flux), q);
 
         energy.submit_value(std::get<2>(conv_flux) - std::get<2>(visc_grad_flux), q);
-        energy.submit_gradient(std::get<2>(visc_value_flux), q);
+        energy.submit_gradient(std::get<1>(visc_value_flux), q);
       }
 
       density.integrate_scatter(dealii::EvaluationFlags::values, dst);
@@ -1985,6 +3047,12 @@ private:
 
   ConvectiveOperator<dim, Number> const * convective_operator;
   ViscousOperator<dim, Number> const *    viscous_operator;
+
+  // heat capacity ratio
+  Number gamma;
+
+  // specific gas constant
+  Number R;
 };
 
 } // namespace CompNS
@@ -124,6 +124,8 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
     n_q_points_conv = param.degree + (param.degree + 2) / 2;
   else if(param.n_q_points_convective == QuadratureRule::Overintegration2k)
     n_q_points_conv = 2 * param.degree + 1;
+  else if(param.n_q_points_convective == QuadratureRule::EntropyStableSplitForm)
+    n_q_points_conv = param.degree + 1;
   else
     AssertThrow(false, dealii::ExcMessage("Specified quadrature rule is not implemented."));
 
@@ -145,9 +147,18 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_standard =
     create_quadrature<dim>(param.grid.element_type, param.degree + 1);
   matrix_free_data.insert_quadrature(*quadrature_standard, field + quad_index_standard);
-  std::shared_ptr<dealii::Quadrature<dim>> quadrature_conv =
-    create_quadrature<dim>(param.grid.element_type, n_q_points_conv);
-  matrix_free_data.insert_quadrature(*quadrature_conv, field + quad_index_overintegration_conv);
+  if(param.n_q_points_convective == QuadratureRule::EntropyStableSplitForm)
+  {
+    // flux differencing requires the summation-by-parts property of Gauss-Lobatto quadrature
+    matrix_free_data.insert_quadrature(dealii::QGaussLobatto<1>(n_q_points_conv),
+                                       field + quad_index_overintegration_conv);
+  }
+  else
+  {
+    std::shared_ptr<dealii::Quadrature<dim>> quadrature_conv =
+      create_quadrature<dim>(param.grid.element_type, n_q_points_conv);
+    matrix_free_data.insert_quadrature(*quadrature_conv, field + quad_index_overintegration_conv);
+  }
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_vis =
     create_quadrature<dim>(param.grid.element_type, n_q_points_vis);
   matrix_free_data.insert_quadrature(*quadrature_vis, field + quad_index_overintegration_vis);
@@ -163,10 +174,14 @@ Operator<dim, Number>::setup_operators()
   mass_operator_data.quad_index = get_quad_index_standard();
   mass_operator.initialize(*matrix_free, mass_operator_data);
 
-  // inverse mass operator
+  // inverse mass operator, integrated on the Gauss-Lobatto points of the convective term in case
+  // of the entropy-stable split form to obtain the mass matrix of the summation-by-parts operator
   InverseMassOperatorData inverse_mass_operator_data_all;
   inverse_mass_operator_data_all.dof_index  = get_dof_index_all();
-  inverse_mass_operator_data_all.quad_index = get_quad_index_standard();
+  inverse_mass_operator_data_all.quad_index =
+    param.n_q_points_convective == QuadratureRule::EntropyStableSplitForm ?
+      get_quad_index_overintegration_conv() :
+      get_quad_index_standard();
   inverse_mass_operator_data_all.parameters = param.inverse_mass_operator;
   inverse_mass_all.initialize(*matrix_free, inverse_mass_operator_data_all);
 
@@ -195,6 +210,8 @@ Operator<dim, Number>::setup_operators()
   ConvectiveOperatorData<dim> convective_operator_data;
   convective_operator_data.dof_index             = get_dof_index_all();
   convective_operator_data.quad_index            = get_quad_index_overintegration_conv();
+  convective_operator_data.use_flux_differencing =
+    param.n_q_points_convective == QuadratureRule::EntropyStableSplitForm;
   convective_operator_data.bc                    = boundary_descriptor;
   convective_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
   convective_operator_data.specific_gas_constant = param.specific_gas_constant;
@@ -213,6 +230,21 @@ Operator<dim, Number>::setup_operators()
   viscous_operator_data.bc                    = boundary_descriptor;
   viscous_operator.initialize(*matrix_free, viscous_operator_data);
 
+  if(param.shock_capturing == ShockCapturing::ArtificialViscosity)
+  {
+    ArtificialViscosityOperatorData<dim> artificial_viscosity_operator_data;
+    artificial_viscosity_operator_data.dof_index        = get_dof_index_all();
+    artificial_viscosity_operator_data.dof_index_scalar = get_dof_index_scalar();
+    artificial_viscosity_operator_data.quad_index       = get_quad_index_standard();
+    artificial_viscosity_operator_data.IP_factor        = param.IP_factor;
+    artificial_viscosity_operator_data.viscosity_factor = param.shock_capturing_viscosity_factor;
+    artificial_viscosity_operator_data.kappa            = param.shock_capturing_kappa;
+    artificial_viscosity_operator_data.max_wave_speed =
+      param.max_velocity + std::sqrt(param.heat_capacity_ratio * param.specific_gas_constant *
+                                     param.max_temperature);
+    artificial_viscosity_operator.initialize(*matrix_free, artificial_viscosity_operator_data);
+  }
+
   if(param.use_combined_operator == true)
   {
     AssertThrow(param.n_q_points_convective == param.n_q_points_viscous,
@@ -220,9 +252,11 @@ Operator<dim, Number>::setup_operators()
                                    "and viscous term in case of combined operator."));
 
     CombinedOperatorData<dim> combined_operator_data;
-    combined_operator_data.dof_index  = get_dof_index_all();
-    combined_operator_data.quad_index = get_quad_index_overintegration_vis();
-    combined_operator_data.bc         = boundary_descriptor;
+    combined_operator_data.dof_index             = get_dof_index_all();
+    combined_operator_data.quad_index            = get_quad_index_overintegration_vis();
+    combined_operator_data.bc                    = boundary_descriptor;
+    combined_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
+    combined_operator_data.specific_gas_constant = param.specific_gas_constant;
 
     combined_operator.initialize(*matrix_free,
                                  combined_operator_data,
@@ -270,6 +304,8 @@ Operator<dim, Number>::setup()
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
+  memory_matrix_free.set(mf->memory_consumption());
+
   // Subsequently, call the other setup function with MatrixFree/MatrixFreeData objects as
   // arguments.
   this->setup(mf, mf_data);
@@ -363,6 +399,38 @@ Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number
   wall_time_operator_evaluation += timer.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_and_update(
+  VectorType &                                                        dst,
+  VectorType const &                                                  src,
+  Number const                                                        time,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  if(not rhs.partitioners_are_globally_compatible(*src.get_partitioner()))
+    rhs.reinit(src);
+
+  evaluate_convective_and_viscous(rhs, src, time);
+
+  // the viscous and convective terms are shifted to the right-hand side of the equation by the
+  // scaling factor of the inverse mass operator, unless the body force term has to be added
+  double scaling_factor = -1.0;
+  if(param.right_hand_side == true)
+  {
+    rhs *= -1.0;
+    body_force_operator.evaluate_add(rhs, src, time);
+    scaling_factor = 1.0;
+  }
+
+  // apply inverse mass operator, src is no longer accessed such that dst may be the same vector
+  inverse_mass_all.apply_scale(dst, scaling_factor, rhs, operation_after_loop);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_convective(VectorType &       dst,
@@ -398,27 +466,57 @@ Operator<dim, Number>::evaluate_convective_and_viscous(VectorType &       dst,
   {
     // viscous and convective terms
     combined_operator.evaluate(dst, src, time);
+
+    if(param.shock_capturing == ShockCapturing::ArtificialViscosity)
+    {
+      artificial_viscosity_operator.evaluate_add(dst, src, time);
+    }
   }
   else // apply operators separately
   {
-    // set dst to zero
-    dst = 0.0;
+    evaluate_convective_and_viscous_separately(dst, src, time);
+  }
+}
 
-    // viscous operator
-    if(param.equation_type == EquationType::NavierStokes)
-    {
-      viscous_operator.evaluate_add(dst, src, time);
-    }
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_convective_and_viscous_separately(VectorType &       dst,
+                                                                  VectorType const & src,
+                                                                  Number const       time) const
+{
+  // set dst to zero
+  dst = 0.0;
 
-    // convective operator
-    if(param.equation_type == EquationType::Euler or
-       param.equation_type == EquationType::NavierStokes)
-    {
-      convective_operator.evaluate_add(dst, src, time);
-    }
+  // viscous operator
+  if(param.equation_type == EquationType::NavierStokes)
+  {
+    viscous_operator.evaluate_add(dst, src, time);
+  }
+
+  // convective operator
+  if(param.equation_type == EquationType::Euler or
+     param.equation_type == EquationType::NavierStokes)
+  {
+    convective_operator.evaluate_add(dst, src, time);
+  }
+
+  // shock capturing
+  if(param.shock_capturing == ShockCapturing::ArtificialViscosity)
+  {
+    artificial_viscosity_operator.evaluate_add(dst, src, time);
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::update_shock_capturing_indicator(VectorType const & src) const
+{
+  AssertThrow(param.shock_capturing == ShockCapturing::ArtificialViscosity,
+              dealii::ExcMessage("Shock capturing is not used."));
+
+  artificial_viscosity_operator.update_viscosity(src);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::apply_inverse_mass(VectorType & dst, VectorType const & src) const
@@ -497,6 +595,20 @@ Operator<dim, Number>::get_quad_index_standard() const
   return matrix_free_data->get_quad_index(field + quad_index_standard);
 }
 
+template<int dim, typename Number>
+double
+Operator<dim, Number>::get_heat_capacity_ratio() const
+{
+  return param.heat_capacity_ratio;
+}
+
+template<int dim, typename Number>
+double
+Operator<dim, Number>::get_specific_gas_constant() const
+{
+  return param.specific_gas_constant;
+}
+
 template<int dim, typename Number>
 unsigned int
 Operator<dim, Number>::get_quad_index_overintegration_conv() const
@@ -38,6 +38,7 @@
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/navier_stokes_calculators.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -103,6 +104,20 @@ public:
   void
   evaluate(VectorType & dst, VectorType const & src, Number const time) const final;
 
+  /*
+   *  Same as evaluate(), but the inverse mass operator calls operation_after_loop(start, end) for
+   *  ranges of DoFs of dst once they are computed. This allows to fuse the vector updates of
+   *  low-storage Runge-Kutta schemes with the application of the inverse mass operator. dst and
+   *  src may be the same vector.
+   */
+  void
+  evaluate_and_update(
+    VectorType &                                                        dst,
+    VectorType const &                                                  src,
+    Number const                                                        time,
+    std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const final;
+
   void
   evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const;
 
@@ -114,6 +129,22 @@ public:
                                   VectorType const & src,
                                   Number const       time) const;
 
+  /*
+   * Evaluates convective and viscous terms with separate loops over cells and faces also if the
+   * combined operator is used, which allows to compare the throughput of both variants.
+   */
+  void
+  evaluate_convective_and_viscous_separately(VectorType &       dst,
+                                             VectorType const & src,
+                                             Number const       time) const;
+
+  /*
+   * Evaluates the smoothness indicator of the shock capturing, which is otherwise done as part of
+   * the evaluation of the convective and viscous terms.
+   */
+  void
+  update_shock_capturing_indicator(VectorType const & src) const;
+
   void
   apply_inverse_mass(VectorType & dst, VectorType const & src) const;
 
@@ -145,6 +176,12 @@ public:
   unsigned int
   get_quad_index_standard() const;
 
+  double
+  get_heat_capacity_ratio() const;
+
+  double
+  get_specific_gas_constant() const;
+
   // pressure
   void
   compute_pressure(VectorType & dst, VectorType const & src) const;
@@ -258,6 +295,9 @@ private:
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
 
+  // memory of the MatrixFree object created in setup(), see MemoryReport
+  MemoryReport::Entry memory_matrix_free{MemoryCategory::MatrixFree};
+
   /*
    * Basic operators.
    */
@@ -271,6 +311,8 @@ private:
    */
   CombinedOperator<dim, Number> combined_operator;
 
+  ArtificialViscosityOperator<dim, Number> artificial_viscosity_operator;
+
   InverseMassOperator<dim, dim + 2, Number> inverse_mass_all;
   InverseMassOperator<dim, dim, Number>     inverse_mass_vector;
   InverseMassOperator<dim, 1, Number>       inverse_mass_scalar;
@@ -293,6 +335,9 @@ private:
 
   // wall time for operator evaluation
   mutable double wall_time_operator_evaluation;
+
+  // right-hand side of evaluate_and_update() before applying the inverse mass operator
+  mutable VectorType rhs;
 };
 
 } // namespace CompNS
@@ -41,7 +41,7 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.end_time,
                               param_in.max_number_of_time_steps,
                               param_in.restart_data,
-                              false, // currently no adaptive time stepping implemented
+                              param_in.adaptive_time_stepping,
                               mpi_comm_in,
                               is_test_in),
     pde_operator(operator_in),
@@ -50,7 +50,9 @@ TimeIntExplRK<Number>::TimeIntExplRK(
     postprocessor(postprocessor_in),
     l2_norm(0.0),
     cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
-    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time))
+    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time)),
+    time_step_proposed(std::numeric_limits<double>::max()),
+    n_rejected_time_steps(0)
 {
 }
 
@@ -64,15 +66,16 @@ TimeIntExplRK<Number>::initialize_time_integrator()
     rk_time_integrator = std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
       param.order_time_integrator, pde_operator);
   }
+  // the vector updates of the 2-register schemes are fused with the inverse mass operator
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(pde_operator);
+    rk_time_integrator = std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(
+      pde_operator, LowStorageRK3Stage4Reg2C<Operator, VectorType>::get_coefficients());
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(pde_operator);
+    rk_time_integrator = std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(
+      pde_operator, LowStorageRK4Stage5Reg2C<Operator, VectorType>::get_coefficients());
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
   {
@@ -98,6 +101,14 @@ TimeIntExplRK<Number>::initialize_time_integrator()
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+  else if(this->param.temporal_discretization == TemporalDiscretization::RosenbrockW2Stage2)
+  {
+    rk_time_integrator = std::make_shared<RosenbrockW2<Operator, VectorType>>(
+      pde_operator, param.solver_data_rosenbrock);
+  }
+
+  if(this->adaptive_time_stepping)
+    rk_time_integrator->enable_error_estimate();
 }
 
 /*
@@ -109,6 +120,9 @@ TimeIntExplRK<Number>::initialize_vectors()
 {
   pde_operator->initialize_dof_vector(this->solution_n);
   pde_operator->initialize_dof_vector(this->solution_np);
+
+  if(this->adaptive_time_stepping)
+    pde_operator->initialize_dof_vector(solution_backup);
 }
 
 /*
@@ -197,9 +211,11 @@ template<typename Number>
 double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
 {
-  AssertThrow(false, dealii::ExcMessage("Currently no adaptive time stepping implemented."));
+  // the time step size is proposed by the step size controller in do_timestep_solve()
+  double const new_time_step_size = std::min(time_step_proposed, param.time_step_size_max);
 
-  return 1.0;
+  // do not step beyond the end time
+  return std::min(new_time_step_size, this->end_time - this->time);
 }
 
 template<typename Number>
@@ -241,15 +257,63 @@ TimeIntExplRK<Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(this->adaptive_time_stepping)
+  {
+    // the low-storage Runge-Kutta schemes overwrite the solution at the old time, which therefore
+    // has to be restored when a time step is rejected
+    solution_backup = this->solution_n;
+
+    while(true)
+    {
+      rk_time_integrator->solve_timestep(this->solution_np,
+                                         this->solution_n,
+                                         this->time,
+                                         this->time_step);
+
+      double const error_norm =
+        this->calculate_error_norm(rk_time_integrator->get_error_estimate(),
+                                   solution_backup,
+                                   this->solution_np,
+                                   param.adaptive_time_stepping_abs_tol,
+                                   param.adaptive_time_stepping_rel_tol);
+
+      bool const accepted =
+        this->control_time_step_size(error_norm,
+                                     rk_time_integrator->get_order_embedded_scheme(),
+                                     param.adaptive_time_stepping_limiting_factor,
+                                     time_step_proposed);
+
+      if(accepted)
+        break;
+
+      // repeat the time step with reduced time step size
+      this->time_step = time_step_proposed;
+      this->solution_n = solution_backup;
+      ++n_rejected_time_steps;
+    }
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info() and not(this->is_test))
   {
     this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
     print_wall_time(this->pcout, timer.wall_time());
+
+    if(this->adaptive_time_stepping)
+      this->pcout << "  Rejected time steps (accumulated): " << n_rejected_time_steps << std::endl;
+
+    if(auto const rosenbrock =
+         std::dynamic_pointer_cast<RosenbrockW2<Operator, VectorType>>(rk_time_integrator))
+    {
+      this->pcout << "  GMRES iterations (accumulated): " << rosenbrock->get_n_iterations()
+                  << std::endl;
+    }
   }
 
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
@@ -264,6 +328,13 @@ TimeIntExplRK<Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<typename Number>
+bool
+TimeIntExplRK<Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
 // instantiations
 template class TimeIntExplRK<float>;
 template class TimeIntExplRK<double>;
@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/rosenbrock.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -86,6 +87,9 @@ private:
   bool
   print_solver_info() const final;
 
+  bool
+  print_memory_consumption() const final;
+
   void
   calculate_time_step_size() final;
 
@@ -123,6 +127,11 @@ private:
   // time step calculation
   double const cfl_number;
   double const diffusion_number;
+
+  // adaptive time stepping
+  VectorType   solution_backup;
+  double       time_step_proposed;
+  unsigned int n_rejected_time_steps;
 };
 
 } // namespace CompNS
@@ -86,7 +86,8 @@ enum class TemporalDiscretization
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
   ExplRK5Stage9Reg2S,
-  SSPRK // specify order and stages of time integration scheme
+  SSPRK,             // specify order and stages of time integration scheme
+  RosenbrockW2Stage2 // linearly implicit, Jacobian-free, e.g. for low Mach numbers
 };
 
 /*
@@ -109,14 +110,29 @@ enum class TimeStepCalculation
 
 /*
  *  QuadratureRule
+ *
+ *  EntropyStableSplitForm: Gauss-Lobatto quadrature with degree + 1 points combined with an
+ *  entropy-stable flux differencing formulation, only available for the convective term
  */
 enum class QuadratureRule
 {
   Standard,
   Overintegration32k,
-  Overintegration2k
+  Overintegration2k,
+  EntropyStableSplitForm
 };
 
+/*
+ *  Shock capturing:
+ *
+ *    ArtificialViscosity: cellwise artificial viscosity for all conserved variables in cells that
+ *    are detected as troubled by a modal smoothness indicator of the density
+ */
+enum class ShockCapturing
+{
+  None,
+  ArtificialViscosity
+};
 
 /**************************************************************************************/
 /*                                                                                    */
@@ -58,6 +58,12 @@ Parameters::Parameters()
     diffusion_number(-1.),
     exponent_fe_degree_cfl(2.0),
     exponent_fe_degree_viscous(4.0),
+    adaptive_time_stepping(false),
+    adaptive_time_stepping_abs_tol(1.e-6),
+    adaptive_time_stepping_rel_tol(1.e-4),
+    adaptive_time_stepping_limiting_factor(5.0),
+    time_step_size_max(std::numeric_limits<double>::max()),
+    solver_data_rosenbrock(SolverData(1000, 1.e-12, 1.e-6, 30)),
     // restart
     restarted_simulation(false),
     restart_data(RestartData()),
@@ -75,6 +81,11 @@ Parameters::Parameters()
     // viscous term
     IP_factor(1.0),
 
+    // shock capturing
+    shock_capturing(ShockCapturing::None),
+    shock_capturing_viscosity_factor(1.0),
+    shock_capturing_kappa(1.0),
+
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
     use_combined_operator(false)
@@ -114,6 +125,13 @@ Parameters::check() const
     AssertThrow(stages >= 1, dealii::ExcMessage("Specify number of RK stages!"));
   }
 
+  if(temporal_discretization == TemporalDiscretization::RosenbrockW2Stage2)
+  {
+    AssertThrow(solver_data_rosenbrock.max_iter > 0 and solver_data_rosenbrock.rel_tol > 0.0 and
+                  solver_data_rosenbrock.max_krylov_size > 0,
+                dealii::ExcMessage("Invalid solver data of the Rosenbrock method."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, dealii::ExcMessage("Invalid parameter max_velocity."));
@@ -121,12 +139,46 @@ Parameters::check() const
     AssertThrow(diffusion_number > 0.0, dealii::ExcMessage("parameter must be defined"));
   }
 
+  if(adaptive_time_stepping)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C or
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C or
+                  temporal_discretization == TemporalDiscretization::RosenbrockW2Stage2,
+                dealii::ExcMessage("Adaptive time stepping requires a time integration scheme "
+                                   "with embedded error estimate."));
+    AssertThrow(adaptive_time_stepping_abs_tol > 0.0 and adaptive_time_stepping_rel_tol >= 0.0,
+                dealii::ExcMessage("Invalid tolerances for adaptive time stepping."));
+    AssertThrow(adaptive_time_stepping_limiting_factor > 1.0,
+                dealii::ExcMessage("Invalid parameter adaptive_time_stepping_limiting_factor."));
+  }
+
 
   // SPATIAL DISCRETIZATION
   grid.check();
 
   AssertThrow(degree > 0, dealii::ExcMessage("Polynomial degree must be larger than zero."));
 
+  if(n_q_points_convective == QuadratureRule::EntropyStableSplitForm)
+  {
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("The entropy-stable split form requires hypercube elements."));
+  }
+
+  AssertThrow(n_q_points_viscous != QuadratureRule::EntropyStableSplitForm,
+              dealii::ExcMessage("The entropy-stable split form is only available for the "
+                                 "convective term."));
+
+  if(shock_capturing == ShockCapturing::ArtificialViscosity)
+  {
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("Shock capturing requires hypercube elements."));
+    AssertThrow(max_velocity >= 0.0 and max_temperature > 0.0,
+                dealii::ExcMessage("Shock capturing requires max_velocity and max_temperature to "
+                                   "estimate the maximum wave speed."));
+    AssertThrow(shock_capturing_viscosity_factor > 0.0 and shock_capturing_kappa > 0.0,
+                dealii::ExcMessage("Invalid parameters of shock capturing."));
+  }
+
   if(use_combined_operator)
   {
     AssertThrow(
@@ -206,8 +258,25 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Number of stages", stages);
   }
 
+  if(temporal_discretization == TemporalDiscretization::RosenbrockW2Stage2)
+  {
+    solver_data_rosenbrock.print(pcout);
+  }
+
   print_parameter(pcout, "Calculation of time step size", calculation_of_time_step_size);
 
+  print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
+
+  if(adaptive_time_stepping)
+  {
+    print_parameter(pcout, "Absolute tolerance", adaptive_time_stepping_abs_tol);
+    print_parameter(pcout, "Relative tolerance", adaptive_time_stepping_rel_tol);
+    print_parameter(pcout,
+                    "Adaptive time stepping limiting factor",
+                    adaptive_time_stepping_limiting_factor);
+    print_parameter(pcout, "Maximum allowable time step size", time_step_size_max);
+  }
+
   // maximum number of time steps
   print_parameter(pcout, "Maximum number of time steps", max_number_of_time_steps);
 
@@ -240,6 +309,13 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
   print_parameter(pcout, "Quadrature rule viscous term", n_q_points_viscous);
 
   print_parameter(pcout, "IP factor viscous term", IP_factor);
+
+  print_parameter(pcout, "Shock capturing", shock_capturing);
+  if(shock_capturing == ShockCapturing::ArtificialViscosity)
+  {
+    print_parameter(pcout, "Artificial viscosity factor", shock_capturing_viscosity_factor);
+    print_parameter(pcout, "Smoothness indicator kappa", shock_capturing_kappa);
+  }
 }
 
 void
@@ -24,6 +24,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/grid/grid_data.h>
 #include <exadg/operators/inverse_mass_parameters.h>
+#include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 #include <exadg/utilities/print_functions.h>
@@ -152,6 +153,24 @@ public:
   // exponent of fe_degree used in the calculation of the diffusion time step size
   double exponent_fe_degree_viscous;
 
+  // use adaptive time stepping based on the error estimate of an embedded Runge-Kutta scheme.
+  // The time step size according to calculation_of_time_step_size is used for the first time
+  // step.
+  bool adaptive_time_stepping;
+
+  // absolute and relative tolerance of the local error for adaptive time stepping
+  double adaptive_time_stepping_abs_tol;
+  double adaptive_time_stepping_rel_tol;
+
+  // maximum factor by which the time step size may change from one time step to the next
+  double adaptive_time_stepping_limiting_factor;
+
+  // maximum allowable time step size
+  double time_step_size_max;
+
+  // solver data for the Jacobian-free linear systems of the linearly implicit Rosenbrock method
+  SolverData solver_data_rosenbrock;
+
   // set this variable to true to start the simulation from restart files
   bool restarted_simulation;
 
@@ -182,6 +201,18 @@ public:
   // interior penalty parameter scaling factor: default value is 1.0
   double IP_factor;
 
+  // shock capturing, see enum declaration. The interior penalty parameter of the artificial
+  // viscosity is scaled by IP_factor as well.
+  ShockCapturing shock_capturing;
+
+  // the artificial viscosity of troubled cells is viscosity_factor * lambda_max * h / degree, where
+  // the maximum wave speed lambda_max is computed from max_velocity and max_temperature
+  double shock_capturing_viscosity_factor;
+
+  // width of the transition from smooth to troubled cells of the smoothness indicator in log10
+  // scale
+  double shock_capturing_kappa;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                NUMERICAL PARAMETERS                                */
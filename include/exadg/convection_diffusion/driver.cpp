@@ -28,6 +28,7 @@
 #include <exadg/convection_diffusion/driver.h>
 #include <exadg/convection_diffusion/time_integration/create_time_integrator.h>
 #include <exadg/operators/throughput_parameters.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -135,6 +136,9 @@ Driver<dim, Number>::setup()
   }
 
   timer_tree.insert({"Convection-diffusion", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -156,14 +160,32 @@ void
 Driver<dim, Number>::mark_cells_coarsening_and_refinement(dealii::Triangulation<dim> & tria,
                                                           VectorType const & solution) const
 {
-  mark_cells_kelly_error_estimator(tria,
-                                   pde_operator->get_dof_handler(),
-                                   pde_operator->get_constraints(),
-                                   *pde_operator->get_mapping(),
-                                   solution,
-                                   application->get_parameters().degree +
-                                     1 /* n_face_quadrature_points */,
-                                   application->get_parameters().amr_data);
+  AdaptiveMeshRefinementData const & amr_data = application->get_parameters().amr_data;
+
+  if(amr_data.refinement_indicator == RefinementIndicator::KellyErrorEstimator)
+  {
+    mark_cells_kelly_error_estimator(tria,
+                                     pde_operator->get_dof_handler(),
+                                     pde_operator->get_constraints(),
+                                     *pde_operator->get_mapping(),
+                                     solution,
+                                     application->get_parameters().degree +
+                                       1 /* n_face_quadrature_points */,
+                                     amr_data);
+  }
+  else if(amr_data.refinement_indicator == RefinementIndicator::GradientJump)
+  {
+    mark_cells_gradient_jump_indicator(tria,
+                                       pde_operator->get_matrix_free(),
+                                       pde_operator->get_dof_index(),
+                                       pde_operator->get_quad_index(),
+                                       solution,
+                                       amr_data);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
 }
 
 template<int dim, typename Number>
@@ -191,6 +213,11 @@ template<int dim, typename Number>
 void
 Driver<dim, Number>::do_adaptive_refinement()
 {
+  std::shared_ptr<TimerTree> const timings = time_integrator->get_timings();
+
+  dealii::Timer timer;
+  timer.restart();
+
   limit_coarsening_and_refinement(*grid->triangulation, application->get_parameters().amr_data);
 
   if(any_cells_flagged_for_coarsening_or_refinement(*grid->triangulation))
@@ -206,8 +233,21 @@ Driver<dim, Number>::do_adaptive_refinement()
       AssertThrow(false, dealii::ExcNotImplemented());
     }
 
+    timings->insert({"Timeloop", "Adaptive mesh refinement", "Prepare solution transfer"},
+                    timer.wall_time());
+    timer.restart();
+
+    // In case of a dealii::parallel::distributed::Triangulation, the cells are repartitioned
+    // according to the cell weights (see GridData) as part of the refinement.
     grid->triangulation->execute_coarsening_and_refinement();
 
+    timings->insert({"Timeloop", "Adaptive mesh refinement", "Refinement and repartitioning"},
+                    timer.wall_time());
+
+    print_load_imbalance(pcout, *grid);
+
+    timer.restart();
+
     if(application->get_parameters().involves_h_multigrid())
     {
       GridUtilities::create_coarse_triangulations_after_coarsening_and_refinement(
@@ -217,10 +257,17 @@ Driver<dim, Number>::do_adaptive_refinement()
         grid->coarse_periodic_face_pairs,
         application->get_parameters().grid,
         application->get_parameters().amr_data.preserve_boundary_cells);
+
+      timings->insert({"Timeloop", "Adaptive mesh refinement", "Coarse triangulations"},
+                      timer.wall_time());
+      timer.restart();
     }
 
     setup_after_coarsening_and_refinement();
 
+    timings->insert({"Timeloop", "Adaptive mesh refinement", "Setup"}, timer.wall_time());
+    timer.restart();
+
     if(application->get_parameters().problem_type == ProblemType::Unsteady)
     {
       time_integrator->interpolate_after_coarsening_and_refinement();
@@ -229,6 +276,9 @@ Driver<dim, Number>::do_adaptive_refinement()
     {
       AssertThrow(false, dealii::ExcNotImplemented());
     }
+
+    timings->insert({"Timeloop", "Adaptive mesh refinement", "Interpolate solution"},
+                    timer.wall_time());
   }
 }
 
@@ -260,10 +310,19 @@ Driver<dim, Number>::solve()
                       dealii::ExcMessage("Adaptive mesh refinement only implemented"
                                          " for implicit time integration."));
 
+          dealii::Timer timer;
+          timer.restart();
+
           mark_cells_coarsening_and_refinement(*grid->triangulation,
                                                bdf_time_integrator->get_solution_np());
 
+          time_integrator->get_timings()->insert(
+            {"Timeloop", "Adaptive mesh refinement", "Mark cells"}, timer.wall_time());
+
           do_adaptive_refinement();
+
+          time_integrator->get_timings()->insert({"Timeloop", "Adaptive mesh refinement"},
+                                                 timer.wall_time());
         }
 
         time_integrator->advance_one_timestep_post_solve();
@@ -300,6 +359,67 @@ Driver<dim, Number>::solve()
   }
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_parareal(Parareal<Number> const & parareal,
+                                    double const             coarse_time_step_factor)
+{
+  Parameters const & param = application->get_parameters();
+
+  AssertThrow(param.problem_type == ProblemType::Unsteady and
+                param.temporal_discretization == TemporalDiscretization::ExplRK,
+              dealii::ExcMessage("Parareal is only implemented for explicit Runge-Kutta time "
+                                 "integration of unsteady problems."));
+  AssertThrow(not param.enable_adaptivity and not param.ale_formulation and
+                not param.adaptive_time_stepping,
+              dealii::ExcMessage("Parareal requires a fixed mesh and a constant time step size."));
+  AssertThrow(not(param.convective_problem() and
+                  param.get_type_velocity_field() == TypeVelocityField::DoFVector),
+              dealii::ExcMessage("Parareal does not support velocity fields given as DoF vector."));
+
+  std::shared_ptr<TimeIntExplRK<Number>> rk_time_integrator =
+    std::dynamic_pointer_cast<TimeIntExplRK<Number>>(time_integrator);
+
+  double const time_step_fine   = rk_time_integrator->get_time_step_size();
+  double const time_step_coarse = coarse_time_step_factor * time_step_fine;
+
+  typename Parareal<Number>::Propagator fine_propagator =
+    [&](VectorType & solution, double const start_time, double const end_time) {
+      rk_time_integrator->propagate(solution, start_time, end_time, time_step_fine);
+    };
+
+  typename Parareal<Number>::Propagator coarse_propagator =
+    [&](VectorType & solution, double const start_time, double const end_time) {
+      rk_time_integrator->propagate(solution, start_time, end_time, time_step_coarse);
+    };
+
+  VectorType solution;
+  pde_operator->initialize_dof_vector(solution);
+  pde_operator->prescribe_initial_conditions(solution, param.start_time);
+
+  dealii::Timer timer;
+  timer.restart();
+
+  unsigned int const n_iterations = parareal.solve(
+    solution, fine_propagator, coarse_propagator, param.start_time, param.end_time);
+
+  time_integrator->get_timings()->insert({"Timeloop", "Parareal"}, timer.wall_time());
+
+  pcout << std::endl << "Parareal iterations: " << n_iterations << std::endl;
+
+  if(parareal.is_last_time_slice())
+    postprocessor->do_postprocessing(solution,
+                                     param.end_time,
+                                     time_integrator->get_number_of_time_steps());
+}
+
+template<int dim, typename Number>
+dealii::types::global_dof_index
+Driver<dim, Number>::get_number_of_dofs() const
+{
+  return pde_operator->get_number_of_dofs();
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::print_performance_results(double const total_time) const
@@ -311,7 +431,7 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
 
   this->pcout << "Performance results for convection-diffusion solver:" << std::endl;
 
-  // Averaged number of iterations are only relevant for BDF time integrator
+  // Averaged number of iterations are only relevant for BDF and IMEX Runge-Kutta time integrators
   if(application->get_parameters().problem_type == ProblemType::Unsteady and
      application->get_parameters().temporal_discretization == TemporalDiscretization::BDF)
   {
@@ -321,6 +441,26 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
       std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
     time_integrator_bdf->print_iterations();
   }
+  else if(application->get_parameters().problem_type == ProblemType::Unsteady and
+          application->get_parameters().temporal_discretization ==
+            TemporalDiscretization::IMEXRK)
+  {
+    this->pcout << std::endl << "Average number of iterations:" << std::endl;
+
+    std::shared_ptr<TimeIntIMEXRK<dim, Number>> time_integrator_imex_rk =
+      std::dynamic_pointer_cast<TimeIntIMEXRK<dim, Number>>(time_integrator);
+    time_integrator_imex_rk->print_iterations();
+  }
+  else if(application->get_parameters().problem_type == ProblemType::Unsteady and
+          application->get_parameters().temporal_discretization ==
+            TemporalDiscretization::IMEXSDC)
+  {
+    this->pcout << std::endl << "Average number of iterations:" << std::endl;
+
+    std::shared_ptr<TimeIntIMEXSDC<dim, Number>> time_integrator_imex_sdc =
+      std::dynamic_pointer_cast<TimeIntIMEXSDC<dim, Number>>(time_integrator);
+    time_integrator_imex_sdc->print_iterations();
+  }
 
   // wall times
   timer_tree.insert({"Convection-diffusion"}, total_time);
@@ -339,6 +479,13 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
         std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
       timer_tree.insert({"Convection-diffusion"}, time_integrator_bdf->get_timings());
     }
+    else if(application->get_parameters().temporal_discretization ==
+              TemporalDiscretization::IMEXRK or
+            application->get_parameters().temporal_discretization ==
+              TemporalDiscretization::IMEXSDC)
+    {
+      timer_tree.insert({"Convection-diffusion"}, time_integrator->get_timings());
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
@@ -355,6 +502,18 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
+  // include the timings of the individual phases of adaptive mesh refinement
+  if(application->get_parameters().enable_adaptivity and timer_tree.get_max_level() > 2)
+  {
+    pcout << std::endl << "Timings for all levels:" << std::endl;
+    timer_tree.print_level(pcout, timer_tree.get_max_level());
+  }
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int N_mpi_processes               = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -46,6 +46,7 @@
 #include <exadg/grid/mapping_deformation_function.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/adaptive_mesh_refinement.h>
+#include <exadg/time_integration/parareal.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 
@@ -78,9 +79,22 @@ public:
   void
   solve();
 
+  /*
+   * Parallel-in-time solution of unsteady problems with explicit Runge-Kutta time integration,
+   * where the fine propagator uses the time step size of the time integrator and the coarse
+   * propagator a larger time step size by the factor coarse_time_step_factor. The driver has to be
+   * created on the space communicator of parareal. Postprocessing is only done for the solution at
+   * the end time, i.e., on the last time slice.
+   */
+  void
+  solve_parareal(Parareal<Number> const & parareal, double const coarse_time_step_factor);
+
   void
   print_performance_results(double const total_time) const;
 
+  dealii::types::global_dof_index
+  get_number_of_dofs() const;
+
   /*
    * Throughput study
    */
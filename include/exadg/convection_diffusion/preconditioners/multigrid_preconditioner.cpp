@@ -110,7 +110,7 @@ void
 MultigridPreconditioner<dim, Number>::update()
 {
   // Update matrix-free objects and operators
-  if(mesh_is_moving)
+  if(mesh_is_moving and this->geometry_has_changed())
   {
     this->initialize_mapping();
 
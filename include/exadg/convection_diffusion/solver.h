@@ -31,9 +31,13 @@
 
 // utilities
 #include <exadg/operators/resolution_parameters.h>
+#include <exadg/time_integration/parareal.h>
 #include <exadg/time_integration/resolution_parameters.h>
 #include <exadg/utilities/enum_patterns.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
+#include <exadg/utilities/work_precision_report.h>
 
 // application
 #include <exadg/convection_diffusion/user_interface/declare_get_application.h>
@@ -54,6 +58,9 @@ create_input_file(std::string const & input_file)
   TemporalResolutionParameters temporal;
   temporal.add_parameters(prm);
 
+  PararealParameters parareal;
+  parareal.add_parameters(prm);
+
   // we have to assume a default dimension and default Number type
   // for the automatic generation of a default input file
   unsigned int const Dim = 2;
@@ -67,30 +74,53 @@ create_input_file(std::string const & input_file)
 
 template<int dim, typename Number>
 void
-run(std::string const & input_file,
-    unsigned int const  degree,
-    unsigned int const  refine_space,
-    unsigned int const  refine_time,
-    MPI_Comm const &    mpi_comm,
-    bool const          is_test)
+run(std::string const &        input_file,
+    unsigned int const         degree,
+    unsigned int const         refine_space,
+    unsigned int const         refine_time,
+    PararealParameters const & parareal_parameters,
+    MPI_Comm const &           mpi_comm,
+    bool const                 is_test)
 {
   dealii::Timer timer;
   timer.restart();
 
+  // in case of parallelization in time, the spatial problem is created for each time slice
+  std::shared_ptr<Parareal<Number>> parareal;
+  if(parareal_parameters.n_time_slices > 1)
+  {
+    parareal = std::make_shared<Parareal<Number>>(mpi_comm, parareal_parameters);
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+    parareal_parameters.print(pcout);
+  }
+
+  MPI_Comm const & mpi_comm_space = parareal ? parareal->get_space_communicator() : mpi_comm;
+
   std::shared_ptr<ConvDiff::ApplicationBase<dim, Number>> application =
-    ConvDiff::get_application<dim, Number>(input_file, mpi_comm);
+    ConvDiff::get_application<dim, Number>(input_file, mpi_comm_space);
 
   application->set_parameters_convergence_study(degree, refine_space, refine_time);
 
   std::shared_ptr<ConvDiff::Driver<dim, Number>> driver =
-    std::make_shared<ConvDiff::Driver<dim, Number>>(mpi_comm, application, is_test, false);
+    std::make_shared<ConvDiff::Driver<dim, Number>>(mpi_comm_space, application, is_test, false);
 
   driver->setup();
 
-  driver->solve();
+  if(parareal)
+    driver->solve_parareal(*parareal, parareal_parameters.coarse_time_step_factor);
+  else
+    driver->solve();
 
   if(not(is_test))
     driver->print_performance_results(timer.wall_time());
+
+  WorkPrecisionReport::get().finish_run(degree,
+                                        refine_space,
+                                        refine_time,
+                                        driver->get_number_of_dofs(),
+                                        dealii::Utilities::MPI::max(timer.wall_time(), mpi_comm));
 }
 
 } // namespace ExaDG
@@ -100,6 +130,8 @@ main(int argc, char ** argv)
 {
   dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
 
+  ExaDG::ProfilingSession profiling;
+
   MPI_Comm mpi_comm(MPI_COMM_WORLD);
 
   std::string input_file;
@@ -132,6 +164,7 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters                 general(input_file);
   ExaDG::SpatialResolutionParametersMinMax spatial(input_file);
   ExaDG::TemporalResolutionParameters      temporal(input_file);
+  ExaDG::PararealParameters                parareal(input_file);
 
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
@@ -150,22 +183,22 @@ main(int argc, char ** argv)
         if(general.dim == 2 and general.precision == "float")
         {
           ExaDG::run<2, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         }
         else if(general.dim == 2 and general.precision == "double")
         {
           ExaDG::run<2, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         }
         else if(general.dim == 3 and general.precision == "float")
         {
           ExaDG::run<3, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         }
         else if(general.dim == 3 and general.precision == "double")
         {
           ExaDG::run<3, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         }
         else
         {
@@ -176,6 +209,12 @@ main(int argc, char ** argv)
     }
   }
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
+  if(not general.work_precision_report.empty())
+    ExaDG::WorkPrecisionReport::get().write_csv(general.work_precision_report, mpi_comm);
+
   return 0;
 }
 
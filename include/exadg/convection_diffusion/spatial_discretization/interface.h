@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_CONVECTION_DIFFUSION_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_CONVECTION_DIFFUSION_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// C/C++
+#include <memory>
+#include <vector>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -70,6 +74,10 @@ public:
         double const       evaluation_time = -1.0,
         VectorType const * velocity        = nullptr) = 0;
 
+  // pseudo-transient continuation: apply mass operator
+  virtual void
+  apply_mass_operator(VectorType & dst, VectorType const & src) const = 0;
+
   // time integration: initialize dof vector
   virtual void
   initialize_dof_vector(VectorType & src) const = 0;
@@ -92,12 +100,15 @@ public:
   virtual double
   calculate_time_step_cfl_global(double const time) const = 0;
 
-  // time step calculation: local CFL condition
+  // time step calculation: local CFL condition. If reduce_over_processes is false, the minimum
+  // over the locally owned cells of the current process is returned.
   virtual double
-  calculate_time_step_cfl_analytical_velocity(double const time) const = 0;
+  calculate_time_step_cfl_analytical_velocity(double const time,
+                                              bool const   reduce_over_processes = true) const = 0;
 
   virtual double
-  calculate_time_step_cfl_numerical_velocity(VectorType const & velocity) const = 0;
+  calculate_time_step_cfl_numerical_velocity(VectorType const & velocity,
+                                             bool const reduce_over_processes = true) const = 0;
 
   // needed for time step calculation
   virtual double
@@ -105,6 +116,61 @@ public:
 };
 } // namespace Interface
 
+/*
+ * Transport velocity interpolated in time from the velocities of previous time instants. The
+ * interpolated velocity is only recomputed if the evaluation time changes, so that several scalar
+ * transport solvers that are advanced with the same velocity field can share one object and
+ * perform the interpolation once per Runge-Kutta stage instead of once per scalar.
+ */
+template<typename Number>
+class InterpolatedVelocity
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  InterpolatedVelocity() : is_up_to_date(false), interpolation_time(0.0)
+  {
+  }
+
+  void
+  reinit(VectorType const & vector)
+  {
+    velocity.reinit(vector);
+    is_up_to_date = false;
+  }
+
+  void
+  set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
+                           std::vector<double> const &             times_in)
+  {
+    velocities    = velocities_in;
+    times         = times_in;
+    is_up_to_date = false;
+  }
+
+  VectorType const &
+  get(double const evaluation_time)
+  {
+    if(not is_up_to_date or evaluation_time != interpolation_time)
+    {
+      interpolate(velocity, evaluation_time, velocities, times);
+
+      interpolation_time = evaluation_time;
+      is_up_to_date      = true;
+    }
+
+    return velocity;
+  }
+
+private:
+  std::vector<VectorType const *> velocities;
+  std::vector<double>             times;
+
+  VectorType velocity;
+  bool       is_up_to_date;
+  double     interpolation_time;
+};
+
 template<typename Number>
 class OperatorExplRK
 {
@@ -113,18 +179,42 @@ public:
 
   OperatorExplRK(std::shared_ptr<ConvDiff::Interface::Operator<Number>> operator_in,
                  bool const                                             numerical_velocity_field_in)
-    : pde_operator(operator_in), numerical_velocity_field(numerical_velocity_field_in)
+    : pde_operator(operator_in),
+      numerical_velocity_field(numerical_velocity_field_in),
+      velocity_is_shared(false)
   {
     if(numerical_velocity_field)
-      initialize_dof_vector_velocity(velocity_interpolated);
+    {
+      velocity_interpolated = std::make_shared<InterpolatedVelocity<Number>>();
+
+      VectorType velocity;
+      initialize_dof_vector_velocity(velocity);
+      velocity_interpolated->reinit(velocity);
+    }
+  }
+
+  /*
+   * Use an interpolated velocity shared with other operators. The owner of the shared object is
+   * responsible for setting the velocities and times, i.e., set_velocities_and_times() of this
+   * class has no effect afterwards.
+   */
+  void
+  set_interpolated_velocity(std::shared_ptr<InterpolatedVelocity<Number>> velocity_in)
+  {
+    AssertThrow(numerical_velocity_field,
+                dealii::ExcMessage("A shared interpolated velocity can only be used for a "
+                                   "numerical velocity field."));
+
+    velocity_interpolated = velocity_in;
+    velocity_is_shared    = true;
   }
 
   void
   set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
                            std::vector<double> const &             times_in)
   {
-    velocities = velocities_in;
-    times      = times_in;
+    if(not velocity_is_shared)
+      velocity_interpolated->set_velocities_and_times(velocities_in, times_in);
   }
 
   void
@@ -132,9 +222,10 @@ public:
   {
     if(numerical_velocity_field)
     {
-      interpolate(velocity_interpolated, evaluation_time, velocities, times);
-
-      pde_operator->evaluate_explicit_time_int(dst, src, evaluation_time, &velocity_interpolated);
+      pde_operator->evaluate_explicit_time_int(dst,
+                                               src,
+                                               evaluation_time,
+                                               &velocity_interpolated->get(evaluation_time));
     }
     else
     {
@@ -157,10 +248,10 @@ public:
 private:
   std::shared_ptr<ConvDiff::Interface::Operator<Number>> pde_operator;
 
-  bool                            numerical_velocity_field;
-  std::vector<VectorType const *> velocities;
-  std::vector<double>             times;
-  VectorType mutable velocity_interpolated;
+  bool numerical_velocity_field;
+
+  std::shared_ptr<InterpolatedVelocity<Number>> velocity_interpolated;
+  bool                                          velocity_is_shared;
 };
 
 } // namespace ConvDiff
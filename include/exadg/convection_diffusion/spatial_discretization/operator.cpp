@@ -26,7 +26,6 @@
 // ExaDG
 #include <exadg/convection_diffusion/preconditioners/multigrid_preconditioner.h>
 #include <exadg/convection_diffusion/spatial_discretization/operator.h>
-#include <exadg/convection_diffusion/spatial_discretization/project_velocity.h>
 #include <exadg/grid/mapping_dof_vector.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
@@ -104,7 +103,7 @@ void
 Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const
 {
   // append mapping flags
-  if(param.problem_type == ProblemType::Unsteady)
+  if(param.problem_type == ProblemType::Unsteady or param.use_pseudo_transient_continuation)
   {
     matrix_free_data.append_mapping_flags(MassKernel<dim, Number>::get_mapping_flags());
   }
@@ -155,6 +154,30 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::setup_coupling_boundary_conditions()
+{
+  if(not(boundary_descriptor->dirichlet_cached_bc.empty()))
+  {
+    interface_data_dirichlet_cached = std::make_shared<ContainerInterfaceData<0, dim, double>>();
+
+    // boundary values are needed by the diffusive and the convective term, where the latter uses
+    // the quadrature rule with over-integration if requested
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index());
+    if(param.use_overintegration)
+      quad_indices.emplace_back(get_quad_index_overintegration());
+
+    interface_data_dirichlet_cached->setup(*matrix_free,
+                                           get_dof_index(),
+                                           quad_indices,
+                                           boundary_descriptor->dirichlet_cached_bc);
+
+    boundary_descriptor->set_dirichlet_cached_data(interface_data_dirichlet_cached);
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup_operators()
@@ -177,6 +200,20 @@ Operator<dim, Number>::setup_operators()
 
   inverse_mass_operator.initialize(*matrix_free, inverse_mass_operator_data);
 
+  // L2-projection of analytical velocity field
+  if(param.analytical_velocity_field and
+     param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    InverseMassOperatorData inverse_mass_operator_data_l2_projection;
+    inverse_mass_operator_data_l2_projection.dof_index  = get_dof_index_velocity();
+    inverse_mass_operator_data_l2_projection.quad_index = get_quad_index();
+
+    velocity_projection.initialize(*matrix_free,
+                                   inverse_mass_operator_data_l2_projection,
+                                   field_functions->velocity,
+                                   param.velocity_projection_time_interval);
+  }
+
   // convective operator
   unsigned int const quad_index_convective =
     param.use_overintegration ? get_quad_index_overintegration() : get_quad_index();
@@ -188,6 +225,8 @@ Operator<dim, Number>::setup_operators()
     convective_kernel_data.formulation                = param.formulation_convective_term;
     convective_kernel_data.velocity_type              = param.get_type_velocity_field();
     convective_kernel_data.dof_index_velocity         = get_dof_index_velocity();
+    convective_kernel_data.store_velocity_at_quadrature_points =
+      param.store_velocity_at_quadrature_points;
     convective_kernel_data.numerical_flux_formulation = param.numerical_flux_convective_operator;
     convective_kernel_data.velocity                   = field_functions->velocity;
 
@@ -247,6 +286,8 @@ Operator<dim, Number>::setup_operators()
 
   // merged operator
   if(param.temporal_discretization == TemporalDiscretization::BDF or
+     param.temporal_discretization == TemporalDiscretization::IMEXRK or
+     param.temporal_discretization == TemporalDiscretization::IMEXSDC or
      (param.temporal_discretization == TemporalDiscretization::ExplRK and
       param.use_combined_operator == true))
   {
@@ -261,11 +302,14 @@ Operator<dim, Number>::setup_operators()
 
     // linear system of equations has to be solved: the problem is either steady or
     // an unsteady problem is solved with BDF time integration (semi-implicit or fully implicit
-    // formulation of convective and diffusive terms)
+    // formulation of convective and diffusive terms) or IMEX Runge-Kutta or spectral deferred
+    // correction time integration (explicit convective term)
     if(param.problem_type == ProblemType::Steady or
-       param.temporal_discretization == TemporalDiscretization::BDF)
+       param.temporal_discretization == TemporalDiscretization::BDF or
+       param.temporal_discretization == TemporalDiscretization::IMEXRK or
+       param.temporal_discretization == TemporalDiscretization::IMEXSDC)
     {
-      if(param.problem_type == ProblemType::Unsteady)
+      if(param.problem_type == ProblemType::Unsteady or param.use_pseudo_transient_continuation)
         combined_operator_data.unsteady_problem = true;
 
       if(param.convective_problem() and
@@ -342,6 +386,8 @@ Operator<dim, Number>::do_setup()
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
+  memory_matrix_free.set(mf->memory_consumption());
+
   if(param.ale_formulation)
     matrix_free_own_storage = mf;
 
@@ -361,6 +407,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number> con
 
   dof_index_velocity_external = dof_index_velocity_external_in;
 
+  setup_coupling_boundary_conditions();
+
   setup_operators();
 
   if(param.linear_system_has_to_be_solved())
@@ -570,17 +618,7 @@ template<int dim, typename Number>
 void
 Operator<dim, Number>::project_velocity(VectorType & velocity, double const time) const
 {
-  VelocityProjection<dim, Number> l2_projection;
-
-  InverseMassOperatorData inverse_mass_operator_data_l2_projection;
-  inverse_mass_operator_data_l2_projection.dof_index  = get_dof_index_velocity();
-  inverse_mass_operator_data_l2_projection.quad_index = get_quad_index();
-
-  l2_projection.apply(*matrix_free,
-                      inverse_mass_operator_data_l2_projection,
-                      field_functions->velocity,
-                      time,
-                      velocity);
+  velocity_projection.apply(velocity, time);
 }
 
 template<int dim, typename Number>
@@ -809,6 +847,12 @@ Operator<dim, Number>::update_after_grid_motion(bool const update_matrix_free)
   // The inverse mass operator might contain matrix-based components, in which cases it needs to be
   // updated after the grid has been deformed.
   inverse_mass_operator.update();
+
+  if(param.analytical_velocity_field and
+     param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    velocity_projection.update();
+  }
 }
 
 template<int dim, typename Number>
@@ -898,7 +942,9 @@ Operator<dim, Number>::calculate_time_step_diffusion() const
 
 template<int dim, typename Number>
 double
-Operator<dim, Number>::calculate_time_step_cfl_numerical_velocity(VectorType const & velocity) const
+Operator<dim, Number>::calculate_time_step_cfl_numerical_velocity(
+  VectorType const & velocity,
+  bool const         reduce_over_processes) const
 {
   return calculate_time_step_cfl_local<dim, Number>(*matrix_free,
                                                     get_dof_index_velocity(),
@@ -907,12 +953,15 @@ Operator<dim, Number>::calculate_time_step_cfl_numerical_velocity(VectorType con
                                                     param.degree,
                                                     param.exponent_fe_degree_convection,
                                                     param.adaptive_time_stepping_cfl_type,
-                                                    mpi_comm);
+                                                    reduce_over_processes ? mpi_comm :
+                                                                            MPI_COMM_SELF);
 }
 
 template<int dim, typename Number>
 double
-Operator<dim, Number>::calculate_time_step_cfl_analytical_velocity(double const time) const
+Operator<dim, Number>::calculate_time_step_cfl_analytical_velocity(
+  double const time,
+  bool const   reduce_over_processes) const
 {
   return calculate_time_step_cfl_local<dim, Number>(*matrix_free,
                                                     get_dof_index(),
@@ -922,7 +971,8 @@ Operator<dim, Number>::calculate_time_step_cfl_analytical_velocity(double const
                                                     param.degree,
                                                     param.exponent_fe_degree_convection,
                                                     param.adaptive_time_stepping_cfl_type,
-                                                    mpi_comm);
+                                                    reduce_over_processes ? mpi_comm :
+                                                                            MPI_COMM_SELF);
 }
 
 template<int dim, typename Number>
@@ -1059,6 +1109,13 @@ Operator<dim, Number>::get_constraints() const
   return affine_constraints;
 }
 
+template<int dim, typename Number>
+std::shared_ptr<ContainerInterfaceData<0, dim, double>>
+Operator<dim, Number>::get_container_interface_data() const
+{
+  return interface_data_dirichlet_cached;
+}
+
 template class Operator<2, float>;
 template class Operator<2, double>;
 
@@ -29,6 +29,7 @@
 // ExaDG
 #include <exadg/convection_diffusion/spatial_discretization/interface.h>
 #include <exadg/convection_diffusion/spatial_discretization/operators/combined_operator.h>
+#include <exadg/convection_diffusion/spatial_discretization/project_velocity.h>
 #include <exadg/convection_diffusion/user_interface/boundary_descriptor.h>
 #include <exadg/convection_diffusion/user_interface/field_functions.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
@@ -39,6 +40,7 @@
 #include <exadg/operators/rhs_operator.h>
 #include <exadg/operators/solution_transfer.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -165,7 +167,7 @@ public:
    * dst-vector.
    */
   void
-  apply_mass_operator(VectorType & dst, VectorType const & src) const;
+  apply_mass_operator(VectorType & dst, VectorType const & src) const final;
 
   /*
    * This function applies the mass operator to the src-vector and adds the result to the
@@ -248,11 +250,13 @@ public:
 
   // local CFL criterion: use numerical velocity field
   double
-  calculate_time_step_cfl_numerical_velocity(VectorType const & velocity) const final;
+  calculate_time_step_cfl_numerical_velocity(VectorType const & velocity,
+                                             bool const reduce_over_processes = true) const final;
 
   // local CFL criterion: use analytical velocity field
   double
-  calculate_time_step_cfl_analytical_velocity(double const time) const final;
+  calculate_time_step_cfl_analytical_velocity(double const time,
+                                              bool const reduce_over_processes = true) const final;
 
   /*
    * Calculate time step size according to diffusion term
@@ -291,6 +295,10 @@ public:
   dealii::AffineConstraints<Number> const &
   get_constraints() const;
 
+  // interface coupling
+  std::shared_ptr<ContainerInterfaceData<0, dim, double>>
+  get_container_interface_data() const;
+
 private:
   void
   do_setup();
@@ -301,6 +309,12 @@ private:
   void
   initialize_dof_handler_and_constraints();
 
+  /**
+   * Sets up the data structures for DirichletCached boundary conditions.
+   */
+  void
+  setup_coupling_boundary_conditions();
+
   /**
    * Performs setup of operators.
    */
@@ -413,11 +427,19 @@ private:
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
 
+  /*
+   * Interface coupling
+   */
+  std::shared_ptr<ContainerInterfaceData<0, dim, double>> interface_data_dirichlet_cached;
+
   // If we want to be able to update the mapping, we need a pointer to a non-const MatrixFree
   // object. In case this object is created, we let the above object called matrix_free point to
   // matrix_free_own_storage. This variable is needed for ALE formulations.
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free_own_storage;
 
+  // memory of the MatrixFree object created in setup(), see MemoryReport
+  MemoryReport::Entry memory_matrix_free{MemoryCategory::MatrixFree};
+
   /*
    * Basic operators.
    */
@@ -430,6 +452,11 @@ private:
   DiffusiveOperator<dim, Number>      diffusive_operator;
   RHSOperator<dim, Number>            rhs_operator;
 
+  /*
+   * L2-projection of analytical velocity field (in case the velocity is stored in a DoF vector).
+   */
+  VelocityProjection<dim, Number> velocity_projection;
+
   /*
    * Combined operator.
    */
@@ -207,6 +207,28 @@ CombinedOperator<dim, Number>::reinit_face_cell_based_derived(
                                              operator_data.dof_index);
 }
 
+template<int dim, typename Number>
+FastDiagonalizationCoefficients
+CombinedOperator<dim, Number>::get_fast_diagonalization_coefficients() const
+{
+  FastDiagonalizationCoefficients coefficients;
+
+  if(operator_data.unsteady_problem)
+    coefficients.mass_factor = scaling_factor_mass;
+
+  if(operator_data.diffusive_problem)
+  {
+    coefficients.laplace_factor = operator_data.diffusive_kernel_data.diffusivity;
+    coefficients.IP_factor      = operator_data.diffusive_kernel_data.IP_factor;
+  }
+
+  AssertThrow(coefficients.mass_factor > 0.0 or coefficients.laplace_factor > 0.0,
+              dealii::ExcMessage("The fast diagonalization preconditioner requires a mass or "
+                                 "diffusive term."));
+
+  return coefficients;
+}
+
 template<int dim, typename Number>
 void
 CombinedOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) const
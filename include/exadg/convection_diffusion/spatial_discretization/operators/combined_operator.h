@@ -150,6 +150,10 @@ private:
   do_face_int_integral_cell_based(IntegratorFace & integrator_m,
                                   IntegratorFace & integrator_p) const final;
 
+  // The convective term is neglected in the separable approximation of the cell blocks.
+  FastDiagonalizationCoefficients
+  get_fast_diagonalization_coefficients() const final;
+
   CombinedOperatorData<dim> operator_data;
 
   std::shared_ptr<MassKernel<dim, Number>>                  mass_kernel;
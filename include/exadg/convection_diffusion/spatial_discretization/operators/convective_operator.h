@@ -22,6 +22,8 @@
 #ifndef CONV_DIFF_CONVECTION_OPERATOR
 #define CONV_DIFF_CONVECTION_OPERATOR
 
+#include <deal.II/base/aligned_vector.h>
+
 #include <exadg/convection_diffusion/user_interface/boundary_descriptor.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
@@ -43,6 +45,7 @@ struct ConvectiveKernelData
     : formulation(FormulationConvectiveTerm::DivergenceFormulation),
       velocity_type(TypeVelocityField::Function),
       dof_index_velocity(1),
+      store_velocity_at_quadrature_points(false),
       numerical_flux_formulation(NumericalFluxConvectiveOperator::Undefined)
   {
   }
@@ -56,6 +59,10 @@ struct ConvectiveKernelData
   // TypeVelocityField::DoFVector
   unsigned int dof_index_velocity;
 
+  // TypeVelocityField::DoFVector: interpolate the velocity into the quadrature points once
+  // whenever the velocity is set instead of in every operator evaluation
+  bool store_velocity_at_quadrature_points;
+
   // TypeVelocityField::Function
   std::shared_ptr<dealii::Function<dim>> velocity;
 
@@ -87,6 +94,8 @@ public:
   {
     data = data_in;
 
+    matrix_free_velocity = &matrix_free;
+
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
       integrator_velocity =
@@ -166,6 +175,9 @@ public:
     velocity.own() = velocity_in;
 
     velocity->update_ghost_values();
+
+    if(data.store_velocity_at_quadrature_points)
+      update_velocity_at_quadrature_points();
   }
 
   void
@@ -177,6 +189,9 @@ public:
     velocity.reset(velocity_in);
 
     velocity->update_ghost_values();
+
+    if(data.store_velocity_at_quadrature_points)
+      update_velocity_at_quadrature_points();
   }
 
   void
@@ -184,8 +199,15 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity->reinit(cell);
-      integrator_velocity->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      if(data.store_velocity_at_quadrature_points)
+      {
+        velocity_cell = &velocity_cells[cell * integrator_velocity->n_q_points];
+      }
+      else
+      {
+        integrator_velocity->reinit(cell);
+        integrator_velocity->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      }
     }
   }
 
@@ -194,11 +216,19 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity_m->reinit(face);
-      integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      if(data.store_velocity_at_quadrature_points)
+      {
+        velocity_face_m = &velocity_faces_m[face * integrator_velocity_m->n_q_points];
+        velocity_face_p = &velocity_faces_p[face * integrator_velocity_m->n_q_points];
+      }
+      else
+      {
+        integrator_velocity_m->reinit(face);
+        integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
-      integrator_velocity_p->reinit(face);
-      integrator_velocity_p->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+        integrator_velocity_p->reinit(face);
+        integrator_velocity_p->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      }
     }
   }
 
@@ -207,8 +237,15 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity_m->reinit(face);
-      integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      if(data.store_velocity_at_quadrature_points)
+      {
+        velocity_face_m = &velocity_faces_m[face * integrator_velocity_m->n_q_points];
+      }
+      else
+      {
+        integrator_velocity_m->reinit(face);
+        integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      }
     }
   }
 
@@ -219,6 +256,9 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
+      // the stored values are indexed by faces, not by the faces of a cell
+      velocity_face_m = nullptr;
+
       integrator_velocity_m->reinit(cell, face);
       integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
@@ -329,9 +369,8 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      vector velocity_m = integrator_velocity_m->get_value(q);
-      vector velocity_p =
-        exterior_velocity_available ? integrator_velocity_p->get_value(q) : velocity_m;
+      vector velocity_m = get_velocity_m(q);
+      vector velocity_p = exterior_velocity_available ? get_velocity_p(q) : velocity_m;
 
       scalar normal_velocity_m = velocity_m * normal_m;
       scalar normal_velocity_p = velocity_p * normal_m;
@@ -393,9 +432,8 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      vector velocity_m = integrator_velocity_m->get_value(q);
-      vector velocity_p =
-        exterior_velocity_available ? integrator_velocity_p->get_value(q) : velocity_m;
+      vector velocity_m = get_velocity_m(q);
+      vector velocity_p = exterior_velocity_available ? get_velocity_p(q) : velocity_m;
 
       velocity = 0.5 * (velocity_m + velocity_p);
     }
@@ -485,7 +523,7 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      velocity = integrator_velocity->get_value(q);
+      velocity = get_velocity_cell(q);
     }
     else
     {
@@ -512,7 +550,7 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      velocity = integrator_velocity->get_value(q);
+      velocity = get_velocity_cell(q);
     }
     else
     {
@@ -523,13 +561,101 @@ public:
   }
 
 private:
+  /*
+   * Interpolates the velocity into the quadrature points of all cells and faces once, such that
+   * repeated evaluations of the operator for the same velocity, e.g. within iterative solvers, only
+   * need to load these values.
+   */
+  void
+  update_velocity_at_quadrature_points() const
+  {
+    dealii::MatrixFree<dim, Number> const & matrix_free = *matrix_free_velocity;
+
+    unsigned int const n_cells =
+      matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
+    unsigned int const n_q_points_cell = integrator_velocity->n_q_points;
+
+    velocity_cells.resize(n_cells * n_q_points_cell);
+    for(unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      integrator_velocity->reinit(cell);
+      integrator_velocity->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      for(unsigned int q = 0; q < n_q_points_cell; ++q)
+        velocity_cells[cell * n_q_points_cell + q] = integrator_velocity->get_value(q);
+    }
+
+    // inner faces, boundary faces, and ghost inner faces
+    unsigned int const n_inner_faces    = matrix_free.n_inner_face_batches();
+    unsigned int const n_boundary_faces = matrix_free.n_boundary_face_batches();
+    unsigned int const n_faces =
+      n_inner_faces + n_boundary_faces + matrix_free.n_ghost_inner_face_batches();
+    unsigned int const n_q_points_face = integrator_velocity_m->n_q_points;
+
+    velocity_faces_m.resize(n_faces * n_q_points_face);
+    velocity_faces_p.resize(n_faces * n_q_points_face);
+    for(unsigned int face = 0; face < n_faces; ++face)
+    {
+      integrator_velocity_m->reinit(face);
+      integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      for(unsigned int q = 0; q < n_q_points_face; ++q)
+        velocity_faces_m[face * n_q_points_face + q] = integrator_velocity_m->get_value(q);
+
+      bool const is_boundary_face =
+        face >= n_inner_faces and face < n_inner_faces + n_boundary_faces;
+      if(not is_boundary_face)
+      {
+        integrator_velocity_p->reinit(face);
+        integrator_velocity_p->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+        for(unsigned int q = 0; q < n_q_points_face; ++q)
+          velocity_faces_p[face * n_q_points_face + q] = integrator_velocity_p->get_value(q);
+      }
+    }
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    get_velocity_cell(unsigned int const q) const
+  {
+    return data.store_velocity_at_quadrature_points ? velocity_cell[q] :
+                                                      integrator_velocity->get_value(q);
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    get_velocity_m(unsigned int const q) const
+  {
+    return data.store_velocity_at_quadrature_points and velocity_face_m != nullptr ?
+             velocity_face_m[q] :
+             integrator_velocity_m->get_value(q);
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    get_velocity_p(unsigned int const q) const
+  {
+    return data.store_velocity_at_quadrature_points ? velocity_face_p[q] :
+                                                      integrator_velocity_p->get_value(q);
+  }
+
   ConvectiveKernelData<dim> data;
 
+  dealii::MatrixFree<dim, Number> const * matrix_free_velocity = nullptr;
+
   mutable lazy_ptr<VectorType> velocity;
 
   std::shared_ptr<CellIntegratorVelocity> integrator_velocity;
   std::shared_ptr<FaceIntegratorVelocity> integrator_velocity_m;
   std::shared_ptr<FaceIntegratorVelocity> integrator_velocity_p;
+
+  // velocity stored in the quadrature points of all cells and faces
+  mutable dealii::AlignedVector<vector> velocity_cells;
+  mutable dealii::AlignedVector<vector> velocity_faces_m;
+  mutable dealii::AlignedVector<vector> velocity_faces_p;
+
+  // stored velocity of the current cell and face
+  mutable vector const * velocity_cell   = nullptr;
+  mutable vector const * velocity_face_m = nullptr;
+  mutable vector const * velocity_face_p = nullptr;
 };
 
 } // namespace Operators
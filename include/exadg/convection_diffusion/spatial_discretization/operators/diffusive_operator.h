@@ -57,7 +57,8 @@ private:
   typedef FaceIntegrator<dim, 1, Number> IntegratorFace;
 
 public:
-  DiffusiveKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  DiffusiveKernel()
+    : degree(1), penalty_factor(1.0), tau(dealii::make_vectorized_array<Number>(0.0))
   {
   }
 
@@ -82,6 +83,16 @@ public:
                               unsigned int const                      dof_index)
   {
     IP::calculate_penalty_parameter<dim, Number>(array_penalty_parameter, matrix_free, dof_index);
+
+    penalty_factor = IP::get_penalty_factor<dim, Number>(
+      degree,
+      get_element_type(matrix_free.get_dof_handler(dof_index).get_triangulation()),
+      data.IP_factor);
+
+    IP::calculate_face_penalty_parameter<dim, Number>(array_face_penalty_parameter,
+                                                      array_penalty_parameter,
+                                                      matrix_free,
+                                                      penalty_factor);
   }
 
   IntegratorFlags
@@ -120,24 +131,18 @@ public:
               IntegratorFace &   integrator_p,
               unsigned int const dof_index) const
   {
-    tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
-                   integrator_p.read_cell_data(array_penalty_parameter)) *
-          IP::get_penalty_factor<dim, Number>(
-            degree,
-            get_element_type(
-              integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-            data.IP_factor);
+    (void)integrator_p;
+    (void)dof_index;
+
+    tau = array_face_penalty_parameter[integrator_m.get_current_cell_index()];
   }
 
   void
   reinit_boundary_face(IntegratorFace & integrator_m, unsigned int const dof_index) const
   {
-    tau = integrator_m.read_cell_data(array_penalty_parameter) *
-          IP::get_penalty_factor<dim, Number>(
-            degree,
-            get_element_type(
-              integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-            data.IP_factor);
+    (void)dof_index;
+
+    tau = array_face_penalty_parameter[integrator_m.get_current_cell_index()];
   }
 
   void
@@ -146,24 +151,17 @@ public:
                          IntegratorFace &                 integrator_p,
                          unsigned int const               dof_index) const
   {
+    (void)dof_index;
+
     if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
     {
       tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
                      integrator_p.read_cell_data(array_penalty_parameter)) *
-            IP::get_penalty_factor<dim, Number>(
-              degree,
-              get_element_type(
-                integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-              data.IP_factor);
+            penalty_factor;
     }
     else // boundary face
     {
-      tau = integrator_m.read_cell_data(array_penalty_parameter) *
-            IP::get_penalty_factor<dim, Number>(
-              degree,
-              get_element_type(
-                integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-              data.IP_factor);
+      tau = integrator_m.read_cell_data(array_penalty_parameter) * penalty_factor;
     }
   }
 
@@ -208,6 +206,11 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
+  // penalty parameter of each face batch including the penalty factor
+  dealii::AlignedVector<scalar> array_face_penalty_parameter;
+
+  Number penalty_factor;
+
   mutable scalar tau;
 };
 
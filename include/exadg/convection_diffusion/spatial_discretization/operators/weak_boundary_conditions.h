@@ -85,16 +85,27 @@ inline DEAL_II_ALWAYS_INLINE //
 {
   dealii::VectorizedArray<Number> value_p = dealii::make_vectorized_array<Number>(0.0);
 
-  if(boundary_type == BoundaryType::Dirichlet)
+  if(boundary_type == BoundaryType::Dirichlet or boundary_type == BoundaryType::DirichletCached)
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
       dealii::VectorizedArray<Number> g;
 
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
-
-      g = FunctionEvaluator<0, dim, Number>::value(*bc, q_points, time);
+      if(boundary_type == BoundaryType::Dirichlet)
+      {
+        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+        auto q_points = integrator.quadrature_point(q);
+
+        g = FunctionEvaluator<0, dim, Number>::value(*bc, q_points, time);
+      }
+      else
+      {
+        auto bc = boundary_descriptor->get_dirichlet_cached_data();
+        g       = FunctionEvaluator<0, dim, Number>::value(*bc,
+                                                     integrator.get_current_cell_index(),
+                                                     q,
+                                                     integrator.get_quadrature_index());
+      }
 
       value_p = -value_m + 2.0 * g;
     }
@@ -186,7 +197,7 @@ inline DEAL_II_ALWAYS_INLINE //
 {
   dealii::VectorizedArray<Number> normal_gradient_p = dealii::make_vectorized_array<Number>(0.0);
 
-  if(boundary_type == BoundaryType::Dirichlet)
+  if(boundary_type == BoundaryType::Dirichlet or boundary_type == BoundaryType::DirichletCached)
   {
     normal_gradient_p = normal_gradient_m;
   }
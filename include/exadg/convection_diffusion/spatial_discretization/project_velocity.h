@@ -22,12 +22,24 @@
 #ifndef INCLUDE_EXADG_CONVECTION_DIFFUSION_SPATIAL_DISCRETIZATION_PROJECT_VELOCITY_H_
 #define INCLUDE_EXADG_CONVECTION_DIFFUSION_SPATIAL_DISCRETIZATION_PROJECT_VELOCITY_H_
 
+// C/C++
+#include <cmath>
+#include <limits>
+
+// ExaDG
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/inverse_mass_operator.h>
 
 namespace ExaDG
 {
+/*
+ * L2-projection of an analytical velocity field. The inverse mass operator is set up once, and the
+ * last projection is cached, so that repeated calls for the same time, e.g. in several stages of a
+ * time integrator, only copy the cached vector. If a time interval is specified, the velocity is
+ * only projected at the multiples of this interval and interpolated linearly in time in between,
+ * which reduces the number of projections for time-dependent velocity fields to one per interval.
+ */
 template<int dim, typename Number>
 class VelocityProjection
 {
@@ -39,32 +51,110 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
+  VelocityProjection() : matrix_free(nullptr), dof_index(0), quad_index(0), time_interval(0.0)
+  {
+  }
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const &      matrix_free_in,
+             InverseMassOperatorData const                inverse_mass_operator_data,
+             std::shared_ptr<dealii::Function<dim>> const function_in,
+             double const                                 time_interval_in)
+  {
+    matrix_free   = &matrix_free_in;
+    dof_index     = inverse_mass_operator_data.dof_index;
+    quad_index    = inverse_mass_operator_data.quad_index;
+    function      = function_in;
+    time_interval = time_interval_in;
+
+    inverse_mass.initialize(*matrix_free, inverse_mass_operator_data);
+
+    for(unsigned int i = 0; i < 2; ++i)
+      matrix_free->initialize_dof_vector(snapshots[i], dof_index);
+
+    invalidate();
+  }
+
+  /*
+   * The cached projections become invalid if the mesh is deformed.
+   */
+  void
+  update()
+  {
+    inverse_mass.update();
+
+    invalidate();
+  }
+
+  void
+  apply(VectorType & vector, double const time) const
+  {
+    if(time_interval > 0.0)
+    {
+      // project at t_k = k * time_interval and t_{k+1} with t_k <= time < t_{k+1}
+      long long const k = static_cast<long long>(std::floor(time / time_interval));
+
+      if(snapshot_index[1] == k)
+      {
+        snapshots[0].swap(snapshots[1]);
+        std::swap(snapshot_index[0], snapshot_index[1]);
+      }
+
+      if(snapshot_index[0] != k)
+        project(snapshots[0], snapshot_index[0], k);
+
+      if(snapshot_index[1] != k + 1)
+        project(snapshots[1], snapshot_index[1], k + 1);
+
+      double const factor = time / time_interval - static_cast<double>(k);
+      vector.equ(1.0 - factor, snapshots[0], factor, snapshots[1]);
+    }
+    else
+    {
+      if(not cached_projection_is_valid or time != cached_time)
+      {
+        project(snapshots[0], time);
+
+        cached_time                = time;
+        cached_projection_is_valid = true;
+      }
+
+      vector = snapshots[0];
+    }
+  }
+
+private:
+  void
+  invalidate()
+  {
+    snapshot_index[0]          = std::numeric_limits<long long>::min();
+    snapshot_index[1]          = std::numeric_limits<long long>::min();
+    cached_projection_is_valid = false;
+  }
+
+  void
+  project(VectorType & vector, long long & index, long long const new_index) const
+  {
+    project(vector, static_cast<double>(new_index) * time_interval);
+    index = new_index;
+  }
+
   /*
    * (v_h, u_h)_Omega^e = (v_h, f)_Omega^e -> M * U = RHS -> U = M^{-1} * RHS
    */
   void
-  apply(dealii::MatrixFree<dim, Number> const &      matrix_free,
-        InverseMassOperatorData const                inverse_mass_operator_data,
-        std::shared_ptr<dealii::Function<dim>> const function,
-        double const &                               time,
-        VectorType &                                 vector)
+  project(VectorType & vector, double const time) const
   {
-    this->dof_index  = inverse_mass_operator_data.dof_index;
-    this->quad_index = inverse_mass_operator_data.quad_index;
-    this->function   = function;
-    this->time       = time;
+    projection_time = time;
 
     // calculate RHS
     VectorType src;
-    matrix_free.cell_loop(&VelocityProjection<dim, Number>::cell_loop, this, vector, src);
+    matrix_free->cell_loop(&VelocityProjection<dim, Number>::cell_loop, this, vector, src, true);
 
     // apply M^{-1}
-    InverseMassOperator<dim, dim, Number> inverse_mass;
-    inverse_mass.initialize(matrix_free, inverse_mass_operator_data);
     inverse_mass.apply(vector, vector);
   }
 
-private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free,
             VectorType &                            dst,
@@ -81,9 +171,9 @@ private:
 
       for(unsigned int q = 0; q < integrator.n_q_points; ++q)
       {
-        integrator.submit_value(
-          FunctionEvaluator<1, dim, Number>::value(*function, integrator.quadrature_point(q), time),
-          q);
+        integrator.submit_value(FunctionEvaluator<1, dim, Number>::value(
+                                  *function, integrator.quadrature_point(q), projection_time),
+                                q);
       }
 
       integrator.integrate(dealii::EvaluationFlags::values);
@@ -92,10 +182,26 @@ private:
     }
   }
 
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
   unsigned int                           dof_index;
   unsigned int                           quad_index;
   std::shared_ptr<dealii::Function<dim>> function;
-  double                                 time;
+
+  // projections are only computed at multiples of this interval if it is larger than zero
+  double time_interval;
+
+  InverseMassOperator<dim, dim, Number> inverse_mass;
+
+  // the projections at the times t_k and t_{k+1} with indices k, k+1 bracketing the last
+  // requested time, or the projection at cached_time if the velocity is projected exactly
+  mutable VectorType snapshots[2];
+  mutable long long  snapshot_index[2];
+
+  mutable bool   cached_projection_is_valid = false;
+  mutable double cached_time                = 0.0;
+
+  mutable double projection_time = 0.0;
 };
 
 } // namespace ExaDG
@@ -24,6 +24,8 @@
 
 #include <exadg/convection_diffusion/time_integration/time_int_bdf.h>
 #include <exadg/convection_diffusion/time_integration/time_int_explicit_runge_kutta.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_runge_kutta.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_sdc.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
 
 namespace ExaDG
@@ -54,10 +56,22 @@ create_time_integrator(std::shared_ptr<Operator<dim, Number>>          pde_opera
     time_integrator = std::make_shared<TimeIntBDF<dim, Number>>(
       pde_operator, helpers_ale, postprocessor, parameters, mpi_comm, is_test);
   }
+  else if(parameters.temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    time_integrator = std::make_shared<TimeIntIMEXRK<dim, Number>>(
+      pde_operator, postprocessor, parameters, mpi_comm, is_test);
+  }
+  else if(parameters.temporal_discretization == TemporalDiscretization::IMEXSDC)
+  {
+    time_integrator = std::make_shared<TimeIntIMEXSDC<dim, Number>>(
+      pde_operator, postprocessor, parameters, mpi_comm, is_test);
+  }
   else
   {
     AssertThrow(parameters.temporal_discretization == TemporalDiscretization::ExplRK or
-                  parameters.temporal_discretization == TemporalDiscretization::BDF,
+                  parameters.temporal_discretization == TemporalDiscretization::BDF or
+                  parameters.temporal_discretization == TemporalDiscretization::IMEXRK or
+                  parameters.temporal_discretization == TemporalDiscretization::IMEXSDC,
                 dealii::ExcMessage("Specified time integration scheme is not implemented!"));
   }
 
@@ -19,6 +19,10 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <algorithm>
+
+// ExaDG
 #include <exadg/convection_diffusion/postprocessor/postprocessor_base.h>
 #include <exadg/convection_diffusion/spatial_discretization/interface.h>
 #include <exadg/convection_diffusion/time_integration/driver_steady_problems.h>
@@ -133,22 +137,101 @@ DriverSteadyProblems<Number>::do_solve()
   // calculate rhs vector
   pde_operator->rhs(rhs_vector, 0.0 /* time */, velocity_ptr);
 
-  // solve linear system of equations
-  unsigned int iterations = pde_operator->solve(solution,
-                                                rhs_vector,
-                                                param.update_preconditioner,
-                                                1.0 /* scaling_factor */,
-                                                0.0 /* time */,
-                                                velocity_ptr);
+  if(param.use_pseudo_transient_continuation)
+  {
+    std::pair<unsigned int, unsigned int> const iterations =
+      solve_pseudo_transient_continuation(velocity_ptr);
 
-  if(not(is_test))
-    print_solver_info_linear(pcout, iterations, timer.wall_time());
+    if(not(is_test))
+      print_solver_info_nonlinear(pcout, iterations.first, iterations.second, timer.wall_time());
+  }
+  else
+  {
+    // solve linear system of equations
+    unsigned int iterations = pde_operator->solve(solution,
+                                                  rhs_vector,
+                                                  param.update_preconditioner,
+                                                  1.0 /* scaling_factor */,
+                                                  0.0 /* time */,
+                                                  velocity_ptr);
+
+    if(not(is_test))
+      print_solver_info_linear(pcout, iterations, timer.wall_time());
+  }
 
   pcout << std::endl << "... done!" << std::endl;
 
   timer_tree->insert({"DriverSteady", "Solve"}, timer.wall_time());
 }
 
+template<typename Number>
+std::pair<unsigned int, unsigned int>
+DriverSteadyProblems<Number>::solve_pseudo_transient_continuation(VectorType const * velocity_ptr)
+{
+  // pseudo time step size for a CFL number of 1
+  double const time_step_cfl = pde_operator->calculate_time_step_cfl_global(0.0 /* time */);
+
+  VectorType solution_old, rhs_pseudo_time, residual;
+  pde_operator->initialize_dof_vector(solution_old);
+  pde_operator->initialize_dof_vector(rhs_pseudo_time);
+  pde_operator->initialize_dof_vector(residual);
+
+  double cfl               = param.pseudo_time_cfl_initial;
+  double residual_norm_old = 0.0;
+  double residual_norm_0   = 0.0;
+
+  unsigned int n_steps = 0, n_iterations_linear = 0;
+  bool         converged = false;
+
+  while(not converged and n_steps < param.pseudo_time_max_steps)
+  {
+    double const time_step = cfl * time_step_cfl;
+
+    // implicit Euler step in pseudo time: (M/dt + A) u_{k+1} = f + M/dt u_k
+    solution_old = solution;
+    pde_operator->apply_mass_operator(rhs_pseudo_time, solution_old);
+    rhs_pseudo_time.sadd(1.0 / time_step, 1.0, rhs_vector);
+
+    n_iterations_linear += pde_operator->solve(solution,
+                                               rhs_pseudo_time,
+                                               param.update_preconditioner,
+                                               1.0 / time_step /* scaling_factor */,
+                                               0.0 /* time */,
+                                               velocity_ptr);
+    ++n_steps;
+
+    // steady-state residual f - A u_{k+1} = M (u_{k+1} - u_k) / dt (up to the solver tolerance)
+    solution_old.sadd(-1.0, 1.0, solution);
+    pde_operator->apply_mass_operator(residual, solution_old);
+    double const residual_norm = residual.l2_norm() / time_step;
+
+    if(n_steps == 1)
+      residual_norm_0 = residual_norm;
+
+    if(not(is_test))
+    {
+      pcout << std::endl
+            << "  Pseudo time step " << n_steps << ": CFL = " << cfl
+            << ", steady-state residual = " << residual_norm << std::endl;
+    }
+
+    converged = residual_norm < param.pseudo_time_abs_tol or
+                residual_norm < param.pseudo_time_rel_tol * residual_norm_0;
+
+    // switched evolution relaxation
+    if(n_steps > 1 and residual_norm > 0.0)
+      cfl = std::min(cfl * residual_norm_old / residual_norm, param.pseudo_time_cfl_max);
+
+    residual_norm_old = residual_norm;
+  }
+
+  AssertThrow(converged,
+              dealii::ExcMessage("Pseudo-transient continuation did not converge within the "
+                                 "maximum number of pseudo time steps."));
+
+  return std::make_pair(n_steps, n_iterations_linear);
+}
+
 template<typename Number>
 void
 DriverSteadyProblems<Number>::postprocessing() const
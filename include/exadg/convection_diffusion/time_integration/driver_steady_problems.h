@@ -22,6 +22,9 @@
 #ifndef INCLUDE_CONVECTION_DIFFUSION_DRIVER_STEADY_PROBLEMS_H_
 #define INCLUDE_CONVECTION_DIFFUSION_DRIVER_STEADY_PROBLEMS_H_
 
+// C/C++
+#include <utility>
+
 // deal.II
 #include <deal.II/base/timer.h>
 #include <deal.II/lac/la_parallel_vector.h>
@@ -78,6 +81,14 @@ private:
   void
   do_solve();
 
+  /*
+   * Approaches the steady state by implicit Euler steps in pseudo time, where the CFL number is
+   * increased according to the reduction of the steady-state residual. Returns the number of
+   * pseudo time steps and the accumulated number of linear iterations.
+   */
+  std::pair<unsigned int, unsigned int>
+  solve_pseudo_transient_continuation(VectorType const * velocity_ptr);
+
   void
   postprocessing() const;
 
@@ -113,6 +113,7 @@ TimeIntBDF<dim, Number>::allocate_vectors()
   pde_operator->initialize_dof_vector(solution_np);
 
   pde_operator->initialize_dof_vector(rhs_vector);
+  pde_operator->initialize_dof_vector(sum_alphai_ui);
 
   if(param.convective_problem())
   {
@@ -137,6 +138,19 @@ TimeIntBDF<dim, Number>::allocate_vectors()
   }
 }
 
+template<int dim, typename Number>
+std::size_t
+TimeIntBDF<dim, Number>::memory_consumption_vectors() const
+{
+  return dealii::MemoryConsumption::memory_consumption(solution) +
+         solution_np.memory_consumption() + rhs_vector.memory_consumption() +
+         sum_alphai_ui.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(vec_convective_term) +
+         convective_term_np.memory_consumption() + grid_velocity.memory_consumption() +
+         grid_coordinates_np.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(vec_grid_coordinates);
+}
+
 template<int dim, typename Number>
 std::shared_ptr<std::vector<dealii::LinearAlgebra::distributed::Vector<Number> *>>
 TimeIntBDF<dim, Number>::get_vectors()
@@ -344,8 +358,8 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
   double new_time_step_size = std::numeric_limits<double>::max();
   if(param.analytical_velocity_field)
   {
-    new_time_step_size =
-      pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time());
+    new_time_step_size = pde_operator->calculate_time_step_cfl_analytical_velocity(
+      this->get_time(), not this->defer_time_step_reduction);
     new_time_step_size *= cfl;
   }
   else // numerical velocity field
@@ -357,7 +371,9 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
     if(param.ale_formulation == true)
       u_relative -= grid_velocity;
 
-    new_time_step_size = pde_operator->calculate_time_step_cfl_numerical_velocity(u_relative);
+    new_time_step_size =
+      pde_operator->calculate_time_step_cfl_numerical_velocity(u_relative,
+                                                               not this->defer_time_step_reduction);
     new_time_step_size *= cfl;
   }
 
@@ -425,6 +441,13 @@ TimeIntBDF<dim, Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<int dim, typename Number>
+bool
+TimeIntBDF<dim, Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
@@ -492,14 +515,17 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  // transport velocity
-  VectorType velocity_np;
+  // transport velocity, which is only copied if it has to be modified since the same velocity
+  // vector is shared by all scalar transport solvers of a coupled problem
+  VectorType         velocity_np;
+  VectorType const * transport_velocity = &velocity_np;
 
   if(param.convective_problem())
   {
     if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
     {
-      pde_operator->initialize_dof_vector_velocity(velocity_np);
+      if(param.analytical_velocity_field or param.ale_formulation)
+        pde_operator->initialize_dof_vector_velocity(velocity_np);
 
       if(param.analytical_velocity_field)
       {
@@ -512,7 +538,10 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
         AssertThrow(velocities[0] != nullptr,
                     dealii::ExcMessage("Pointer velocities[0] is not correctly initialized."));
 
-        velocity_np = *velocities[0];
+        if(param.ale_formulation)
+          velocity_np = *velocities[0];
+        else
+          transport_velocity = velocities[0];
       }
 
       if(param.ale_formulation)
@@ -527,7 +556,7 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
   }
 
   // calculate rhs (rhs-vector f and inhomogeneous boundary face integrals)
-  pde_operator->rhs(rhs_vector, this->get_next_time(), &velocity_np);
+  pde_operator->rhs(rhs_vector, this->get_next_time(), transport_velocity);
 
   // if the convective term is involved in the equations:
   // add the convective term to the right-hand side of the equations
@@ -544,31 +573,38 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
         pde_operator->evaluate_convective_term(vec_convective_term[i],
                                                solution[i],
                                                this->get_previous_time(i),
-                                               &velocity_np);
+                                               transport_velocity);
       }
     }
 
-    for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
-      rhs_vector.add(-this->extra.get_beta(i), vec_convective_term[i]);
+    compute_linear_combination(rhs_vector,
+                               this->get_extrapolation_factors(vec_convective_term.size(), -1.0),
+                               vec_convective_term,
+                               true);
   }
 
-  VectorType sum_alphai_ui(solution[0]);
-  sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), solution[0]);
-  for(unsigned int i = 1; i < solution.size(); ++i)
-    sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i]);
+  compute_linear_combination(sum_alphai_ui, this->get_bdf_factors(solution.size()), solution);
 
   // apply mass operator to sum_alphai_ui and add to rhs_vector
   pde_operator->apply_mass_operator_add(rhs_vector, sum_alphai_ui);
 
   // extrapolate old solution to obtain a good initial guess for the solver
-  solution_np.equ(this->extra.get_beta(0), solution[0]);
-  for(unsigned int i = 1; i < solution.size(); ++i)
-    solution_np.add(this->extra.get_beta(i), solution[i]);
+  compute_linear_combination(solution_np,
+                             this->get_extrapolation_factors(solution.size()),
+                             solution);
 
   // solve the linear system of equations
-  bool const update_preconditioner =
-    this->param.update_preconditioner and
-    (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
+  bool update_preconditioner = false;
+  if(this->param.update_preconditioner)
+  {
+    if(this->param.adaptive_preconditioner_update)
+      update_preconditioner = preconditioner_update_policy.update_needed();
+    else
+      update_preconditioner =
+        (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
+  }
+
+  dealii::Timer timer_solve;
 
   unsigned int const N_iter =
     pde_operator->solve(solution_np,
@@ -576,7 +612,15 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
                         update_preconditioner,
                         this->bdf.get_gamma0() / this->get_time_step_size(),
                         this->get_next_time(),
-                        &velocity_np);
+                        transport_velocity);
+
+  if(this->param.update_preconditioner and this->param.adaptive_preconditioner_update)
+  {
+    preconditioner_update_policy.report(N_iter,
+                                        timer_solve.wall_time(),
+                                        update_preconditioner,
+                                        this->mpi_comm);
+  }
 
   iterations.first += 1;
   iterations.second += N_iter;
@@ -593,7 +637,7 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
         pde_operator->evaluate_convective_term(convective_term_np,
                                                solution_np,
                                                this->get_next_time(),
-                                               &velocity_np);
+                                               transport_velocity);
       }
       else
       {
@@ -666,14 +710,17 @@ TimeIntBDF<dim, Number>::get_solution_np() const
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::extrapolate_solution(VectorType & vector)
+TimeIntBDF<dim, Number>::get_extrapolation(std::vector<VectorType const *> & vectors,
+                                           std::vector<double> &             factors)
 {
   // make sure that the time integrator constants are up-to-date
   this->update_time_integrator_constants();
 
-  vector.equ(this->extra.get_beta(0), this->solution[0]);
-  for(unsigned int i = 1; i < solution.size(); ++i)
-    vector.add(this->extra.get_beta(i), this->solution[i]);
+  factors = this->get_extrapolation_factors(solution.size());
+
+  vectors.resize(factors.size());
+  for(unsigned int i = 0; i < factors.size(); ++i)
+    vectors[i] = &solution[i];
 }
 
 // instantiations
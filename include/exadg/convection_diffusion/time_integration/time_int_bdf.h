@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/time_integration/lambda_functions_ale.h>
+#include <exadg/time_integration/preconditioner_update_policy.h>
 #include <exadg/time_integration/time_int_bdf_base.h>
 
 namespace ExaDG
@@ -62,8 +63,13 @@ public:
   set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
                            std::vector<double> const &             times_in);
 
+  /*
+   * Returns the vectors and factors of the extrapolation of the solution to the new time, such
+   * that the extrapolated solution is the linear combination of the vectors, which is not computed
+   * here.
+   */
   void
-  extrapolate_solution(VectorType & vector);
+  get_extrapolation(std::vector<VectorType const *> & vectors, std::vector<double> & factors);
 
   VectorType const &
   get_solution_np() const;
@@ -84,6 +90,9 @@ private:
   void
   allocate_vectors() final;
 
+  std::size_t
+  memory_consumption_vectors() const final;
+
   std::shared_ptr<std::vector<VectorType *>>
   get_vectors();
 
@@ -114,6 +123,9 @@ private:
   bool
   print_solver_info() const final;
 
+  bool
+  print_memory_consumption() const final;
+
   void
   read_restart_vectors(boost::archive::binary_iarchive & ia) final;
 
@@ -139,6 +151,9 @@ private:
 
   VectorType rhs_vector;
 
+  // sum_i (alpha_i/dt * u_i), allocated once to avoid reallocations in every time step
+  VectorType sum_alphai_ui;
+
   // numerical velocity field
   std::vector<VectorType const *> velocities;
   std::vector<double>             times;
@@ -146,6 +161,9 @@ private:
   // iteration counts
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations;
 
+  // automatic update of preconditioner, see adaptive_preconditioner_update
+  PreconditionerUpdatePolicy preconditioner_update_policy;
+
   // postprocessor
   std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
 
@@ -67,9 +67,22 @@ TimeIntExplRK<Number>::set_velocities_and_times(
 
 template<typename Number>
 void
-TimeIntExplRK<Number>::extrapolate_solution(VectorType & vector)
+TimeIntExplRK<Number>::set_interpolated_velocity(
+  std::shared_ptr<InterpolatedVelocity<Number>> velocity)
 {
-  vector.equ(1.0, this->solution_n);
+  AssertThrow(expl_rk_operator.get() != nullptr,
+              dealii::ExcMessage("Time integrator has not been set up."));
+
+  expl_rk_operator->set_interpolated_velocity(velocity);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::get_extrapolation(std::vector<VectorType const *> & vectors,
+                                         std::vector<double> &             factors)
+{
+  vectors = {&this->solution_n};
+  factors = {1.0};
 }
 
 template<typename Number>
@@ -221,8 +234,8 @@ TimeIntExplRK<Number>::recalculate_time_step_size() const
   double new_time_step_size = std::numeric_limits<double>::max();
   if(param.analytical_velocity_field)
   {
-    new_time_step_size =
-      pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time());
+    new_time_step_size = pde_operator->calculate_time_step_cfl_analytical_velocity(
+      this->get_time(), not this->defer_time_step_reduction);
     new_time_step_size *= cfl;
   }
   else
@@ -230,7 +243,9 @@ TimeIntExplRK<Number>::recalculate_time_step_size() const
     AssertThrow(velocities[0] != nullptr,
                 dealii::ExcMessage("Pointer velocities[0] is not initialized."));
 
-    new_time_step_size = pde_operator->calculate_time_step_cfl_numerical_velocity(*velocities[0]);
+    new_time_step_size =
+      pde_operator->calculate_time_step_cfl_numerical_velocity(*velocities[0],
+                                                               not this->defer_time_step_reduction);
     new_time_step_size *= cfl;
   }
 
@@ -339,6 +354,13 @@ TimeIntExplRK<Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<typename Number>
+bool
+TimeIntExplRK<Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
 template<typename Number>
 void
 TimeIntExplRK<Number>::do_timestep_solve()
@@ -49,6 +49,9 @@ class Operator;
 template<typename Number>
 class OperatorExplRK;
 
+template<typename Number>
+class InterpolatedVelocity;
+
 template<typename Number>
 class TimeIntExplRK : public TimeIntExplRKBase<Number>
 {
@@ -65,8 +68,19 @@ public:
   set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
                            std::vector<double> const &             times_in);
 
+  /*
+   * Share the velocity interpolated in time with other scalar transport solvers advanced with the
+   * same velocity field. Has to be called after setup().
+   */
+  void
+  set_interpolated_velocity(std::shared_ptr<InterpolatedVelocity<Number>> velocity);
+
+  /*
+   * Returns the solution at the old time as extrapolation of the solution to the new time, i.e.,
+   * one vector with factor 1.
+   */
   void
-  extrapolate_solution(VectorType & vector);
+  get_extrapolation(std::vector<VectorType const *> & vectors, std::vector<double> & factors);
 
 private:
   void
@@ -81,6 +95,9 @@ private:
   bool
   print_solver_info() const final;
 
+  bool
+  print_memory_consumption() const final;
+
   void
   do_timestep_solve() final;
 
@@ -0,0 +1,350 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <exadg/convection_diffusion/postprocessor/postprocessor_base.h>
+#include <exadg/convection_diffusion/spatial_discretization/operator.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_runge_kutta.h>
+#include <exadg/convection_diffusion/user_interface/parameters.h>
+#include <exadg/time_integration/time_step_calculation.h>
+#include <exadg/utilities/print_functions.h>
+#include <exadg/utilities/print_solver_results.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+template<int dim, typename Number>
+TimeIntIMEXRK<dim, Number>::TimeIntIMEXRK(
+  std::shared_ptr<Operator<dim, Number>>          operator_in,
+  std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in,
+  Parameters const &                              param_in,
+  MPI_Comm const &                                mpi_comm_in,
+  bool const                                      is_test_in)
+  : TimeIntExplRKBase<Number>(param_in.start_time,
+                              param_in.end_time,
+                              param_in.max_number_of_time_steps,
+                              param_in.restart_data,
+                              param_in.adaptive_time_stepping,
+                              mpi_comm_in,
+                              is_test_in),
+    pde_operator(operator_in),
+    param(param_in),
+    refine_steps_time(param_in.n_refine_time),
+    cfl(param.cfl / std::pow(2.0, refine_steps_time)),
+    iterations({0, 0}),
+    postprocessor(postprocessor_in)
+{
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::initialize_time_integrator()
+{
+  imex_rk = std::make_shared<IMEXRungeKuttaConstants>(param.order_time_integrator);
+
+  imex_rk->print(this->pcout);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::initialize_vectors()
+{
+  pde_operator->initialize_dof_vector(this->solution_n);
+  pde_operator->initialize_dof_vector(this->solution_np);
+  pde_operator->initialize_dof_vector(rhs_vector);
+  pde_operator->initialize_dof_vector(mass_solution_n);
+  pde_operator->initialize_dof_vector(sum_previous_stages);
+
+  unsigned int const n_stages = imex_rk->get_n_stages();
+
+  vec_implicit_term.resize(n_stages - 1);
+  for(auto & vector : vec_implicit_term)
+    pde_operator->initialize_dof_vector(vector);
+
+  if(param.convective_problem())
+  {
+    vec_convective_term.resize(n_stages - 1);
+    for(auto & vector : vec_convective_term)
+      pde_operator->initialize_dof_vector(vector);
+
+    if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+      pde_operator->initialize_dof_vector_velocity(velocity);
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::initialize_solution()
+{
+  pde_operator->prescribe_initial_conditions(this->solution_n, this->time);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::calculate_time_step_size()
+{
+  if(param.calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+  {
+    this->time_step = calculate_const_time_step(param.time_step_size, refine_steps_time);
+
+    this->pcout << std::endl
+                << "Calculation of time step size (user-specified):" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "time step size", this->time_step);
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::CFL)
+  {
+    double time_step_conv = pde_operator->calculate_time_step_cfl_global(this->get_time());
+    time_step_conv *= cfl;
+
+    this->pcout << std::endl
+                << "Calculation of time step size according to CFL condition:" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "CFL", cfl);
+    print_parameter(this->pcout, "Time step size (CFL global)", time_step_conv);
+
+    if(this->adaptive_time_stepping)
+    {
+      double time_step_adap =
+        pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time());
+      time_step_adap *= cfl;
+
+      // use adaptive time step size only if it is smaller, otherwise use global time step size
+      time_step_conv = std::min(time_step_conv, time_step_adap);
+
+      // make sure that the maximum allowable time step size is not exceeded
+      time_step_conv = std::min(time_step_conv, param.time_step_size_max);
+
+      print_parameter(this->pcout, "Time step size (CFL adaptive)", time_step_conv);
+    }
+    else
+    {
+      time_step_conv =
+        adjust_time_step_to_hit_end_time(this->start_time, this->end_time, time_step_conv);
+
+      this->pcout << std::endl
+                  << "Adjust time step size to hit end time:" << std::endl
+                  << std::endl;
+      print_parameter(this->pcout, "Time step size", time_step_conv);
+    }
+
+    this->time_step = time_step_conv;
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::MaxEfficiency)
+  {
+    this->time_step    = pde_operator->calculate_time_step_max_efficiency(imex_rk->get_order());
+    double const c_eff = param.c_eff / std::pow(2., refine_steps_time);
+    this->time_step *= c_eff;
+
+    this->time_step =
+      adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+
+    this->pcout << std::endl
+                << "Calculation of time step size (max efficiency):" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "C_eff", c_eff);
+    print_parameter(this->pcout, "Time step size", this->time_step);
+  }
+  else
+  {
+    AssertThrow(false,
+                dealii::ExcMessage("Specified type of time step calculation is not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+double
+TimeIntIMEXRK<dim, Number>::recalculate_time_step_size() const
+{
+  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL,
+              dealii::ExcMessage(
+                "Adaptive time step is not implemented for this type of time step calculation."));
+
+  double new_time_step_size =
+    pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time(),
+                                                              not this->defer_time_step_reduction);
+  new_time_step_size *= cfl;
+
+  // make sure that time step size does not exceed maximum allowable time step size
+  new_time_step_size = std::min(new_time_step_size, param.time_step_size_max);
+
+  limit_time_step_change(new_time_step_size,
+                         this->get_time_step_size(),
+                         param.adaptive_time_stepping_limiting_factor);
+
+  return new_time_step_size;
+}
+
+template<int dim, typename Number>
+bool
+TimeIntIMEXRK<dim, Number>::print_solver_info() const
+{
+  return param.solver_info_data.write(this->global_timer.wall_time(),
+                                      this->time,
+                                      this->time_step_number);
+}
+
+template<int dim, typename Number>
+bool
+TimeIntIMEXRK<dim, Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::evaluate_convective_term(VectorType &       dst,
+                                                     VectorType const & src,
+                                                     double const       time)
+{
+  if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    pde_operator->project_velocity(velocity, time);
+    pde_operator->evaluate_convective_term(dst, src, time, &velocity);
+  }
+  else
+  {
+    pde_operator->evaluate_convective_term(dst, src, time);
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::do_timestep_solve()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  double const       dt       = this->time_step;
+  unsigned int const n_stages = imex_rk->get_n_stages();
+
+  // The stages i = 1, ..., n_stages - 1 solve
+  //
+  //  (M / (a^I_ii dt) + A) U_i = b(t_i) + M u^n / (a^I_ii dt) + 1 / a^I_ii * sum_{j<i} (
+  //                              - a^E_ij C(U_j) + a^I_ij (- A U_j + b(t_j)) ),
+  //
+  // with the mass operator M, the diffusive operator A, the convective term C, and the
+  // inhomogeneous contributions b. The implicit terms -A U_j + b(t_j) are recovered from the
+  // stage equations so that the diffusive operator does not have to be evaluated explicitly.
+  pde_operator->apply_mass_operator(mass_solution_n, this->solution_n);
+
+  if(param.convective_problem())
+    evaluate_convective_term(vec_convective_term[0], this->solution_n, this->time);
+
+  bool const update_preconditioner =
+    param.update_preconditioner and
+    (this->time_step_number % param.update_preconditioner_every_time_steps == 0);
+
+  // use the solution of the last time step as initial guess for the first stage and the previous
+  // stage value as initial guess for the remaining stages
+  this->solution_np = this->solution_n;
+
+  unsigned int N_iter = 0;
+
+  for(unsigned int i = 1; i < n_stages; ++i)
+  {
+    double const stage_time     = this->time + imex_rk->get_c(i) * dt;
+    double const scaling_factor = 1.0 / (imex_rk->get_a_implicit(i, i) * dt);
+
+    // contributions of the previous stages, scaled by 1 / a^I_ii
+    sum_previous_stages = 0.0;
+    for(unsigned int j = 0; j < i; ++j)
+    {
+      if(param.convective_problem())
+        sum_previous_stages.add(-imex_rk->get_a_explicit(i, j) * scaling_factor * dt,
+                                vec_convective_term[j]);
+      if(j > 0)
+        sum_previous_stages.add(imex_rk->get_a_implicit(i, j) * scaling_factor * dt,
+                                vec_implicit_term[j - 1]);
+    }
+
+    pde_operator->rhs(rhs_vector, stage_time);
+    rhs_vector += sum_previous_stages;
+    rhs_vector.add(scaling_factor, mass_solution_n);
+
+    N_iter += pde_operator->solve(this->solution_np,
+                                  rhs_vector,
+                                  update_preconditioner and i == 1,
+                                  scaling_factor,
+                                  stage_time);
+
+    // the terms of the last stage are not needed since the schemes are globally stiffly accurate
+    if(i + 1 < n_stages)
+    {
+      // implicit term -A U_i + b(t_i) = (M U_i - M u^n) / (a^I_ii dt) - sum_previous_stages
+      VectorType & implicit_term = vec_implicit_term[i - 1];
+      pde_operator->apply_mass_operator(implicit_term, this->solution_np);
+      implicit_term.add(-1.0, mass_solution_n);
+      implicit_term *= scaling_factor;
+      implicit_term -= sum_previous_stages;
+
+      if(param.convective_problem())
+        evaluate_convective_term(vec_convective_term[i], this->solution_np, stage_time);
+    }
+  }
+
+  iterations.first += n_stages - 1;
+  iterations.second += N_iter;
+
+  if(print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl << "Solve scalar convection-diffusion equation (IMEX Runge-Kutta):";
+    print_solver_info_linear(this->pcout, N_iter, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Solve"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::postprocessing() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  postprocessor->do_postprocessing(this->solution_n, this->time, this->time_step_number);
+
+  this->timer_tree->insert({"Timeloop", "Postprocessing"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::print_iterations() const
+{
+  std::vector<std::string> names = {"Linear system"};
+
+  std::vector<double> iterations_avg;
+  iterations_avg.resize(1);
+  iterations_avg[0] = (double)iterations.second / std::max(1., (double)iterations.first);
+
+  print_list_of_iterations(this->pcout, names, iterations_avg);
+}
+
+// instantiations
+
+template class TimeIntIMEXRK<2, float>;
+template class TimeIntIMEXRK<2, double>;
+
+template class TimeIntIMEXRK<3, float>;
+template class TimeIntIMEXRK<3, double>;
+
+} // namespace ConvDiff
+} // namespace ExaDG
@@ -0,0 +1,134 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_CONVECTION_DIFFUSION_TIME_INT_IMEX_RUNGE_KUTTA_H_
+#define INCLUDE_CONVECTION_DIFFUSION_TIME_INT_IMEX_RUNGE_KUTTA_H_
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/imex_runge_kutta_constants.h>
+#include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+// forward declarations
+class Parameters;
+
+template<int dim, typename Number>
+class Operator;
+
+template<typename Number>
+class PostProcessorInterface;
+
+/**
+ * Additive implicit-explicit Runge-Kutta time integration of the convection-diffusion equation,
+ * where the convective term is treated explicitly and the diffusive term (as well as the
+ * right-hand side and the boundary conditions of the diffusive term) implicitly. In each stage, a
+ * linear system of equations involving the mass and diffusive operators is solved with the solver
+ * and preconditioner (e.g. multigrid) of the spatial discretization, i.e., the time step size is
+ * only restricted by the CFL condition of the convective term.
+ *
+ * The implementation is restricted to analytical velocity fields.
+ */
+template<int dim, typename Number>
+class TimeIntIMEXRK : public TimeIntExplRKBase<Number>
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  TimeIntIMEXRK(std::shared_ptr<Operator<dim, Number>>          operator_in,
+                std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in,
+                Parameters const &                              param_in,
+                MPI_Comm const &                                mpi_comm_in,
+                bool const                                      is_test_in);
+
+  void
+  print_iterations() const;
+
+private:
+  void
+  initialize_vectors() final;
+
+  void
+  initialize_solution() final;
+
+  void
+  postprocessing() const final;
+
+  bool
+  print_solver_info() const final;
+
+  bool
+  print_memory_consumption() const final;
+
+  void
+  do_timestep_solve() final;
+
+  void
+  calculate_time_step_size() final;
+
+  double
+  recalculate_time_step_size() const final;
+
+  void
+  initialize_time_integrator() final;
+
+  /*
+   * Evaluates the convective term for the given stage value, using the analytical velocity field.
+   */
+  void
+  evaluate_convective_term(VectorType & dst, VectorType const & src, double const time);
+
+  std::shared_ptr<Operator<dim, Number>> pde_operator;
+
+  std::shared_ptr<IMEXRungeKuttaConstants> imex_rk;
+
+  Parameters const & param;
+
+  unsigned int const refine_steps_time;
+
+  double const cfl;
+
+  // convective terms and (mass-weighted) implicit terms of the stages
+  std::vector<VectorType> vec_convective_term;
+  std::vector<VectorType> vec_implicit_term;
+
+  VectorType rhs_vector;
+  VectorType mass_solution_n;
+  VectorType sum_previous_stages;
+
+  // velocity field in case it is stored in a DoF vector
+  VectorType velocity;
+
+  // iteration counts
+  std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations;
+
+  std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
+};
+
+} // namespace ConvDiff
+} // namespace ExaDG
+
+#endif /* INCLUDE_CONVECTION_DIFFUSION_TIME_INT_IMEX_RUNGE_KUTTA_H_ */
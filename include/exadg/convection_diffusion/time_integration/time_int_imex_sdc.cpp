@@ -0,0 +1,405 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <exadg/convection_diffusion/postprocessor/postprocessor_base.h>
+#include <exadg/convection_diffusion/spatial_discretization/operator.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_sdc.h>
+#include <exadg/convection_diffusion/user_interface/parameters.h>
+#include <exadg/time_integration/linear_combination.h>
+#include <exadg/time_integration/time_step_calculation.h>
+#include <exadg/utilities/print_functions.h>
+#include <exadg/utilities/print_solver_results.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+template<int dim, typename Number>
+TimeIntIMEXSDC<dim, Number>::TimeIntIMEXSDC(
+  std::shared_ptr<Operator<dim, Number>>          operator_in,
+  std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in,
+  Parameters const &                              param_in,
+  MPI_Comm const &                                mpi_comm_in,
+  bool const                                      is_test_in)
+  : TimeIntExplRKBase<Number>(param_in.start_time,
+                              param_in.end_time,
+                              param_in.max_number_of_time_steps,
+                              param_in.restart_data,
+                              param_in.adaptive_time_stepping,
+                              mpi_comm_in,
+                              is_test_in),
+    pde_operator(operator_in),
+    param(param_in),
+    refine_steps_time(param_in.n_refine_time),
+    cfl(param.cfl / std::pow(2.0, refine_steps_time)),
+    iterations({0, 0}),
+    postprocessor(postprocessor_in)
+{
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::initialize_time_integrator()
+{
+  sdc = std::make_shared<SpectralDeferredCorrectionConstants>(param.order_time_integrator);
+
+  sdc->print(this->pcout);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::initialize_vectors()
+{
+  pde_operator->initialize_dof_vector(this->solution_n);
+  pde_operator->initialize_dof_vector(this->solution_np);
+  pde_operator->initialize_dof_vector(rhs_vector);
+  pde_operator->initialize_dof_vector(sum_known_terms);
+
+  unsigned int const n_nodes = sdc->get_n_nodes();
+
+  vec_solution.resize(n_nodes);
+  for(auto & vector : vec_solution)
+    pde_operator->initialize_dof_vector(vector);
+
+  vec_implicit_term.resize(n_nodes);
+  for(auto & vector : vec_implicit_term)
+    pde_operator->initialize_dof_vector(vector);
+
+  vec_integral.resize(n_nodes - 1);
+  for(auto & vector : vec_integral)
+    pde_operator->initialize_dof_vector(vector);
+
+  if(param.convective_problem())
+  {
+    vec_convective_term.resize(n_nodes);
+    for(auto & vector : vec_convective_term)
+      pde_operator->initialize_dof_vector(vector);
+    pde_operator->initialize_dof_vector(convective_term);
+
+    if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+      pde_operator->initialize_dof_vector_velocity(velocity);
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::initialize_solution()
+{
+  pde_operator->prescribe_initial_conditions(this->solution_n, this->time);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::calculate_time_step_size()
+{
+  if(param.calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+  {
+    this->time_step = calculate_const_time_step(param.time_step_size, refine_steps_time);
+
+    this->pcout << std::endl
+                << "Calculation of time step size (user-specified):" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "time step size", this->time_step);
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::CFL)
+  {
+    double time_step_conv = pde_operator->calculate_time_step_cfl_global(this->get_time());
+    time_step_conv *= cfl;
+
+    this->pcout << std::endl
+                << "Calculation of time step size according to CFL condition:" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "CFL", cfl);
+    print_parameter(this->pcout, "Time step size (CFL global)", time_step_conv);
+
+    if(this->adaptive_time_stepping)
+    {
+      double time_step_adap =
+        pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time());
+      time_step_adap *= cfl;
+
+      // use adaptive time step size only if it is smaller, otherwise use global time step size
+      time_step_conv = std::min(time_step_conv, time_step_adap);
+
+      // make sure that the maximum allowable time step size is not exceeded
+      time_step_conv = std::min(time_step_conv, param.time_step_size_max);
+
+      print_parameter(this->pcout, "Time step size (CFL adaptive)", time_step_conv);
+    }
+    else
+    {
+      time_step_conv =
+        adjust_time_step_to_hit_end_time(this->start_time, this->end_time, time_step_conv);
+
+      this->pcout << std::endl
+                  << "Adjust time step size to hit end time:" << std::endl
+                  << std::endl;
+      print_parameter(this->pcout, "Time step size", time_step_conv);
+    }
+
+    this->time_step = time_step_conv;
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::MaxEfficiency)
+  {
+    this->time_step    = pde_operator->calculate_time_step_max_efficiency(sdc->get_order());
+    double const c_eff = param.c_eff / std::pow(2., refine_steps_time);
+    this->time_step *= c_eff;
+
+    this->time_step =
+      adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+
+    this->pcout << std::endl
+                << "Calculation of time step size (max efficiency):" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "C_eff", c_eff);
+    print_parameter(this->pcout, "Time step size", this->time_step);
+  }
+  else
+  {
+    AssertThrow(false,
+                dealii::ExcMessage("Specified type of time step calculation is not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+double
+TimeIntIMEXSDC<dim, Number>::recalculate_time_step_size() const
+{
+  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL,
+              dealii::ExcMessage(
+                "Adaptive time step is not implemented for this type of time step calculation."));
+
+  double new_time_step_size =
+    pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time(),
+                                                              not this->defer_time_step_reduction);
+  new_time_step_size *= cfl;
+
+  // make sure that time step size does not exceed maximum allowable time step size
+  new_time_step_size = std::min(new_time_step_size, param.time_step_size_max);
+
+  limit_time_step_change(new_time_step_size,
+                         this->get_time_step_size(),
+                         param.adaptive_time_stepping_limiting_factor);
+
+  return new_time_step_size;
+}
+
+template<int dim, typename Number>
+bool
+TimeIntIMEXSDC<dim, Number>::print_solver_info() const
+{
+  return param.solver_info_data.write(this->global_timer.wall_time(),
+                                      this->time,
+                                      this->time_step_number);
+}
+
+template<int dim, typename Number>
+bool
+TimeIntIMEXSDC<dim, Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::evaluate_convective_term(VectorType &       dst,
+                                                     VectorType const & src,
+                                                     double const       time)
+{
+  if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    pde_operator->project_velocity(velocity, time);
+    pde_operator->evaluate_convective_term(dst, src, time, &velocity);
+  }
+  else
+  {
+    pde_operator->evaluate_convective_term(dst, src, time);
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::do_timestep_solve()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  double const       dt      = this->time_step;
+  unsigned int const n_nodes = sdc->get_n_nodes();
+
+  // Denoting the mass operator by M, the diffusive operator by A, the convective term by C, and
+  // the inhomogeneous contributions by b, the implicit terms are I(u,t) = - A u + b(t). Sweep k+1
+  // solves for the nodes m = 0, ..., n_nodes - 2
+  //
+  //  (M / dt_m + A) u^{k+1}_{m+1} = b(t_{m+1}) + X_m / dt_m,
+  //
+  //  X_m = M u^{k+1}_m - dt_m (C(u^{k+1}_m) - C(u^k_m)) - dt_m I(u^k_{m+1}) + int_m^{m+1} F^k,
+  //
+  // with dt_m = t_{m+1} - t_m and the integral of the collocation polynomial of the right-hand
+  // side F^k = - C(u^k) + I(u^k) of the previous sweep. The implicit terms of the new sweep are
+  // recovered from I(u^{k+1}_{m+1}) = (M u^{k+1}_{m+1} - X_m) / dt_m so that the diffusive
+  // operator only has to be evaluated for the initial value.
+  vec_solution[0] = this->solution_n;
+
+  pde_operator->rhs(vec_implicit_term[0], this->time);
+  if(param.diffusive_problem())
+  {
+    pde_operator->apply_diffusive_term(rhs_vector, this->solution_n);
+    vec_implicit_term[0] -= rhs_vector;
+  }
+
+  if(param.convective_problem())
+    evaluate_convective_term(vec_convective_term[0], this->solution_n, this->time);
+
+  // spread the initial value to all nodes
+  for(unsigned int m = 1; m < n_nodes; ++m)
+  {
+    vec_solution[m]      = vec_solution[0];
+    vec_implicit_term[m] = vec_implicit_term[0];
+    if(param.convective_problem())
+      vec_convective_term[m] = vec_convective_term[0];
+  }
+
+  bool const update_preconditioner =
+    param.update_preconditioner and
+    (this->time_step_number % param.update_preconditioner_every_time_steps == 0);
+
+  unsigned int N_iter = 0;
+
+  for(unsigned int k = 0; k < sdc->get_n_sweeps(); ++k)
+  {
+    // integrals of the collocation polynomial of the previous sweep
+    for(unsigned int m = 0; m < n_nodes - 1; ++m)
+    {
+      std::vector<double>             factors;
+      std::vector<VectorType const *> vectors;
+      for(unsigned int j = 0; j < n_nodes; ++j)
+      {
+        double const weight = dt * sdc->get_integration_weight(m, j);
+
+        factors.push_back(weight);
+        vectors.push_back(&vec_implicit_term[j]);
+        if(param.convective_problem())
+        {
+          factors.push_back(-weight);
+          vectors.push_back(&vec_convective_term[j]);
+        }
+      }
+
+      compute_linear_combination(vec_integral[m], factors, vectors);
+    }
+
+    for(unsigned int m = 0; m < n_nodes - 1; ++m)
+    {
+      double const node_time      = this->time + sdc->get_node(m + 1) * dt;
+      double const dt_m           = (sdc->get_node(m + 1) - sdc->get_node(m)) * dt;
+      double const scaling_factor = 1.0 / dt_m;
+
+      // X_m, where the node values u_0 and C(u_0) do not change in the sweeps
+      pde_operator->apply_mass_operator(sum_known_terms, vec_solution[m]);
+      sum_known_terms.add(-dt_m, vec_implicit_term[m + 1]);
+      sum_known_terms += vec_integral[m];
+
+      if(param.convective_problem() and m > 0)
+      {
+        evaluate_convective_term(convective_term,
+                                 vec_solution[m],
+                                 this->time + sdc->get_node(m) * dt);
+        sum_known_terms.add(-dt_m, convective_term, dt_m, vec_convective_term[m]);
+        vec_convective_term[m].swap(convective_term);
+      }
+
+      pde_operator->rhs(rhs_vector, node_time);
+      rhs_vector.add(scaling_factor, sum_known_terms);
+
+      // the node value of the previous sweep is the initial guess
+      N_iter += pde_operator->solve(vec_solution[m + 1],
+                                    rhs_vector,
+                                    update_preconditioner and k == 0 and m == 0,
+                                    scaling_factor,
+                                    node_time);
+
+      // implicit term I(u^{k+1}_{m+1}) = (M u^{k+1}_{m+1} - X_m) / dt_m
+      VectorType & implicit_term = vec_implicit_term[m + 1];
+      pde_operator->apply_mass_operator(implicit_term, vec_solution[m + 1]);
+      implicit_term -= sum_known_terms;
+      implicit_term *= scaling_factor;
+    }
+
+    // the convective term of the last node is needed for the integrals of the next sweep
+    if(param.convective_problem() and k + 1 < sdc->get_n_sweeps())
+      evaluate_convective_term(vec_convective_term[n_nodes - 1],
+                               vec_solution[n_nodes - 1],
+                               this->time + dt);
+  }
+
+  // the last node is the end point of the time step
+  this->solution_np = vec_solution[n_nodes - 1];
+
+  iterations.first += sdc->get_n_sweeps() * (n_nodes - 1);
+  iterations.second += N_iter;
+
+  if(print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl
+                << "Solve scalar convection-diffusion equation (IMEX spectral deferred "
+                   "correction):";
+    print_solver_info_linear(this->pcout, N_iter, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Solve"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::postprocessing() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  postprocessor->do_postprocessing(this->solution_n, this->time, this->time_step_number);
+
+  this->timer_tree->insert({"Timeloop", "Postprocessing"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXSDC<dim, Number>::print_iterations() const
+{
+  std::vector<std::string> names = {"Linear system"};
+
+  std::vector<double> iterations_avg;
+  iterations_avg.resize(1);
+  iterations_avg[0] = (double)iterations.second / std::max(1., (double)iterations.first);
+
+  print_list_of_iterations(this->pcout, names, iterations_avg);
+}
+
+// instantiations
+
+template class TimeIntIMEXSDC<2, float>;
+template class TimeIntIMEXSDC<2, double>;
+
+template class TimeIntIMEXSDC<3, float>;
+template class TimeIntIMEXSDC<3, double>;
+
+} // namespace ConvDiff
+} // namespace ExaDG
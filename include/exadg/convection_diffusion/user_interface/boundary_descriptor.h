@@ -30,6 +30,9 @@
 #include <deal.II/base/function.h>
 #include <deal.II/base/types.h>
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+
 namespace ExaDG
 {
 namespace ConvDiff
@@ -38,6 +41,7 @@ enum class BoundaryType
 {
   Undefined,
   Dirichlet,
+  DirichletCached,
   Neumann
 };
 
@@ -46,6 +50,11 @@ struct BoundaryDescriptor
 {
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
 
+  // Another type of Dirichlet boundary condition where the Dirichlet values come from the solution
+  // on another domain, e.g. the donor grid in the overlap region of overset grids. This type of
+  // boundary condition is only available for discontinuous Galerkin discretizations.
+  std::set<dealii::types::boundary_id> dirichlet_cached_bc;
+
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> neumann_bc;
 
   // returns the boundary type
@@ -55,6 +64,8 @@ struct BoundaryDescriptor
   {
     if(this->dirichlet_bc.find(boundary_id) != this->dirichlet_bc.end())
       return BoundaryType::Dirichlet;
+    else if(this->dirichlet_cached_bc.find(boundary_id) != this->dirichlet_cached_bc.end())
+      return BoundaryType::DirichletCached;
     else if(this->neumann_bc.find(boundary_id) != this->neumann_bc.end())
       return BoundaryType::Neumann;
 
@@ -73,6 +84,9 @@ struct BoundaryDescriptor
     if(dirichlet_bc.find(boundary_id) != dirichlet_bc.end())
       counter++;
 
+    if(dirichlet_cached_bc.find(boundary_id) != dirichlet_cached_bc.end())
+      counter++;
+
     if(neumann_bc.find(boundary_id) != neumann_bc.end())
       counter++;
 
@@ -82,6 +96,25 @@ struct BoundaryDescriptor
     AssertThrow(counter == 1,
                 dealii::ExcMessage("Boundary face with non-unique boundary type found."));
   }
+
+  void
+  set_dirichlet_cached_data(
+    std::shared_ptr<ContainerInterfaceData<0, dim, double> const> interface_data) const
+  {
+    dirichlet_cached_data = interface_data;
+  }
+
+  std::shared_ptr<ContainerInterfaceData<0, dim, double> const>
+  get_dirichlet_cached_data() const
+  {
+    AssertThrow(dirichlet_cached_data.get(),
+                dealii::ExcMessage("Pointer to ContainerInterfaceData has not been initialized."));
+
+    return dirichlet_cached_data;
+  }
+
+private:
+  mutable std::shared_ptr<ContainerInterfaceData<0, dim, double> const> dirichlet_cached_data;
 };
 
 } // namespace ConvDiff
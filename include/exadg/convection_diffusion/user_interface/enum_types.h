@@ -98,12 +98,18 @@ enum class FormulationConvectiveTerm
  *  Temporal discretization method:
  *  ExplRK: Explicit Runge-Kutta methods (implemented for orders 1-4)
  *  BDF: backward differentiation formulae (implemented for order 1-3)
+ *  IMEXRK: additive implicit-explicit Runge-Kutta methods with explicit convective term and
+ *          implicit diffusive term (implemented for orders 1-3)
+ *  IMEXSDC: implicit-explicit spectral deferred correction with explicit convective term and
+ *           implicit diffusive term (implemented for orders 1-8)
  */
 enum class TemporalDiscretization
 {
   Undefined,
   ExplRK,
-  BDF
+  BDF,
+  IMEXRK,
+  IMEXSDC
 };
 
 /*
@@ -79,6 +79,7 @@ Parameters::Parameters()
     preconditioner(Preconditioner::Undefined),
     update_preconditioner(false),
     update_preconditioner_every_time_steps(1),
+    adaptive_preconditioner_update(false),
     implement_block_diagonal_preconditioner_matrix_free(false),
     solver_block_diagonal(Elementwise::Solver::Undefined),
     preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
@@ -86,11 +87,19 @@ Parameters::Parameters()
     mg_operator_type(MultigridOperatorType::Undefined),
     multigrid_data(MultigridData()),
     solver_info_data(SolverInfoData()),
+    use_pseudo_transient_continuation(false),
+    pseudo_time_cfl_initial(1.0),
+    pseudo_time_cfl_max(1.e6),
+    pseudo_time_max_steps(100),
+    pseudo_time_abs_tol(1.e-12),
+    pseudo_time_rel_tol(1.e-8),
 
     // NUMERICAL PARAMETERS
     use_cell_based_face_loops(false),
     use_combined_operator(true),
     store_analytical_velocity_in_dof_vector(false),
+    velocity_projection_time_interval(0.0),
+    store_velocity_at_quadrature_points(false),
     use_overintegration(false)
 {
 }
@@ -119,6 +128,13 @@ Parameters::check() const
     }
   }
 
+  if(store_velocity_at_quadrature_points)
+  {
+    AssertThrow(get_type_velocity_field() == TypeVelocityField::DoFVector,
+                dealii::ExcMessage("The velocity can only be stored in the quadrature points if "
+                                   "the velocity field is given by a DoF vector."));
+  }
+
   // moving mesh
   if(ale_formulation)
   {
@@ -183,6 +199,33 @@ Parameters::check() const
                   dealii::ExcMessage("parameter must be defined"));
     }
 
+    if(temporal_discretization == TemporalDiscretization::IMEXRK or
+       temporal_discretization == TemporalDiscretization::IMEXSDC)
+    {
+      if(equation_type == EquationType::Convection or
+         equation_type == EquationType::ConvectionDiffusion)
+      {
+        AssertThrow(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit,
+                    dealii::ExcMessage(
+                      "IMEX time integration requires an explicit treatment of the convective "
+                      "term."));
+
+        AssertThrow(analytical_velocity_field,
+                    dealii::ExcMessage("IMEX time integration is only implemented for analytical "
+                                       "velocity fields."));
+      }
+
+      AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Diffusion and
+                    calculation_of_time_step_size != TimeStepCalculation::CFLAndDiffusion,
+                  dealii::ExcMessage("The diffusive term is treated implicitly for IMEX time "
+                                     "integration."));
+    }
+
+    if(update_preconditioner and adaptive_preconditioner_update)
+      AssertThrow(temporal_discretization == TemporalDiscretization::BDF,
+                  dealii::ExcMessage("Adaptive preconditioner update is only implemented for BDF "
+                                     "time integration."));
+
     AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Undefined,
                 dealii::ExcMessage("parameter must be defined"));
 
@@ -253,6 +296,20 @@ Parameters::check() const
       AssertThrow(order_time_integrator >= 1 and order_time_integrator <= 4,
                   dealii::ExcMessage("Specified order of time integrator BDF not implemented!"));
     }
+
+    if(temporal_discretization == TemporalDiscretization::IMEXRK)
+    {
+      AssertThrow(order_time_integrator >= 1 and order_time_integrator <= 3,
+                  dealii::ExcMessage(
+                    "Specified order of time integrator IMEXRK not implemented!"));
+    }
+
+    if(temporal_discretization == TemporalDiscretization::IMEXSDC)
+    {
+      AssertThrow(order_time_integrator >= 1 and order_time_integrator <= 8,
+                  dealii::ExcMessage(
+                    "Specified order of time integrator IMEXSDC not implemented!"));
+    }
   }
 
   // SPATIAL DISCRETIZATION
@@ -284,7 +341,9 @@ Parameters::check() const
 
 
   // SOLVER
-  if(temporal_discretization == TemporalDiscretization::BDF)
+  if(temporal_discretization == TemporalDiscretization::BDF or
+     temporal_discretization == TemporalDiscretization::IMEXRK or
+     temporal_discretization == TemporalDiscretization::IMEXSDC)
   {
     AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("parameter must be defined"));
 
@@ -341,6 +400,23 @@ Parameters::check() const
         "Invalid parameter. A solver type needs to be specified for elementwise matrix-free iterative solver."));
   }
 
+  AssertThrow(velocity_projection_time_interval >= 0.0,
+              dealii::ExcMessage("Time interval of velocity projection must not be negative."));
+
+  if(use_pseudo_transient_continuation)
+  {
+    AssertThrow(problem_type == ProblemType::Steady,
+                dealii::ExcMessage("Pseudo-transient continuation is only used for steady "
+                                   "problems."));
+
+    AssertThrow(convective_problem(),
+                dealii::ExcMessage("Pseudo-transient continuation requires a convective term "
+                                   "to define the pseudo time step size via the CFL number."));
+
+    AssertThrow(pseudo_time_cfl_initial > 0.0 and pseudo_time_cfl_max >= pseudo_time_cfl_initial,
+                dealii::ExcMessage("Invalid CFL numbers for pseudo-transient continuation."));
+  }
+
   // NUMERICAL PARAMETERS
 }
 
@@ -388,8 +464,11 @@ bool
 Parameters::linear_system_has_to_be_solved() const
 {
   bool linear_solver_needed =
-    problem_type == ProblemType::Steady or (problem_type == ProblemType::Unsteady and
-                                            temporal_discretization == TemporalDiscretization::BDF);
+    problem_type == ProblemType::Steady or
+    (problem_type == ProblemType::Unsteady and
+     (temporal_discretization == TemporalDiscretization::BDF or
+      temporal_discretization == TemporalDiscretization::IMEXRK or
+      temporal_discretization == TemporalDiscretization::IMEXSDC));
 
   return linear_solver_needed;
 }
@@ -489,6 +568,12 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Treatment of convective term", treatment_of_convective_term);
   }
 
+  if(temporal_discretization == TemporalDiscretization::IMEXRK or
+     temporal_discretization == TemporalDiscretization::IMEXSDC)
+  {
+    print_parameter(pcout, "Order of time integrator", order_time_integrator);
+  }
+
   print_parameter(pcout, "Calculation of time step size", calculation_of_time_step_size);
 
   print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
@@ -561,7 +646,12 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
     print_parameter(pcout, "Update preconditioner", update_preconditioner);
 
     if(update_preconditioner)
-      print_parameter(pcout, "Update every time steps", update_preconditioner_every_time_steps);
+    {
+      print_parameter(pcout, "Adaptive preconditioner update", adaptive_preconditioner_update);
+
+      if(not adaptive_preconditioner_update)
+        print_parameter(pcout, "Update every time steps", update_preconditioner_every_time_steps);
+    }
   }
 
   print_parameter(pcout,
@@ -584,6 +674,20 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
   }
 
   solver_info_data.print(pcout);
+
+  if(problem_type == ProblemType::Steady)
+  {
+    print_parameter(pcout, "Pseudo-transient continuation", use_pseudo_transient_continuation);
+
+    if(use_pseudo_transient_continuation)
+    {
+      print_parameter(pcout, "Initial CFL number", pseudo_time_cfl_initial);
+      print_parameter(pcout, "Maximum CFL number", pseudo_time_cfl_max);
+      print_parameter(pcout, "Maximum number of pseudo time steps", pseudo_time_max_steps);
+      print_parameter(pcout, "Absolute tolerance steady residual", pseudo_time_abs_tol);
+      print_parameter(pcout, "Relative tolerance steady residual", pseudo_time_rel_tol);
+    }
+  }
 }
 
 
@@ -606,8 +710,18 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
                       "Store velocity in DoF vector",
                       store_analytical_velocity_in_dof_vector);
     }
+
+    if(get_type_velocity_field() == TypeVelocityField::DoFVector)
+      print_parameter(pcout,
+                      "Time interval of velocity projection",
+                      velocity_projection_time_interval);
   }
 
+  if(get_type_velocity_field() == TypeVelocityField::DoFVector)
+    print_parameter(pcout,
+                    "Store velocity at quadrature points",
+                    store_velocity_at_quadrature_points);
+
   print_parameter(pcout, "Use over-integration", use_overintegration);
 }
 
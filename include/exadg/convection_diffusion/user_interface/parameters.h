@@ -147,7 +147,8 @@ public:
   // description: see enum declaration (only relevant for explicit time integration)
   TimeIntegratorRK time_integrator_rk;
 
-  // order of time integration scheme (only relevant for BDF time integration)
+  // order of time integration scheme (only relevant for BDF, IMEX Runge-Kutta, and IMEX spectral
+  // deferred correction time integration)
   unsigned int order_time_integrator;
 
   // start with low order (only relevant for BDF time integration)
@@ -155,7 +156,8 @@ public:
 
   // description: see enum declaration (this parameter is ignored for steady problems or
   // unsteady problems with explicit Runge-Kutta time integration scheme). In case of
-  // a purely diffusive problem, one also does not have to specify this parameter.
+  // a purely diffusive problem, one also does not have to specify this parameter. IMEX
+  // Runge-Kutta time integration requires an explicit treatment of the convective term.
   TreatmentOfConvectiveTerm treatment_of_convective_term;
 
   // calculation of time step size
@@ -299,6 +301,12 @@ public:
   // is set to true.
   unsigned int update_preconditioner_every_time_steps;
 
+  // replace the fixed interval update_preconditioner_every_time_steps by an automatic policy that
+  // updates the preconditioner once the wall time spent on additional iterations exceeds the
+  // measured cost of an update, see PreconditionerUpdatePolicy. Only relevant if update
+  // preconditioner is set to true. Only implemented for BDF time integration.
+  bool adaptive_preconditioner_update;
+
   // Implement block diagonal (block Jacobi) preconditioner in a matrix-free way
   // by solving the block Jacobi problems elementwise using iterative solvers and
   // matrix-free operator evaluation
@@ -323,6 +331,25 @@ public:
   // show solver performance (wall time, number of iterations)
   SolverInfoData solver_info_data;
 
+  // Steady problems: approach the steady state by implicit Euler steps in pseudo time instead of
+  // solving the steady equations directly (pseudo-transient continuation). The mass term makes the
+  // linear systems of convection-dominated problems diagonally dominant, such that preconditioners
+  // like multigrid with block Jacobi smoothing converge much faster.
+  bool use_pseudo_transient_continuation;
+
+  // CFL number of the first pseudo time step. The CFL number is increased by the reduction of the
+  // steady-state residual from one pseudo time step to the next (switched evolution relaxation)
+  // and limited by pseudo_time_cfl_max. The preconditioner follows the pseudo time step size only
+  // if update_preconditioner is true.
+  double pseudo_time_cfl_initial;
+  double pseudo_time_cfl_max;
+
+  // maximum number of pseudo time steps and absolute/relative tolerance of the steady-state
+  // residual, where the relative tolerance refers to the residual of the first pseudo time step
+  unsigned int pseudo_time_max_steps;
+  double       pseudo_time_abs_tol;
+  double       pseudo_time_rel_tol;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                NUMERICAL PARAMETERS                                */
@@ -354,6 +381,20 @@ public:
   // term has to be evaluated more than once at a given time t.
   bool store_analytical_velocity_in_dof_vector;
 
+  // In case that the analytical velocity field is stored in a DoF vector, the L2-projection of a
+  // time-dependent velocity field can become as expensive as the operator evaluation itself. If
+  // this time interval is larger than zero, the velocity field is only projected at multiples of
+  // this interval and interpolated linearly in time in between. A value of zero projects the
+  // velocity field at every requested time.
+  double velocity_projection_time_interval;
+
+  // In case that the velocity field is given as a DoF vector, the velocity can be interpolated
+  // into the quadrature points of all cells and faces once whenever the velocity is updated, i.e.,
+  // once per time step, and reused by all subsequent evaluations of the convective term, e.g. in
+  // iterative solvers and the multigrid level operators. This avoids the repeated interpolation of
+  // the velocity at the cost of storing the velocity in all quadrature points.
+  bool store_velocity_at_quadrature_points;
+
   // use 3/2 overintegration rule for convective term
   bool use_overintegration;
 };
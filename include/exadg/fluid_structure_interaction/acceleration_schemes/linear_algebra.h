@@ -23,11 +23,16 @@
 #define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_LINEAR_ALGEBRA_H_
 
 // C/C++
+#include <cmath>
+#include <deque>
 #include <vector>
 
 // deal.II
 #include <deal.II/base/exceptions.h>
 
+// ExaDG
+#include <exadg/solvers_and_preconditioners/utilities/vector_pool.h>
+
 namespace ExaDG
 {
 namespace FSI
@@ -77,39 +82,52 @@ private:
   std::vector<Number> data;
 };
 
+/*
+ * Orthogonalizes column i of Q against the columns 0, ..., i-1 by the modified Gram-Schmidt
+ * method, where the columns 0, ..., i-1 have already been orthonormalized and the corresponding
+ * entries of R have already been computed. The column is dropped if it is linearly dependent.
+ */
 template<typename VectorType, typename Number>
 void
-compute_QR_decomposition(std::vector<VectorType> & Q, Matrix<Number> & R, Number const eps = 1.e-2)
+orthogonalize_column(std::vector<VectorType> & Q,
+                     Matrix<Number> &          R,
+                     unsigned int const        i,
+                     Number const              eps = 1.e-2)
 {
-  for(unsigned int i = 0; i < Q.size(); ++i)
+  Number const norm_initial = Number(Q[i].l2_norm());
+
+  // orthogonalize
+  for(unsigned int j = 0; j < i; ++j)
   {
-    Number const norm_initial = Number(Q[i].l2_norm());
+    Number r_ji = Q[j] * Q[i];
+    R.set(r_ji, j, i);
+    Q[i].add(-r_ji, Q[j]);
+  }
 
-    // orthogonalize
+  // normalize or drop if linear dependent
+  Number r_ii = Number(Q[i].l2_norm());
+  if(r_ii < eps * norm_initial)
+  {
+    Q[i] = 0.0;
     for(unsigned int j = 0; j < i; ++j)
-    {
-      Number r_ji = Q[j] * Q[i];
-      R.set(r_ji, j, i);
-      Q[i].add(-r_ji, Q[j]);
-    }
-
-    // normalize or drop if linear dependent
-    Number r_ii = Number(Q[i].l2_norm());
-    if(r_ii < eps * norm_initial)
-    {
-      Q[i] = 0.0;
-      for(unsigned int j = 0; j < i; ++j)
-        R.set(0.0, j, i);
-      R.set(1.0, i, i);
-    }
-    else
-    {
-      R.set(r_ii, i, i);
-      Q[i] *= 1. / r_ii;
-    }
+      R.set(0.0, j, i);
+    R.set(1.0, i, i);
+  }
+  else
+  {
+    R.set(r_ii, i, i);
+    Q[i] *= 1. / r_ii;
   }
 }
 
+template<typename VectorType, typename Number>
+void
+compute_QR_decomposition(std::vector<VectorType> & Q, Matrix<Number> & R, Number const eps = 1.e-2)
+{
+  for(unsigned int i = 0; i < Q.size(); ++i)
+    orthogonalize_column(Q, R, i, eps);
+}
+
 /*
  *  Matrix has to be upper triangular with d_ii != 0 for all 0 <= i < n
  */
@@ -143,13 +161,14 @@ backward_substitution_multiple_rhs(Matrix<Number> const &          matrix,
 
   for(int i = n - 1; i >= 0; --i)
   {
-    VectorType value = rhs[i];
+    TemporaryVector<VectorType> value(rhs[i], true);
+    *value = rhs[i];
     for(int j = i + 1; j < n; ++j)
     {
-      value.add(-matrix.get(i, j), dst[j]);
+      value->add(-matrix.get(i, j), dst[j]);
     }
 
-    dst[i].equ(1.0 / matrix.get(i, i), value);
+    dst[i].equ(1.0 / matrix.get(i, i), *value);
   }
 }
 
@@ -161,7 +180,9 @@ inv_jacobian_times_residual(VectorType &
                             std::vector<std::shared_ptr<std::vector<VectorType>>> const & Z_history,
                             VectorType const &                                            residual)
 {
-  VectorType a = residual;
+  TemporaryVector<VectorType> a_vector(residual, true);
+  VectorType &                a = *a_vector;
+  a                               = residual;
 
   // reset
   b = 0.0;
@@ -187,6 +208,198 @@ inv_jacobian_times_residual(VectorType &
   }
 }
 
+/*
+ * Least-squares model of the interface quasi-Newton method with least-squares approximation
+ * (IQN-ILS). The columns v_i of V are differences of residuals and the columns w_i of W the
+ * corresponding differences of the solution, ordered from the newest to the oldest column. The QR
+ * decomposition V = Q R is updated incrementally: a new column is inserted in front with one
+ * orthogonalization against Q and Givens rotations restoring the triangular shape of R, and
+ * columns are removed by Givens rotations, such that the number of vector operations per update
+ * is proportional to the number of columns instead of its square for a new decomposition. The
+ * vectors are stored only once and are neither copied nor reassembled between the iterations and
+ * time steps. Columns are filtered as in the QR2 filter of Haelterman et al. (2016), "Improving
+ * the performance of the partitioned QN-ILS procedure for fluid-structure interaction problems:
+ * Filtering", i.e., column i is removed if |R_ii| < filter_tolerance * |v_i|, which removes older
+ * columns that are almost linearly dependent on newer ones.
+ */
+template<typename VectorType>
+class IncrementalQRLeastSquares
+{
+  typedef typename VectorType::value_type Number;
+
+public:
+  IncrementalQRLeastSquares(double const filter_tolerance_in = 1.e-2)
+    : filter_tolerance(filter_tolerance_in)
+  {
+  }
+
+  unsigned int
+  size() const
+  {
+    return Q.size();
+  }
+
+  /*
+   * Inserts the column pair (v, w) as newest column, labelled with the given tag.
+   */
+  void
+  insert(VectorType && v, VectorType && w, unsigned int const tag)
+  {
+    double const norm = v.l2_norm();
+    if(norm == 0.0)
+      return;
+
+    unsigned int const n = Q.size();
+
+    // orthogonalize v against Q, repeated once to compensate for the loss of orthogonality
+    std::vector<double> c(n, 0.0);
+    for(unsigned int pass = 0; pass < 2; ++pass)
+    {
+      for(unsigned int i = 0; i < n; ++i)
+      {
+        double const c_i = Q[i] * v;
+        c[i] += c_i;
+        v.add(static_cast<Number>(-c_i), Q[i]);
+      }
+    }
+
+    // v lies in the span of Q up to round-off errors and does not add information
+    double const rho = v.l2_norm();
+    if(rho < 1.e-14 * norm)
+      return;
+
+    v *= static_cast<Number>(1.0 / rho);
+    Q.push_back(std::move(v));
+
+    // [v_new, V] = [Q, q_new] H with H = [c, R; rho, 0]
+    std::vector<std::vector<double>> H(n + 1, std::vector<double>(n + 1, 0.0));
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      H[i][0] = c[i];
+      for(unsigned int j = i; j < n; ++j)
+        H[i][j + 1] = R[i][j];
+    }
+    H[n][0] = rho;
+
+    // eliminate the first column of H below the diagonal from bottom to top
+    for(unsigned int i = n; i > 0; --i)
+      apply_givens_rotation(H, Q, i - 1, 0);
+
+    R = std::move(H);
+    W.push_front(std::move(w));
+    column_norms.push_front(norm);
+    tags.push_front(tag);
+
+    // QR2 filter
+    for(unsigned int i = 1; i < Q.size();)
+    {
+      if(std::abs(R[i][i]) < filter_tolerance * column_norms[i])
+        remove_column(i);
+      else
+        ++i;
+    }
+  }
+
+  /*
+   * Removes all columns with a tag smaller than the given tag, assuming that the tags do not
+   * increase from the newest to the oldest column.
+   */
+  void
+  remove_columns_with_tag_below(unsigned int const tag)
+  {
+    while(not tags.empty() and tags.back() < tag)
+      remove_column(Q.size() - 1);
+  }
+
+  /*
+   * Adds W alpha to dst, where alpha = - R^{-1} Q^T r minimizes |V alpha + r|.
+   */
+  void
+  apply(VectorType & dst, VectorType const & r) const
+  {
+    int const n = Q.size();
+
+    std::vector<double> alpha(n, 0.0);
+    for(int i = n - 1; i >= 0; --i)
+    {
+      double value = -(Q[i] * r);
+      for(int j = i + 1; j < n; ++j)
+        value -= R[i][j] * alpha[j];
+
+      alpha[i] = value / R[i][i];
+    }
+
+    for(int i = 0; i < n; ++i)
+      dst.add(static_cast<Number>(alpha[i]), W[i]);
+  }
+
+private:
+  /*
+   * Givens rotation of the rows i and i+1 of matrix eliminating the entry (i+1, column), and the
+   * corresponding rotation of the columns i and i+1 of Q such that the product Q matrix remains
+   * unchanged.
+   */
+  void
+  apply_givens_rotation(std::vector<std::vector<double>> & matrix,
+                        std::deque<VectorType> &           Q_in,
+                        unsigned int const                 i,
+                        unsigned int const                 column)
+  {
+    double const x = matrix[i][column];
+    double const y = matrix[i + 1][column];
+    double const r = std::sqrt(x * x + y * y);
+    if(r == 0.0)
+      return;
+
+    double const cosine = x / r;
+    double const sine   = y / r;
+
+    for(unsigned int j = column; j < matrix[i].size(); ++j)
+    {
+      double const a   = matrix[i][j];
+      double const b   = matrix[i + 1][j];
+      matrix[i][j]     = cosine * a + sine * b;
+      matrix[i + 1][j] = -sine * a + cosine * b;
+    }
+    matrix[i + 1][column] = 0.0;
+
+    tmp = Q_in[i];
+    Q_in[i].sadd(static_cast<Number>(cosine), static_cast<Number>(sine), Q_in[i + 1]);
+    Q_in[i + 1].sadd(static_cast<Number>(cosine), static_cast<Number>(-sine), tmp);
+  }
+
+  void
+  remove_column(unsigned int const i)
+  {
+    unsigned int const n = Q.size();
+
+    for(auto & row : R)
+      row.erase(row.begin() + i);
+
+    // R is upper Hessenberg from column i on
+    for(unsigned int j = i; j + 1 < n; ++j)
+      apply_givens_rotation(R, Q, j, j);
+
+    R.pop_back();
+    Q.pop_back();
+
+    W.erase(W.begin() + i);
+    column_norms.erase(column_norms.begin() + i);
+    tags.erase(tags.begin() + i);
+  }
+
+  double const filter_tolerance;
+
+  std::deque<VectorType>           Q;
+  std::vector<std::vector<double>> R;
+
+  std::deque<VectorType>   W;
+  std::deque<double>       column_norms;
+  std::deque<unsigned int> tags;
+
+  VectorType tmp;
+};
+
 } // namespace FSI
 } // namespace ExaDG
 
@@ -34,14 +34,27 @@ enum class AccelerationMethod
   IQN_IMVLS
 };
 
+/*
+ * GaussSeidel: the structure is solved for the stress of the fluid solve of the same iteration.
+ * Jacobi: fluid and structure are solved for the data of the previous iteration, such that the two
+ * solves are independent of each other, and both displacement and stress are accelerated.
+ */
+enum class CouplingScheme
+{
+  GaussSeidel,
+  Jacobi
+};
+
 struct Parameters
 {
   Parameters()
     : acceleration_method(AccelerationMethod::Undefined),
+      coupling_scheme(CouplingScheme::GaussSeidel),
       abs_tol(1.e-12),
       rel_tol(1.e-3),
       omega_init(0.1),
       reused_time_steps(0),
+      qr_filter_tolerance(1.e-2),
       partitioned_iter_max(100),
       geometric_tolerance(1.e-10)
   {
@@ -57,6 +70,11 @@ struct Parameters
                         "Acceleration method.",
                         Patterns::Enum<AccelerationMethod>(),
                         true);
+      prm.add_parameter("CouplingScheme",
+                        coupling_scheme,
+                        "Serial (GaussSeidel) or parallel (Jacobi) coupling scheme.",
+                        Patterns::Enum<CouplingScheme>(),
+                        false);
       prm.add_parameter(
         "AbsTol", abs_tol, "Absolute solver tolerance.", dealii::Patterns::Double(0.0, 1.0), true);
       prm.add_parameter(
@@ -71,6 +89,11 @@ struct Parameters
                         "Number of time steps reused for acceleration.",
                         dealii::Patterns::Integer(0, 100),
                         false);
+      prm.add_parameter("QRFilterTolerance",
+                        qr_filter_tolerance,
+                        "Tolerance of the QR filter of the IQN-ILS method.",
+                        dealii::Patterns::Double(0.0, 1.0),
+                        false);
       prm.add_parameter("PartitionedIterMax",
                         partitioned_iter_max,
                         "Maximum number of fixed-point iterations.",
@@ -86,11 +109,17 @@ struct Parameters
   }
 
   AccelerationMethod acceleration_method;
+  CouplingScheme     coupling_scheme;
   double             abs_tol;
   double             rel_tol;
   double             omega_init;
   unsigned int       reused_time_steps;
-  unsigned int       partitioned_iter_max;
+
+  // IQN-ILS: columns i of the least-squares model with |R_ii| < qr_filter_tolerance * |v_i| are
+  // removed
+  double qr_filter_tolerance;
+
+  unsigned int partitioned_iter_max;
 
   // tolerance used to locate points at the fluid-structure interface
   double geometric_tolerance;
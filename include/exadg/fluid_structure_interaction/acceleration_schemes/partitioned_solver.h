@@ -23,12 +23,18 @@
 #ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_PARTITIONED_SOLVER_H_
 #define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_PARTITIONED_SOLVER_H_
 
+// deal.II
+#include <deal.II/dofs/dof_tools.h>
+
 // FSI
 #include <exadg/fluid_structure_interaction/acceleration_schemes/linear_algebra.h>
 #include <exadg/fluid_structure_interaction/acceleration_schemes/parameters.h>
 #include <exadg/fluid_structure_interaction/single_field_solvers/fluid.h>
 #include <exadg/fluid_structure_interaction/single_field_solvers/structure.h>
 
+// solvers
+#include <exadg/solvers_and_preconditioners/utilities/vector_pool.h>
+
 // utilities
 #include <exadg/utilities/print_solver_results.h>
 #include <exadg/utilities/timer_tree.h>
@@ -46,14 +52,48 @@ private:
 public:
   PartitionedSolver(Parameters const & parameters, MPI_Comm const & comm);
 
+  /*
+   * The acceleration schemes operate on the structural displacement DoFs located on the faces
+   * with the given boundary IDs, i.e., the fluid-structure interface. Since the fluid only sees
+   * the structural displacement on the interface, the fixed-point problem is fully described by
+   * the interface DoFs, and the remaining DoFs are taken from the last structural solution. For
+   * the parallel coupling scheme, the interface vectors additionally contain the DoFs of the fluid
+   * stress vector of the fluid cells adjacent to the faces with the fluid boundary IDs.
+   */
   void
   setup(std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
-        std::shared_ptr<SolverStructure<dim, Number>> structure_);
+        std::shared_ptr<SolverStructure<dim, Number>> structure_,
+        std::set<dealii::types::boundary_id> const &  interface_boundary_ids,
+        std::set<dealii::types::boundary_id> const &  interface_boundary_ids_fluid);
 
+  /*
+   * Serial (Gauss-Seidel) coupling scheme: apply_dirichlet_neumann_scheme(d_tilde, d, k) solves
+   * the fluid problem for the structural displacement d and the structural problem for the
+   * resulting fluid stress.
+   */
   void
   solve(std::function<void(VectorType &, VectorType const &, unsigned int)> const &
           apply_dirichlet_neumann_scheme);
 
+  /*
+   * Parallel (Jacobi) coupling scheme: apply_parallel_scheme(d_tilde, s_tilde, d, s, k) solves
+   * the fluid problem for the structural displacement d and the structural problem for the fluid
+   * stress s independently of each other. The acceleration is applied to displacement and stress.
+   */
+  void
+  solve_parallel(std::function<void(VectorType &,
+                                    VectorType &,
+                                    VectorType const &,
+                                    VectorType const &,
+                                    unsigned int)> const & apply_parallel_scheme);
+
+  /*
+   * Fluid stress at the start of the first time step, required by the parallel coupling scheme.
+   * In the following time steps, the fluid stress of the previous time step is used.
+   */
+  void
+  set_initial_stress(VectorType const & stress);
+
   void
   print_iterations(dealii::ConditionalOStream const & pcout) const;
 
@@ -61,6 +101,44 @@ public:
   get_timings() const;
 
 private:
+  bool
+  parallel_coupling() const;
+
+  void
+  solve_fixed_point_problem(std::function<void(unsigned int)> const & apply_coupling_scheme);
+
+  /*
+   * Compact vectors holding the interface DoFs of the structural displacement vector, followed by
+   * the interface DoFs of the fluid stress vector for the parallel coupling scheme.
+   */
+  void
+  initialize_interface_vector(VectorType & dst) const;
+
+  // dst = (displacement, stress) restricted to the interface DoFs
+  void
+  restrict_to_interface(VectorType &       dst,
+                        VectorType const & displacement,
+                        VectorType const & stress) const;
+
+  /*
+   * Sets up the full vectors of iteration k, applies the coupling scheme, and restricts the full
+   * vectors before and after the field solves to the interface.
+   */
+  void
+  evaluate_fixed_point_map(VectorType &                              d_tilde_interface,
+                           VectorType &                              d_interface,
+                           unsigned int const                        k,
+                           std::function<void(unsigned int)> const & apply_coupling_scheme);
+
+  /*
+   * Sets the next iterate: the interface DoFs are taken from d_interface, the remaining DoFs from
+   * the last field solves.
+   */
+  void
+  set_iterate(VectorType const & d_interface);
+
+  bool
+  check_convergence(VectorType const & residual) const;
   bool
   check_convergence(VectorType const & residual) const;
 
@@ -72,15 +150,33 @@ private:
 
   Parameters parameters;
 
+  MPI_Comm const mpi_comm;
+
   // output to std::cout
   dealii::ConditionalOStream pcout;
 
   std::shared_ptr<SolverFluid<dim, Number>>     fluid;
   std::shared_ptr<SolverStructure<dim, Number>> structure;
 
+  // interface DoFs: local indices in the structural displacement vector and the fluid stress
+  // vector, and the locally owned range of the compact interface vectors
+  std::vector<unsigned int> interface_dofs;
+  std::vector<unsigned int> interface_dofs_stress;
+  dealii::IndexSet          interface_index_set;
+
+  // full vectors of the current iteration: structural displacement d and fluid stress s
+  VectorType d, d_tilde, s, s_tilde;
+
+  // parallel coupling scheme: the stress part of the interface vectors is multiplied by this factor
+  // such that displacement and stress have the same magnitude in the acceleration schemes
+  double stress_scaling;
+
   // required for quasi-Newton methods
   std::vector<std::shared_ptr<std::vector<VectorType>>> D_history, R_history, Z_history;
 
+  // least-squares model of the IQN-ILS method including the reused time steps
+  IncrementalQRLeastSquares<VectorType> least_squares_model;
+
   // Computation time (wall clock time).
   std::shared_ptr<TimerTree> timer_tree;
 
@@ -95,7 +191,10 @@ template<int dim, typename Number>
 PartitionedSolver<dim, Number>::PartitionedSolver(Parameters const & parameters,
                                                   MPI_Comm const &   comm)
   : parameters(parameters),
+    mpi_comm(comm),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
+    least_squares_model(parameters.qr_filter_tolerance),
+    stress_scaling(0.0),
     partitioned_iterations({0, 0})
 {
   timer_tree = std::make_shared<TimerTree>();
@@ -103,21 +202,192 @@ PartitionedSolver<dim, Number>::PartitionedSolver(Parameters const & parameters,
 
 template<int dim, typename Number>
 void
-PartitionedSolver<dim, Number>::setup(std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
-                                      std::shared_ptr<SolverStructure<dim, Number>> structure_)
+PartitionedSolver<dim, Number>::setup(
+  std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
+  std::shared_ptr<SolverStructure<dim, Number>> structure_,
+  std::set<dealii::types::boundary_id> const &  interface_boundary_ids,
+  std::set<dealii::types::boundary_id> const &  interface_boundary_ids_fluid)
 {
   fluid     = fluid_;
   structure = structure_;
+
+  structure->pde_operator->initialize_dof_vector(d);
+  structure->pde_operator->initialize_dof_vector(d_tilde);
+
+  dealii::IndexSet const boundary_dofs =
+    dealii::DoFTools::extract_boundary_dofs(structure->pde_operator->get_dof_handler(),
+                                            dealii::ComponentMask(),
+                                            interface_boundary_ids);
+
+  dealii::IndexSet const locally_owned_interface_dofs = boundary_dofs & d.locally_owned_elements();
+
+  interface_dofs.clear();
+  interface_dofs.reserve(locally_owned_interface_dofs.n_elements());
+  for(auto const dof : locally_owned_interface_dofs)
+    interface_dofs.push_back(d.get_partitioner()->global_to_local(dof));
+
+  interface_dofs_stress.clear();
+  if(parallel_coupling())
+  {
+    fluid->pde_operator->initialize_vector_velocity(s);
+    fluid->pde_operator->initialize_vector_velocity(s_tilde);
+
+    // the fluid stress is interpolated into all DoFs of the cells at the interface
+    dealii::DoFHandler<dim> const & dof_handler = fluid->pde_operator->get_dof_handler_u();
+
+    std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
+    std::set<unsigned int>                       local_indices;
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(not cell->is_locally_owned())
+        continue;
+
+      for(auto const & face : cell->face_iterators())
+      {
+        if(face->at_boundary() and interface_boundary_ids_fluid.find(face->boundary_id()) !=
+                                     interface_boundary_ids_fluid.end())
+        {
+          cell->get_dof_indices(dof_indices);
+          for(auto const dof : dof_indices)
+            if(s.in_local_range(dof))
+              local_indices.insert(s.get_partitioner()->global_to_local(dof));
+          break;
+        }
+      }
+    }
+    interface_dofs_stress.assign(local_indices.begin(), local_indices.end());
+  }
+
+  // contiguous numbering of the interface DoFs in the order of the processes
+  unsigned long long n_local = interface_dofs.size() + interface_dofs_stress.size();
+  unsigned long long offset  = 0;
+  int const ierr = MPI_Exscan(&n_local, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    offset = 0;
+  unsigned long long const n_global = dealii::Utilities::MPI::sum(n_local, mpi_comm);
+
+  interface_index_set.clear();
+  interface_index_set.set_size(n_global);
+  interface_index_set.add_range(offset, offset + n_local);
+
+  pcout << std::endl
+        << "Partitioned FSI: the acceleration operates on " << n_global << " interface DoFs of "
+        << structure->pde_operator->get_number_of_dofs() << " structural DoFs";
+  if(parallel_coupling())
+    pcout << " and " << fluid->pde_operator->get_dof_handler_u().n_dofs() << " fluid DoFs";
+  pcout << "." << std::endl;
+}
+
+template<int dim, typename Number>
+bool
+PartitionedSolver<dim, Number>::parallel_coupling() const
+{
+  return parameters.coupling_scheme == CouplingScheme::Jacobi;
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::set_initial_stress(VectorType const & stress)
+{
+  s_tilde = stress;
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::initialize_interface_vector(VectorType & dst) const
+{
+  dst.reinit(interface_index_set, mpi_comm);
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::restrict_to_interface(VectorType &       dst,
+                                                      VectorType const & displacement,
+                                                      VectorType const & stress) const
+{
+  unsigned int const n = interface_dofs.size();
+
+  for(unsigned int i = 0; i < n; ++i)
+    dst.local_element(i) = displacement.local_element(interface_dofs[i]);
+
+  for(unsigned int i = 0; i < interface_dofs_stress.size(); ++i)
+    dst.local_element(n + i) = stress_scaling * stress.local_element(interface_dofs_stress[i]);
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::evaluate_fixed_point_map(
+  VectorType &                              d_tilde_interface,
+  VectorType &                              d_interface,
+  unsigned int const                        k,
+  std::function<void(unsigned int)> const & apply_coupling_scheme)
+{
+  if(k == 0)
+  {
+    structure->time_integrator->extrapolate_displacement_to_np(d);
+
+    // the fluid stress of the previous time step
+    if(parallel_coupling())
+      s = s_tilde;
+  }
+  else
+  {
+    d = structure->time_integrator->get_displacement_np();
+  }
+
+  apply_coupling_scheme(k);
+
+  // scaling of the stress is computed once from the first solves and kept constant afterwards
+  // such that the information of previous time steps remains valid
+  if(parallel_coupling() and stress_scaling == 0.0)
+  {
+    double const norm_d = d_tilde.l2_norm();
+    double const norm_s = s_tilde.l2_norm();
+    stress_scaling      = (norm_d > 0.0 and norm_s > 0.0) ? norm_d / norm_s : 1.0;
+  }
+
+  restrict_to_interface(d_interface, d, s);
+  restrict_to_interface(d_tilde_interface, d_tilde, s_tilde);
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::set_iterate(VectorType const & d_interface)
+{
+  unsigned int const n = interface_dofs.size();
+
+  d = d_tilde;
+  for(unsigned int i = 0; i < n; ++i)
+    d.local_element(interface_dofs[i]) = d_interface.local_element(i);
+
+  structure->time_integrator->set_displacement(d);
+
+  if(parallel_coupling())
+  {
+    s = s_tilde;
+    for(unsigned int i = 0; i < interface_dofs_stress.size(); ++i)
+      s.local_element(interface_dofs_stress[i]) = d_interface.local_element(n + i) / stress_scaling;
+  }
 }
 
 template<int dim, typename Number>
 bool
 PartitionedSolver<dim, Number>::check_convergence(VectorType const & residual) const
 {
+  VectorType const & velocity_np = structure->time_integrator->get_velocity_np();
+
+  double velocity_norm_sqr = 0.0;
+  for(auto const i : interface_dofs)
+    velocity_norm_sqr += velocity_np.local_element(i) * velocity_np.local_element(i);
+  velocity_norm_sqr = dealii::Utilities::MPI::sum(velocity_norm_sqr, mpi_comm);
+
+  // for the parallel coupling scheme, the scaled stress residual is measured in the same way as
+  // the displacement residual
   double const residual_norm = residual.l2_norm();
-  double const ref_norm_abs  = std::sqrt(structure->pde_operator->get_number_of_dofs());
-  double const ref_norm_rel  = structure->time_integrator->get_velocity_np().l2_norm() *
-                              structure->time_integrator->get_time_step_size();
+  double const ref_norm_abs  = std::sqrt(interface_index_set.size());
+  double const ref_norm_rel =
+    std::sqrt(velocity_norm_sqr) * structure->time_integrator->get_time_step_size();
 
   bool const converged = (residual_norm < parameters.abs_tol * ref_norm_abs) or
                          (residual_norm < parameters.rel_tol * ref_norm_rel);
@@ -177,6 +447,32 @@ void
 PartitionedSolver<dim, Number>::solve(
   std::function<void(VectorType &, VectorType const &, unsigned int)> const &
     apply_dirichlet_neumann_scheme)
+{
+  AssertThrow(not parallel_coupling(),
+              dealii::ExcMessage("Use solve_parallel() for the parallel coupling scheme."));
+
+  solve_fixed_point_problem(
+    [&](unsigned int const k) { apply_dirichlet_neumann_scheme(d_tilde, d, k); });
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::solve_parallel(
+  std::function<
+    void(VectorType &, VectorType &, VectorType const &, VectorType const &, unsigned int)> const &
+    apply_parallel_scheme)
+{
+  AssertThrow(parallel_coupling(),
+              dealii::ExcMessage("Use solve() for the serial coupling scheme."));
+
+  solve_fixed_point_problem(
+    [&](unsigned int const k) { apply_parallel_scheme(d_tilde, s_tilde, d, s, k); });
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::solve_fixed_point_problem(
+  std::function<void(unsigned int)> const & apply_coupling_scheme)
 {
   // iteration counter
   unsigned int k = 0;
@@ -184,9 +480,12 @@ PartitionedSolver<dim, Number>::solve(
   // fixed-point iteration with dynamic relaxation (Aitken relaxation)
   if(parameters.acceleration_method == AccelerationMethod::Aitken)
   {
-    VectorType r_old, d;
-    structure->pde_operator->initialize_dof_vector(r_old);
-    structure->pde_operator->initialize_dof_vector(d);
+    // interface vectors
+    VectorType d_interface, d_tilde_interface, r, r_old;
+    initialize_interface_vector(d_interface);
+    initialize_interface_vector(d_tilde_interface);
+    initialize_interface_vector(r);
+    initialize_interface_vector(r_old);
 
     bool   converged = false;
     double omega     = 1.0;
@@ -194,17 +493,11 @@ PartitionedSolver<dim, Number>::solve(
     {
       print_solver_info_header(k);
 
-      if(k == 0)
-        structure->time_integrator->extrapolate_displacement_to_np(d);
-      else
-        d = structure->time_integrator->get_displacement_np();
-
-      VectorType d_tilde(d);
-      apply_dirichlet_neumann_scheme(d_tilde, d, k);
+      evaluate_fixed_point_map(d_tilde_interface, d_interface, k, apply_coupling_scheme);
 
       // compute residual and check convergence
-      VectorType r = d_tilde;
-      r.add(-1.0, d);
+      r = d_tilde_interface;
+      r.add(-1.0, d_interface);
       converged = check_convergence(r);
 
       // relaxation
@@ -219,15 +512,16 @@ PartitionedSolver<dim, Number>::solve(
         }
         else
         {
-          VectorType delta_r = r;
-          delta_r.add(-1.0, r_old);
-          omega *= -(r_old * delta_r) / delta_r.norm_sqr();
+          TemporaryVector<VectorType> delta_r(r, true);
+          *delta_r = r;
+          delta_r->add(-1.0, r_old);
+          omega *= -(r_old * *delta_r) / delta_r->norm_sqr();
         }
 
         r_old = r;
 
-        d.add(omega, r);
-        structure->time_integrator->set_displacement(d);
+        d_interface.add(omega, r);
+        set_iterate(d_interface);
 
         timer_tree->insert({"Aitken"}, timer.wall_time());
       }
@@ -238,35 +532,30 @@ PartitionedSolver<dim, Number>::solve(
   }
   else if(parameters.acceleration_method == AccelerationMethod::IQN_ILS)
   {
-    std::shared_ptr<std::vector<VectorType>> D, R;
-    D = std::make_shared<std::vector<VectorType>>();
-    R = std::make_shared<std::vector<VectorType>>();
-
-    VectorType d, d_tilde, d_tilde_old, r, r_old;
-    structure->pde_operator->initialize_dof_vector(d);
-    structure->pde_operator->initialize_dof_vector(d_tilde);
-    structure->pde_operator->initialize_dof_vector(d_tilde_old);
-    structure->pde_operator->initialize_dof_vector(r);
-    structure->pde_operator->initialize_dof_vector(r_old);
+    // interface vectors
+    VectorType d_interface, d_tilde_interface, d_tilde_old, r, r_old;
+    initialize_interface_vector(d_interface);
+    initialize_interface_vector(d_tilde_interface);
+    initialize_interface_vector(d_tilde_old);
+    initialize_interface_vector(r);
+    initialize_interface_vector(r_old);
 
     unsigned int const q = parameters.reused_time_steps;
     unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
 
+    // remove the columns of time steps that are not reused anymore
+    least_squares_model.remove_columns_with_tag_below(n > q ? n - q : 0);
+
     bool converged = false;
     while(not(converged) and k < parameters.partitioned_iter_max)
     {
       print_solver_info_header(k);
 
-      if(k == 0)
-        structure->time_integrator->extrapolate_displacement_to_np(d);
-      else
-        d = structure->time_integrator->get_displacement_np();
-
-      apply_dirichlet_neumann_scheme(d_tilde, d, k);
+      evaluate_fixed_point_map(d_tilde_interface, d_interface, k, apply_coupling_scheme);
 
       // compute residual and check convergence
-      r = d_tilde;
-      r.add(-1.0, d);
+      r = d_tilde_interface;
+      r.add(-1.0, d_interface);
       converged = check_convergence(r);
 
       // relaxation
@@ -275,67 +564,34 @@ PartitionedSolver<dim, Number>::solve(
         dealii::Timer timer;
         timer.restart();
 
-        if(k == 0 and (q == 0 or n == 0))
-        {
-          d.add(parameters.omega_init, r);
-        }
-        else
+        if(k >= 1)
         {
-          if(k >= 1)
-          {
-            // append D, R matrices
-            VectorType delta_d_tilde = d_tilde;
-            delta_d_tilde.add(-1.0, d_tilde_old);
-            D->push_back(delta_d_tilde);
+          // insert new columns into the least-squares model
+          VectorType delta_d_tilde = d_tilde_interface;
+          delta_d_tilde.add(-1.0, d_tilde_old);
 
-            VectorType delta_r = r;
-            delta_r.add(-1.0, r_old);
-            R->push_back(delta_r);
-          }
-
-          // fill vectors (including reuse)
-          std::vector<VectorType> Q = *R;
-          for(auto R_q : R_history)
-            for(auto delta_r : *R_q)
-              Q.push_back(delta_r);
-          std::vector<VectorType> D_all = *D;
-          for(auto D_q : D_history)
-            for(auto delta_d : *D_q)
-              D_all.push_back(delta_d);
-
-          AssertThrow(D_all.size() == Q.size(),
-                      dealii::ExcMessage("D, Q vectors must have same size."));
-
-          unsigned int const k_all = Q.size();
-          if(k_all >= 1)
-          {
-            // compute QR-decomposition
-            Matrix<Number> U(k_all);
-            compute_QR_decomposition(Q, U);
-
-            std::vector<Number> rhs(k_all, 0.0);
-            for(unsigned int i = 0; i < k_all; ++i)
-              rhs[i] = -Number(Q[i] * r);
+          VectorType delta_r = r;
+          delta_r.add(-1.0, r_old);
 
-            // alpha = U^{-1} rhs
-            std::vector<Number> alpha(k_all, 0.0);
-            backward_substitution(U, alpha, rhs);
+          least_squares_model.insert(std::move(delta_r), std::move(delta_d_tilde), n);
+        }
 
-            // d_{k+1} = d_tilde_{k} + delta d_tilde
-            d = d_tilde;
-            for(unsigned int i = 0; i < k_all; ++i)
-              d.add(alpha[i], D_all[i]);
-          }
-          else // despite reuse, the vectors might be empty
-          {
-            d.add(parameters.omega_init, r);
-          }
+        // the model is empty in the first iteration without reuse of previous time steps
+        if(least_squares_model.size() == 0)
+        {
+          d_interface.add(parameters.omega_init, r);
+        }
+        else
+        {
+          // d_{k+1} = d_tilde_{k} + delta d_tilde
+          d_interface = d_tilde_interface;
+          least_squares_model.apply(d_interface, r);
         }
 
-        d_tilde_old = d_tilde;
+        d_tilde_old = d_tilde_interface;
         r_old       = r;
 
-        structure->time_integrator->set_displacement(d);
+        set_iterate(d_interface);
 
         timer_tree->insert({"IQN-ILS"}, timer.wall_time());
       }
@@ -343,19 +599,6 @@ PartitionedSolver<dim, Number>::solve(
       // increment counter of partitioned iteration
       ++k;
     }
-
-    dealii::Timer timer;
-    timer.restart();
-
-    // Update history
-    D_history.push_back(D);
-    R_history.push_back(R);
-    if(D_history.size() > q)
-      D_history.erase(D_history.begin());
-    if(R_history.size() > q)
-      R_history.erase(R_history.begin());
-
-    timer_tree->insert({"IQN-ILS"}, timer.wall_time());
   }
   else if(parameters.acceleration_method == AccelerationMethod::IQN_IMVLS)
   {
@@ -365,14 +608,15 @@ PartitionedSolver<dim, Number>::solve(
 
     std::vector<VectorType> B;
 
-    VectorType d, d_tilde, d_tilde_old, r, r_old, b, b_old;
-    structure->pde_operator->initialize_dof_vector(d);
-    structure->pde_operator->initialize_dof_vector(d_tilde);
-    structure->pde_operator->initialize_dof_vector(d_tilde_old);
-    structure->pde_operator->initialize_dof_vector(r);
-    structure->pde_operator->initialize_dof_vector(r_old);
-    structure->pde_operator->initialize_dof_vector(b);
-    structure->pde_operator->initialize_dof_vector(b_old);
+    // interface vectors
+    VectorType d_interface, d_tilde_interface, d_tilde_old, r, r_old, b, b_old;
+    initialize_interface_vector(d_interface);
+    initialize_interface_vector(d_tilde_interface);
+    initialize_interface_vector(d_tilde_old);
+    initialize_interface_vector(r);
+    initialize_interface_vector(r_old);
+    initialize_interface_vector(b);
+    initialize_interface_vector(b_old);
 
     std::shared_ptr<Matrix<Number>> U;
     std::vector<VectorType>         Q;
@@ -385,16 +629,11 @@ PartitionedSolver<dim, Number>::solve(
     {
       print_solver_info_header(k);
 
-      if(k == 0)
-        structure->time_integrator->extrapolate_displacement_to_np(d);
-      else
-        d = structure->time_integrator->get_displacement_np();
-
-      apply_dirichlet_neumann_scheme(d_tilde, d, k);
+      evaluate_fixed_point_map(d_tilde_interface, d_interface, k, apply_coupling_scheme);
 
       // compute residual and check convergence
-      r = d_tilde;
-      r.add(-1.0, d);
+      r = d_tilde_interface;
+      r.add(-1.0, d_interface);
       converged = check_convergence(r);
 
       // relaxation
@@ -408,17 +647,17 @@ PartitionedSolver<dim, Number>::solve(
 
         if(k == 0 and (q == 0 or n == 0))
         {
-          d.add(parameters.omega_init, r);
+          d_interface.add(parameters.omega_init, r);
         }
         else
         {
-          d = d_tilde;
-          d.add(-1.0, b);
+          d_interface = d_tilde_interface;
+          d_interface.add(-1.0, b);
 
           if(k >= 1)
           {
             // append D, R, B matrices
-            VectorType delta_d_tilde = d_tilde;
+            VectorType delta_d_tilde = d_tilde_interface;
             delta_d_tilde.add(-1.0, d_tilde_old);
             D->push_back(delta_d_tilde);
 
@@ -431,10 +670,16 @@ PartitionedSolver<dim, Number>::solve(
             delta_b.add(-1.0, b);
             B.push_back(delta_b);
 
-            // compute QR-decomposition
-            U = std::make_shared<Matrix<Number>>(k);
-            Q = *R;
-            compute_QR_decomposition(Q, *U);
+            // extend the QR-decomposition by the new column, the previous columns remain
+            // unchanged
+            std::shared_ptr<Matrix<Number>> U_new = std::make_shared<Matrix<Number>>(k);
+            for(unsigned int i = 0; i + 1 < k; ++i)
+              for(unsigned int j = i; j + 1 < k; ++j)
+                U_new->set(U->get(i, j), i, j);
+            U = U_new;
+
+            Q.push_back(delta_r);
+            orthogonalize_column(Q, *U, k - 1);
 
             std::vector<Number> rhs(k, 0.0);
             for(unsigned int i = 0; i < k; ++i)
@@ -445,15 +690,15 @@ PartitionedSolver<dim, Number>::solve(
             backward_substitution(*U, alpha, rhs);
 
             for(unsigned int i = 0; i < k; ++i)
-              d.add(alpha[i], B[i]);
+              d_interface.add(alpha[i], B[i]);
           }
         }
 
-        d_tilde_old = d_tilde;
+        d_tilde_old = d_tilde_interface;
         r_old       = r;
         b_old       = b;
 
-        structure->time_integrator->set_displacement(d);
+        set_iterate(d_interface);
 
         timer_tree->insert({"IQN-IMVLS"}, timer.wall_time());
       }
@@ -22,6 +22,7 @@
 // ExaDG
 #include <exadg/fluid_structure_interaction/driver.h>
 #include <exadg/grid/marked_vertices.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_general_infos.h>
 
 namespace ExaDG
@@ -79,9 +80,16 @@ Driver<dim, Number>::setup()
 
   setup_interface_coupling();
 
-  partitioned_solver->setup(fluid, structure);
+  partitioned_solver->setup(
+    fluid,
+    structure,
+    application->structure->get_boundary_descriptor()->neumann_cached_bc,
+    application->fluid->get_boundary_descriptor()->velocity->dirichlet_cached_bc);
 
   timer_tree.insert({"FSI", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -126,6 +134,19 @@ Driver<dim, Number>::setup_interface_coupling()
         marked_vertices_structure,
         parameters.geometric_tolerance);
     }
+    else if(application->fluid->get_parameters().mesh_movement_type ==
+            IncNS::MeshMovementType::RadialBasisFunction)
+    {
+      structure_to_ale = std::make_shared<InterfaceCoupling<1, dim, Number>>();
+
+      std::shared_ptr<RBF::DeformedMapping<dim, Number>> rbf_grid_motion =
+        std::dynamic_pointer_cast<RBF::DeformedMapping<dim, Number>>(fluid->ale_mapping);
+      structure_to_ale->setup(rbf_grid_motion->get_container_interface_data(),
+                              structure->pde_operator->get_dof_handler(),
+                              *structure->mapping,
+                              marked_vertices_structure,
+                              parameters.geometric_tolerance);
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("not implemented."));
@@ -234,11 +255,20 @@ Driver<dim, Number>::coupling_structure_to_fluid(bool const extrapolate) const
 template<int dim, typename Number>
 void
 Driver<dim, Number>::coupling_fluid_to_structure(bool const end_of_time_step) const
+{
+  VectorType stress_fluid;
+  calculate_stress_fluid(stress_fluid, end_of_time_step);
+  coupling_fluid_to_structure(stress_fluid);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::calculate_stress_fluid(VectorType & stress_fluid,
+                                            bool const   end_of_time_step) const
 {
   dealii::Timer sub_timer;
   sub_timer.restart();
 
-  VectorType stress_fluid;
   fluid->pde_operator->initialize_vector_velocity(stress_fluid);
   // calculate fluid stress at fluid-structure interface
   if(end_of_time_step)
@@ -255,6 +285,17 @@ Driver<dim, Number>::coupling_fluid_to_structure(bool const end_of_time_step) co
   }
 
   stress_fluid *= -1.0;
+
+  timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::coupling_fluid_to_structure(VectorType const & stress_fluid) const
+{
+  dealii::Timer sub_timer;
+  sub_timer.restart();
+
   fluid_to_structure->update_data(stress_fluid);
 
   timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
@@ -286,6 +327,33 @@ Driver<dim, Number>::apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
   d_tilde = structure->time_integrator->get_displacement_np();
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::apply_parallel_scheme(VectorType &       d_tilde,
+                                           VectorType &       s_tilde,
+                                           VectorType const & d,
+                                           VectorType const & s,
+                                           unsigned int       iteration) const
+{
+  // fluid problem for the displacement d
+  coupling_structure_to_ale(d);
+
+  fluid->solve_ale();
+
+  coupling_structure_to_fluid(iteration == 0);
+
+  fluid->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
+
+  calculate_stress_fluid(s_tilde, /* end_of_time_step = */ true);
+
+  // structural problem for the stress s, which does not depend on the above fluid solve
+  coupling_fluid_to_structure(s);
+
+  structure->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
+
+  d_tilde = structure->time_integrator->get_displacement_np();
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve() const
@@ -297,7 +365,11 @@ Driver<dim, Number>::solve() const
   // compute initial acceleration for structural problem
   {
     // update stress boundary condition for solid at time t_n (not t_{n+1})
-    coupling_fluid_to_structure(/* end_of_time_step = */ false);
+    VectorType stress_fluid;
+    calculate_stress_fluid(stress_fluid, /* end_of_time_step = */ false);
+    coupling_fluid_to_structure(stress_fluid);
+    if(parameters.coupling_scheme == CouplingScheme::Jacobi)
+      partitioned_solver->set_initial_stress(stress_fluid);
     structure->time_integrator->compute_initial_acceleration(
       application->structure->get_parameters().restarted_simulation);
   }
@@ -310,11 +382,25 @@ Driver<dim, Number>::solve() const
     structure->time_integrator->advance_one_timestep_pre_solve(false);
 
     // solve (using strongly-coupled partitioned scheme)
-    auto const lambda_dirichlet_neumann =
-      [&](VectorType & d_tilde, VectorType const & d, unsigned int k) {
-        apply_dirichlet_neumann_scheme(d_tilde, d, k);
+    if(parameters.coupling_scheme == CouplingScheme::GaussSeidel)
+    {
+      auto const lambda_dirichlet_neumann =
+        [&](VectorType & d_tilde, VectorType const & d, unsigned int k) {
+          apply_dirichlet_neumann_scheme(d_tilde, d, k);
+        };
+      partitioned_solver->solve(lambda_dirichlet_neumann);
+    }
+    else
+    {
+      auto const lambda_parallel = [&](VectorType &       d_tilde,
+                                       VectorType &       s_tilde,
+                                       VectorType const & d,
+                                       VectorType const & s,
+                                       unsigned int       k) {
+        apply_parallel_scheme(d_tilde, s_tilde, d, s, k);
       };
-    partitioned_solver->solve(lambda_dirichlet_neumann);
+      partitioned_solver->solve_parallel(lambda_parallel);
+    }
 
     // post-solve
     fluid->time_integrator->advance_one_timestep_post_solve();
@@ -367,6 +453,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index DoFs =
     fluid->pde_operator->get_number_of_dofs() + structure->pde_operator->get_number_of_dofs();
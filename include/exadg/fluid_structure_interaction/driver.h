@@ -79,11 +79,28 @@ private:
   void
   coupling_fluid_to_structure(bool const end_of_time_step) const;
 
+  void
+  calculate_stress_fluid(VectorType & stress_fluid, bool const end_of_time_step) const;
+
+  void
+  coupling_fluid_to_structure(VectorType const & stress_fluid) const;
+
   void
   apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
                                  VectorType const & d,
                                  unsigned int       iteration) const;
 
+  /*
+   * Parallel coupling scheme: the fluid is solved for the displacement d and the structure for the
+   * fluid stress s, i.e., the two field solves do not depend on each other.
+   */
+  void
+  apply_parallel_scheme(VectorType &       d_tilde,
+                        VectorType &       s_tilde,
+                        VectorType const & d,
+                        VectorType const & s,
+                        unsigned int       iteration) const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
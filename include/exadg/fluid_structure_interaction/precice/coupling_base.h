@@ -105,8 +105,15 @@ public:
              std::string const &                                        data_name) = 0;
 
 
+  /**
+   * @brief read_block_data Reads the data from preCICE
+   *
+   * @param relative_read_time Time relative to the beginning of the current time step at which
+   *        the data is sampled for waveform iterations. Negative values read the data at the end
+   *        of the time window.
+   */
   virtual void
-  read_block_data(std::string const & data_name) const;
+  read_block_data(std::string const & data_name, double const relative_read_time) const;
 
   /**
    * @brief Queries data IDs from preCICE for the given read data name
@@ -245,7 +252,8 @@ CouplingBase<dim, data_dim, VectorizedArrayType>::process_coupling_mesh()
 
 template<int dim, int data_dim, typename VectorizedArrayType>
 void
-CouplingBase<dim, data_dim, VectorizedArrayType>::read_block_data(std::string const &) const
+CouplingBase<dim, data_dim, VectorizedArrayType>::read_block_data(std::string const &,
+                                                                  double const) const
 {
   AssertThrow(false, dealii::ExcNotImplemented());
 }
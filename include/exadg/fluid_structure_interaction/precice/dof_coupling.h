@@ -75,6 +75,8 @@ private:
   std::vector<int> coupling_nodes_ids;
   /// The deal.II associated IDs
   std::vector<std::array<dealii::types::global_dof_index, data_dim>> global_indices;
+  /// Buffer holding the data of all coupling nodes, passed to preCICE in a single call
+  std::vector<double> write_buffer;
 
   /// Indices related to the FEEvaluation (have a look at the initialization
   /// of the MatrixFree)
@@ -209,30 +211,31 @@ DoFCoupling<dim, data_dim, VectorizedArrayType>::write_data(
   Assert(write_data_id != -1, dealii::ExcNotInitialized());
   Assert(coupling_nodes_ids.size() > 0, dealii::ExcNotInitialized());
 
-  std::array<double, data_dim> write_data;
+  // Extract relevant elements from global vector
+  write_buffer.resize(data_dim * global_indices.size());
   for(std::size_t i = 0; i < global_indices.size(); ++i)
-  {
-    // Extract relevant elements from global vector
     for(unsigned int d = 0; d < data_dim; ++d)
-    {
-      auto const element = global_indices[i][d];
-      write_data[d]      = data_vector[element];
-    }
+      write_buffer[data_dim * i + d] = data_vector[global_indices[i][d]];
 
 #ifdef EXADG_WITH_PRECICE
-    // and pass them to preCICE
-    if constexpr(data_dim > 1)
-    {
-      this->precice->writeVectorData(write_data_id, coupling_nodes_ids[i], write_data.data());
-    }
-    else
-    {
-      this->precice->writeScalarData(write_data_id, coupling_nodes_ids[i], write_data[0]);
-    }
+  // and pass them to preCICE
+  if constexpr(data_dim > 1)
+  {
+    this->precice->writeBlockVectorData(write_data_id,
+                                        coupling_nodes_ids.size(),
+                                        coupling_nodes_ids.data(),
+                                        write_buffer.data());
+  }
+  else
+  {
+    this->precice->writeBlockScalarData(write_data_id,
+                                        coupling_nodes_ids.size(),
+                                        coupling_nodes_ids.data(),
+                                        write_buffer.data());
+  }
 #else
-    (void)write_data_id;
+  (void)write_data_id;
 #endif
-  }
 }
 
 
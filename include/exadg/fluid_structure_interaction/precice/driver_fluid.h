@@ -272,7 +272,8 @@ private:
   {
     // TODO: parametrize names
     this->precice->read_block_data(this->precice_parameters.ale_mesh_name,
-                                   this->precice_parameters.displacement_data_name);
+                                   this->precice_parameters.displacement_data_name,
+                                   fluid->time_integrator->get_time_step_size());
   }
 
   void
@@ -280,7 +281,8 @@ private:
   {
     // TODO: parametrize names
     this->precice->read_block_data(this->precice_parameters.read_mesh_name,
-                                   this->precice_parameters.velocity_data_name);
+                                   this->precice_parameters.velocity_data_name,
+                                   fluid->time_integrator->get_time_step_size());
   }
 
   void
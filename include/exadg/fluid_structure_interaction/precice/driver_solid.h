@@ -230,7 +230,8 @@ private:
   coupling_fluid_to_structure() const
   {
     this->precice->read_block_data(this->precice_parameters.read_mesh_name,
-                                   this->precice_parameters.stress_data_name);
+                                   this->precice_parameters.stress_data_name,
+                                   structure->time_integrator->get_time_step_size());
   }
 
   // the solver
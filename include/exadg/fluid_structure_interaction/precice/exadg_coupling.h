@@ -71,7 +71,7 @@ public:
              std::string const &                                        data_name) override;
 
   virtual void
-  read_block_data(std::string const & data_name) const override;
+  read_block_data(std::string const & data_name, double const relative_read_time) const override;
 
 private:
   /// Accessor for ExaDG data structures
@@ -151,7 +151,8 @@ ExaDGCoupling<dim, data_dim, VectorizedArrayType>::define_coupling_mesh()
 template<int dim, int data_dim, typename VectorizedArrayType>
 void
 ExaDGCoupling<dim, data_dim, VectorizedArrayType>::read_block_data(
-  std::string const & data_name) const
+  std::string const & data_name,
+  double const        relative_read_time) const
 {
   Assert(interface_data.get() != nullptr, dealii::ExcNotInitialized());
 
@@ -168,13 +169,22 @@ ExaDGCoupling<dim, data_dim, VectorizedArrayType>::read_block_data(
       auto const array_size     = array_solution.size();
 
       AssertIndexRange(start_index, coupling_nodes_ids.size());
+      // preCICE writes directly into the data structure used by the boundary conditions
 #ifdef EXADG_WITH_PRECICE
-      this->precice->readBlockVectorData(read_data_id,
-                                         array_size,
-                                         &coupling_nodes_ids[start_index],
-                                         &array_solution[0][0]);
+      if(relative_read_time >= 0.0)
+        this->precice->readBlockVectorData(read_data_id,
+                                           array_size,
+                                           &coupling_nodes_ids[start_index],
+                                           relative_read_time,
+                                           &array_solution[0][0]);
+      else
+        this->precice->readBlockVectorData(read_data_id,
+                                           array_size,
+                                           &coupling_nodes_ids[start_index],
+                                           &array_solution[0][0]);
 #else
       (void)read_data_id;
+      (void)relative_read_time;
 #endif
       start_index += array_size;
     }
@@ -163,8 +163,17 @@ public:
              VectorType const &  write_data,
              double const        computed_timestep_length);
 
+  /**
+   * @brief      Reads the data of the given mesh
+   *
+   * @param[in]  time_step_size Time step size of the current time step. For waveform iterations,
+   *             the data is read at the end of the current time step, which may differ from the
+   *             end of the time window if the participants use different time step sizes.
+   */
   void
-  read_block_data(std::string const & mesh_name, const std::string & data_name) const;
+  read_block_data(std::string const & mesh_name,
+                  std::string const & data_name,
+                  double const        time_step_size) const;
 
   /**
    * @brief is_coupling_ongoing Calls the preCICE API function isCouplingOnGoing
@@ -200,6 +209,8 @@ private:
 
   // Container to store time dependent data in case of an implicit coupling
   std::vector<VectorType> old_state_data;
+
+  bool waveform_iteration;
 };
 
 
@@ -208,7 +219,7 @@ template<int dim, int data_dim, typename VectorType, typename VectorizedArrayTyp
 template<typename ParameterClass>
 Adapter<dim, data_dim, VectorType, VectorizedArrayType>::Adapter(ParameterClass const & parameters,
                                                                  MPI_Comm               mpi_comm)
-
+  : waveform_iteration(parameters.waveform_iteration)
 {
 #ifdef EXADG_WITH_PRECICE
   precice =
@@ -391,9 +402,10 @@ template<int dim, int data_dim, typename VectorType, typename VectorizedArrayTyp
 void
 Adapter<dim, data_dim, VectorType, VectorizedArrayType>::read_block_data(
   std::string const & mesh_name,
-  std::string const & data_name) const
+  std::string const & data_name,
+  double const        time_step_size) const
 {
-  reader.at(mesh_name)->read_block_data(data_name);
+  reader.at(mesh_name)->read_block_data(data_name, waveform_iteration ? time_step_size : -1.0);
 }
 
 
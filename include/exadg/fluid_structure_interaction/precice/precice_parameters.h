@@ -54,6 +54,10 @@ struct ConfigurationParameters
   std::string displacement_data_name   = "default";
   std::string stress_data_name         = "default";
 
+  // read the data at the time of the evaluation within the time window (waveform iteration),
+  // which has to be combined with a waveform-order in the precice-config.xml file
+  bool waveform_iteration = false;
+
   WriteDataType write_data_type = WriteDataType::undefined;
 
   void
@@ -120,6 +124,11 @@ ConfigurationParameters::add_parameters(dealii::ParameterHandler & prm)
                       stress_data_name,
                       "Name of the Stress data in the precice-config.xml file",
                       dealii::Patterns::Anything());
+    prm.add_parameter("WaveformIteration",
+                      waveform_iteration,
+                      "Read data at the time of the evaluation within the time window "
+                      "(requires preCICE >= 2.4)",
+                      dealii::Patterns::Bool());
   }
   prm.leave_subsection();
 }
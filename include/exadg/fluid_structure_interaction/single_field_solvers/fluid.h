@@ -24,6 +24,7 @@
 
 // grid
 #include <exadg/grid/mapping_deformation_poisson.h>
+#include <exadg/grid/mapping_deformation_rbf.h>
 #include <exadg/grid/mapping_deformation_structure.h>
 
 // IncNS
@@ -133,6 +134,18 @@ SolverFluid<dim, Number>::setup(std::shared_ptr<FluidFSI::ApplicationBase<dim, N
       "ale_elasticity",
       mpi_comm);
   }
+  else if(application->get_parameters().mesh_movement_type ==
+          IncNS::MeshMovementType::RadialBasisFunction)
+  {
+    ale_mapping = std::make_shared<RBF::DeformedMapping<dim, Number>>(
+      grid,
+      mapping,
+      application->get_boundary_descriptor()->velocity->dirichlet_cached_bc,
+      application->get_parameters().mapping_degree,
+      application->get_parameters().rbf_band_width,
+      application->get_parameters().rbf_support_radius,
+      mpi_comm);
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("not implemented."));
@@ -25,6 +25,7 @@
 // Structure
 #include <exadg/structure/spatial_discretization/operator.h>
 #include <exadg/structure/time_integration/time_int_gen_alpha.h>
+#include <exadg/utilities/memory_report.h>
 
 // application
 #include <exadg/fluid_structure_interaction/user_interface/application_base.h>
@@ -51,6 +52,7 @@ public:
   // matrix-free
   std::shared_ptr<MatrixFreeData<dim, Number>>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free;
+  MemoryReport::Entry                              memory_matrix_free{MemoryCategory::MatrixFree};
 
   // spatial discretization
   std::shared_ptr<Structure::Operator<dim, Number>> pde_operator;
@@ -95,6 +97,8 @@ SolverStructure<dim, Number>::setup(
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
+  memory_matrix_free.set(matrix_free->memory_consumption());
+
   pde_operator->setup(matrix_free, matrix_free_data);
 
   // initialize postprocessor
@@ -317,6 +317,10 @@ public:
       ale_elasticity_field_functions = std::make_shared<Structure::FieldFunctions<dim>>();
       set_field_functions_ale_elasticity();
     }
+    else if(param.mesh_movement_type == IncNS::MeshMovementType::RadialBasisFunction)
+    {
+      // the grid motion is fully described by the fluid parameters and the interface
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("not implemented."));
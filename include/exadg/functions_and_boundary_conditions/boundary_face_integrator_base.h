@@ -45,14 +45,19 @@ public:
   {
     evaluation_time = time;
 
-    auto const boundary_id_new = matrix_free.get_boundary_id(face);
+    set_boundary_id(matrix_free.get_boundary_id(face));
+  }
 
-    // only update boundary_type if needed to avoid an unnecessary search in boundary_descriptor
-    if(boundary_id_new != boundary_id)
-    {
-      boundary_id   = boundary_id_new;
-      boundary_type = boundary_descriptor.get_boundary_type(boundary_id);
-    }
+  /*
+   * Same as above for cell-based face loops, where the face is identified by the cell batch and the
+   * local face number. All cells of the cell batch need to have the same boundary ID on this face.
+   */
+  void
+  reinit(unsigned int const cell, unsigned int const face, Number const time)
+  {
+    evaluation_time = time;
+
+    set_boundary_id(matrix_free.get_faces_by_cells_boundary_id(cell, face)[0]);
   }
 
   // A corresponding function has to be implemented in the deriving class.
@@ -71,6 +76,17 @@ protected:
   {
   }
 
+  void
+  set_boundary_id(dealii::types::boundary_id const boundary_id_new)
+  {
+    // only update boundary_type if needed to avoid an unnecessary search in boundary_descriptor
+    if(boundary_id_new != boundary_id)
+    {
+      boundary_id   = boundary_id_new;
+      boundary_type = boundary_descriptor.get_boundary_type(boundary_id);
+    }
+  }
+
   dealii::MatrixFree<dim, Number> const & matrix_free;
   BoundaryDescriptorType const &          boundary_descriptor;
 
@@ -0,0 +1,238 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_BOUNDARY_FUNCTION_CACHE_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_BOUNDARY_FUNCTION_CACHE_H_
+
+// C/C++
+#include <atomic>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+/**
+ * Table of the values of boundary functions at the quadrature points of the boundary faces of a
+ * given set of boundary IDs, for the face batches of a MatrixFree object and a set of quadrature
+ * rules. The values are computed once per time, namely at the first access with a new time, and
+ * are read from the table in all further evaluations at the same time. This avoids repeated
+ * evaluations of the (virtual, non-vectorized) dealii::Function objects in all operators needing
+ * the boundary data as well as in repeated operator evaluations within a time step or stage.
+ *
+ * The boundary functions may only depend on space and time. The table is not updated when the
+ * mapping changes (moving meshes), and the face indices refer to face batches, i.e., the table
+ * cannot be used for cell-based face loops.
+ */
+template<int rank, int dim, typename Number>
+class BoundaryFunctionCache
+{
+public:
+  typedef dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> value_type;
+
+  typedef std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> FunctionMap;
+
+  BoundaryFunctionCache() : matrix_free(nullptr), n_inner_face_batches(0)
+  {
+  }
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        unsigned int const                      dof_index,
+        std::vector<unsigned int> const &       quad_indices,
+        FunctionMap const &                     functions)
+  {
+    matrix_free          = &matrix_free_in;
+    n_inner_face_batches = matrix_free->n_inner_face_batches();
+
+    tables.clear();
+    for(unsigned int const quad_index : quad_indices)
+    {
+      if(quad_index >= tables.size())
+        tables.resize(quad_index + 1);
+
+      if(tables[quad_index])
+        continue;
+
+      tables[quad_index] = std::make_unique<Table>();
+      Table & table      = *tables[quad_index];
+
+      table.offsets.resize(matrix_free->n_boundary_face_batches(),
+                           dealii::numbers::invalid_unsigned_int);
+
+      FaceIntegrator<dim, 1, Number> integrator(*matrix_free, true, dof_index, quad_index);
+      for(unsigned int face = n_inner_face_batches;
+          face < n_inner_face_batches + matrix_free->n_boundary_face_batches();
+          ++face)
+      {
+        auto const function = functions.find(matrix_free->get_boundary_id(face));
+        if(function == functions.end())
+          continue;
+
+        integrator.reinit(face);
+
+        table.offsets[face - n_inner_face_batches] = table.q_points.size();
+        table.faces.push_back(face);
+        table.functions.push_back(function->second);
+        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+          table.q_points.push_back(integrator.quadrature_point(q));
+      }
+
+      table.n_q_points = integrator.n_q_points;
+      table.values.resize(table.q_points.size());
+    }
+  }
+
+  /*
+   * Returns true if the values for the face batch and quadrature rule of the integrator are
+   * available from the table.
+   */
+  template<typename Integrator>
+  bool
+  is_cached(Integrator const & integrator) const
+  {
+    unsigned int const quad_index = integrator.get_quadrature_index();
+    unsigned int const face       = integrator.get_current_cell_index();
+
+    return static_cast<void const *>(&integrator.get_matrix_free()) ==
+             static_cast<void const *>(matrix_free) and
+           quad_index < tables.size() and tables[quad_index] and face >= n_inner_face_batches and
+           tables[quad_index]->offsets[face - n_inner_face_batches] !=
+             dealii::numbers::invalid_unsigned_int;
+  }
+
+  /*
+   * Value of the boundary function at quadrature point q of the face batch, computing the
+   * values of the table first if the table does not hold the values for the given time.
+   */
+  value_type const &
+  get_value(unsigned int const face,
+            unsigned int const q,
+            unsigned int const quad_index,
+            double const       time) const
+  {
+    Table const & table = *tables[quad_index];
+
+    if(table.time.load(std::memory_order_acquire) != time)
+      update(table, time);
+
+    return table.values[table.offsets[face - n_inner_face_batches] + q];
+  }
+
+private:
+  struct Table
+  {
+    Table() : n_q_points(0), time(std::numeric_limits<double>::quiet_NaN())
+    {
+    }
+
+    // start index of the quadrature points of a boundary face batch, invalid if not cached
+    std::vector<unsigned int> offsets;
+
+    unsigned int n_q_points;
+
+    std::vector<unsigned int>                                          faces;
+    std::vector<std::shared_ptr<dealii::Function<dim>>>                functions;
+    std::vector<dealii::Point<dim, dealii::VectorizedArray<Number>>>   q_points;
+    mutable std::vector<value_type>                                    values;
+
+    // time of the values, not a number before the first evaluation
+    mutable std::atomic<double> time;
+  };
+
+  /*
+   * The values are computed by the first thread accessing the table with a new time, while the
+   * other threads wait.
+   */
+  void
+  update(Table const & table, double const time) const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(table.time.load(std::memory_order_relaxed) == time)
+      return;
+
+    for(unsigned int i = 0; i < table.faces.size(); ++i)
+    {
+      unsigned int const offset = table.offsets[table.faces[i] - n_inner_face_batches];
+      for(unsigned int q = 0; q < table.n_q_points; ++q)
+        table.values[offset + q] =
+          FunctionEvaluator<rank, dim, Number>::value(*table.functions[i],
+                                                      table.q_points[offset + q],
+                                                      time);
+    }
+
+    table.time.store(time, std::memory_order_release);
+  }
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int n_inner_face_batches;
+
+  // tables indexed by the quadrature index, empty for quadrature rules that are not cached
+  std::vector<std::unique_ptr<Table>> tables;
+
+  mutable std::mutex mutex;
+};
+
+/*
+ * Evaluates the boundary function at quadrature point q of the current face of the integrator,
+ * reading the value from the cache if available. The cache is only used for integrators in
+ * double precision, e.g., not on the (single precision) multigrid levels.
+ */
+template<int rank, int dim, typename Number, int n_components>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+  evaluate_boundary_function(
+    std::shared_ptr<BoundaryFunctionCache<rank, dim, double> const> const & cache,
+    dealii::Function<dim> &                                                 function,
+    FaceIntegrator<dim, n_components, Number> const &                       integrator,
+    unsigned int const                                                      q,
+    double const                                                            time)
+{
+  if constexpr(std::is_same_v<Number, double>)
+  {
+    if(cache and cache->is_cached(integrator))
+      return cache->get_value(integrator.get_current_cell_index(),
+                              q,
+                              integrator.get_quadrature_index(),
+                              time);
+  }
+
+  return dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(
+    FunctionEvaluator<rank, dim, Number>::value(function, integrator.quadrature_point(q), time));
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_BOUNDARY_FUNCTION_CACHE_H_ */
@@ -30,6 +30,7 @@
 
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
 #include <exadg/functions_and_boundary_conditions/function_with_normal.h>
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
 
 #include <memory>
 
@@ -153,6 +154,9 @@ struct FunctionEvaluator<0, dim, Number>
     value(dealii::Function<dim> const &                               function,
           dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
   {
+    if(auto const vectorized = dynamic_cast<VectorizedFunctionBase<dim> const *>(&function))
+      return vectorized->vectorized_value(q_points, 0);
+
     dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
 
     for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
@@ -204,6 +208,14 @@ struct FunctionEvaluator<1, dim, Number>
   {
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
 
+    if(auto const vectorized = dynamic_cast<VectorizedFunctionBase<dim> const *>(&function))
+    {
+      for(unsigned int d = 0; d < dim; ++d)
+        value[d] = vectorized->vectorized_value(q_points, d);
+
+      return value;
+    }
+
     for(unsigned int d = 0; d < dim; ++d)
     {
       for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
@@ -302,6 +314,17 @@ struct FunctionEvaluator<2, dim, Number>
   {
     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> value;
 
+    if(auto const vectorized = dynamic_cast<VectorizedFunctionBase<dim> const *>(&function))
+    {
+      for(unsigned int d1 = 0; d1 < dim; ++d1)
+        for(unsigned int d2 = 0; d2 < dim; ++d2)
+          value[d1][d2] = vectorized->vectorized_value(
+            q_points,
+            dealii::Tensor<2, dim>::component_to_unrolled_index(dealii::TableIndices<2>(d1, d2)));
+
+      return value;
+    }
+
     for(unsigned int d1 = 0; d1 < dim; ++d1)
     {
       for(unsigned int d2 = 0; d2 < dim; ++d2)
@@ -368,6 +391,18 @@ struct FunctionEvaluator<2, dim, Number>
   {
     dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>> value;
 
+    if(auto const vectorized = dynamic_cast<VectorizedFunctionBase<dim> const *>(&function))
+    {
+      for(unsigned int d1 = 0; d1 < dim; ++d1)
+        for(unsigned int d2 = d1; d2 < dim; ++d2)
+          value[d1][d2] = vectorized->vectorized_value(
+            q_points,
+            dealii::SymmetricTensor<2, dim>::component_to_unrolled_index(
+              dealii::TableIndices<2>(d1, d2)));
+
+      return value;
+    }
+
     for(unsigned int d1 = 0; d1 < dim; ++d1)
     {
       for(unsigned int d2 = d1; d2 < dim; ++d2)
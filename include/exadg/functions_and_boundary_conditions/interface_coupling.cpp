@@ -19,6 +19,13 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <algorithm>
+#include <limits>
+
+// deal.II
+#include <deal.II/base/bounding_box.h>
+
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/interface_coupling.h>
 #include <exadg/postprocessor/write_output.h>
@@ -26,7 +33,8 @@
 namespace ExaDG
 {
 template<int rank, int dim, typename Number>
-InterfaceCoupling<rank, dim, Number>::InterfaceCoupling() : dof_handler_src(nullptr)
+InterfaceCoupling<rank, dim, Number>::InterfaceCoupling()
+  : dof_handler_src(nullptr), tolerance(0.0)
 {
 }
 
@@ -49,21 +57,131 @@ InterfaceCoupling<rank, dim, Number>::setup(
                 dealii::ExcMessage("Vector marked_vertices_src_ has invalid size."));
   }
 
-  interface_data_dst = interface_data_dst_;
-  dof_handler_src    = &dof_handler_src_;
+  interface_data_dst  = interface_data_dst_;
+  dof_handler_src     = &dof_handler_src_;
+  marked_vertices_src = marked_vertices_src_;
+  tolerance           = tolerance_;
+
+  for(auto quad_index : interface_data_dst->get_quad_indices())
+    map_reference_points[quad_index] = interface_data_dst->get_array_q_points(quad_index);
+
+  reinit_evaluators(mapping_src_, marked_vertices_src);
+}
+
+template<int rank, int dim, typename Number>
+void
+InterfaceCoupling<rank, dim, Number>::update_search(
+  dealii::Mapping<dim> const &                                          mapping_src_,
+  std::function<dealii::Point<dim>(dealii::Point<dim> const &)> const & transformation_dst_)
+{
+  AssertThrow(interface_data_dst.get(),
+              dealii::ExcMessage("InterfaceCoupling::setup() has to be called first."));
+
+  if(transformation_dst_)
+  {
+    for(auto quad_index : interface_data_dst->get_quad_indices())
+    {
+      auto &       points           = interface_data_dst->get_array_q_points(quad_index);
+      auto const & reference_points = map_reference_points[quad_index];
+
+      for(unsigned int i = 0; i < points.size(); ++i)
+        points[i] = transformation_dst_(reference_points[i]);
+    }
+  }
+
+  reinit_evaluators(mapping_src_, get_marked_vertices_in_bounding_box(mapping_src_));
+}
+
+template<int rank, int dim, typename Number>
+std::vector<bool>
+InterfaceCoupling<rank, dim, Number>::get_marked_vertices_in_bounding_box(
+  dealii::Mapping<dim> const & mapping_src) const
+{
+  MPI_Comm const mpi_comm = dof_handler_src->get_communicator();
+
+  // bounding box of the points of all processes, enlarged by the tolerance of the search
+  dealii::Point<dim> lower, upper;
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    lower[d] = std::numeric_limits<double>::max();
+    upper[d] = std::numeric_limits<double>::lowest();
+  }
+
+  for(auto quad_index : interface_data_dst->get_quad_indices())
+  {
+    for(auto const & point : interface_data_dst->get_array_q_points(quad_index))
+    {
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        lower[d] = std::min(lower[d], point[d]);
+        upper[d] = std::max(upper[d], point[d]);
+      }
+    }
+  }
+
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    lower[d] = dealii::Utilities::MPI::min(lower[d], mpi_comm) - tolerance;
+    upper[d] = dealii::Utilities::MPI::max(upper[d], mpi_comm) + tolerance;
+  }
+
+  dealii::BoundingBox<dim> const bounding_box(std::make_pair(lower, upper));
+
+  // mark the vertices of all cells of the src-side intersecting the bounding box, in addition to
+  // the restriction by the marked vertices passed to setup()
+  auto const & triangulation = dof_handler_src->get_triangulation();
+
+  std::vector<bool> marked_vertices(triangulation.n_vertices(), false);
+
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_artificial())
+      continue;
+
+    if(mapping_src.get_bounding_box(cell).get_neighbor_type(bounding_box) ==
+       dealii::NeighborType::not_neighbors)
+      continue;
+
+    for(auto const & v : cell->vertex_indices())
+    {
+      unsigned int const index = cell->vertex_index(v);
+      if(marked_vertices_src.empty() or marked_vertices_src[index])
+        marked_vertices[index] = true;
+    }
+  }
+
+  // see get_marked_vertices_via_boundary_ids(): fall back to an unrestricted search on processes
+  // without marked vertices
+  if(std::none_of(marked_vertices.begin(), marked_vertices.end(), [](bool const marked) {
+       return marked;
+     }))
+  {
+    marked_vertices.clear();
+  }
+
+  return marked_vertices;
+}
+
+template<int rank, int dim, typename Number>
+void
+InterfaceCoupling<rank, dim, Number>::reinit_evaluators(
+  dealii::Mapping<dim> const & mapping_src_,
+  std::vector<bool> const &    marked_vertices_src_)
+{
+  map_evaluator.clear();
 
   for(auto quad_index : interface_data_dst->get_quad_indices())
   {
     // exchange quadrature points with their owners
     map_evaluator.emplace(quad_index,
                           std::make_unique<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(
-                            tolerance_, false, 0, [marked_vertices_src_]() {
+                            tolerance, false, 0, [marked_vertices_src_]() {
                               return marked_vertices_src_;
                             }));
 
     auto const * points = &interface_data_dst->get_array_q_points(quad_index);
 
-    map_evaluator[quad_index]->reinit(*points, dof_handler_src_.get_triangulation(), mapping_src_);
+    map_evaluator[quad_index]->reinit(*points, dof_handler_src->get_triangulation(), mapping_src_);
 
     if(not map_evaluator[quad_index]->all_points_found())
     {
@@ -97,7 +215,7 @@ InterfaceCoupling<rank, dim, Number>::setup(
         points_not_found, "./", file_name, 0, dof_handler_src->get_communicator());
 
       AssertThrow(map_evaluator[quad_index]->all_points_found(),
-                  dealii::ExcMessage(std::string("Setup of InterfaceCoupling was not successful: " +
+                  dealii::ExcMessage(std::string("Search of points in InterfaceCoupling failed: " +
                                                  std::to_string(n_points_not_found) +
                                                  " points have not been found.")));
     }
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_FUNCTIONALITIES_INTERFACE_COUPLING_H_
 #define INCLUDE_FUNCTIONALITIES_INTERFACE_COUPLING_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/numerics/vector_tools.h>
 
@@ -47,6 +50,12 @@ public:
   /**
    * setup() function.
    *
+   * The search of the points of the dst-side on the src-side is performed only once in this
+   * function, and the resulting communication pattern is reused for all calls of update_data().
+   * The points are defined in the reference configuration of the dst-side and are searched with
+   * the mapping of the src-side that is passed to this function, i.e., the search remains valid
+   * as long as both sides move consistently and does not need to be repeated in every time step.
+   *
    * The aim of @param marked_vertices_src_ is to make the search of points on the src side
    * computationally more efficient. If no useful information can be provided for this parameter, an
    * empty vector has to be passed to this function.
@@ -61,10 +70,33 @@ public:
         std::vector<bool> const &                                  marked_vertices_src_,
         double const                                               tolerance_);
 
+  /**
+   * Repeats the search of the dst-points on the src-side after one of the grids has moved as a
+   * rigid body relative to the other one, i.e., in situations where the search performed in setup()
+   * does no longer hold. @param mapping_src_ describes the current configuration of the src-side.
+   * If the dst-side has moved, @param transformation_dst_ maps the points in the configuration used
+   * in setup() to their current position, otherwise an empty function has to be passed.
+   *
+   * The search is restricted to the cells of the src-side that the bounding box of the points of
+   * all processes intersects. Since the two grids only overlap in a small region, this makes the
+   * update considerably cheaper than a new setup.
+   */
+  void
+  update_search(
+    dealii::Mapping<dim> const &                                          mapping_src_,
+    std::function<dealii::Point<dim>(dealii::Point<dim> const &)> const & transformation_dst_);
+
   void
   update_data(VectorType const & dof_vector_src);
 
 private:
+  void
+  reinit_evaluators(dealii::Mapping<dim> const & mapping_src,
+                    std::vector<bool> const &    marked_vertices);
+
+  std::vector<bool>
+  get_marked_vertices_in_bounding_box(dealii::Mapping<dim> const & mapping_src) const;
+
   /*
    * dst-side
    */
@@ -80,6 +112,15 @@ private:
    * src-side
    */
   dealii::DoFHandler<dim> const * dof_handler_src;
+
+  std::vector<bool> marked_vertices_src;
+
+  double tolerance;
+
+  /*
+   * Points of the dst-side in the configuration used in setup(), needed by update_search().
+   */
+  std::map<quad_index, std::vector<dealii::Point<dim>>> map_reference_points;
 };
 
 } // namespace ExaDG
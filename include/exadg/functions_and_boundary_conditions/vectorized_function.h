@@ -0,0 +1,121 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_VECTORIZED_FUNCTION_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_VECTORIZED_FUNCTION_H_
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+/*
+ * Extension of dealii::Function by the evaluation of a function in all lanes of a point of type
+ * dealii::Point<dim, dealii::VectorizedArray<Number>> at once. FunctionEvaluator, i.e., the
+ * evaluation of analytical boundary conditions and right-hand sides in the matrix-free kernels of
+ * all modules, uses this interface for functions derived from this class. All other functions
+ * are evaluated lane by lane via dealii::Function::value(), which requires one virtual function
+ * call per lane and component.
+ */
+template<int dim>
+class VectorizedFunctionBase : public dealii::Function<dim>
+{
+public:
+  template<typename Number>
+  using VectorizedPoint = dealii::Point<dim, dealii::VectorizedArray<Number>>;
+
+  VectorizedFunctionBase(unsigned int const n_components = 1, double const time = 0.0)
+    : dealii::Function<dim>(n_components, time)
+  {
+  }
+
+  virtual ~VectorizedFunctionBase()
+  {
+  }
+
+  virtual dealii::VectorizedArray<float>
+  vectorized_value(VectorizedPoint<float> const & p, unsigned int const component) const = 0;
+
+  virtual dealii::VectorizedArray<double>
+  vectorized_value(VectorizedPoint<double> const & p, unsigned int const component) const = 0;
+};
+
+/*
+ * Implements both the scalar function dealii::Function::value() and the vectorized evaluation by
+ * a single function template of the derived class (curiously recurring template pattern), which
+ * has to be written in terms of operations available for double and dealii::VectorizedArray, e.g.
+ *
+ *   template<int dim>
+ *   class Solution : public VectorizedFunction<dim, Solution<dim>>
+ *   {
+ *   public:
+ *     template<typename T>
+ *     T
+ *     evaluate(dealii::Point<dim, T> const & p, unsigned int const component) const
+ *     {
+ *       return std::sin(p[0]) * std::exp(-this->get_time());
+ *     }
+ *   };
+ */
+template<int dim, typename Derived>
+class VectorizedFunction : public VectorizedFunctionBase<dim>
+{
+public:
+  template<typename Number>
+  using VectorizedPoint = typename VectorizedFunctionBase<dim>::template VectorizedPoint<Number>;
+
+  VectorizedFunction(unsigned int const n_components = 1, double const time = 0.0)
+    : VectorizedFunctionBase<dim>(n_components, time)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    return derived().evaluate(p, component);
+  }
+
+  dealii::VectorizedArray<float>
+  vectorized_value(VectorizedPoint<float> const & p, unsigned int const component) const final
+  {
+    return derived().evaluate(p, component);
+  }
+
+  dealii::VectorizedArray<double>
+  vectorized_value(VectorizedPoint<double> const & p, unsigned int const component) const final
+  {
+    return derived().evaluate(p, component);
+  }
+
+private:
+  Derived const &
+  derived() const
+  {
+    return static_cast<Derived const &>(*this);
+  }
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_VECTORIZED_FUNCTION_H_ */
@@ -22,11 +22,45 @@
 #ifndef INCLUDE_EXADG_GRID_BALANCED_GRANULARITY_PARTITION_POLICY_H_
 #define INCLUDE_EXADG_GRID_BALANCED_GRANULARITY_PARTITION_POLICY_H_
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+
 // deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
 #include <deal.II/distributed/fully_distributed_tria.h>
 
 namespace ExaDG
 {
+/**
+ * Estimates a grain size for BalancedGranularityPartitionPolicy on the given machine: the latency
+ * of a small message is measured by repeated MPI_Allreduce calls, and the grain size is chosen
+ * such that the work of a coarse-level operator application per process, given by the number of
+ * cells times @p cell_cost (in seconds), is ten times the latency. Hence, the coarse levels remain
+ * compute-bound rather than latency-bound. The result is the same on all processes.
+ */
+inline unsigned int
+estimate_grain_size(MPI_Comm const & mpi_comm, double const cell_cost)
+{
+  AssertThrow(cell_cost > 0.0, dealii::ExcMessage("cell_cost has to be larger than zero."));
+
+  unsigned int const n_warmup      = 5;
+  unsigned int const n_repetitions = 50;
+
+  double value = 1.0;
+  for(unsigned int i = 0; i < n_warmup; ++i)
+    value = dealii::Utilities::MPI::sum(value, mpi_comm) / value;
+
+  dealii::Timer timer;
+  timer.restart();
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    value = dealii::Utilities::MPI::sum(value, mpi_comm) / value;
+  double const latency = dealii::Utilities::MPI::max(timer.wall_time() / n_repetitions, mpi_comm);
+
+  return std::max(1u, static_cast<unsigned int>(std::ceil(10.0 * latency / cell_cost)));
+}
+
 /**
  * A class to use for the deal.II coarsening functionality, where we try to
  * balance the mesh coarsening with a minimum granularity and the number of
@@ -37,9 +71,23 @@ class BalancedGranularityPartitionPolicy
   : public dealii::RepartitioningPolicyTools::Base<dim, spacedim>
 {
 public:
-  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes)
-    : n_mpi_processes_per_level{n_mpi_processes}
+  /**
+   * The coarse levels are agglomerated onto fewer processes such that each process owns at least
+   * @p grain_size cells. In order to limit the number of messages sent to an individual process
+   * in the transfer between two levels, the number of cells per process grows at most by the
+   * factor @p max_shrink_factor from one level to the next coarser one. Processes without cells
+   * on a coarse level have no work on that level.
+   */
+  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes,
+                                     unsigned int const grain_size        = 200,
+                                     unsigned int const max_shrink_factor = 8)
+    : n_mpi_processes_per_level{n_mpi_processes},
+      grain_size(grain_size),
+      max_shrink_factor(max_shrink_factor)
   {
+    AssertThrow(grain_size > 0, dealii::ExcMessage("grain_size has to be larger than zero."));
+    AssertThrow(max_shrink_factor > 0,
+                dealii::ExcMessage("max_shrink_factor has to be larger than zero."));
   }
 
   virtual ~BalancedGranularityPartitionPolicy(){};
@@ -49,14 +97,12 @@ public:
   {
     dealii::types::global_cell_index const n_cells = tria_coarse_in.n_global_active_cells();
 
-    // TODO: We hard-code a grain-size limit of 200 cells per processor
-    // (assuming linear finite elements and typical behavior of
-    // supercomputers). In case we have fewer cells on the fine level, we do
-    // not immediately go to 200 cells per rank, but limit the growth by a
-    // factor of 8, which limits makes sure that we do not create too many
-    // messages for individual MPI processes.
-    unsigned int const grain_size_limit =
-      std::min<unsigned int>(200, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
+    // The default grain-size limit of 200 cells per processor assumes linear finite elements and
+    // typical behavior of supercomputers. In case we have fewer cells on the fine level, we do
+    // not immediately go to grain_size cells per rank, but limit the growth by max_shrink_factor,
+    // which makes sure that we do not create too many messages for individual MPI processes.
+    unsigned int const grain_size_limit = std::min<unsigned int>(
+      grain_size, max_shrink_factor * n_cells / n_mpi_processes_per_level.back() + 1);
 
     dealii::RepartitioningPolicyTools::MinimalGranularityPolicy<dim, spacedim> partitioning_policy(
       grain_size_limit);
@@ -71,6 +117,9 @@ public:
 
 private:
   mutable std::vector<unsigned int> n_mpi_processes_per_level;
+
+  unsigned int const grain_size;
+  unsigned int const max_shrink_factor;
 };
 } // namespace ExaDG
 
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_GRID_GRID_H_
 #define INCLUDE_EXADG_GRID_GRID_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
@@ -70,6 +73,12 @@ public:
    * corresponds to the coarsest triangulation.
    */
   std::vector<PeriodicFacePairs> coarse_periodic_face_pairs;
+
+  /**
+   * Relative computational cost of an active cell that has been used to balance the load among the
+   * processes, see GridData::cell_weight_boundary_face. Empty if all cells are weighted equally.
+   */
+  std::function<double(typename dealii::Triangulation<dim>::cell_iterator const &)> cell_weight;
 };
 
 /**
@@ -90,7 +99,8 @@ public:
                     std::shared_ptr<dealii::Mapping<dim>> mapping_coarse_levels)
     : mapping_fine_level(mapping),
       mapping_coarse_levels(mapping_coarse_levels),
-      degree_coarse_mappings(1)
+      degree_coarse_mappings(1),
+      geometry_version_coarse_mappings(dealii::numbers::invalid_unsigned_int)
   {
   }
 
@@ -100,12 +110,15 @@ public:
   MultigridMappings(std::shared_ptr<MappingDoFVector<dim, Number>> mapping_dof_vector,
                     unsigned int const                             degree_coarse_mappings)
     : mapping_dof_vector_fine_level(mapping_dof_vector),
-      degree_coarse_mappings(degree_coarse_mappings)
+      degree_coarse_mappings(degree_coarse_mappings),
+      geometry_version_coarse_mappings(dealii::numbers::invalid_unsigned_int)
   {
   }
 
   /**
-   * Initializes the multigrid mappings on coarse h levels.
+   * Initializes the multigrid mappings on coarse h levels. Since this object is shared by all
+   * multigrid preconditioners, the coarse mappings are only re-computed if the fine-level mapping
+   * has changed since the last call.
    */
   void
   initialize_coarse_mappings(Grid<dim> const & grid, unsigned int const n_h_levels)
@@ -116,9 +129,18 @@ public:
     {
       if(n_h_levels > 1)
       {
-        mapping_dof_vector_coarse_levels.resize(n_h_levels - 1);
+        bool const coarse_mappings_are_up_to_date =
+          mapping_dof_vector_coarse_levels.size() == n_h_levels - 1 and
+          geometry_version_coarse_mappings == get_geometry_version();
 
-        lambda_initialize_coarse_mappings(grid.triangulation, grid.coarse_triangulations);
+        if(not coarse_mappings_are_up_to_date)
+        {
+          mapping_dof_vector_coarse_levels.resize(n_h_levels - 1);
+
+          lambda_initialize_coarse_mappings(grid.triangulation, grid.coarse_triangulations);
+
+          geometry_version_coarse_mappings = get_geometry_version();
+        }
       }
     }
     else // standard dealii::Mapping
@@ -131,6 +153,19 @@ public:
     }
   }
 
+  /**
+   * Returns the geometry version of the fine-level mapping, see MappingDoFVector. Standard
+   * dealii::Mapping's are assumed to be constant.
+   */
+  unsigned int
+  get_geometry_version() const
+  {
+    if(mapping_dof_vector_fine_level.get())
+      return mapping_dof_vector_fine_level->get_geometry_version();
+    else
+      return 0;
+  }
+
   /**
    * Returns the dealii::Mapping for a given h_level of n_h_levels.
    */
@@ -230,6 +265,11 @@ private:
    * MappingDoFVector.
    */
   unsigned int const degree_coarse_mappings;
+
+  /**
+   * Geometry version of the fine-level mapping for which the coarse mappings have been computed.
+   */
+  unsigned int geometry_version_coarse_mappings;
 };
 
 } // namespace ExaDG
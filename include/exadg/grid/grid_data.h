@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_GRID_GRID_DATA_H_
 
 // C/C++
+#include <map>
 #include <string>
 
 // deal.II
@@ -92,13 +93,53 @@ struct GridData
       partitioning_type(PartitioningType::Metis),
       n_refine_global(0),
       file_name(),
-      create_coarse_triangulations(false)
+      partitioned_file_prefix(),
+      reorder_coarse_cells(false),
+      create_coarse_triangulations(false),
+      coarse_triangulations_grain_size(200),
+      coarse_triangulations_max_shrink_factor(8),
+      coarse_triangulations_cell_cost(1.e-6),
+      cell_weight_boundary_face(0.0)
   {
   }
 
   void
   check() const
   {
+    if(not partitioned_file_prefix.empty())
+    {
+      AssertThrow(triangulation_type == TriangulationType::FullyDistributed,
+                  dealii::ExcMessage("partitioned_file_prefix requires "
+                                     "TriangulationType::FullyDistributed."));
+    }
+
+    AssertThrow(coarse_triangulations_grain_size > 0 or coarse_triangulations_cell_cost > 0.0,
+                dealii::ExcMessage("coarse_triangulations_cell_cost has to be larger than zero if "
+                                   "the grain size is determined automatically."));
+    AssertThrow(coarse_triangulations_max_shrink_factor > 0,
+                dealii::ExcMessage(
+                  "coarse_triangulations_max_shrink_factor has to be larger than zero."));
+
+    AssertThrow(cell_weight_boundary_face >= 0.0,
+                dealii::ExcMessage("cell_weight_boundary_face must not be negative."));
+    for(auto const & it : cell_weight_factors)
+    {
+      AssertThrow(it.second > 0.0,
+                  dealii::ExcMessage("cell_weight_factors have to be larger than zero."));
+    }
+
+    if(use_cell_weights() and triangulation_type == TriangulationType::FullyDistributed)
+    {
+      AssertThrow(partitioning_type == PartitioningType::Metis,
+                  dealii::ExcMessage("Cell weights require PartitioningType::Metis in case of "
+                                     "TriangulationType::FullyDistributed."));
+    }
+  }
+
+  bool
+  use_cell_weights() const
+  {
+    return cell_weight_boundary_face > 0.0 or not cell_weight_factors.empty();
   }
 
   void
@@ -116,7 +157,44 @@ struct GridData
     if(not file_name.empty())
       print_parameter(pcout, "Grid file name", file_name);
 
+    if(not file_name.empty())
+      print_parameter(pcout, "Reorder coarse cells", reorder_coarse_cells);
+
+    if(not partitioned_file_prefix.empty())
+      print_parameter(pcout, "Partitioned grid file prefix", partitioned_file_prefix);
+
     print_parameter(pcout, "Create coarse triangulations", create_coarse_triangulations);
+
+    if(create_coarse_triangulations and triangulation_type != TriangulationType::Serial)
+    {
+      if(coarse_triangulations_grain_size > 0)
+      {
+        print_parameter(pcout,
+                        "Coarse triangulations grain size",
+                        coarse_triangulations_grain_size);
+      }
+      else
+      {
+        print_parameter(pcout, "Coarse triangulations grain size", "automatic");
+        print_parameter(pcout,
+                        "Coarse triangulations cell cost",
+                        coarse_triangulations_cell_cost);
+      }
+      print_parameter(pcout,
+                      "Coarse triangulations max shrink factor",
+                      coarse_triangulations_max_shrink_factor);
+    }
+
+    if(use_cell_weights())
+    {
+      print_parameter(pcout, "Cell weight per boundary face", cell_weight_boundary_face);
+      for(auto const & it : cell_weight_factors)
+      {
+        print_parameter(pcout,
+                        "Cell weight factor of material id " + std::to_string(it.first),
+                        it.second);
+      }
+    }
   }
 
   TriangulationType triangulation_type;
@@ -133,6 +211,26 @@ struct GridData
   // deduce the correct type of the file format
   std::string file_name;
 
+  // Grid generators often number the cells of a grid file arbitrarily. Since deal.II (and hence
+  // the MatrixFree cell batches on each process) follows the numbering of the coarse cells,
+  // neighboring cells are then far apart in memory, which impairs the cache reuse of face
+  // neighbors in matrix-free loops. If this parameter is true, the coarse cells read from file are
+  // renumbered along a hierarchical ordering of the face connectivity graph before any refinement.
+  // This is the ordering dealii::parallel::distributed::Triangulation applies anyway, such that
+  // the parameter has no effect for TriangulationType::Distributed.
+  bool reorder_coarse_cells;
+
+  // Only relevant for TriangulationType::FullyDistributed: If not empty, each process reads the
+  // description of its part of the triangulation from a file starting with this prefix, such that
+  // neither the grid file nor a serial triangulation needs to be created on any process. If the
+  // files do not exist, the triangulation is created as usual and the files are written for
+  // subsequent runs. This includes the coarse triangulations if create_coarse_triangulations is
+  // true. The file names contain the number of processes and the global and local refinements, but
+  // it is the responsibility of the user to remove the files when the grid is changed otherwise.
+  // Periodic boundaries are not supported, since the periodic face pairs are filled when creating
+  // the triangulation.
+  std::string partitioned_file_prefix;
+
   // In case of a hypercube mesh that is globally refined, i.e. without hanging nodes, the fine
   // triangulation can be used for all multigrid h-levels without the need to create coarse
   // triangulations explicitly. Hence, this parameter is typically set to false for globally-refined
@@ -141,8 +239,38 @@ struct GridData
   // meshes. In that case, the coarse triangulations are created explicitly for use in
   // h-multigrid methods.
   // This parameter needs to be set to true if one wants to use h-multigrid methods for
-  // locally-refined hypercube meshes or non-hypercube meshes.
+  // non-hypercube meshes. For locally-refined hypercube meshes, the coarse triangulations are
+  // created in any case (global coarsening).
   bool create_coarse_triangulations;
+
+  // Only relevant for parallel triangulations with coarse triangulations: The coarse
+  // triangulations are repartitioned onto fewer MPI processes such that each process owns at least
+  // coarse_triangulations_grain_size cells. From one level to the next coarser one, the number of
+  // cells per process grows at most by the factor coarse_triangulations_max_shrink_factor. On large
+  // numbers of processes, this avoids coarse levels with only a handful of cells per process, which
+  // are dominated by communication latency.
+  //
+  // If coarse_triangulations_grain_size is 0, the grain size is chosen automatically from the MPI
+  // latency measured on the given machine, such that the work per process on a coarse level,
+  // estimated with the cost coarse_triangulations_cell_cost (in seconds) of an operator
+  // application per cell, exceeds the latency of a message by a safe margin.
+  unsigned int coarse_triangulations_grain_size;
+  unsigned int coarse_triangulations_max_shrink_factor;
+  double       coarse_triangulations_cell_cost;
+
+  // Model of the relative computational cost of a cell used to balance the load among the
+  // processes (not relevant for TriangulationType::Serial). A cell with neither boundary faces nor
+  // a material id listed in cell_weight_factors has the weight 1, such that the default balances
+  // the number of cells. Each boundary face (excluding periodic faces) adds
+  // cell_weight_boundary_face to the weight, which accounts for the boundary face integrals. The
+  // resulting weight is multiplied by the factor given for the material id of the cell, which
+  // allows to tag categories of cells with a different cost, e.g. over-integrated cells or the
+  // region of a turbulence model. The values can be obtained from a cost model or from measured
+  // operator timings. For TriangulationType::Distributed, the weights are also used to repartition
+  // the triangulation after adaptive mesh refinement.
+  double cell_weight_boundary_face;
+
+  std::map<dealii::types::material_id, double> cell_weight_factors;
 };
 
 } // namespace ExaDG
@@ -22,12 +22,23 @@
 #ifndef INCLUDE_EXADG_GRID_GRID_UTILITIES_H_
 #define INCLUDE_EXADG_GRID_GRID_UTILITIES_H_
 
+// C/C++
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <string>
+
 // deal.II
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/tria.h>
 #include <deal.II/fe/fe_simplex_p.h>
 #include <deal.II/fe/mapping_fe.h>
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/grid/grid_in.h>
 #include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria_description.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 
 // ExaDG
@@ -132,6 +143,156 @@ transform_periodic_face_pairs_to_dof_cell_iterator(
   return periodic_faces_dof;
 }
 
+/**
+ * Returns the relative computational cost of a cell according to the cost model in GridData.
+ */
+template<int dim>
+inline double
+compute_cell_weight(typename dealii::Triangulation<dim>::cell_iterator const & cell,
+                    GridData const &                                           data)
+{
+  double weight = 1.0;
+
+  for(unsigned int const f : cell->face_indices())
+  {
+    if(cell->at_boundary(f) and not cell->has_periodic_neighbor(f))
+      weight += data.cell_weight_boundary_face;
+  }
+
+  auto const it = data.cell_weight_factors.find(cell->material_id());
+  if(it != data.cell_weight_factors.end())
+    weight *= it->second;
+
+  return weight;
+}
+
+/**
+ * deal.II expects integer weights with the weight 1000 for a cell of default cost.
+ */
+inline unsigned int
+convert_cell_weight(double const weight)
+{
+  return static_cast<unsigned int>(std::round(1000.0 * weight));
+}
+
+/**
+ * Connects the cost model in GridData to the repartitioning of a distributed triangulation, which
+ * takes place at every call to execute_coarsening_and_refinement() and repartition().
+ */
+template<int dim>
+inline void
+connect_cell_weights(dealii::parallel::distributed::Triangulation<dim> & triangulation,
+                     GridData const &                                    data)
+{
+  auto const weight_function =
+    [data](typename dealii::Triangulation<dim>::cell_iterator const & cell,
+           auto const                                                 status) -> unsigned int {
+    double weight = compute_cell_weight<dim>(cell, data);
+
+    // the parent cell represents all its children that are going to be coarsened
+    if(status == dealii::Triangulation<dim>::CELL_COARSEN)
+      weight *= cell->n_children();
+
+#if DEAL_II_VERSION_GTE(9, 5, 0)
+    return convert_cell_weight(weight);
+#else
+    // the weight 1000 of a cell is added by deal.II
+    return convert_cell_weight(std::max(weight - 1.0, 0.0));
+#endif
+  };
+
+#if DEAL_II_VERSION_GTE(9, 5, 0)
+  triangulation.signals.weight.connect(weight_function);
+#else
+  triangulation.signals.cell_weight.connect(weight_function);
+#endif
+}
+
+/**
+ * Name of the file holding the description of the part of a fully-distributed triangulation owned
+ * by the current process, see GridData::partitioned_file_prefix.
+ */
+inline std::string
+get_partitioned_file_name(std::string const &               prefix,
+                          MPI_Comm const &                  mpi_comm,
+                          unsigned int const                global_refinements,
+                          std::vector<unsigned int> const & vector_local_refinements,
+                          bool const                        construct_multigrid_hierarchy)
+{
+  std::string file_name = prefix + "_" +
+                          std::to_string(dealii::Utilities::MPI::n_mpi_processes(mpi_comm)) +
+                          "procs_" + std::to_string(global_refinements) + "refs";
+
+  // the levels of a geometric coarsening sequence differ in the local refinements only
+  for(unsigned int const local_refinements : vector_local_refinements)
+    file_name += "_" + std::to_string(local_refinements);
+
+  if(construct_multigrid_hierarchy)
+    file_name += "_mg";
+
+  return file_name + "." + std::to_string(dealii::Utilities::MPI::this_mpi_process(mpi_comm));
+}
+
+/**
+ * Construct a fully-distributed triangulation from a description either read from file or created
+ * from a serial triangulation, where in the latter case the description is written to file if
+ * GridData::partitioned_file_prefix is set.
+ */
+template<int dim>
+inline void
+create_fully_distributed_triangulation(
+  dealii::Triangulation<dim> &      triangulation,
+  GridData const &                  data,
+  bool const                        construct_multigrid_hierarchy,
+  unsigned int const                global_refinements,
+  std::vector<unsigned int> const & vector_local_refinements,
+  std::function<dealii::TriangulationDescription::Description<dim, dim>()> const &
+    create_description)
+{
+  MPI_Comm const mpi_comm = triangulation.get_communicator();
+
+  std::string file_name;
+  bool        read_from_file = false;
+  if(not data.partitioned_file_prefix.empty())
+  {
+    file_name = get_partitioned_file_name(data.partitioned_file_prefix,
+                                          mpi_comm,
+                                          global_refinements,
+                                          vector_local_refinements,
+                                          construct_multigrid_hierarchy);
+
+    read_from_file =
+      dealii::Utilities::MPI::logical_and(std::ifstream(file_name).good(), mpi_comm);
+  }
+
+  if(read_from_file)
+  {
+    std::ifstream     file(file_name, std::ios::binary);
+    std::vector<char> buffer((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+
+    triangulation.create_triangulation(
+      dealii::Utilities::unpack<dealii::TriangulationDescription::Description<dim, dim>>(buffer,
+                                                                                        false));
+  }
+  else
+  {
+    auto const description = create_description();
+
+    if(not file_name.empty())
+    {
+      std::vector<char> buffer;
+      dealii::Utilities::pack(description, buffer, false);
+
+      std::ofstream file(file_name, std::ios::binary);
+      AssertThrow(file.good(), dealii::ExcMessage("Could not write file " + file_name + "."));
+      file.write(buffer.data(), buffer.size());
+    }
+
+    triangulation.create_triangulation(description);
+  }
+}
+
 /**
  * This function creates a triangulation based on a lambda function and refinement parameters for
  * global and local mesh refinements. This function is used to create the fine triangulation on the
@@ -195,15 +356,24 @@ create_triangulation(
         dealii::parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy;
     }
 
-    triangulation =
+    auto const tria_distributed =
       std::make_shared<dealii::parallel::distributed::Triangulation<dim>>(mpi_comm,
                                                                           mesh_smoothing,
                                                                           distributed_settings);
 
+    if(data.use_cell_weights())
+      connect_cell_weights(*tria_distributed, data);
+
+    triangulation = tria_distributed;
+
     lambda_create_triangulation(*triangulation,
                                 periodic_face_pairs,
                                 global_refinements,
                                 vector_local_refinements);
+
+    // the weights of the coarse cells are not known to p4est when creating the triangulation
+    if(data.use_cell_weights())
+      tria_distributed->repartition();
   }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
@@ -220,8 +390,22 @@ create_triangulation(
       (void)group_size;
       if(data.partitioning_type == PartitioningType::Metis)
       {
-        dealii::GridTools::partition_triangulation(dealii::Utilities::MPI::n_mpi_processes(comm),
-                                                   tria_serial);
+        if(data.use_cell_weights())
+        {
+          std::vector<unsigned int> cell_weights(tria_serial.n_active_cells());
+          for(auto const & cell : tria_serial.active_cell_iterators())
+            cell_weights[cell->active_cell_index()] =
+              convert_cell_weight(compute_cell_weight<dim>(cell, data));
+
+          dealii::GridTools::partition_triangulation(dealii::Utilities::MPI::n_mpi_processes(comm),
+                                                     cell_weights,
+                                                     tria_serial);
+        }
+        else
+        {
+          dealii::GridTools::partition_triangulation(dealii::Utilities::MPI::n_mpi_processes(comm),
+                                                     tria_serial);
+        }
       }
       else if(data.partitioning_type == PartitioningType::z_order)
       {
@@ -248,15 +432,23 @@ create_triangulation(
     triangulation =
       std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(mpi_comm);
 
-    auto const description = dealii::TriangulationDescription::Utilities::
-      create_description_from_triangulation_in_groups<dim, dim>(serial_grid_generator,
-                                                                serial_grid_partitioner,
-                                                                triangulation->get_communicator(),
-                                                                group_size,
-                                                                mesh_smoothing,
-                                                                triangulation_description_setting);
+    auto const create_description = [&]() {
+      return dealii::TriangulationDescription::Utilities::
+        create_description_from_triangulation_in_groups<dim, dim>(
+          serial_grid_generator,
+          serial_grid_partitioner,
+          triangulation->get_communicator(),
+          group_size,
+          mesh_smoothing,
+          triangulation_description_setting);
+    };
 
-    triangulation->create_triangulation(description);
+    create_fully_distributed_triangulation<dim>(*triangulation,
+                                                data,
+                                                construct_multigrid_hierarchy,
+                                                global_refinements,
+                                                vector_local_refinements,
+                                                create_description);
   }
   else
   {
@@ -264,6 +456,64 @@ create_triangulation(
   }
 }
 
+/**
+ * Creates the policy to agglomerate the coarse triangulations onto fewer processes, see
+ * GridData::coarse_triangulations_grain_size.
+ */
+template<int dim>
+inline BalancedGranularityPartitionPolicy<dim>
+create_coarse_triangulations_partition_policy(MPI_Comm const & mpi_comm, GridData const & data)
+{
+  unsigned int const grain_size =
+    data.coarse_triangulations_grain_size > 0 ?
+      data.coarse_triangulations_grain_size :
+      estimate_grain_size(mpi_comm, data.coarse_triangulations_cell_cost);
+
+  return BalancedGranularityPartitionPolicy<dim>(dealii::Utilities::MPI::n_mpi_processes(mpi_comm),
+                                                 grain_size,
+                                                 data.coarse_triangulations_max_shrink_factor);
+}
+
+/**
+ * Repartitions a coarse triangulation of type TriangulationType::FullyDistributed according to the
+ * given policy, which agglomerates the cells onto fewer processes. The policy has to be called for
+ * the levels from fine to coarse. The triangulation is not repartitioned in case of periodic
+ * boundaries, since the periodic face pairs would be invalidated.
+ */
+template<int dim>
+inline void
+repartition_fully_distributed_coarse_triangulation(
+  std::shared_ptr<dealii::Triangulation<dim>> &        triangulation,
+  PeriodicFacePairs<dim> const &                       periodic_face_pairs,
+  dealii::RepartitioningPolicyTools::Base<dim> const & policy)
+{
+  if(not(periodic_face_pairs.empty()))
+    return;
+
+  dealii::LinearAlgebra::distributed::Vector<double> const partition =
+    policy.partition(*triangulation);
+
+  // an empty vector means that the partition remains unchanged
+  if(partition.size() == 0)
+    return;
+
+  auto const description =
+    dealii::TriangulationDescription::Utilities::create_description_from_triangulation(
+      *triangulation, partition);
+
+  auto const tria_repartitioned =
+    std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(
+      triangulation->get_communicator());
+
+  for(auto const manifold_id : triangulation->get_manifold_ids())
+    if(manifold_id != dealii::numbers::flat_manifold_id)
+      tria_repartitioned->set_manifold(manifold_id, triangulation->get_manifold(manifold_id));
+
+  tria_repartitioned->create_triangulation(description);
+
+  triangulation = tria_repartitioned;
+}
+
 /**
  * Given a fine_triangulation, this function creates all the coarse triangulations required for
  * multigrid implementations that expect a vector of triangulations.
@@ -312,8 +562,8 @@ create_coarse_triangulations_automatically_from_fine_triangulation(
     coarse_triangulations_const =
       dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
         fine_triangulation,
-        BalancedGranularityPartitionPolicy<dim>(
-          dealii::Utilities::MPI::n_mpi_processes(fine_triangulation.get_communicator())));
+        create_coarse_triangulations_partition_policy<dim>(fine_triangulation.get_communicator(),
+                                                           data));
   }
   else
   {
@@ -347,7 +597,8 @@ create_coarse_triangulations_for_fully_distributed_triangulation(
 {
   // In case of a fully distributed triangulation, deal.II cannot automatically generate the
   // coarse triangulations. Create the coarse traingulations using the lambda function and
-  // the vector of local refinements.
+  // the vector of local refinements. Each coarse triangulation is created on all processes and
+  // then agglomerated onto fewer processes as for TriangulationType::Distributed.
   AssertThrow(data.triangulation_type == TriangulationType::FullyDistributed,
               dealii::ExcMessage("Invalid parameter triangulation_type."));
 
@@ -360,6 +611,10 @@ create_coarse_triangulations_for_fully_distributed_triangulation(
 
     coarse_periodic_face_pairs = std::vector<PeriodicFacePairs<dim>>(coarse_triangulations.size());
 
+    BalancedGranularityPartitionPolicy<dim> const policy =
+      create_coarse_triangulations_partition_policy<dim>(fine_triangulation.get_communicator(),
+                                                         data);
+
     // Start one level below the fine triangulation.
     unsigned int              level        = fine_triangulation.n_global_levels() - 2;
     std::vector<unsigned int> refine_local = vector_local_refinements;
@@ -379,6 +634,10 @@ create_coarse_triangulations_for_fully_distributed_triangulation(
                                                  refine_global,
                                                  refine_local);
 
+        repartition_fully_distributed_coarse_triangulation<dim>(coarse_triangulations[level],
+                                                                coarse_periodic_face_pairs[level],
+                                                                policy);
+
         if(level > 0)
         {
           level--;
@@ -408,6 +667,10 @@ create_coarse_triangulations_for_fully_distributed_triangulation(
                                                  0 /*refine_global*/,
                                                  refine_local);
 
+        repartition_fully_distributed_coarse_triangulation<dim>(coarse_triangulations[level],
+                                                                coarse_periodic_face_pairs[level],
+                                                                policy);
+
         if(level > 0)
         {
           level--;
@@ -469,6 +732,21 @@ create_coarse_triangulations(
   }
 }
 
+/**
+ * Stores the cost model used to partition the triangulation of a Grid object.
+ */
+template<int dim>
+inline void
+set_cell_weight(Grid<dim> & grid, GridData const & data)
+{
+  if(data.use_cell_weights() and data.triangulation_type != TriangulationType::Serial)
+  {
+    grid.cell_weight = [data](typename dealii::Triangulation<dim>::cell_iterator const & cell) {
+      return compute_cell_weight<dim>(cell, data);
+    };
+  }
+}
+
 /**
  * This utility function initializes a Grid object by creating a triangulation and filling the
  * periodic_face_pairs. According to the settings in GridData, the corresponding constructor of
@@ -487,6 +765,8 @@ create_triangulation(
                      std::vector<unsigned int> const &)> const & lambda_create_triangulation,
   std::vector<unsigned int> const                                vector_local_refinements)
 {
+  set_cell_weight(grid, data);
+
   GridUtilities::create_triangulation(grid.triangulation,
                                       grid.periodic_face_pairs,
                                       mpi_comm,
@@ -526,6 +806,8 @@ create_triangulation_with_multigrid(
                     "in order to use h-multigrid for simplex meshes."));
     }
 
+    set_cell_weight(grid, data);
+
     // create fine triangulation
     GridUtilities::create_triangulation(grid.triangulation,
                                         grid.periodic_face_pairs,
@@ -536,17 +818,14 @@ create_triangulation_with_multigrid(
                                         data.n_refine_global,
                                         vector_local_refinements);
 
-    // Make sure that we create coarse triangulations in case of meshes with hanging nodes.
-    if(grid.triangulation->has_hanging_nodes())
-    {
-      AssertThrow(data.create_coarse_triangulations == true,
-                  dealii::ExcMessage(
-                    "You need to set GridData::create_coarse_triangulations = true "
-                    "in order to use h-multigrid for meshes with hanging nodes."));
-    }
+    // Locally refined meshes, i.e., meshes with hanging nodes, are always coarsened globally, since
+    // the multigrid implementation does not support the levels of the fine triangulation (local
+    // smoothing) in this case. Hence, the coarse triangulations are created even if not requested.
+    bool const create_coarse_triangulations =
+      data.create_coarse_triangulations or grid.triangulation->has_hanging_nodes();
 
     // create coarse triangulations
-    if(data.create_coarse_triangulations)
+    if(create_coarse_triangulations)
     {
       GridUtilities::create_coarse_triangulations(*grid.triangulation,
                                                   grid.periodic_face_pairs,
@@ -610,6 +889,34 @@ create_coarse_triangulations_after_coarsening_and_refinement(
   }
 }
 
+/**
+ * Renumbers the coarse cells of a triangulation without refinements along a hierarchical ordering
+ * of the face connectivity graph of the cells, which places cells that are neighbors in the graph
+ * close to each other in the numbering, see GridData::reorder_coarse_cells.
+ */
+template<int dim>
+inline void
+reorder_coarse_cells(dealii::Triangulation<dim, dim> & tria)
+{
+  AssertThrow(tria.n_levels() == 1,
+              dealii::ExcMessage("Only a triangulation without refinements can be reordered."));
+
+  dealii::DynamicSparsityPattern connectivity;
+  dealii::GridTools::get_face_connectivity_of_cells(tria, connectivity);
+
+  std::vector<dealii::types::global_dof_index> new_indices(tria.n_active_cells());
+  dealii::SparsityTools::reorder_hierarchical(connectivity, new_indices);
+
+  auto [vertices, cells, subcell_data] = dealii::GridTools::get_coarse_mesh_description(tria);
+
+  std::vector<dealii::CellData<dim>> reordered_cells(cells.size());
+  for(unsigned int i = 0; i < cells.size(); ++i)
+    reordered_cells[new_indices[i]] = cells[i];
+
+  tria.clear();
+  tria.create_triangulation(vertices, reordered_cells, subcell_data);
+}
+
 /**
  * This function reads an external triangulation. The function takes GridData as an argument
  * and stores the external triangulation in "tria".
@@ -646,6 +953,12 @@ read_external_triangulation(dealii::Triangulation<dim, dim> & tria, GridData con
 
   grid_in.read(data.file_name, format);
 
+  if(data.reorder_coarse_cells and
+     dynamic_cast<dealii::parallel::distributed::Triangulation<dim> *>(&tria) == nullptr)
+  {
+    reorder_coarse_cells(tria);
+  }
+
   AssertThrow(get_element_type(tria) == data.element_type,
               dealii::ExcMessage("You are trying to read a grid file, but the element type of the"
                                  " external grid file and the element type specified in GridData"
@@ -24,6 +24,7 @@
 
 #include <exadg/grid/grid_data.h>
 #include <exadg/grid/mapping_deformation_base.h>
+#include <exadg/grid/rigid_body_motion.h>
 
 namespace ExaDG
 {
@@ -31,6 +32,10 @@ namespace ExaDG
  * Class for mesh deformations that can be described analytically via a dealii::Function<dim>
  * object.
  *
+ * The points of the undeformed grid are computed once and stored, such that an update of the grid
+ * only evaluates the displacement function. For a RigidBodyMotion, the points are transformed
+ * directly by the affine motion without evaluating the function for each point and component.
+ *
  * TODO: extend this class to simplicial elements.
  */
 template<int dim, typename Number>
@@ -51,9 +56,18 @@ public:
       mesh_deformation_function(mesh_deformation_function),
       triangulation(triangulation)
   {
+    // the stored points of the undeformed grid become invalid if the triangulation changes
+    connection_triangulation_change =
+      triangulation.signals.any_change.connect([this]() { undeformed_points.clear(); });
+
     update(start_time, false, dealii::numbers::invalid_unsigned_int);
   }
 
+  ~DeformedMappingFunction()
+  {
+    connection_triangulation_change.disconnect();
+  }
+
   /**
    * Updates the grid coordinates using a dealii::Function<dim> object evaluated at a given time.
    */
@@ -93,33 +107,70 @@ private:
                                                                1),
                                     dealii::update_quadrature_points);
 
+    std::shared_ptr<RigidBodyMotion<dim> const> const rigid_body_motion =
+      std::dynamic_pointer_cast<RigidBodyMotion<dim> const>(displacement_function);
+
+    dealii::Tensor<2, dim> rotation;
+    dealii::Tensor<1, dim> offset;
+    if(rigid_body_motion.get() != nullptr)
+      rigid_body_motion->get_transformation(rotation, offset);
+
+    if(undeformed_points.size() != triangulation.n_levels())
+      undeformed_points.resize(triangulation.n_levels());
+
     this->mapping_q_cache->initialize(
       triangulation,
       [&](typename dealii::Triangulation<dim>::cell_iterator const & cell)
         -> std::vector<dealii::Point<dim>> {
-        fe_values.reinit(cell);
+        std::vector<std::vector<dealii::Point<dim>>> & points_on_level =
+          undeformed_points[cell->level()];
+        if(points_on_level.size() <= static_cast<unsigned int>(cell->index()))
+          points_on_level.resize(triangulation.n_raw_cells(cell->level()));
 
-        // compute displacement and add to original position
-        std::vector<dealii::Point<dim>> points_moved(fe_values.n_quadrature_points);
-        for(unsigned int i = 0; i < fe_values.n_quadrature_points; ++i)
+        std::vector<dealii::Point<dim>> & points = points_on_level[cell->index()];
+        if(points.empty())
         {
+          fe_values.reinit(cell);
+
           // need to adjust for hierarchic numbering of dealii::MappingQCache
-          dealii::Point<dim> const point =
-            fe_values.quadrature_point(this->hierarchic_to_lexicographic_numbering[i]);
-          dealii::Point<dim> displacement;
-          for(unsigned int d = 0; d < dim; ++d)
-            displacement[d] = displacement_function->value(point, d);
+          points.resize(fe_values.n_quadrature_points);
+          for(unsigned int i = 0; i < fe_values.n_quadrature_points; ++i)
+            points[i] = fe_values.quadrature_point(this->hierarchic_to_lexicographic_numbering[i]);
+        }
 
-          points_moved[i] = point + displacement;
+        // compute displacement and add to original position
+        std::vector<dealii::Point<dim>> points_moved(points.size());
+        if(rigid_body_motion.get() != nullptr)
+        {
+          for(unsigned int i = 0; i < points.size(); ++i)
+            points_moved[i] = dealii::Point<dim>(rotation * points[i] + offset);
+        }
+        else
+        {
+          for(unsigned int i = 0; i < points.size(); ++i)
+          {
+            dealii::Point<dim> displacement;
+            for(unsigned int d = 0; d < dim; ++d)
+              displacement[d] = displacement_function->value(points[i], d);
+
+            points_moved[i] = points[i] + displacement;
+          }
         }
 
         return points_moved;
       });
+
+    ++this->geometry_version;
   }
 
   std::shared_ptr<dealii::Function<dim>> mesh_deformation_function;
 
   dealii::Triangulation<dim> const & triangulation;
+
+  // points of the undeformed grid in the numbering of dealii::MappingQCache, per level and cell
+  std::vector<std::vector<std::vector<dealii::Point<dim>>>> undeformed_points;
+
+  boost::signals2::connection connection_triangulation_change;
 };
 
 } // namespace ExaDG
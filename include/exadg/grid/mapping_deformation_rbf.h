@@ -0,0 +1,335 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_GRID_MAPPING_DEFORMATION_RBF_H_
+#define INCLUDE_EXADG_GRID_MAPPING_DEFORMATION_RBF_H_
+
+// C/C++
+#include <set>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/numerics/rtree.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/grid/grid.h>
+#include <exadg/grid/mapping_deformation_base.h>
+#include <exadg/utilities/print_solver_results.h>
+
+namespace ExaDG
+{
+namespace RBF
+{
+/**
+ * Class for moving grid problems, where the displacement prescribed on the interface is extended
+ * into the domain by an interpolation with compactly supported radial basis functions instead of
+ * solving a PDE. Only the grid nodes within a band of width band_width around the interface are
+ * moved. The displacement of a node at distance delta from the interface is
+ *
+ *   u(x) = beta(delta / band_width) * sum_j phi(|x - x_j| / support_radius) u_j
+ *                                     / sum_j phi(|x - x_j| / support_radius),
+ *
+ * where x_j are the interface points, phi(r) = (1-r)^4 (4r+1) is the Wendland C2 function, and
+ * beta = phi is used to blend the displacement to zero at the edge of the band. The weights only
+ * depend on the undeformed grid and are computed once in the constructor, such that an update of
+ * the grid only requires gathering the interface displacements and a sparse matrix-vector product.
+ *
+ * The interface points are the nodes of the grid on the interface, so the interface displacement
+ * is reproduced exactly. Boundaries other than the interface must not intersect the band if their
+ * grid motion is constrained.
+ *
+ * TODO: extend this class to simplicial elements.
+ */
+template<int dim, typename Number>
+class DeformedMapping : public DeformedMappingBase<dim, Number>
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  /**
+   * Constructor.
+   */
+  DeformedMapping(std::shared_ptr<Grid<dim> const>             grid,
+                  std::shared_ptr<dealii::Mapping<dim> const>  mapping_undeformed,
+                  std::set<dealii::types::boundary_id> const & interface_boundary_ids,
+                  unsigned int const                           degree,
+                  double const                                 band_width,
+                  double const                                 support_radius,
+                  MPI_Comm const &                             mpi_comm)
+    : DeformedMappingBase<dim, Number>(mapping_undeformed, degree, *grid->triangulation),
+      dof_handler(*grid->triangulation),
+      fe(dealii::FE_Q<dim>(degree), dim),
+      mpi_comm(mpi_comm),
+      pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    AssertThrow(band_width > 0.0 and support_radius > 0.0,
+                dealii::ExcMessage("Band width and support radius have to be positive."));
+
+    dof_handler.distribute_dofs(fe);
+
+    constraints.reinit(dealii::DoFTools::extract_locally_relevant_dofs(dof_handler));
+    dealii::DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+    constraints.close();
+
+    // the interface points are the quadrature points of a Gauss-Lobatto formula on the interface,
+    // which coincide with the nodes of the FE_Q element
+    typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+    additional_data.mapping_update_flags_boundary_faces = dealii::update_quadrature_points;
+
+    matrix_free.reinit(*mapping_undeformed,
+                       dof_handler,
+                       constraints,
+                       dealii::QGaussLobatto<1>(degree + 1),
+                       additional_data);
+
+    interface_data = std::make_shared<ContainerInterfaceData<1, dim, double>>();
+    interface_data->setup(matrix_free, 0, {0}, interface_boundary_ids);
+
+    setup_weights(*mapping_undeformed, band_width, support_radius);
+
+    displacement.reinit(dof_handler.locally_owned_dofs(),
+                        dealii::DoFTools::extract_locally_relevant_dofs(dof_handler),
+                        mpi_comm);
+  }
+
+  /**
+   * Data structure filled by the coupling with the displacement on the interface.
+   */
+  std::shared_ptr<ContainerInterfaceData<1, dim, double>>
+  get_container_interface_data() const
+  {
+    return interface_data;
+  }
+
+  /**
+   * Updates the mapping, i.e., moves the grid by interpolating the interface displacement.
+   */
+  void
+  update(double const     time,
+         bool const       print_solver_info,
+         types::time_step time_step_number) override
+  {
+    (void)time;
+    (void)time_step_number;
+
+    dealii::Timer timer;
+    timer.restart();
+
+    // displacements of all interface points
+    std::vector<std::vector<dealii::Tensor<1, dim, double>>> const values_per_process =
+      dealii::Utilities::MPI::all_gather(mpi_comm, interface_data->get_array_solution(0));
+
+    std::vector<dealii::Tensor<1, dim, double>> values;
+    values.reserve(n_interface_points);
+    for(auto const & values_process : values_per_process)
+      values.insert(values.end(), values_process.begin(), values_process.end());
+
+    displacement = 0.0;
+    for(auto const & node : nodes)
+    {
+      double value = 0.0;
+      for(unsigned int i = node.begin; i < node.end; ++i)
+        value += weights[i] * values[centers[i]][node.component];
+      displacement.local_element(node.index) = value;
+    }
+    constraints.distribute(displacement);
+
+    if(print_solver_info)
+    {
+      pcout << std::endl << "Interpolate moving mesh displacement (RBF):";
+      print_wall_time(pcout, timer.wall_time());
+    }
+
+    this->initialize_mapping_from_dof_vector(this->mapping_undeformed, displacement, dof_handler);
+  }
+
+  /**
+   * The grid motion does not involve the solution of linear systems.
+   */
+  void
+  print_iterations() const override
+  {
+  }
+
+private:
+  static double
+  wendland(double const r)
+  {
+    return r < 1.0 ? std::pow(1.0 - r, 4) * (4.0 * r + 1.0) : 0.0;
+  }
+
+  /*
+   * Computes the interpolation weights of the locally owned nodes within the band.
+   */
+  void
+  setup_weights(dealii::Mapping<dim> const & mapping,
+                double const                 band_width,
+                double const                 support_radius)
+  {
+    std::vector<std::vector<dealii::Point<dim>>> const points_per_process =
+      dealii::Utilities::MPI::all_gather(mpi_comm, interface_data->get_array_q_points(0));
+
+    std::vector<dealii::Point<dim>> interface_points;
+    for(auto const & points_process : points_per_process)
+      interface_points.insert(interface_points.end(), points_process.begin(), points_process.end());
+    n_interface_points = interface_points.size();
+
+    auto const tree = dealii::pack_rtree_of_indices(interface_points);
+
+    double const search_radius = std::max(band_width, support_radius);
+    double const tolerance     = 1.e-12 * search_radius;
+
+    std::vector<dealii::Point<dim>> const &      unit_points = fe.get_unit_support_points();
+    std::vector<dealii::types::global_dof_index> dof_indices(fe.dofs_per_cell);
+    std::vector<bool>         visited(dof_handler.locally_owned_dofs().n_elements(), false);
+    std::vector<unsigned int> candidates;
+
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(not cell->is_locally_owned())
+        continue;
+
+      cell->get_dof_indices(dof_indices);
+      for(unsigned int i = 0; i < fe.dofs_per_cell; ++i)
+      {
+        if(not dof_handler.locally_owned_dofs().is_element(dof_indices[i]))
+          continue;
+
+        unsigned int const index =
+          dof_handler.locally_owned_dofs().index_within_set(dof_indices[i]);
+        if(visited[index])
+          continue;
+        visited[index] = true;
+
+        dealii::Point<dim> const x = mapping.transform_unit_to_real_cell(cell, unit_points[i]);
+
+        dealii::Point<dim> lower = x, upper = x;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          lower[d] -= search_radius;
+          upper[d] += search_radius;
+        }
+
+        candidates.clear();
+        tree.query(boost::geometry::index::intersects(
+                     dealii::BoundingBox<dim>(std::make_pair(lower, upper))),
+                   std::back_inserter(candidates));
+
+        if(candidates.empty())
+          continue;
+
+        // distance to the interface
+        unsigned int nearest  = candidates[0];
+        double       distance = x.distance(interface_points[nearest]);
+        for(auto const j : candidates)
+        {
+          if(x.distance(interface_points[j]) < distance)
+          {
+            nearest  = j;
+            distance = x.distance(interface_points[j]);
+          }
+        }
+
+        if(distance >= band_width)
+          continue;
+
+        Node node;
+        node.index     = index;
+        node.component = fe.system_to_component_index(i).first;
+        node.begin     = weights.size();
+
+        double const blending = wendland(distance / band_width);
+
+        double sum = 0.0;
+        if(distance > tolerance)
+        {
+          for(auto const j : candidates)
+            sum += wendland(x.distance(interface_points[j]) / support_radius);
+        }
+
+        if(sum > 0.0)
+        {
+          for(auto const j : candidates)
+          {
+            double const phi = wendland(x.distance(interface_points[j]) / support_radius);
+            if(phi > 0.0)
+            {
+              centers.push_back(j);
+              weights.push_back(blending * phi / sum);
+            }
+          }
+        }
+        else // nodes on the interface or without interface points within the support radius
+        {
+          centers.push_back(nearest);
+          weights.push_back(blending);
+        }
+
+        node.end = weights.size();
+        nodes.push_back(node);
+      }
+    }
+  }
+
+  struct Node
+  {
+    // index within the locally owned DoFs
+    unsigned int index;
+    unsigned int component;
+
+    // range of the interpolation weights
+    unsigned int begin;
+    unsigned int end;
+  };
+
+  dealii::DoFHandler<dim>           dof_handler;
+  dealii::FESystem<dim>             fe;
+  dealii::AffineConstraints<Number> constraints;
+  dealii::MatrixFree<dim, Number>   matrix_free;
+
+  std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data;
+
+  // sparse interpolation matrix from the interface points to the nodes within the band
+  std::vector<Node>         nodes;
+  std::vector<unsigned int> centers;
+  std::vector<double>       weights;
+  unsigned int              n_interface_points = 0;
+
+  VectorType displacement;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::ConditionalOStream pcout;
+};
+
+} // namespace RBF
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_MAPPING_DEFORMATION_RBF_H_ */
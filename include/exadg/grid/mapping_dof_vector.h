@@ -22,6 +22,10 @@
 #ifndef INCLUDE_FUNCTIONALITIES_MESH_H_
 #define INCLUDE_FUNCTIONALITIES_MESH_H_
 
+// C/C++
+#include <fstream>
+#include <string>
+
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mg_level_object.h>
@@ -58,7 +62,7 @@ public:
   /**
    * Constructor.
    */
-  MappingDoFVector(unsigned int const mapping_degree)
+  MappingDoFVector(unsigned int const mapping_degree) : geometry_version(0)
   {
     mapping_q_cache = std::make_shared<dealii::MappingQCache<dim>>(mapping_degree);
 
@@ -96,6 +100,17 @@ public:
     return mapping_q_cache;
   }
 
+  /**
+   * Returns a counter that is incremented whenever the grid coordinates of the mapping change.
+   * Objects depending on the geometry, e.g. the MatrixFree objects of the multigrid levels, can
+   * compare this counter to the one of their last update to skip updates for an unchanged mesh.
+   */
+  unsigned int
+  get_geometry_version() const
+  {
+    return geometry_version;
+  }
+
   /**
    * Extract the grid coordinates of the current mesh configuration described by the
    * dealii::MappingQCache object and fill a dof-vector given a corresponding dealii::DoFHandler
@@ -307,13 +322,87 @@ public:
 
         return grid_coordinates;
       });
+
+    ++geometry_version;
+  }
+
+  /**
+   * Writes the locally owned grid coordinates of the current mesh configuration to a file per
+   * process. This allows to initialize the mapping with load_grid_coordinates() in later runs on
+   * the same triangulation, partitioning, and dealii::DoFHandler without evaluating the mapping
+   * that has originally been used to initialize this object (e.g. a manifold description).
+   */
+  void
+  save_grid_coordinates(std::string const &             file_prefix,
+                        dealii::DoFHandler<dim> const & dof_handler) const
+  {
+    VectorType grid_coordinates;
+    fill_grid_coordinates_vector(grid_coordinates, dof_handler);
+
+    std::ofstream file(get_file_name(file_prefix, dof_handler), std::ios::binary);
+    AssertThrow(file.good(), dealii::ExcMessage("Could not write file with grid coordinates."));
+
+    dealii::types::global_dof_index const n_dofs = dof_handler.n_dofs();
+    unsigned int const local_size                = grid_coordinates.locally_owned_size();
+    file.write(reinterpret_cast<char const *>(&n_dofs), sizeof(n_dofs));
+    file.write(reinterpret_cast<char const *>(&local_size), sizeof(local_size));
+    file.write(reinterpret_cast<char const *>(grid_coordinates.begin()),
+               local_size * sizeof(Number));
+  }
+
+  /**
+   * Initializes the dealii::MappingQCache object from the grid coordinates written by
+   * save_grid_coordinates(). Returns false without changing the mapping if the files do not exist
+   * or do not match the given dealii::DoFHandler on any process.
+   */
+  bool
+  load_grid_coordinates(std::string const &             file_prefix,
+                        dealii::DoFHandler<dim> const & dof_handler)
+  {
+    VectorType grid_coordinates(dof_handler.locally_owned_dofs(), dof_handler.get_communicator());
+
+    std::ifstream file(get_file_name(file_prefix, dof_handler), std::ios::binary);
+
+    dealii::types::global_dof_index n_dofs     = 0;
+    unsigned int                    local_size = 0;
+    file.read(reinterpret_cast<char *>(&n_dofs), sizeof(n_dofs));
+    file.read(reinterpret_cast<char *>(&local_size), sizeof(local_size));
+
+    bool const valid = dealii::Utilities::MPI::logical_and(
+      file.good() and n_dofs == dof_handler.n_dofs() and
+        local_size == grid_coordinates.locally_owned_size(),
+      dof_handler.get_communicator());
+
+    if(not valid)
+      return false;
+
+    file.read(reinterpret_cast<char *>(grid_coordinates.begin()), local_size * sizeof(Number));
+
+    // the grid coordinates are absolute coordinates (of the active cells), i.e. there is no
+    // reference configuration
+    initialize_mapping_from_dof_vector(nullptr, grid_coordinates, dof_handler);
+
+    return true;
   }
 
   std::vector<unsigned int> hierarchic_to_lexicographic_numbering;
   std::vector<unsigned int> lexicographic_to_hierarchic_numbering;
 
+private:
+  static std::string
+  get_file_name(std::string const & file_prefix, dealii::DoFHandler<dim> const & dof_handler)
+  {
+    MPI_Comm const mpi_comm = dof_handler.get_communicator();
+
+    return file_prefix + "_" + std::to_string(dealii::Utilities::MPI::n_mpi_processes(mpi_comm)) +
+           "procs." + std::to_string(dealii::Utilities::MPI::this_mpi_process(mpi_comm));
+  }
+
 protected:
   std::shared_ptr<dealii::MappingQCache<dim>> mapping_q_cache;
+
+  // has to be incremented by all functions initializing mapping_q_cache
+  unsigned int geometry_version;
 };
 
 
@@ -0,0 +1,113 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_GRID_OVERSET_GRIDS_H_
+#define INCLUDE_EXADG_GRID_OVERSET_GRIDS_H_
+
+// deal.II
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/tria.h>
+
+namespace ExaDG
+{
+/**
+ * This function determines which faces of the dst triangulation are inside the src-triangulation.
+ * A face is considered inside, if all vertices of the face are inside. Then, the boundary ID is
+ * set to bid for all the faces of the dst-triangulation in the overlap region.
+ */
+template<int dim>
+void
+set_boundary_ids_overlap_region(dealii::Triangulation<dim> const & tria_dst,
+                                dealii::types::boundary_id const & bid,
+                                dealii::Mapping<dim> const &       mapping_src,
+                                dealii::Triangulation<dim> const & tria_src)
+{
+  std::vector<dealii::Point<dim>> points;
+  using CellIteratorType = typename dealii::Triangulation<dim>::cell_iterator;
+  using Id               = std::tuple<CellIteratorType /* cell */, unsigned int /*face*/>;
+  std::vector<std::pair<Id, unsigned int /* first_point_in_vector */>> id_to_vector_index;
+
+  // fill vector of points for all boundary faces
+  for(auto cell : tria_dst.cell_iterators())
+  {
+    for(auto const & f : cell->face_indices())
+    {
+      if(cell->face(f)->at_boundary())
+      {
+        for(auto const & v : cell->face(f)->vertex_indices())
+        {
+          if(v == 0)
+          {
+            Id const id = std::make_tuple(cell, f);
+            id_to_vector_index.push_back({id, points.size()});
+          }
+
+          points.push_back(cell->face(f)->vertex(v));
+        }
+      }
+    }
+  }
+
+  // create and reinit RemotePointEvaluation: find points on src-side
+  std::vector<bool> marked_vertices = {};
+  double const      tolerance       = 1.e-10;
+
+  dealii::Utilities::MPI::RemotePointEvaluation<dim> rpe =
+    dealii::Utilities::MPI::RemotePointEvaluation<dim>(tolerance,
+                                                       false
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+                                                       ,
+                                                       0,
+                                                       [marked_vertices]() {
+                                                         return marked_vertices;
+                                                       }
+#endif
+    );
+
+  rpe.reinit(points, tria_src, mapping_src);
+
+  // check which points have been found and whether a face on dst-side is located inside the src
+  // triangulation
+  for(auto iter = id_to_vector_index.begin(); iter != id_to_vector_index.end(); ++iter)
+  {
+    unsigned int const begin = iter->second;
+    unsigned int const end =
+      (iter + 1 != id_to_vector_index.end()) ? (iter + 1)->second : points.size();
+
+    bool inside = true;
+    for(unsigned int i = begin; i < end; ++i)
+    {
+      inside = (inside and rpe.point_found(i));
+    }
+
+    if(inside)
+    {
+      auto const & [cell, f] = iter->first;
+      cell->face(f)->set_boundary_id(bid);
+    }
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_OVERSET_GRIDS_H_ */
@@ -0,0 +1,87 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_GRID_RIGID_BODY_MOTION_H_
+#define INCLUDE_EXADG_GRID_RIGID_BODY_MOTION_H_
+
+// C/C++
+#include <functional>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+namespace ExaDG
+{
+/**
+ * Displacement field d(X, t) = x(X, t) - X of a rigid-body motion x(X, t) = c + b(t) + R(t) (X - c)
+ * of the grid, with the rotation matrix R(t) around the center of rotation c and the translation
+ * b(t). The rotation matrix can be obtained from dealii::Physics::Transformations::Rotations.
+ *
+ * DeformedMappingFunction detects this function and applies the affine transformation to the
+ * points of the undeformed grid directly instead of evaluating the function for each point and
+ * component.
+ */
+template<int dim>
+class RigidBodyMotion : public dealii::Function<dim>
+{
+public:
+  RigidBodyMotion(dealii::Point<dim> const &                                  center,
+                  std::function<dealii::Tensor<2, dim>(double const)> const & rotation,
+                  std::function<dealii::Tensor<1, dim>(double const)> const & translation)
+    : dealii::Function<dim>(dim), center(center), rotation(rotation), translation(translation)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & X, unsigned int const component = 0) const override
+  {
+    dealii::Tensor<2, dim> R;
+    dealii::Tensor<1, dim> offset;
+    get_transformation(R, offset);
+
+    return (R * X + offset)[component] - X[component];
+  }
+
+  /**
+   * Returns the motion x = R X + offset at the current time, i.e., offset = c + b(t) - R(t) c.
+   */
+  void
+  get_transformation(dealii::Tensor<2, dim> & R, dealii::Tensor<1, dim> & offset) const
+  {
+    double const time = this->get_time();
+
+    R      = rotation(time);
+    offset = center + translation(time) - R * center;
+  }
+
+private:
+  dealii::Point<dim> const center;
+
+  std::function<dealii::Tensor<2, dim>(double const)> const rotation;
+  std::function<dealii::Tensor<1, dim>(double const)> const translation;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_RIGID_BODY_MOTION_H_ */
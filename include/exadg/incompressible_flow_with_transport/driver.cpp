@@ -23,6 +23,7 @@
 #include <exadg/incompressible_flow_with_transport/driver.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -30,7 +31,8 @@ namespace ExaDG
 namespace FTI
 {
 template<int dim, typename Number>
-Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
+Driver<dim, Number>::Driver(std::string const &                           input_file,
+                            MPI_Comm const &                              comm,
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
                             bool const                                    is_test)
   : mpi_comm(comm),
@@ -38,9 +40,15 @@ Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
     is_test(is_test),
     application(app),
     use_adaptive_time_stepping(false),
+    defer_time_step_reduction(false),
+    coupling_iterations({0, 0}),
     N_time_steps(0)
 {
   print_general_info<Number>(pcout, mpi_comm, is_test);
+
+  dealii::ParameterHandler prm;
+  parameters.add_parameters(prm);
+  prm.parse_input(input_file, "", true, true);
 }
 
 template<int dim, typename Number>
@@ -54,6 +62,9 @@ Driver<dim, Number>::setup()
 
   application->setup(grid, mapping, multigrid_mappings);
 
+  application->fluid->get_parameters().parallelization.setup_threads();
+  application->fluid->get_parameters().parallelization.setup_shared_memory_communicator();
+
   // additional parameter check: This driver does not implement steady
   // flow-transport problems. Note, however, that ProblemType and
   // SolverType might be Steady for the fluid problem in order to be able
@@ -170,6 +181,8 @@ Driver<dim, Number>::setup()
     matrix_free_data->append(scalar_operator[i]);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
+  application->fluid->get_parameters().parallelization.fill_additional_data(
+    matrix_free_data->data, mpi_comm);
   if(application->fluid->get_parameters().use_cell_based_face_loops)
     Categorization::do_cell_based_loops(*grid->triangulation, matrix_free_data->data);
 
@@ -179,6 +192,8 @@ Driver<dim, Number>::setup()
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
+  memory_matrix_free.set(matrix_free->memory_consumption());
+
   for(unsigned int i = 0; i < n_scalars; ++i)
   {
     AssertThrow(
@@ -208,12 +223,23 @@ Driver<dim, Number>::setup()
                               fluid_operator->get_dof_name_velocity());
   }
 
-  // Initialize DoF-vector temperature in case of transport->fluid coupling with Boussinesq term:
-  if(application->fluid->get_parameters().boussinesq_term)
+  // The implicit coupling iterates on the temperature, which is coupled to the fluid via the
+  // Boussinesq term. All scalar solves are repeated within the coupling iterations, which requires
+  // BDF time integration of the scalars.
+  if(parameters.coupling_scheme == CouplingScheme::Implicit)
   {
-    // assume that the first scalar quantity with index 0 is the active scalar coupled to the
-    // incompressible Navier-Stokes equations via the Boussinesq term
-    scalar_operator[0]->initialize_dof_vector(temperature);
+    AssertThrow(application->fluid->get_parameters().boussinesq_term,
+                dealii::ExcMessage("Implicit coupling requires the Boussinesq term."));
+
+    for(unsigned int i = 0; i < n_scalars; ++i)
+    {
+      AssertThrow(application->scalars[i]->get_parameters().temporal_discretization ==
+                    ConvDiff::TemporalDiscretization::BDF,
+                  dealii::ExcMessage("Implicit coupling requires BDF time integration of the "
+                                     "scalar transport."));
+    }
+
+    scalar_operator[0]->initialize_dof_vector(temperature_last_iter);
   }
 
   // setup postprocessor
@@ -303,13 +329,64 @@ Driver<dim, Number>::setup()
                   "An analytical velocity field can not be used for this coupled solver."));
   }
 
+  // The velocity is interpolated in time only once per Runge-Kutta stage for all scalars, since
+  // all scalars are transported by the same velocity field.
+  for(unsigned int i = 0; i < n_scalars; ++i)
+  {
+    ConvDiff::Parameters const & scalar_param_i = application->scalars[i]->get_parameters();
+
+    if(scalar_param_i.temporal_discretization == ConvDiff::TemporalDiscretization::ExplRK and
+       scalar_param_i.convective_problem())
+    {
+      if(scalar_velocity_interpolated.get() == nullptr)
+      {
+        scalar_velocity_interpolated = std::make_shared<ConvDiff::InterpolatedVelocity<Number>>();
+
+        dealii::LinearAlgebra::distributed::Vector<Number> velocity;
+        scalar_operator[i]->initialize_dof_vector_velocity(velocity);
+        scalar_velocity_interpolated->reinit(velocity);
+      }
+
+      std::shared_ptr<ConvDiff::TimeIntExplRK<Number>> time_int_scalar =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntExplRK<Number>>(scalar_time_integrator[i]);
+      time_int_scalar->set_interpolated_velocity(scalar_velocity_interpolated);
+    }
+  }
+
   // Initialize member variable use_adaptive_time_stepping
   if(application->fluid->get_parameters().adaptive_time_stepping == true)
   {
     use_adaptive_time_stepping = true;
   }
 
+  // The time step sizes written to restart files have to be the global ones, so the reduction
+  // can not be deferred when writing restart data.
+  if(use_adaptive_time_stepping)
+  {
+    bool write_restart = false;
+    if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
+      write_restart = application->fluid->get_parameters().restart_data.write_restart;
+
+    for(unsigned int i = 0; i < application->scalars.size(); ++i)
+      write_restart =
+        write_restart or application->scalars[i]->get_parameters().restart_data.write_restart;
+
+    defer_time_step_reduction = not write_restart;
+  }
+
+  if(defer_time_step_reduction)
+  {
+    if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
+      fluid_time_integrator->enable_deferred_time_step_reduction();
+
+    for(unsigned int i = 0; i < application->scalars.size(); ++i)
+      scalar_time_integrator[i]->enable_deferred_time_step_reduction();
+  }
+
   timer_tree.insert({"Flow + transport", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -343,6 +420,20 @@ Driver<dim, Number>::set_start_time() const
 template<int dim, typename Number>
 void
 Driver<dim, Number>::synchronize_time_step_size() const
+{
+  double const time_step_size = calculate_combined_time_step_size();
+
+  if(use_adaptive_time_stepping == false)
+  {
+    pcout << std::endl << "Combined time step size dt = " << time_step_size << std::endl;
+  }
+
+  set_combined_time_step_size(time_step_size);
+}
+
+template<int dim, typename Number>
+double
+Driver<dim, Number>::calculate_combined_time_step_size() const
 {
   double const EPSILON = 1.e-10;
 
@@ -390,11 +481,13 @@ Driver<dim, Number>::synchronize_time_step_size() const
     time_step_size = std::min(time_step_size, time_step_size_scalar);
   }
 
-  if(use_adaptive_time_stepping == false)
-  {
-    pcout << std::endl << "Combined time step size dt = " << time_step_size << std::endl;
-  }
+  return time_step_size;
+}
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::set_combined_time_step_size(double const time_step_size) const
+{
   // Set the same time step size for both solvers
 
   // fluid
@@ -412,7 +505,7 @@ Driver<dim, Number>::synchronize_time_step_size() const
 
 template<int dim, typename Number>
 void
-Driver<dim, Number>::communicate_scalar_to_fluid() const
+Driver<dim, Number>::communicate_scalar_to_fluid(bool const use_extrapolation) const
 {
   // We need to communicate between fluid solver and scalar transport solver, i.e., ask the
   // scalar transport solver (scalar 0 by definition) for the temperature and hand it over to the
@@ -420,27 +513,41 @@ Driver<dim, Number>::communicate_scalar_to_fluid() const
   if(application->fluid->get_parameters().boussinesq_term)
   {
     // assume that the first scalar quantity with index 0 is the active scalar coupled to
-    // the incompressible Navier-Stokes equations via the Boussinesq term
-    if(application->scalars[0]->get_parameters().temporal_discretization ==
-       ConvDiff::TemporalDiscretization::ExplRK)
+    // the incompressible Navier-Stokes equations via the Boussinesq term. The vectors of the scalar
+    // time integrator are handed over by reference, i.e., the extrapolated temperature is only
+    // computed within the matrix-free loop of the fluid solver.
+    std::vector<dealii::LinearAlgebra::distributed::Vector<Number> const *> temperatures;
+    std::vector<double>                                                     factors;
+
+    if(not(use_extrapolation))
+    {
+      std::shared_ptr<ConvDiff::TimeIntBDF<dim, Number>> time_int_scalar =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[0]);
+      AssertThrow(time_int_scalar.get() != nullptr, dealii::ExcMessage("Not implemented."));
+
+      temperatures = {&time_int_scalar->get_solution_np()};
+      factors      = {1.0};
+    }
+    else if(application->scalars[0]->get_parameters().temporal_discretization ==
+            ConvDiff::TemporalDiscretization::ExplRK)
     {
       std::shared_ptr<ConvDiff::TimeIntExplRK<Number>> time_int_scalar =
         std::dynamic_pointer_cast<ConvDiff::TimeIntExplRK<Number>>(scalar_time_integrator[0]);
-      time_int_scalar->extrapolate_solution(temperature);
+      time_int_scalar->get_extrapolation(temperatures, factors);
     }
     else if(application->scalars[0]->get_parameters().temporal_discretization ==
             ConvDiff::TemporalDiscretization::BDF)
     {
       std::shared_ptr<ConvDiff::TimeIntBDF<dim, Number>> time_int_scalar =
         std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[0]);
-      time_int_scalar->extrapolate_solution(temperature);
+      time_int_scalar->get_extrapolation(temperatures, factors);
     }
     else
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
 
-    fluid_operator->set_temperature(temperature);
+    fluid_operator->set_temperature(temperatures, factors);
   }
 }
 
@@ -471,6 +578,9 @@ Driver<dim, Number>::communicate_fluid_to_all_scalars() const
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
 
+  if(scalar_velocity_interpolated.get() != nullptr)
+    scalar_velocity_interpolated->set_velocities_and_times(velocities, times);
+
   for(unsigned int i = 0; i < application->scalars.size(); ++i)
   {
     if(application->scalars[i]->get_parameters().temporal_discretization ==
@@ -494,6 +604,127 @@ Driver<dim, Number>::communicate_fluid_to_all_scalars() const
   }
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_fluid(bool const use_extrapolation) const
+{
+  if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
+  {
+    if(parameters.coupling_scheme == CouplingScheme::Implicit)
+      fluid_time_integrator->advance_one_timestep_partitioned_solve(use_extrapolation);
+    else
+      fluid_time_integrator->advance_one_timestep_solve();
+  }
+  else if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Steady)
+  {
+    // the postprocessing is done separately in case of implicit coupling
+    if(parameters.coupling_scheme == CouplingScheme::Implicit)
+      fluid_driver_steady->do_solve(scalar_time_integrator[0]->get_next_time(), true /*unsteady*/);
+    else
+      fluid_driver_steady->solve(scalar_time_integrator[0]->get_next_time(), true /*unsteady*/);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_coupling_staggered() const
+{
+  // Communicate scalar -> fluid
+  communicate_scalar_to_fluid();
+
+  // fluid: advance one time step
+  solve_fluid(true /* use_extrapolation */);
+
+  // Communicate fluid -> all scalars
+  communicate_fluid_to_all_scalars();
+
+  // scalar transport: advance one time step
+  for(unsigned int i = 0; i < application->scalars.size(); ++i)
+    scalar_time_integrator[i]->advance_one_timestep_solve();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_coupling_implicit() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  bool const fluid_is_steady =
+    application->fluid->get_parameters().solver_type == IncNS::SolverType::Steady;
+
+  bool const print_solver_info =
+    fluid_is_steady ? not(is_test) : fluid_time_integrator->print_solver_info();
+
+  if(fluid_is_steady)
+    fluid_driver_steady->postprocessing(scalar_time_integrator[0]->get_next_time(), true);
+
+  std::shared_ptr<ConvDiff::TimeIntBDF<dim, Number>> time_int_temperature =
+    std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[0]);
+
+  /*
+   * Fixed-point iterations of the coupled problem: the fluid is solved for the temperature of the
+   * previous iteration (extrapolated in time in the first iteration), and the scalars are solved
+   * for the velocity of the current iteration.
+   */
+  bool         converged = false;
+  unsigned int k         = 0;
+  while(not(converged) and k < parameters.coupling_iter_max)
+  {
+    bool const first_iteration = (k == 0);
+
+    if(not(first_iteration))
+      temperature_last_iter = time_int_temperature->get_solution_np();
+
+    communicate_scalar_to_fluid(first_iteration);
+
+    solve_fluid(first_iteration);
+
+    communicate_fluid_to_all_scalars();
+
+    for(unsigned int i = 0; i < application->scalars.size(); ++i)
+      scalar_time_integrator[i]->advance_one_timestep_solve();
+
+    ++k;
+
+    // check convergence based on the increment of the temperature, which is not available in the
+    // first iteration
+    if(not(first_iteration))
+    {
+      VectorType const & temperature = time_int_temperature->get_solution_np();
+
+      temperature_last_iter.sadd(-1.0, 1.0, temperature);
+      double const increment_norm = temperature_last_iter.l2_norm();
+
+      converged = (increment_norm < parameters.abs_tol) or
+                  (increment_norm < parameters.rel_tol * temperature.l2_norm());
+    }
+  }
+
+  AssertThrow(converged or parameters.coupling_iter_max == 1,
+              dealii::ExcMessage("Coupling iterations of fluid and scalar transport did not "
+                                 "converge within CouplingIterMax iterations."));
+
+  if(fluid_is_steady)
+    fluid_driver_steady->postprocessing(scalar_time_integrator[0]->get_next_time(), true);
+
+  coupling_iterations.first += 1;
+  coupling_iterations.second += k;
+
+  if(print_solver_info)
+  {
+    pcout << std::endl
+          << "Coupling of fluid and scalar transport converged in " << k << " iterations."
+          << std::endl;
+  }
+
+  timer_tree.insert({"Flow + transport", "Coupling iterations"}, timer.wall_time());
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::ale_update() const
@@ -557,43 +788,54 @@ Driver<dim, Number>::solve() const
      *  solve
      */
 
-    // Communicate scalar -> fluid
-    communicate_scalar_to_fluid();
-
-    // fluid: advance one time step
-    if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
-    {
-      fluid_time_integrator->advance_one_timestep_solve();
-    }
-    else if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Steady)
-    {
-      fluid_driver_steady->solve(scalar_time_integrator[0]->get_next_time(), true /*unsteady*/);
-    }
+    if(parameters.coupling_scheme == CouplingScheme::Implicit)
+      solve_coupling_implicit();
     else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
-
-    // Communicate fluid -> all scalars
-    communicate_fluid_to_all_scalars();
-
-    // scalar transport: advance one time step
-    for(unsigned int i = 0; i < application->scalars.size(); ++i)
-      scalar_time_integrator[i]->advance_one_timestep_solve();
+      solve_coupling_staggered();
 
     /*
      * post solve
      */
-    if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
-      fluid_time_integrator->advance_one_timestep_post_solve();
+    if(defer_time_step_reduction)
+    {
+      if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
+        fluid_time_integrator->advance_one_timestep_post_solve_update();
 
-    for(unsigned int i = 0; i < application->scalars.size(); ++i)
-      scalar_time_integrator[i]->advance_one_timestep_post_solve();
+      for(unsigned int i = 0; i < application->scalars.size(); ++i)
+        scalar_time_integrator[i]->advance_one_timestep_post_solve_update();
 
-    // Both solvers have already calculated the new, adaptive time step size individually in
-    // function advance_one_timestep(). Here, we have to synchronize the time step size.
-    if(use_adaptive_time_stepping == true)
-      synchronize_time_step_size();
+      // The solvers have calculated process-local time step sizes. Compute the minimum over all
+      // solvers and processes in a single reduction, overlapped with the postprocessing.
+      double      time_step_size = calculate_combined_time_step_size();
+      MPI_Request request;
+      int         ierr =
+        MPI_Iallreduce(MPI_IN_PLACE, &time_step_size, 1, MPI_DOUBLE, MPI_MIN, mpi_comm, &request);
+      AssertThrowMPI(ierr);
+
+      if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
+        fluid_time_integrator->advance_one_timestep_post_solve_postprocessing();
+
+      for(unsigned int i = 0; i < application->scalars.size(); ++i)
+        scalar_time_integrator[i]->advance_one_timestep_post_solve_postprocessing();
+
+      ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      set_combined_time_step_size(time_step_size);
+    }
+    else
+    {
+      if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
+        fluid_time_integrator->advance_one_timestep_post_solve();
+
+      for(unsigned int i = 0; i < application->scalars.size(); ++i)
+        scalar_time_integrator[i]->advance_one_timestep_post_solve();
+
+      // Both solvers have already calculated the new, adaptive time step size individually in
+      // function advance_one_timestep(). Here, we have to synchronize the time step size.
+      if(use_adaptive_time_stepping == true)
+        synchronize_time_step_size();
+    }
 
     // check if all finished
     if(application->fluid->get_parameters().solver_type == IncNS::SolverType::Unsteady)
@@ -622,6 +864,21 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   // Iterations
   this->pcout << std::endl << "Average number of iterations:" << std::endl;
 
+  // Coupling
+  if(parameters.coupling_scheme == CouplingScheme::Implicit)
+  {
+    this->pcout << std::endl << "Implicit coupling of fluid and scalar transport:" << std::endl;
+
+    std::vector<std::string> names = {"Coupling iterations"};
+
+    std::vector<double> iterations_avg;
+    iterations_avg.resize(1);
+    iterations_avg[0] =
+      (double)coupling_iterations.second / std::max(1.0, (double)coupling_iterations.first);
+
+    print_list_of_iterations(pcout, names, iterations_avg);
+  }
+
   // Fluid
   this->pcout << std::endl << "Incompressible Navier-Stokes solver:" << std::endl;
 
@@ -692,6 +949,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index DoFs = this->fluid_operator->get_number_of_dofs();
 
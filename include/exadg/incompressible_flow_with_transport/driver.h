@@ -23,11 +23,13 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_FLOW_WITH_TRANSPORT_DRIVER_H_
 
 // application
+#include <exadg/incompressible_flow_with_transport/parameters.h>
 #include <exadg/incompressible_flow_with_transport/user_interface/application_base.h>
 
 // utilities
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 #include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 #include <exadg/utilities/timer_tree.h>
@@ -55,7 +57,8 @@ template<int dim, typename Number = double>
 class Driver
 {
 public:
-  Driver(MPI_Comm const &                              mpi_comm,
+  Driver(std::string const &                           input_file,
+         MPI_Comm const &                              mpi_comm,
          std::shared_ptr<ApplicationBase<dim, Number>> application,
          bool const                                    is_test);
 
@@ -74,18 +77,43 @@ private:
   void
   ale_update() const;
 
+  /*
+   * Hands the temperature over to the fluid solver, which is the temperature extrapolated in time
+   * if use_extrapolation is true and the current solution of the scalar transport otherwise.
+   */
   void
-  communicate_scalar_to_fluid() const;
+  communicate_scalar_to_fluid(bool const use_extrapolation = true) const;
 
   void
   communicate_fluid_to_all_scalars() const;
 
+  void
+  solve_fluid(bool const use_extrapolation) const;
+
+  // one time step with staggered coupling, i.e., one solve of the fluid and of each scalar
+  void
+  solve_coupling_staggered() const;
+
+  // one time step with implicit coupling, i.e., fixed-point iterations of fluid and scalar solves
+  void
+  solve_coupling_implicit() const;
+
   void
   set_start_time() const;
 
   void
   synchronize_time_step_size() const;
 
+  /*
+   * Minimum of the time step sizes of all solvers. In case of deferred time step reduction, this
+   * is only the minimum over the current process.
+   */
+  double
+  calculate_combined_time_step_size() const;
+
+  void
+  set_combined_time_step_size(double const time_step_size) const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -98,6 +126,9 @@ private:
   // application
   std::shared_ptr<ApplicationBase<dim, Number>> application;
 
+  // parameters of the coupling of fluid and scalar transport
+  Parameters parameters;
+
   std::shared_ptr<Grid<dim>> grid;
 
   std::shared_ptr<dealii::Mapping<dim>> mapping;
@@ -114,9 +145,15 @@ private:
 
   bool use_adaptive_time_stepping;
 
+  // In case of adaptive time stepping, the solvers only compute process-local time step sizes,
+  // and the minimum over all solvers and processes is computed in a single non-blocking reduction
+  // overlapped with the postprocessing.
+  bool defer_time_step_reduction;
+
   //  MatrixFree (only a single object for both flow and transport problems)
   std::shared_ptr<MatrixFreeData<dim, Number>>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free;
+  MemoryReport::Entry                              memory_matrix_free{MemoryCategory::MatrixFree};
 
   // INCOMPRESSIBLE NAVIER-STOKES
 
@@ -141,7 +178,14 @@ private:
 
   std::vector<std::shared_ptr<TimeIntBase>> scalar_time_integrator;
 
-  mutable dealii::LinearAlgebra::distributed::Vector<Number> temperature;
+  // velocity interpolated in time, shared by all scalars with explicit Runge-Kutta time integration
+  std::shared_ptr<ConvDiff::InterpolatedVelocity<Number>> scalar_velocity_interpolated;
+
+  // implicit coupling: temperature of the previous coupling iteration
+  mutable VectorType temperature_last_iter;
+
+  // implicit coupling: number of time steps and accumulated number of coupling iterations
+  mutable std::pair<unsigned int, unsigned long long> coupling_iterations;
 
   /*
    * Computation time (wall clock time).
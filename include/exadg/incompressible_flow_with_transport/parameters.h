@@ -0,0 +1,101 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_FLOW_WITH_TRANSPORT_PARAMETERS_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_FLOW_WITH_TRANSPORT_PARAMETERS_H_
+
+// deal.II
+#include <deal.II/base/parameter_handler.h>
+
+// ExaDG
+#include <exadg/utilities/enum_patterns.h>
+
+namespace ExaDG
+{
+namespace FTI
+{
+/*
+ * Staggered: the fluid is solved for the temperature extrapolated in time, and the scalars are
+ * solved for the new velocity afterwards, i.e., the buoyancy term is treated explicitly.
+ * Implicit: the fluid and scalar solves are repeated within each time step until the temperature
+ * has converged, such that the buoyancy term and the transport by the velocity are treated
+ * implicitly as in a monolithic solve of the coupled problem.
+ */
+enum class CouplingScheme
+{
+  Staggered,
+  Implicit
+};
+
+struct Parameters
+{
+  Parameters()
+    : coupling_scheme(CouplingScheme::Staggered),
+      abs_tol(1.e-12),
+      rel_tol(1.e-6),
+      coupling_iter_max(100)
+  {
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm, std::string const & subsection_name = "Coupling")
+  {
+    prm.enter_subsection(subsection_name);
+    {
+      prm.add_parameter("CouplingScheme",
+                        coupling_scheme,
+                        "Staggered or implicit coupling of fluid and scalar transport.",
+                        Patterns::Enum<CouplingScheme>(),
+                        false);
+      prm.add_parameter("AbsTol",
+                        abs_tol,
+                        "Absolute tolerance of the coupling iterations.",
+                        dealii::Patterns::Double(0.0, 1.0),
+                        false);
+      prm.add_parameter("RelTol",
+                        rel_tol,
+                        "Relative tolerance of the coupling iterations.",
+                        dealii::Patterns::Double(0.0, 1.0),
+                        false);
+      prm.add_parameter("CouplingIterMax",
+                        coupling_iter_max,
+                        "Maximum number of coupling iterations per time step.",
+                        dealii::Patterns::Integer(1, 1000),
+                        false);
+    }
+    prm.leave_subsection();
+  }
+
+  CouplingScheme coupling_scheme;
+
+  // the coupling iterations are converged if the l2-norm of the increment of the temperature is
+  // below abs_tol or below rel_tol times the l2-norm of the temperature
+  double abs_tol;
+  double rel_tol;
+
+  unsigned int coupling_iter_max;
+};
+
+} // namespace FTI
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_FLOW_WITH_TRANSPORT_PARAMETERS_H_ */
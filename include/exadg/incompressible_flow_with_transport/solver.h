@@ -31,6 +31,8 @@
 // utilities
 #include <exadg/utilities/enum_patterns.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
 
 // application
 #include <exadg/incompressible_flow_with_transport/user_interface/declare_get_application.h>
@@ -45,6 +47,9 @@ create_input_file(std::string const & input_file)
   GeneralParameters general;
   general.add_parameters(prm);
 
+  FTI::Parameters fti_data;
+  fti_data.add_parameters(prm);
+
   // we have to assume a default dimension and default Number type
   // for the automatic generation of a default input file
   unsigned int const Dim = 2;
@@ -67,7 +72,7 @@ run(std::string const & input_file, MPI_Comm const & mpi_comm, bool const is_tes
     FTI::get_application<dim, Number>(input_file, mpi_comm);
 
   std::shared_ptr<FTI::Driver<dim, Number>> driver =
-    std::make_shared<FTI::Driver<dim, Number>>(mpi_comm, application, is_test);
+    std::make_shared<FTI::Driver<dim, Number>>(input_file, mpi_comm, application, is_test);
 
   driver->setup();
 
@@ -83,6 +88,8 @@ main(int argc, char ** argv)
 {
   dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
 
+  ExaDG::ProfilingSession profiling;
+
   MPI_Comm mpi_comm(MPI_COMM_WORLD);
 
   std::string input_file;
@@ -137,6 +144,9 @@ main(int argc, char ** argv)
                 dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
   }
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
   return 0;
 }
 
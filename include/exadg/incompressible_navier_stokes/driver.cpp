@@ -29,12 +29,48 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
 #include <exadg/operators/throughput_parameters.h>
+#include <exadg/reduced_order_model/galerkin_reduced_order_model.h>
+#include <exadg/reduced_order_model/proper_orthogonal_decomposition.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
 {
 namespace IncNS
 {
+namespace
+{
+/*
+ * The solution computed during the p-sequenced startup at low polynomial degree is not
+ * postprocessed.
+ */
+template<int dim, typename Number>
+class PostProcessorStartup : public PostProcessorBase<dim, Number>
+{
+  typedef typename PostProcessorBase<dim, Number>::VectorType VectorType;
+
+public:
+  void
+  setup(SpatialOperatorBase<dim, Number> const & pde_operator) final
+  {
+    (void)pde_operator;
+  }
+
+  void
+  do_postprocessing(VectorType const &     velocity,
+                    VectorType const &     pressure,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)velocity;
+    (void)pressure;
+    (void)time;
+    (void)time_step_number;
+  }
+};
+} // namespace
+
 template<int dim, typename Number>
 Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
@@ -60,6 +96,9 @@ Driver<dim, Number>::setup()
 
   application->setup(grid, mapping, multigrid_mappings);
 
+  application->get_parameters().parallelization.setup_threads();
+  application->get_parameters().parallelization.setup_shared_memory_communicator();
+
   // moving mesh (ALE formulation)
   bool const ale = application->get_parameters().ale_formulation;
 
@@ -160,6 +199,9 @@ Driver<dim, Number>::setup()
         pde_operator, helpers_ale, postprocessor, application->get_parameters(), mpi_comm, is_test);
 
       time_integrator->setup(application->get_parameters().restarted_simulation);
+
+      if(application->get_parameters().startup_degree_u > 0)
+        setup_startup();
     }
     else if(application->get_parameters().solver_type == SolverType::Steady)
     {
@@ -179,6 +221,168 @@ Driver<dim, Number>::setup()
   }
 
   timer_tree.insert({"Incompressible flow", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_startup()
+{
+  pcout << std::endl << "Setting up p-sequenced startup:" << std::endl;
+
+  // The startup phase uses the parameters of the production run except for the polynomial degree
+  // and the end time. Restart files are only written by the production run.
+  startup_parameters                            = application->get_parameters();
+  startup_parameters.degree_u                   = application->get_parameters().startup_degree_u;
+  startup_parameters.end_time                   = application->get_parameters().startup_end_time;
+  startup_parameters.startup_degree_u           = 0;
+  startup_parameters.restart_data.write_restart = false;
+
+  startup_pde_operator = create_operator<dim, Number>(grid,
+                                                      mapping,
+                                                      multigrid_mappings,
+                                                      application->get_boundary_descriptor(),
+                                                      application->get_field_functions(),
+                                                      startup_parameters,
+                                                      "fluid_startup",
+                                                      mpi_comm);
+
+  startup_pde_operator->setup();
+
+  startup_time_integrator =
+    create_time_integrator<dim, Number>(startup_pde_operator,
+                                        helpers_ale,
+                                        std::make_shared<PostProcessorStartup<dim, Number>>(),
+                                        startup_parameters,
+                                        mpi_comm,
+                                        is_test);
+
+  startup_time_integrator->setup(false /* do_restart */);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_startup() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  pcout << std::endl
+        << "Startup phase with polynomial degree " << startup_parameters.degree_u
+        << " until t = " << startup_parameters.end_time << ":" << std::endl;
+
+  startup_time_integrator->timeloop();
+
+  startup_time_integrator->transfer_state(*time_integrator);
+
+  startup_time_integrator.reset();
+  startup_pde_operator.reset();
+
+  timer_tree.insert({"Incompressible flow", "Startup"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_reduced_order_model() const
+{
+  Parameters const & param = application->get_parameters();
+
+  dealii::Timer timer;
+  timer.restart();
+
+  // offline phase: full-order model in the training interval
+  pcout << std::endl
+        << "Training phase of reduced-order model until t = " << param.rom_training_end_time << ":"
+        << std::endl;
+
+  ProperOrthogonalDecomposition<Number> pod;
+
+  unsigned int counter = 0;
+  while(not(time_integrator->finished()) and
+        time_integrator->get_time() < param.rom_training_end_time)
+  {
+    time_integrator->advance_one_timestep();
+
+    if(++counter % param.rom_snapshot_interval == 0)
+      pod.add_snapshot(time_integrator->get_velocity());
+  }
+
+  timer_tree.insert({"Incompressible flow", "ROM training"}, timer.wall_time());
+
+  timer.restart();
+
+  auto const apply_mass = [&](VectorType & dst, VectorType const & src) {
+    pde_operator->apply_mass_operator(dst, src);
+  };
+
+  unsigned int const n_snapshots = pod.n_snapshots();
+
+  pod.compute(apply_mass, param.rom_max_modes, param.rom_energy_tolerance);
+
+  double const training_end_time = time_integrator->get_time();
+
+  auto const evaluate_full_order = [&](VectorType & dst, VectorType const & src) {
+    pde_operator->evaluate_momentum_terms(dst, src, training_end_time);
+  };
+
+  typedef GalerkinReducedOrderModel<Number> ReducedOrderModel;
+
+  std::shared_ptr<ReducedOrderModel> reduced_order_model = std::make_shared<ReducedOrderModel>();
+  reduced_order_model->setup(pod.get_modes(), pod.get_mean(), evaluate_full_order, apply_mass);
+
+  timer_tree.insert({"Incompressible flow", "ROM setup"}, timer.wall_time());
+
+  pcout << std::endl << "Reduced-order model:" << std::endl;
+  print_parameter(pcout, "Number of snapshots", n_snapshots);
+  print_parameter(pcout, "Number of POD modes", reduced_order_model->n_modes());
+  print_parameter(pcout, "Captured energy", pod.get_captured_energy());
+
+  // online phase: reduced-order model until the end time
+  timer.restart();
+
+  typename ReducedOrderModel::ReducedVectorType coefficients, coefficients_np;
+  reduced_order_model->initialize_dof_vector(coefficients);
+  reduced_order_model->initialize_dof_vector(coefficients_np);
+  reduced_order_model->project_state(coefficients, time_integrator->get_velocity());
+
+  ExplicitRungeKuttaTimeIntegrator<ReducedOrderModel, typename ReducedOrderModel::ReducedVectorType>
+    runge_kutta(4, reduced_order_model);
+
+  double const time_step_size = time_integrator->get_time_step_size();
+
+  double       time             = training_end_time;
+  unsigned int n_time_steps_rom = 0;
+  while(param.end_time - time > 1.e-12 * time_step_size)
+  {
+    double const time_step = std::min(time_step_size, param.end_time - time);
+
+    runge_kutta.solve_timestep(coefficients_np, coefficients, time, time_step);
+    coefficients.swap(coefficients_np);
+
+    time += time_step;
+    ++n_time_steps_rom;
+  }
+
+  double const wall_time_online = timer.wall_time();
+
+  timer_tree.insert({"Incompressible flow", "ROM online"}, wall_time_online);
+
+  print_parameter(pcout, "Number of time steps", n_time_steps_rom);
+  if(not(is_test))
+    print_parameter(pcout, "Wall time online phase [s]", wall_time_online);
+
+  // the reduced-order model does not provide the pressure
+  VectorType velocity, pressure;
+  pde_operator->initialize_vector_velocity(velocity);
+  pde_operator->initialize_vector_pressure(pressure);
+  reduced_order_model->reconstruct(velocity, coefficients);
+
+  postprocessor->do_postprocessing(velocity,
+                                   pressure,
+                                   time,
+                                   time_integrator->get_time_step_number() + n_time_steps_rom);
 }
 
 template<int dim, typename Number>
@@ -218,6 +422,9 @@ Driver<dim, Number>::solve() const
     // stability analysis (uncomment if desired)
     // time_integrator->postprocessing_stability_analysis();
 
+    if(startup_time_integrator)
+      solve_startup();
+
     if(application->get_parameters().ale_formulation == true)
     {
       while(not(time_integrator->finished()))
@@ -231,6 +438,10 @@ Driver<dim, Number>::solve() const
         time_integrator->advance_one_timestep_post_solve();
       }
     }
+    else if(application->get_parameters().use_reduced_order_model)
+    {
+      solve_reduced_order_model();
+    }
     else
     {
       time_integrator->timeloop();
@@ -258,6 +469,13 @@ Driver<dim, Number>::solve() const
   }
 }
 
+template<int dim, typename Number>
+dealii::types::global_dof_index
+Driver<dim, Number>::get_number_of_dofs() const
+{
+  return pde_operator->get_number_of_dofs();
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::print_performance_results(double const total_time) const
@@ -277,6 +495,10 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     time_integrator->print_iterations();
   }
 
+  // Deferred setup of solvers and preconditioners
+  pcout << std::endl << "Deferred setup of solvers:" << std::endl;
+  pde_operator->print_deferred_setups(pcout);
+
   // Wall times
   timer_tree.insert({"Incompressible flow"}, total_time);
 
@@ -295,6 +517,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -327,6 +554,9 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
                                     unsigned int const   n_repetitions_inner,
                                     unsigned int const   n_repetitions_outer) const
 {
+  if(operator_type == OperatorType::FullTimeStep)
+    return apply_time_step(n_repetitions_inner, n_repetitions_outer);
+
   pcout << std::endl << "Computing matrix-vector product ..." << std::endl;
 
   AssertThrow(application->get_parameters().degree_p == DegreePressure::MixedOrder,
@@ -352,6 +582,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
                   operator_type == OperatorType::PressurePoissonOperator or
                   operator_type == OperatorType::HelmholtzOperator or
                   operator_type == OperatorType::ProjectionOperator or
+                  operator_type == OperatorType::ModalFilter or
                   operator_type == OperatorType::InverseMassOperator,
                 dealii::ExcMessage("Invalid operator specified for dual splitting scheme."));
   }
@@ -362,6 +593,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
                   operator_type == OperatorType::PressurePoissonOperator or
                   operator_type == OperatorType::VelocityConvDiffOperator or
                   operator_type == OperatorType::ProjectionOperator or
+                  operator_type == OperatorType::ModalFilter or
                   operator_type == OperatorType::InverseMassOperator,
                 dealii::ExcMessage("Invalid operator specified for pressure-correction scheme."));
   }
@@ -403,6 +635,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
     if(operator_type == OperatorType::ConvectiveOperator or
        operator_type == OperatorType::HelmholtzOperator or
        operator_type == OperatorType::ProjectionOperator or
+       operator_type == OperatorType::ModalFilter or
        operator_type == OperatorType::InverseMassOperator)
     {
       pde_operator->initialize_vector_velocity(src2);
@@ -425,6 +658,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
   {
     if(operator_type == OperatorType::VelocityConvDiffOperator or
        operator_type == OperatorType::ProjectionOperator or
+       operator_type == OperatorType::ModalFilter or
        operator_type == OperatorType::InverseMassOperator)
     {
       pde_operator->initialize_vector_velocity(src2);
@@ -476,6 +710,8 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
         operator_dual_splitting->evaluate_convective_term(dst2,src2,0.0);
       else if(operator_type == OperatorType::ProjectionOperator)
         operator_dual_splitting->apply_projection_operator(dst2,src2);
+      else if(operator_type == OperatorType::ModalFilter)
+        operator_dual_splitting->apply_modal_filter(dst2,src2);
       else if(operator_type == OperatorType::PressurePoissonOperator)
         operator_dual_splitting->apply_laplace_operator(dst2,src2);
       else if(operator_type == OperatorType::InverseMassOperator)
@@ -492,6 +728,8 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
         operator_pressure_correction->apply_momentum_operator(dst2,src2);
       else if(operator_type == OperatorType::ProjectionOperator)
         operator_pressure_correction->apply_projection_operator(dst2,src2);
+      else if(operator_type == OperatorType::ModalFilter)
+        operator_pressure_correction->apply_modal_filter(dst2,src2);
       else if(operator_type == OperatorType::PressurePoissonOperator)
         operator_pressure_correction->apply_laplace_operator(dst2,src2);
       else if(operator_type == OperatorType::InverseMassOperator)
@@ -525,6 +763,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
           operator_type == OperatorType::VelocityConvDiffOperator or
           operator_type == OperatorType::HelmholtzOperator or
           operator_type == OperatorType::ProjectionOperator or
+          operator_type == OperatorType::ModalFilter or
           operator_type == OperatorType::InverseMassOperator)
   {
     dofs = pde_operator->get_dof_handler_u().n_dofs();
@@ -567,6 +806,94 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
                                                                            throughput);
 }
 
+template<int dim, typename Number>
+std::tuple<unsigned int, dealii::types::global_dof_index, double>
+Driver<dim, Number>::apply_time_step(unsigned int const n_repetitions_inner,
+                                     unsigned int const n_repetitions_outer) const
+{
+  pcout << std::endl << "Computing time steps ..." << std::endl;
+
+  Parameters const & param = application->get_parameters();
+
+  AssertThrow(param.solver_type == SolverType::Unsteady,
+              dealii::ExcMessage("The throughput study of a time step requires an unsteady "
+                                 "solver."));
+
+  AssertThrow(param.ale_formulation == false,
+              dealii::ExcMessage("The throughput study of a time step is not implemented for the "
+                                 "ALE formulation."));
+
+  // postprocessor and time integrator are not set up by setup() in case of a throughput study
+  std::shared_ptr<Postprocessor> postprocessor_time_step = application->create_postprocessor();
+  postprocessor_time_step->setup(*pde_operator);
+
+  std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_time_step =
+    create_time_integrator<dim, Number>(
+      pde_operator, helpers_ale, postprocessor_time_step, param, mpi_comm, is_test);
+
+  time_integrator_time_step->setup(false /* restarted */);
+
+  // The solution history is never updated, i.e., all repetitions solve the same systems of
+  // equations with the same initial guesses and, hence, with the same number of iterations. This
+  // excludes the evaluation of the convective term of the new solution done in the update of the
+  // solution history, which is measured by OperatorType::ConvectiveOperator.
+  time_integrator_time_step->advance_one_timestep_pre_solve(false);
+
+  // the first time step also sets up preconditioners and is excluded from the measurements
+  time_integrator_time_step->advance_one_timestep_solve();
+
+  std::shared_ptr<TimerTree> timings = time_integrator_time_step->get_timings();
+  timings->clear();
+
+  unsigned int n_time_steps = 0;
+
+  const std::function<void(void)> time_step = [&](void) {
+    time_integrator_time_step->advance_one_timestep_solve();
+    ++n_time_steps;
+  };
+
+  dealii::types::global_dof_index const dofs =
+    pde_operator->get_dof_handler_u().n_dofs() + pde_operator->get_dof_handler_p().n_dofs();
+
+  unsigned int const fe_degree = param.degree_u;
+
+  // do the measurements
+  double const wall_time = measure_operator_evaluation_time(
+    time_step, fe_degree, n_repetitions_inner, n_repetitions_outer, mpi_comm);
+
+  double const throughput = (double)dofs / wall_time;
+
+  // average wall times of the sub-steps over all time steps, where the throughput of the sub-steps
+  // refers to all degrees of freedom of the time step so that the inverse throughputs add up
+  std::vector<std::pair<std::string, double>> const wall_times_sub_steps =
+    timings->get_wall_times_of_children();
+
+  unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  if(not(is_test))
+  {
+    // clang-format off
+    pcout << std::endl
+          << std::scientific << std::setprecision(4)
+          << "DoFs/sec:        " << throughput << std::endl
+          << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
+
+    pcout << std::endl << "DoFs/sec of sub-steps:" << std::endl;
+    for(auto const & sub_step : wall_times_sub_steps)
+      pcout << "  " << std::setw(20) << std::left << sub_step.first
+            << std::scientific << std::setprecision(4)
+            << (double)dofs * (double)n_time_steps / sub_step.second << std::endl;
+    // clang-format on
+
+    time_integrator_time_step->print_iterations();
+  }
+
+  pcout << std::endl << " ... done." << std::endl << std::endl;
+
+  return std::tuple<unsigned int, dealii::types::global_dof_index, double>(fe_degree,
+                                                                           dofs,
+                                                                           throughput);
+}
 
 template class Driver<2, float>;
 template class Driver<3, float>;
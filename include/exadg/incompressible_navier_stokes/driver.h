@@ -56,8 +56,10 @@ enum class OperatorType{
   ConvectiveOperator,       // convective term (vectorial quantity, velocity)
   HelmholtzOperator,        // mass + viscous (vectorial quantity, velocity)
   ProjectionOperator,       // mass + divergence penalty + continuity penalty (vectorial quantity, velocity)
+  ModalFilter,              // cell-local modal filter (vectorial quantity, velocity)
   VelocityConvDiffOperator, // mass + convective + viscous (vectorial quantity, velocity)
-  InverseMassOperator       // inverse mass operator (vectorial quantity, velocity)
+  InverseMassOperator,      // inverse mass operator (vectorial quantity, velocity)
+  FullTimeStep              // all sub-steps of one time step (velocity and pressure)
 };
 // clang-format on
 
@@ -88,9 +90,10 @@ get_dofs_per_element(OperatorType const &     operator_type,
   unsigned int const pressure_dofs_per_element = ExaDG::get_dofs_per_element(
     element_type, true /* is_dg */, 1 /* n_components */, degree_p, dim);
 
-  // coupled/monolithic problem
+  // coupled/monolithic problem, or velocity and pressure of a complete time step
   if(operator_type == OperatorType::CoupledNonlinearResidual or
-     operator_type == OperatorType::CoupledLinearized)
+     operator_type == OperatorType::CoupledLinearized or
+     operator_type == OperatorType::FullTimeStep)
   {
     return velocity_dofs_per_element + pressure_dofs_per_element;
   }
@@ -99,6 +102,7 @@ get_dofs_per_element(OperatorType const &     operator_type,
           operator_type == OperatorType::VelocityConvDiffOperator or
           operator_type == OperatorType::HelmholtzOperator or
           operator_type == OperatorType::ProjectionOperator or
+          operator_type == OperatorType::ModalFilter or
           operator_type == OperatorType::InverseMassOperator)
   {
     return velocity_dofs_per_element;
@@ -134,6 +138,9 @@ public:
   void
   print_performance_results(double const total_time) const;
 
+  dealii::types::global_dof_index
+  get_number_of_dofs() const;
+
   /*
    * Throughput study
    */
@@ -148,6 +155,35 @@ private:
   void
   ale_update() const;
 
+  /*
+   * p-sequenced startup, see Parameters::startup_degree_u: sets up the spatial and temporal
+   * discretization of the startup phase at low polynomial degree.
+   */
+  void
+  setup_startup();
+
+  /*
+   * Simulates the startup phase and transfers the solution history to the time integrator at the
+   * production degree.
+   */
+  void
+  solve_startup() const;
+
+  /*
+   * POD-Galerkin reduced-order model, see Parameters::use_reduced_order_model: simulates the
+   * training interval with the full-order model while collecting snapshots, and integrates the
+   * reduced-order model until the end time.
+   */
+  void
+  solve_reduced_order_model() const;
+
+  /*
+   * Throughput study of a complete time step of the selected temporal discretization.
+   */
+  std::tuple<unsigned int, dealii::types::global_dof_index, double>
+  apply_time_step(unsigned int const n_repetitions_inner,
+                  unsigned int const n_repetitions_outer) const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -197,6 +233,13 @@ private:
   // unsteady solver
   std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator;
 
+  // p-sequenced startup at low polynomial degree; the data structures are released once the
+  // startup phase is completed
+  Parameters startup_parameters;
+
+  mutable std::shared_ptr<SpatialOperatorBase<dim, Number>> startup_pde_operator;
+  mutable std::shared_ptr<TimeIntBDF<dim, Number>>          startup_time_integrator;
+
   // steady solver
   std::shared_ptr<DriverSteadyProblems<dim, Number>> driver_steady;
 
@@ -0,0 +1,225 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/combined_integrals_calculator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+namespace
+{
+/*
+ * Layout of the integrals of all tools in one vector that is summed over the MPI processes. The
+ * maximum vorticity is stored in the last entry and is not summed.
+ */
+template<int dim, typename Number>
+struct IntegralsLayout
+{
+  static unsigned int const div_and_mass_error = 0;
+  static unsigned int const kinetic_energy =
+    div_and_mass_error + DivergenceAndMassErrorCalculator<dim, Number>::n_integrals;
+  static unsigned int const n_sums =
+    kinetic_energy + KineticEnergyCalculator<dim, Number>::n_integrals;
+  static unsigned int const max_vorticity = n_sums;
+  static unsigned int const size          = n_sums + 1;
+};
+} // namespace
+
+template<int dim, typename Number>
+CombinedIntegralsCalculator<dim, Number>::CombinedIntegralsCalculator(MPI_Comm const & comm)
+  : mpi_comm(comm),
+    matrix_free(nullptr),
+    dof_index(0),
+    quad_index(0),
+    div_and_mass_error(nullptr),
+    kinetic_energy(nullptr)
+{
+}
+
+template<int dim, typename Number>
+void
+CombinedIntegralsCalculator<dim, Number>::setup(
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_in,
+  unsigned int const                      quad_index_in)
+{
+  matrix_free = &matrix_free_in;
+  dof_index   = dof_index_in;
+  quad_index  = quad_index_in;
+}
+
+template<int dim, typename Number>
+void
+CombinedIntegralsCalculator<dim, Number>::evaluate(
+  VectorType const &                              velocity,
+  double const                                    time,
+  bool const                                      unsteady,
+  DivergenceAndMassErrorCalculator<dim, Number> * div_and_mass_error_calculator,
+  KineticEnergyCalculator<dim, Number> *          kinetic_energy_calculator)
+{
+  typedef IntegralsLayout<dim, Number> Layout;
+
+  if(kinetic_energy_calculator != nullptr)
+  {
+    AssertThrow(unsteady,
+                dealii::ExcMessage(
+                  "This postprocessing tool can only be used for unsteady problems."));
+  }
+
+  div_and_mass_error = div_and_mass_error_calculator;
+  kinetic_energy     = kinetic_energy_calculator;
+
+  std::vector<Number> integrals(Layout::size, 0.0);
+
+  // faces are only needed for the mass error
+  if(div_and_mass_error != nullptr)
+  {
+    matrix_free->loop(
+      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, integrals, velocity);
+  }
+  else
+  {
+    matrix_free->cell_loop(&This::cell_loop, this, integrals, velocity);
+  }
+
+  // sum over all MPI processes
+  dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(integrals.data(), Layout::n_sums),
+                              mpi_comm,
+                              dealii::ArrayView<Number>(integrals.data(), Layout::n_sums));
+
+  if(div_and_mass_error != nullptr)
+  {
+    div_and_mass_error->write_integrals(
+      dealii::ArrayView<Number const>(integrals.data() + Layout::div_and_mass_error,
+                                      DivergenceAndMassErrorCalculator<dim, Number>::n_integrals),
+      time,
+      unsteady);
+  }
+
+  if(kinetic_energy != nullptr)
+  {
+    Number const max_vorticity =
+      dealii::Utilities::MPI::max(integrals[Layout::max_vorticity], mpi_comm);
+
+    kinetic_energy->write_integrals(
+      dealii::ArrayView<Number const>(integrals.data() + Layout::kinetic_energy,
+                                      KineticEnergyCalculator<dim, Number>::n_integrals),
+      max_vorticity,
+      time);
+  }
+
+  div_and_mass_error = nullptr;
+  kinetic_energy     = nullptr;
+}
+
+template<int dim, typename Number>
+void
+CombinedIntegralsCalculator<dim, Number>::cell_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & cell_range)
+{
+  typedef IntegralsLayout<dim, Number> Layout;
+
+  CellIntegrator<dim, dim, Number> integrator(matrix_free, dof_index, quad_index);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(src);
+    integrator.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
+
+    unsigned int const n_active_entries = matrix_free.n_active_entries_per_cell_batch(cell);
+
+    if(div_and_mass_error != nullptr)
+    {
+      div_and_mass_error->integrate_cell_batch(
+        integrator,
+        n_active_entries,
+        dealii::ArrayView<Number>(dst.data() + Layout::div_and_mass_error,
+                                  DivergenceAndMassErrorCalculator<dim, Number>::n_integrals));
+    }
+
+    if(kinetic_energy != nullptr)
+    {
+      kinetic_energy->integrate_cell_batch(
+        integrator,
+        n_active_entries,
+        dealii::ArrayView<Number>(dst.data() + Layout::kinetic_energy,
+                                  KineticEnergyCalculator<dim, Number>::n_integrals),
+        dst[Layout::max_vorticity]);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+CombinedIntegralsCalculator<dim, Number>::face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & face_range)
+{
+  typedef IntegralsLayout<dim, Number> Layout;
+
+  FaceIntegrator<dim, dim, Number> integrator_m(matrix_free, true, dof_index, quad_index);
+  FaceIntegrator<dim, dim, Number> integrator_p(matrix_free, false, dof_index, quad_index);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values(src);
+    integrator_m.evaluate(dealii::EvaluationFlags::values);
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values(src);
+    integrator_p.evaluate(dealii::EvaluationFlags::values);
+
+    div_and_mass_error->integrate_face_batch(
+      integrator_m,
+      integrator_p,
+      matrix_free.n_active_entries_per_face_batch(face),
+      dealii::ArrayView<Number>(dst.data() + Layout::div_and_mass_error,
+                                DivergenceAndMassErrorCalculator<dim, Number>::n_integrals));
+  }
+}
+
+template<int dim, typename Number>
+void
+CombinedIntegralsCalculator<dim, Number>::boundary_face_loop(
+  dealii::MatrixFree<dim, Number> const &,
+  std::vector<Number> &,
+  VectorType const &,
+  std::pair<unsigned int, unsigned int> const &)
+{
+}
+
+template class CombinedIntegralsCalculator<2, float>;
+template class CombinedIntegralsCalculator<2, double>;
+
+template class CombinedIntegralsCalculator<3, float>;
+template class CombinedIntegralsCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
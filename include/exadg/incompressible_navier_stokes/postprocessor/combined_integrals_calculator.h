@@ -0,0 +1,105 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_COMBINED_INTEGRALS_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_COMBINED_INTEGRALS_CALCULATOR_H_
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
+#include <exadg/postprocessor/kinetic_energy_calculation.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Evaluates the integrals of several postprocessing tools that are due at the same time in one
+ * loop over cells and faces, such that the velocity is read and evaluated only once per cell and
+ * face batch, and sums the integrals of all tools over the MPI processes in one reduction.
+ * Currently, the divergence and mass error and the kinetic energy (without the evaluation of
+ * individual terms) are combined. All tools have to integrate the velocity with the same
+ * dof_index and quad_index.
+ */
+template<int dim, typename Number>
+class CombinedIntegralsCalculator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef CombinedIntegralsCalculator<dim, Number> This;
+
+  CombinedIntegralsCalculator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        unsigned int const                      dof_index_in,
+        unsigned int const                      quad_index_in);
+
+  /*
+   * Evaluates the tools passed as non-null pointers and writes their results.
+   */
+  void
+  evaluate(VectorType const &                              velocity,
+           double const                                    time,
+           bool const                                      unsteady,
+           DivergenceAndMassErrorCalculator<dim, Number> * div_and_mass_error_calculator,
+           KineticEnergyCalculator<dim, Number> *          kinetic_energy_calculator);
+
+private:
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & cell_range);
+
+  void
+  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & face_range);
+
+  // not needed
+  void
+  boundary_face_loop(dealii::MatrixFree<dim, Number> const &,
+                     std::vector<Number> &,
+                     VectorType const &,
+                     std::pair<unsigned int, unsigned int> const &);
+
+  MPI_Comm const mpi_comm;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+  unsigned int                            dof_index, quad_index;
+
+  // tools evaluated in the current call of evaluate()
+  DivergenceAndMassErrorCalculator<dim, Number> * div_and_mass_error;
+  KineticEnergyCalculator<dim, Number> *          kinetic_energy;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_COMBINED_INTEGRALS_CALCULATOR_H_ \
+        */
@@ -69,10 +69,11 @@ DivergenceAndMassErrorCalculator<dim, Number>::evaluate(VectorType const & veloc
                                                         double const       time,
                                                         const bool         unsteady)
 {
-  if(unsteady)
-    analyze_div_and_mass_error_unsteady(velocity, time);
-  else
-    analyze_div_and_mass_error_steady(velocity);
+  std::vector<Number> integrals(n_integrals, 0.0);
+
+  do_evaluate(*matrix_free, velocity, integrals);
+
+  write_integrals(integrals, time, unsteady);
 }
 
 template<int dim, typename Number>
@@ -80,23 +81,41 @@ void
 DivergenceAndMassErrorCalculator<dim, Number>::do_evaluate(
   dealii::MatrixFree<dim, Number> const & matrix_free,
   VectorType const &                      velocity,
-  Number &                                div_error,
-  Number &                                div_error_reference,
-  Number &                                mass_error,
-  Number &                                mass_error_reference)
+  std::vector<Number> &                   integrals)
 {
-  std::vector<Number> dst(4, 0.0);
   matrix_free.loop(&This::local_compute_div,
                    &This::local_compute_div_face,
                    &This::local_compute_div_boundary_face,
                    this,
-                   dst,
+                   integrals,
                    velocity);
 
-  div_error            = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
-  div_error_reference  = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
-  mass_error           = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
-  mass_error_reference = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+  dealii::Utilities::MPI::sum(integrals, mpi_comm, integrals);
+}
+
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::write_integrals(
+  dealii::ArrayView<Number const> const & integrals,
+  double const                            time,
+  bool const                              unsteady)
+{
+  Number const div_error            = integrals[0];
+  Number const div_error_reference  = integrals[1];
+  Number const mass_error           = integrals[2];
+  Number const mass_error_reference = integrals[3];
+
+  Number div_error_normalized  = div_error / div_error_reference;
+  Number mass_error_normalized = 1.0;
+  if(mass_error_reference > 1.e-12)
+    mass_error_normalized = mass_error / mass_error_reference;
+  else
+    mass_error_normalized = mass_error;
+
+  if(unsteady)
+    write_div_and_mass_error_unsteady(div_error_normalized, mass_error_normalized, time);
+  else
+    write_div_and_mass_error_steady(div_error_normalized, mass_error_normalized);
 }
 
 template<int dim, typename Number>
@@ -109,35 +128,39 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div(
 {
   CellIntegratorU integrator(matrix_free, dof_index, quad_index);
 
-  Number div = 0.;
-  Number ref = 0.;
-
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
     integrator.reinit(cell);
     integrator.read_dof_values(source);
     integrator.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
 
-    scalar div_vec = dealii::make_vectorized_array<Number>(0.);
-    scalar ref_vec = dealii::make_vectorized_array<Number>(0.);
+    integrate_cell_batch(integrator, matrix_free.n_active_entries_per_cell_batch(cell), dst);
+  }
+}
 
-    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-    {
-      vector velocity = integrator.get_value(q);
-      ref_vec += integrator.JxW(q) * velocity.norm();
-      div_vec += integrator.JxW(q) * std::abs(integrator.get_divergence(q));
-    }
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::integrate_cell_batch(
+  CellIntegratorU const &           integrator,
+  unsigned int const                n_active_entries,
+  dealii::ArrayView<Number> const & integrals) const
+{
+  scalar div_vec = dealii::make_vectorized_array<Number>(0.);
+  scalar ref_vec = dealii::make_vectorized_array<Number>(0.);
 
-    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
-    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
-    {
-      div += div_vec[v];
-      ref += ref_vec[v];
-    }
+  for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+  {
+    vector velocity = integrator.get_value(q);
+    ref_vec += integrator.JxW(q) * velocity.norm();
+    div_vec += integrator.JxW(q) * std::abs(integrator.get_divergence(q));
   }
 
-  dst.at(0) += div * data.reference_length_scale;
-  dst.at(1) += ref;
+  // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+  for(unsigned int v = 0; v < n_active_entries; ++v)
+  {
+    integrals[0] += div_vec[v] * data.reference_length_scale;
+    integrals[1] += ref_vec[v];
+  }
 }
 
 template<int dim, typename Number>
@@ -151,9 +174,6 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_face(
   FaceIntegratorU integrator_m(matrix_free, true, dof_index, quad_index);
   FaceIntegratorU integrator_p(matrix_free, false, dof_index, quad_index);
 
-  Number diff_mass_flux = 0.;
-  Number mean_mass_flux = 0.;
-
   for(unsigned int face = face_range.first; face < face_range.second; ++face)
   {
     integrator_m.reinit(face);
@@ -163,29 +183,40 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_face(
     integrator_p.read_dof_values(source);
     integrator_p.evaluate(dealii::EvaluationFlags::values);
 
-    scalar diff_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
-    scalar mean_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+    integrate_face_batch(integrator_m,
+                         integrator_p,
+                         matrix_free.n_active_entries_per_face_batch(face),
+                         dst);
+  }
+}
 
-    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
-    {
-      diff_mass_flux_vec +=
-        integrator_m.JxW(q) * std::abs((integrator_m.get_value(q) - integrator_p.get_value(q)) *
-                                       integrator_m.get_normal_vector(q));
-      mean_mass_flux_vec += integrator_m.JxW(q) *
-                            std::abs(0.5 * (integrator_m.get_value(q) + integrator_p.get_value(q)) *
-                                     integrator_m.get_normal_vector(q));
-    }
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::integrate_face_batch(
+  FaceIntegratorU const &           integrator_m,
+  FaceIntegratorU const &           integrator_p,
+  unsigned int const                n_active_entries,
+  dealii::ArrayView<Number> const & integrals) const
+{
+  scalar diff_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+  scalar mean_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
 
-    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
-    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
-    {
-      diff_mass_flux += diff_mass_flux_vec[v];
-      mean_mass_flux += mean_mass_flux_vec[v];
-    }
+  for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+  {
+    diff_mass_flux_vec +=
+      integrator_m.JxW(q) * std::abs((integrator_m.get_value(q) - integrator_p.get_value(q)) *
+                                     integrator_m.get_normal_vector(q));
+    mean_mass_flux_vec += integrator_m.JxW(q) *
+                          std::abs(0.5 * (integrator_m.get_value(q) + integrator_p.get_value(q)) *
+                                   integrator_m.get_normal_vector(q));
   }
 
-  dst.at(2) += diff_mass_flux;
-  dst.at(3) += mean_mass_flux;
+  // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+  for(unsigned int v = 0; v < n_active_entries; ++v)
+  {
+    integrals[2] += diff_mass_flux_vec[v];
+    integrals[3] += mean_mass_flux_vec[v];
+  }
 }
 
 template<int dim, typename Number>
@@ -200,23 +231,11 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_boundary_face(
 
 template<int dim, typename Number>
 void
-DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unsteady(
-  VectorType const & velocity,
-  double const       time)
+DivergenceAndMassErrorCalculator<dim, Number>::write_div_and_mass_error_unsteady(
+  Number const div_error_normalized,
+  Number const mass_error_normalized,
+  double const time)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
-  Number div_error_normalized  = div_error / div_error_reference;
-  Number mass_error_normalized = 1.0;
-  if(mass_error_reference > 1.e-12)
-    mass_error_normalized = mass_error / mass_error_reference;
-  else
-    mass_error_normalized = mass_error;
-
   // write output file
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
@@ -272,22 +291,10 @@ DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unstea
 
 template<int dim, typename Number>
 void
-DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_steady(
-  VectorType const & velocity)
+DivergenceAndMassErrorCalculator<dim, Number>::write_div_and_mass_error_steady(
+  Number const div_error_normalized,
+  Number const mass_error_normalized)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
-  Number div_error_normalized  = div_error / div_error_reference;
-  Number mass_error_normalized = 1.0;
-  if(mass_error_reference > 1.e-12)
-    mass_error_normalized = mass_error / mass_error_reference;
-  else
-    mass_error_normalized = mass_error;
-
   // write output file
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
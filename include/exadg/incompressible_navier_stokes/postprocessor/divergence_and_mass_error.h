@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_DIVERGENCE_AND_MASS_ERROR_H_
 
 // deal.II
+#include <deal.II/base/array_view.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -84,6 +85,32 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   *  Interface to evaluate the divergence and mass error in a loop over cells and faces shared with
+   *  other postprocessing tools: integrate_cell_batch() adds the contributions of a cell batch,
+   *  whose values and gradients have been evaluated by the integrator, and integrate_face_batch()
+   *  those of an interior face batch, whose values have been evaluated on both sides, to the
+   *  n_integrals integrals (divergence error, reference value, mass error, reference value). After
+   *  the reduction over all MPI processes by the caller, write_integrals() writes the results.
+   */
+  static unsigned int const n_integrals = 4;
+
+  void
+  integrate_cell_batch(CellIntegratorU const &           integrator,
+                       unsigned int const                n_active_entries,
+                       dealii::ArrayView<Number> const & integrals) const;
+
+  void
+  integrate_face_batch(FaceIntegratorU const &           integrator_m,
+                       FaceIntegratorU const &           integrator_p,
+                       unsigned int const                n_active_entries,
+                       dealii::ArrayView<Number> const & integrals) const;
+
+  void
+  write_integrals(dealii::ArrayView<Number const> const & integrals,
+                  double const                            time,
+                  bool const                              unsteady);
+
   TimeControl time_control;
 
 private:
@@ -102,10 +129,7 @@ private:
   void
   do_evaluate(dealii::MatrixFree<dim, Number> const & matrix_free,
               VectorType const &                      velocity,
-              Number &                                div_error,
-              Number &                                div_error_reference,
-              Number &                                mass_error,
-              Number &                                mass_error_reference);
+              std::vector<Number> &                   integrals);
 
   void
   local_compute_div(dealii::MatrixFree<dim, Number> const &       data,
@@ -127,10 +151,13 @@ private:
                                   const std::pair<unsigned int, unsigned int> &);
 
   void
-  analyze_div_and_mass_error_unsteady(VectorType const & velocity, double const time);
+  write_div_and_mass_error_unsteady(Number const div_error_normalized,
+                                    Number const mass_error_normalized,
+                                    double const time);
 
   void
-  analyze_div_and_mass_error_steady(VectorType const & velocity);
+  write_div_and_mass_error_steady(Number const div_error_normalized,
+                                  Number const mass_error_normalized);
 
   MPI_Comm const mpi_comm;
 
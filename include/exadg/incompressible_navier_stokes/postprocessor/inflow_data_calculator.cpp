@@ -22,6 +22,7 @@
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_database.h>
 #include <exadg/postprocessor/solution_interpolation.h>
 
 namespace ExaDG
@@ -45,12 +46,17 @@ InflowDataCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_han
 
   array_dof_indices_and_shape_values.resize(inflow_data.n_points_y * inflow_data.n_points_z);
   array_counter.resize(inflow_data.n_points_y * inflow_data.n_points_z);
+
+  if(inflow_data.write_inflow_data and not inflow_data.database_filename.empty())
+    database_writer =
+      std::make_shared<InflowDatabaseWriter<dim>>(inflow_data.database_filename, mpi_comm);
 }
 
 template<int dim, typename Number>
 void
 InflowDataCalculator<dim, Number>::calculate(
-  dealii::LinearAlgebra::distributed::Vector<Number> const & velocity)
+  dealii::LinearAlgebra::distributed::Vector<Number> const & velocity,
+  double const                                               time)
 {
   if(inflow_data.write_inflow_data == true)
   {
@@ -145,6 +151,9 @@ InflowDataCalculator<dim, Number>::calculate(
           (*inflow_data.array)[array_index] /= Number(array_counter[array_index]);
       }
     }
+
+    if(database_writer)
+      database_writer->write(time, inflow_data);
   }
 }
 
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATA_CALCULATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATA_CALCULATOR_H_
 
+// C/C++
+#include <memory>
+#include <string>
+
 // deal.II
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/point.h>
@@ -36,6 +40,9 @@ namespace ExaDG
 {
 namespace IncNS
 {
+template<int dim>
+class InflowDatabaseWriter;
+
 /*
  * inflow data: use velocity at the outflow of one domain as inflow-BC for another domain
  *
@@ -73,6 +80,8 @@ struct InflowData
       print_parameter(pcout, "Normal coordinate", normal_coordinate);
       print_parameter(pcout, "Number of points in y-direction", n_points_y);
       print_parameter(pcout, "Number of points in z-direction", n_points_z);
+      if(not database_filename.empty())
+        print_parameter(pcout, "Inflow database", database_filename);
     }
   }
 
@@ -94,6 +103,10 @@ struct InflowData
   std::vector<double> * z_values;
   // and the velocity values at n_points_y*n_points_z points
   std::vector<dealii::Tensor<1, dim, double>> * array;
+
+  // If not empty, the inflow data is additionally appended to this file in every evaluation, see
+  // InflowDatabaseWriter. The database can be read by simulations without precursor.
+  std::string database_filename;
 };
 
 template<int dim, typename Number>
@@ -106,7 +119,8 @@ public:
   setup(dealii::DoFHandler<dim> const & dof_handler_velocity, dealii::Mapping<dim> const & mapping);
 
   void
-  calculate(dealii::LinearAlgebra::distributed::Vector<Number> const & velocity);
+  calculate(dealii::LinearAlgebra::distributed::Vector<Number> const & velocity,
+            double const                                               time);
 
 private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
@@ -121,6 +135,8 @@ private:
     array_dof_indices_and_shape_values;
 
   std::vector<unsigned int> array_counter;
+
+  std::shared_ptr<InflowDatabaseWriter<dim>> database_writer;
 };
 
 } // namespace IncNS
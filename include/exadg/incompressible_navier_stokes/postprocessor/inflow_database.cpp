@@ -0,0 +1,259 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_database.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+namespace
+{
+char const magic_string[8] = {'E', 'x', 'a', 'D', 'G', 'I', 'n', 'f'};
+}
+
+template<int dim>
+InflowDatabaseWriter<dim>::InflowDatabaseWriter(std::string const & filename,
+                                                MPI_Comm const &    comm)
+  : header_has_been_written(false), mpi_comm(comm)
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    file.open(filename, std::ios::binary | std::ios::trunc);
+    AssertThrow(file.good(), dealii::ExcMessage("Could not open inflow database " + filename));
+  }
+}
+
+template<int dim>
+void
+InflowDatabaseWriter<dim>::write(double const time, InflowData<dim> const & inflow_data)
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
+
+  if(not header_has_been_written)
+  {
+    std::uint32_t const header[3] = {dim, inflow_data.n_points_y, inflow_data.n_points_z};
+
+    file.write(magic_string, sizeof(magic_string));
+    file.write(reinterpret_cast<char const *>(header), sizeof(header));
+    file.write(reinterpret_cast<char const *>(inflow_data.y_values->data()),
+               inflow_data.n_points_y * sizeof(double));
+    file.write(reinterpret_cast<char const *>(inflow_data.z_values->data()),
+               inflow_data.n_points_z * sizeof(double));
+
+    header_has_been_written = true;
+  }
+
+  std::vector<float> values(inflow_data.array->size() * dim);
+  for(unsigned int i = 0; i < inflow_data.array->size(); ++i)
+    for(unsigned int d = 0; d < dim; ++d)
+      values[i * dim + d] = static_cast<float>((*inflow_data.array)[i][d]);
+
+  file.write(reinterpret_cast<char const *>(&time), sizeof(double));
+  file.write(reinterpret_cast<char const *>(values.data()), values.size() * sizeof(float));
+
+  // keep the database readable in case the precursor simulation stops
+  file.flush();
+
+  AssertThrow(file.good(), dealii::ExcMessage("Could not write to inflow database."));
+}
+
+template<int dim>
+InflowDatabaseReader<dim>::InflowDatabaseReader(std::string const & filename,
+                                                bool const          periodic,
+                                                MPI_Comm const &    comm)
+  : periodic(periodic),
+    mpi_comm(comm),
+    n_points_y(0),
+    n_points_z(0),
+    header_size(0),
+    record_size(0),
+    record_indices{dealii::numbers::invalid_unsigned_int, dealii::numbers::invalid_unsigned_int},
+    prefetched_index(dealii::numbers::invalid_unsigned_int)
+{
+  std::uint32_t header[3] = {0, 0, 0};
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    file.open(filename, std::ios::binary);
+    AssertThrow(file.good(), dealii::ExcMessage("Could not open inflow database " + filename));
+
+    char magic[sizeof(magic_string)];
+    file.read(magic, sizeof(magic));
+    AssertThrow(file.good() and std::memcmp(magic, magic_string, sizeof(magic)) == 0,
+                dealii::ExcMessage(filename + " is not an inflow database."));
+
+    file.read(reinterpret_cast<char *>(header), sizeof(header));
+    AssertThrow(header[0] == dim,
+                dealii::ExcMessage("The inflow database has been written for another dimension."));
+  }
+
+  int ierr = MPI_Bcast(header, 3, MPI_UINT32_T, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  n_points_y = header[1];
+  n_points_z = header[2];
+  y_values.resize(n_points_y);
+  z_values.resize(n_points_z);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    file.read(reinterpret_cast<char *>(y_values.data()), n_points_y * sizeof(double));
+    file.read(reinterpret_cast<char *>(z_values.data()), n_points_z * sizeof(double));
+
+    header_size = file.tellg();
+    record_size = sizeof(double) + n_points_y * n_points_z * dim * sizeof(float);
+
+    // times of all records
+    file.seekg(0, std::ios::end);
+    unsigned int const n_records = (static_cast<std::streamoff>(file.tellg()) - header_size) /
+                                   record_size;
+    AssertThrow(n_records > 0, dealii::ExcMessage("The inflow database contains no records."));
+
+    times.resize(n_records);
+    for(unsigned int i = 0; i < n_records; ++i)
+    {
+      file.seekg(header_size + i * record_size);
+      file.read(reinterpret_cast<char *>(&times[i]), sizeof(double));
+    }
+
+    AssertThrow(file.good() and std::is_sorted(times.begin(), times.end()),
+                dealii::ExcMessage("The records of the inflow database are corrupt."));
+  }
+
+  ierr = MPI_Bcast(y_values.data(), n_points_y, MPI_DOUBLE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+  ierr = MPI_Bcast(z_values.data(), n_points_z, MPI_DOUBLE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+}
+
+template<int dim>
+std::vector<float>
+InflowDatabaseReader<dim>::read_record(unsigned int const index)
+{
+  std::vector<float> values(n_points_y * n_points_z * dim);
+
+  file.seekg(header_size + index * record_size + static_cast<std::streamoff>(sizeof(double)));
+  file.read(reinterpret_cast<char *>(values.data()), values.size() * sizeof(float));
+
+  AssertThrow(file.good(), dealii::ExcMessage("Could not read from inflow database."));
+
+  return values;
+}
+
+template<int dim>
+std::vector<float> const &
+InflowDatabaseReader<dim>::get_record(unsigned int const index)
+{
+  for(unsigned int i = 0; i < 2; ++i)
+    if(record_indices[i] == index)
+      return records[i];
+
+  // replace the record that is not needed for the interpolation
+  unsigned int const slot = (record_indices[0] + 1 == index) ? 1 : 0;
+
+  // wait for the background read before accessing the file
+  if(prefetched_record.valid())
+  {
+    std::vector<float> prefetched = prefetched_record.get();
+    if(prefetched_index == index)
+      records[slot] = std::move(prefetched);
+    else
+      records[slot] = read_record(index);
+  }
+  else
+  {
+    records[slot] = read_record(index);
+  }
+  record_indices[slot] = index;
+
+  return records[slot];
+}
+
+template<int dim>
+void
+InflowDatabaseReader<dim>::read(double const time, InflowData<dim> const & inflow_data)
+{
+  AssertThrow(inflow_data.n_points_y == n_points_y and inflow_data.n_points_z == n_points_z,
+              dealii::ExcMessage("The inflow data does not match the inflow database."));
+
+  *inflow_data.y_values = y_values;
+  *inflow_data.z_values = z_values;
+
+  unsigned int const n_values = n_points_y * n_points_z * dim;
+  std::vector<double> values(n_values);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    // time within the time interval of the database
+    double t = time;
+    if(periodic and times.back() > times.front())
+      t = times.front() + std::fmod(std::max(t - times.front(), 0.0), times.back() - times.front());
+    t = std::min(std::max(t, times.front()), times.back());
+
+    unsigned int const i_1 =
+      std::min<unsigned int>(std::upper_bound(times.begin(), times.end(), t) - times.begin(),
+                             times.size() - 1);
+    unsigned int const i_0 = i_1 > 0 ? i_1 - 1 : 0;
+
+    double const weight = (times[i_1] > times[i_0]) ? (t - times[i_0]) / (times[i_1] - times[i_0]) :
+                                                      1.0;
+
+    std::vector<float> const & record_0 = get_record(i_0);
+    std::vector<float> const & record_1 = get_record(i_1);
+    for(unsigned int k = 0; k < n_values; ++k)
+      values[k] = (1.0 - weight) * record_0[k] + weight * record_1[k];
+
+    // read the next record in the background
+    unsigned int const next = (i_1 + 1 < times.size()) ? i_1 + 1 : (periodic ? 0 : i_1);
+    if(next != i_0 and next != i_1 and not prefetched_record.valid())
+    {
+      prefetched_index  = next;
+      prefetched_record = std::async(std::launch::async, [this, next]() {
+        return read_record(next);
+      });
+    }
+  }
+
+  int const ierr = MPI_Bcast(values.data(), n_values, MPI_DOUBLE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  for(unsigned int i = 0; i < n_points_y * n_points_z; ++i)
+    for(unsigned int d = 0; d < dim; ++d)
+      (*inflow_data.array)[i][d] = values[i * dim + d];
+}
+
+template class InflowDatabaseWriter<2>;
+template class InflowDatabaseWriter<3>;
+
+template class InflowDatabaseReader<2>;
+template class InflowDatabaseReader<3>;
+
+} // namespace IncNS
+} // namespace ExaDG
@@ -0,0 +1,126 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATABASE_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATABASE_H_
+
+// C/C++
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Inflow database: time series of the velocity on the inflow plane described by InflowData,
+ * written to disk by a precursor simulation and read by any number of subsequent main
+ * simulations without running the precursor again.
+ *
+ * The binary file consists of a header (dimension, number of points in y- and z-direction, y-
+ * and z-coordinates) followed by one record per time instant. Each record holds the time and the
+ * velocity values in single precision, which halves the size of the database compared to the
+ * double precision values of the inflow data.
+ */
+template<int dim>
+class InflowDatabaseWriter
+{
+public:
+  InflowDatabaseWriter(std::string const & filename, MPI_Comm const & comm);
+
+  /*
+   * Appends the current inflow data as record for the given time. The inflow data has to be
+   * identical on all processes, as computed by InflowDataCalculator.
+   */
+  void
+  write(double const time, InflowData<dim> const & inflow_data);
+
+private:
+  std::ofstream file;
+
+  bool header_has_been_written;
+
+  MPI_Comm const mpi_comm;
+};
+
+/*
+ * Reads the inflow data at a given time from the database by linear interpolation between the two
+ * records enclosing that time. The records are read sequentially on the first process, where the
+ * next record is read in the background while the main simulation advances in time. For times
+ * after the last record, the database is either repeated periodically or the last record is used.
+ */
+template<int dim>
+class InflowDatabaseReader
+{
+public:
+  InflowDatabaseReader(std::string const & filename, bool const periodic, MPI_Comm const & comm);
+
+  /*
+   * Sets the coordinates and velocity values of the inflow data, whose numbers of points have to
+   * match the database, on all processes.
+   */
+  void
+  read(double const time, InflowData<dim> const & inflow_data);
+
+private:
+  std::vector<float>
+  read_record(unsigned int const index);
+
+  std::vector<float> const &
+  get_record(unsigned int const index);
+
+  std::ifstream file;
+
+  bool const periodic;
+
+  MPI_Comm const mpi_comm;
+
+  unsigned int n_points_y, n_points_z;
+
+  std::vector<double> y_values, z_values;
+
+  // offset of the first record in the file and size of a record in bytes
+  std::streamoff header_size, record_size;
+
+  // times of all records, only on the first process
+  std::vector<double> times;
+
+  // the two most recently used records
+  std::vector<float> records[2];
+  unsigned int       record_indices[2];
+
+  // record read in the background
+  std::future<std::vector<float>> prefetched_record;
+  unsigned int                    prefetched_index;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATABASE_H_ */
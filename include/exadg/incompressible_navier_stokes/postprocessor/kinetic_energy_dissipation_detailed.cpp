@@ -20,6 +20,7 @@
  */
 
 // C/C++
+#include <array>
 #include <fstream>
 
 // ExaDG
@@ -76,14 +77,13 @@ KineticEnergyCalculatorDetailed<dim, Number>::calculate_detailed(VectorType cons
     *this->matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
 
   AssertThrow(navier_stokes_operator != nullptr, dealii::ExcMessage("Invalid pointer."));
-  Number dissipation_convective =
-    navier_stokes_operator->calculate_dissipation_convective_term(velocity, time) / volume;
-  Number dissipation_viscous =
-    navier_stokes_operator->calculate_dissipation_viscous_term(velocity) / volume;
-  Number dissipation_divergence =
-    navier_stokes_operator->calculate_dissipation_divergence_term(velocity) / volume;
-  Number dissipation_continuity =
-    navier_stokes_operator->calculate_dissipation_continuity_term(velocity) / volume;
+  std::array<double, 4> const dissipation_terms =
+    navier_stokes_operator->calculate_dissipation_terms(velocity, time);
+
+  Number dissipation_convective = dissipation_terms[0] / volume;
+  Number dissipation_viscous    = dissipation_terms[1] / volume;
+  Number dissipation_divergence = dissipation_terms[2] / volume;
+  Number dissipation_continuity = dissipation_terms[3] / volume;
 
   // write output file
   if(dealii::Utilities::MPI::this_mpi_process(this->mpi_comm) == 0)
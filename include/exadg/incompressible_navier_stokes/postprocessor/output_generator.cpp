@@ -48,14 +48,17 @@ write_output(
   dealii::LinearAlgebra::distributed::Vector<Number> const &            pressure,
   std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> const & additional_fields,
   unsigned int const                                                    output_counter,
-  MPI_Comm const &                                                      mpi_comm)
+  double const                                                          time,
+  MPI_Comm const &                                                      mpi_comm,
+  OutputWriter<dim> &                                                   output_writer)
 {
   std::string folder = output_data.directory, file = output_data.filename;
 
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
+  flags.compression_level        = get_vtk_compression_level(output_data.compression);
 
-  dealii::DataOut<dim> data_out;
+  SnapshotDataOut<dim> data_out;
   data_out.set_flags(flags);
 
   std::vector<std::string> velocity_names(dim, "velocity");
@@ -114,9 +117,10 @@ write_output(
     }
   }
 
+  select_output_cells(data_out, output_data.material_ids);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  output_writer.write(data_out, folder, file, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -138,6 +142,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
 
   time_control.setup(output_data_in.time_control_data);
 
+  output_writer.setup(output_data_in);
+
   if(output_data.time_control_data.is_active)
   {
     create_directories(output_data.directory, mpi_comm);
@@ -208,7 +214,9 @@ OutputGenerator<dim, Number>::evaluate(
                     pressure,
                     additional_fields,
                     time_control.get_counter(),
-                    mpi_comm);
+                    time,
+                    mpi_comm,
+                    output_writer);
 }
 
 template class OutputGenerator<2, float>;
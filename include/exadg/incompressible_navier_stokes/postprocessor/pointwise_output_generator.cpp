@@ -89,16 +89,34 @@ PointwiseOutputGenerator<dim, Number>::evaluate(VectorType const & velocity,
 {
   this->do_evaluate(
     [&]() {
-      if(pointwise_output_data.write_velocity)
+      if(pointwise_output_data.write_velocity and pointwise_output_data.write_pressure)
       {
-        auto const values =
-          this->template compute_point_values<dim>(velocity, *dof_handler_velocity);
-        this->write_quantity("Velocity", values, 0 /*first_selected_component*/);
+        // evaluate both fields in a single communication round
+        std::vector<dealii::Tensor<1, dim, Number>> velocity_values;
+        std::vector<Number>                         pressure_values;
+        this->template compute_point_values<dim, 1>(velocity_values,
+                                                    pressure_values,
+                                                    velocity,
+                                                    *dof_handler_velocity,
+                                                    pressure,
+                                                    *dof_handler_pressure);
+        this->write_quantity("Velocity", velocity_values, 0 /*first_selected_component*/);
+        this->write_quantity("Pressure", pressure_values);
       }
-      if(pointwise_output_data.write_pressure)
+      else
       {
-        auto const values = this->template compute_point_values<1>(pressure, *dof_handler_pressure);
-        this->write_quantity("Pressure", values);
+        if(pointwise_output_data.write_velocity)
+        {
+          auto const values =
+            this->template compute_point_values<dim>(velocity, *dof_handler_velocity);
+          this->write_quantity("Velocity", values, 0 /*first_selected_component*/);
+        }
+        if(pointwise_output_data.write_pressure)
+        {
+          auto const values =
+            this->template compute_point_values<1>(pressure, *dof_handler_pressure);
+          this->write_quantity("Pressure", values);
+        }
       }
     },
     time,
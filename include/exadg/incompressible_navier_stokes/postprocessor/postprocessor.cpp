@@ -31,15 +31,19 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
   : mpi_comm(comm),
     pp_data(postprocessor_data),
     output_generator(comm),
+    time_averaged_fields_calculator(comm),
     pointwise_output_generator(comm),
+    surface_and_slice_output_generator(comm),
     error_calculator_u(comm),
     error_calculator_p(comm),
     lift_and_drag_calculator(comm),
     pressure_difference_calculator(comm),
     div_and_mass_error_calculator(comm),
     kinetic_energy_calculator(comm),
+    combined_integrals_calculator(comm),
     kinetic_energy_spectrum_calculator(comm),
-    line_plot_calculator(comm)
+    line_plot_calculator(comm),
+    particle_tracker(comm)
 {
 }
 
@@ -63,11 +67,21 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                          *pde_operator.get_mapping(),
                          pp_data.output_data);
 
+  time_averaged_fields_calculator.setup(pde_operator.get_dof_handler_u(),
+                                        pde_operator.get_dof_handler_p(),
+                                        *pde_operator.get_mapping(),
+                                        pp_data.time_averaged_fields_data);
+
   pointwise_output_generator.setup(pde_operator.get_dof_handler_u(),
                                    pde_operator.get_dof_handler_p(),
                                    *pde_operator.get_mapping(),
                                    pp_data.pointwise_output_data);
 
+  surface_and_slice_output_generator.setup(pde_operator.get_dof_handler_u(),
+                                           pde_operator.get_dof_handler_p(),
+                                           *pde_operator.get_mapping(),
+                                           pp_data.surface_and_slice_output_data);
+
   error_calculator_u.setup(pde_operator.get_dof_handler_u(),
                            *pde_operator.get_mapping(),
                            pp_data.error_data_u);
@@ -98,6 +112,10 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                                   pde_operator.get_quad_index_velocity_standard(),
                                   pp_data.kinetic_energy_data);
 
+  combined_integrals_calculator.setup(pde_operator.get_matrix_free(),
+                                      pde_operator.get_dof_index_velocity(),
+                                      pde_operator.get_quad_index_velocity_standard());
+
   kinetic_energy_spectrum_calculator.setup(pde_operator.get_matrix_free(),
                                            pde_operator.get_dof_handler_u(),
                                            pp_data.kinetic_energy_spectrum_data);
@@ -106,6 +124,10 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                              pde_operator.get_dof_handler_p(),
                              *pde_operator.get_mapping(),
                              pp_data.line_plot_data);
+
+  particle_tracker.setup(pde_operator.get_dof_handler_u(),
+                         *pde_operator.get_mapping(),
+                         pp_data.particle_tracking_data);
 }
 
 template<int dim, typename Number>
@@ -135,6 +157,8 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
    */
   if(output_generator.time_control.needs_evaluation(time, time_step_number))
   {
+    evaluate_derived_fields_fused(velocity);
+
     std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> additional_fields_vtu;
     if(pp_data.output_data.write_vorticity)
     {
@@ -188,6 +212,23 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
                               Utilities::is_unsteady_timestep(time_step_number));
   }
 
+  /*
+   *  time-averaged fields
+   */
+  if(time_averaged_fields_calculator.time_control_statistics.time_control.needs_evaluation(
+       time, time_step_number))
+  {
+    time_averaged_fields_calculator.evaluate(velocity,
+                                             pressure,
+                                             Utilities::is_unsteady_timestep(time_step_number));
+  }
+
+  if(time_averaged_fields_calculator.time_control_statistics.write_preliminary_results(
+       time, time_step_number))
+  {
+    time_averaged_fields_calculator.write_output();
+  }
+
   /*
    *  write pointwise output
    */
@@ -199,6 +240,17 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
                                         Utilities::is_unsteady_timestep(time_step_number));
   }
 
+  /*
+   *  write output on surfaces and slices
+   */
+  if(surface_and_slice_output_generator.time_control.needs_evaluation(time, time_step_number))
+  {
+    surface_and_slice_output_generator.evaluate(velocity,
+                                                pressure,
+                                                time,
+                                                Utilities::is_unsteady_timestep(time_step_number));
+  }
+
   /*
    *  calculate error
    */
@@ -220,23 +272,38 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
     pressure_difference_calculator.evaluate(pressure, time);
 
   /*
-   *  Analysis of divergence and mass error
+   *  Analysis of divergence and mass error and calculation of kinetic energy: if both are due, the
+   *  integrals are evaluated in one loop over the mesh
    */
-  if(div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number))
+  bool const evaluate_div_and_mass_error =
+    div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number);
+  bool const evaluate_kinetic_energy =
+    kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number);
+
+  if(evaluate_div_and_mass_error and evaluate_kinetic_energy and
+     not pp_data.kinetic_energy_data.evaluate_individual_terms)
   {
-    div_and_mass_error_calculator.evaluate(velocity,
+    combined_integrals_calculator.evaluate(velocity,
                                            time,
-                                           Utilities::is_unsteady_timestep(time_step_number));
+                                           Utilities::is_unsteady_timestep(time_step_number),
+                                           &div_and_mass_error_calculator,
+                                           &kinetic_energy_calculator);
   }
-
-  /*
-   *  calculation of kinetic energy
-   */
-  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
+  else
   {
-    kinetic_energy_calculator.evaluate(velocity,
-                                       time,
-                                       Utilities::is_unsteady_timestep(time_step_number));
+    if(evaluate_div_and_mass_error)
+    {
+      div_and_mass_error_calculator.evaluate(velocity,
+                                             time,
+                                             Utilities::is_unsteady_timestep(time_step_number));
+    }
+
+    if(evaluate_kinetic_energy)
+    {
+      kinetic_energy_calculator.evaluate(velocity,
+                                         time,
+                                         Utilities::is_unsteady_timestep(time_step_number));
+    }
   }
 
   /*
@@ -254,6 +321,51 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
    */
   if(line_plot_calculator.time_control.needs_evaluation(time, time_step_number))
     line_plot_calculator.evaluate(velocity, pressure);
+
+  /*
+   *  Particle tracking: the particles are moved in every call, i.e., in every time step
+   */
+  if(pp_data.particle_tracking_data.time_control_data.is_active)
+  {
+    particle_tracker.evaluate(velocity, time);
+
+    if(particle_tracker.time_control.needs_evaluation(time, time_step_number))
+      particle_tracker.write_output();
+  }
+}
+
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::evaluate_derived_fields_fused(VectorType const & velocity)
+{
+  OutputData const & output_data = pp_data.output_data;
+
+  typename NavierStokesOperator::DerivedFields dst;
+
+  std::vector<SolutionField<dim, Number> *> fields;
+
+  auto const select =
+    [&](bool const is_needed, SolutionField<dim, Number> & field, VectorType *& dst_field) {
+      if(is_needed and not field.available())
+      {
+        dst_field = &field.get_for_update();
+        fields.push_back(&field);
+      }
+    };
+
+  select(output_data.write_vorticity, vorticity, dst.vorticity);
+  select(output_data.write_divergence, divergence, dst.divergence);
+  select(output_data.write_shear_rate, shear_rate, dst.shear_rate);
+  select(output_data.write_velocity_magnitude, velocity_magnitude, dst.velocity_magnitude);
+  select(output_data.write_q_criterion, q_criterion, dst.q_criterion);
+
+  if(fields.size() > 1)
+  {
+    navier_stokes_operator->compute_derived_fields(dst, velocity);
+
+    for(auto field : fields)
+      field->set_available();
+  }
 }
 
 template<int dim, typename Number>
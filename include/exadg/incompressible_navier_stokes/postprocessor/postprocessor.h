@@ -22,16 +22,20 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_H_
 
+#include <exadg/incompressible_navier_stokes/postprocessor/combined_integrals_calculator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/kinetic_energy_dissipation_detailed.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/output_generator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/pointwise_output_generator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/surface_and_slice_output_generator.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/time_averaged_fields_calculator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
+#include <exadg/postprocessor/particle_tracking.h>
 #include <exadg/postprocessor/pressure_difference_calculation.h>
 
 namespace ExaDG
@@ -45,16 +49,19 @@ struct PostProcessorData
   {
   }
 
-  OutputData                  output_data;
-  PointwiseOutputData<dim>    pointwise_output_data;
-  ErrorCalculationData<dim>   error_data_u;
-  ErrorCalculationData<dim>   error_data_p;
-  LiftAndDragData             lift_and_drag_data;
-  PressureDifferenceData<dim> pressure_difference_data;
-  MassConservationData        mass_data;
-  KineticEnergyData           kinetic_energy_data;
-  KineticEnergySpectrumData   kinetic_energy_spectrum_data;
-  LinePlotData<dim>           line_plot_data;
+  OutputData                     output_data;
+  PointwiseOutputData<dim>       pointwise_output_data;
+  ErrorCalculationData<dim>      error_data_u;
+  ErrorCalculationData<dim>      error_data_p;
+  LiftAndDragData                lift_and_drag_data;
+  PressureDifferenceData<dim>    pressure_difference_data;
+  MassConservationData           mass_data;
+  KineticEnergyData              kinetic_energy_data;
+  KineticEnergySpectrumData      kinetic_energy_spectrum_data;
+  LinePlotData<dim>              line_plot_data;
+  SurfaceAndSliceOutputData<dim> surface_and_slice_output_data;
+  TimeAveragedFieldsData         time_averaged_fields_data;
+  ParticleTrackingData<dim>      particle_tracking_data;
 };
 
 template<int dim, typename Number>
@@ -92,6 +99,14 @@ private:
   void
   invalidate_derived_fields();
 
+  /*
+   * Computes all requested derived fields that depend on the velocity gradient (and the velocity
+   * magnitude) in a single cell loop. Only done if more than one of these fields is needed since
+   * the fields are otherwise computed individually via SolutionField::evaluate().
+   */
+  void
+  evaluate_derived_fields_fused(VectorType const & velocity);
+
   PostProcessorData<dim> pp_data;
 
   dealii::SmartPointer<NavierStokesOperator const> navier_stokes_operator;
@@ -112,9 +127,15 @@ private:
   // write output for visualization of results (e.g., using paraview)
   OutputGenerator<dim, Number> output_generator;
 
+  // time-averaged velocity and pressure fields and their fluctuations
+  TimeAveragedFieldsCalculator<dim, Number> time_averaged_fields_calculator;
+
   // writes output at certain points in space
   PointwiseOutputGenerator<dim, Number> pointwise_output_generator;
 
+  // writes output on boundary surfaces and planar slices
+  SurfaceAndSliceOutputGenerator<dim, Number> surface_and_slice_output_generator;
+
   // calculate errors for verification purposes for problems with known analytical solution
   ErrorCalculator<dim, Number> error_calculator_u;
   ErrorCalculator<dim, Number> error_calculator_p;
@@ -133,11 +154,17 @@ private:
   // flows)
   KineticEnergyCalculatorDetailed<dim, Number> kinetic_energy_calculator;
 
+  // evaluates the divergence and mass error and the kinetic energy in one loop if both are due
+  CombinedIntegralsCalculator<dim, Number> combined_integrals_calculator;
+
   // evaluate kinetic energy in spectral space (i.e., as a function of the wavenumber)
   KineticEnergySpectrumCalculator<dim, Number> kinetic_energy_spectrum_calculator;
 
   // evaluate quantities along lines through the domain
   LinePlotCalculator<dim, Number> line_plot_calculator;
+
+  // track particles transported by the velocity field
+  ParticleTracker<dim, Number> particle_tracker;
 };
 
 
@@ -0,0 +1,435 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/shared_tria.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/mapping_q1.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/numerics/data_out_faces.h>
+#include <deal.II/numerics/data_postprocessor.h>
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+#  include <deal.II/numerics/data_out_resample.h>
+#endif
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/surface_and_slice_output_generator.h>
+#include <exadg/postprocessor/write_output.h>
+#include <exadg/utilities/create_directories.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim>
+void
+SurfaceAndSliceOutputData<dim>::print(dealii::ConditionalOStream & pcout, bool unsteady) const
+{
+  if(time_control_data.is_active)
+  {
+    pcout << std::endl << "Surface and slice output" << std::endl;
+
+    time_control_data.print(pcout, unsteady);
+
+    print_parameter(pcout, "Output directory", directory);
+    print_parameter(pcout, "Name of output files", filename);
+
+    for(auto const & bnd_id : boundary_IDs)
+      print_parameter(pcout, "Surface with boundary ID", bnd_id);
+    if(not boundary_IDs.empty())
+    {
+      print_parameter(pcout, "Write wall shear stress", write_wall_shear_stress);
+      if(write_wall_shear_stress)
+        print_parameter(pcout, "Kinematic viscosity", viscosity);
+      print_parameter(pcout, "Subdivisions of faces", degree);
+    }
+
+    for(auto const & slice : slices)
+    {
+      print_parameter(pcout, "Slice", slice.name);
+      print_parameter(pcout, "  Normal direction", slice.normal_direction);
+      print_parameter(pcout, "  Position", slice.position);
+      print_parameter(pcout, "  Cells per direction", slice.n_cells_per_direction);
+    }
+
+    print_parameter(pcout, "Compression", compression);
+  }
+}
+
+/*
+ * DataOutFaces restricted to a given list of faces. The default implementation of DataOutFaces
+ * loops over all faces of all cells to find the faces at the boundary, while the faces of interest
+ * are known in advance.
+ */
+template<int dim>
+class FaceListDataOut : public dealii::DataOutFaces<dim>
+{
+  typedef typename dealii::DataOutFaces<dim>::FaceDescriptor FaceDescriptor;
+
+public:
+  FaceListDataOut(std::vector<FaceDescriptor> const & faces_in)
+    : dealii::DataOutFaces<dim>(true /* surface only */), faces(faces_in), index(0)
+  {
+  }
+
+  FaceDescriptor
+  first_face() final
+  {
+    index = 0;
+    return get_face();
+  }
+
+  FaceDescriptor
+  next_face(FaceDescriptor const & face) final
+  {
+    (void)face;
+
+    ++index;
+    return get_face();
+  }
+
+private:
+  FaceDescriptor
+  get_face() const
+  {
+    if(index < faces.size())
+      return faces[index];
+    else
+      return FaceDescriptor(this->triangulation->end(), 0);
+  }
+
+  std::vector<FaceDescriptor> const & faces;
+
+  unsigned int index;
+};
+
+/*
+ * Tangential part of the viscous traction nu (grad(u) + grad(u)^T) * n at the boundary.
+ */
+template<int dim>
+class WallShearStressPostprocessor : public dealii::DataPostprocessorVector<dim>
+{
+public:
+  WallShearStressPostprocessor(double const viscosity_in)
+    : dealii::DataPostprocessorVector<dim>("wall_shear_stress",
+                                           dealii::update_gradients |
+                                             dealii::update_normal_vectors),
+      viscosity(viscosity_in)
+  {
+  }
+
+  void
+  evaluate_vector_field(dealii::DataPostprocessorInputs::Vector<dim> const & inputs,
+                        std::vector<dealii::Vector<double>> & computed_quantities) const final
+  {
+    for(unsigned int q = 0; q < inputs.solution_gradients.size(); ++q)
+    {
+      dealii::Tensor<2, dim> grad_u;
+      for(unsigned int i = 0; i < dim; ++i)
+        grad_u[i] = inputs.solution_gradients[q][i];
+
+      dealii::Tensor<1, dim> const & normal = inputs.normals[q];
+
+      dealii::Tensor<1, dim> tau = viscosity * (grad_u + dealii::transpose(grad_u)) * normal;
+      tau -= (tau * normal) * normal;
+
+      for(unsigned int d = 0; d < dim; ++d)
+        computed_quantities[q][d] = tau[d];
+    }
+  }
+
+private:
+  double const viscosity;
+};
+
+/*
+ * Planar slice mesh along with the data structures interpolating the solution from the
+ * triangulation of the flow solver to the vertices of the slice mesh. The slice mesh is
+ * distributed among the MPI ranks, the points are located in the triangulation of the flow solver
+ * once in setup().
+ */
+template<int dim>
+class SliceResampler
+{
+public:
+  SliceResampler(SliceData<dim> const &       slice,
+                 dealii::Mapping<dim> const & mapping_flow_in,
+                 MPI_Comm const &             mpi_comm)
+    : triangulation(mpi_comm), mapping_flow(&mapping_flow_in)
+  {
+    AssertThrow(slice.normal_direction < dim,
+                dealii::ExcMessage("Normal direction of slice has to be smaller than dim."));
+
+    // the slice mesh is created in the coordinates of the plane and moved into place afterwards
+    dealii::Point<dim - 1> p1, p2;
+    for(unsigned int d = 0, i = 0; d < dim; ++d)
+    {
+      if(d != slice.normal_direction)
+      {
+        p1[i] = std::min(slice.corner_1[d], slice.corner_2[d]);
+        p2[i] = std::max(slice.corner_1[d], slice.corner_2[d]);
+        ++i;
+      }
+    }
+
+    std::vector<unsigned int> const repetitions(dim - 1, slice.n_cells_per_direction);
+    dealii::GridGenerator::subdivided_hyper_rectangle(triangulation, repetitions, p1, p2);
+
+    dealii::GridTools::transform(
+      [&](dealii::Point<dim> const & point_in_plane) {
+        dealii::Point<dim> point;
+        for(unsigned int d = 0, i = 0; d < dim; ++d)
+          point[d] = (d == slice.normal_direction) ? slice.position : point_in_plane[i++];
+        return point;
+      },
+      triangulation);
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    data_out = std::make_shared<dealii::DataOutResample<dim, dim - 1, dim>>(triangulation, mapping);
+#else
+    AssertThrow(false, dealii::ExcMessage("Slice output requires deal.II version 9.4 or newer."));
+#endif
+  }
+
+  /*
+   * Attaches the vectors evaluated on the slice and locates the points of the slice mesh. Both
+   * vectors have to stay alive as long as this object is used.
+   */
+  template<typename VectorType>
+  void
+  setup(dealii::DoFHandler<dim> const & dof_handler_velocity,
+        VectorType const &              velocity,
+        dealii::DoFHandler<dim> const & dof_handler_pressure,
+        VectorType const &              pressure)
+  {
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    std::vector<std::string> velocity_names(dim, "velocity");
+    std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+      velocity_component_interpretation(
+        dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+    data_out->add_data_vector(dof_handler_velocity,
+                              velocity,
+                              velocity_names,
+                              velocity_component_interpretation);
+    data_out->add_data_vector(dof_handler_pressure, pressure, "p");
+
+    data_out->update_mapping(*mapping_flow);
+#else
+    (void)dof_handler_velocity;
+    (void)velocity;
+    (void)dof_handler_pressure;
+    (void)pressure;
+#endif
+  }
+
+  void
+  write(dealii::DataOutBase::VtkFlags const & flags,
+        std::string const &                   folder,
+        std::string const &                   file,
+        unsigned int const                    counter,
+        MPI_Comm const &                      mpi_comm)
+  {
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    data_out->set_flags(flags);
+    // uses the points located in setup()
+    data_out->build_patches();
+    data_out->write_vtu_with_pvtu_record(folder, file, counter, mpi_comm, 4);
+#else
+    (void)flags;
+    (void)folder;
+    (void)file;
+    (void)counter;
+    (void)mpi_comm;
+#endif
+  }
+
+private:
+  dealii::parallel::shared::Triangulation<dim - 1, dim> triangulation;
+  dealii::MappingQ1<dim - 1, dim>                       mapping;
+
+  dealii::SmartPointer<dealii::Mapping<dim> const> mapping_flow;
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  std::shared_ptr<dealii::DataOutResample<dim, dim - 1, dim>> data_out;
+#endif
+};
+
+template<int dim, typename Number>
+SurfaceAndSliceOutputGenerator<dim, Number>::SurfaceAndSliceOutputGenerator(MPI_Comm const & comm)
+  : mpi_comm(comm)
+{
+}
+
+template<int dim, typename Number>
+void
+SurfaceAndSliceOutputGenerator<dim, Number>::setup(
+  dealii::DoFHandler<dim> const &        dof_handler_velocity_in,
+  dealii::DoFHandler<dim> const &        dof_handler_pressure_in,
+  dealii::Mapping<dim> const &           mapping_in,
+  SurfaceAndSliceOutputData<dim> const & data_in)
+{
+  dof_handler_velocity = &dof_handler_velocity_in;
+  dof_handler_pressure = &dof_handler_pressure_in;
+  mapping              = &mapping_in;
+  data                 = data_in;
+
+  time_control.setup(data_in.time_control_data);
+
+  if(data.time_control_data.is_active)
+  {
+    create_directories(data.directory, mpi_comm);
+
+    // collect the locally owned faces on the surfaces
+    surface_faces.clear();
+    if(not data.boundary_IDs.empty())
+    {
+      for(auto const & cell : dof_handler_velocity->get_triangulation().active_cell_iterators())
+      {
+        if(cell->is_locally_owned() and cell->at_boundary())
+        {
+          for(unsigned int const f : cell->face_indices())
+          {
+            if(cell->face(f)->at_boundary() and
+               data.boundary_IDs.find(cell->face(f)->boundary_id()) != data.boundary_IDs.end())
+            {
+              surface_faces.emplace_back(cell, f);
+            }
+          }
+        }
+      }
+    }
+
+    // locate the points of the slices
+    if(not data.slices.empty())
+    {
+      dealii::IndexSet relevant_dofs_velocity, relevant_dofs_pressure;
+      dealii::DoFTools::extract_locally_relevant_dofs(*dof_handler_velocity,
+                                                      relevant_dofs_velocity);
+      dealii::DoFTools::extract_locally_relevant_dofs(*dof_handler_pressure,
+                                                      relevant_dofs_pressure);
+      velocity_slice.reinit(dof_handler_velocity->locally_owned_dofs(),
+                            relevant_dofs_velocity,
+                            mpi_comm);
+      pressure_slice.reinit(dof_handler_pressure->locally_owned_dofs(),
+                            relevant_dofs_pressure,
+                            mpi_comm);
+
+      slice_resamplers.clear();
+      for(auto const & slice : data.slices)
+      {
+        auto resampler = std::make_shared<SliceResampler<dim>>(slice, *mapping, mpi_comm);
+        resampler->setup(*dof_handler_velocity,
+                         velocity_slice,
+                         *dof_handler_pressure,
+                         pressure_slice);
+        slice_resamplers.push_back(resampler);
+      }
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+SurfaceAndSliceOutputGenerator<dim, Number>::evaluate(VectorType const & velocity,
+                                                      VectorType const & pressure,
+                                                      double const       time,
+                                                      bool const         unsteady) const
+{
+  print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
+
+  if(not data.boundary_IDs.empty())
+    write_surfaces(velocity, pressure, time_control.get_counter());
+
+  if(not data.slices.empty())
+    write_slices(velocity, pressure, time_control.get_counter());
+}
+
+template<int dim, typename Number>
+void
+SurfaceAndSliceOutputGenerator<dim, Number>::write_surfaces(VectorType const & velocity,
+                                                            VectorType const & pressure,
+                                                            unsigned int const counter) const
+{
+  dealii::DataOutBase::VtkFlags flags;
+  flags.compression_level = get_vtk_compression_level(data.compression);
+
+  FaceListDataOut<dim> data_out(surface_faces);
+  data_out.set_flags(flags);
+
+  std::vector<std::string> velocity_names(dim, "velocity");
+  std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+    velocity_component_interpretation(
+      dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+  data_out.add_data_vector(*dof_handler_velocity,
+                           velocity,
+                           velocity_names,
+                           velocity_component_interpretation);
+  data_out.add_data_vector(*dof_handler_pressure, pressure, "p");
+
+  // needs to survive until build_patches
+  WallShearStressPostprocessor<dim> wall_shear_stress(data.viscosity);
+  if(data.write_wall_shear_stress)
+    data_out.add_data_vector(*dof_handler_velocity, velocity, wall_shear_stress);
+
+  data_out.build_patches(*mapping, data.degree);
+  data_out.write_vtu_with_pvtu_record(
+    data.directory, data.filename + "_surface", counter, mpi_comm, 4);
+}
+
+template<int dim, typename Number>
+void
+SurfaceAndSliceOutputGenerator<dim, Number>::write_slices(VectorType const & velocity,
+                                                          VectorType const & pressure,
+                                                          unsigned int const counter) const
+{
+  // the slice resamplers refer to these vectors, which in addition hold the ghost values needed
+  // for the interpolation
+  velocity_slice.copy_locally_owned_data_from(velocity);
+  velocity_slice.update_ghost_values();
+  pressure_slice.copy_locally_owned_data_from(pressure);
+  pressure_slice.update_ghost_values();
+
+  dealii::DataOutBase::VtkFlags flags;
+  flags.compression_level = get_vtk_compression_level(data.compression);
+
+  for(unsigned int i = 0; i < data.slices.size(); ++i)
+  {
+    slice_resamplers[i]->write(
+      flags, data.directory, data.filename + "_" + data.slices[i].name, counter, mpi_comm);
+  }
+}
+
+template struct SurfaceAndSliceOutputData<2>;
+template struct SurfaceAndSliceOutputData<3>;
+
+template class SurfaceAndSliceOutputGenerator<2, float>;
+template class SurfaceAndSliceOutputGenerator<2, double>;
+
+template class SurfaceAndSliceOutputGenerator<3, float>;
+template class SurfaceAndSliceOutputGenerator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
@@ -0,0 +1,184 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_SURFACE_AND_SLICE_OUTPUT_GENERATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_SURFACE_AND_SLICE_OUTPUT_GENERATOR_H_
+
+// C/C++
+#include <memory>
+#include <set>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/time_control.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Axis-aligned planar slice {x[normal_direction] = position} through the domain. The rectangular
+ * part of the plane spanned by the points corner_1 and corner_2 is written, where the coordinate in
+ * normal direction of these points is ignored.
+ */
+template<int dim>
+struct SliceData
+{
+  SliceData() : name("slice"), normal_direction(dim - 1), position(0.0), n_cells_per_direction(100)
+  {
+  }
+
+  // name of slice, used as suffix of the output files
+  std::string name;
+
+  unsigned int normal_direction;
+  double       position;
+
+  dealii::Point<dim> corner_1;
+  dealii::Point<dim> corner_2;
+
+  // resolution of the slice, the solution is interpolated to the vertices of this mesh
+  unsigned int n_cells_per_direction;
+};
+
+/*
+ * Output of the velocity and pressure on selected boundary surfaces and planar slices. This output
+ * is cheap compared to the field output of the whole domain and can therefore be written at a
+ * higher frequency, controlled by a TimeControlData of its own.
+ */
+template<int dim>
+struct SurfaceAndSliceOutputData
+{
+  SurfaceAndSliceOutputData()
+    : directory("output/"),
+      filename("name"),
+      write_wall_shear_stress(false),
+      viscosity(1.0),
+      degree(1),
+      compression(OutputCompression::BestSpeed)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout, bool unsteady) const;
+
+  TimeControlData time_control_data;
+
+  // output directory
+  std::string directory;
+
+  // name of generated output files
+  std::string filename;
+
+  // boundary IDs of the surfaces written (no surface output if empty)
+  std::set<dealii::types::boundary_id> boundary_IDs;
+
+  // write the wall shear stress, i.e., the tangential part of the viscous traction, on the surfaces
+  bool write_wall_shear_stress;
+
+  // kinematic viscosity, needed for the wall shear stress
+  double viscosity;
+
+  // number of subdivisions of a face for the surface output
+  unsigned int degree;
+
+  // planar slices (no slice output if empty)
+  std::vector<SliceData<dim>> slices;
+
+  // compression of the vtu-files
+  OutputCompression compression;
+};
+
+template<int dim>
+class SliceResampler;
+
+/*
+ * The expensive geometric operations are done once in setup(): the locally owned faces on the
+ * selected boundaries are collected such that the surface output does not loop over all cells and
+ * faces of the triangulation, and the points of the slice meshes are located in the triangulation
+ * of the flow solver. The output at a given time then only involves the evaluation of the solution
+ * in these faces and points. The mesh is assumed to be fixed after setup().
+ */
+template<int dim, typename Number>
+class SurfaceAndSliceOutputGenerator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  SurfaceAndSliceOutputGenerator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::DoFHandler<dim> const &        dof_handler_velocity_in,
+        dealii::DoFHandler<dim> const &        dof_handler_pressure_in,
+        dealii::Mapping<dim> const &           mapping_in,
+        SurfaceAndSliceOutputData<dim> const & data_in);
+
+  void
+  evaluate(VectorType const & velocity,
+           VectorType const & pressure,
+           double const       time,
+           bool const         unsteady) const;
+
+  TimeControl time_control;
+
+private:
+  void
+  write_surfaces(VectorType const & velocity,
+                 VectorType const & pressure,
+                 unsigned int const counter) const;
+
+  void
+  write_slices(VectorType const & velocity,
+               VectorType const & pressure,
+               unsigned int const counter) const;
+
+  MPI_Comm const mpi_comm;
+
+  SurfaceAndSliceOutputData<dim> data;
+
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
+  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  // locally owned cells and face numbers of the faces located on the surfaces written
+  std::vector<std::pair<typename dealii::Triangulation<dim>::cell_iterator, unsigned int>>
+    surface_faces;
+
+  std::vector<std::shared_ptr<SliceResampler<dim>>> slice_resamplers;
+
+  // copies of the solution referenced by the slice resamplers
+  mutable VectorType velocity_slice, pressure_slice;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_SURFACE_AND_SLICE_OUTPUT_GENERATOR_H_ \
+        */
@@ -0,0 +1,199 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <fstream>
+
+// deal.II
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/numerics/data_out.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/time_averaged_fields_calculator.h>
+#include <exadg/time_integration/restart.h>
+#include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+void
+TimeAveragedFieldsData::print(dealii::ConditionalOStream & pcout) const
+{
+  if(time_control_data_statistics.time_control_data.is_active)
+  {
+    pcout << "  Time-averaged fields:" << std::endl;
+
+    // only implemented for unsteady problem
+    time_control_data_statistics.print(pcout, true /*unsteady*/);
+
+    print_parameter(pcout, "Output directory", directory);
+    print_parameter(pcout, "Name of output files", filename);
+    print_parameter(pcout, "Write higher order", write_higher_order);
+    print_parameter(pcout, "Polynomial degree", degree);
+    print_parameter(pcout, "Read previous state", read_previous_state);
+  }
+}
+
+template<int dim, typename Number>
+TimeAveragedFieldsCalculator<dim, Number>::TimeAveragedFieldsCalculator(MPI_Comm const & comm)
+  : mpi_comm(comm), output_counter(0)
+{
+}
+
+template<int dim, typename Number>
+void
+TimeAveragedFieldsCalculator<dim, Number>::setup(
+  dealii::DoFHandler<dim> const & dof_handler_velocity_in,
+  dealii::DoFHandler<dim> const & dof_handler_pressure_in,
+  dealii::Mapping<dim> const &    mapping_in,
+  TimeAveragedFieldsData const &  data_in)
+{
+  dof_handler_velocity = &dof_handler_velocity_in;
+  dof_handler_pressure = &dof_handler_pressure_in;
+  mapping              = &mapping_in;
+  data                 = data_in;
+
+  time_control_statistics.setup(data.time_control_data_statistics);
+
+  if(data.time_control_data_statistics.time_control_data.is_active)
+  {
+    // the ghost values are needed for the output
+    dealii::IndexSet relevant_dofs_velocity, relevant_dofs_pressure;
+    dealii::DoFTools::extract_locally_relevant_dofs(*dof_handler_velocity, relevant_dofs_velocity);
+    dealii::DoFTools::extract_locally_relevant_dofs(*dof_handler_pressure, relevant_dofs_pressure);
+
+    VectorType velocity(dof_handler_velocity->locally_owned_dofs(),
+                        relevant_dofs_velocity,
+                        mpi_comm);
+    VectorType pressure(dof_handler_pressure->locally_owned_dofs(),
+                        relevant_dofs_pressure,
+                        mpi_comm);
+
+    velocity_statistics.reinit(velocity);
+    pressure_statistics.reinit(pressure);
+
+    create_directories(data.directory, mpi_comm);
+
+    if(data.read_previous_state)
+      read_state();
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeAveragedFieldsCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                                    VectorType const & pressure,
+                                                    bool const         unsteady)
+{
+  AssertThrow(unsteady, dealii::ExcMessage("Only implemented for unsteady simulation."));
+
+  velocity_statistics.add_sample(velocity);
+  pressure_statistics.add_sample(pressure);
+}
+
+template<int dim, typename Number>
+void
+TimeAveragedFieldsCalculator<dim, Number>::write_output()
+{
+  VectorType velocity_rms, pressure_rms;
+  velocity_statistics.compute_rms(velocity_rms);
+  pressure_statistics.compute_rms(pressure_rms);
+
+  velocity_statistics.get_mean().update_ghost_values();
+  pressure_statistics.get_mean().update_ghost_values();
+  velocity_rms.update_ghost_values();
+  pressure_rms.update_ghost_values();
+
+  dealii::DataOutBase::VtkFlags flags;
+  flags.write_higher_order_cells = data.write_higher_order;
+
+  dealii::DataOut<dim> data_out;
+  data_out.set_flags(flags);
+
+  std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+    velocity_component_interpretation(
+      dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+  data_out.add_data_vector(*dof_handler_velocity,
+                           velocity_statistics.get_mean(),
+                           std::vector<std::string>(dim, "velocity_mean"),
+                           velocity_component_interpretation);
+  data_out.add_data_vector(*dof_handler_velocity,
+                           velocity_rms,
+                           std::vector<std::string>(dim, "velocity_rms"),
+                           velocity_component_interpretation);
+  data_out.add_data_vector(*dof_handler_pressure, pressure_statistics.get_mean(), "p_mean");
+  data_out.add_data_vector(*dof_handler_pressure, pressure_rms, "p_rms");
+
+  data_out.build_patches(*mapping, data.degree, dealii::DataOut<dim>::curved_inner_cells);
+  data_out.write_vtu_with_pvtu_record(data.directory, data.filename, output_counter, mpi_comm, 4);
+
+  ++output_counter;
+
+  write_state();
+}
+
+template<int dim, typename Number>
+void
+TimeAveragedFieldsCalculator<dim, Number>::write_state() const
+{
+  std::string const filename = restart_filename(data.directory + data.filename, mpi_comm);
+
+  rename_restart_files(filename);
+
+  std::ofstream                   out(filename);
+  boost::archive::binary_oarchive oa(out);
+
+  oa << output_counter;
+  velocity_statistics.save(oa);
+  pressure_statistics.save(oa);
+}
+
+template<int dim, typename Number>
+void
+TimeAveragedFieldsCalculator<dim, Number>::read_state()
+{
+  std::string const filename = restart_filename(data.directory + data.filename, mpi_comm);
+
+  std::ifstream in(filename);
+  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  boost::archive::binary_iarchive ia(in);
+
+  ia >> output_counter;
+  velocity_statistics.load(ia);
+  pressure_statistics.load(ia);
+}
+
+template class TimeAveragedFieldsCalculator<2, float>;
+template class TimeAveragedFieldsCalculator<2, double>;
+
+template class TimeAveragedFieldsCalculator<3, float>;
+template class TimeAveragedFieldsCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
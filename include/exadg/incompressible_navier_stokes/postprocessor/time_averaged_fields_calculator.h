@@ -0,0 +1,127 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_TIME_AVERAGED_FIELDS_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_TIME_AVERAGED_FIELDS_CALCULATOR_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/postprocessor/mean_and_variance_accumulator.h>
+#include <exadg/postprocessor/time_control_statistics.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+struct TimeAveragedFieldsData
+{
+  TimeAveragedFieldsData()
+    : directory("output/"),
+      filename("time_averaged"),
+      write_higher_order(true),
+      degree(1),
+      read_previous_state(false)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout) const;
+
+  // defines when the velocity and pressure are sampled and when the time-averaged fields are
+  // written (preliminary results)
+  TimeControlDataStatistics time_control_data_statistics;
+
+  // output directory
+  std::string directory;
+
+  // name of generated output files
+  std::string filename;
+
+  // see OutputDataBase
+  bool         write_higher_order;
+  unsigned int degree;
+
+  // continue the averaging of a previous simulation with the same mesh and number of MPI
+  // processes, e.g., after a restart: the state written by the previous simulation along with the
+  // output (file ending .restart) is read in setup()
+  bool read_previous_state;
+};
+
+/*
+ * Computes the time-averaged velocity and pressure fields as well as the root mean square of their
+ * fluctuations on the DoF vectors of the flow solver. The mean and variance are updated
+ * incrementally for every sample, see MeanAndVarianceAccumulator, such that no instantaneous
+ * fields have to be written for averaging in a postprocessing step.
+ */
+template<int dim, typename Number>
+class TimeAveragedFieldsCalculator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  TimeAveragedFieldsCalculator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
+        dealii::DoFHandler<dim> const & dof_handler_pressure_in,
+        dealii::Mapping<dim> const &    mapping_in,
+        TimeAveragedFieldsData const &  data_in);
+
+  void
+  evaluate(VectorType const & velocity, VectorType const & pressure, bool const unsteady);
+
+  void
+  write_output();
+
+  TimeControlStatistics time_control_statistics;
+
+private:
+  void
+  write_state() const;
+
+  void
+  read_state();
+
+  MPI_Comm const mpi_comm;
+
+  TimeAveragedFieldsData data;
+
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
+  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  MeanAndVarianceAccumulator<Number> velocity_statistics;
+  MeanAndVarianceAccumulator<Number> pressure_statistics;
+
+  unsigned int output_counter;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_TIME_AVERAGED_FIELDS_CALCULATOR_H_ \
+        */
@@ -67,7 +67,7 @@ template<int dim, typename Number>
 void
 MultigridPreconditionerProjection<dim, Number>::update()
 {
-  if(mesh_is_moving)
+  if(mesh_is_moving and this->geometry_has_changed())
   {
     this->initialize_mapping();
 
@@ -21,6 +21,7 @@
 
 #include <exadg/incompressible_navier_stokes/precursor/driver.h>
 #include <exadg/time_integration/time_step_calculation.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -174,11 +175,21 @@ Driver<dim, Number>::setup()
     // parameters)
     consistency_checks();
   }
+  else if(not application->inflow_database.database_filename.empty())
+  {
+    inflow_database_reader = std::make_shared<InflowDatabaseReader<dim>>(
+      application->inflow_database.database_filename,
+      application->inflow_database_periodic,
+      mpi_comm);
+  }
 
   // constant vs. adaptive time stepping
   use_adaptive_time_stepping = application->main->get_parameters().adaptive_time_stepping;
 
   timer_tree.insert({"Incompressible flow", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -215,6 +226,18 @@ Driver<dim, Number>::solve() const
     } while(not(solver_precursor.time_integrator->finished()) or
             not(solver_main.time_integrator->finished()));
   }
+  else if(inflow_database_reader)
+  {
+    // The inflow data is read at the end time of the time step, corresponding to the coupled
+    // simulation, where the precursor has already been advanced to this time.
+    while(not solver_main.time_integrator->finished())
+    {
+      inflow_database_reader->read(solver_main.time_integrator->get_next_time(),
+                                   application->inflow_database);
+
+      solver_main.time_integrator->advance_one_timestep();
+    }
+  }
   else
   {
     solver_main.time_integrator->timeloop();
@@ -261,6 +284,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Computational costs in CPUh
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_DRIVER_PRECURSOR_H_
 
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_database.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
 #include <exadg/incompressible_navier_stokes/precursor/user_interface/application_base.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
@@ -34,6 +35,7 @@
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_dual_splitting.h>
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_pressure_correction.h>
 #include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_general_infos.h>
 
 namespace ExaDG
@@ -56,6 +58,9 @@ public:
     // setup application
     domain->setup(grid, mapping, multigrid_mappings, subsection_names_parameters);
 
+    domain->get_parameters().parallelization.setup_threads();
+    domain->get_parameters().parallelization.setup_shared_memory_communicator();
+
     // ALE is not used for this solver
     std::shared_ptr<HelpersALE<dim, Number>> helpers_ale_dummy;
 
@@ -74,6 +79,8 @@ public:
     matrix_free_data->append(pde_operator);
 
     matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
+    domain->get_parameters().parallelization.fill_additional_data(matrix_free_data->data,
+                                                                  mpi_comm);
     if(domain->get_parameters().use_cell_based_face_loops)
       Categorization::do_cell_based_loops(*grid->triangulation, matrix_free_data->data);
     matrix_free->reinit(*mapping,
@@ -82,6 +89,8 @@ public:
                         matrix_free_data->get_quadrature_vector(),
                         matrix_free_data->data);
 
+    memory_matrix_free.set(matrix_free->memory_consumption());
+
     // setup Navier-Stokes operator
     pde_operator->setup(matrix_free, matrix_free_data);
 
@@ -127,6 +136,7 @@ private:
    */
   std::shared_ptr<MatrixFreeData<dim, Number>>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free;
+  MemoryReport::Entry                              memory_matrix_free{MemoryCategory::MatrixFree};
 };
 
 template<int dim, typename Number>
@@ -172,6 +182,9 @@ private:
 
   bool use_adaptive_time_stepping;
 
+  // inflow data of the main domain if the precursor is switched off
+  std::shared_ptr<InflowDatabaseReader<dim>> inflow_database_reader;
+
   /*
    * Computation time (wall clock time).
    */
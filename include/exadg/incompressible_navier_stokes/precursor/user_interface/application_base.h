@@ -33,6 +33,7 @@
 #include <exadg/convection_diffusion/user_interface/boundary_descriptor.h>
 #include <exadg/grid/grid.h>
 #include <exadg/grid/grid_utilities.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor.h>
 #include <exadg/incompressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/incompressible_navier_stokes/user_interface/field_functions.h>
@@ -178,7 +179,8 @@ public:
     : mpi_comm(comm),
       pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
       parameter_file(parameter_file),
-      switch_off_precursor(false) // precursor is active by default
+      switch_off_precursor(false), // precursor is active by default
+      inflow_database_periodic(true)
   {
   }
 
@@ -211,6 +213,19 @@ public:
    */
   std::shared_ptr<Domain<dim, Number>> precursor, main;
 
+  /**
+   * Inflow database written by a previous precursor simulation, see
+   * InflowData::database_filename. If the precursor is switched off and the file name of
+   * inflow_database is not empty, the driver reads the inflow data of the main domain from the
+   * database before each time step. The pointers of inflow_database have to point to the data
+   * used by the inflow boundary condition of the main domain. If inflow_database_periodic is true,
+   * the database is repeated periodically for main simulations that are longer than the
+   * precursor simulation.
+   */
+  InflowData<dim> inflow_database;
+
+  bool inflow_database_periodic;
+
 protected:
   MPI_Comm const mpi_comm;
 
@@ -29,6 +29,9 @@
 #include <exadg/operators/resolution_parameters.h>
 #include <exadg/time_integration/resolution_parameters.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
+#include <exadg/utilities/work_precision_report.h>
 
 // application
 #include <exadg/incompressible_navier_stokes/user_interface/declare_get_application.h>
@@ -86,6 +89,12 @@ run(std::string const & input_file,
 
   if(not(is_test))
     driver->print_performance_results(timer.wall_time());
+
+  WorkPrecisionReport::get().finish_run(degree,
+                                        refine_space,
+                                        refine_time,
+                                        driver->get_number_of_dofs(),
+                                        dealii::Utilities::MPI::max(timer.wall_time(), mpi_comm));
 }
 
 } // namespace ExaDG
@@ -97,6 +106,8 @@ main(int argc, char ** argv)
 {
   dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
 
+  ExaDG::ProfilingSession profiling;
+
   MPI_Comm mpi_comm(MPI_COMM_WORLD);
 
   // new communicator
@@ -199,6 +210,12 @@ main(int argc, char ** argv)
   MPI_Comm_free(&sub_comm);
 #endif
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
+  if(not general.work_precision_report.empty())
+    ExaDG::WorkPrecisionReport::get().write_csv(general.work_precision_report, mpi_comm);
+
   return 0;
 }
 
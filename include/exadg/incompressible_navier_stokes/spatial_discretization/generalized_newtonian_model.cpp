@@ -48,6 +48,9 @@ GeneralizedNewtonianModel<dim, Number>::initialize(
   data = generalized_newtonian_model_data_in;
 
   data.check();
+
+  if(data.use_vectorized_approximation)
+    accuracy = VectorizedMath::Accuracy<Number>(data.approximation_tolerance);
 }
 
 template<int dim, typename Number>
@@ -249,8 +252,20 @@ GeneralizedNewtonianModel<dim, Number>::generalized_carreau_yasuda_model(
   scalar &       viscosity_factor,
   scalar const & shear_rate) const
 {
-  viscosity_factor = pow(data.kappa + pow(shear_rate * data.lambda, static_cast<Number>(data.a)),
-                         static_cast<Number>((data.n - 1.0) / data.a));
+  if(data.use_vectorized_approximation)
+  {
+    scalar const power =
+      VectorizedMath::pow(shear_rate * data.lambda, static_cast<Number>(data.a), accuracy);
+
+    viscosity_factor = VectorizedMath::pow(data.kappa + power,
+                                           static_cast<Number>((data.n - 1.0) / data.a),
+                                           accuracy);
+  }
+  else
+  {
+    viscosity_factor = pow(data.kappa + pow(shear_rate * data.lambda, static_cast<Number>(data.a)),
+                           static_cast<Number>((data.n - 1.0) / data.a));
+  }
 }
 
 template class GeneralizedNewtonianModel<2, float>;
@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/spatial_discretization/viscosity_model_base.h>
+#include <exadg/utilities/vectorized_math.h>
 
 namespace ExaDG
 {
@@ -135,6 +136,9 @@ private:
   generalized_carreau_yasuda_model(scalar & viscosity_factor, scalar const & shear_rate) const;
 
   GeneralizedNewtonianModelData data;
+
+  // number of terms of the vectorized approximations of the power functions
+  VectorizedMath::Accuracy<Number> accuracy;
 };
 
 } // namespace IncNS
@@ -52,7 +52,13 @@ OperatorCoupled<dim, Number>::OperatorCoupled(
          parameters_in,
          field_in,
          mpi_comm_in),
-    scaling_factor_continuity(1.0)
+    scaling_factor_continuity(1.0),
+    outer_residual_initial(1.0),
+    use_inner_solves(true),
+    trial_solve(false),
+    n_linear_solves(0),
+    wall_time_last_solve(0.0),
+    wall_time_reference(0.0)
 {
 }
 
@@ -75,7 +81,10 @@ OperatorCoupled<dim, Number>::setup_preconditioners_and_solvers()
   Base::setup_preconditioners_and_solvers();
 
   if(this->param.apply_penalty_terms_in_postprocessing_step)
-    Base::setup_projection_solver();
+  {
+    this->projection_solver_setup.initialize("Setup of projection solver",
+                                             [this]() { Base::setup_projection_solver(); });
+  }
 
   setup_block_preconditioner();
   setup_solver_coupled();
@@ -106,7 +115,8 @@ OperatorCoupled<dim, Number>::setup_solver_coupled()
       Krylov::SolverGMRES<LinearOperatorCoupled<dim, Number>, Preconditioner, BlockVectorType>>(
       linear_operator, block_preconditioner, solver_data, this->mpi_comm);
   }
-  else if(this->param.solver_coupled == SolverCoupled::FGMRES)
+  else if(this->param.solver_coupled == SolverCoupled::FGMRES or
+          this->param.solver_coupled == SolverCoupled::RecyclingFGMRES)
   {
     Krylov::SolverDataFGMRES solver_data;
     solver_data.max_iter             = this->param.solver_data_coupled.max_iter;
@@ -119,9 +129,35 @@ OperatorCoupled<dim, Number>::setup_solver_coupled()
       solver_data.use_preconditioner = true;
     }
 
-    linear_solver = std::make_shared<
-      Krylov::SolverFGMRES<LinearOperatorCoupled<dim, Number>, Preconditioner, BlockVectorType>>(
-      linear_operator, block_preconditioner, solver_data);
+    if(this->param.solver_coupled == SolverCoupled::FGMRES)
+    {
+      typedef Krylov::
+        SolverFGMRES<LinearOperatorCoupled<dim, Number>, Preconditioner, BlockVectorType>
+          SolverType;
+
+      std::shared_ptr<SolverType> solver =
+        std::make_shared<SolverType>(linear_operator, block_preconditioner, solver_data);
+
+      if(this->param.adaptive_inner_tolerances or this->param.automatic_switching_inner_solves)
+      {
+        solver->set_residual_monitor([&](unsigned int const step, double const residual) {
+          this->monitor_outer_residual(step, residual);
+        });
+      }
+
+      linear_solver = solver;
+    }
+    else
+    {
+      typedef Krylov::
+        SolverRecyclingFGMRES<LinearOperatorCoupled<dim, Number>, Preconditioner, BlockVectorType>
+          SolverType;
+
+      linear_solver = std::make_shared<SolverType>(linear_operator,
+                                                   block_preconditioner,
+                                                   solver_data,
+                                                   this->param.n_recycled_vectors_coupled);
+    }
   }
   else
   {
@@ -134,6 +170,9 @@ OperatorCoupled<dim, Number>::setup_solver_coupled()
   {
     nonlinear_operator.initialize(*this);
 
+    if(this->param.newton_solver_data_coupled.jacobian_free)
+      linear_operator.initialize_jacobian_free(nonlinear_operator);
+
     newton_solver = std::make_shared<Newton::Solver<BlockVectorType,
                                                     NonlinearOperatorCoupled<dim, Number>,
                                                     LinearOperatorCoupled<dim, Number>,
@@ -142,6 +181,27 @@ OperatorCoupled<dim, Number>::setup_solver_coupled()
   }
 }
 
+template<int dim, typename Number>
+void
+OperatorCoupled<dim, Number>::set_velocity_ptr(VectorType const & velocity) const
+{
+  SpatialOperatorBase<dim, Number>::set_velocity_ptr(velocity);
+
+  if(pressure_conv_diff_operator.get() != nullptr and this->param.implicit_convective_problem())
+    pressure_conv_diff_operator->set_velocity_ptr(velocity);
+}
+
+template<int dim, typename Number>
+void
+OperatorCoupled<dim, Number>::set_scaling_factor_mass_operator(double const scaling_factor_mass)
+{
+  this->momentum_operator.set_scaling_factor_mass_operator(scaling_factor_mass);
+
+  if(pressure_conv_diff_operator.get() != nullptr and this->unsteady_problem_has_to_be_solved())
+    pressure_conv_diff_operator->set_scaling_factor_mass_operator(
+      static_cast<Number>(scaling_factor_mass));
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::update_divergence_penalty_operator(VectorType const & velocity)
@@ -175,7 +235,7 @@ OperatorCoupled<dim, Number>::solve_linear_stokes_problem(BlockVectorType &
   // We do not need to set the time here, because time affects the operator only in the form of
   // boundary conditions. The result of such boundary condition evaluations is handed over to this
   // function via the vector src.
-  this->momentum_operator.set_scaling_factor_mass_operator(scaling_factor_mass);
+  set_scaling_factor_mass_operator(scaling_factor_mass);
 
   linear_solver->update_preconditioner(update_preconditioner);
 
@@ -254,7 +314,7 @@ OperatorCoupled<dim, Number>::solve_nonlinear_problem(BlockVectorType &  dst,
 
   // Update linearized momentum operator
   this->momentum_operator.set_time(time);
-  this->momentum_operator.set_scaling_factor_mass_operator(scaling_factor_mass);
+  set_scaling_factor_mass_operator(scaling_factor_mass);
 
   // Solve nonlinear problem
   Newton::UpdateData update;
@@ -1047,7 +1107,7 @@ OperatorCoupled<dim, Number>::apply_preconditioner_velocity_block(VectorType &
   }
   else if(type == MomentumPreconditioner::Multigrid)
   {
-    if(this->param.exact_inversion_of_velocity_block == false)
+    if(this->param.exact_inversion_of_velocity_block == false or use_inner_solves == false)
     {
       // perform one multigrid V-cylce
       preconditioner_momentum->vmult(dst, src);
@@ -1141,18 +1201,9 @@ OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &
     // I. inverse, negative Laplace operator (-L)^{-1}
     apply_inverse_negative_laplace_operator(tmp_scp_pressure, src);
 
-    // II. pressure convection-diffusion operator A_p
-    if(this->unsteady_problem_has_to_be_solved())
-    {
-      pressure_conv_diff_operator->set_scaling_factor_mass_operator(
-        this->momentum_operator.get_scaling_factor_mass_operator());
-    }
-
-    if(this->param.implicit_convective_problem())
-    {
-      pressure_conv_diff_operator->set_velocity_ptr(this->convective_kernel->get_velocity());
-    }
-
+    // II. pressure convection-diffusion operator A_p. The scaling factor of the mass operator and
+    // the linearization velocity are set once per linear solve and per linearization, see
+    // set_scaling_factor_mass_operator() and set_velocity_ptr().
     pressure_conv_diff_operator->apply(dst, tmp_scp_pressure);
 
     // III. inverse pressure mass operator M_p^{-1}
@@ -1177,7 +1228,7 @@ void
 OperatorCoupled<dim, Number>::apply_inverse_negative_laplace_operator(VectorType &       dst,
                                                                       VectorType const & src) const
 {
-  if(this->param.exact_inversion_of_laplace_operator == false)
+  if(this->param.exact_inversion_of_laplace_operator == false or use_inner_solves == false)
   {
     // perform one multigrid V-cycle in order to approximately invert the negative Laplace
     // operator (classical or compatible)
@@ -1208,6 +1259,64 @@ OperatorCoupled<dim, Number>::apply_inverse_negative_laplace_operator(VectorType
   }
 }
 
+template<int dim, typename Number>
+void
+OperatorCoupled<dim, Number>::monitor_outer_residual(unsigned int const step, double const residual)
+{
+  if(step == 0)
+  {
+    // The previous linear solve has finished. Compare the wall time of a trial solve with the
+    // alternative (inner solves or single V-cycles) to the wall time of the preceding solve and
+    // switch back if the trial solve was slower.
+    if(this->param.automatic_switching_inner_solves and n_linear_solves > 0)
+    {
+      if(trial_solve)
+      {
+        if(wall_time_last_solve >= wall_time_reference)
+          use_inner_solves = not use_inner_solves;
+
+        trial_solve = false;
+      }
+      else
+      {
+        wall_time_reference = wall_time_last_solve;
+
+        if(n_linear_solves % this->param.switching_interval_inner_solves == 0)
+        {
+          use_inner_solves = not use_inner_solves;
+          trial_solve      = true;
+        }
+      }
+    }
+
+    ++n_linear_solves;
+    timer_outer_solve.restart();
+
+    outer_residual_initial = residual;
+  }
+
+  wall_time_last_solve = timer_outer_solve.wall_time();
+
+  // relax the tolerances of the inner solves as the outer residual decreases
+  if(this->param.adaptive_inner_tolerances and outer_residual_initial > 0.0 and residual > 0.0)
+  {
+    double const relative_residual = residual / outer_residual_initial;
+
+    auto const get_tolerance = [&](double const tolerance_block) {
+      return std::min(std::max(this->param.solver_data_coupled.rel_tol / relative_residual,
+                               tolerance_block),
+                      this->param.adaptive_inner_tolerance_max);
+    };
+
+    if(solver_velocity_block.get() != 0)
+      solver_velocity_block->set_relative_tolerance(
+        get_tolerance(this->param.solver_data_velocity_block.rel_tol));
+
+    if(solver_pressure_block.get() != 0)
+      solver_pressure_block->set_relative_tolerance(
+        get_tolerance(this->param.solver_data_pressure_block.rel_tol));
+  }
+}
 
 template class OperatorCoupled<2, float>;
 template class OperatorCoupled<2, double>;
@@ -22,6 +22,8 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATOR_COUPLED_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATOR_COUPLED_H_
 
+#include <deal.II/base/timer.h>
+
 #include <exadg/convection_diffusion/spatial_discretization/operators/combined_operator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
@@ -110,6 +112,21 @@ public:
     pde_operator->set_velocity_ptr(solution_linearization.block(0));
   }
 
+  /*
+   * Jacobian-free Newton-Krylov mode: The linearized operator is applied via finite differences of
+   * the nonlinear residual evaluated by nonlinear_operator.
+   */
+  void
+  initialize_jacobian_free(NonlinearOperatorCoupled<dim, Number> const & nonlinear_operator)
+  {
+    jacobian_free_operator.initialize(nonlinear_operator);
+  }
+
+  void
+  set_jacobian_free_linearization(BlockVectorType const & solution, BlockVectorType const & rhs)
+  {
+    jacobian_free_operator.set_linearization_point(solution, rhs);
+  }
 
   /*
    * The implementation of linear solvers in deal.ii requires that a function called 'vmult' is
@@ -118,11 +135,17 @@ public:
   void
   vmult(BlockVectorType & dst, BlockVectorType const & src) const
   {
-    pde_operator->apply_linearized_problem(dst, src);
+    if(jacobian_free_operator.is_active())
+      jacobian_free_operator.vmult(dst, src);
+    else
+      pde_operator->apply_linearized_problem(dst, src);
   }
 
 private:
   PDEOperator const * pde_operator;
+
+  Newton::JacobianFreeOperator<BlockVectorType, NonlinearOperatorCoupled<dim, Number>>
+    jacobian_free_operator;
 };
 
 template<int dim, typename Number>
@@ -223,6 +246,15 @@ private:
   setup_preconditioners_and_solvers() final;
 
 public:
+  /*
+   * Sets the linearization velocity of the convective term. In case of the pressure
+   * convection-diffusion preconditioner, the velocity is also handed over to the pressure
+   * convection-diffusion operator here, once per linearization, instead of in every application of
+   * the preconditioner.
+   */
+  void
+  set_velocity_ptr(VectorType const & velocity) const;
+
   /*
    *  Update divergence penalty operator by recalculating the penalty parameter
    *  which depends on the current velocity field
@@ -328,6 +360,13 @@ private:
   void
   setup_solver_coupled();
 
+  /*
+   * Sets the scaling factor of the mass operator of the momentum operator and of the pressure
+   * convection-diffusion operator.
+   */
+  void
+  set_scaling_factor_mass_operator(double const scaling_factor_mass);
+
   /*
    * Block preconditioner
    */
@@ -367,6 +406,13 @@ private:
   void
   apply_inverse_negative_laplace_operator(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Called in every iteration of the outer FGMRES solver to adapt the tolerances of the inner
+   * solves and to switch between inner solves and single multigrid V-cycles.
+   */
+  void
+  monitor_outer_residual(unsigned int const step, double const residual);
+
   /*
    * Newton-Krylov solver for (non-)linear problem
    */
@@ -413,6 +459,18 @@ private:
 
   std::shared_ptr<Krylov::SolverBase<VectorType>> solver_pressure_block;
 
+  // adaptive inner solves
+  double outer_residual_initial;
+
+  // false if a single multigrid V-cycle replaces the inner solves
+  bool use_inner_solves;
+
+  bool         trial_solve;
+  unsigned int n_linear_solves;
+  double       wall_time_last_solve, wall_time_reference;
+
+  dealii::Timer timer_outer_solve;
+
   // temporary vectors that are necessary when using preconditioners of block-triangular type
   VectorType mutable vec_tmp_pressure;
   VectorType mutable vec_tmp_velocity, vec_tmp_velocity_2;
@@ -55,6 +55,115 @@ OperatorDualSplitting<dim, Number>::~OperatorDualSplitting()
 {
 }
 
+template<int dim, typename Number>
+bool
+OperatorDualSplitting<dim, Number>::fused_convective_step_is_available() const
+{
+  return this->param.spatial_discretization == SpatialDiscretization::L2 and
+         this->inverse_mass_velocity.is_cell_local();
+}
+
+template<int dim, typename Number>
+void
+OperatorDualSplitting<dim, Number>::evaluate_convective_step(
+  VectorType &                    dst,
+  std::vector<VectorType> const & convective_terms,
+  std::vector<double> const &     factors_convective,
+  std::vector<VectorType> const & velocities,
+  std::vector<double> const &     factors_velocity,
+  double const                    scaling_factor,
+  double const                    time) const
+{
+  AssertThrow(fused_convective_step_is_available(),
+              dealii::ExcMessage("The fused convective step is not available for the present "
+                                 "discretization and inverse mass operator."));
+
+  AssertThrow(factors_convective.size() <= convective_terms.size() and
+                factors_velocity.size() <= velocities.size(),
+              dealii::ExcMessage("Number of factors exceeds number of vectors."));
+
+  convective_step_data.convective_terms   = &convective_terms;
+  convective_step_data.factors_convective = factors_convective;
+  convective_step_data.velocities         = &velocities;
+  convective_step_data.factors_velocity   = factors_velocity;
+  convective_step_data.scaling_factor     = scaling_factor;
+
+  if(this->param.right_hand_side)
+    this->rhs_operator.set_time(time);
+
+  VectorType src_dummy;
+  this->get_matrix_free().cell_loop(&This::local_convective_step, this, dst, src_dummy);
+}
+
+template<int dim, typename Number>
+void
+OperatorDualSplitting<dim, Number>::local_convective_step(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &,
+  Range const & cell_range) const
+{
+  CellIntegratorU integrator(matrix_free,
+                             this->get_dof_index_velocity(),
+                             this->get_quad_index_velocity_standard());
+
+  CellIntegratorP integrator_temperature(matrix_free,
+                                         this->rhs_operator.get_data().dof_index_scalar,
+                                         this->get_quad_index_velocity_standard());
+
+  ConvectiveStepData const & data = convective_step_data;
+
+  dealii::AlignedVector<scalar> values(integrator.dofs_per_cell);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    // body force term and extrapolated convective term
+    if(this->param.right_hand_side)
+    {
+      this->rhs_operator.evaluate_cell(integrator, integrator_temperature, cell);
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        values[i] = integrator.begin_dof_values()[i];
+    }
+    else
+    {
+      integrator.reinit(cell);
+      values.fill(scalar(0.0));
+    }
+
+    for(unsigned int k = 0; k < data.factors_convective.size(); ++k)
+    {
+      integrator.read_dof_values((*data.convective_terms)[k]);
+      scalar const factor = static_cast<Number>(data.factors_convective[k]);
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        values[i] += factor * integrator.begin_dof_values()[i];
+    }
+
+    // inverse mass operator
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] = values[i];
+
+    this->inverse_mass_velocity.apply_on_cell(integrator);
+
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      values[i] = integrator.begin_dof_values()[i];
+
+    // sum of the velocities of the BDF scheme
+    for(unsigned int k = 0; k < data.factors_velocity.size(); ++k)
+    {
+      integrator.read_dof_values((*data.velocities)[k]);
+      scalar const factor = static_cast<Number>(data.factors_velocity[k]);
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        values[i] += factor * integrator.begin_dof_values()[i];
+    }
+
+    scalar const scaling_factor = static_cast<Number>(data.scaling_factor);
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] = scaling_factor * values[i];
+
+    integrator.set_dof_values(dst);
+  }
+}
+
 template<int dim, typename Number>
 void
 OperatorDualSplitting<dim, Number>::apply_velocity_divergence_term(VectorType &       dst,
@@ -117,12 +226,14 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_div_term_body_forces_boundary_
         // and avoids a scaling of the resulting vector by the factor -1.0
         integrator.submit_value(-flux_times_normal, q);
       }
-      else if(boundary_type == BoundaryTypeU::Neumann or boundary_type == BoundaryTypeU::Symmetry)
+      else if(boundary_type == BoundaryTypeU::Neumann or
+              boundary_type == BoundaryTypeU::Symmetry or boundary_type == BoundaryTypeU::WallModel)
       {
-        // Do nothing on Neumann and symmetry boundaries.
+        // Do nothing on Neumann, symmetry, and wall model boundaries.
         // Remark: On symmetry boundaries it follows from g_u * n = 0 that also g_{u_hat} * n = 0.
         // Hence, a symmetry boundary for u is also a symmetry boundary for u_hat. Hence, there
-        // are no inhomogeneous contributions on symmetry boundaries.
+        // are no inhomogeneous contributions on symmetry boundaries. The same holds for wall model
+        // boundaries.
         scalar zero = dealii::make_vectorized_array<Number>(0.0);
         integrator.submit_value(zero, q);
       }
@@ -231,12 +342,14 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_div_term_convective_term_bound
 
         pressure.submit_value(flux_times_normal, q);
       }
-      else if(boundary_type == BoundaryTypeU::Neumann or boundary_type == BoundaryTypeU::Symmetry)
+      else if(boundary_type == BoundaryTypeU::Neumann or
+              boundary_type == BoundaryTypeU::Symmetry or boundary_type == BoundaryTypeU::WallModel)
       {
-        // Do nothing on Neumann and symmetry boundaries.
+        // Do nothing on Neumann, symmetry, and wall model boundaries.
         // Remark: On symmetry boundaries it follows from g_u * n = 0 that also g_{u_hat} * n = 0.
         // Hence, a symmetry boundary for u is also a symmetry boundary for u_hat. Hence, there
-        // are no inhomogeneous contributions on symmetry boundaries.
+        // are no inhomogeneous contributions on symmetry boundaries. The same holds for wall model
+        // boundaries.
         scalar zero = dealii::make_vectorized_array<Number>(0.0);
         pressure.submit_value(zero, q);
       }
@@ -519,6 +632,9 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_viscous_add_boundary_face(
     omega.reinit(face);
     omega.gather_evaluate(src, dealii::EvaluationFlags::gradients);
 
+    if(this->param.viscosity_is_variable())
+      this->viscous_kernel->reinit_boundary_face_viscosity(face);
+
     BoundaryTypeP boundary_type =
       this->boundary_descriptor->pressure->get_boundary_type(matrix_free.get_boundary_id(face));
 
@@ -650,7 +766,8 @@ OperatorDualSplitting<dim, Number>::local_interpolate_velocity_dirichlet_bc_boun
     else
     {
       AssertThrow(boundary_type == BoundaryTypeU::Neumann or
-                    boundary_type == BoundaryTypeU::Symmetry,
+                    boundary_type == BoundaryTypeU::Symmetry or
+                    boundary_type == BoundaryTypeU::WallModel,
                   dealii::ExcMessage("BoundaryTypeU not implemented."));
     }
   }
@@ -49,6 +49,9 @@ private:
   typedef typename Base::FaceIntegratorU FaceIntegratorU;
   typedef typename Base::FaceIntegratorP FaceIntegratorP;
 
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorP;
+
 public:
   /*
    * Constructor.
@@ -67,6 +70,38 @@ public:
    */
   virtual ~OperatorDualSplitting();
 
+  /*
+   * Convective step.
+   */
+
+  /*
+   * Whether evaluate_convective_step() can be used, which requires an L2-conforming discretization
+   * with a cell-local inverse mass operator.
+   */
+  bool
+  fused_convective_step_is_available() const;
+
+  /*
+   * Explicit convective step in a single cell loop:
+   *
+   *   dst = scaling_factor * (M^{-1} (sum_i factors_convective[i] * convective_terms[i] + f(time))
+   *                           + sum_i factors_velocity[i] * velocities[i]),
+   *
+   * where convective_terms are the evaluated convective terms (already multiplied by the mass
+   * matrix) and the body force term f is only added if right_hand_side is set. Only the first
+   * factors_convective.size() and factors_velocity.size() vectors are used. This is equivalent to
+   * the separate evaluation of the linear combinations, the body force term, and the inverse mass
+   * operator, but reads and writes each vector only once.
+   */
+  void
+  evaluate_convective_step(VectorType &                    dst,
+                           std::vector<VectorType> const & convective_terms,
+                           std::vector<double> const &     factors_convective,
+                           std::vector<VectorType> const & velocities,
+                           std::vector<double> const &     factors_velocity,
+                           double const                    scaling_factor,
+                           double const                    time) const;
+
   /*
    * Pressure Poisson equation.
    */
@@ -129,6 +164,28 @@ public:
   interpolate_velocity_dirichlet_bc(VectorType & dst, double const & time) const;
 
 private:
+  /*
+   * convective step
+   */
+
+  void
+  local_convective_step(dealii::MatrixFree<dim, Number> const & matrix_free,
+                        VectorType &                            dst,
+                        VectorType const &                      src,
+                        Range const &                           cell_range) const;
+
+  // data of the current call to evaluate_convective_step()
+  struct ConvectiveStepData
+  {
+    std::vector<VectorType> const * convective_terms = nullptr;
+    std::vector<double>             factors_convective;
+    std::vector<VectorType> const * velocities = nullptr;
+    std::vector<double>             factors_velocity;
+    double                          scaling_factor = 1.0;
+  };
+
+  mutable ConvectiveStepData convective_step_data;
+
   /*
    * rhs pressure Poisson equation
    */
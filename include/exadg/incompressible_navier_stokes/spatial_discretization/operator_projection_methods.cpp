@@ -22,6 +22,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_projection_methods.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/static_condensation_solver.h>
 #include <exadg/solvers_and_preconditioners/utilities/check_multigrid.h>
 
 namespace ExaDG
@@ -59,6 +60,9 @@ void
 OperatorProjectionMethods<dim, Number>::setup_derived()
 {
   initialize_laplace_operator();
+
+  if(this->param.use_modal_filter)
+    initialize_modal_filter();
 }
 
 template<int dim, typename Number>
@@ -70,6 +74,10 @@ OperatorProjectionMethods<dim, Number>::update_after_grid_motion(bool const upda
   // update SIPG penalty parameter of Laplace operator which depends on the deformation
   // of elements
   laplace_operator.update_penalty_parameter();
+
+  // the previous solutions belong to the operator of the old grid
+  if(initial_guess_projection_pressure.get() != nullptr)
+    initial_guess_projection_pressure->clear();
 }
 
 template<int dim, typename Number>
@@ -79,10 +87,25 @@ OperatorProjectionMethods<dim, Number>::setup_preconditioners_and_solvers()
   setup_preconditioner_pressure_poisson();
   setup_solver_pressure_poisson();
 
-  Base::setup_projection_solver();
+  // The projection solver is only needed if penalty terms are used, and the momentum solver only
+  // if the viscous or the convective term is treated implicitly. Both are set up at first use.
+  this->projection_solver_setup.initialize("Setup of projection solver",
+                                           [this]() { Base::setup_projection_solver(); });
+
+  momentum_solver_setup.initialize("Setup of momentum solver", [this]() {
+    setup_momentum_preconditioner();
+    setup_momentum_solver();
+  });
+}
+
+template<int dim, typename Number>
+void
+OperatorProjectionMethods<dim, Number>::print_deferred_setups(
+  dealii::ConditionalOStream const & pcout) const
+{
+  Base::print_deferred_setups(pcout);
 
-  setup_momentum_preconditioner();
-  setup_momentum_solver();
+  momentum_solver_setup.print(pcout);
 }
 
 template<int dim, typename Number>
@@ -207,7 +230,72 @@ template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::setup_solver_pressure_poisson()
 {
-  if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG)
+  if(this->param.mixed_precision_pressure_poisson)
+  {
+    typedef typename MultigridPoisson::MultigridNumber                  MultigridNumber;
+    typedef dealii::LinearAlgebra::distributed::Vector<MultigridNumber> VectorTypeMG;
+
+    std::shared_ptr<MultigridPoisson> multigrid =
+      std::dynamic_pointer_cast<MultigridPoisson>(preconditioner_pressure_poisson);
+
+    laplace_operator_reduced_precision =
+      std::make_shared<MultigridFineLevelOperator<MultigridPoisson>>(*multigrid);
+    preconditioner_pressure_poisson_reduced_precision =
+      std::make_shared<MultigridReducedPrecisionPreconditioner<MultigridPoisson>>(*multigrid);
+
+    // inner solver in reduced precision
+    std::shared_ptr<Krylov::SolverBase<VectorTypeMG>> inner_solver;
+    if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG)
+    {
+      Krylov::SolverDataCG solver_data;
+      solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+      solver_data.solver_tolerance_rel = this->param.rel_tol_inner_mixed_precision_pressure_poisson;
+      solver_data.use_preconditioner   = true;
+
+      inner_solver = std::make_shared<
+        Krylov::SolverCG<MultigridFineLevelOperator<MultigridPoisson>,
+                         MultigridReducedPrecisionPreconditioner<MultigridPoisson>,
+                         VectorTypeMG>>(*laplace_operator_reduced_precision,
+                                        *preconditioner_pressure_poisson_reduced_precision,
+                                        solver_data);
+    }
+    else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FGMRES)
+    {
+      Krylov::SolverDataFGMRES solver_data;
+      solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+      solver_data.solver_tolerance_rel = this->param.rel_tol_inner_mixed_precision_pressure_poisson;
+      solver_data.max_n_tmp_vectors    = this->param.solver_data_pressure_poisson.max_krylov_size;
+      solver_data.use_preconditioner   = true;
+
+      inner_solver = std::make_shared<
+        Krylov::SolverFGMRES<MultigridFineLevelOperator<MultigridPoisson>,
+                             MultigridReducedPrecisionPreconditioner<MultigridPoisson>,
+                             VectorTypeMG>>(*laplace_operator_reduced_precision,
+                                            *preconditioner_pressure_poisson_reduced_precision,
+                                            solver_data);
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage(
+                    "Specified solver for pressure Poisson equation is not implemented."));
+    }
+
+    // outer iterative refinement
+    Krylov::SolverDataIterativeRefinement solver_data;
+    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+
+    pressure_poisson_solver =
+      std::make_shared<Krylov::SolverIterativeRefinement<Poisson::LaplaceOperator<dim, Number, 1>,
+                                                         VectorType,
+                                                         VectorTypeMG>>(laplace_operator,
+                                                                        inner_solver,
+                                                                        solver_data);
+  }
+  else if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG or
+          this->param.solver_pressure_poisson == SolverPressurePoisson::PipelinedCG)
   {
     // setup solver data
     Krylov::SolverDataCG solver_data;
@@ -222,12 +310,69 @@ OperatorProjectionMethods<dim, Number>::setup_solver_pressure_poisson()
     }
 
     // setup solver
+    if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG)
+    {
+      pressure_poisson_solver =
+        std::make_shared<Krylov::SolverCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                          PreconditionerBase<Number>,
+                                          VectorType>>(laplace_operator,
+                                                       *preconditioner_pressure_poisson,
+                                                       solver_data);
+    }
+    else
+    {
+      pressure_poisson_solver =
+        std::make_shared<Krylov::SolverPipelinedCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                                   PreconditionerBase<Number>,
+                                                   VectorType>>(laplace_operator,
+                                                                *preconditioner_pressure_poisson,
+                                                                solver_data);
+    }
+  }
+  else if(this->param.solver_pressure_poisson == SolverPressurePoisson::DeflatedCG)
+  {
+    Krylov::SolverDataCG solver_data;
+    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+    // use default value of update_preconditioner (=false)
+
+    if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
+    {
+      solver_data.use_preconditioner = true;
+    }
+
+    // the coarse space and the coarse operator are set up once and reused in all time steps
+    std::vector<unsigned int> const subdomain_indices = Krylov::compute_box_subdomain_indices(
+      this->get_dof_handler_p(), this->param.n_subdivisions_1d_deflation_pressure_poisson);
+
     pressure_poisson_solver =
-      std::make_shared<Krylov::SolverCG<Poisson::LaplaceOperator<dim, Number, 1>,
-                                        PreconditionerBase<Number>,
-                                        VectorType>>(laplace_operator,
-                                                     *preconditioner_pressure_poisson,
-                                                     solver_data);
+      std::make_shared<Krylov::SolverDeflatedCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                                PreconditionerBase<Number>,
+                                                VectorType>>(laplace_operator,
+                                                             *preconditioner_pressure_poisson,
+                                                             solver_data,
+                                                             subdomain_indices,
+                                                             this->is_pressure_level_undefined());
+  }
+  else if(this->param.solver_pressure_poisson == SolverPressurePoisson::StaticCondensation)
+  {
+#ifdef DEAL_II_WITH_TRILINOS
+    Krylov::SolverDataCG solver_data;
+    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+
+    // the condensed system is preconditioned by algebraic multigrid with the parameters of the
+    // coarse-grid solver of the pressure Poisson multigrid preconditioner
+    pressure_poisson_solver = std::make_shared<
+      Krylov::SolverStaticCondensation<dim, Poisson::LaplaceOperator<dim, Number, 1>, VectorType>>(
+      laplace_operator,
+      solver_data,
+      this->param.multigrid_data_pressure_poisson.coarse_problem.amg_data.ml_data);
+#else
+    AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
+#endif
   }
   else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FGMRES)
   {
@@ -256,6 +401,12 @@ OperatorProjectionMethods<dim, Number>::setup_solver_pressure_poisson()
                 dealii::ExcMessage(
                   "Specified solver for pressure Poisson equation is not implemented."));
   }
+
+  if(this->param.initial_guess_projection_size_pressure_poisson > 0)
+  {
+    initial_guess_projection_pressure = std::make_shared<InitialGuessProjection<VectorType>>(
+      this->param.initial_guess_projection_size_pressure_poisson);
+  }
 }
 
 template<int dim, typename Number>
@@ -335,7 +486,8 @@ template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::setup_momentum_solver()
 {
-  if(this->param.solver_momentum == SolverMomentum::CG)
+  if(this->param.solver_momentum == SolverMomentum::CG or
+     this->param.solver_momentum == SolverMomentum::PipelinedCG)
   {
     // setup solver data
     Krylov::SolverDataCG solver_data;
@@ -346,11 +498,24 @@ OperatorProjectionMethods<dim, Number>::setup_momentum_solver()
       solver_data.use_preconditioner = true;
 
     // setup solver
-    momentum_linear_solver = std::make_shared<
-      Krylov::SolverCG<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
-      this->momentum_operator, *momentum_preconditioner, solver_data);
+    if(this->param.solver_momentum == SolverMomentum::CG)
+    {
+      momentum_linear_solver = std::make_shared<
+        Krylov::SolverCG<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
+        this->momentum_operator, *momentum_preconditioner, solver_data);
+    }
+    else
+    {
+      momentum_linear_solver =
+        std::make_shared<Krylov::SolverPipelinedCG<MomentumOperator<dim, Number>,
+                                                   PreconditionerBase<Number>,
+                                                   VectorType>>(this->momentum_operator,
+                                                                *momentum_preconditioner,
+                                                                solver_data);
+    }
   }
-  else if(this->param.solver_momentum == SolverMomentum::GMRES)
+  else if(this->param.solver_momentum == SolverMomentum::GMRES or
+          this->param.solver_momentum == SolverMomentum::LowSynchronizationGMRES)
   {
     // setup solver data
     Krylov::SolverDataGMRES solver_data;
@@ -363,9 +528,20 @@ OperatorProjectionMethods<dim, Number>::setup_momentum_solver()
       solver_data.use_preconditioner = true;
 
     // setup solver
-    momentum_linear_solver = std::make_shared<
-      Krylov::SolverGMRES<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
-      this->momentum_operator, *momentum_preconditioner, solver_data, this->mpi_comm);
+    if(this->param.solver_momentum == SolverMomentum::GMRES)
+    {
+      momentum_linear_solver = std::make_shared<
+        Krylov::SolverGMRES<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
+        this->momentum_operator, *momentum_preconditioner, solver_data, this->mpi_comm);
+    }
+    else
+    {
+      momentum_linear_solver =
+        std::make_shared<Krylov::SolverLowSynchronizationGMRES<MomentumOperator<dim, Number>,
+                                                               PreconditionerBase<Number>,
+                                                               VectorType>>(
+          this->momentum_operator, *momentum_preconditioner, solver_data);
+    }
   }
   else if(this->param.solver_momentum == SolverMomentum::FGMRES)
   {
@@ -447,9 +623,15 @@ OperatorProjectionMethods<dim, Number>::do_solve_pressure(VectorType &       dst
   // update preconditioner
   this->pressure_poisson_solver->update_preconditioner(update_preconditioner);
 
+  if(initial_guess_projection_pressure.get() != nullptr)
+    initial_guess_projection_pressure->compute_initial_guess(dst, src);
+
   // call pressure Poisson solver
   unsigned int n_iter = this->pressure_poisson_solver->solve(dst, src);
 
+  if(initial_guess_projection_pressure.get() != nullptr)
+    initial_guess_projection_pressure->add(laplace_operator, dst, src);
+
   return n_iter;
 }
 
@@ -479,6 +661,8 @@ OperatorProjectionMethods<dim, Number>::solve_linear_momentum_equation(
   // because this function is only called if the convective term is not considered
   // in the momentum_operator (Stokes eq. or explicit treatment of convective term).
 
+  momentum_solver_setup.ensure_setup();
+
   this->momentum_linear_solver->update_preconditioner(update_preconditioner);
 
   auto linear_iterations = this->momentum_linear_solver->solve(solution, rhs);
@@ -495,6 +679,8 @@ OperatorProjectionMethods<dim, Number>::solve_nonlinear_momentum_equation(
   bool const &       update_preconditioner,
   double const &     scaling_factor_mass)
 {
+  momentum_solver_setup.ensure_setup();
+
   // update nonlinear operator
   this->nonlinear_operator.update(rhs_vector, time, scaling_factor_mass);
 
@@ -554,6 +740,31 @@ OperatorProjectionMethods<dim, Number>::apply_projection_operator(VectorType &
   this->projection_operator->vmult(dst, src);
 }
 
+template<int dim, typename Number>
+void
+OperatorProjectionMethods<dim, Number>::apply_modal_filter(VectorType &       dst,
+                                                           VectorType const & src) const
+{
+  AssertThrow(this->param.use_modal_filter,
+              dealii::ExcMessage("Modal filter is not initialized correctly."));
+
+  modal_filter.apply(dst, src);
+}
+
+template<int dim, typename Number>
+void
+OperatorProjectionMethods<dim, Number>::initialize_modal_filter()
+{
+  ModalFilterData data;
+  data.dof_index     = this->get_dof_index_velocity();
+  data.quad_index    = this->get_quad_index_velocity_standard();
+  data.strength      = this->param.modal_filter_strength;
+  data.order         = this->param.modal_filter_order;
+  data.cutoff_degree = this->param.modal_filter_cutoff_degree;
+
+  modal_filter.initialize(this->get_matrix_free(), data);
+}
+
 template class OperatorProjectionMethods<2, float>;
 template class OperatorProjectionMethods<2, double>;
 
@@ -24,10 +24,13 @@
 
 #include <exadg/incompressible_navier_stokes/preconditioners/multigrid_preconditioner_momentum.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
+#include <exadg/operators/modal_filter.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_reduced_precision.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/initial_guess_projection.h>
 
 namespace ExaDG
 {
@@ -130,6 +133,9 @@ public:
   void
   update_after_grid_motion(bool const update_matrix_free) override;
 
+  void
+  print_deferred_setups(dealii::ConditionalOStream const & pcout) const override;
+
   /*
    * Pressure Poisson equation: This function evaluates the inhomogeneous parts of boundary face
    * integrals of the negative Laplace operator and adds the result to the dst-vector.
@@ -157,6 +163,13 @@ public:
   void
   apply_laplace_operator(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * This function applies the cell-local modal filter of the velocity, dst = F src. The vectors
+   * dst and src must not be the same vector.
+   */
+  void
+  apply_modal_filter(VectorType & dst, VectorType const & src) const;
+
   /*
    * Momentum step:
    */
@@ -205,6 +218,15 @@ protected:
 
   std::shared_ptr<Krylov::SolverBase<VectorType>> pressure_poisson_solver;
 
+  // operator and preconditioner in the precision of the multigrid levels for the mixed-precision
+  // pressure Poisson solver (optional)
+  std::shared_ptr<MultigridFineLevelOperator<MultigridPoisson>> laplace_operator_reduced_precision;
+  std::shared_ptr<MultigridReducedPrecisionPreconditioner<MultigridPoisson>>
+    preconditioner_pressure_poisson_reduced_precision;
+
+  // initial guess of the pressure Poisson solver from previous solutions (optional)
+  std::shared_ptr<InitialGuessProjection<VectorType>> initial_guess_projection_pressure;
+
   /*
    * Momentum equation.
    */
@@ -228,10 +250,19 @@ protected:
   void
   setup_momentum_solver();
 
+  // the momentum preconditioner and solver are set up at their first use
+  LazySetup momentum_solver_setup;
+
 private:
   void
   initialize_laplace_operator();
 
+  void
+  initialize_modal_filter();
+
+  // cell-local filter of the velocity (optional)
+  ModalFilter<dim, dim, Number> modal_filter;
+
   /*
    * Setup functions called during setup of pressure Poisson solver.
    */
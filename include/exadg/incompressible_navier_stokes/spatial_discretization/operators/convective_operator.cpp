@@ -62,6 +62,8 @@ ConvectiveOperator<dim, Number>::initialize(
   Base::reinit(matrix_free, affine_constraints, data);
 
   this->integrator_flags = kernel->get_integrator_flags();
+
+  degree = matrix_free.get_dof_handler(data.dof_index).get_fe().degree;
 }
 
 template<int dim, typename Number>
@@ -72,6 +74,9 @@ ConvectiveOperator<dim, Number>::evaluate_nonlinear_operator(VectorType &
 {
   this->time = time;
 
+  if(operator_data.adaptive_overintegration)
+    compute_overintegration_indicator(src);
+
   this->matrix_free->loop(&This::cell_loop_nonlinear_operator,
                           &This::face_loop_nonlinear_operator,
                           &This::boundary_face_loop_nonlinear_operator,
@@ -91,6 +96,9 @@ ConvectiveOperator<dim, Number>::evaluate_nonlinear_operator_add(VectorType &
 {
   this->time = time;
 
+  if(operator_data.adaptive_overintegration)
+    compute_overintegration_indicator(src);
+
   this->matrix_free->loop(&This::cell_loop_nonlinear_operator,
                           &This::face_loop_nonlinear_operator,
                           &This::boundary_face_loop_nonlinear_operator,
@@ -148,6 +156,83 @@ ConvectiveOperator<dim, Number>::evaluate_add(VectorType & dst, VectorType const
                 "The function evaluate_add() does not make sense for the convective operator."));
 }
 
+template<int dim, typename Number>
+void
+ConvectiveOperator<dim, Number>::compute_overintegration_indicator(VectorType const & src) const
+{
+  cell_is_overintegrated.resize(this->matrix_free->n_cell_batches());
+
+  VectorType dummy;
+
+  this->matrix_free->cell_loop(&This::cell_loop_overintegration_indicator, this, dummy, src);
+}
+
+template<int dim, typename Number>
+void
+ConvectiveOperator<dim, Number>::cell_loop_overintegration_indicator(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &,
+  VectorType const & src,
+  Range const &      cell_range) const
+{
+  IntegratorCell integrator(matrix_free,
+                            operator_data.dof_index,
+                            operator_data.quad_index_nonlinear_standard);
+
+  // the cell Reynolds number is compared to the threshold without dividing by the viscosity,
+  // which might be zero
+  Number const threshold =
+    operator_data.adaptive_overintegration_threshold * operator_data.viscosity * degree;
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+    scalar velocity_norm_square = dealii::make_vectorized_array<Number>(0.0);
+    scalar volume               = dealii::make_vectorized_array<Number>(0.0);
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      velocity_norm_square = std::max(velocity_norm_square, integrator.get_value(q).norm_square());
+      volume += integrator.JxW(q);
+    }
+
+    scalar const velocity_times_h =
+      std::sqrt(velocity_norm_square) * std::pow(volume, static_cast<Number>(1.0 / dim));
+
+    cell_is_overintegrated[cell] = 0;
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      if(velocity_times_h[v] >= threshold)
+        cell_is_overintegrated[cell] = 1;
+  }
+}
+
+template<int dim, typename Number>
+bool
+ConvectiveOperator<dim, Number>::face_is_overintegrated(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  unsigned int const                      face) const
+{
+  // Cells not owned by this process (the exterior cells of faces at processor boundaries) are not
+  // considered since their indicator is not available.
+  auto const is_overintegrated = [&](unsigned int const cell_index) {
+    unsigned int const cell_batch = cell_index / dealii::VectorizedArray<Number>::size();
+    return cell_batch < cell_is_overintegrated.size() and cell_is_overintegrated[cell_batch] == 1;
+  };
+
+  auto const & face_info = matrix_free.get_face_info(face);
+  for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+  {
+    if(is_overintegrated(face_info.cells_interior[v]))
+      return true;
+
+    if(face < matrix_free.n_inner_face_batches() and is_overintegrated(face_info.cells_exterior[v]))
+      return true;
+  }
+
+  return false;
+}
+
 template<int dim, typename Number>
 void
 ConvectiveOperator<dim, Number>::cell_loop_nonlinear_operator(
@@ -156,15 +241,30 @@ ConvectiveOperator<dim, Number>::cell_loop_nonlinear_operator(
   VectorType const &                      src,
   Range const &                           cell_range) const
 {
-  IntegratorCell integrator(matrix_free,
-                            operator_data.dof_index,
-                            operator_data.quad_index_nonlinear);
-  IntegratorCell integrator_grid_velocity(matrix_free,
-                                          operator_data.dof_index,
-                                          operator_data.quad_index_nonlinear);
+  IntegratorCell integrator_overintegration(matrix_free,
+                                            operator_data.dof_index,
+                                            operator_data.quad_index_nonlinear);
+  IntegratorCell integrator_grid_velocity_overintegration(matrix_free,
+                                                          operator_data.dof_index,
+                                                          operator_data.quad_index_nonlinear);
+
+  IntegratorCell integrator_standard(matrix_free,
+                                     operator_data.dof_index,
+                                     operator_data.quad_index_nonlinear_standard);
+  IntegratorCell integrator_grid_velocity_standard(matrix_free,
+                                                   operator_data.dof_index,
+                                                   operator_data.quad_index_nonlinear_standard);
 
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
+    bool const overintegrate =
+      not operator_data.adaptive_overintegration or cell_is_overintegrated[cell] == 1;
+
+    IntegratorCell & integrator =
+      overintegrate ? integrator_overintegration : integrator_standard;
+    IntegratorCell & integrator_grid_velocity =
+      overintegrate ? integrator_grid_velocity_overintegration : integrator_grid_velocity_standard;
+
     integrator.reinit(cell);
 
     // Strictly speaking, the variable integrator_flags refers to the linearized operator, but
@@ -192,22 +292,44 @@ ConvectiveOperator<dim, Number>::face_loop_nonlinear_operator(
   VectorType const &                      src,
   Range const &                           face_range) const
 {
-  IntegratorFace integrator_m(matrix_free,
-                              true,
-                              operator_data.dof_index,
-                              operator_data.quad_index_nonlinear);
-  IntegratorFace integrator_p(matrix_free,
-                              false,
-                              operator_data.dof_index,
-                              operator_data.quad_index_nonlinear);
-
-  IntegratorFace integrator_grid_velocity(matrix_free,
-                                          true,
-                                          operator_data.dof_index,
-                                          operator_data.quad_index_nonlinear);
+  IntegratorFace integrator_m_overintegration(matrix_free,
+                                              true,
+                                              operator_data.dof_index,
+                                              operator_data.quad_index_nonlinear);
+  IntegratorFace integrator_p_overintegration(matrix_free,
+                                              false,
+                                              operator_data.dof_index,
+                                              operator_data.quad_index_nonlinear);
+  IntegratorFace integrator_grid_velocity_overintegration(matrix_free,
+                                                          true,
+                                                          operator_data.dof_index,
+                                                          operator_data.quad_index_nonlinear);
+
+  IntegratorFace integrator_m_standard(matrix_free,
+                                       true,
+                                       operator_data.dof_index,
+                                       operator_data.quad_index_nonlinear_standard);
+  IntegratorFace integrator_p_standard(matrix_free,
+                                       false,
+                                       operator_data.dof_index,
+                                       operator_data.quad_index_nonlinear_standard);
+  IntegratorFace integrator_grid_velocity_standard(matrix_free,
+                                                   true,
+                                                   operator_data.dof_index,
+                                                   operator_data.quad_index_nonlinear_standard);
 
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
+    bool const overintegrate =
+      not operator_data.adaptive_overintegration or face_is_overintegrated(matrix_free, face);
+
+    IntegratorFace & integrator_m =
+      overintegrate ? integrator_m_overintegration : integrator_m_standard;
+    IntegratorFace & integrator_p =
+      overintegrate ? integrator_p_overintegration : integrator_p_standard;
+    IntegratorFace & integrator_grid_velocity =
+      overintegrate ? integrator_grid_velocity_overintegration : integrator_grid_velocity_standard;
+
     integrator_m.reinit(face);
     integrator_p.reinit(face);
 
@@ -240,18 +362,34 @@ ConvectiveOperator<dim, Number>::boundary_face_loop_nonlinear_operator(
   VectorType const &                      src,
   Range const &                           face_range) const
 {
-  IntegratorFace integrator_m(matrix_free,
-                              true,
-                              operator_data.dof_index,
-                              operator_data.quad_index_nonlinear);
-
-  IntegratorFace integrator_grid_velocity(matrix_free,
-                                          true,
-                                          operator_data.dof_index,
-                                          operator_data.quad_index_nonlinear);
+  IntegratorFace integrator_m_overintegration(matrix_free,
+                                              true,
+                                              operator_data.dof_index,
+                                              operator_data.quad_index_nonlinear);
+  IntegratorFace integrator_grid_velocity_overintegration(matrix_free,
+                                                          true,
+                                                          operator_data.dof_index,
+                                                          operator_data.quad_index_nonlinear);
+
+  IntegratorFace integrator_m_standard(matrix_free,
+                                       true,
+                                       operator_data.dof_index,
+                                       operator_data.quad_index_nonlinear_standard);
+  IntegratorFace integrator_grid_velocity_standard(matrix_free,
+                                                   true,
+                                                   operator_data.dof_index,
+                                                   operator_data.quad_index_nonlinear_standard);
 
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
+    bool const overintegrate =
+      not operator_data.adaptive_overintegration or face_is_overintegrated(matrix_free, face);
+
+    IntegratorFace & integrator_m =
+      overintegrate ? integrator_m_overintegration : integrator_m_standard;
+    IntegratorFace & integrator_grid_velocity =
+      overintegrate ? integrator_grid_velocity_overintegration : integrator_grid_velocity_standard;
+
     integrator_m.reinit(face);
 
     // Strictly speaking, the variable integrator_flags refers to the linearized operator, but
@@ -809,7 +809,7 @@ public:
     {
       delta_uP = delta_uM;
     }
-    else if(boundary_type == BoundaryTypeU::Symmetry)
+    else if(boundary_type == BoundaryTypeU::Symmetry or boundary_type == BoundaryTypeU::WallModel)
     {
       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normalM =
         integrator.get_normal_vector(q);
@@ -844,7 +844,13 @@ private:
 template<int dim>
 struct ConvectiveOperatorData : public OperatorBaseData
 {
-  ConvectiveOperatorData() : OperatorBaseData(), quad_index_nonlinear(0)
+  ConvectiveOperatorData()
+    : OperatorBaseData(),
+      quad_index_nonlinear(0),
+      adaptive_overintegration(false),
+      quad_index_nonlinear_standard(0),
+      adaptive_overintegration_threshold(1.0),
+      viscosity(0.0)
   {
   }
 
@@ -862,6 +868,17 @@ struct ConvectiveOperatorData : public OperatorBaseData
    */
   unsigned int quad_index_nonlinear;
 
+  /*
+   * Adaptive choice of the quadrature rule for the nonlinear operator: cell batches in which the
+   * cell Reynolds number |u| h / (viscosity k) stays below the threshold for all cells are
+   * integrated with the standard quadrature rule quad_index_nonlinear_standard, all other cell
+   * batches and the faces adjacent to them with quad_index_nonlinear.
+   */
+  bool         adaptive_overintegration;
+  unsigned int quad_index_nonlinear_standard;
+  double       adaptive_overintegration_threshold;
+  double       viscosity;
+
   std::shared_ptr<BoundaryDescriptorU<dim> const> bc;
 };
 
@@ -950,6 +967,22 @@ private:
                                         VectorType const &                      src,
                                         Range const &                           face_range) const;
 
+  /*
+   * Marks the cell batches that need over-integration in case of adaptive over-integration.
+   */
+  void
+  cell_loop_overintegration_indicator(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                      VectorType &                            dst,
+                                      VectorType const &                      src,
+                                      Range const &                           cell_range) const;
+
+  void
+  compute_overintegration_indicator(VectorType const & src) const;
+
+  bool
+  face_is_overintegrated(dealii::MatrixFree<dim, Number> const & matrix_free,
+                         unsigned int const                      face) const;
+
   void
   do_cell_integral_nonlinear_operator(IntegratorCell & integrator,
                                       IntegratorCell & integrator_u_grid) const;
@@ -1025,6 +1058,13 @@ private:
   ConvectiveOperatorData<dim> operator_data;
 
   std::shared_ptr<Operators::ConvectiveKernel<dim, Number>> kernel;
+
+  // polynomial degree of the velocity, needed for the cell Reynolds number
+  unsigned int degree;
+
+  // one for cell batches evaluated with the over-integration rule, zero otherwise (not a vector of
+  // bool since the entries are written concurrently by different threads)
+  mutable std::vector<unsigned char> cell_is_overintegrated;
 };
 
 } // namespace IncNS
@@ -118,6 +118,15 @@ public:
     return this->data;
   }
 
+  /*
+   * Penalty parameters of the locally owned and ghost cell batches
+   */
+  dealii::AlignedVector<scalar> const &
+  get_penalty_parameter() const
+  {
+    return array_penalty_parameter;
+  }
+
   IntegratorFlags
   get_integrator_flags() const
   {
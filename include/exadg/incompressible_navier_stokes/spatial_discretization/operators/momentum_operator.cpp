@@ -20,13 +20,22 @@
  */
 
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/momentum_operator.h>
+#include <exadg/solvers_and_preconditioners/utilities/block_jacobi_matrices.h>
 
 namespace ExaDG
 {
 namespace IncNS
 {
 template<int dim, typename Number>
-MomentumOperator<dim, Number>::MomentumOperator() : scaling_factor_mass(1.0)
+MomentumOperator<dim, Number>::MomentumOperator()
+  : scaling_factor_mass(1.0),
+    mass_term_enabled(true),
+    convective_term_enabled(true),
+    viscous_term_enabled(true),
+    diagonal_contributions_cached(false),
+    scaling_factor_mass_diagonal(1.0),
+    block_diagonal_contributions_cached(false),
+    scaling_factor_mass_block_diagonal(1.0)
 {
 }
 
@@ -155,6 +164,10 @@ MomentumOperator<dim, Number>::update_after_grid_motion()
   if(operator_data.viscous_problem)
     viscous_kernel->calculate_penalty_parameter(this->get_matrix_free(),
                                                 this->get_data().dof_index);
+
+  // cached contributions depend on the geometry
+  diagonal_contributions_cached       = false;
+  block_diagonal_contributions_cached = false;
 }
 
 template<int dim, typename Number>
@@ -232,6 +245,169 @@ MomentumOperator<dim, Number>::evaluate_add(VectorType & dst, VectorType const &
                 "The function evaluate_add() does not make sense for the momentum operator."));
 }
 
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::calculate_diagonal(VectorType & diagonal) const
+{
+  if(not operator_data.cache_diagonal_contributions)
+  {
+    Base::calculate_diagonal(diagonal);
+    return;
+  }
+
+  if(not diagonal_contributions_cached)
+    calculate_cached_diagonal_contributions();
+
+  // terms that are not cached
+  bool const convective = operator_data.convective_problem;
+  bool const viscous    = operator_data.viscous_problem and not viscous_term_is_cached();
+  if(convective or viscous)
+  {
+    enable_terms(false, convective, viscous);
+    Base::calculate_diagonal(diagonal);
+    enable_terms(true, true, true);
+  }
+  else
+  {
+    if(diagonal.size() == 0)
+      this->initialize_dof_vector(diagonal);
+    diagonal = 0;
+  }
+
+  if(operator_data.unsteady_problem)
+    diagonal.add(scaling_factor_mass / scaling_factor_mass_diagonal, diagonal_mass);
+
+  if(viscous_term_is_cached())
+    diagonal.add(1.0, diagonal_viscous);
+}
+
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::add_block_diagonal_matrices(
+  std::vector<LAPACKMatrix> & matrices) const
+{
+  if(not operator_data.cache_diagonal_contributions)
+  {
+    Base::add_block_diagonal_matrices(matrices);
+    return;
+  }
+
+  if(not block_diagonal_contributions_cached)
+    calculate_cached_block_diagonal_contributions(matrices);
+
+  // terms that are not cached
+  bool const convective = operator_data.convective_problem;
+  bool const viscous    = operator_data.viscous_problem and not viscous_term_is_cached();
+  if(convective or viscous)
+  {
+    enable_terms(false, convective, viscous);
+    Base::add_block_diagonal_matrices(matrices);
+    enable_terms(true, true, true);
+  }
+
+  Number const factor = scaling_factor_mass / scaling_factor_mass_block_diagonal;
+  for(unsigned int i = 0; i < matrices.size(); ++i)
+  {
+    if(operator_data.unsteady_problem)
+      matrices[i].add(factor, block_diagonal_mass[i]);
+
+    if(viscous_term_is_cached())
+      matrices[i].add(1.0, block_diagonal_viscous[i]);
+  }
+}
+
+template<int dim, typename Number>
+bool
+MomentumOperator<dim, Number>::evaluate_mass_term() const
+{
+  return operator_data.unsteady_problem and mass_term_enabled;
+}
+
+template<int dim, typename Number>
+bool
+MomentumOperator<dim, Number>::evaluate_convective_term() const
+{
+  return operator_data.convective_problem and convective_term_enabled;
+}
+
+template<int dim, typename Number>
+bool
+MomentumOperator<dim, Number>::evaluate_viscous_term() const
+{
+  return operator_data.viscous_problem and viscous_term_enabled;
+}
+
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::enable_terms(bool const mass,
+                                            bool const convective,
+                                            bool const viscous) const
+{
+  mass_term_enabled       = mass;
+  convective_term_enabled = convective;
+  viscous_term_enabled    = viscous;
+}
+
+template<int dim, typename Number>
+bool
+MomentumOperator<dim, Number>::viscous_term_is_cached() const
+{
+  return operator_data.viscous_problem and
+         not viscous_kernel->get_data().viscosity_is_variable;
+}
+
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::calculate_cached_diagonal_contributions() const
+{
+  if(operator_data.unsteady_problem)
+  {
+    enable_terms(true, false, false);
+    Base::calculate_diagonal(diagonal_mass);
+    scaling_factor_mass_diagonal = scaling_factor_mass;
+  }
+
+  if(viscous_term_is_cached())
+  {
+    enable_terms(false, false, true);
+    Base::calculate_diagonal(diagonal_viscous);
+  }
+
+  enable_terms(true, true, true);
+
+  diagonal_contributions_cached = true;
+}
+
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::calculate_cached_block_diagonal_contributions(
+  std::vector<LAPACKMatrix> const & matrices) const
+{
+  // the matrices passed to this function define the size of the block matrices
+  if(operator_data.unsteady_problem)
+  {
+    block_diagonal_mass = matrices;
+    initialize_block_jacobi_matrices_with_zero(block_diagonal_mass);
+
+    enable_terms(true, false, false);
+    Base::add_block_diagonal_matrices(block_diagonal_mass);
+    scaling_factor_mass_block_diagonal = scaling_factor_mass;
+  }
+
+  if(viscous_term_is_cached())
+  {
+    block_diagonal_viscous = matrices;
+    initialize_block_jacobi_matrices_with_zero(block_diagonal_viscous);
+
+    enable_terms(false, false, true);
+    Base::add_block_diagonal_matrices(block_diagonal_viscous);
+  }
+
+  enable_terms(true, true, true);
+
+  block_diagonal_contributions_cached = true;
+}
+
 template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrator,
@@ -241,6 +417,9 @@ MomentumOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrator
 
   if(operator_data.convective_problem)
     convective_kernel->reinit_cell(cell);
+
+  if(operator_data.viscous_problem)
+    viscous_kernel->reinit_cell(cell);
 }
 
 template<int dim, typename Number>
@@ -304,12 +483,12 @@ MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) con
     if(this->integrator_flags.cell_evaluate & dealii::EvaluationFlags::gradients)
       gradient = integrator.get_gradient(q);
 
-    if(operator_data.unsteady_problem)
+    if(evaluate_mass_term())
     {
       value_flux += mass_kernel->get_volume_flux(scaling_factor_mass, value);
     }
 
-    if(operator_data.convective_problem)
+    if(evaluate_convective_term())
     {
       if(operator_data.convective_kernel_data.formulation ==
          FormulationConvectiveTerm::DivergenceFormulation)
@@ -329,7 +508,7 @@ MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) con
       }
     }
 
-    if(operator_data.viscous_problem)
+    if(evaluate_viscous_term())
     {
       scalar viscosity = viscous_kernel->get_viscosity_cell(integrator.get_current_cell_index(), q);
       gradient_flux += viscous_kernel->get_volume_flux(gradient, viscosity);
@@ -357,7 +536,7 @@ MomentumOperator<dim, Number>::do_face_integral(IntegratorFace & integrator_m,
     vector value_flux_m, value_flux_p;
     tensor gradient_flux;
 
-    if(operator_data.convective_problem)
+    if(evaluate_convective_term())
     {
       vector u_m = convective_kernel->get_velocity_m(q);
       vector u_p = convective_kernel->get_velocity_p(q);
@@ -370,7 +549,7 @@ MomentumOperator<dim, Number>::do_face_integral(IntegratorFace & integrator_m,
       value_flux_p += std::get<1>(flux);
     }
 
-    if(operator_data.viscous_problem)
+    if(evaluate_viscous_term())
     {
       scalar average_viscosity =
         viscous_kernel->get_viscosity_interior_face(integrator_m.get_current_cell_index(), q);
@@ -415,7 +594,7 @@ MomentumOperator<dim, Number>::do_face_int_integral(IntegratorFace & integrator_
     vector value_flux_m;
     tensor gradient_flux;
 
-    if(operator_data.convective_problem)
+    if(evaluate_convective_term())
     {
       vector u_m = convective_kernel->get_velocity_m(q);
       vector u_p = convective_kernel->get_velocity_p(q);
@@ -424,7 +603,7 @@ MomentumOperator<dim, Number>::do_face_int_integral(IntegratorFace & integrator_
         u_m, u_p, value_m, value_p, normal_m, q);
     }
 
-    if(operator_data.viscous_problem)
+    if(evaluate_viscous_term())
     {
       scalar average_viscosity =
         viscous_kernel->get_viscosity_interior_face(integrator_m.get_current_cell_index(), q);
@@ -466,7 +645,7 @@ MomentumOperator<dim, Number>::do_face_int_integral_cell_based(IntegratorFace &
     vector value_flux_m;
     tensor gradient_flux;
 
-    if(operator_data.convective_problem)
+    if(evaluate_convective_term())
     {
       vector u_m = convective_kernel->get_velocity_m(q);
       // TODO
@@ -479,7 +658,7 @@ MomentumOperator<dim, Number>::do_face_int_integral_cell_based(IntegratorFace &
         u_m, u_p, value_m, value_p, normal_m, q);
     }
 
-    if(operator_data.viscous_problem)
+    if(evaluate_viscous_term())
     {
       scalar average_viscosity =
         viscous_kernel->get_viscosity_interior_face(integrator_m.get_current_cell_index(), q);
@@ -522,7 +701,7 @@ MomentumOperator<dim, Number>::do_face_ext_integral(IntegratorFace & integrator_
     vector value_flux_p;
     tensor gradient_flux;
 
-    if(operator_data.convective_problem)
+    if(evaluate_convective_term())
     {
       vector u_m = convective_kernel->get_velocity_m(q);
       vector u_p = convective_kernel->get_velocity_p(q);
@@ -531,7 +710,7 @@ MomentumOperator<dim, Number>::do_face_ext_integral(IntegratorFace & integrator_
         u_p, u_m, value_p, value_m, normal_p, q);
     }
 
-    if(operator_data.viscous_problem)
+    if(evaluate_viscous_term())
     {
       scalar average_viscosity =
         viscous_kernel->get_viscosity_interior_face(integrator_p.get_current_cell_index(), q);
@@ -583,7 +762,7 @@ MomentumOperator<dim, Number>::do_boundary_integral(
     vector value_flux_m;
     tensor gradient_flux;
 
-    if(operator_data.convective_problem)
+    if(evaluate_convective_term())
     {
       // value_p is calculated differently for the convective term and the viscous term
       value_p = convective_kernel->calculate_exterior_value_linearized(value_m,
@@ -606,7 +785,7 @@ MomentumOperator<dim, Number>::do_boundary_integral(
         u_m, u_p, value_m, value_p, normal_m, boundary_type, q);
     }
 
-    if(operator_data.viscous_problem)
+    if(evaluate_viscous_term())
     {
       // value_p is calculated differently for the convective term and the viscous term
       value_p = calculate_exterior_value(value_m,
@@ -35,7 +35,11 @@ template<int dim>
 struct MomentumOperatorData : public OperatorBaseData
 {
   MomentumOperatorData()
-    : OperatorBaseData(), unsteady_problem(false), convective_problem(false), viscous_problem(false)
+    : OperatorBaseData(),
+      unsteady_problem(false),
+      convective_problem(false),
+      viscous_problem(false),
+      cache_diagonal_contributions(false)
   {
   }
 
@@ -43,6 +47,12 @@ struct MomentumOperatorData : public OperatorBaseData
   bool convective_problem;
   bool viscous_problem;
 
+  // Store the diagonal and block-diagonal contributions of the mass term and the viscous term when
+  // the preconditioner is computed for the first time. Subsequent updates then only rescale the
+  // mass contribution by the current scaling factor and recompute the convective term. The viscous
+  // term is only cached for constant viscosity.
+  bool cache_diagonal_contributions;
+
   Operators::ConvectiveKernelData convective_kernel_data;
   Operators::ViscousKernelData    viscous_kernel_data;
 
@@ -62,6 +72,7 @@ private:
   typedef typename Base::VectorType     VectorType;
   typedef typename Base::IntegratorCell IntegratorCell;
   typedef typename Base::IntegratorFace IntegratorFace;
+  typedef typename Base::LAPACKMatrix   LAPACKMatrix;
 
 public:
   // required by preconditioner interfaces
@@ -136,7 +147,42 @@ public:
   void
   evaluate_add(VectorType & dst, VectorType const & src) const final;
 
+  /*
+   * Diagonal and block-diagonal, see MomentumOperatorData::cache_diagonal_contributions.
+   */
+  void
+  calculate_diagonal(VectorType & diagonal) const final;
+
+  void
+  add_block_diagonal_matrices(std::vector<LAPACKMatrix> & matrices) const final;
+
 private:
+  /*
+   * Terms evaluated by the integrals of this operator. By default, all terms of the operator are
+   * evaluated. Only a subset of terms is evaluated when computing cached diagonal contributions.
+   */
+  bool
+  evaluate_mass_term() const;
+
+  bool
+  evaluate_convective_term() const;
+
+  bool
+  evaluate_viscous_term() const;
+
+  void
+  enable_terms(bool const mass, bool const convective, bool const viscous) const;
+
+  // returns true if the diagonal contributions of the viscous term do not change over time
+  bool
+  viscous_term_is_cached() const;
+
+  void
+  calculate_cached_diagonal_contributions() const;
+
+  void
+  calculate_cached_block_diagonal_contributions(std::vector<LAPACKMatrix> const & matrices) const;
+
   void
   reinit_cell_derived(IntegratorCell & integrator, unsigned int const cell) const final;
 
@@ -194,6 +240,21 @@ private:
   std::shared_ptr<Operators::ViscousKernel<dim, Number>>    viscous_kernel;
 
   double scaling_factor_mass;
+
+  mutable bool mass_term_enabled;
+  mutable bool convective_term_enabled;
+  mutable bool viscous_term_enabled;
+
+  // cached diagonal contributions and the mass scaling factor they have been computed with
+  mutable bool       diagonal_contributions_cached;
+  mutable VectorType diagonal_mass;
+  mutable VectorType diagonal_viscous;
+  mutable double     scaling_factor_mass_diagonal;
+
+  mutable bool                      block_diagonal_contributions_cached;
+  mutable std::vector<LAPACKMatrix> block_diagonal_mass;
+  mutable std::vector<LAPACKMatrix> block_diagonal_viscous;
+  mutable double                    scaling_factor_mass_block_diagonal;
 };
 
 } // namespace IncNS
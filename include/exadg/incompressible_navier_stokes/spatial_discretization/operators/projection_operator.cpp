@@ -157,6 +157,29 @@ ProjectionOperator<dim, Number>::update(VectorType const & velocity, double cons
   time_step_size = dt;
 }
 
+template<int dim, typename Number>
+void
+ProjectionOperator<dim, Number>::reinit_fast_diagonalization_kernel(
+  FastDiagonalizationKernel<dim, Number> & kernel) const
+{
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> const empty;
+
+  bool const continuity_penalty_all_components =
+    operator_data.use_continuity_penalty and
+    conti_kernel->get_data().which_components == ContinuityPenaltyComponents::All;
+
+  kernel.reinit_penalty(this->get_matrix_free(),
+                        operator_data.dof_index,
+                        operator_data.quad_index,
+                        time_step_size,
+                        operator_data.use_divergence_penalty ? div_kernel->get_penalty_parameter() :
+                                                               empty,
+                        operator_data.use_continuity_penalty ?
+                          conti_kernel->get_penalty_parameter() :
+                          empty,
+                        continuity_penalty_all_components);
+}
+
 template<int dim, typename Number>
 void
 ProjectionOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrator,
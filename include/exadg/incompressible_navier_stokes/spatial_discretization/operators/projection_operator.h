@@ -128,6 +128,14 @@ public:
   update(VectorType const & velocity, double const & dt);
 
 private:
+  /*
+   * The fast diagonalization preconditioner uses one separable approximation per velocity
+   * component neglecting the coupling of the components by the divergence penalty term, see
+   * FastDiagonalizationKernel::reinit_penalty().
+   */
+  void
+  reinit_fast_diagonalization_kernel(FastDiagonalizationKernel<dim, Number> & kernel) const final;
+
   void
   reinit_cell_derived(IntegratorCell & integrator, unsigned int const cell) const final;
 
@@ -26,7 +26,7 @@ namespace ExaDG
 namespace IncNS
 {
 template<int dim, typename Number>
-RHSOperator<dim, Number>::RHSOperator() : matrix_free(nullptr), time(0.0), temperature(nullptr)
+RHSOperator<dim, Number>::RHSOperator() : matrix_free(nullptr), time(0.0)
 {
 }
 
@@ -65,7 +65,80 @@ template<int dim, typename Number>
 void
 RHSOperator<dim, Number>::set_temperature(VectorType const & T)
 {
-  this->temperature = &T;
+  set_temperature({&T}, {1.0});
+}
+
+template<int dim, typename Number>
+void
+RHSOperator<dim, Number>::set_temperature(std::vector<VectorType const *> const & temperatures_in,
+                                          std::vector<double> const &             factors)
+{
+  AssertThrow(temperatures_in.size() > 0 and temperatures_in.size() == factors.size(),
+              dealii::ExcMessage("One factor per temperature vector is required."));
+
+  this->temperatures        = temperatures_in;
+  this->factors_temperature = factors;
+}
+
+template<int dim, typename Number>
+RHSOperatorData<dim> const &
+RHSOperator<dim, Number>::get_data() const
+{
+  return data;
+}
+
+template<int dim, typename Number>
+void
+RHSOperator<dim, Number>::set_time(double const evaluation_time) const
+{
+  time = evaluation_time;
+}
+
+template<int dim, typename Number>
+void
+RHSOperator<dim, Number>::evaluate_cell(Integrator &       integrator,
+                                        IntegratorScalar & integrator_temperature,
+                                        unsigned int const cell) const
+{
+  integrator.reinit(cell);
+
+  if(data.kernel_data.boussinesq_term)
+  {
+    Assert(temperatures.size() > 0,
+           dealii::ExcMessage("The temperature has not been set for the Boussinesq term."));
+
+    integrator_temperature.reinit(cell);
+
+    if(temperatures.size() == 1 and factors_temperature[0] == 1.0)
+    {
+      integrator_temperature.read_dof_values(*temperatures[0]);
+    }
+    else
+    {
+      // linear combination of the DoF values of all vectors
+      unsigned int const dofs_per_cell = integrator_temperature.dofs_per_cell;
+
+      dealii::AlignedVector<dealii::VectorizedArray<Number>> values(
+        dofs_per_cell, dealii::make_vectorized_array<Number>(0.0));
+      for(unsigned int k = 0; k < temperatures.size(); ++k)
+      {
+        integrator_temperature.read_dof_values(*temperatures[k]);
+
+        Number const factor = static_cast<Number>(factors_temperature[k]);
+        for(unsigned int i = 0; i < dofs_per_cell; ++i)
+          values[i] += factor * integrator_temperature.begin_dof_values()[i];
+      }
+
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        integrator_temperature.begin_dof_values()[i] = values[i];
+    }
+
+    integrator_temperature.evaluate(dealii::EvaluationFlags::values);
+  }
+
+  do_cell_integral(integrator, integrator_temperature);
+
+  integrator.integrate(dealii::EvaluationFlags::values);
 }
 
 template<int dim, typename Number>
@@ -94,17 +167,9 @@ RHSOperator<dim, Number>::cell_loop(dealii::MatrixFree<dim, Number> const & matr
 
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
-    integrator.reinit(cell);
-
-    if(data.kernel_data.boussinesq_term)
-    {
-      integrator_temperature.reinit(cell);
-      integrator_temperature.gather_evaluate(*temperature, dealii::EvaluationFlags::values);
-    }
-
-    do_cell_integral(integrator, integrator_temperature);
+    evaluate_cell(integrator, integrator_temperature, cell);
 
-    integrator.integrate_scatter(dealii::EvaluationFlags::values, dst);
+    integrator.distribute_local_to_global(dst);
   }
 }
 
@@ -164,6 +164,36 @@ public:
   void
   set_temperature(VectorType const & T);
 
+  /*
+   * Sets the temperature as linear combination sum_i factors[i] * temperatures[i] of the given
+   * vectors, e.g. the extrapolation of the temperature to the new time, which is evaluated within
+   * the cell loop. This avoids that the temperature has to be computed and stored in a separate
+   * vector before the evaluation of the operator. The vectors are accessed by reference and need to
+   * remain valid.
+   */
+  void
+  set_temperature(std::vector<VectorType const *> const & temperatures,
+                  std::vector<double> const &             factors);
+
+  RHSOperatorData<dim> const &
+  get_data() const;
+
+  /*
+   * Sets the time for evaluate_cell().
+   */
+  void
+  set_time(double const evaluation_time) const;
+
+  /*
+   * Computes the cell integral of the body force for the given cell and writes it to the DoF values
+   * of the integrator, which allows to fuse the body force with other cell-local operations. The
+   * integrators are reinitialized by this function.
+   */
+  void
+  evaluate_cell(Integrator &       integrator,
+                IntegratorScalar & integrator_temperature,
+                unsigned int const cell) const;
+
 private:
   void
   do_cell_integral(Integrator & integrator, IntegratorScalar & integrator_temperature) const;
@@ -182,7 +212,8 @@ private:
 
   Operators::RHSKernel<dim, Number> kernel;
 
-  VectorType const * temperature;
+  std::vector<VectorType const *> temperatures;
+  std::vector<double>             factors_temperature;
 };
 
 } // namespace IncNS
@@ -49,6 +49,16 @@ ViscousOperator<dim, Number>::update()
   kernel->calculate_penalty_parameter(this->get_matrix_free(), operator_data.dof_index);
 }
 
+template<int dim, typename Number>
+void
+ViscousOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrator,
+                                                  unsigned int const cell) const
+{
+  (void)integrator;
+
+  kernel->reinit_cell(cell);
+}
+
 template<int dim, typename Number>
 void
 ViscousOperator<dim, Number>::reinit_face_derived(IntegratorFace &   integrator_m,
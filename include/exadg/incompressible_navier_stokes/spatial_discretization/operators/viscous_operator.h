@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_VISCOUS_OPERATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_VISCOUS_OPERATOR_H_
 
+// C/C++
+#include <functional>
+
+// ExaDG
 #include <exadg/grid/grid_data.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
@@ -45,6 +49,7 @@ struct ViscousKernelData
       penalty_term_div_formulation(PenaltyTermDivergenceFormulation::Symmetrized),
       IP_formulation(InteriorPenaltyFormulation::SIPG),
       viscosity_is_variable(false),
+      store_viscosity_in_reduced_precision(false),
       variable_normal_vector(false)
   {
   }
@@ -55,6 +60,7 @@ struct ViscousKernelData
   PenaltyTermDivergenceFormulation penalty_term_div_formulation;
   InteriorPenaltyFormulation       IP_formulation;
   bool                             viscosity_is_variable;
+  bool                             store_viscosity_in_reduced_precision;
   bool                             variable_normal_vector;
 };
 
@@ -66,11 +72,26 @@ private:
   typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
 
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
   typedef CellIntegrator<dim, dim, Number> IntegratorCell;
   typedef FaceIntegrator<dim, dim, Number> IntegratorFace;
 
 public:
-  ViscousKernel() : quad_index(0), degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  /*
+   * Adds the model viscosity, given the filter width of the cell and the velocity gradient, to the
+   * viscosity passed as first argument.
+   */
+  typedef std::function<void(scalar &, scalar const &, tensor const &)> ViscosityFunction;
+
+  ViscousKernel()
+    : quad_index(0),
+      degree(1),
+      penalty_factor(1.0),
+      tau(dealii::make_vectorized_array<Number>(0.0)),
+      filter_width(nullptr),
+      filter_width_m(dealii::make_vectorized_array<Number>(0.0)),
+      filter_width_p(dealii::make_vectorized_array<Number>(0.0))
   {
   }
 
@@ -94,7 +115,8 @@ public:
     if(data.viscosity_is_variable)
     {
       // allocate vectors for variable coefficients and initialize with constant viscosity
-      viscosity_coefficients.initialize(matrix_free, quad_index, true, false);
+      viscosity_coefficients.initialize(
+        matrix_free, quad_index, true, false, data.store_viscosity_in_reduced_precision);
       viscosity_coefficients.set_coefficients(data.viscosity);
     }
   }
@@ -104,6 +126,16 @@ public:
                               unsigned int const                      dof_index)
   {
     IP::calculate_penalty_parameter<dim, Number>(array_penalty_parameter, matrix_free, dof_index);
+
+    penalty_factor = IP::get_penalty_factor<dim, Number>(
+      degree,
+      get_element_type(matrix_free.get_dof_handler(dof_index).get_triangulation()),
+      data.IP_factor);
+
+    IP::calculate_face_penalty_parameter<dim, Number>(array_face_penalty_parameter,
+                                                      array_penalty_parameter,
+                                                      matrix_free,
+                                                      penalty_factor);
   }
 
   ViscousKernelData const &
@@ -124,6 +156,63 @@ public:
     return this->degree;
   }
 
+  /*
+   * Memory consumption of the variable viscosity field in bytes.
+   */
+  std::size_t
+  memory_consumption_viscosity_coefficients() const
+  {
+    return viscosity_coefficients.memory_consumption();
+  }
+
+  /*
+   * Evaluate the variable viscosity on the fly from the gradient of the velocity field passed to
+   * set_velocity_viscosity() instead of storing it in the quadrature points of all cells and faces.
+   * The velocity gradient is computed by the reinit functions of this class, so that this mode is
+   * not available for cell-based face loops. The coefficient tables are released.
+   */
+  void
+  enable_viscosity_on_the_fly(dealii::MatrixFree<dim, Number> const & matrix_free,
+                              unsigned int const                      dof_index,
+                              ViscosityFunction const &               add_viscosity,
+                              dealii::AlignedVector<scalar> const &   filter_width_in)
+  {
+    AssertThrow(data.viscosity_is_variable,
+                dealii::ExcMessage("The on-the-fly evaluation of the viscosity requires a "
+                                   "variable viscosity."));
+
+    add_viscosity_on_the_fly = add_viscosity;
+    filter_width             = &filter_width_in;
+
+    integrator_viscosity = std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index);
+    integrator_viscosity_m =
+      std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index);
+    integrator_viscosity_p =
+      std::make_shared<IntegratorFace>(matrix_free, false, dof_index, quad_index);
+
+    matrix_free.initialize_dof_vector(velocity_viscosity, dof_index);
+
+    viscosity_coefficients = VariableCoefficients<dealii::VectorizedArray<Number>>();
+  }
+
+  bool
+  viscosity_is_evaluated_on_the_fly() const
+  {
+    return static_cast<bool>(add_viscosity_on_the_fly);
+  }
+
+  /*
+   * Sets the velocity field from which the viscosity is evaluated on the fly. The velocity is
+   * copied, since the viscosity is treated explicitly and the time integrators overwrite this
+   * vector before the viscosity is used.
+   */
+  void
+  set_velocity_viscosity(VectorType const & velocity)
+  {
+    velocity_viscosity = velocity;
+    velocity_viscosity.update_ghost_values();
+  }
+
   void
   set_constant_coefficient(Number const & constant_coefficient)
   {
@@ -191,29 +280,66 @@ public:
     return flags;
   }
 
+  void
+  reinit_cell(unsigned int const cell) const
+  {
+    if(viscosity_is_evaluated_on_the_fly())
+    {
+      integrator_viscosity->reinit(cell);
+      integrator_viscosity->gather_evaluate(velocity_viscosity, dealii::EvaluationFlags::gradients);
+      filter_width_m = integrator_viscosity->read_cell_data(*filter_width);
+    }
+  }
+
+  /*
+   * Prepares the on-the-fly evaluation of the viscosity for boundary face loops that do not call
+   * reinit_boundary_face().
+   */
+  void
+  reinit_boundary_face_viscosity(unsigned int const face) const
+  {
+    if(viscosity_is_evaluated_on_the_fly())
+    {
+      integrator_viscosity_m->reinit(face);
+      integrator_viscosity_m->gather_evaluate(velocity_viscosity,
+                                              dealii::EvaluationFlags::gradients);
+      filter_width_m = integrator_viscosity_m->read_cell_data(*filter_width);
+    }
+  }
+
   void
   reinit_face(IntegratorFace &   integrator_m,
               IntegratorFace &   integrator_p,
               unsigned int const dof_index) const
   {
-    tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
-                   integrator_p.read_cell_data(array_penalty_parameter)) *
-          IP::get_penalty_factor<dim, Number>(
-            degree,
-            get_element_type(
-              integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-            data.IP_factor);
+    (void)dof_index;
+
+    if(viscosity_is_evaluated_on_the_fly())
+    {
+      unsigned int const face = integrator_m.get_current_cell_index();
+
+      integrator_viscosity_m->reinit(face);
+      integrator_viscosity_m->gather_evaluate(velocity_viscosity,
+                                              dealii::EvaluationFlags::gradients);
+      filter_width_m = integrator_viscosity_m->read_cell_data(*filter_width);
+
+      integrator_viscosity_p->reinit(face);
+      integrator_viscosity_p->gather_evaluate(velocity_viscosity,
+                                              dealii::EvaluationFlags::gradients);
+      filter_width_p = integrator_viscosity_p->read_cell_data(*filter_width);
+    }
+
+    tau = array_face_penalty_parameter[integrator_m.get_current_cell_index()];
   }
 
   void
   reinit_boundary_face(IntegratorFace & integrator_m, unsigned int const dof_index) const
   {
-    tau = integrator_m.read_cell_data(array_penalty_parameter) *
-          IP::get_penalty_factor<dim, Number>(
-            degree,
-            get_element_type(
-              integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-            data.IP_factor);
+    (void)dof_index;
+
+    reinit_boundary_face_viscosity(integrator_m.get_current_cell_index());
+
+    tau = array_face_penalty_parameter[integrator_m.get_current_cell_index()];
   }
 
   void
@@ -222,24 +348,21 @@ public:
                          IntegratorFace &                 integrator_p,
                          unsigned int const               dof_index) const
   {
+    (void)dof_index;
+
+    AssertThrow(not viscosity_is_evaluated_on_the_fly(),
+                dealii::ExcMessage("The on-the-fly evaluation of the viscosity is not available "
+                                   "for cell-based face loops."));
+
     if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
     {
       tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
                      integrator_p.read_cell_data(array_penalty_parameter)) *
-            IP::get_penalty_factor<dim, Number>(
-              degree,
-              get_element_type(
-                integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-              data.IP_factor);
+            penalty_factor;
     }
     else // boundary face
     {
-      tau = integrator_m.read_cell_data(array_penalty_parameter) *
-            IP::get_penalty_factor<dim, Number>(
-              degree,
-              get_element_type(
-                integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-              data.IP_factor);
+      tau = integrator_m.read_cell_data(array_penalty_parameter) * penalty_factor;
     }
   }
 
@@ -252,7 +375,11 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_evaluated_on_the_fly())
+    {
+      add_viscosity_on_the_fly(viscosity, filter_width_m, integrator_viscosity->get_gradient(q));
+    }
+    else if(data.viscosity_is_variable)
     {
       viscosity = viscosity_coefficients.get_coefficient_cell(cell, q);
     }
@@ -269,9 +396,23 @@ public:
   {
     scalar average_viscosity = dealii::make_vectorized_array<Number>(0.0);
 
-    scalar coefficient_face = viscosity_coefficients.get_coefficient_face(face, q);
-    scalar coefficient_face_neighbor =
-      viscosity_coefficients.get_coefficient_face_neighbor(face, q);
+    scalar coefficient_face, coefficient_face_neighbor;
+    if(viscosity_is_evaluated_on_the_fly())
+    {
+      coefficient_face          = dealii::make_vectorized_array<Number>(data.viscosity);
+      coefficient_face_neighbor = dealii::make_vectorized_array<Number>(data.viscosity);
+      add_viscosity_on_the_fly(coefficient_face,
+                               filter_width_m,
+                               integrator_viscosity_m->get_gradient(q));
+      add_viscosity_on_the_fly(coefficient_face_neighbor,
+                               filter_width_p,
+                               integrator_viscosity_p->get_gradient(q));
+    }
+    else
+    {
+      coefficient_face          = viscosity_coefficients.get_coefficient_face(face, q);
+      coefficient_face_neighbor = viscosity_coefficients.get_coefficient_face_neighbor(face, q);
+    }
 
     // harmonic mean (harmonic weighting according to Schott and Rasthofer et al. (2015))
     average_viscosity = 2.0 * coefficient_face * coefficient_face_neighbor /
@@ -312,7 +453,11 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_evaluated_on_the_fly())
+    {
+      add_viscosity_on_the_fly(viscosity, filter_width_m, integrator_viscosity_m->get_gradient(q));
+    }
+    else if(data.viscosity_is_variable)
     {
       viscosity = viscosity_coefficients.get_coefficient_face(face, q);
     }
@@ -540,9 +685,27 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
+  // penalty parameter of each face batch including the penalty factor
+  dealii::AlignedVector<scalar> array_face_penalty_parameter;
+
+  Number penalty_factor;
+
   mutable scalar tau;
 
   VariableCoefficients<dealii::VectorizedArray<Number>> viscosity_coefficients;
+
+  // on-the-fly evaluation of the viscosity
+  ViscosityFunction                     add_viscosity_on_the_fly;
+  dealii::AlignedVector<scalar> const * filter_width;
+
+  VectorType velocity_viscosity;
+
+  std::shared_ptr<IntegratorCell> integrator_viscosity;
+  std::shared_ptr<IntegratorFace> integrator_viscosity_m;
+  std::shared_ptr<IntegratorFace> integrator_viscosity_p;
+
+  mutable scalar filter_width_m;
+  mutable scalar filter_width_p;
 };
 
 } // namespace Operators
@@ -584,6 +747,9 @@ public:
   update();
 
 private:
+  void
+  reinit_cell_derived(IntegratorCell & integrator, unsigned int const cell) const final;
+
   void
   reinit_face_derived(IntegratorFace &   integrator_m,
                       IntegratorFace &   integrator_p,
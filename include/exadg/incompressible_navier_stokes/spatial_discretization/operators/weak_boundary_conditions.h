@@ -22,6 +22,7 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_WEAK_BOUNDARY_CONDITIONS_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_WEAK_BOUNDARY_CONDITIONS_H_
 
+#include <exadg/functions_and_boundary_conditions/boundary_function_cache.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/incompressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/incompressible_navier_stokes/user_interface/enum_types.h>
@@ -49,6 +50,8 @@ namespace IncNS
  *  | inhomogeneous operator  | u⁺ = -u⁻ + 2g , u⁻ = 0  | u⁺ = u⁻ , u⁻ = 0   | u⁺ = u⁻ - 2 (u⁻*n)n , u⁻ = 0 |
  *  +-------------------------+-------------------------+--------------------+------------------------------+
  *
+ *  Wall model boundaries are treated like symmetry boundaries.
+ *
  */
 // clang-format on
 template<int dim, typename Number>
@@ -100,10 +103,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
       if(boundary_type == BoundaryTypeU::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-        auto q_points = integrator.quadrature_point(q);
+        auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-        g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        g = evaluate_boundary_function<1, dim>(
+          boundary_descriptor->get_dirichlet_bc_cache(), *bc, integrator, q, time);
       }
       else if(boundary_type == BoundaryTypeU::DirichletCached)
       {
@@ -133,7 +136,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     value_p = value_m;
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry or boundary_type == BoundaryTypeU::WallModel)
   {
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal_m =
       integrator.get_normal_vector(q);
@@ -180,10 +183,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
     if(boundary_type == BoundaryTypeU::Dirichlet)
     {
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-      g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+      g = evaluate_boundary_function<1, dim>(
+        boundary_descriptor->get_dirichlet_bc_cache(), *bc, integrator, q, time);
     }
     else if(boundary_type == BoundaryTypeU::DirichletCached)
     {
@@ -215,7 +218,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     u_p = u_m;
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry or boundary_type == BoundaryTypeU::WallModel)
   {
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal_m =
       integrator.get_normal_vector(q);
@@ -264,7 +267,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     value_p = value_m;
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry or boundary_type == BoundaryTypeU::WallModel)
   {
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal_m =
       integrator_bc.get_normal_vector(q);
@@ -342,11 +345,10 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-      dealii::VectorizedArray<Number> g =
-        FunctionEvaluator<0, dim, Number>::value(*bc, q_points, time);
+      dealii::VectorizedArray<Number> g = evaluate_boundary_function<0, dim>(
+        boundary_descriptor->get_dirichlet_bc_cache(), *bc, integrator, q, time);
 
       value_p = -value_m + 2.0 * inverse_scaling_factor * g;
     }
@@ -441,6 +443,10 @@ inline DEAL_II_ALWAYS_INLINE //
  *  +-------------------------+---------------------------------+---------------------------------------+----------------------------------------------------+
  *  | inhomogeneous operator  | {{F(u)}}*n = 0                  | {{F(u)}}*n = h                        | {{F(u)}}*n = 0                                     |
  *  +-------------------------+---------------------------------+---------------------------------------+----------------------------------------------------+
+ *
+ *  Wall model boundaries are treated like symmetry boundaries, where the tangential wall shear
+ *  stress divided by the viscosity h = tau_w / nu (i.e., h*n = 0) is added in the same way as for
+ *  Neumann boundaries.
  */
 // clang-format on
 
@@ -468,16 +474,17 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->neumann_bc.find(boundary_id)->second;
 
       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> h;
       if(variable_normal_vector == false)
       {
-        h = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        h = evaluate_boundary_function<1, dim>(
+          boundary_descriptor->get_neumann_bc_cache(), *bc, integrator, q, time);
       }
       else
       {
+        auto q_points  = integrator.quadrature_point(q);
         auto normals_m = integrator.get_normal_vector(q);
         h              = FunctionEvaluator<1, dim, Number>::value(
           *(std::dynamic_pointer_cast<FunctionWithNormal<dim>>(bc)), q_points, normals_m, time);
@@ -499,6 +506,22 @@ inline DEAL_II_ALWAYS_INLINE //
     auto normal_m     = integrator.get_normal_vector(q);
     normal_gradient_p = -normal_gradient_m + 2.0 * (normal_gradient_m * normal_m) * normal_m;
   }
+  else if(boundary_type == BoundaryTypeU::WallModel)
+  {
+    auto normal_m     = integrator.get_normal_vector(q);
+    normal_gradient_p = -normal_gradient_m + 2.0 * (normal_gradient_m * normal_m) * normal_m;
+
+    if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
+    {
+      // wall shear stress divided by the viscosity, which is tangential to the wall
+      auto h = FunctionEvaluator<1, dim, Number>::value(*boundary_descriptor->get_wall_model_data(),
+                                                        integrator.get_current_cell_index(),
+                                                        q,
+                                                        integrator.get_quadrature_index());
+
+      normal_gradient_p += 2.0 * h;
+    }
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("Boundary type of face is invalid or not implemented."));
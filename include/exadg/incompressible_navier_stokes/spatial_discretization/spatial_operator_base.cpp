@@ -30,6 +30,7 @@
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/fast_diagonalization_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 #include <exadg/utilities/exceptions.h>
@@ -389,6 +390,85 @@ SpatialOperatorBase<dim, Number>::initialize_dirichlet_cached_bc()
   }
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::initialize_wall_model()
+{
+  if(not(boundary_descriptor->velocity->wall_model_bc.empty()))
+  {
+    AssertThrow(param.spatial_discretization == SpatialDiscretization::L2,
+                dealii::ExcMessage("The wall model is only implemented for L2-conforming spaces."));
+
+    // the exchange locations are searched only once
+    AssertThrow(param.ale_formulation == false,
+                dealii::ExcMessage("The wall model is not implemented for moving meshes."));
+
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index_velocity_standard());
+    quad_indices.emplace_back(get_quad_index_velocity_overintegration());
+    quad_indices.emplace_back(get_quad_index_velocity_gauss_lobatto());
+
+    interface_data_wall_model = std::make_shared<ContainerInterfaceData<1, dim, double>>();
+    wall_model.setup(interface_data_wall_model,
+                     *matrix_free,
+                     get_dof_index_velocity(),
+                     quad_indices,
+                     boundary_descriptor->velocity->wall_model_bc,
+                     *get_mapping(),
+                     param.viscosity);
+
+    boundary_descriptor->velocity->set_wall_model_data(interface_data_wall_model);
+  }
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::initialize_boundary_function_cache()
+{
+  // The tables refer to the face batches of the MatrixFree object of this class and are only used
+  // by integrators in double precision, see evaluate_boundary_function().
+  if constexpr(std::is_same_v<Number, double>)
+  {
+    if(param.cache_boundary_functions)
+    {
+      std::vector<unsigned int> quad_indices;
+      quad_indices.emplace_back(get_quad_index_velocity_standard());
+      quad_indices.emplace_back(get_quad_index_pressure());
+      quad_indices.emplace_back(get_quad_index_velocity_overintegration());
+      quad_indices.emplace_back(get_quad_index_velocity_gauss_lobatto());
+      quad_indices.emplace_back(get_quad_index_pressure_gauss_lobatto());
+
+      dirichlet_bc_cache_velocity = std::make_shared<BoundaryFunctionCache<1, dim, double>>();
+      dirichlet_bc_cache_velocity->setup(*matrix_free,
+                                         get_dof_index_velocity(),
+                                         quad_indices,
+                                         boundary_descriptor->velocity->dirichlet_bc);
+
+      // Neumann data depending on the normal vector is evaluated directly
+      typename BoundaryFunctionCache<1, dim, double>::FunctionMap neumann_bc;
+      for(auto const & [boundary_id, function] : boundary_descriptor->velocity->neumann_bc)
+        if(std::dynamic_pointer_cast<FunctionWithNormal<dim>>(function) == nullptr)
+          neumann_bc.emplace(boundary_id, function);
+
+      neumann_bc_cache_velocity = std::make_shared<BoundaryFunctionCache<1, dim, double>>();
+      neumann_bc_cache_velocity->setup(*matrix_free,
+                                       get_dof_index_velocity(),
+                                       quad_indices,
+                                       neumann_bc);
+
+      dirichlet_bc_cache_pressure = std::make_shared<BoundaryFunctionCache<0, dim, double>>();
+      dirichlet_bc_cache_pressure->setup(*matrix_free,
+                                         get_dof_index_velocity(),
+                                         quad_indices,
+                                         boundary_descriptor->pressure->dirichlet_bc);
+
+      boundary_descriptor->velocity->set_function_cache(dirichlet_bc_cache_velocity,
+                                                        neumann_bc_cache_velocity);
+      boundary_descriptor->pressure->set_function_cache(dirichlet_bc_cache_pressure);
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_index_temperature)
@@ -482,6 +562,13 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   convective_operator_data.use_cell_based_loops = param.use_cell_based_face_loops;
   convective_operator_data.quad_index_nonlinear = get_quad_index_velocity_overintegration();
   convective_operator_data.bc                   = boundary_descriptor->velocity;
+
+  convective_operator_data.adaptive_overintegration      = param.adaptive_overintegration;
+  convective_operator_data.quad_index_nonlinear_standard = get_quad_index_velocity_standard();
+  convective_operator_data.adaptive_overintegration_threshold =
+    param.adaptive_overintegration_threshold;
+  convective_operator_data.viscosity = param.viscosity;
+
   convective_operator.initialize(*matrix_free,
                                  constraint_dummy,
                                  convective_operator_data,
@@ -494,6 +581,8 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   viscous_kernel_data.penalty_term_div_formulation = param.penalty_term_div_formulation;
   viscous_kernel_data.IP_formulation               = param.IP_formulation_viscous;
   viscous_kernel_data.viscosity_is_variable        = param.viscosity_is_variable();
+  viscous_kernel_data.store_viscosity_in_reduced_precision =
+    param.store_variable_viscosity_in_reduced_precision;
   viscous_kernel_data.variable_normal_vector       = param.neumann_with_variable_normal_vector;
   viscous_kernel = std::make_shared<Operators::ViscousKernel<dim, Number>>();
   viscous_kernel->reinit(*matrix_free,
@@ -563,6 +652,8 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   data.preconditioner_block_diagonal = Elementwise::Preconditioner::InverseMassMatrix;
   data.solver_data_block_diagonal    = param.solver_data_block_diagonal;
 
+  data.cache_diagonal_contributions = param.cache_diagonal_contributions_momentum;
+
   momentum_operator.initialize(
     *matrix_free, constraint_dummy, data, viscous_kernel, convective_kernel);
 
@@ -670,6 +761,11 @@ SpatialOperatorBase<dim, Number>::initialize_calculators_for_derived_quantities(
                                     get_dof_index_velocity_scalar(),
                                     get_quad_index_velocity_standard(),
                                     false /*compressible_flow*/);
+  derived_quantities_calculator.initialize(*matrix_free,
+                                           get_dof_index_velocity(),
+                                           get_dof_index_velocity_scalar(),
+                                           get_quad_index_velocity_standard(),
+                                           false /*compressible_flow*/);
 }
 
 template<int dim, typename Number>
@@ -684,6 +780,8 @@ SpatialOperatorBase<dim, Number>::setup()
 
   fill_matrix_free_data(*mf_data);
 
+  param.parallelization.fill_additional_data(mf_data->data, mpi_comm);
+
   if(param.use_cell_based_face_loops)
     Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
   mf->reinit(*get_mapping(),
@@ -692,6 +790,8 @@ SpatialOperatorBase<dim, Number>::setup()
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
+  memory_matrix_free.set(mf->memory_consumption());
+
   if(param.ale_formulation)
     matrix_free_own_storage = mf;
 
@@ -719,8 +819,19 @@ SpatialOperatorBase<dim, Number>::setup(
 
   initialize_dirichlet_cached_bc();
 
+  initialize_wall_model();
+
+  initialize_boundary_function_cache();
+
   initialize_operators(dof_index_temperature);
 
+  if(param.viscous_problem() and param.viscosity_is_variable())
+  {
+    std::size_t const memory = dealii::Utilities::MPI::sum(
+      viscous_kernel->memory_consumption_viscosity_coefficients(), mpi_comm);
+    print_parameter(pcout, "Memory variable viscosity [MB]", (double)memory / 1.e6);
+  }
+
   initialize_calculators_for_derived_quantities();
 
   // Finally, do set up of derived classes
@@ -893,7 +1004,7 @@ SpatialOperatorBase<dim, Number>::get_viscosity_boundary_face(unsigned int const
 {
   if(param.viscosity_is_variable())
   {
-    return viscous_kernel->get_coefficient_face(face, q);
+    return viscous_kernel->get_viscosity_boundary_face(face, q);
   }
   else
   {
@@ -1080,7 +1191,8 @@ SpatialOperatorBase<dim, Number>::calculate_time_step_cfl_global() const
 
 template<int dim, typename Number>
 double
-SpatialOperatorBase<dim, Number>::calculate_time_step_cfl(VectorType const & velocity) const
+SpatialOperatorBase<dim, Number>::calculate_time_step_cfl(VectorType const & velocity,
+                                                          bool const reduce_over_processes) const
 {
   // Need to update ghost values in the case of continuity constraints.
   if(param.spatial_discretization == SpatialDiscretization::HDIV)
@@ -1093,7 +1205,8 @@ SpatialOperatorBase<dim, Number>::calculate_time_step_cfl(VectorType const & vel
                                                     param.degree_u,
                                                     param.cfl_exponent_fe_degree_velocity,
                                                     param.adaptive_time_stepping_cfl_type,
-                                                    mpi_comm);
+                                                    reduce_over_processes ? mpi_comm :
+                                                                            MPI_COMM_SELF);
 }
 
 template<int dim, typename Number>
@@ -1220,6 +1333,17 @@ SpatialOperatorBase<dim, Number>::set_temperature(VectorType const & temperature
   rhs_operator.set_temperature(temperature);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::set_temperature(
+  std::vector<VectorType const *> const & temperatures,
+  std::vector<double> const &             factors)
+{
+  AssertThrow(param.boussinesq_term, dealii::ExcMessage("Invalid parameters detected."));
+
+  rhs_operator.set_temperature(temperatures, factors);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::compute_vorticity(VectorType & dst, VectorType const & src) const
@@ -1315,6 +1439,9 @@ SpatialOperatorBase<dim, Number>::compute_streamfunction(VectorType &       dst,
   AssertThrow(boundary_descriptor->velocity->symmetry_bc.empty() == true,
               dealii::ExcMessage("Assumption is not fulfilled. Streamfunction calculator is "
                                  "not implemented for this type of boundary conditions."));
+  AssertThrow(boundary_descriptor->velocity->wall_model_bc.empty() == true,
+              dealii::ExcMessage("Assumption is not fulfilled. Streamfunction calculator is "
+                                 "not implemented for this type of boundary conditions."));
 
   laplace_operator_data.bc = boundary_descriptor_streamfunction;
 
@@ -1371,6 +1498,24 @@ SpatialOperatorBase<dim, Number>::compute_q_criterion(VectorType &       dst,
   inverse_mass_velocity_scalar.apply(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::compute_derived_fields(DerivedFields const & dst,
+                                                         VectorType const &    src) const
+{
+  derived_quantities_calculator.compute(dst, src);
+
+  if(dst.vorticity != nullptr)
+    this->apply_inverse_mass_operator(*dst.vorticity, *dst.vorticity);
+
+  for(VectorType * field :
+      {dst.divergence, dst.shear_rate, dst.velocity_magnitude, dst.q_criterion})
+  {
+    if(field != nullptr)
+      inverse_mass_velocity_scalar.apply(*field, *field);
+  }
+}
+
 template<int dim, typename Number>
 unsigned int
 SpatialOperatorBase<dim, Number>::apply_inverse_mass_operator(VectorType &       dst,
@@ -1399,6 +1544,29 @@ SpatialOperatorBase<dim, Number>::evaluate_add_body_force_term(VectorType & dst,
   this->rhs_operator.evaluate_add(dst, time);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::evaluate_momentum_terms(VectorType &       dst,
+                                                          VectorType const & src,
+                                                          double const       time) const
+{
+  dst = 0.0;
+
+  if(param.convective_problem())
+    convective_operator.evaluate_nonlinear_operator_add(dst, src, time);
+
+  if(param.viscous_problem())
+  {
+    viscous_operator.set_time(time);
+    viscous_operator.evaluate_add(dst, src);
+  }
+
+  dst *= -1.0;
+
+  if(param.right_hand_side)
+    evaluate_add_body_force_term(dst, time);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::evaluate_convective_term(VectorType &       dst,
@@ -1426,6 +1594,14 @@ SpatialOperatorBase<dim, Number>::evaluate_velocity_divergence_term(VectorType &
   divergence_operator.evaluate(dst, src, time);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::update_wall_model(VectorType const & velocity) const
+{
+  if(not(boundary_descriptor->velocity->wall_model_bc.empty()))
+    wall_model.update(velocity);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::update_viscosity(VectorType const & velocity) const
@@ -1524,6 +1700,197 @@ SpatialOperatorBase<dim, Number>::calculate_dissipation_continuity_term(
   }
 }
 
+template<int dim, typename Number>
+std::array<double, 4>
+SpatialOperatorBase<dim, Number>::calculate_dissipation_terms(VectorType const & velocity,
+                                                              double const       time) const
+{
+  // locally owned contributions of the convective, viscous, divergence penalty, and continuity
+  // penalty terms
+  std::array<double, 4> dissipation = {{0.0, 0.0, 0.0, 0.0}};
+
+  if(param.convective_problem() or param.viscous_problem())
+  {
+    VectorType dst;
+    dst.reinit(velocity, false);
+
+    auto const local_dot = [&]() {
+      double sum = 0.0;
+      for(unsigned int i = 0; i < velocity.locally_owned_size(); ++i)
+        sum += velocity.local_element(i) * dst.local_element(i);
+      return sum;
+    };
+
+    if(param.convective_problem())
+    {
+      convective_operator.evaluate_nonlinear_operator(dst, velocity, time);
+      dissipation[0] = local_dot();
+    }
+
+    if(param.viscous_problem())
+    {
+      viscous_operator.apply(dst, velocity);
+      dissipation[1] = local_dot();
+    }
+  }
+
+  if(param.use_divergence_penalty or param.use_continuity_penalty)
+  {
+    std::vector<Number> dst(2, 0.0);
+    matrix_free->loop(&This::cell_loop_dissipation_penalty,
+                      &This::face_loop_dissipation_penalty,
+                      &This::boundary_face_loop_dissipation_penalty,
+                      this,
+                      dst,
+                      velocity,
+                      false /*zero_dst_vector*/,
+                      dealii::MatrixFree<dim, Number>::DataAccessOnFaces::values,
+                      dealii::MatrixFree<dim, Number>::DataAccessOnFaces::values);
+
+    dissipation[2] = dst[0];
+    dissipation[3] = dst[1];
+  }
+
+  dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(dissipation.data(), 4),
+                              mpi_comm,
+                              dealii::ArrayView<double>(dissipation.data(), 4));
+
+  return dissipation;
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::cell_loop_dissipation_penalty(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<Number> &                   dst,
+  VectorType const &                      src,
+  Range const &                           cell_range) const
+{
+  if(not param.use_divergence_penalty)
+    return;
+
+  CellIntegratorU integrator(matrix_free,
+                             get_dof_index_velocity(),
+                             get_quad_index_velocity_standard());
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.gather_evaluate(src, dealii::EvaluationFlags::gradients);
+
+    div_penalty_kernel->reinit_cell(integrator);
+
+    scalar dissipation = dealii::make_vectorized_array<Number>(0.0);
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      dissipation += div_penalty_kernel->get_volume_flux(integrator, q) *
+                     integrator.get_divergence(q) * integrator.JxW(q);
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      dst[0] += dissipation[v];
+  }
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::face_loop_dissipation_penalty(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<Number> &                   dst,
+  VectorType const &                      src,
+  Range const &                           face_range) const
+{
+  if(not param.use_continuity_penalty)
+    return;
+
+  FaceIntegratorU integrator_m(matrix_free,
+                               true,
+                               get_dof_index_velocity(),
+                               get_quad_index_velocity_standard());
+  FaceIntegratorU integrator_p(matrix_free,
+                               false,
+                               get_dof_index_velocity(),
+                               get_quad_index_velocity_standard());
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_p.reinit(face);
+
+    integrator_m.gather_evaluate(src, dealii::EvaluationFlags::values);
+    integrator_p.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+    conti_penalty_kernel->reinit_face(integrator_m, integrator_p);
+
+    // the flux is tested with v^- and -v^+, i.e., with the jump (u^- - u^+)
+    scalar dissipation = dealii::make_vectorized_array<Number>(0.0);
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      vector const u_m = integrator_m.get_value(q);
+      vector const u_p = integrator_p.get_value(q);
+
+      vector const flux =
+        conti_penalty_kernel->calculate_flux(u_m, u_p, integrator_m.get_normal_vector(q));
+
+      dissipation += flux * (u_m - u_p) * integrator_m.JxW(q);
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+      dst[1] += dissipation[v];
+  }
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::boundary_face_loop_dissipation_penalty(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<Number> &                   dst,
+  VectorType const &                      src,
+  Range const &                           face_range) const
+{
+  if(not(param.use_continuity_penalty and param.continuity_penalty_use_boundary_data))
+    return;
+
+  FaceIntegratorU integrator_m(matrix_free,
+                               true,
+                               get_dof_index_velocity(),
+                               get_quad_index_velocity_standard());
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+    conti_penalty_kernel->reinit_boundary_face(integrator_m);
+
+    dealii::types::boundary_id const boundary_id   = matrix_free.get_boundary_id(face);
+    BoundaryTypeU const              boundary_type =
+      boundary_descriptor->velocity->get_boundary_type(boundary_id);
+
+    scalar dissipation = dealii::make_vectorized_array<Number>(0.0);
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      vector const u_m = calculate_interior_value(q, integrator_m, OperatorType::homogeneous);
+      vector const u_p = calculate_exterior_value(u_m,
+                                                  q,
+                                                  integrator_m,
+                                                  OperatorType::homogeneous,
+                                                  boundary_type,
+                                                  boundary_id,
+                                                  boundary_descriptor->velocity,
+                                                  0.0 /* time, not used */);
+
+      vector const flux =
+        conti_penalty_kernel->calculate_flux(u_m, u_p, integrator_m.get_normal_vector(q));
+
+      dissipation += flux * u_m * integrator_m.JxW(q);
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+      dst[1] += dissipation[v];
+  }
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::update_after_grid_motion(bool const update_matrix_free)
@@ -1604,6 +1971,17 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
                                  *projection_operator,
                                  false);
     }
+    else if(param.preconditioner_projection == PreconditionerProjection::FastDiagonalization)
+    {
+      typedef Elementwise::FastDiagonalizationPreconditioner<dim, dim, Number, ProjOperator> FDM;
+
+      elementwise_preconditioner_projection =
+        std::make_shared<FDM>(projection_operator->get_matrix_free(),
+                              projection_operator->get_dof_index(),
+                              projection_operator->get_quad_index(),
+                              *projection_operator,
+                              false);
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("The specified preconditioner is not implemented."));
@@ -1671,6 +2049,14 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
       preconditioner_projection =
         std::make_shared<BlockJacobiPreconditioner<ProjOperator>>(*projection_operator, false);
     }
+    else if(param.preconditioner_projection == PreconditionerProjection::FastDiagonalization)
+    {
+      // As for the block Jacobi preconditioner, 'update_preconditioner = true' should be used
+      // since the penalty parameters and the time step size are not known at this point.
+      preconditioner_projection =
+        std::make_shared<FastDiagonalizationPreconditioner<ProjOperator>>(*projection_operator,
+                                                                          false);
+    }
     else if(param.preconditioner_projection == PreconditionerProjection::Multigrid)
     {
       typedef MultigridPreconditionerProjection<dim, Number> Multigrid;
@@ -1772,7 +2158,10 @@ template<int dim, typename Number>
 bool
 SpatialOperatorBase<dim, Number>::unsteady_problem_has_to_be_solved() const
 {
-  return (this->param.solver_type == SolverType::Unsteady);
+  // pseudo-time stepping for steady problems needs the mass operator as well
+  return (this->param.solver_type == SolverType::Unsteady or
+          (this->param.solver_type == SolverType::Steady and
+           this->param.pseudo_time_stepping_steady));
 }
 
 template<int dim, typename Number>
@@ -1803,6 +2192,8 @@ SpatialOperatorBase<dim, Number>::solve_projection(VectorType &       dst,
                                                    VectorType const & src,
                                                    bool const &       update_preconditioner) const
 {
+  projection_solver_setup.ensure_setup();
+
   Assert(projection_solver.get() != 0,
          dealii::ExcMessage("Projection solver has not been initialized."));
 
@@ -1813,6 +2204,14 @@ SpatialOperatorBase<dim, Number>::solve_projection(VectorType &       dst,
   return n_iter;
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::print_deferred_setups(
+  dealii::ConditionalOStream const & pcout) const
+{
+  projection_solver_setup.print(pcout);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::local_interpolate_stress_bc_boundary_face(
@@ -1844,6 +2243,9 @@ SpatialOperatorBase<dim, Number>::local_interpolate_stress_bc_boundary_face(
       integrator_p.reinit(face);
       integrator_p.gather_evaluate(*pressure_ptr, dealii::EvaluationFlags::values);
 
+      if(param.viscosity_is_variable())
+        viscous_kernel->reinit_boundary_face_viscosity(face);
+
       for(unsigned int q = 0; q < integrator_u.n_q_points; ++q)
       {
         unsigned int const local_face_number = matrix_free.get_face_info(face).interior_face_no;
@@ -1874,7 +2276,8 @@ SpatialOperatorBase<dim, Number>::local_interpolate_stress_bc_boundary_face(
     {
       AssertThrow(boundary_type == BoundaryTypeU::Dirichlet or
                     boundary_type == BoundaryTypeU::Neumann or
-                    boundary_type == BoundaryTypeU::Symmetry,
+                    boundary_type == BoundaryTypeU::Symmetry or
+                    boundary_type == BoundaryTypeU::WallModel,
                   dealii::ExcMessage("BoundaryTypeU not implemented."));
     }
   }
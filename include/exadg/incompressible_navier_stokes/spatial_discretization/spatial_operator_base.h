@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATOR_BASE_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATOR_BASE_H_
 
+// C/C++
+#include <array>
+
 // deal.II
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_raviart_thomas.h>
@@ -44,6 +47,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/viscous_operator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/turbulence_model.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/viscosity_model_base.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/wall_model.h>
 #include <exadg/incompressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/incompressible_navier_stokes/user_interface/field_functions.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
@@ -55,6 +59,8 @@
 #include <exadg/poisson/spatial_discretization/laplace_operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/utilities/lazy_setup.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -78,6 +84,7 @@ protected:
 
   typedef std::pair<unsigned int, unsigned int> Range;
 
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
   typedef FaceIntegrator<dim, dim, Number> FaceIntegratorU;
   typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorP;
 
@@ -267,9 +274,11 @@ public:
   double
   calculate_time_step_cfl_global() const;
 
-  // Calculate time step size according to local CFL criterion
+  // Calculate time step size according to local CFL criterion. If reduce_over_processes is
+  // false, the minimum over the locally owned cells of the current process is returned.
   double
-  calculate_time_step_cfl(VectorType const & velocity) const;
+  calculate_time_step_cfl(VectorType const & velocity,
+                          bool const         reduce_over_processes = true) const;
 
   // Calculate CFL numbers of cells
   void
@@ -305,6 +314,11 @@ public:
   void
   set_temperature(VectorType const & temperature);
 
+  // the temperature is the linear combination of the given vectors, see RHSOperator
+  void
+  set_temperature(std::vector<VectorType const *> const & temperatures,
+                  std::vector<double> const &             factors);
+
   /*
    * Computation of derived quantities which is needed for postprocessing but some of them are also
    * needed, e.g., for special splitting-type time integration schemes.
@@ -338,6 +352,13 @@ public:
   void
   compute_q_criterion(VectorType & dst, VectorType const & src) const;
 
+  // vorticity, divergence, shear rate, velocity magnitude, and Q criterion computed in a single
+  // cell loop, fields with a nullptr in dst are skipped
+  typedef typename DerivedQuantitiesCalculator<dim, Number>::Fields DerivedFields;
+
+  void
+  compute_derived_fields(DerivedFields const & dst, VectorType const & src) const;
+
   /*
    * Operators.
    */
@@ -369,6 +390,11 @@ public:
                                     VectorType const & src,
                                     double const       time) const;
 
+  // momentum terms except for the pressure gradient, dst = f - C(u) - V(u), which are the terms of
+  // the momentum equation in the space of (weakly) divergence-free velocities
+  void
+  evaluate_momentum_terms(VectorType & dst, VectorType const & src, double const time) const;
+
   // inverse velocity mass operator
   unsigned int
   apply_inverse_mass_operator(VectorType & dst, VectorType const & src) const;
@@ -379,6 +405,13 @@ public:
   void
   update_viscosity(VectorType const & velocity) const;
 
+  /*
+   * Update the wall shear stress of the wall model boundaries, see BoundaryTypeU::WallModel. This
+   * function does nothing if there are no wall model boundaries.
+   */
+  void
+  update_wall_model(VectorType const & velocity) const;
+
   /*
    * Projection step.
    */
@@ -393,6 +426,13 @@ public:
                    VectorType const & src,
                    bool const &       update_preconditioner) const;
 
+  /*
+   * Prints which of the solvers and preconditioners with deferred setup, see LazySetup, have been
+   * built during the simulation and the wall time of their setup.
+   */
+  virtual void
+  print_deferred_setups(dealii::ConditionalOStream const & pcout) const;
+
   /*
    * Postprocessing.
    */
@@ -408,6 +448,15 @@ public:
   double
   calculate_dissipation_continuity_term(VectorType const & velocity) const;
 
+  /*
+   * Calculates all of the above terms, returned in the order convective, viscous, divergence
+   * penalty, and continuity penalty term. The penalty terms are integrated directly in one cell
+   * and face loop without assembling a residual vector, and the contributions of all terms are
+   * summed over all MPI processes in a single reduction.
+   */
+  std::array<double, 4>
+  calculate_dissipation_terms(VectorType const & velocity, double const time) const;
+
   /*
    * Updates operators after grid has been moved.
    */
@@ -525,6 +574,9 @@ private:
   // matrix_free_own_storage. This variable is needed for ALE formulations.
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free_own_storage;
 
+  // memory of the MatrixFree object created in setup(), see MemoryReport
+  MemoryReport::Entry memory_matrix_free{MemoryCategory::MatrixFree};
+
   bool pressure_level_is_undefined;
 
   /*
@@ -532,6 +584,20 @@ private:
    */
   std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_dirichlet_cached;
 
+  /*
+   * Wall model
+   */
+  std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_wall_model;
+
+  mutable WallModel<dim, Number> wall_model;
+
+  /*
+   * Tabulated boundary functions
+   */
+  std::shared_ptr<BoundaryFunctionCache<1, dim, double>> dirichlet_bc_cache_velocity;
+  std::shared_ptr<BoundaryFunctionCache<1, dim, double>> neumann_bc_cache_velocity;
+  std::shared_ptr<BoundaryFunctionCache<0, dim, double>> dirichlet_bc_cache_pressure;
+
 protected:
   /*
    * Operator kernels.
@@ -597,6 +663,10 @@ protected:
   std::shared_ptr<Krylov::SolverBase<VectorType>> projection_solver;
   std::shared_ptr<PreconditionerBase<Number>>     preconditioner_projection;
 
+  // The projection solver is set up by setup_projection_solver() at its first use in
+  // solve_projection(), provided that derived classes register the setup.
+  LazySetup projection_solver_setup;
+
   /*
    * Calculators used to obtain derived quantities.
    */
@@ -606,6 +676,8 @@ protected:
   MagnitudeCalculator<dim, Number>  magnitude_calculator;
   QCriterionCalculator<dim, Number> q_criterion_calculator;
 
+  DerivedQuantitiesCalculator<dim, Number> derived_quantities_calculator;
+
   MPI_Comm const mpi_comm;
 
   dealii::ConditionalOStream pcout;
@@ -627,6 +699,12 @@ private:
   void
   initialize_dirichlet_cached_bc();
 
+  void
+  initialize_wall_model();
+
+  void
+  initialize_boundary_function_cache();
+
   void
   initialize_operators(std::string const & dof_index_temperature);
 
@@ -652,6 +730,28 @@ private:
   {
   }
 
+  /*
+   * Dissipation of the divergence penalty (dst[0]) and continuity penalty (dst[1]) terms, i.e.,
+   * u^T A u with A the homogeneous penalty operator, locally owned contributions only.
+   */
+  void
+  cell_loop_dissipation_penalty(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                std::vector<Number> &                   dst,
+                                VectorType const &                      src,
+                                Range const &                           cell_range) const;
+
+  void
+  face_loop_dissipation_penalty(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                std::vector<Number> &                   dst,
+                                VectorType const &                      src,
+                                Range const &                           face_range) const;
+
+  void
+  boundary_face_loop_dissipation_penalty(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                         std::vector<Number> &                   dst,
+                                         VectorType const &                      src,
+                                         Range const & face_range) const;
+
   void
   local_interpolate_stress_bc_boundary_face(dealii::MatrixFree<dim, Number> const & matrix_free,
                                             VectorType &                            dst,
@@ -52,6 +52,20 @@ TurbulenceModel<dim, Number>::initialize(
   turbulence_model_data.check();
 
   calculate_filter_width(mapping_in);
+
+  if(turbulence_model_data.compute_viscosity_on_the_fly)
+  {
+    this->viscous_kernel->enable_viscosity_on_the_fly(
+      matrix_free_in,
+      dof_index_velocity_in,
+      [this](scalar & viscosity, scalar const & filter_width, tensor const & velocity_gradient) {
+        add_turbulent_viscosity(viscosity,
+                                filter_width,
+                                velocity_gradient,
+                                turbulence_model_data.constant);
+      },
+      filter_width_vector);
+  }
 }
 
 template<int dim, typename Number>
@@ -67,6 +81,13 @@ template<int dim, typename Number>
 void
 TurbulenceModel<dim, Number>::add_viscosity(VectorType const & velocity) const
 {
+  // the viscosity is computed from the velocity gradient inside the viscous kernel
+  if(this->viscous_kernel->viscosity_is_evaluated_on_the_fly())
+  {
+    this->viscous_kernel->set_velocity_viscosity(velocity);
+    return;
+  }
+
   VectorType dummy;
 
   this->matrix_free->loop(&This::cell_loop_set_coefficients,
@@ -318,7 +339,7 @@ TurbulenceModel<dim, Number>::smagorinsky_model(scalar const & filter_width,
     dealii::make_vectorized_array<Number>(0.5) * (velocity_gradient + transpose(velocity_gradient));
 
   scalar rate_of_strain = 2.0 * scalar_product(symmetric_gradient, symmetric_gradient);
-  rate_of_strain        = std::exp(0.5 * std::log(rate_of_strain));
+  rate_of_strain        = std::sqrt(rate_of_strain);
 
   scalar factor = C * filter_width;
 
@@ -347,18 +368,20 @@ TurbulenceModel<dim, Number>::vreman_model(scalar const & filter_width,
 
   scalar factor = C * filter_width;
 
-  for(unsigned int i = 0; i < dealii::VectorizedArray<Number>::size(); i++)
-  {
-    // If the norm of the velocity gradient tensor is zero, the subgrid-scale
-    // viscosity is defined as zero, so we do nothing in that case.
-    // Make sure that B_gamma[i] is larger than zero since we calculate
-    // the square root of B_gamma[i].
-    if(velocity_gradient_norm_square[i] > tolerance and B_gamma[i] > tolerance)
-    {
-      viscosity[i] += factor[i] * factor[i] *
-                      std::exp(0.5 * std::log(B_gamma[i] / velocity_gradient_norm_square[i]));
-    }
-  }
+  // If the norm of the velocity gradient tensor is zero, the subgrid-scale
+  // viscosity is defined as zero, so we do nothing in that case.
+  // Make sure that B_gamma is larger than zero since we calculate
+  // the square root of B_gamma. The masks are applied to all lanes at once.
+  scalar const tolerance_vectorized = dealii::make_vectorized_array<Number>(tolerance);
+  scalar const zero                 = dealii::make_vectorized_array<Number>(0.0);
+
+  scalar ratio = B_gamma / std::max(velocity_gradient_norm_square, tolerance_vectorized);
+  ratio        = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+    velocity_gradient_norm_square, tolerance_vectorized, ratio, zero);
+  ratio = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+    B_gamma, tolerance_vectorized, ratio, zero);
+
+  viscosity += factor * factor * std::sqrt(ratio);
 }
 
 template<int dim, typename Number>
@@ -387,17 +410,18 @@ TurbulenceModel<dim, Number>::wale_model(scalar const & filter_width,
 
   scalar S_d_norm_square = scalar_product(S_d, S_d);
 
-  scalar D = dealii::make_vectorized_array<Number>(0.0);
+  // D = (S_d:S_d)^(3/2) / ((S:S)^(5/2) + (S_d:S_d)^(5/4)), where the powers are expressed by
+  // vectorized square roots, and D is zero for S_d:S_d below the tolerance
+  scalar const tolerance = dealii::make_vectorized_array<Number>(1.e-12);
 
-  for(unsigned int i = 0; i < dealii::VectorizedArray<Number>::size(); i++)
-  {
-    Number const tolerance = 1.e-12;
-    if(S_d_norm_square[i] > tolerance)
-    {
-      D[i] = std::pow(S_d_norm_square[i], 1.5) /
-             (std::pow(S_norm_square[i], 2.5) + std::pow(S_d_norm_square[i], 1.25));
-    }
-  }
+  scalar const S_d_norm_square_bounded = std::max(S_d_norm_square, tolerance);
+  scalar const sqrt_S_d                = std::sqrt(S_d_norm_square_bounded);
+  scalar const sqrt_S                  = std::sqrt(S_norm_square);
+
+  scalar D = S_d_norm_square_bounded * sqrt_S_d /
+             (S_norm_square * S_norm_square * sqrt_S + sqrt_S_d * std::sqrt(sqrt_S_d));
+  D = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+    S_d_norm_square, tolerance, D, dealii::make_vectorized_array<Number>(0.0));
 
   scalar factor = C * filter_width;
 
@@ -0,0 +1,192 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cmath>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/wall_model.h>
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim, typename Number>
+WallModel<dim, Number>::WallModel() : viscosity(0.0)
+{
+}
+
+template<int dim, typename Number>
+void
+WallModel<dim, Number>::setup(
+  std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_in,
+  dealii::MatrixFree<dim, Number> const &                 matrix_free,
+  unsigned int const                                      dof_index,
+  std::vector<unsigned int> const &                       quad_indices,
+  std::map<dealii::types::boundary_id, double> const &    exchange_distances,
+  dealii::Mapping<dim> const &                            mapping,
+  double const                                            viscosity_in)
+{
+  interface_data = interface_data_in;
+  viscosity      = viscosity_in;
+
+  std::set<dealii::types::boundary_id> boundary_ids;
+  for(auto const & [boundary_id, distance] : exchange_distances)
+  {
+    AssertThrow(distance > 0.0,
+                dealii::ExcMessage("The exchange distance of the wall model has to be positive."));
+    boundary_ids.insert(boundary_id);
+  }
+
+  interface_data->setup(matrix_free, dof_index, quad_indices, boundary_ids);
+
+  // Move the points into the domain. The points are stored in the same order as they are created
+  // in ContainerInterfaceData::setup(), i.e., face by face, point by point, and lane by lane.
+  for(auto const quad_index : quad_indices)
+  {
+    std::vector<dealii::Point<dim>> & points = interface_data->get_array_q_points(quad_index);
+
+    std::vector<dealii::Tensor<1, dim>> & normals_q   = normals[quad_index];
+    std::vector<double> &                 distances_q = distances[quad_index];
+    normals_q.resize(points.size());
+    distances_q.resize(points.size());
+
+    unsigned int index = 0;
+    for(unsigned int face = matrix_free.n_inner_face_batches();
+        face < matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+        ++face)
+    {
+      auto const it = exchange_distances.find(matrix_free.get_boundary_id(face));
+      if(it != exchange_distances.end())
+      {
+        FaceIntegrator<dim, dim, Number> integrator(matrix_free, true, dof_index, quad_index);
+        integrator.reinit(face);
+
+        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          auto const normal = integrator.normal_vector(q);
+
+          for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v, ++index)
+          {
+            for(unsigned int d = 0; d < dim; ++d)
+              normals_q[index][d] = normal[d][v];
+
+            distances_q[index] = it->second;
+            points[index] -= it->second * normals_q[index];
+          }
+        }
+      }
+    }
+
+    AssertThrow(index == points.size(),
+                dealii::ExcMessage("Inconsistent number of points of the wall model."));
+  }
+
+  // the distances are of the order of the near-wall cells
+  double const tolerance = 1.e-10;
+
+  interface_coupling.setup(interface_data,
+                           matrix_free.get_dof_handler(dof_index),
+                           mapping,
+                           std::vector<bool>() /* marked_vertices */,
+                           tolerance);
+}
+
+template<int dim, typename Number>
+void
+WallModel<dim, Number>::update(VectorType const & velocity)
+{
+  // velocity at the exchange locations
+  interface_coupling.update_data(velocity);
+
+  // replace the velocity by the wall shear stress divided by the viscosity, i.e., the prescribed
+  // normal gradient F(u)*n of the tangential components
+  for(auto const quad_index : interface_data->get_quad_indices())
+  {
+    auto &       values      = interface_data->get_array_solution(quad_index);
+    auto const & normals_q   = normals[quad_index];
+    auto const & distances_q = distances[quad_index];
+
+    for(unsigned int i = 0; i < values.size(); ++i)
+    {
+      dealii::Tensor<1, dim> const u_t = values[i] - (values[i] * normals_q[i]) * normals_q[i];
+
+      double const u_t_norm = u_t.norm();
+
+      if(u_t_norm > 0.0)
+      {
+        double const u_tau = compute_friction_velocity(u_t_norm, distances_q[i], viscosity);
+
+        values[i] = -(u_tau * u_tau / (viscosity * u_t_norm)) * u_t;
+      }
+      else
+      {
+        values[i] = dealii::Tensor<1, dim>();
+      }
+    }
+  }
+}
+
+template<int dim, typename Number>
+double
+WallModel<dim, Number>::compute_friction_velocity(double const u_t,
+                                                  double const y,
+                                                  double const viscosity)
+{
+  double const kappa = 0.41;
+  double const B     = 5.2;
+  double const c     = std::exp(-kappa * B);
+
+  double const Re_y = u_t * y / viscosity;
+
+  // With y+ = Re_y / u+, Spalding's law reads g(u+) = u+ y+(u+) - Re_y = 0, where g is convex and
+  // monotonically increasing. Since y+(u+) >= u+, Newton's method converges monotonically when
+  // starting from the laminar solution u+ = sqrt(Re_y), which is an upper bound of the root.
+  double u_plus = std::sqrt(Re_y);
+  for(unsigned int iter = 0; iter < 100; ++iter)
+  {
+    double const k  = kappa * u_plus;
+    double const ek = std::exp(k);
+
+    double const y_plus   = u_plus + c * (ek - 1.0 - k - k * k / 2.0 - k * k * k / 6.0);
+    double const d_y_plus = 1.0 + c * kappa * (ek - 1.0 - k - k * k / 2.0);
+
+    double const g   = u_plus * y_plus - Re_y;
+    double const d_g = y_plus + u_plus * d_y_plus;
+
+    double const increment = g / d_g;
+    u_plus -= increment;
+
+    if(std::abs(increment) < 1.e-12 * u_plus)
+      break;
+  }
+
+  return u_t / u_plus;
+}
+
+template class WallModel<2, float>;
+template class WallModel<2, double>;
+template class WallModel<3, float>;
+template class WallModel<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
@@ -0,0 +1,113 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_WALL_MODEL_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_WALL_MODEL_H_
+
+// C/C++
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+// deal.II
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/functions_and_boundary_conditions/interface_coupling.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Equilibrium wall model for wall-modeled LES, see BoundaryTypeU::WallModel. The velocity is
+ * sampled at exchange locations, which are the boundary quadrature points moved into the domain by
+ * the exchange distance y_wm of the boundary. The friction velocity u_tau follows from the law of
+ * the wall by Spalding (1961)
+ *
+ *   y+ = u+ + exp(-kappa B) [exp(kappa u+) - 1 - kappa u+ - (kappa u+)^2/2 - (kappa u+)^3/6]
+ *
+ * with u+ = |u_t| / u_tau, y+ = y_wm u_tau / nu, and the tangential velocity u_t at the exchange
+ * location. The wall shear stress (divided by the density) acts opposite to u_t,
+ *
+ *   nu F(u)*n = - u_tau^2 u_t / |u_t| ,
+ *
+ * and is imposed like an inhomogeneous Neumann condition for the tangential components.
+ *
+ * The points are searched only once in setup() via RemotePointEvaluation, and the communication
+ * pattern is reused in each update() (i.e., in each time step), such that the wall model is
+ * explicit in time.
+ */
+template<int dim, typename Number>
+class WallModel
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  WallModel();
+
+  /*
+   * The data computed in update() is stored in interface_data, which is read by the integrators of
+   * the viscous term. The wall model is applied on the boundary IDs of exchange_distances.
+   */
+  void
+  setup(std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data,
+        dealii::MatrixFree<dim, Number> const &                 matrix_free,
+        unsigned int const                                      dof_index,
+        std::vector<unsigned int> const &                       quad_indices,
+        std::map<dealii::types::boundary_id, double> const &    exchange_distances,
+        dealii::Mapping<dim> const &                            mapping,
+        double const                                            viscosity);
+
+  /*
+   * Evaluates the velocity at the exchange locations and computes the wall shear stress.
+   */
+  void
+  update(VectorType const & velocity);
+
+  /*
+   * Returns the friction velocity according to Spalding's law for the magnitude of the tangential
+   * velocity u_t at the wall distance y.
+   */
+  static double
+  compute_friction_velocity(double const u_t, double const y, double const viscosity);
+
+private:
+  std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data;
+
+  InterfaceCoupling<1, dim, Number> interface_coupling;
+
+  // outward unit normal vectors and exchange distances of the points of interface_data
+  std::map<unsigned int, std::vector<dealii::Tensor<1, dim>>> normals;
+  std::map<unsigned int, std::vector<double>>                 distances;
+
+  double viscosity;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_WALL_MODEL_H_ */
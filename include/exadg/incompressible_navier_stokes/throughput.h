@@ -34,8 +34,10 @@
 
 // utilities
 #include <exadg/operators/hypercube_resolution_parameters.h>
+#include <exadg/operators/scaling_study.h>
 #include <exadg/operators/throughput_parameters.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
 
 // application
 #include <exadg/incompressible_navier_stokes/user_interface/declare_get_application.h>
@@ -56,6 +58,9 @@ create_input_file(std::string const & input_file)
   ThroughputParameters<IncNS::OperatorType> throughput;
   throughput.add_parameters(prm);
 
+  ScalingStudyParameters scaling;
+  scaling.add_parameters(prm);
+
   try
   {
     // we have to assume a default dimension and default Number type
@@ -143,6 +148,7 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters                                general(input_file);
   ExaDG::HypercubeResolutionParameters                    resolution(input_file, general.dim);
   ExaDG::ThroughputParameters<ExaDG::IncNS::OperatorType> throughput(input_file);
+  ExaDG::ScalingStudyParameters                           scaling(input_file);
 
   ExaDG::IncNS::PressureDegree pressure_degree = ExaDG::IncNS::PressureDegree::MixedOrder;
 
@@ -166,42 +172,45 @@ main(int argc, char ** argv)
         throughput.operator_type, pressure_degree, dim, degree, element_type);
     };
 
-  // fill resolution vector depending on the operator_type
-  resolution.fill_resolution_vector(lambda_get_dofs_per_element);
-
-  // loop over resolutions vector and run simulations
-  for(auto iter = resolution.resolutions.begin(); iter != resolution.resolutions.end(); ++iter)
-  {
-    unsigned int const degree       = std::get<0>(*iter);
-    unsigned int const refine_space = std::get<1>(*iter);
-    unsigned int const n_cells_1d   = std::get<2>(*iter);
-
-    if(general.dim == 2 and general.precision == "float")
-    {
-      ExaDG::run<2, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 2 and general.precision == "double")
-    {
-      ExaDG::run<2, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 3 and general.precision == "float")
+  // loop over resolutions vector and run simulations, possibly for a series of communicators
+  auto const run_resolutions = [&](ExaDG::ResolutionsVector const & resolutions,
+                                   MPI_Comm const &                 sub_comm) {
+    for(auto iter = resolutions.begin(); iter != resolutions.end(); ++iter)
     {
-      ExaDG::run<3, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
+      unsigned int const degree       = std::get<0>(*iter);
+      unsigned int const refine_space = std::get<1>(*iter);
+      unsigned int const n_cells_1d   = std::get<2>(*iter);
+
+      if(general.dim == 2 and general.precision == "float")
+      {
+        ExaDG::run<2, float>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else if(general.dim == 2 and general.precision == "double")
+      {
+        ExaDG::run<2, double>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else if(general.dim == 3 and general.precision == "float")
+      {
+        ExaDG::run<3, float>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else if(general.dim == 3 and general.precision == "double")
+      {
+        ExaDG::run<3, double>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else
+      {
+        AssertThrow(false,
+                    dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
+      }
     }
-    else if(general.dim == 3 and general.precision == "double")
-    {
-      ExaDG::run<3, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else
-    {
-      AssertThrow(false,
-                  dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
-    }
-  }
+  };
+
+  ExaDG::run_scaling_study(
+    scaling, resolution, lambda_get_dofs_per_element, throughput, run_resolutions, mpi_comm);
 
   if(not(general.is_test))
     throughput.print_results(mpi_comm);
@@ -210,6 +219,9 @@ main(int argc, char ** argv)
   LIKWID_MARKER_CLOSE;
 #endif
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
   return 0;
 }
 
@@ -164,9 +164,25 @@ DriverSteadyProblems<dim, Number>::do_solve(double const time, bool unsteady_pro
     if(this->param.right_hand_side)
       pde_operator->evaluate_add_body_force_term(rhs, time);
 
-    // Newton solver
-    auto const iter = pde_operator->solve_nonlinear_problem(
-      solution, rhs, this->param.update_preconditioner_coupled, time);
+    std::tuple<unsigned int, unsigned int> iter;
+    if(this->param.pseudo_time_stepping_steady)
+    {
+      auto const pseudo_time_iter = solve_pseudo_time_stepping(rhs, time, unsteady_problem);
+
+      if(print_solver_info(time, unsteady_problem) and not(this->is_test))
+        pcout << std::endl
+              << "  Pseudo-time steps: " << std::get<0>(pseudo_time_iter) << std::endl;
+
+      iter = {std::get<1>(pseudo_time_iter), std::get<2>(pseudo_time_iter)};
+    }
+    else
+    {
+      // Newton solver
+      iter = pde_operator->solve_nonlinear_problem(solution,
+                                                   rhs,
+                                                   this->param.update_preconditioner_coupled,
+                                                   time);
+    }
 
     if(print_solver_info(time, unsteady_problem) and not(this->is_test))
       print_solver_info_nonlinear(pcout, std::get<0>(iter), std::get<1>(iter), timer.wall_time());
@@ -196,6 +212,64 @@ DriverSteadyProblems<dim, Number>::do_solve(double const time, bool unsteady_pro
   timer_tree->insert({"DriverSteady", "Solve"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+std::tuple<unsigned int, unsigned int, unsigned int>
+DriverSteadyProblems<dim, Number>::solve_pseudo_time_stepping(VectorType const & rhs,
+                                                              double const       time,
+                                                              bool               unsteady_problem)
+{
+  BlockVectorType residual;
+  pde_operator->initialize_block_vector_velocity_pressure(residual);
+
+  // rhs of the implicit Euler step, f + M u_k / dtau
+  VectorType rhs_pseudo_time(rhs), mass_solution(rhs);
+
+  pde_operator->evaluate_nonlinear_residual_steady(residual, solution, time);
+  double const residual_norm_initial = residual.l2_norm();
+  double       residual_norm         = residual_norm_initial;
+
+  double pseudo_time_step_size = this->param.pseudo_time_step_size_initial;
+
+  unsigned int n_steps = 0, n_iter_nonlinear = 0, n_iter_linear = 0;
+  while(residual_norm > this->param.abs_tol_steady and
+        residual_norm > this->param.rel_tol_steady * residual_norm_initial and
+        n_steps < this->param.max_number_of_pseudo_time_steps)
+  {
+    double const scaling_factor_mass = 1.0 / pseudo_time_step_size;
+
+    pde_operator->apply_mass_operator(mass_solution, solution.block(0));
+    rhs_pseudo_time = rhs;
+    rhs_pseudo_time.add(scaling_factor_mass, mass_solution);
+
+    bool const update_preconditioner = this->param.update_preconditioner_coupled;
+
+    auto const iter = pde_operator->solve_nonlinear_problem(
+      solution, rhs_pseudo_time, update_preconditioner, time, scaling_factor_mass);
+
+    ++n_steps;
+    n_iter_nonlinear += std::get<0>(iter);
+    n_iter_linear += std::get<1>(iter);
+
+    pde_operator->evaluate_nonlinear_residual_steady(residual, solution, time);
+    double const residual_norm_new = residual.l2_norm();
+
+    if(print_solver_info(time, unsteady_problem) and not(this->is_test))
+    {
+      pcout << "  Pseudo-time step " << n_steps << ": dtau = " << pseudo_time_step_size
+            << ", residual = " << residual_norm_new << std::endl;
+    }
+
+    // switched evolution relaxation
+    if(residual_norm_new > 0.0)
+      pseudo_time_step_size = std::min(pseudo_time_step_size * residual_norm / residual_norm_new,
+                                       this->param.pseudo_time_step_size_max);
+
+    residual_norm = residual_norm_new;
+  }
+
+  return {n_steps, n_iter_nonlinear, n_iter_linear};
+}
+
 template<int dim, typename Number>
 bool
 DriverSteadyProblems<dim, Number>::print_solver_info(double const time, bool unsteady_problem) const
@@ -62,6 +62,17 @@ public:
   void
   solve(double const time = 0.0, bool unsteady_problem = false);
 
+  /*
+   * The two steps of solve(), i.e., the solution of the steady problem and the postprocessing,
+   * which can be called separately, e.g. to solve the steady problem several times within the
+   * coupling iterations of a coupled problem and to postprocess the converged solution only once.
+   */
+  void
+  do_solve(double const time = 0.0, bool unsteady_problem = false);
+
+  void
+  postprocessing(double const time = 0.0, bool unsteady_problem = false) const;
+
   VectorType const &
   get_velocity() const;
 
@@ -78,15 +89,16 @@ private:
   void
   initialize_solution();
 
-  void
-  do_solve(double const time = 0.0, bool unsteady_problem = false);
+  /*
+   * Pseudo-transient continuation, see Parameters::pseudo_time_stepping_steady. Returns the
+   * number of pseudo-time steps and the accumulated Newton and linear iterations.
+   */
+  std::tuple<unsigned int, unsigned int, unsigned int>
+  solve_pseudo_time_stepping(VectorType const & rhs, double const time, bool unsteady_problem);
 
   bool
   print_solver_info(double const time, bool unsteady_problem = false) const;
 
-  void
-  postprocessing(double const time = 0.0, bool unsteady_problem = false) const;
-
   std::shared_ptr<OperatorCoupled<dim, Number>> pde_operator;
 
   Parameters const & param;
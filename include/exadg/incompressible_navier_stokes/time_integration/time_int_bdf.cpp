@@ -91,6 +91,16 @@ TimeIntBDF<dim, Number>::allocate_vectors()
   }
 }
 
+template<int dim, typename Number>
+std::size_t
+TimeIntBDF<dim, Number>::memory_consumption_vectors() const
+{
+  return dealii::MemoryConsumption::memory_consumption(vec_convective_term) +
+         convective_term_np.memory_consumption() + grid_velocity.memory_consumption() +
+         grid_coordinates_np.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(vec_grid_coordinates);
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::setup_derived()
@@ -150,6 +160,33 @@ TimeIntBDF<dim, Number>::prepare_vectors_for_next_timestep()
   }
 }
 
+template<int dim, typename Number>
+bool
+TimeIntBDF<dim, Number>::preconditioner_update_needed(
+  bool const                         update_preconditioner,
+  unsigned int const                 update_every_time_steps,
+  PreconditionerUpdatePolicy const & policy) const
+{
+  if(not update_preconditioner)
+    return false;
+
+  if(param.adaptive_preconditioner_update)
+    return policy.update_needed();
+
+  return ((this->time_step_number - 1) % update_every_time_steps == 0);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::report_preconditioner_update(PreconditionerUpdatePolicy & policy,
+                                                      unsigned int const           n_iterations,
+                                                      double const                 wall_time,
+                                                      bool const                   updated) const
+{
+  if(param.adaptive_preconditioner_update)
+    policy.report(n_iterations, wall_time, updated, this->mpi_comm);
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::ale_update()
@@ -255,17 +292,34 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
 {
+  AssertThrow(not(this->use_cellwise_restart_format() and this->param.ale_formulation),
+              dealii::ExcMessage(
+                "Partition-independent restart is not implemented for ALE formulations."));
+
+  bool const partition_independent = this->use_cellwise_restart_format();
+
+  restart_velocities.resize(this->order);
   for(unsigned int i = 0; i < this->order; i++)
   {
-    VectorType tmp = get_velocity(i);
-    ia >> tmp;
-    set_velocity(tmp, i);
+    restart_velocities[i] = get_velocity(i);
+    read_restart_vector(ia, operator_base->get_dof_handler_u(), restart_velocities[i]);
+    if(not partition_independent)
+      set_velocity(restart_velocities[i], i);
   }
+
+  restart_pressures.resize(this->order);
   for(unsigned int i = 0; i < this->order; i++)
   {
-    VectorType tmp = get_pressure(i);
-    ia >> tmp;
-    set_pressure(tmp, i);
+    restart_pressures[i] = get_pressure(i);
+    read_restart_vector(ia, operator_base->get_dof_handler_p(), restart_pressures[i]);
+    if(not partition_independent)
+      set_pressure(restart_pressures[i], i);
+  }
+
+  if(not partition_independent)
+  {
+    restart_velocities.clear();
+    restart_pressures.clear();
   }
 
   if(needs_vector_convective_term)
@@ -274,7 +328,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        read_restart_vector(ia, operator_base->get_dof_handler_u(), vec_convective_term[i]);
       }
     }
   }
@@ -292,13 +346,17 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
 {
+  AssertThrow(not(this->use_cellwise_restart_format() and this->param.ale_formulation),
+              dealii::ExcMessage(
+                "Partition-independent restart is not implemented for ALE formulations."));
+
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << get_velocity(i);
+    write_restart_vector(oa, operator_base->get_dof_handler_u(), get_velocity(i));
   }
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << get_pressure(i);
+    write_restart_vector(oa, operator_base->get_dof_handler_p(), get_pressure(i));
   }
 
   if(needs_vector_convective_term)
@@ -307,7 +365,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        write_restart_vector(oa, operator_base->get_dof_handler_u(), vec_convective_term[i]);
       }
     }
   }
@@ -321,6 +379,59 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
   }
 }
 
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::finalize_read_restart()
+{
+  if(this->use_cellwise_restart_format())
+  {
+    cellwise_restart_reader.distribute(this->mpi_comm);
+
+    for(unsigned int i = 0; i < restart_velocities.size(); i++)
+      set_velocity(restart_velocities[i], i);
+    for(unsigned int i = 0; i < restart_pressures.size(); i++)
+      set_pressure(restart_pressures[i], i);
+
+    restart_velocities.clear();
+    restart_pressures.clear();
+  }
+
+  // the time step size might depend on the velocity field, which is available only now
+  Base::finalize_read_restart();
+}
+
+template<int dim, typename Number>
+bool
+TimeIntBDF<dim, Number>::supports_partition_independent_restart() const
+{
+  return true;
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::write_restart_vector(boost::archive::binary_oarchive & oa,
+                                              dealii::DoFHandler<dim> const &   dof_handler,
+                                              VectorType const &                vector) const
+{
+  if(this->use_cellwise_restart_format())
+    write_restart_vector_cellwise(oa, dof_handler, vector);
+  else
+    oa << vector;
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::read_restart_vector(boost::archive::binary_iarchive & ia,
+                                             dealii::DoFHandler<dim> const &   dof_handler,
+                                             VectorType &                      vector)
+{
+  if(this->use_cellwise_restart_format())
+    cellwise_restart_reader.read(ia, dof_handler, vector);
+  else
+    ia >> vector;
+}
+
 template<int dim, typename Number>
 double
 TimeIntBDF<dim, Number>::calculate_time_step_size()
@@ -407,7 +518,8 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
   if(param.ale_formulation == true)
     u_relative -= grid_velocity;
 
-  double new_time_step_size = operator_base->calculate_time_step_cfl(u_relative);
+  double new_time_step_size =
+    operator_base->calculate_time_step_cfl(u_relative, not this->defer_time_step_reduction);
   new_time_step_size *= cfl;
 
   // make sure that time step size does not exceed maximum allowable time step size
@@ -433,6 +545,13 @@ TimeIntBDF<dim, Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<int dim, typename Number>
+bool
+TimeIntBDF<dim, Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::get_velocities_and_times(std::vector<VectorType const *> & velocities,
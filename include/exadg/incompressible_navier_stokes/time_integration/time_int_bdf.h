@@ -27,6 +27,8 @@
 
 // ExaDG
 #include <exadg/time_integration/lambda_functions_ale.h>
+#include <exadg/time_integration/preconditioner_update_policy.h>
+#include <exadg/time_integration/restart_cellwise.h>
 #include <exadg/time_integration/time_int_bdf_base.h>
 
 namespace ExaDG
@@ -100,10 +102,16 @@ public:
   bool
   print_solver_info() const final;
 
+  bool
+  print_memory_consumption() const final;
+
 protected:
   void
   allocate_vectors() override;
 
+  std::size_t
+  memory_consumption_vectors() const override;
+
   void
   setup_derived() override;
 
@@ -113,9 +121,50 @@ protected:
   void
   write_restart_vectors(boost::archive::binary_oarchive & oa) const override;
 
+  void
+  finalize_read_restart() override;
+
+  bool
+  supports_partition_independent_restart() const final;
+
+  /*
+   * Restart: writes/reads a DoF vector defined on dof_handler. In case of a partition-independent
+   * restart, the vector is stored cell-wise and the vector passed to read_restart_vector() is only
+   * filled in finalize_read_restart().
+   */
+  void
+  write_restart_vector(boost::archive::binary_oarchive & oa,
+                       dealii::DoFHandler<dim> const &   dof_handler,
+                       VectorType const &                vector) const;
+
+  void
+  read_restart_vector(boost::archive::binary_iarchive & ia,
+                      dealii::DoFHandler<dim> const &   dof_handler,
+                      VectorType &                      vector);
+
   void
   prepare_vectors_for_next_timestep() override;
 
+  /*
+   * Returns whether the preconditioner of a linear solver has to be updated in the current time
+   * step. If adaptive_preconditioner_update is true, the decision is taken by the policy instead
+   * of the fixed interval update_every_time_steps.
+   */
+  bool
+  preconditioner_update_needed(bool const                         update_preconditioner,
+                               unsigned int const                 update_every_time_steps,
+                               PreconditionerUpdatePolicy const & policy) const;
+
+  /*
+   * Reports the iterations and the wall time of a linear solve to the policy (only done if
+   * adaptive_preconditioner_update is true).
+   */
+  void
+  report_preconditioner_update(PreconditionerUpdatePolicy & policy,
+                               unsigned int const           n_iterations,
+                               double const                 wall_time,
+                               bool const                   updated) const;
+
   Parameters const & param;
 
   // number of refinement steps, where the time step size is reduced in
@@ -140,6 +189,12 @@ protected:
   // This object allows to access utility functions needed for ALE
   std::shared_ptr<HelpersALE<dim, Number> const> helpers_ale;
 
+  // automatic update of preconditioners, see adaptive_preconditioner_update
+  PreconditionerUpdatePolicy preconditioner_update_pressure;
+  PreconditionerUpdatePolicy preconditioner_update_projection;
+  PreconditionerUpdatePolicy preconditioner_update_momentum;
+  PreconditionerUpdatePolicy preconditioner_update_coupled;
+
 private:
   void
   get_quantities_and_times(
@@ -185,6 +240,11 @@ private:
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
   VectorType              grid_coordinates_np;
+
+  // partition-independent restart
+  CellwiseRestartReader<dim, Number> cellwise_restart_reader;
+  std::vector<VectorType>            restart_velocities;
+  std::vector<VectorType>            restart_pressures;
 };
 
 } // namespace IncNS
@@ -60,6 +60,14 @@ TimeIntBDFCoupled<dim, Number>::allocate_vectors()
   pde_operator->initialize_block_vector_velocity_pressure(solution_np);
 }
 
+template<int dim, typename Number>
+std::size_t
+TimeIntBDFCoupled<dim, Number>::memory_consumption_vectors() const
+{
+  return TimeIntBDF<dim, Number>::memory_consumption_vectors() +
+         dealii::MemoryConsumption::memory_consumption(solution) + solution_np.memory_consumption();
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFCoupled<dim, Number>::initialize_current_solution()
@@ -167,9 +175,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
   // extrapolated solution
   if(this->use_extrapolation)
   {
-    solution_np.equ(this->extra.get_beta(0), solution[0]);
-    for(unsigned int i = 1; i < solution.size(); ++i)
-      solution_np.add(this->extra.get_beta(i), solution[i]);
+    compute_linear_combination(solution_np,
+                               this->get_extrapolation_factors(solution.size()),
+                               solution);
   }
   else if(this->param.apply_penalty_terms_in_postprocessing_step == true)
   {
@@ -192,6 +200,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     }
   }
 
+  // explicit update of the wall shear stress of the wall model
+  pde_operator->update_wall_model(solution_np.block(0));
+
   // Update divergence and continuity penalty operator in case
   // that these terms are added to the monolithic system of equations.
   if(this->param.apply_penalty_terms_in_postprocessing_step == false)
@@ -222,17 +233,17 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
   solution_np.block(1) *= 1.0 / scaling_factor_continuity;
 
   bool const update_preconditioner =
-    this->param.update_preconditioner_coupled and
-    ((this->time_step_number - 1) % this->param.update_preconditioner_coupled_every_time_steps ==
-     0);
+    this->preconditioner_update_needed(this->param.update_preconditioner_coupled,
+                                       this->param.update_preconditioner_coupled_every_time_steps,
+                                       this->preconditioner_update_coupled);
 
   // calculate Sum_i (alpha_i/dt * u_i) and store
   VectorType sum_alphai_ui(solution[0].block(0));
-  sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), solution[0].block(0));
-  for(unsigned int i = 1; i < solution.size(); ++i)
-  {
-    sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i].block(0));
-  }
+  std::vector<VectorType const *> velocities(solution.size());
+  for(unsigned int i = 0; i < solution.size(); ++i)
+    velocities[i] = &solution[i].block(0);
+
+  compute_linear_combination(sum_alphai_ui, this->get_bdf_factors(solution.size()), velocities);
 
   // Update the convective term when using an ALE formulation
   if(this->param.convective_problem() and
@@ -264,17 +275,26 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     if(this->param.convective_problem() and
        this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-        rhs.add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+      compute_linear_combination(rhs,
+                                 this->get_extrapolation_factors(this->vec_convective_term.size(),
+                                                                 -1.0),
+                                 this->vec_convective_term,
+                                 true);
     }
 
     // Newton solver
+    dealii::Timer timer_solve;
+
     auto const iter =
       pde_operator->solve_nonlinear_problem(solution_np,
                                             rhs,
                                             update_preconditioner,
                                             this->get_next_time(),
                                             this->get_scaling_factor_time_derivative_term());
+    this->report_preconditioner_update(this->preconditioner_update_coupled,
+                                       std::get<1>(iter),
+                                       timer_solve.wall_time(),
+                                       update_preconditioner);
 
     iterations.first += 1;
     std::get<0>(iterations.second) += std::get<0>(iter);
@@ -305,18 +325,27 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     if(this->param.convective_problem() and
        this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-        rhs_vector.block(0).add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+      compute_linear_combination(rhs_vector.block(0),
+                                 this->get_extrapolation_factors(this->vec_convective_term.size(),
+                                                                 -1.0),
+                                 this->vec_convective_term,
+                                 true);
     }
 
     // apply mass operator to sum_alphai_ui and add to rhs vector
     pde_operator->apply_mass_operator_add(rhs_vector.block(0), sum_alphai_ui);
 
+    dealii::Timer timer_solve;
+
     unsigned int const n_iter =
       pde_operator->solve_linear_stokes_problem(solution_np,
                                                 rhs_vector,
                                                 update_preconditioner,
                                                 this->get_scaling_factor_time_derivative_term());
+    this->report_preconditioner_update(this->preconditioner_update_coupled,
+                                       n_iter,
+                                       timer_solve.wall_time(),
+                                       update_preconditioner);
 
     iterations.first += 1;
     std::get<1>(iterations.second) += n_iter;
@@ -390,9 +419,13 @@ TimeIntBDFCoupled<dim, Number>::penalty_step()
   VectorType velocity_extrapolated(solution_np.block(0));
   if(this->use_extrapolation)
   {
-    velocity_extrapolated = 0.0;
+    std::vector<VectorType const *> velocities(solution.size());
     for(unsigned int i = 0; i < solution.size(); ++i)
-      velocity_extrapolated.add(this->extra.get_beta(i), solution[i].block(0));
+      velocities[i] = &solution[i].block(0);
+
+    compute_linear_combination(velocity_extrapolated,
+                               this->get_extrapolation_factors(solution.size()),
+                               velocities);
   }
   else
   {
@@ -407,17 +440,23 @@ TimeIntBDFCoupled<dim, Number>::penalty_step()
   if(this->param.use_continuity_penalty and this->param.continuity_penalty_use_boundary_data)
     pde_operator->rhs_add_projection_operator(rhs, this->get_next_time());
 
-  bool const update_preconditioner =
-    this->param.update_preconditioner_projection and
-    ((this->time_step_number - 1) % this->param.update_preconditioner_projection_every_time_steps ==
-     0);
+  bool const update_preconditioner = this->preconditioner_update_needed(
+    this->param.update_preconditioner_projection,
+    this->param.update_preconditioner_projection_every_time_steps,
+    this->preconditioner_update_projection);
 
   // solve projection step
   if(this->use_extrapolation == false)
     solution_np.block(0) = velocity_penalty_last_iter;
 
+  dealii::Timer timer_solve;
+
   unsigned int n_iter =
     pde_operator->solve_projection(solution_np.block(0), rhs, update_preconditioner);
+  this->report_preconditioner_update(this->preconditioner_update_projection,
+                                     n_iter,
+                                     timer_solve.wall_time(),
+                                     update_preconditioner);
 
   if(this->store_solution)
     velocity_penalty_last_iter = solution_np.block(0);
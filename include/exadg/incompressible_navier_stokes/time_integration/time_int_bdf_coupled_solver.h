@@ -78,6 +78,9 @@ private:
   void
   allocate_vectors() final;
 
+  std::size_t
+  memory_consumption_vectors() const final;
+
   void
   setup_derived() final;
 
@@ -24,6 +24,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_dual_splitting.h>
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_dual_splitting.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
+#include <exadg/solvers_and_preconditioners/utilities/vector_pool.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_step_calculation.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -94,7 +95,7 @@ TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(boost::archive::binar
 
   for(unsigned int i = 0; i < velocity_dbc.size(); i++)
   {
-    ia >> velocity_dbc[i];
+    this->read_restart_vector(ia, pde_operator->get_dof_handler_u(), velocity_dbc[i]);
   }
 }
 
@@ -107,7 +108,7 @@ TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(
 
   for(unsigned int i = 0; i < velocity_dbc.size(); i++)
   {
-    oa << velocity_dbc[i];
+    this->write_restart_vector(oa, pde_operator->get_dof_handler_u(), velocity_dbc[i]);
   }
 }
 
@@ -133,6 +134,19 @@ TimeIntBDFDualSplitting<dim, Number>::allocate_vectors()
   pde_operator->initialize_vector_velocity(velocity_dbc_np);
 }
 
+template<int dim, typename Number>
+std::size_t
+TimeIntBDFDualSplitting<dim, Number>::memory_consumption_vectors() const
+{
+  return Base::memory_consumption_vectors() +
+         dealii::MemoryConsumption::memory_consumption(velocity) +
+         velocity_np.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(pressure) +
+         pressure_np.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(velocity_dbc) +
+         velocity_dbc_np.memory_consumption();
+}
+
 
 template<int dim, typename Number>
 void
@@ -327,6 +341,9 @@ TimeIntBDFDualSplitting<dim, Number>::do_timestep_solve()
   if(this->param.apply_penalty_terms_in_postprocessing_step)
     penalty_step();
 
+  if(this->param.use_modal_filter)
+    filter_step();
+
   // evaluate convective term once the final solution at time
   // t_{n+1} is known
   evaluate_convective_term();
@@ -339,46 +356,71 @@ TimeIntBDFDualSplitting<dim, Number>::convective_step()
   dealii::Timer timer;
   timer.restart();
 
-  velocity_np = 0.0;
-
-  // compute convective term and extrapolate convective term (if not Stokes equations)
-  if(this->param.convective_problem())
+  // in a general setting, we only know the boundary conditions at time t_{n+1}
+  if(this->param.convective_problem() and this->param.ale_formulation)
   {
-    if(this->param.ale_formulation)
+    for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-      {
-        // in a general setting, we only know the boundary conditions at time t_{n+1}
-        pde_operator->evaluate_convective_term(this->vec_convective_term[i],
-                                               velocity[i],
-                                               this->get_next_time());
-      }
+      pde_operator->evaluate_convective_term(this->vec_convective_term[i],
+                                             velocity[i],
+                                             this->get_next_time());
     }
-
-    for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-      velocity_np.add(-this->extra.get_beta(i), this->vec_convective_term[i]);
   }
 
-  // compute body force vector
-  if(this->param.right_hand_side == true)
+  unsigned int n_iter_mass = 0;
+
+  if(pde_operator->fused_convective_step_is_available())
   {
-    pde_operator->evaluate_add_body_force_term(velocity_np, this->get_next_time());
+    // extrapolated convective term, body force term, inverse mass operator, and sum
+    // (alpha_i/dt * u_i) in a single cell loop
+    std::vector<double> const factors_convective =
+      this->param.convective_problem() ?
+        this->get_extrapolation_factors(this->vec_convective_term.size(), -1.0) :
+        std::vector<double>();
+
+    pde_operator->evaluate_convective_step(velocity_np,
+                                           this->vec_convective_term,
+                                           factors_convective,
+                                           velocity,
+                                           this->get_bdf_factors(velocity.size()),
+                                           this->get_time_step_size() / this->bdf.get_gamma0(),
+                                           this->get_next_time());
   }
+  else
+  {
+    velocity_np = 0.0;
 
-  // apply inverse mass operator
-  unsigned int const n_iter_mass =
-    pde_operator->apply_inverse_mass_operator(velocity_np, velocity_np);
-  iterations_mass.first += 1;
-  iterations_mass.second += n_iter_mass;
+    // extrapolate convective term (if not Stokes equations)
+    if(this->param.convective_problem())
+    {
+      compute_linear_combination(velocity_np,
+                                 this->get_extrapolation_factors(this->vec_convective_term.size(),
+                                                                 -1.0),
+                                 this->vec_convective_term,
+                                 true);
+    }
 
-  // calculate sum (alpha_i/dt * u_i) and add to velocity_np
-  for(unsigned int i = 0; i < velocity.size(); ++i)
-  {
-    velocity_np.add(this->bdf.get_alpha(i) / this->get_time_step_size(), velocity[i]);
+    // compute body force vector
+    if(this->param.right_hand_side == true)
+    {
+      pde_operator->evaluate_add_body_force_term(velocity_np, this->get_next_time());
+    }
+
+    // apply inverse mass operator
+    n_iter_mass = pde_operator->apply_inverse_mass_operator(velocity_np, velocity_np);
+
+    // calculate sum (alpha_i/dt * u_i) and add to velocity_np
+    compute_linear_combination(velocity_np,
+                               this->get_bdf_factors(velocity.size()),
+                               velocity,
+                               true);
+
+    // solve discrete temporal derivative term for intermediate velocity u_hat
+    velocity_np *= this->get_time_step_size() / this->bdf.get_gamma0();
   }
 
-  // solve discrete temporal derivative term for intermediate velocity u_hat
-  velocity_np *= this->get_time_step_size() / this->bdf.get_gamma0();
+  iterations_mass.first += 1;
+  iterations_mass.second += n_iter_mass;
 
   if(this->print_solver_info() and not(this->is_test))
   {
@@ -429,17 +471,15 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   timer.restart();
 
   // compute right-hand-side vector
-  VectorType rhs(pressure_np);
-  rhs_pressure(rhs);
+  TemporaryVector<VectorType> rhs(pressure_np);
+  rhs_pressure(*rhs);
 
   // extrapolate old solution to get a good initial estimate for the solver
   if(this->use_extrapolation)
   {
-    pressure_np = 0;
-    for(unsigned int i = 0; i < pressure.size(); ++i)
-    {
-      pressure_np.add(this->extra.get_beta(i), pressure[i]);
-    }
+    compute_linear_combination(pressure_np,
+                               this->get_extrapolation_factors(pressure.size()),
+                               pressure);
   }
   else
   {
@@ -447,13 +487,19 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   }
 
   // solve linear system of equations
-  bool const update_preconditioner =
-    this->param.update_preconditioner_pressure_poisson and
-    ((this->time_step_number - 1) %
-       this->param.update_preconditioner_pressure_poisson_every_time_steps ==
-     0);
-
-  unsigned int const n_iter = pde_operator->solve_pressure(pressure_np, rhs, update_preconditioner);
+  bool const update_preconditioner = this->preconditioner_update_needed(
+    this->param.update_preconditioner_pressure_poisson,
+    this->param.update_preconditioner_pressure_poisson_every_time_steps,
+    this->preconditioner_update_pressure);
+
+  dealii::Timer timer_solve;
+
+  unsigned int const n_iter =
+    pde_operator->solve_pressure(pressure_np, *rhs, update_preconditioner);
+  this->report_preconditioner_update(this->preconditioner_update_pressure,
+                                     n_iter,
+                                     timer_solve.wall_time(),
+                                     update_preconditioner);
   iterations_pressure.first += 1;
   iterations_pressure.second += n_iter;
 
@@ -490,17 +536,17 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
   // inhomogeneous parts of boundary face integrals of velocity divergence operator
   if(this->param.divu_integrated_by_parts == true and this->param.divu_use_boundary_data == true)
   {
-    VectorType temp(rhs);
+    TemporaryVector<VectorType> temp(rhs);
 
     // sum alpha_i * u_i term
     for(unsigned int i = 0; i < velocity.size(); ++i)
     {
-      pde_operator->rhs_velocity_divergence_term_dirichlet_bc_from_dof_vector(temp,
+      pde_operator->rhs_velocity_divergence_term_dirichlet_bc_from_dof_vector(*temp,
                                                                               velocity_dbc[i]);
 
       // note that the minus sign related to this term is already taken into account
       // in the function rhs() of the divergence operator
-      rhs.add(this->bdf.get_alpha(i) / this->get_time_step_size(), temp);
+      rhs.add(this->bdf.get_alpha(i) / this->get_time_step_size(), *temp);
     }
 
     // convective term
@@ -508,9 +554,9 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
     {
       for(unsigned int i = 0; i < velocity.size(); ++i)
       {
-        temp = 0.0;
-        pde_operator->rhs_ppe_div_term_convective_term_add(temp, velocity[i]);
-        rhs.add(this->extra.get_beta(i), temp);
+        *temp = 0.0;
+        pde_operator->rhs_ppe_div_term_convective_term_add(*temp, velocity[i]);
+        rhs.add(this->extra.get_beta(i), *temp);
       }
     }
 
@@ -534,10 +580,10 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
   }
 
   // II.3. pressure Neumann boundary condition: temporal derivative of velocity
-  VectorType acceleration(velocity_dbc_np);
+  TemporaryVector<VectorType> acceleration(velocity_dbc_np, true);
   compute_bdf_time_derivative(
-    acceleration, velocity_dbc_np, velocity_dbc, this->bdf, this->get_time_step_size());
-  pde_operator->rhs_ppe_nbc_numerical_time_derivative_add(rhs, acceleration);
+    *acceleration, velocity_dbc_np, velocity_dbc, this->bdf, this->get_time_step_size());
+  pde_operator->rhs_ppe_nbc_numerical_time_derivative_add(rhs, *acceleration);
 
   // II.4. viscous term of pressure Neumann boundary condition on Gamma_D:
   //       extrapolate velocity, evaluate vorticity, and subsequently evaluate boundary
@@ -546,17 +592,17 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
   {
     if(this->param.order_extrapolation_pressure_nbc > 0)
     {
-      VectorType velocity_extra(velocity[0]);
-      velocity_extra = 0.0;
-      for(unsigned int i = 0; i < extra_pressure_nbc.get_order(); ++i)
-      {
-        velocity_extra.add(this->extra_pressure_nbc.get_beta(i), velocity[i]);
-      }
+      std::vector<double> factors(extra_pressure_nbc.get_order());
+      for(unsigned int i = 0; i < factors.size(); ++i)
+        factors[i] = this->extra_pressure_nbc.get_beta(i);
+
+      TemporaryVector<VectorType> velocity_extra(velocity[0], true);
+      compute_linear_combination(*velocity_extra, factors, velocity);
 
-      VectorType vorticity(velocity_extra);
-      pde_operator->compute_vorticity(vorticity, velocity_extra);
+      TemporaryVector<VectorType> vorticity(*velocity_extra);
+      pde_operator->compute_vorticity(*vorticity, *velocity_extra);
 
-      pde_operator->rhs_ppe_nbc_viscous_add(rhs, vorticity);
+      pde_operator->rhs_ppe_nbc_viscous_add(rhs, *vorticity);
     }
   }
 
@@ -567,12 +613,12 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
   {
     if(this->param.order_extrapolation_pressure_nbc > 0)
     {
-      VectorType temp(rhs);
+      TemporaryVector<VectorType> temp(rhs);
       for(unsigned int i = 0; i < extra_pressure_nbc.get_order(); ++i)
       {
-        temp = 0.0;
-        pde_operator->rhs_ppe_nbc_convective_add(temp, velocity[i]);
-        rhs.add(this->extra_pressure_nbc.get_beta(i), temp);
+        *temp = 0.0;
+        pde_operator->rhs_ppe_nbc_convective_add(*temp, velocity[i]);
+        rhs.add(this->extra_pressure_nbc.get_beta(i), *temp);
       }
     }
   }
@@ -594,12 +640,12 @@ TimeIntBDFDualSplitting<dim, Number>::projection_step()
   timer.restart();
 
   // compute right-hand-side vector
-  VectorType rhs(velocity_np);
-  rhs_projection(rhs);
+  TemporaryVector<VectorType> rhs(velocity_np);
+  rhs_projection(*rhs);
 
   // apply inverse mass operator: this is the solution if no penalty terms are applied
   // and serves as a good initial guess for the case with penalty terms
-  unsigned int const n_iter_mass = pde_operator->apply_inverse_mass_operator(velocity_np, rhs);
+  unsigned int const n_iter_mass = pde_operator->apply_inverse_mass_operator(velocity_np, *rhs);
   iterations_mass.first += 1;
   iterations_mass.second += n_iter_mass;
 
@@ -609,31 +655,36 @@ TimeIntBDFDualSplitting<dim, Number>::projection_step()
   {
     // extrapolate velocity to time t_n+1 and use this velocity field to
     // calculate the penalty parameter for the divergence and continuity penalty term
-    VectorType velocity_extrapolated;
+    TemporaryVector<VectorType> velocity_extrapolated(velocity[0], true);
     if(this->use_extrapolation)
     {
-      velocity_extrapolated.reinit(velocity[0]);
-      for(unsigned int i = 0; i < velocity.size(); ++i)
-        velocity_extrapolated.add(this->extra.get_beta(i), velocity[i]);
+      compute_linear_combination(*velocity_extrapolated,
+                                 this->get_extrapolation_factors(velocity.size()),
+                                 velocity);
     }
     else
     {
-      velocity_extrapolated = velocity_projection_last_iter;
+      *velocity_extrapolated = velocity_projection_last_iter;
     }
 
-    pde_operator->update_projection_operator(velocity_extrapolated, this->get_time_step_size());
+    pde_operator->update_projection_operator(*velocity_extrapolated, this->get_time_step_size());
 
     // solve linear system of equations
-    bool const update_preconditioner =
-      this->param.update_preconditioner_projection and
-      ((this->time_step_number - 1) %
-         this->param.update_preconditioner_projection_every_time_steps ==
-       0);
+    bool const update_preconditioner = this->preconditioner_update_needed(
+      this->param.update_preconditioner_projection,
+      this->param.update_preconditioner_projection_every_time_steps,
+      this->preconditioner_update_projection);
 
     if(this->use_extrapolation == false)
       velocity_np = velocity_projection_last_iter;
 
-    unsigned int n_iter = pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
+    dealii::Timer timer_solve;
+
+    unsigned int n_iter = pde_operator->solve_projection(velocity_np, *rhs, update_preconditioner);
+    this->report_preconditioner_update(this->preconditioner_update_projection,
+                                       n_iter,
+                                       timer_solve.wall_time(),
+                                       update_preconditioner);
     iterations_projection.first += 1;
     iterations_projection.second += n_iter;
 
@@ -698,14 +749,15 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
   if(this->param.viscous_problem() or this->param.implicit_convective_problem())
   {
     // store the velocity vector that is needed to compute the rhs vector
-    VectorType velocity_rhs = velocity_np;
+    TemporaryVector<VectorType> velocity_rhs(velocity_np, true);
+    *velocity_rhs = velocity_np;
 
     // Extrapolate old solution to get a good initial estimate for the solver.
     if(this->use_extrapolation)
     {
-      velocity_np = 0;
-      for(unsigned int i = 0; i < velocity.size(); ++i)
-        velocity_np.add(this->extra.get_beta(i), velocity[i]);
+      compute_linear_combination(velocity_np,
+                                 this->get_extrapolation_factors(velocity.size()),
+                                 velocity);
     }
     else
     {
@@ -730,10 +782,13 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
       }
     }
 
-    bool const update_preconditioner =
-      this->param.update_preconditioner_momentum and
-      ((this->time_step_number - 1) % this->param.update_preconditioner_momentum_every_time_steps ==
-       0);
+    // explicit update of the wall shear stress of the wall model
+    pde_operator->update_wall_model(velocity_np);
+
+    bool const update_preconditioner = this->preconditioner_update_needed(
+      this->param.update_preconditioner_momentum,
+      this->param.update_preconditioner_momentum_every_time_steps,
+      this->preconditioner_update_momentum);
 
     if(this->param.nonlinear_problem_has_to_be_solved())
     {
@@ -742,16 +797,22 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
        *  (where constant means that the vector does not change from one Newton iteration
        *  to the next, i.e., it does not depend on the current solution of the nonlinear solver)
        */
-      VectorType rhs(velocity_rhs);
-      rhs_viscous(rhs, velocity_rhs);
+      TemporaryVector<VectorType> rhs(velocity_np);
+      rhs_viscous(*rhs, *velocity_rhs);
 
       // solve non-linear system of equations
+      dealii::Timer timer_solve;
+
       auto const iter = pde_operator->solve_nonlinear_momentum_equation(
         velocity_np,
-        rhs,
+        *rhs,
         this->get_next_time(),
         update_preconditioner,
         this->get_scaling_factor_time_derivative_term());
+      this->report_preconditioner_update(this->preconditioner_update_momentum,
+                                         std::get<1>(iter),
+                                         timer_solve.wall_time(),
+                                         update_preconditioner);
 
       iterations_viscous.first += 1;
       std::get<0>(iterations_viscous.second) += std::get<0>(iter);
@@ -773,12 +834,18 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
       /*
        *  Calculate the right-hand side of the linear system of equations.
        */
-      VectorType rhs(velocity_rhs);
-      rhs_viscous(rhs, velocity_rhs);
+      TemporaryVector<VectorType> rhs(velocity_np);
+      rhs_viscous(*rhs, *velocity_rhs);
 
       // solve linear system of equations
+      dealii::Timer timer_solve;
+
       unsigned int const n_iter = pde_operator->solve_linear_momentum_equation(
-        velocity_np, rhs, update_preconditioner, this->get_scaling_factor_time_derivative_term());
+        velocity_np, *rhs, update_preconditioner, this->get_scaling_factor_time_derivative_term());
+      this->report_preconditioner_update(this->preconditioner_update_momentum,
+                                         n_iter,
+                                         timer_solve.wall_time(),
+                                         update_preconditioner);
       iterations_viscous.first += 1;
       std::get<1>(iterations_viscous.second) += n_iter;
 
@@ -823,8 +890,10 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_viscous(VectorType &       rhs,
     // compensate for explicit convective term
     if(this->param.convective_problem())
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-        rhs.add(this->extra.get_beta(i), this->vec_convective_term[i]);
+      compute_linear_combination(rhs,
+                                 this->get_extrapolation_factors(this->vec_convective_term.size()),
+                                 this->vec_convective_term,
+                                 true);
     }
   }
   else
@@ -846,35 +915,40 @@ TimeIntBDFDualSplitting<dim, Number>::penalty_step()
     timer.restart();
 
     // compute right-hand-side vector
-    VectorType rhs(velocity_np);
-    pde_operator->apply_mass_operator(rhs, velocity_np);
+    TemporaryVector<VectorType> rhs(velocity_np);
+    pde_operator->apply_mass_operator(*rhs, velocity_np);
 
     // extrapolate velocity to time t_n+1 and use this velocity field to
     // calculate the penalty parameter for the divergence and continuity penalty term
-    VectorType velocity_extrapolated(velocity_np);
-    velocity_extrapolated = 0.0;
-    for(unsigned int i = 0; i < velocity.size(); ++i)
-      velocity_extrapolated.add(this->extra.get_beta(i), velocity[i]);
+    TemporaryVector<VectorType> velocity_extrapolated(velocity_np, true);
+    compute_linear_combination(*velocity_extrapolated,
+                               this->get_extrapolation_factors(velocity.size()),
+                               velocity);
 
-    pde_operator->update_projection_operator(velocity_extrapolated, this->get_time_step_size());
+    pde_operator->update_projection_operator(*velocity_extrapolated, this->get_time_step_size());
 
     // right-hand side term: add inhomogeneous contributions of continuity penalty operator to
     // rhs-vector if desired
     if(this->param.use_continuity_penalty and this->param.continuity_penalty_use_boundary_data)
-      pde_operator->rhs_add_projection_operator(rhs, this->get_next_time());
+      pde_operator->rhs_add_projection_operator(*rhs, this->get_next_time());
 
     // solve linear system of equations
-    bool const update_preconditioner =
-      this->param.update_preconditioner_projection and
-      ((this->time_step_number - 1) %
-         this->param.update_preconditioner_projection_every_time_steps ==
-       0);
+    bool const update_preconditioner = this->preconditioner_update_needed(
+      this->param.update_preconditioner_projection,
+      this->param.update_preconditioner_projection_every_time_steps,
+      this->preconditioner_update_projection);
 
     if(this->use_extrapolation == false)
       velocity_np = velocity_projection_last_iter;
 
+    dealii::Timer timer_solve;
+
     unsigned int const n_iter =
-      pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
+      pde_operator->solve_projection(velocity_np, *rhs, update_preconditioner);
+    this->report_preconditioner_update(this->preconditioner_update_projection,
+                                       n_iter,
+                                       timer_solve.wall_time(),
+                                       update_preconditioner);
 
     iterations_penalty.first += 1;
     iterations_penalty.second += n_iter;
@@ -893,6 +967,27 @@ TimeIntBDFDualSplitting<dim, Number>::penalty_step()
   }
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFDualSplitting<dim, Number>::filter_step()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  TemporaryVector<VectorType> velocity_unfiltered(velocity_np, true);
+  *velocity_unfiltered = velocity_np;
+
+  pde_operator->apply_modal_filter(velocity_np, *velocity_unfiltered);
+
+  if(this->print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl << "Modal filter:";
+    print_wall_time(this->pcout, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Filter step"}, timer.wall_time());
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFDualSplitting<dim, Number>::prepare_vectors_for_next_timestep()
@@ -76,6 +76,9 @@ private:
   void
   allocate_vectors() final;
 
+  std::size_t
+  memory_consumption_vectors() const final;
+
   void
   setup_derived() final;
 
@@ -124,6 +127,9 @@ private:
   void
   penalty_step();
 
+  void
+  filter_step();
+
   void
   viscous_step();
 
@@ -24,6 +24,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_pressure_correction.h>
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_pressure_correction.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
+#include <exadg/solvers_and_preconditioners/utilities/vector_pool.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_step_calculation.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -104,7 +105,7 @@ TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(
 
   for(unsigned int i = 0; i < pressure_dbc.size(); i++)
   {
-    ia >> pressure_dbc[i];
+    this->read_restart_vector(ia, pde_operator->get_dof_handler_p(), pressure_dbc[i]);
   }
 }
 
@@ -117,7 +118,7 @@ TimeIntBDFPressureCorrection<dim, Number>::write_restart_vectors(
 
   for(unsigned int i = 0; i < pressure_dbc.size(); i++)
   {
-    oa << pressure_dbc[i];
+    this->write_restart_vector(oa, pde_operator->get_dof_handler_p(), pressure_dbc[i]);
   }
 }
 
@@ -141,6 +142,18 @@ TimeIntBDFPressureCorrection<dim, Number>::allocate_vectors()
     pde_operator->initialize_vector_pressure(pressure_dbc[i]);
 }
 
+template<int dim, typename Number>
+std::size_t
+TimeIntBDFPressureCorrection<dim, Number>::memory_consumption_vectors() const
+{
+  return Base::memory_consumption_vectors() +
+         dealii::MemoryConsumption::memory_consumption(velocity) +
+         velocity_np.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(pressure) +
+         pressure_np.memory_consumption() +
+         dealii::MemoryConsumption::memory_consumption(pressure_dbc);
+}
+
 
 template<int dim, typename Number>
 void
@@ -328,6 +341,9 @@ TimeIntBDFPressureCorrection<dim, Number>::do_timestep_solve()
 
   projection_step(pressure_increment);
 
+  if(this->param.use_modal_filter)
+    filter_step();
+
   // evaluate convective term once the final solution at time
   // t_{n+1} is known
   evaluate_convective_term();
@@ -346,11 +362,9 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
     // Extrapolate old solutions to get a good initial estimate for the solver.
     if(this->use_extrapolation)
     {
-      velocity_np = 0.0;
-      for(unsigned int i = 0; i < velocity.size(); ++i)
-      {
-        velocity_np.add(this->extra.get_beta(i), velocity[i]);
-      }
+      compute_linear_combination(velocity_np,
+                                 this->get_extrapolation_factors(velocity.size()),
+                                 velocity);
     }
     else
     {
@@ -375,10 +389,13 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
       }
     }
 
-    bool const update_preconditioner =
-      this->param.update_preconditioner_momentum and
-      ((this->time_step_number - 1) % this->param.update_preconditioner_momentum_every_time_steps ==
-       0);
+    // explicit update of the wall shear stress of the wall model
+    pde_operator->update_wall_model(velocity_np);
+
+    bool const update_preconditioner = this->preconditioner_update_needed(
+      this->param.update_preconditioner_momentum,
+      this->param.update_preconditioner_momentum_every_time_steps,
+      this->preconditioner_update_momentum);
 
     if(this->param.nonlinear_problem_has_to_be_solved())
     {
@@ -391,12 +408,18 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
       rhs_momentum(rhs);
 
       // solve non-linear system of equations
+      dealii::Timer timer_solve;
+
       auto const iter = pde_operator->solve_nonlinear_momentum_equation(
         velocity_np,
         rhs,
         this->get_next_time(),
         update_preconditioner,
         this->get_scaling_factor_time_derivative_term());
+      this->report_preconditioner_update(this->preconditioner_update_momentum,
+                                         std::get<1>(iter),
+                                         timer_solve.wall_time(),
+                                         update_preconditioner);
 
       iterations_momentum.first += 1;
       std::get<0>(iterations_momentum.second) += std::get<0>(iter);
@@ -422,8 +445,14 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
       rhs_momentum(rhs);
 
       // solve linear system of equations
+      dealii::Timer timer_solve;
+
       unsigned int n_iter = pde_operator->solve_linear_momentum_equation(
         velocity_np, rhs, update_preconditioner, this->get_scaling_factor_time_derivative_term());
+      this->report_preconditioner_update(this->preconditioner_update_momentum,
+                                         n_iter,
+                                         timer_solve.wall_time(),
+                                         update_preconditioner);
 
       iterations_momentum.first += 1;
       std::get<1>(iterations_momentum.second) += n_iter;
@@ -510,8 +539,11 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_momentum(VectorType & rhs)
       }
     }
 
-    for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-      rhs.add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+    compute_linear_combination(rhs,
+                               this->get_extrapolation_factors(this->vec_convective_term.size(),
+                                                               -1.0),
+                               this->vec_convective_term,
+                               true);
   }
 
   /*
@@ -521,11 +553,7 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_momentum(VectorType & rhs)
   VectorType sum_alphai_ui(velocity[0]);
 
   // calculate sum (alpha_i/dt * u_i)
-  sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), velocity[0]);
-  for(unsigned int i = 1; i < velocity.size(); ++i)
-  {
-    sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), velocity[i]);
-  }
+  compute_linear_combination(sum_alphai_ui, this->get_bdf_factors(velocity.size()), velocity);
 
   pde_operator->apply_mass_operator_add(rhs, sum_alphai_ui);
 
@@ -557,26 +585,20 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   {
     // extrapolate old solution to get a good initial estimate for the
     // pressure solution p_{n+1} at time t^{n+1}
-    for(unsigned int i = 0; i < pressure.size(); ++i)
-    {
-      pressure_increment.add(this->extra.get_beta(i), pressure[i]);
-    }
+    std::vector<double> factors = this->get_extrapolation_factors(pressure.size());
 
     // incremental formulation
-    if(extra_pressure_gradient.get_order() > 0)
-    {
-      // Subtract extrapolation of pressure since the PPE is solved for the
-      // pressure increment phi = p_{n+1} - sum_i (beta_pressure_extra_i * pressure_i),
-      // where p_{n+1} is approximated by an extrapolation of order J (=order of BDF scheme).
-      // Note that the divergence correction term in case of the rotational formulation is not
-      // considered when calculating a good initial guess for the solution of the PPE,
-      // which will slightly increase the number of iterations compared to the standard
-      // formulation of the pressure-correction scheme.
-      for(unsigned int i = 0; i < extra_pressure_gradient.get_order(); ++i)
-      {
-        pressure_increment.add(-extra_pressure_gradient.get_beta(i), pressure[i]);
-      }
-    }
+    // Subtract extrapolation of pressure since the PPE is solved for the
+    // pressure increment phi = p_{n+1} - sum_i (beta_pressure_extra_i * pressure_i),
+    // where p_{n+1} is approximated by an extrapolation of order J (=order of BDF scheme).
+    // Note that the divergence correction term in case of the rotational formulation is not
+    // considered when calculating a good initial guess for the solution of the PPE,
+    // which will slightly increase the number of iterations compared to the standard
+    // formulation of the pressure-correction scheme.
+    for(unsigned int i = 0; i < extra_pressure_gradient.get_order(); ++i)
+      factors[i] -= extra_pressure_gradient.get_beta(i);
+
+    compute_linear_combination(pressure_increment, factors, pressure, true);
   }
   else
   {
@@ -584,14 +606,19 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   }
 
   // solve linear system of equations
-  bool const update_preconditioner =
-    this->param.update_preconditioner_pressure_poisson and
-    ((this->time_step_number - 1) %
-       this->param.update_preconditioner_pressure_poisson_every_time_steps ==
-     0);
+  bool const update_preconditioner = this->preconditioner_update_needed(
+    this->param.update_preconditioner_pressure_poisson,
+    this->param.update_preconditioner_pressure_poisson_every_time_steps,
+    this->preconditioner_update_pressure);
+
+  dealii::Timer timer_solve;
 
   unsigned int const n_iter =
     pde_operator->solve_pressure(pressure_increment, rhs, update_preconditioner);
+  this->report_preconditioner_update(this->preconditioner_update_pressure,
+                                     n_iter,
+                                     timer_solve.wall_time(),
+                                     update_preconditioner);
 
   iterations_pressure.first += 1;
   iterations_pressure.second += n_iter;
@@ -716,10 +743,11 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_update(VectorType const & pr
   // add extrapolation of pressure to the pressure-increment solution in order to obtain
   // the pressure solution at the end of the time step, i.e.,
   // p^{n+1} = (pressure_increment)^{n+1} + sum_i (beta_pressure_extrapolation_i * p^{n-i});
-  for(unsigned int i = 0; i < extra_pressure_gradient.get_order(); ++i)
-  {
-    pressure_np.add(extra_pressure_gradient.get_beta(i), pressure[i]);
-  }
+  std::vector<double> factors(extra_pressure_gradient.get_order());
+  for(unsigned int i = 0; i < factors.size(); ++i)
+    factors[i] = extra_pressure_gradient.get_beta(i);
+
+  compute_linear_combination(pressure_np, factors, pressure, true);
 }
 
 template<int dim, typename Number>
@@ -782,9 +810,10 @@ TimeIntBDFPressureCorrection<dim, Number>::projection_step(VectorType const & pr
     VectorType velocity_extrapolated;
     if(this->use_extrapolation)
     {
-      velocity_extrapolated.reinit(velocity[0]);
-      for(unsigned int i = 0; i < velocity.size(); ++i)
-        velocity_extrapolated.add(this->extra.get_beta(i), velocity[i]);
+      velocity_extrapolated.reinit(velocity[0], true);
+      compute_linear_combination(velocity_extrapolated,
+                                 this->get_extrapolation_factors(velocity.size()),
+                                 velocity);
     }
     else
     {
@@ -800,17 +829,22 @@ TimeIntBDFPressureCorrection<dim, Number>::projection_step(VectorType const & pr
       pde_operator->rhs_add_projection_operator(rhs, this->get_next_time());
 
     // solve linear system of equations
-    bool const update_preconditioner =
-      this->param.update_preconditioner_projection and
-      ((this->time_step_number - 1) %
-         this->param.update_preconditioner_projection_every_time_steps ==
-       0);
+    bool const update_preconditioner = this->preconditioner_update_needed(
+      this->param.update_preconditioner_projection,
+      this->param.update_preconditioner_projection_every_time_steps,
+      this->preconditioner_update_projection);
 
     if(this->use_extrapolation == false)
       velocity_np = velocity_projection_last_iter;
 
+    dealii::Timer timer_solve;
+
     unsigned int const n_iter =
       pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
+    this->report_preconditioner_update(this->preconditioner_update_projection,
+                                       n_iter,
+                                       timer_solve.wall_time(),
+                                       update_preconditioner);
 
     iterations_projection.first += 1;
     iterations_projection.second += n_iter;
@@ -836,6 +870,27 @@ TimeIntBDFPressureCorrection<dim, Number>::projection_step(VectorType const & pr
   this->timer_tree->insert({"Timeloop", "Projection step"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFPressureCorrection<dim, Number>::filter_step()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  TemporaryVector<VectorType> velocity_unfiltered(velocity_np, true);
+  *velocity_unfiltered = velocity_np;
+
+  pde_operator->apply_modal_filter(velocity_np, *velocity_unfiltered);
+
+  if(this->print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl << "Modal filter:";
+    print_wall_time(this->pcout, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Filter step"}, timer.wall_time());
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFPressureCorrection<dim, Number>::evaluate_convective_term()
@@ -76,6 +76,9 @@ private:
   void
   allocate_vectors() final;
 
+  std::size_t
+  memory_consumption_vectors() const final;
+
   void
   setup_derived() final;
 
@@ -118,6 +121,9 @@ private:
   void
   projection_step(VectorType const & pressure_increment);
 
+  void
+  filter_step();
+
   void
   evaluate_convective_term();
 
@@ -116,6 +116,16 @@ private:
     this->operator_base->initialize_vector_pressure(pressure_np);
   }
 
+  std::size_t
+  memory_consumption_vectors() const final
+  {
+    return Base::memory_consumption_vectors() +
+           dealii::MemoryConsumption::memory_consumption(velocity) +
+           velocity_np.memory_consumption() +
+           dealii::MemoryConsumption::memory_consumption(pressure) +
+           pressure_np.memory_consumption();
+  }
+
 
   /**
    * This function simply sets the analytical
@@ -30,6 +30,7 @@
 #include <deal.II/base/types.h>
 
 // ExaDG
+#include <exadg/functions_and_boundary_conditions/boundary_function_cache.h>
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 
@@ -54,6 +55,9 @@ namespace IncNS
  *   |     outflow          |   Neumann:                |  Dirichlet:                                    |
  *   |                      | prescribe F(u)*n          | prescribe g_p                                  |
  *   +----------------------+---------------------------+------------------------------------------------+
+ *   |     wall-modeled LES |   WallModel:              |  Neumann:                                      |
+ *   |                      | prescribe y_wm            | no BCs to be prescribed                        |
+ *   +----------------------+---------------------------+------------------------------------------------+
  *
  *   Divergence formulation: F(u) = F_nu(u) / nu = ( grad(u) + grad(u)^T )
  *   Laplace formulation:    F(u) = F_nu(u) / nu = grad(u)
@@ -66,7 +70,8 @@ enum class BoundaryTypeU
   Dirichlet,
   DirichletCached,
   Neumann,
-  Symmetry
+  Symmetry,
+  WallModel
 };
 
 enum class BoundaryTypeP
@@ -118,6 +123,22 @@ struct BoundaryDescriptorU
   // be evaluated by the code).
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> symmetry_bc;
 
+  // WallModel: A boundary condition for wall-modeled LES, where the near-wall region of a
+  // turbulent boundary layer is not resolved. As for the symmetry boundary condition, the velocity
+  // normal to the wall is set to zero
+  //
+  //   u*n=0 ,
+  //
+  // but the surface stress vector in tangential directions is given by the wall shear stress
+  // tau_w (divided by the density) of an equilibrium wall model
+  //
+  //   nu F(u)*n - [(nu F(u)*n)*n] n = tau_w .
+  //
+  // The wall shear stress is computed from the velocity at an exchange location inside the
+  // domain, see WallModel. The user prescribes the distance y_wm > 0 of the exchange location
+  // from the wall, which is typically of the order of the size of the near-wall cells.
+  std::map<dealii::types::boundary_id, double> wall_model_bc;
+
   // add more types of boundary conditions
 
 
@@ -134,6 +155,8 @@ struct BoundaryDescriptorU
       return BoundaryTypeU::Neumann;
     else if(this->symmetry_bc.find(boundary_id) != this->symmetry_bc.end())
       return BoundaryTypeU::Symmetry;
+    else if(this->wall_model_bc.find(boundary_id) != this->wall_model_bc.end())
+      return BoundaryTypeU::WallModel;
 
     AssertThrow(false, dealii::ExcMessage("Boundary type of face is invalid or not implemented."));
 
@@ -159,6 +182,9 @@ struct BoundaryDescriptorU
     if(this->symmetry_bc.find(boundary_id) != this->symmetry_bc.end())
       counter++;
 
+    if(this->wall_model_bc.find(boundary_id) != this->wall_model_bc.end())
+      counter++;
+
     if(periodic_boundary_ids.find(boundary_id) != periodic_boundary_ids.end())
       counter++;
 
@@ -182,8 +208,59 @@ struct BoundaryDescriptorU
     return dirichlet_cached_data;
   }
 
+  /*
+   * Wall shear stress divided by the viscosity at the boundary quadrature points of wall_model_bc,
+   * which is computed by WallModel.
+   */
+  void
+  set_wall_model_data(
+    std::shared_ptr<ContainerInterfaceData<1, dim, double> const> interface_data) const
+  {
+    wall_model_data = interface_data;
+  }
+
+  std::shared_ptr<ContainerInterfaceData<1, dim, double> const>
+  get_wall_model_data() const
+  {
+    AssertThrow(wall_model_data.get(),
+                dealii::ExcMessage("Pointer to ContainerInterfaceData has not been initialized."));
+
+    return wall_model_data;
+  }
+
+  /*
+   * Tables of the values of the Dirichlet and Neumann boundary functions at the boundary
+   * quadrature points, see BoundaryFunctionCache. These pointers are empty if the boundary
+   * functions are evaluated directly.
+   */
+  void
+  set_function_cache(
+    std::shared_ptr<BoundaryFunctionCache<1, dim, double> const> dirichlet_cache,
+    std::shared_ptr<BoundaryFunctionCache<1, dim, double> const> neumann_cache) const
+  {
+    dirichlet_bc_cache = dirichlet_cache;
+    neumann_bc_cache   = neumann_cache;
+  }
+
+  std::shared_ptr<BoundaryFunctionCache<1, dim, double> const> const &
+  get_dirichlet_bc_cache() const
+  {
+    return dirichlet_bc_cache;
+  }
+
+  std::shared_ptr<BoundaryFunctionCache<1, dim, double> const> const &
+  get_neumann_bc_cache() const
+  {
+    return neumann_bc_cache;
+  }
+
 private:
   mutable std::shared_ptr<ContainerInterfaceData<1, dim, double> const> dirichlet_cached_data;
+
+  mutable std::shared_ptr<ContainerInterfaceData<1, dim, double> const> wall_model_data;
+
+  mutable std::shared_ptr<BoundaryFunctionCache<1, dim, double> const> dirichlet_bc_cache;
+  mutable std::shared_ptr<BoundaryFunctionCache<1, dim, double> const> neumann_bc_cache;
 };
 
 template<int dim>
@@ -233,6 +310,27 @@ struct BoundaryDescriptorP
     AssertThrow(counter == 1,
                 dealii::ExcMessage("Boundary face with non-unique boundary type found."));
   }
+
+  /*
+   * Table of the values of the Dirichlet boundary functions at the boundary quadrature points,
+   * see BoundaryFunctionCache. This pointer is empty if the boundary functions are evaluated
+   * directly.
+   */
+  void
+  set_function_cache(
+    std::shared_ptr<BoundaryFunctionCache<0, dim, double> const> dirichlet_cache) const
+  {
+    dirichlet_bc_cache = dirichlet_cache;
+  }
+
+  std::shared_ptr<BoundaryFunctionCache<0, dim, double> const> const &
+  get_dirichlet_bc_cache() const
+  {
+    return dirichlet_bc_cache;
+  }
+
+private:
+  mutable std::shared_ptr<BoundaryFunctionCache<0, dim, double> const> dirichlet_bc_cache;
 };
 
 template<int dim>
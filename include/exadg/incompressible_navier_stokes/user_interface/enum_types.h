@@ -84,7 +84,8 @@ enum class MeshMovementType
 {
   Function,
   Poisson,
-  Elasticity
+  Elasticity,
+  RadialBasisFunction
 };
 
 /**************************************************************************************/
@@ -354,12 +355,21 @@ enum class QuadratureRuleLinearization
  *
  *  use CG (conjugate gradient) method as default. FGMRES might be necessary
  *  if a Krylov method is used inside the preconditioner (e.g., as multigrid
- *  smoother or as multigrid coarse grid solver)
+ *  smoother or as multigrid coarse grid solver). PipelinedCG overlaps the
+ *  global reductions with the preconditioner and the operator, which pays off
+ *  at small numbers of unknowns per process. DeflatedCG adds a global coarse
+ *  correction with piecewise constant functions on subdomains to the
+ *  preconditioned CG method. StaticCondensation eliminates the cell interiors
+ *  of nodal DG elements and solves the system on the cell boundaries by CG with
+ *  algebraic multigrid (requires Trilinos).
  */
 enum class SolverPressurePoisson
 {
   CG,
-  FGMRES
+  PipelinedCG,
+  FGMRES,
+  DeflatedCG,
+  StaticCondensation
 };
 
 /*
@@ -398,6 +408,7 @@ enum class PreconditionerProjection
   InverseMassMatrix,
   PointJacobi,
   BlockJacobi,
+  FastDiagonalization,
   Multigrid
 };
 
@@ -414,11 +425,16 @@ enum class PreconditionerProjection
  *
  *  - FGMRES might be necessary if a Krylov method is used inside the preconditioner
  *    (e.g., as multigrid smoother or as multigrid coarse grid solver).
+ *
+ *  - PipelinedCG and LowSynchronizationGMRES reduce the cost of global reductions at small
+ *    numbers of unknowns per process.
  */
 enum class SolverMomentum
 {
   CG,
+  PipelinedCG,
   GMRES,
+  LowSynchronizationGMRES,
   FGMRES
 };
 
@@ -442,11 +458,15 @@ enum class SolverMomentum
  *
  * - FGMRES might be necessary if a Krylov method is used inside the preconditioner
  *   (e.g., as multigrid smoother or as multigrid coarse grid solver).
+ *
+ * - RecyclingFGMRES is FGMRES with a subspace recycled across time steps and Newton iterations,
+ *   which reduces the number of iterations for slowly changing systems.
  */
 enum class SolverCoupled
 {
   GMRES,
-  FGMRES
+  FGMRES,
+  RecyclingFGMRES
 };
 
 /*
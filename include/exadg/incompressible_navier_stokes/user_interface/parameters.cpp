@@ -45,6 +45,8 @@ Parameters::Parameters()
     // ALE
     ale_formulation(false),
     mesh_movement_type(MeshMovementType::Function),
+    rbf_band_width(0.0),
+    rbf_support_radius(0.0),
     neumann_with_variable_normal_vector(false),
 
     // PHYSICAL QUANTITIES
@@ -86,6 +88,17 @@ Parameters::Parameters()
     restarted_simulation(false),
     restart_data(RestartData()),
 
+    // p-sequenced startup
+    startup_degree_u(0),
+    startup_end_time(-1.),
+
+    // reduced-order model
+    use_reduced_order_model(false),
+    rom_training_end_time(-1.),
+    rom_snapshot_interval(1),
+    rom_max_modes(20),
+    rom_energy_tolerance(1.e-6),
+
     // SPATIAL DISCRETIZATION
 
     // grid
@@ -132,15 +145,26 @@ Parameters::Parameters()
     continuity_penalty_components(ContinuityPenaltyComponents::Normal),
     continuity_penalty_use_boundary_data(false),
     type_penalty_parameter(TypePenaltyParameter::ConvectiveTerm),
+    use_modal_filter(false),
+    modal_filter_strength(36.0),
+    modal_filter_order(16),
+    modal_filter_cutoff_degree(0),
 
     // VARIABLE VISCOSITY MODELS
     treatment_of_variable_viscosity(TreatmentOfVariableViscosity::Undefined),
+    store_variable_viscosity_in_reduced_precision(false),
 
     // NUMERICAL PARAMETERS
     implement_block_diagonal_preconditioner_matrix_free(false),
     use_cell_based_face_loops(false),
+    cache_boundary_functions(false),
+    parallelization(ParallelizationData()),
+    cache_diagonal_contributions_momentum(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
+    adaptive_overintegration(false),
+    adaptive_overintegration_threshold(1.0),
+    adaptive_preconditioner_update(false),
 
     // PROJECTION METHODS
 
@@ -148,7 +172,11 @@ Parameters::Parameters()
     IP_factor_pressure(1.),
     solver_pressure_poisson(SolverPressurePoisson::CG),
     solver_data_pressure_poisson(SolverData(1e4, 1.e-12, 1.e-6, 100)),
+    initial_guess_projection_size_pressure_poisson(0),
+    n_subdivisions_1d_deflation_pressure_poisson(4),
     preconditioner_pressure_poisson(PreconditionerPressurePoisson::Multigrid),
+    mixed_precision_pressure_poisson(false),
+    rel_tol_inner_mixed_precision_pressure_poisson(1.e-2),
     multigrid_data_pressure_poisson(MultigridData()),
     update_preconditioner_pressure_poisson(false),
     update_preconditioner_pressure_poisson_every_time_steps(1),
@@ -199,6 +227,7 @@ Parameters::Parameters()
     // linear solver
     solver_coupled(SolverCoupled::GMRES),
     solver_data_coupled(SolverData(1e4, 1.e-12, 1.e-6, 100)),
+    n_recycled_vectors_coupled(10),
 
     // preconditioning linear solver
     preconditioner_coupled(PreconditionerCoupled::BlockTriangular),
@@ -217,7 +246,19 @@ Parameters::Parameters()
     preconditioner_pressure_block(SchurComplementPreconditioner::PressureConvectionDiffusion),
     multigrid_data_pressure_block(MultigridData()),
     exact_inversion_of_laplace_operator(false),
-    solver_data_pressure_block(SolverData(1e4, 1.e-12, 1.e-6, 100))
+    solver_data_pressure_block(SolverData(1e4, 1.e-12, 1.e-6, 100)),
+
+    // inner solves of block preconditioner
+    adaptive_inner_tolerances(false),
+    adaptive_inner_tolerance_max(1.e-1),
+    automatic_switching_inner_solves(false),
+    switching_interval_inner_solves(10),
+
+    // pseudo-transient continuation for steady problems
+    pseudo_time_stepping_steady(false),
+    pseudo_time_step_size_initial(1.0),
+    pseudo_time_step_size_max(std::numeric_limits<double>::max()),
+    max_number_of_pseudo_time_steps(1000)
 {
 }
 
@@ -264,6 +305,23 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
       dealii::ExcMessage(
         "ALE formulation only implemented for equations that include the convective operator, "
         "e.g., ALE is currently not available for the Stokes equations."));
+
+    if(mesh_movement_type == MeshMovementType::RadialBasisFunction)
+    {
+      AssertThrow(rbf_band_width > 0.0 and rbf_support_radius > 0.0,
+                  dealii::ExcMessage("Band width and support radius of the radial basis function "
+                                     "mesh movement have to be positive."));
+    }
+  }
+
+  if(cache_boundary_functions)
+  {
+    AssertThrow(not ale_formulation,
+                dealii::ExcMessage("The cache of boundary functions is not available for moving "
+                                   "meshes."));
+    AssertThrow(not use_cell_based_face_loops,
+                dealii::ExcMessage("The cache of boundary functions is not available for "
+                                   "cell-based face loops."));
   }
 
   // PHYSICAL QUANTITIES
@@ -294,6 +352,17 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                   dealii::ExcMessage(
                     "Convective term has to be formulated implicitly when using a steady solver."));
     }
+
+    if(pseudo_time_stepping_steady)
+    {
+      AssertThrow(nonlinear_problem_has_to_be_solved(),
+                  dealii::ExcMessage(
+                    "Pseudo-time stepping is only implemented for nonlinear steady problems."));
+      AssertThrow(pseudo_time_step_size_initial > 0.0 and
+                    pseudo_time_step_size_max >= pseudo_time_step_size_initial,
+                  dealii::ExcMessage("Invalid pseudo-time step sizes."));
+      AssertThrow(max_number_of_pseudo_time_steps > 0, dealii::ExcMessage("Invalid parameter."));
+    }
   }
 
   // In case of a steady solver, the parameter temporal_discretization does not have to be
@@ -332,6 +401,46 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                   "Adaptive time stepping is only implemented for TimeStepCalculation::CFL."));
   }
 
+  if(startup_degree_u > 0)
+  {
+    AssertThrow(problem_type == ProblemType::Unsteady and
+                  temporal_discretization != TemporalDiscretization::InterpolateAnalyticalSolution,
+                dealii::ExcMessage("The p-sequenced startup requires an unsteady problem."));
+    AssertThrow(startup_degree_u < degree_u,
+                dealii::ExcMessage("The startup degree has to be smaller than degree_u."));
+    AssertThrow(startup_end_time > start_time and startup_end_time < end_time,
+                dealii::ExcMessage("The startup end time has to be within the time interval."));
+    AssertThrow(not restarted_simulation and not ale_formulation and
+                  spatial_discretization == SpatialDiscretization::L2,
+                dealii::ExcMessage("The p-sequenced startup is only implemented for L2-conforming "
+                                   "spaces on fixed meshes and without restart."));
+    AssertThrow(adaptive_time_stepping or start_with_low_order,
+                dealii::ExcMessage("The p-sequenced startup requires adaptive time stepping or "
+                                   "start_with_low_order = true, since the time step size changes "
+                                   "after the startup."));
+  }
+
+  if(use_reduced_order_model)
+  {
+    AssertThrow(problem_type == ProblemType::Unsteady and
+                  temporal_discretization != TemporalDiscretization::InterpolateAnalyticalSolution,
+                dealii::ExcMessage("The reduced-order model requires an unsteady problem."));
+    AssertThrow(rom_training_end_time > start_time and rom_training_end_time < end_time,
+                dealii::ExcMessage("The training end time has to be within the time interval."));
+    AssertThrow(rom_snapshot_interval > 0 and rom_max_modes > 0,
+                dealii::ExcMessage("Invalid parameters of the reduced-order model."));
+    AssertThrow(not ale_formulation and spatial_discretization == SpatialDiscretization::L2,
+                dealii::ExcMessage("The reduced-order model is only implemented for "
+                                   "L2-conforming spaces on fixed meshes."));
+    AssertThrow(not restart_data.write_restart,
+                dealii::ExcMessage("Restart is not implemented for the reduced-order model."));
+    AssertThrow(not viscosity_is_variable(),
+                dealii::ExcMessage("The reduced-order model requires a constant viscosity."));
+    AssertThrow(startup_degree_u == 0,
+                dealii::ExcMessage("The reduced-order model can not be combined with the "
+                                   "p-sequenced startup."));
+  }
+
   // SPATIAL DISCRETIZATION
 
   grid.check();
@@ -385,6 +494,24 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("Parameter must be defined"));
   }
 
+  if(use_modal_filter == true)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme or
+                  temporal_discretization == TemporalDiscretization::BDFPressureCorrection,
+                dealii::ExcMessage(
+                  "The modal filter is only implemented for projection-type methods."));
+
+    AssertThrow(spatial_discretization == SpatialDiscretization::L2,
+                dealii::ExcMessage("The modal filter is only implemented for L2 spaces."));
+
+    AssertThrow(modal_filter_strength >= 0.0,
+                dealii::ExcMessage("The strength of the modal filter must not be negative."));
+
+    AssertThrow(modal_filter_cutoff_degree < degree_u,
+                dealii::ExcMessage("The cutoff degree of the modal filter has to be smaller than "
+                                   "the polynomial degree of the velocity."));
+  }
+
   if(solver_type == SolverType::Steady)
   {
     if(use_divergence_penalty == true or use_continuity_penalty == true)
@@ -420,7 +547,38 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                   "Variable viscosity with multiple integration rules is not yet implemented."));
   }
 
+  if(adaptive_overintegration)
+  {
+    AssertThrow(adaptive_overintegration_threshold > 0.0,
+                dealii::ExcMessage("The threshold of the cell Reynolds number for adaptive "
+                                   "over-integration has to be positive."));
+  }
+
   // PROJECTION METHODS
+  if(solver_pressure_poisson == SolverPressurePoisson::StaticCondensation)
+  {
+    AssertThrow(preconditioner_pressure_poisson == PreconditionerPressurePoisson::None,
+                dealii::ExcMessage("The static condensation solver for the pressure Poisson "
+                                   "equation uses its own preconditioner. Set the "
+                                   "preconditioner to None."));
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("The static condensation solver for the pressure Poisson "
+                                   "equation is only implemented for hypercube elements."));
+  }
+
+  if(mixed_precision_pressure_poisson)
+  {
+    AssertThrow(preconditioner_pressure_poisson == PreconditionerPressurePoisson::Multigrid,
+                dealii::ExcMessage("Mixed precision for the pressure Poisson equation requires "
+                                   "the multigrid preconditioner."));
+    AssertThrow(solver_pressure_poisson == SolverPressurePoisson::CG or
+                  solver_pressure_poisson == SolverPressurePoisson::FGMRES,
+                dealii::ExcMessage("Mixed precision for the pressure Poisson equation is only "
+                                   "implemented for CG and FGMRES."));
+    AssertThrow(rel_tol_inner_mixed_precision_pressure_poisson < 1.0,
+                dealii::ExcMessage("The inner relative tolerance has to be smaller than 1."));
+  }
+
   if(preconditioner_momentum == MomentumPreconditioner::Multigrid)
   {
     AssertThrow(multigrid_operator_type_momentum != MultigridOperatorType::Undefined,
@@ -518,6 +676,8 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("Not implemented."));
   }
 
+  parallelization.check();
+
   // TURBULENCE
   if(turbulence_model_data.is_active)
   {
@@ -525,6 +685,19 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("Parameter must be defined."));
     AssertThrow(treatment_of_variable_viscosity != TreatmentOfVariableViscosity::Undefined,
                 dealii::ExcMessage("Parameter must be defined."));
+
+    if(turbulence_model_data.compute_viscosity_on_the_fly)
+    {
+      AssertThrow(treatment_of_variable_viscosity == TreatmentOfVariableViscosity::Explicit,
+                  dealii::ExcMessage("The on-the-fly evaluation of the turbulent viscosity "
+                                     "requires an explicit treatment of the variable viscosity."));
+      AssertThrow(not generalized_newtonian_model_data.is_active,
+                  dealii::ExcMessage("The on-the-fly evaluation of the turbulent viscosity can "
+                                     "not be combined with a generalized Newtonian model."));
+      AssertThrow(not use_cell_based_face_loops,
+                  dealii::ExcMessage("The on-the-fly evaluation of the turbulent viscosity is not "
+                                     "available for cell-based face loops."));
+    }
   }
 
   // GENERALIZED NEWTONIAN MODEL
@@ -549,6 +722,16 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                                    "not implemented for the dual splitting scheme."));
   }
 
+  // INNER SOLVES OF BLOCK PRECONDITIONER OF COUPLED SOLVER
+  if(adaptive_inner_tolerances or automatic_switching_inner_solves)
+  {
+    AssertThrow(solver_coupled == SolverCoupled::FGMRES,
+                dealii::ExcMessage("Adaptive inner solves require SolverCoupled::FGMRES."));
+    AssertThrow(exact_inversion_of_velocity_block or exact_inversion_of_laplace_operator,
+                dealii::ExcMessage("Adaptive inner solves require the exact inversion of the "
+                                   "velocity block or of the Laplace operator."));
+  }
+
   // SIMPLEX ELEMENTS
   if(grid.element_type == ElementType::Simplex)
   {
@@ -778,6 +961,11 @@ Parameters::print_parameters_mathematical_model(dealii::ConditionalOStream const
   if(ale_formulation)
   {
     print_parameter(pcout, "Mesh movement type", mesh_movement_type);
+    if(mesh_movement_type == MeshMovementType::RadialBasisFunction)
+    {
+      print_parameter(pcout, "RBF band width", rbf_band_width);
+      print_parameter(pcout, "RBF support radius", rbf_support_radius);
+    }
     print_parameter(pcout, "NBC with variable normal vector", neumann_with_variable_normal_vector);
   }
 }
@@ -856,7 +1044,12 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
   print_parameter(pcout, "Treatment of convective term", treatment_of_convective_term);
 
   if(this->viscosity_is_variable())
+  {
     print_parameter(pcout, "Treatment of nonlinear viscosity", treatment_of_variable_viscosity);
+    print_parameter(pcout,
+                    "Store viscosity in reduced precision",
+                    store_variable_viscosity_in_reduced_precision);
+  }
 
   if(problem_type == ProblemType::Steady)
   {
@@ -874,6 +1067,21 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
   // restart
   print_parameter(pcout, "Restarted simulation", restarted_simulation);
   restart_data.print(pcout);
+
+  // p-sequenced startup
+  print_parameter(pcout, "Startup degree velocity", startup_degree_u);
+  if(startup_degree_u > 0)
+    print_parameter(pcout, "Startup end time", startup_end_time);
+
+  // reduced-order model
+  print_parameter(pcout, "Use reduced-order model", use_reduced_order_model);
+  if(use_reduced_order_model)
+  {
+    print_parameter(pcout, "Training end time", rom_training_end_time);
+    print_parameter(pcout, "Snapshot interval", rom_snapshot_interval);
+    print_parameter(pcout, "Maximum number of modes", rom_max_modes);
+    print_parameter(pcout, "Energy tolerance", rom_energy_tolerance);
+  }
 }
 
 void
@@ -981,6 +1189,15 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
   {
     print_parameter(pcout, "Type of penalty parameter", type_penalty_parameter);
   }
+
+  print_parameter(pcout, "Use modal filter", use_modal_filter);
+
+  if(use_modal_filter == true)
+  {
+    print_parameter(pcout, "Modal filter strength", modal_filter_strength);
+    print_parameter(pcout, "Modal filter order", modal_filter_order);
+    print_parameter(pcout, "Modal filter cutoff degree", modal_filter_cutoff_degree);
+  }
 }
 
 void
@@ -1000,12 +1217,26 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
 
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
 
+  print_parameter(pcout, "Cache boundary functions", cache_boundary_functions);
+
+  parallelization.print(pcout);
+
+  print_parameter(pcout,
+                  "Cache diagonal contributions momentum",
+                  cache_diagonal_contributions_momentum);
+
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     solver_data_block_diagonal.print(pcout);
   }
 
   print_parameter(pcout, "Quadrature rule linearization", quad_rule_linearization);
+
+  print_parameter(pcout, "Adaptive over-integration", adaptive_overintegration);
+  if(adaptive_overintegration)
+    print_parameter(pcout, "Threshold cell Reynolds number", adaptive_overintegration_threshold);
+
+  print_parameter(pcout, "Adaptive preconditioner update", adaptive_preconditioner_update);
 }
 
 void
@@ -1020,8 +1251,28 @@ Parameters::print_parameters_pressure_poisson(dealii::ConditionalOStream const &
 
   solver_data_pressure_poisson.print(pcout);
 
+  if(solver_pressure_poisson == SolverPressurePoisson::DeflatedCG)
+  {
+    print_parameter(pcout,
+                    "Deflation (number of subdivisions 1d)",
+                    n_subdivisions_1d_deflation_pressure_poisson);
+  }
+
+  print_parameter(pcout,
+                  "Initial guess projection (number of vectors)",
+                  initial_guess_projection_size_pressure_poisson);
+
   print_parameter(pcout, "Preconditioner", preconditioner_pressure_poisson);
 
+  print_parameter(pcout, "Mixed precision", mixed_precision_pressure_poisson);
+
+  if(mixed_precision_pressure_poisson)
+  {
+    print_parameter(pcout,
+                    "Inner relative solver tolerance",
+                    rel_tol_inner_mixed_precision_pressure_poisson);
+  }
+
   print_parameter(pcout,
                   "Update preconditioner pressure step",
                   update_preconditioner_pressure_poisson);
@@ -1231,6 +1482,9 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
 
   solver_data_coupled.print(pcout);
 
+  if(solver_coupled == SolverCoupled::RecyclingFGMRES)
+    print_parameter(pcout, "Number of recycled vectors", n_recycled_vectors_coupled);
+
   print_parameter(pcout, "Preconditioner", preconditioner_coupled);
 
   print_parameter(pcout, "Update preconditioner", update_preconditioner_coupled);
@@ -1287,6 +1541,39 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
     }
   }
 
+  if(exact_inversion_of_velocity_block or exact_inversion_of_laplace_operator)
+  {
+    pcout << std::endl << "  Inner solves:" << std::endl;
+
+    print_parameter(pcout, "Adaptive inner tolerances", adaptive_inner_tolerances);
+
+    if(adaptive_inner_tolerances)
+      print_parameter(pcout, "Maximum inner tolerance", adaptive_inner_tolerance_max);
+
+    print_parameter(pcout, "Automatic switching to V-cycle", automatic_switching_inner_solves);
+
+    if(automatic_switching_inner_solves)
+      print_parameter(pcout, "Switching interval", switching_interval_inner_solves);
+  }
+
+  if(solver_type == SolverType::Steady and nonlinear_problem_has_to_be_solved())
+  {
+    pcout << std::endl << "  Steady solver:" << std::endl;
+
+    print_parameter(pcout, "Pseudo-time stepping", pseudo_time_stepping_steady);
+
+    if(pseudo_time_stepping_steady)
+    {
+      print_parameter(pcout, "Initial pseudo-time step size", pseudo_time_step_size_initial);
+      print_parameter(pcout, "Maximum pseudo-time step size", pseudo_time_step_size_max);
+      print_parameter(pcout,
+                      "Maximum number of pseudo-time steps",
+                      max_number_of_pseudo_time_steps);
+      print_parameter(pcout, "Absolute tolerance", abs_tol_steady);
+      print_parameter(pcout, "Relative tolerance", rel_tol_steady);
+    }
+  }
+
   // projection_step
   if(use_divergence_penalty == true or use_continuity_penalty == true)
   {
@@ -29,6 +29,7 @@
 #include <exadg/grid/grid_data.h>
 #include <exadg/incompressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/incompressible_navier_stokes/user_interface/viscosity_model_data.h>
+#include <exadg/matrix_free/parallelization_data.h>
 #include <exadg/operators/inverse_mass_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
@@ -178,6 +179,11 @@ public:
 
   MeshMovementType mesh_movement_type;
 
+  // MeshMovementType::RadialBasisFunction: width of the band around the interface in which the
+  // grid is deformed, and support radius of the radial basis functions
+  double rbf_band_width;
+  double rbf_support_radius;
+
   bool neumann_with_variable_normal_vector;
 
   /**************************************************************************************/
@@ -299,6 +305,27 @@ public:
   // restart
   RestartData restart_data;
 
+  // p-sequenced startup: if startup_degree_u > 0, the time interval [start_time, startup_end_time]
+  // is simulated with the polynomial degree startup_degree_u of the velocity (and the pressure
+  // degree according to degree_p). Thereafter, the solution history of the time integrator is
+  // interpolated to degree_u and the simulation continues until end_time. This allows to wash out
+  // the initial condition, e.g., for turbulent flows, at lower costs.
+  unsigned int startup_degree_u;
+  double       startup_end_time;
+
+  // POD-Galerkin reduced-order model: if enabled, the full-order model is simulated in the
+  // training interval [start_time, rom_training_end_time], where velocity snapshots are collected
+  // every rom_snapshot_interval time steps. Thereafter, a POD basis of at most rom_max_modes modes
+  // (truncated according to the relative energy rom_energy_tolerance of the discarded modes) is
+  // computed and the Galerkin reduced-order model of the velocity is integrated until end_time
+  // with the last time step size of the full-order model (explicit Runge-Kutta scheme of order 4).
+  // The pressure is not part of the reduced-order model.
+  bool         use_reduced_order_model;
+  double       rom_training_end_time;
+  unsigned int rom_snapshot_interval;
+  unsigned int rom_max_modes;
+  double       rom_energy_tolerance;
+
 
   /**************************************************************************************/
   /*                                                                                    */
@@ -406,6 +433,18 @@ public:
   // type of penalty parameter (see enum declaration for more information)
   TypePenaltyParameter type_penalty_parameter;
 
+  // Cell-local exponential filter of the modal coefficients of the velocity (see ModalFilter),
+  // applied after the last sub-step of projection methods. As an alternative to the divergence and
+  // continuity penalty terms, this stabilization does not require the solution of a (global)
+  // system of equations.
+  bool use_modal_filter;
+
+  // parameters alpha, s, and N_c of the exponential filter
+  // sigma_k = exp(-alpha ((k - N_c)/(N - N_c))^s) of the modal coefficient of degree k > N_c
+  double       modal_filter_strength;
+  unsigned int modal_filter_order;
+  unsigned int modal_filter_cutoff_degree;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                            Variable viscosity models                               */
@@ -416,6 +455,10 @@ public:
   TurbulenceModelData           turbulence_model_data;
   GeneralizedNewtonianModelData generalized_newtonian_model_data;
 
+  // Store the variable viscosity field in single precision (in the quadrature points of cells,
+  // faces, and neighbor faces) to reduce memory and memory transfer of the viscous operator.
+  bool store_variable_viscosity_in_reduced_precision;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                              NUMERICAL PARAMETERS                                  */
@@ -439,6 +482,21 @@ public:
   // can be changed to such an algorithm (cell_based_face_loops).
   bool use_cell_based_face_loops;
 
+  // Tabulate the Dirichlet and Neumann boundary functions at the quadrature points of the boundary
+  // faces once per time, instead of evaluating the functions in every operator evaluation. The
+  // boundary functions may only depend on space and time. Not available for moving meshes and
+  // cell-based face loops.
+  bool cache_boundary_functions;
+
+  // Shared-memory parallelization and overlap of communication and computation of the
+  // matrix-free loops.
+  ParallelizationData parallelization;
+
+  // Cache the contributions of the mass and viscous terms to the (block-)diagonal of the
+  // momentum operator, so that preconditioner updates after a change of the time step size only
+  // have to recompute the convective term.
+  bool cache_diagonal_contributions_momentum;
+
   // Solver data for block Jacobi preconditioner. Accordingly, this parameter is only
   // relevant if the block diagonal preconditioner is implemented in a matrix-free way
   // using an elementwise iterative solution procedure for which solver tolerances have to
@@ -462,6 +520,25 @@ public:
   // for the momentum operator.
   QuadratureRuleLinearization quad_rule_linearization;
 
+  // By default, the nonlinear convective term is integrated with the over-integration rule
+  // everywhere. If this parameter is true, the quadrature rule is chosen per cell batch based on
+  // the cell Reynolds number |u| h / (viscosity k): cell batches and their faces are only
+  // over-integrated if the cell Reynolds number exceeds adaptive_overintegration_threshold in one
+  // of the cells, i.e., in under-resolved regions where aliasing errors threaten stability.
+  // Well-resolved regions are integrated with the standard quadrature rule. The indicator is
+  // evaluated for each evaluation of the nonlinear convective term.
+  bool adaptive_overintegration;
+
+  double adaptive_overintegration_threshold;
+
+  // By default, the preconditioners of the linear solvers are updated every
+  // update_preconditioner_..._every_time_steps time steps if update_preconditioner_... is true.
+  // If this parameter is true, the fixed interval is replaced by an automatic policy for all
+  // solvers with update_preconditioner_... = true: The preconditioner is updated once the wall
+  // time spent on the additional iterations since the last update exceeds the measured cost of
+  // an update, see PreconditionerUpdatePolicy.
+  bool adaptive_preconditioner_update;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                 Solver parameters for mass matrix problem                          */
@@ -512,9 +589,26 @@ public:
   // solver data for pressure Poisson equation
   SolverData solver_data_pressure_poisson;
 
+  // Number of previous pressure solutions used to compute the initial guess of the pressure
+  // Poisson solver by projection, see InitialGuessProjection. The extrapolated initial guess of
+  // the time integrator is used if this number is zero.
+  unsigned int initial_guess_projection_size_pressure_poisson;
+
+  // Number of subdivisions per coordinate direction of the bounding box of the mesh, defining the
+  // subdomains of the piecewise constant coarse space of SolverPressurePoisson::DeflatedCG.
+  unsigned int n_subdivisions_1d_deflation_pressure_poisson;
+
   // description: see enum declaration
   PreconditionerPressurePoisson preconditioner_pressure_poisson;
 
+  // Mixed-precision iterative refinement for the pressure Poisson equation: the Krylov solver
+  // (operator, multigrid preconditioner, and vectors) runs in the precision of the multigrid
+  // levels up to the relative tolerance rel_tol_inner_mixed_precision_pressure_poisson, and the
+  // residual is corrected in outer iterations in the precision of the solver until
+  // solver_data_pressure_poisson is satisfied.
+  bool   mixed_precision_pressure_poisson;
+  double rel_tol_inner_mixed_precision_pressure_poisson;
+
   // update of preconditioner for this equation is currently not provided and not needed
 
   // description: see declaration of MultigridData
@@ -649,6 +743,9 @@ public:
   // Solver data for coupled solver
   SolverData solver_data_coupled;
 
+  // Dimension of the recycled subspace of SolverCoupled::RecyclingFGMRES
+  unsigned int n_recycled_vectors_coupled;
+
   // description: see enum declaration
   PreconditionerCoupled preconditioner_coupled;
 
@@ -695,6 +792,43 @@ public:
   // solver data for Schur complement
   // (only relevant if exact_inversion_of_laplace_operator == true)
   SolverData solver_data_pressure_block;
+
+  // Inexact inner solves with adaptive relative tolerances (only relevant for
+  // SolverCoupled::FGMRES and if exact_inversion_of_velocity_block == true and/or
+  // exact_inversion_of_laplace_operator == true). The relative tolerance of the inner solves is
+  // relaxed as the relative residual rho of the outer solver decreases,
+  //   rel_tol_inner = min(max(rel_tol_outer / rho, rel_tol_block), adaptive_inner_tolerance_max),
+  // where rel_tol_block is the relative tolerance specified in solver_data_velocity_block or
+  // solver_data_pressure_block.
+  bool adaptive_inner_tolerances;
+
+  double adaptive_inner_tolerance_max;
+
+  // Switch automatically between the inner solves and a single multigrid V-cycle for the blocks
+  // that are inverted exactly, depending on the measured wall time of the outer solves (only
+  // relevant for SolverCoupled::FGMRES). Every switching_interval_inner_solves linear solves, the
+  // alternative is tried for one solve and kept if it was faster.
+  bool automatic_switching_inner_solves;
+
+  unsigned int switching_interval_inner_solves;
+
+  // Pseudo-transient continuation for nonlinear steady problems (only relevant for
+  // SolverType::Steady): Instead of applying the Newton solver to the steady equations directly,
+  // implicit Euler steps with the pseudo-time step size dtau are performed, each solved by the
+  // Newton solver with newton_solver_data_coupled (typically a single Newton iteration), until
+  // the residual of the steady equations is below abs_tol_steady or has been reduced by
+  // rel_tol_steady. The pseudo-time step size starts at pseudo_time_step_size_initial and is
+  // adapted by switched evolution relaxation, dtau_{k+1} = dtau_k * |R_{k-1}| / |R_k|, up to
+  // pseudo_time_step_size_max, i.e., the method approaches Newton's method as the residual
+  // decreases. The mass operator in the preconditioners depends on dtau, so that
+  // update_preconditioner_coupled = true is recommended.
+  bool pseudo_time_stepping_steady;
+
+  double pseudo_time_step_size_initial;
+
+  double pseudo_time_step_size_max;
+
+  unsigned int max_number_of_pseudo_time_steps;
 };
 
 } // namespace IncNS
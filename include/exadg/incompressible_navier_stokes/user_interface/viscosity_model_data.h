@@ -57,6 +57,10 @@ struct TurbulenceModelData
   bool                         is_active{false};
   double                       constant{0.0}; // model constant
 
+  // compute the turbulent viscosity from the velocity gradient inside the viscous kernel instead of
+  // storing it in the quadrature points of all cells and faces
+  bool compute_viscosity_on_the_fly{false};
+
   void
   check() const
   {
@@ -75,6 +79,7 @@ struct TurbulenceModelData
     {
       print_parameter(pcout, "Turbulence model", turbulence_model);
       print_parameter(pcout, "Turbulence model constant", constant);
+      print_parameter(pcout, "Compute viscosity on the fly", compute_viscosity_on_the_fly);
     }
   }
 };
@@ -105,12 +110,25 @@ struct GeneralizedNewtonianModelData
   double a{0.0};
   double n{0.0};
 
+  // evaluate the power functions of the model with the vectorized approximations of
+  // VectorizedMath instead of std::pow, which loops over the lanes of the VectorizedArray
+  bool use_vectorized_approximation{false};
+
+  // tolerance of the truncation error of the vectorized approximations
+  double approximation_tolerance{1.e-12};
+
   void
   check() const
   {
     AssertThrow(is_active, dealii::ExcMessage("Generalized Newtonian model is inactive."));
     AssertThrow(generalized_newtonian_model != GeneralizedNewtonianViscosityModel::Undefined,
                 dealii::ExcMessage("GenerelizedNewtonianViscosityModel not defined."));
+    if(use_vectorized_approximation)
+    {
+      AssertThrow(approximation_tolerance > 0.0,
+                  dealii::ExcMessage("Tolerance of the vectorized approximation has to be "
+                                     "positive."));
+    }
   }
 
   void
@@ -128,6 +146,9 @@ struct GeneralizedNewtonianModelData
       print_parameter(pcout, "parameter lambda", lambda);
       print_parameter(pcout, "parameter a", a);
       print_parameter(pcout, "parameter n", n);
+      print_parameter(pcout, "Use vectorized approximation", use_vectorized_approximation);
+      if(use_vectorized_approximation)
+        print_parameter(pcout, "Approximation tolerance", approximation_tolerance);
     }
   }
 };
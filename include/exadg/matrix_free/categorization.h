@@ -35,6 +35,12 @@ namespace Categorization
  *      same category
  *   2) cell based loops are enabled (incl. dealii::FEEvaluationBase::read_cell_data()
  *      for all neighboring cells)
+ *
+ * On locally refined meshes, faces with hanging nodes are treated as a separate type of face in
+ * addition to interior faces and boundary IDs. Hence, all cells of a cell batch have hanging
+ * faces at the same local face numbers, which allows the cell-based face loops to treat the faces
+ * of a cell batch uniformly. This is only supported for the active level, i.e., not for local
+ * smoothing multigrid levels.
  */
 template<int dim, typename AdditionalData>
 void
@@ -53,8 +59,9 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
   AssertThrow(tria.get_reference_cells().size() == 1,
               dealii::ExcMessage("No mixed meshes allowed."));
 
-  AssertThrow(not tria.has_hanging_nodes(),
-              dealii::ExcMessage("Cell based face loops do not support locally refined meshes."));
+  AssertThrow(not(is_mg and tria.has_hanging_nodes()),
+              dealii::ExcMessage("Cell based face loops do not support locally refined meshes "
+                                 "on multigrid levels."));
 
   unsigned int const n_faces_per_cell = tria.get_reference_cells()[0].n_faces();
 
@@ -65,8 +72,11 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
   for(unsigned int i = 0; i < tria.get_boundary_ids().size(); i++)
     bid_map[tria.get_boundary_ids()[i]] = i + 1;
 
+  // category of faces with hanging nodes (after interior faces and all boundary IDs)
+  unsigned int const hanging_face_category = tria.get_boundary_ids().size() + 1;
+
   {
-    unsigned int bids   = tria.get_boundary_ids().size() + 1;
+    unsigned int bids   = tria.get_boundary_ids().size() + 2;
     int          offset = 1;
     for(unsigned int i = 0; i < n_faces_per_cell; i++, offset = offset * bids)
       factors[i] = offset;
@@ -79,6 +89,8 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
       const auto face = *cell->face(i);
       if(face.at_boundary())
         c_num += factors[i] * bid_map[face.boundary_id()];
+      else if(not is_mg and (cell->neighbor_is_coarser(i) or face.has_children()))
+        c_num += factors[i] * hanging_face_category;
     }
     return c_num;
   };
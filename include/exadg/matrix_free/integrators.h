@@ -22,9 +22,21 @@
 #ifndef INCLUDE_EXADG_MATRIX_FREE_INTEGRATORS_H_
 #define INCLUDE_EXADG_MATRIX_FREE_INTEGRATORS_H_
 
+// C++
+#include <type_traits>
+
 // deal.II
 #include <deal.II/base/config.h>
 #include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// Maximum polynomial degree for which integrators with compile-time polynomial degree are
+// instantiated, see ExaDG::expand_fixed_degree(). In addition to n_q_points_1d = degree + 1, the
+// over-integration n_q_points_1d = degree + (degree + 2) / 2 is instantiated if
+// EXADG_FIXED_DEGREE_OVERINTEGRATION is defined, which doubles the number of instantiations.
+#ifndef EXADG_FIXED_DEGREE_MAX
+#  define EXADG_FIXED_DEGREE_MAX 10
+#endif
 
 template<int dim,
          int n_components,
@@ -39,4 +51,108 @@ template<int dim,
 using FaceIntegrator =
   dealii::FEFaceEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>;
 
+/*
+ * Integrators with polynomial degree and number of 1D quadrature points known at compile time.
+ * For these types, deal.II selects sum-factorization kernels specialized for the given degree,
+ * which make use of the even-odd decomposition of the 1D shape matrices and which switch to the
+ * collocation basis if the quadrature points coincide with the nodes of the shape functions.
+ */
+template<int dim,
+         int degree,
+         int n_q_points_1d,
+         int n_components,
+         typename Number,
+         typename VectorizedArrayType = dealii::VectorizedArray<Number>>
+using CellIntegratorFixedDegree =
+  dealii::FEEvaluation<dim, degree, n_q_points_1d, n_components, Number, VectorizedArrayType>;
+
+template<int dim,
+         int degree,
+         int n_q_points_1d,
+         int n_components,
+         typename Number,
+         typename VectorizedArrayType = dealii::VectorizedArray<Number>>
+using FaceIntegratorFixedDegree =
+  dealii::FEFaceEvaluation<dim, degree, n_q_points_1d, n_components, Number, VectorizedArrayType>;
+
+namespace ExaDG
+{
+namespace internal
+{
+template<int degree, typename Lambda>
+bool
+expand_fixed_degree(unsigned int const runtime_degree,
+                    unsigned int const runtime_n_q_points_1d,
+                    Lambda const &     lambda)
+{
+  if constexpr(degree > EXADG_FIXED_DEGREE_MAX)
+  {
+    (void)runtime_degree;
+    (void)runtime_n_q_points_1d;
+    (void)lambda;
+
+    return false;
+  }
+  else
+  {
+    if(runtime_degree == degree)
+    {
+      if(runtime_n_q_points_1d == degree + 1)
+      {
+        lambda(std::integral_constant<int, degree>(), std::integral_constant<int, degree + 1>());
+
+        return true;
+      }
+
+#ifdef EXADG_FIXED_DEGREE_OVERINTEGRATION
+      // over-integration according to the 3/2-rule, e.g. for the convective term
+      if(runtime_n_q_points_1d == degree + (degree + 2) / 2)
+      {
+        lambda(std::integral_constant<int, degree>(),
+               std::integral_constant<int, degree + (degree + 2) / 2>());
+
+        return true;
+      }
+#endif
+
+      return false;
+    }
+
+    return expand_fixed_degree<degree + 1>(runtime_degree, runtime_n_q_points_1d, lambda);
+  }
+}
+} // namespace internal
+
+/*
+ * Translates the runtime polynomial degree and number of 1D quadrature points of the given
+ * dof_index/quad_index into compile-time constants and calls
+ *
+ *   lambda(std::integral_constant<int, degree>, std::integral_constant<int, n_q_points_1d>)
+ *
+ * to allow the use of CellIntegratorFixedDegree/FaceIntegratorFixedDegree. Instantiations are
+ * available for hypercube elements with n_q_points_1d = degree + 1 (and n_q_points_1d = degree +
+ * (degree + 2) / 2 if EXADG_FIXED_DEGREE_OVERINTEGRATION is defined) and 1 <= degree <=
+ * EXADG_FIXED_DEGREE_MAX. Returns false (without calling the lambda) if no instantiation is
+ * available, in which case the caller has to fall back to the integrators with runtime degree.
+ */
+template<int dim, typename Number, typename Lambda>
+bool
+expand_fixed_degree(dealii::MatrixFree<dim, Number> const & matrix_free,
+                    unsigned int const                      dof_index,
+                    unsigned int const                      quad_index,
+                    Lambda const &                          lambda)
+{
+  if(not matrix_free.get_dof_handler(dof_index)
+           .get_triangulation()
+           .all_reference_cells_are_hyper_cube())
+    return false;
+
+  auto const & shape_info = matrix_free.get_shape_info(dof_index, quad_index);
+
+  return internal::expand_fixed_degree<1>(shape_info.data[0].fe_degree,
+                                          shape_info.data[0].n_q_points_1d,
+                                          lambda);
+}
+} // namespace ExaDG
+
 #endif
@@ -0,0 +1,167 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_PARALLELIZATION_DATA_H_
+#define INCLUDE_EXADG_MATRIX_FREE_PARALLELIZATION_DATA_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+#include <exadg/utilities/shared_memory_communicator.h>
+#include <exadg/utilities/thread_affinity.h>
+
+namespace ExaDG
+{
+/*
+ * Shared-memory parallelization of the matrix-free loops, see
+ * dealii::MatrixFree::AdditionalData::TasksParallelScheme. Schemes other than None require
+ * deal.II to be configured with TBB and are used in hybrid MPI + threads runs.
+ */
+enum class TaskParallelScheme
+{
+  None,
+  PartitionPartition,
+  PartitionColor,
+  Color
+};
+
+struct ParallelizationData
+{
+  ParallelizationData()
+    : task_parallel_scheme(TaskParallelScheme::None),
+      overlap_communication_computation(true),
+      tasks_block_size(0),
+      n_threads(1),
+      pin_threads(false),
+      use_shared_memory_communicator(false)
+  {
+  }
+
+  void
+  check() const
+  {
+#ifndef DEAL_II_WITH_TBB
+    AssertThrow(task_parallel_scheme == TaskParallelScheme::None,
+                dealii::ExcMessage("Task-parallel matrix-free loops require deal.II with TBB."));
+    AssertThrow(n_threads == 1 and not(pin_threads),
+                dealii::ExcMessage("Multi-threading requires deal.II with TBB."));
+#endif
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Task parallel scheme", task_parallel_scheme);
+    if(task_parallel_scheme != TaskParallelScheme::None and tasks_block_size > 0)
+      print_parameter(pcout, "Tasks block size", tasks_block_size);
+    print_parameter(pcout, "Overlap communication/computation", overlap_communication_computation);
+    if(n_threads > 0)
+      print_parameter(pcout, "Number of threads per process", n_threads);
+    else
+      print_parameter(pcout, "Number of threads per process", "all cores");
+    print_parameter(pcout, "Pin threads", pin_threads);
+    print_parameter(pcout, "Use shared-memory communicator", use_shared_memory_communicator);
+  }
+
+  /*
+   * Sets the number of threads of this process and pins the threads if requested. Has to be
+   * called before the setup of the MatrixFree objects and the allocation of the vectors, since
+   * the threads touching memory first determine the NUMA domain the memory is placed on, and
+   * deal.II touches the MatrixFree data and the vectors with the threads available at that time.
+   */
+  void
+  setup_threads() const
+  {
+    unsigned int const max_threads =
+      n_threads > 0 ? n_threads : dealii::numbers::invalid_unsigned_int;
+    dealii::MultithreadInfo::set_thread_limit(max_threads);
+
+    if(pin_threads)
+      ExaDG::pin_threads();
+  }
+
+  /*
+   * Enables the shared-memory communication between the processes on the same compute node for
+   * all MatrixFree objects set up subsequently, see SharedMemoryCommunicator. Has to be called
+   * before the setup of the MatrixFree objects.
+   */
+  void
+  setup_shared_memory_communicator() const
+  {
+    SharedMemoryCommunicator::enable(use_shared_memory_communicator);
+  }
+
+  /*
+   * Writes the parameters into the data structure used to initialize dealii::MatrixFree.
+   */
+  template<typename AdditionalData>
+  void
+  fill_additional_data(AdditionalData & data, MPI_Comm const & mpi_comm) const
+  {
+    if(task_parallel_scheme == TaskParallelScheme::None)
+      data.tasks_parallel_scheme = AdditionalData::none;
+    else if(task_parallel_scheme == TaskParallelScheme::PartitionPartition)
+      data.tasks_parallel_scheme = AdditionalData::partition_partition;
+    else if(task_parallel_scheme == TaskParallelScheme::PartitionColor)
+      data.tasks_parallel_scheme = AdditionalData::partition_color;
+    else if(task_parallel_scheme == TaskParallelScheme::Color)
+      data.tasks_parallel_scheme = AdditionalData::color;
+    else
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+
+    // zero means that deal.II chooses the block size
+    if(tasks_block_size > 0)
+      data.tasks_block_size = tasks_block_size;
+
+    // Start the ghost exchange of the src vector before the loop, work on cells and faces that do
+    // not depend on ghost data while the messages are in flight, and complete the exchange only
+    // before the cells/faces at processor boundaries are processed.
+    data.overlap_communication_computation = overlap_communication_computation;
+
+    SharedMemoryCommunicator::fill_additional_data(data, mpi_comm);
+  }
+
+  TaskParallelScheme task_parallel_scheme;
+
+  bool overlap_communication_computation;
+
+  unsigned int tasks_block_size;
+
+  // number of threads per MPI process, where 0 means that all cores available to the process are
+  // used
+  unsigned int n_threads;
+
+  // pin the threads to the cores available to the process, such that the memory first touched by
+  // a thread remains on the NUMA domain of the thread
+  bool pin_threads;
+
+  // allocate the vectors in shared-memory windows of the processes on the same compute node, such
+  // that the ghost values of on-node neighbors are read directly (MPI-3 shared memory)
+  bool use_shared_memory_communicator;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_PARALLELIZATION_DATA_H_ */
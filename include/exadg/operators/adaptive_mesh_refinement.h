@@ -25,25 +25,49 @@
 #ifndef INCLUDE_EXADG_OPERATORS_ADAPTIVE_MESH_REFINEMENT_H_
 #define INCLUDE_EXADG_OPERATORS_ADAPTIVE_MESH_REFINEMENT_H_
 
+// C/C++
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
 // deal.II
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/distributed/grid_refinement.h>
 #include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/grid/grid_refinement.h>
+#include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/numerics/error_estimator.h>
 #include <deal.II/numerics/solution_transfer.h>
 
 // ExaDG
+#include <exadg/matrix_free/integrators.h>
 #include <exadg/utilities/print_functions.h>
 
 
 namespace ExaDG
 {
+/*
+ * Refinement indicator used to mark cells for refinement and coarsening:
+ *
+ *  - KellyErrorEstimator: dealii::KellyErrorEstimator evaluated with dealii::FEFaceValues
+ *  - GradientJump: the same jump of the normal derivative across interior faces as the Kelly
+ *    error estimator, but computed with the MatrixFree face integrators of the PDE operator, i.e.
+ *    at the cost of a single face loop of an operator evaluation
+ */
+enum class RefinementIndicator
+{
+  KellyErrorEstimator,
+  GradientJump
+};
+
 struct AdaptiveMeshRefinementData
 {
   AdaptiveMeshRefinementData()
-    : trigger_every_n_time_steps(1),
+    : refinement_indicator(RefinementIndicator::KellyErrorEstimator),
+      trigger_every_n_time_steps(1),
       maximum_refinement_level(10),
       minimum_refinement_level(0),
       preserve_boundary_cells(false),
@@ -56,6 +80,7 @@ struct AdaptiveMeshRefinementData
   print(dealii::ConditionalOStream const & pcout) const
   {
     print_parameter(pcout, "Enable adaptivity", true);
+    print_parameter(pcout, "Refinement indicator", refinement_indicator);
     print_parameter(pcout, "Triggered every n time steps", trigger_every_n_time_steps);
     print_parameter(pcout, "Maximum refinement level", maximum_refinement_level);
     print_parameter(pcout, "Minimum refinement level", minimum_refinement_level);
@@ -64,6 +89,8 @@ struct AdaptiveMeshRefinementData
     print_parameter(pcout, "Fraction of cells to be coarsened", fraction_of_cells_to_be_coarsened);
   }
 
+  RefinementIndicator refinement_indicator;
+
   unsigned int trigger_every_n_time_steps;
 
   int  maximum_refinement_level;
@@ -182,6 +209,129 @@ mark_cells_kelly_error_estimator(dealii::Triangulation<dim> &              tria,
     amr_data.fraction_of_cells_to_be_coarsened);
 }
 
+/**
+ * Computes the refinement indicator RefinementIndicator::GradientJump for a scalar solution
+ *
+ *   eta_K^2 = sum_{F in faces of K} h_F / 24 int_F [grad(u) * n]^2 dF,
+ *
+ * with the jump [.] across interior faces (boundary faces do not contribute), which coincides with
+ * dealii::KellyErrorEstimator without Neumann data. The face integrals are evaluated with the
+ * MatrixFree face integrators for the given dof_index and quad_index. Since every interior face is
+ * visited by one process only, the contributions to cells owned by other processes are sent to
+ * their owners. The MatrixFree object needs to provide data on interior faces, as is the case for
+ * discontinuous Galerkin discretizations. The result is indexed by the active cell index of the
+ * triangulation.
+ */
+template<int dim, typename Number, typename VectorType>
+dealii::Vector<float>
+compute_gradient_jump_indicator(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                unsigned int const                      dof_index,
+                                unsigned int const                      quad_index,
+                                VectorType const &                      solution)
+{
+  typedef FaceIntegrator<dim, 1, Number> IntegratorFace;
+
+  dealii::Triangulation<dim> const & tria =
+    matrix_free.get_dof_handler(dof_index).get_triangulation();
+
+  dealii::Vector<float> indicator(tria.n_active_cells());
+
+  // contributions to cells owned by other processes, sorted by the owner
+  std::map<unsigned int, std::vector<std::pair<dealii::types::global_cell_index, double>>>
+    remote_contributions;
+
+  auto const add_contribution = [&](typename dealii::DoFHandler<dim>::cell_iterator const & cell,
+                                    double const                                            value) {
+    if(cell->is_locally_owned())
+      indicator[cell->active_cell_index()] += value;
+    else
+      remote_contributions[cell->subdomain_id()].emplace_back(cell->global_active_cell_index(),
+                                                              value);
+  };
+
+  bool const has_ghost_elements = solution.has_ghost_elements();
+  if(not has_ghost_elements)
+    solution.update_ghost_values();
+
+  IntegratorFace integrator_m(matrix_free, true, dof_index, quad_index);
+  IntegratorFace integrator_p(matrix_free, false, dof_index, quad_index);
+
+  for(unsigned int face = 0; face < matrix_free.n_inner_face_batches(); ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_p.reinit(face);
+    integrator_m.gather_evaluate(solution, dealii::EvaluationFlags::gradients);
+    integrator_p.gather_evaluate(solution, dealii::EvaluationFlags::gradients);
+
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      dealii::VectorizedArray<Number> const jump =
+        integrator_m.get_normal_derivative(q) - integrator_p.get_normal_derivative(q);
+      integrator_m.submit_value(jump * jump, q);
+    }
+
+    dealii::VectorizedArray<Number> const jump_squared = integrator_m.integrate_value();
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      auto const cell_and_face_m = matrix_free.get_face_iterator(face, v, true);
+      auto const cell_and_face_p = matrix_free.get_face_iterator(face, v, false);
+
+      double const value =
+        cell_and_face_m.first->face(cell_and_face_m.second)->diameter() / 24.0 * jump_squared[v];
+
+      add_contribution(cell_and_face_m.first, value);
+      add_contribution(cell_and_face_p.first, value);
+    }
+  }
+
+  if(not has_ghost_elements)
+    solution.zero_out_ghost_values();
+
+  // receive the contributions of other processes to the locally owned cells
+  auto const received_contributions =
+    dealii::Utilities::MPI::some_to_some(tria.get_communicator(), remote_contributions);
+
+  if(not received_contributions.empty())
+  {
+    std::map<dealii::types::global_cell_index, unsigned int> global_to_local_cell_index;
+    for(auto const & cell : tria.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+        global_to_local_cell_index[cell->global_active_cell_index()] = cell->active_cell_index();
+    }
+
+    for(auto const & it : received_contributions)
+    {
+      for(auto const & contribution : it.second)
+        indicator[global_to_local_cell_index.at(contribution.first)] += contribution.second;
+    }
+  }
+
+  for(auto & value : indicator)
+    value = std::sqrt(value);
+
+  return indicator;
+}
+
+template<int dim, typename Number, typename VectorType>
+void
+mark_cells_gradient_jump_indicator(dealii::Triangulation<dim> &            tria,
+                                   dealii::MatrixFree<dim, Number> const & matrix_free,
+                                   unsigned int const                      dof_index,
+                                   unsigned int const                      quad_index,
+                                   VectorType const &                      solution,
+                                   AdaptiveMeshRefinementData const &      amr_data)
+{
+  dealii::Vector<float> const indicator =
+    compute_gradient_jump_indicator(matrix_free, dof_index, quad_index, solution);
+
+  dealii::parallel::distributed::GridRefinement::refine_and_coarsen_fixed_number(
+    tria,
+    indicator,
+    amr_data.fraction_of_cells_to_be_refined,
+    amr_data.fraction_of_cells_to_be_coarsened);
+}
 
 } // namespace ExaDG
 
@@ -0,0 +1,253 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_DENSE_SIMPLEX_KERNEL_H_
+#define INCLUDE_EXADG_OPERATORS_DENSE_SIMPLEX_KERNEL_H_
+
+// C++
+#include <algorithm>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+/*
+ * Cell integrals on affine simplex cells computed with dense matrices of the reference cell. Sum
+ * factorization is not applicable to simplex elements, but for affine cells the element matrices
+ * of the mass and Laplace operators are linear combinations of reference matrices with cell-wise
+ * constant geometry factors. Since a cell batch holds the dof values of several cells in
+ * VectorizedArray lanes, applying a reference matrix to a cell batch is a small dense
+ * matrix-matrix product.
+ *
+ * The reference matrices are computed for the scalar base element, i.e., all components are
+ * treated with the same matrices. Cells that are not affine have to be treated by the standard
+ * evaluation path, see function cell_is_affine().
+ */
+template<int dim, typename Number>
+class DenseSimplexKernel
+{
+private:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  typedef dealii::SymmetricTensor<2, dim, scalar> symmetric_tensor;
+
+public:
+  DenseSimplexKernel() : n_dofs(0), weight_first_q_point(1.0), active(false)
+  {
+  }
+
+  /*
+   * Computes the reference matrices. The kernel is only activated for pure simplex meshes with
+   * elements composed of a single base element.
+   */
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
+         unsigned int const                      dof_index,
+         unsigned int const                      quad_index)
+  {
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free.get_dof_handler(dof_index);
+
+    active = dof_handler.get_triangulation().all_reference_cells_are_simplex() and
+             dof_handler.get_fe().n_base_elements() == 1;
+
+    if(not active)
+      return;
+
+    dealii::FiniteElement<dim> const & fe         = dof_handler.get_fe().base_element(0);
+    dealii::Quadrature<dim> const &    quadrature = matrix_free.get_quadrature(quad_index);
+
+    n_dofs               = fe.n_dofs_per_cell();
+    weight_first_q_point = quadrature.weight(0);
+
+    mass_matrix.assign(n_dofs * n_dofs, 0.0);
+    stiffness_matrices.assign(n_stiffness_matrices * n_dofs * n_dofs, 0.0);
+
+    for(unsigned int q = 0; q < quadrature.size(); ++q)
+    {
+      dealii::Point<dim> const & point  = quadrature.point(q);
+      double const               weight = quadrature.weight(q);
+
+      for(unsigned int i = 0; i < n_dofs; ++i)
+      {
+        double const                 value_i    = fe.shape_value(i, point);
+        dealii::Tensor<1, dim> const gradient_i = fe.shape_grad(i, point);
+
+        for(unsigned int j = 0; j < n_dofs; ++j)
+        {
+          double const                 value_j    = fe.shape_value(j, point);
+          dealii::Tensor<1, dim> const gradient_j = fe.shape_grad(j, point);
+
+          mass_matrix[i * n_dofs + j] += weight * value_i * value_j;
+
+          // Only the symmetric part of the coefficient tensor is used, so that the off-diagonal
+          // blocks K^{de} and K^{ed} can be summed up.
+          unsigned int index = 0;
+          for(unsigned int d = 0; d < dim; ++d)
+          {
+            for(unsigned int e = d; e < dim; ++e, ++index)
+            {
+              double entry = gradient_i[d] * gradient_j[e];
+              if(e != d)
+                entry += gradient_i[e] * gradient_j[d];
+
+              stiffness_matrices[(index * n_dofs + i) * n_dofs + j] += weight * entry;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  bool
+  is_active() const
+  {
+    return active;
+  }
+
+  static bool
+  cell_is_affine(dealii::MatrixFree<dim, Number> const & matrix_free, unsigned int const cell)
+  {
+    return matrix_free.get_mapping_info().get_cell_type(cell) <=
+           dealii::internal::MatrixFreeFunctions::affine;
+  }
+
+  /*
+   * Determinant of the Jacobian of an affine cell batch.
+   */
+  template<typename Integrator>
+  scalar
+  get_determinant(Integrator const & integrator) const
+  {
+    return integrator.JxW(0) / weight_first_q_point;
+  }
+
+  /*
+   * Coefficient J^{-1} J^{-T} det(J) of an affine cell batch, i.e. the geometry contribution of
+   * the term (grad(v), grad(u)) written in reference coordinates.
+   */
+  template<typename Integrator>
+  symmetric_tensor
+  get_laplace_coefficient(Integrator const & integrator) const
+  {
+    // inverse_jacobian() returns the inverse and transposed Jacobian J^{-T}
+    dealii::Tensor<2, dim, scalar> const inv_jac_transposed = integrator.inverse_jacobian(0);
+    scalar const                         determinant        = get_determinant(integrator);
+
+    symmetric_tensor coefficient;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      for(unsigned int e = d; e < dim; ++e)
+      {
+        scalar sum = inv_jac_transposed[0][d] * inv_jac_transposed[0][e];
+        for(unsigned int k = 1; k < dim; ++k)
+          sum += inv_jac_transposed[k][d] * inv_jac_transposed[k][e];
+        coefficient[d][e] = sum * determinant;
+      }
+    }
+
+    return coefficient;
+  }
+
+  /*
+   * Computes dst = factor * M src, where M is the reference mass matrix. The arrays hold the dof
+   * values of all components in the layout of FEEvaluation::begin_dof_values().
+   */
+  void
+  apply_mass(scalar const *     src,
+             scalar *           dst,
+             scalar const &     factor,
+             unsigned int const n_components) const
+  {
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      std::fill(dst + c * n_dofs,
+                dst + (c + 1) * n_dofs,
+                dealii::make_vectorized_array<Number>(0.0));
+      matrix_vector_add(mass_matrix.data(), src + c * n_dofs, dst + c * n_dofs, factor);
+    }
+  }
+
+  /*
+   * Computes dst = sum_{d,e} C_de K^{de} src with the coefficient C obtained from
+   * get_laplace_coefficient() and the reference stiffness matrices K^{de}. See function
+   * apply_mass() for the layout of src and dst.
+   */
+  void
+  apply_laplace(scalar const *           src,
+                scalar *                 dst,
+                symmetric_tensor const & coefficient,
+                unsigned int const       n_components) const
+  {
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      std::fill(dst + c * n_dofs,
+                dst + (c + 1) * n_dofs,
+                dealii::make_vectorized_array<Number>(0.0));
+
+      unsigned int index = 0;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        for(unsigned int e = d; e < dim; ++e, ++index)
+        {
+          matrix_vector_add(stiffness_matrices.data() + index * n_dofs * n_dofs,
+                            src + c * n_dofs,
+                            dst + c * n_dofs,
+                            coefficient[d][e]);
+        }
+      }
+    }
+  }
+
+private:
+  static unsigned int const n_stiffness_matrices = dim * (dim + 1) / 2;
+
+  void
+  matrix_vector_add(Number const * matrix,
+                    scalar const * src,
+                    scalar *       dst,
+                    scalar const & factor) const
+  {
+    for(unsigned int i = 0; i < n_dofs; ++i)
+    {
+      scalar sum = matrix[i * n_dofs] * src[0];
+      for(unsigned int j = 1; j < n_dofs; ++j)
+        sum += matrix[i * n_dofs + j] * src[j];
+      dst[i] += factor * sum;
+    }
+  }
+
+  unsigned int n_dofs;
+
+  double weight_first_q_point;
+
+  bool active;
+
+  // row-major reference matrices of the scalar base element
+  std::vector<Number> mass_matrix;
+  std::vector<Number> stiffness_matrices;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_DENSE_SIMPLEX_KERNEL_H_ */
@@ -0,0 +1,465 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_FAST_DIAGONALIZATION_KERNEL_H_
+#define INCLUDE_EXADG_OPERATORS_FAST_DIAGONALIZATION_KERNEL_H_
+
+// C++
+#include <array>
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/table.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/interior_penalty_parameter.h>
+
+namespace ExaDG
+{
+/*
+ * Coefficients of the separable approximation
+ *
+ *   A_cell ≈ mass_factor * M_cell + laplace_factor * L_cell
+ *
+ * of a cell block, where M_cell is the mass matrix and L_cell the symmetric interior penalty
+ * discretization of the (negative) Laplacian with penalty factor IP_factor.
+ */
+struct FastDiagonalizationCoefficients
+{
+  FastDiagonalizationCoefficients() : mass_factor(0.0), laplace_factor(0.0), IP_factor(1.0)
+  {
+  }
+
+  double mass_factor;
+  double laplace_factor;
+  double IP_factor;
+};
+
+/*
+ * Inverse of the cell blocks of mass-like and Laplace-like DG operators on hypercube meshes by the
+ * fast diagonalization method: For each cell batch, the cell is approximated by a box with the
+ * extent h_d in direction d computed from the Jacobian, and the cell block by the tensor-product
+ * operator
+ *
+ *   sum_d M_1 x ... x A_d x ... x M_dim,  A_d = laplace_factor * L_d + mass_factor / dim * M_d,
+ *
+ * with the 1D mass matrices M_d and the 1D interior penalty Laplace matrices L_d, where the
+ * neighbor contributions are neglected as in a block Jacobi method. The inverse is then applied
+ * via the 1D generalized eigenvalue decompositions, see dealii::TensorProductMatrixSymmetricSum,
+ * at O(k^{d+1}) operations and O(k^2) memory per cell instead of O(k^{2d}) for dense LU factors.
+ *
+ * In reinit(), the matrices are set up for the scalar base element, i.e., all components are
+ * treated with the same matrices, while reinit_penalty() and reinit_elasticity() set up one block
+ * per component. The approximation is exact for Cartesian cells and constant coefficients.
+ */
+template<int dim, typename Number>
+class FastDiagonalizationKernel
+{
+private:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  typedef dealii::TensorProductMatrixSymmetricSum<dim, scalar> TensorProductMatrix;
+
+public:
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
+         unsigned int const                      dof_index,
+         unsigned int const                      quad_index,
+         FastDiagonalizationCoefficients const & coefficients)
+  {
+    Matrices1D const matrices_1d =
+      compute_matrices_1d(matrix_free, dof_index, coefficients.IP_factor);
+
+    unsigned int const n_dofs_1d = matrices_1d.mass.n_rows();
+
+    n_blocks_per_cell = 1;
+    tensor_product_matrices.resize(matrix_free.n_cell_batches());
+
+    CellIntegrator<dim, 1, Number> integrator(matrix_free, dof_index, quad_index);
+
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+
+      std::array<scalar, dim> const h = compute_cell_extent(integrator);
+
+      scalar surface_to_volume = dealii::make_vectorized_array<Number>(0.0);
+      for(unsigned int d = 0; d < dim; ++d)
+        surface_to_volume += 1.0 / h[d];
+
+      // same penalty parameter as IP::calculate_penalty_parameter() for interior faces of a box
+      scalar const tau = matrices_1d.penalty_factor * surface_to_volume;
+
+      std::array<dealii::Table<2, scalar>, dim> mass_matrices, derivative_matrices;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        mass_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+        derivative_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          {
+            mass_matrices[d](i, j) = h[d] * matrices_1d.mass(i, j);
+            derivative_matrices[d](i, j) =
+              coefficients.laplace_factor *
+                (matrices_1d.laplace(i, j) / h[d] + tau * matrices_1d.penalty(i, j)) +
+              coefficients.mass_factor / dim * h[d] * matrices_1d.mass(i, j);
+          }
+        }
+      }
+
+      tensor_product_matrices[cell].reinit(mass_matrices, derivative_matrices);
+    }
+
+    n_rows_1d            = n_dofs_1d;
+    n_dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+  }
+
+  /*
+   * Separable approximation of the cell blocks
+   *
+   *   A_cell = M_cell + scaling_factor * (tau_div * D_cell + tau_conti * C_cell)
+   *
+   * of penalty operators for vector-valued fields with dim components, where D_cell = (div u,
+   * div v)_cell is the divergence penalty term and C_cell penalizes the values at the faces of
+   * the cell with the neighbor values set to zero, either of the normal component or of all
+   * components. Neglecting the coupling (d_i u_i, d_j v_j), i != j, of the divergence penalty
+   * term, the block of component c is the tensor-product operator
+   *
+   *   sum_d M_1 x ... x A_d^c x ... x M_dim,
+   *   A_d^c = M_d / dim + delta_dc tau_div K_d + (delta_dc or all components) tau_conti P_d,
+   *
+   * with the 1D stiffness matrices K_d without face terms and the 1D face mass matrices P_d. Apart
+   * from the neglected coupling, the approximation is exact for Cartesian cells with the same
+   * penalty parameter in the neighbors. The penalty parameters are given per cell batch, and an
+   * empty vector disables the respective term.
+   */
+  void
+  reinit_penalty(dealii::MatrixFree<dim, Number> const & matrix_free,
+                 unsigned int const                      dof_index,
+                 unsigned int const                      quad_index,
+                 double const                            scaling_factor,
+                 dealii::AlignedVector<scalar> const &   divergence_penalty,
+                 dealii::AlignedVector<scalar> const &   continuity_penalty,
+                 bool const                              continuity_penalty_all_components)
+  {
+    Matrices1D const matrices_1d = compute_matrices_1d(matrix_free, dof_index, 1.0);
+
+    unsigned int const n_dofs_1d = matrices_1d.mass.n_rows();
+
+    n_blocks_per_cell = dim;
+    tensor_product_matrices.resize(matrix_free.n_cell_batches() * dim);
+
+    CellIntegrator<dim, 1, Number> integrator(matrix_free, dof_index, quad_index);
+
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+
+      std::array<scalar, dim> const h = compute_cell_extent(integrator);
+
+      scalar const tau_div = divergence_penalty.empty() ?
+                               dealii::make_vectorized_array<Number>(0.0) :
+                               scaling_factor * divergence_penalty[cell];
+      scalar const tau_conti = continuity_penalty.empty() ?
+                                 dealii::make_vectorized_array<Number>(0.0) :
+                                 scaling_factor * continuity_penalty[cell];
+
+      std::array<dealii::Table<2, scalar>, dim> mass_matrices;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        mass_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+            mass_matrices[d](i, j) = h[d] * matrices_1d.mass(i, j);
+      }
+
+      for(unsigned int c = 0; c < dim; ++c)
+      {
+        std::array<dealii::Table<2, scalar>, dim> derivative_matrices;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          derivative_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+
+          bool const penalize_derivative = (d == c);
+          bool const penalize_faces      = (d == c) or continuity_penalty_all_components;
+
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+          {
+            for(unsigned int j = 0; j < n_dofs_1d; ++j)
+            {
+              scalar value = 1.0 / dim * mass_matrices[d](i, j);
+              if(penalize_derivative)
+                value += tau_div / h[d] * matrices_1d.stiffness(i, j);
+              if(penalize_faces)
+                value += tau_conti * matrices_1d.penalty(i, j);
+
+              derivative_matrices[d](i, j) = value;
+            }
+          }
+        }
+
+        tensor_product_matrices[cell * dim + c].reinit(mass_matrices, derivative_matrices);
+      }
+    }
+
+    n_rows_1d            = n_dofs_1d;
+    n_dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+  }
+
+  /*
+   * Separable approximation of the overlapping cell blocks of continuous discretizations of
+   * isotropic linear elasticity
+   *
+   *   A = mass_factor * M + 2 mu (eps(u), eps(v)) + lambda (div u, div v)
+   *
+   * with the Lamee parameters lambda and mu given per cell batch, as used by the additive Schwarz
+   * method with one block per cell. Neglecting the coupling of different components, the block of
+   * component c is the anisotropic Laplacian mu (grad u_c, grad v_c) + (lambda + mu) (d_c u_c,
+   * d_c v_c), i.e., the tensor-product operator
+   *
+   *   sum_d M_1 x ... x A_d^c x ... x M_dim,  A_d^c = (mu + delta_dc (lambda + mu)) K_d
+   *                                                  + mass_factor / dim * M_d.
+   *
+   * Since the cell blocks are cut out of the global matrix, the 1D matrices M_d and K_d of the cell
+   * contain the contributions of the neighbors to the vertex degrees of freedom, assuming that the
+   * neighbors have the same extent. Apart from the neglected coupling, the approximation is exact
+   * for uniform Cartesian meshes. Each component block requires O(k^2) memory instead of the dense
+   * block of size (dim k^dim)^2.
+   */
+  void
+  reinit_elasticity(dealii::MatrixFree<dim, Number> const & matrix_free,
+                    unsigned int const                      dof_index,
+                    unsigned int const                      quad_index,
+                    double const                            mass_factor,
+                    dealii::AlignedVector<scalar> const &   lambda,
+                    dealii::AlignedVector<scalar> const &   mu)
+  {
+    AssertThrow(lambda.size() == matrix_free.n_cell_batches() and
+                  mu.size() == matrix_free.n_cell_batches(),
+                dealii::ExcMessage("Lamee parameters have to be given for all cell batches."));
+
+    Matrices1D const matrices_1d = compute_matrices_1d(matrix_free, dof_index, 1.0);
+
+    unsigned int const n_dofs_1d = matrices_1d.mass.n_rows();
+    unsigned int const last      = n_dofs_1d - 1;
+
+    // add the contributions of the neighbors on both sides to the vertex degrees of freedom
+    dealii::Table<2, double> mass(matrices_1d.mass), stiffness(matrices_1d.stiffness);
+    mass(0, 0) += matrices_1d.mass(last, last);
+    mass(last, last) += matrices_1d.mass(0, 0);
+    stiffness(0, 0) += matrices_1d.stiffness(last, last);
+    stiffness(last, last) += matrices_1d.stiffness(0, 0);
+
+    n_blocks_per_cell = dim;
+    tensor_product_matrices.resize(matrix_free.n_cell_batches() * dim);
+
+    CellIntegrator<dim, 1, Number> integrator(matrix_free, dof_index, quad_index);
+
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+
+      std::array<scalar, dim> const h = compute_cell_extent(integrator);
+
+      std::array<dealii::Table<2, scalar>, dim> mass_matrices;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        mass_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+            mass_matrices[d](i, j) = h[d] * mass(i, j);
+      }
+
+      for(unsigned int c = 0; c < dim; ++c)
+      {
+        std::array<dealii::Table<2, scalar>, dim> derivative_matrices;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          scalar const coefficient = (d == c) ? lambda[cell] + 2.0 * mu[cell] : mu[cell];
+
+          derivative_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+            for(unsigned int j = 0; j < n_dofs_1d; ++j)
+              derivative_matrices[d](i, j) = coefficient / h[d] * stiffness(i, j) +
+                                             mass_factor / dim * mass_matrices[d](i, j);
+        }
+
+        tensor_product_matrices[cell * dim + c].reinit(mass_matrices, derivative_matrices);
+      }
+    }
+
+    n_rows_1d            = n_dofs_1d;
+    n_dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+  }
+
+  /*
+   * Applies the inverse cell block to the dof values of all components in the layout of
+   * FEEvaluation::begin_dof_values(). The arrays dst and src must not overlap.
+   */
+  void
+  apply_inverse(unsigned int const cell,
+                scalar *           dst,
+                scalar const *     src,
+                unsigned int const n_components) const
+  {
+    AssertThrow(n_blocks_per_cell == 1 or n_blocks_per_cell == n_components,
+                dealii::ExcMessage("Number of components does not match the cell blocks."));
+
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      unsigned int const block = cell * n_blocks_per_cell + (n_blocks_per_cell == 1 ? 0 : c);
+
+      tensor_product_matrices[block].apply_inverse(
+        dealii::ArrayView<scalar>(dst + c * n_dofs_per_component, n_dofs_per_component),
+        dealii::ArrayView<scalar const>(src + c * n_dofs_per_component, n_dofs_per_component));
+    }
+  }
+
+  std::size_t
+  memory_consumption() const
+  {
+    // eigenvalues, eigenvectors, and mass matrices of the 1D problems
+    return tensor_product_matrices.size() * dim * (2 * n_rows_1d * n_rows_1d + n_rows_1d) *
+           sizeof(scalar);
+  }
+
+private:
+  /*
+   * 1D reference matrices on the unit interval: mass matrix, stiffness matrix without face terms,
+   * symmetric interior penalty Laplace matrix (stiffness matrix with the consistency terms of both
+   * faces, where the value and the gradient of the neighbor are zero), and face mass matrix.
+   */
+  struct Matrices1D
+  {
+    dealii::Table<2, double> mass, stiffness, laplace, penalty;
+
+    double penalty_factor;
+  };
+
+  static Matrices1D
+  compute_matrices_1d(dealii::MatrixFree<dim, Number> const & matrix_free,
+                      unsigned int const                      dof_index,
+                      double const                            IP_factor)
+  {
+    dealii::Triangulation<dim> const & triangulation =
+      matrix_free.get_dof_handler(dof_index).get_triangulation();
+    AssertThrow(triangulation.all_reference_cells_are_hyper_cube(),
+                dealii::ExcMessage("The fast diagonalization method requires hypercube elements."));
+
+    auto const & shape_info = matrix_free.get_shape_info(dof_index);
+    AssertThrow(shape_info.data.size() == 1,
+                dealii::ExcMessage(
+                  "The fast diagonalization method requires isotropic tensor-product elements."));
+
+    auto const &       shape_data = shape_info.data[0];
+    unsigned int const n_dofs_1d  = shape_data.fe_degree + 1;
+    unsigned int const n_q_points = shape_data.n_q_points_1d;
+    auto const &       quadrature = shape_data.quadrature;
+
+    Matrices1D matrices;
+
+    matrices.penalty_factor =
+      IP::get_penalty_factor<dim, double>(shape_data.fe_degree, ElementType::Hypercube, IP_factor);
+
+    matrices.mass.reinit(n_dofs_1d, n_dofs_1d);
+    matrices.stiffness.reinit(n_dofs_1d, n_dofs_1d);
+    matrices.laplace.reinit(n_dofs_1d, n_dofs_1d);
+    matrices.penalty.reinit(n_dofs_1d, n_dofs_1d);
+
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+    {
+      for(unsigned int j = 0; j < n_dofs_1d; ++j)
+      {
+        double mass = 0.0, stiffness = 0.0;
+        for(unsigned int q = 0; q < n_q_points; ++q)
+        {
+          mass += quadrature.weight(q) * shape_data.shape_values[i * n_q_points + q] *
+                  shape_data.shape_values[j * n_q_points + q];
+          stiffness += quadrature.weight(q) * shape_data.shape_gradients[i * n_q_points + q] *
+                       shape_data.shape_gradients[j * n_q_points + q];
+        }
+
+        // face terms at x = 0 (normal -1) and x = 1 (normal +1), where the value and the gradient
+        // of the neighbor are zero
+        double laplace = stiffness, penalty = 0.0;
+        for(unsigned int face = 0; face < 2; ++face)
+        {
+          double const normal    = (face == 0) ? -1.0 : 1.0;
+          auto const & face_data = shape_data.shape_data_on_face[face];
+
+          double const value_i = face_data[i], gradient_i = face_data[n_dofs_1d + i];
+          double const value_j = face_data[j], gradient_j = face_data[n_dofs_1d + j];
+
+          laplace -= 0.5 * normal * (gradient_i * value_j + value_i * gradient_j);
+          penalty += value_i * value_j;
+        }
+
+        matrices.mass(i, j)      = mass;
+        matrices.stiffness(i, j) = stiffness;
+        matrices.laplace(i, j)   = laplace;
+        matrices.penalty(i, j)   = penalty;
+      }
+    }
+
+    return matrices;
+  }
+
+  /*
+   * Extent of the cell in direction d from the metric J^{-1} J^{-T}, where inverse_jacobian()
+   * returns J^{-T}.
+   */
+  static std::array<scalar, dim>
+  compute_cell_extent(CellIntegrator<dim, 1, Number> const & integrator)
+  {
+    dealii::Tensor<2, dim, scalar> const inv_jac_transposed = integrator.inverse_jacobian(0);
+
+    std::array<scalar, dim> h;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      scalar metric = inv_jac_transposed[0][d] * inv_jac_transposed[0][d];
+      for(unsigned int k = 1; k < dim; ++k)
+        metric += inv_jac_transposed[k][d] * inv_jac_transposed[k][d];
+
+      h[d] = 1.0 / std::sqrt(metric);
+    }
+
+    return h;
+  }
+
+  std::vector<TensorProductMatrix> tensor_product_matrices;
+
+  // one block for all components or one block per component
+  unsigned int n_blocks_per_cell    = 1;
+  unsigned int n_rows_1d            = 0;
+  unsigned int n_dofs_per_component = 0;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_FAST_DIAGONALIZATION_KERNEL_H_ */
@@ -108,6 +108,56 @@ calculate_max_velocity(dealii::Triangulation<dim> const &     triangulation,
   return global_max_U;
 }
 
+/*
+ * Returns the transport speed in reference coordinates entering the CFL condition at a quadrature
+ * point, i.e., the norm or the maximum component of J^{-T} u. The time step size of a cell is
+ * determined by the maximum of this speed over the quadrature points, such that the division by
+ * the speed is performed once per cell rather than once per quadrature point.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::VectorizedArray<Number>
+  calculate_cfl_speed(dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & ut_xi,
+                      CFLConditionType const cfl_condition_type)
+{
+  if(cfl_condition_type == CFLConditionType::VelocityNorm)
+  {
+    return ut_xi.norm();
+  }
+  else if(cfl_condition_type == CFLConditionType::VelocityComponents)
+  {
+    dealii::VectorizedArray<Number> speed = std::abs(ut_xi[0]);
+    for(unsigned int d = 1; d < dim; ++d)
+      speed = std::max(speed, std::abs(ut_xi[d]));
+    return speed;
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    return dealii::VectorizedArray<Number>();
+  }
+}
+
+/*
+ * Minimum time step size of the active entries of a cell batch given the maximum speed over the
+ * quadrature points.
+ */
+template<typename Number>
+inline double
+calculate_time_step_cell_batch(dealii::VectorizedArray<Number> const & max_speed,
+                               unsigned int const                      n_active_entries,
+                               double const                            cfl_p)
+{
+  double time_step = std::numeric_limits<Number>::max();
+  for(unsigned int v = 0; v < n_active_entries; ++v)
+  {
+    if(max_speed[v] > 0.0)
+      time_step = std::min(time_step, cfl_p / max_speed[v]);
+  }
+
+  return time_step;
+}
+
 /*
  * Calculate time step size according to local CFL criterion where the velocity field is a
  * prescribed analytical function. The computed time step size corresponds to CFL = 1.0.
@@ -137,8 +187,7 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
   // loop over cells of processor
   for(unsigned int cell = 0; cell < data.n_cell_batches(); ++cell)
   {
-    dealii::VectorizedArray<value_type> delta_t_cell =
-      dealii::make_vectorized_array<value_type>(std::numeric_limits<value_type>::max());
+    dealii::VectorizedArray<value_type> max_speed = dealii::make_vectorized_array<value_type>(0.0);
 
     fe_eval.reinit(cell);
 
@@ -154,29 +203,14 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
       invJ                                                              = transpose(invJ);
       dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> ut_xi = invJ * u_x;
 
-      if(cfl_condition_type == CFLConditionType::VelocityNorm)
-      {
-        delta_t_cell = std::min(delta_t_cell, cfl_p / ut_xi.norm());
-      }
-      else if(cfl_condition_type == CFLConditionType::VelocityComponents)
-      {
-        for(unsigned int d = 0; d < dim; ++d)
-          delta_t_cell = std::min(delta_t_cell, cfl_p / (std::abs(ut_xi[d])));
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcMessage("Not implemented."));
-      }
-    }
-
-    // loop over vectorized array
-    double dt = std::numeric_limits<double>::max();
-    for(unsigned int v = 0; v < dealii::VectorizedArray<value_type>::size(); ++v)
-    {
-      dt = std::min(dt, (double)delta_t_cell[v]);
+      max_speed = std::max(max_speed, calculate_cfl_speed(ut_xi, cfl_condition_type));
     }
 
-    new_time_step = std::min(new_time_step, dt);
+    new_time_step =
+      std::min(new_time_step,
+               calculate_time_step_cell_batch(max_speed,
+                                              data.n_active_entries_per_cell_batch(cell),
+                                              cfl_p));
   }
 
   // find minimum over all processors
@@ -210,8 +244,7 @@ calculate_time_step_cfl_local(
   // loop over cells of processor
   for(unsigned int cell = 0; cell < data.n_cell_batches(); ++cell)
   {
-    dealii::VectorizedArray<value_type> delta_t_cell =
-      dealii::make_vectorized_array<value_type>(std::numeric_limits<value_type>::max());
+    dealii::VectorizedArray<value_type> max_speed = dealii::make_vectorized_array<value_type>(0.0);
 
     dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> invJ;
     dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> u_x;
@@ -229,29 +262,14 @@ calculate_time_step_cfl_local(
       invJ  = transpose(invJ);
       ut_xi = invJ * u_x;
 
-      if(cfl_condition_type == CFLConditionType::VelocityNorm)
-      {
-        delta_t_cell = std::min(delta_t_cell, cfl_p / ut_xi.norm());
-      }
-      else if(cfl_condition_type == CFLConditionType::VelocityComponents)
-      {
-        for(unsigned int d = 0; d < dim; ++d)
-          delta_t_cell = std::min(delta_t_cell, cfl_p / (std::abs(ut_xi[d])));
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcMessage("Not implemented."));
-      }
-    }
-
-    // loop over vectorized array
-    double dt = std::numeric_limits<double>::max();
-    for(unsigned int v = 0; v < dealii::VectorizedArray<value_type>::size(); ++v)
-    {
-      dt = std::min(dt, (double)delta_t_cell[v]);
+      max_speed = std::max(max_speed, calculate_cfl_speed(ut_xi, cfl_condition_type));
     }
 
-    new_time_step = std::min(new_time_step, dt);
+    new_time_step =
+      std::min(new_time_step,
+               calculate_time_step_cell_batch(max_speed,
+                                              data.n_active_entries_per_cell_batch(cell),
+                                              cfl_p));
   }
 
   // find minimum over all processors
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_OPERATORS_INTERIOR_PENALTY_PARAMETER_H_
 #define INCLUDE_EXADG_OPERATORS_INTERIOR_PENALTY_PARAMETER_H_
 
+// C/C++
+#include <algorithm>
+
 // deal.II
 #include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/vectorization.h>
@@ -99,6 +102,54 @@ calculate_penalty_parameter(
   }
 }
 
+/*
+ *  This function calculates the complete penalty parameter of the interior penalty method for
+ *  each face batch, i.e., the maximum of the cell values of both adjacent cells (interior faces)
+ *  or the cell value of the interior cell (boundary faces), multiplied by the penalty factor. The
+ *  face batches are numbered as in dealii::MatrixFree, such that the penalty parameter can be
+ *  accessed via the index of the face batch in face loops. The cell values are expected as
+ *  computed by calculate_penalty_parameter(), i.e., including ghost cells.
+ */
+template<int dim, typename Number>
+void
+calculate_face_penalty_parameter(
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> &       array_face_penalty_parameter,
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> const & array_penalty_parameter,
+  dealii::MatrixFree<dim, Number> const &                        matrix_free,
+  Number const                                                   penalty_factor)
+{
+  unsigned int const n_lanes          = dealii::VectorizedArray<Number>::size();
+  unsigned int const n_inner_faces    = matrix_free.n_inner_face_batches();
+  unsigned int const n_boundary_faces = matrix_free.n_boundary_face_batches();
+  unsigned int const n_faces =
+    n_inner_faces + n_boundary_faces + matrix_free.n_ghost_inner_face_batches();
+
+  array_face_penalty_parameter.resize(n_faces);
+
+  for(unsigned int face = 0; face < n_faces; ++face)
+  {
+    bool const is_boundary_face =
+      face >= n_inner_faces and face < n_inner_faces + n_boundary_faces;
+
+    auto const & face_info = matrix_free.get_face_info(face);
+
+    array_face_penalty_parameter[face] = dealii::make_vectorized_array<Number>(0.0);
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      unsigned int const cell_m = face_info.cells_interior[v];
+      Number             tau    = array_penalty_parameter[cell_m / n_lanes][cell_m % n_lanes];
+
+      if(not is_boundary_face)
+      {
+        unsigned int const cell_p = face_info.cells_exterior[v];
+        tau = std::max(tau, array_penalty_parameter[cell_p / n_lanes][cell_p % n_lanes]);
+      }
+
+      array_face_penalty_parameter[face][v] = tau * penalty_factor;
+    }
+  }
+}
+
 /*
  *  This function returns the penalty factor of the interior penalty method for
  *  quadrilateral/hexahedral or for triangular/tetrahedral elements for a given
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 #define INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 
+// C/C++
+#include <algorithm>
+#include <functional>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/operators.h>
@@ -30,6 +34,7 @@
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/inverse_mass_parameters.h>
 #include <exadg/operators/mass_operator.h>
+#include <exadg/operators/reference_inverse_mass_kernel.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 
@@ -65,7 +70,8 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
-  InverseMassOperator() : matrix_free(nullptr), dof_index(0), quad_index(0)
+  InverseMassOperator()
+    : matrix_free(nullptr), dof_index(0), quad_index(0), use_reference_inverse_mass(false)
   {
   }
 
@@ -87,19 +93,21 @@ public:
 
     if(data.implementation_type == InverseMassType::MatrixfreeOperator)
     {
-      // Currently, the inverse mass realized as matrix-free operator evaluation is only available
-      // in deal.II for tensor-product elements.
-      AssertThrow(
-        fe.base_element(0).dofs_per_cell == dealii::Utilities::pow(fe.degree + 1, dim),
-        dealii::ExcMessage(
-          "The matrix-free inverse mass operator is currently only available for tensor-product elements."));
-
-      // Currently, the inverse mass realized as matrix-free operator evaluation is only available
-      // in deal.II if n_q_points_1d = n_nodes_1d.
-      AssertThrow(
-        this->matrix_free->get_shape_info(0, quad_index).data[0].n_q_points_1d == fe.degree + 1,
-        dealii::ExcMessage(
-          "The matrix-free inverse mass operator is currently only available if n_q_points_1d = n_nodes_1d."));
+      // The inverse mass realized as matrix-free operator evaluation in deal.II is only available
+      // for tensor-product elements with n_q_points_1d = n_nodes_1d. In all other cases, we use
+      // the inverse mass matrix of the reference cell.
+      dealii::Triangulation<dim> const & triangulation =
+        matrix_free->get_dof_handler(dof_index).get_triangulation();
+
+      bool const collocation =
+        triangulation.all_reference_cells_are_hyper_cube() and
+        fe.base_element(0).dofs_per_cell == dealii::Utilities::pow(fe.degree + 1, dim) and
+        matrix_free->get_shape_info(dof_index, quad_index).data[0].n_q_points_1d == fe.degree + 1;
+
+      use_reference_inverse_mass = not collocation;
+
+      if(use_reference_inverse_mass)
+        reference_inverse_mass.reinit(*matrix_free, dof_index, quad_index);
     }
     // We create a block-Jacobi preconditioner with MassOperator as underlying operator in case the
     // inverse mass can not be realized as a matrix-free operator.
@@ -154,7 +162,8 @@ public:
     if(data.implementation_type == InverseMassType::MatrixfreeOperator)
     {
       // no updates needed as long as the MatrixFree object is up-to-date (which is not the
-      // responsibility of the present class).
+      // responsibility of the present class). This also holds for the reference inverse mass,
+      // since the geometry factors are read from the MatrixFree object during the application.
     }
     else if(data.implementation_type == InverseMassType::ElementwiseKrylovSolver or
             data.implementation_type == InverseMassType::BlockMatrices)
@@ -171,6 +180,33 @@ public:
     }
   }
 
+  /*
+   * Whether the inverse mass can be applied cell by cell within the cell loop of another operator
+   * via apply_on_cell(), i.e., InverseMassType::MatrixfreeOperator with tensor-product elements
+   * and n_q_points_1d = n_nodes_1d.
+   */
+  bool
+  is_cell_local() const
+  {
+    return data.implementation_type == InverseMassType::MatrixfreeOperator and
+           not use_reference_inverse_mass;
+  }
+
+  /*
+   * Applies the inverse mass in-place to the DoF values of an integrator that has been
+   * reinitialized for the current cell, see is_cell_local(). The integrator has to be created with
+   * the dof_index and quad_index of this operator.
+   */
+  void
+  apply_on_cell(Integrator & integrator) const
+  {
+    AssertThrow(is_cell_local(),
+                dealii::ExcMessage("The inverse mass can not be applied cell by cell."));
+
+    InverseMassAsMatrixFreeOperator inverse_mass(integrator);
+    inverse_mass.apply(integrator.begin_dof_values(), integrator.begin_dof_values());
+  }
+
   // dst = M^-1 * src
   void
   apply(VectorType & dst, VectorType const & src) const
@@ -218,14 +254,62 @@ public:
     }
   }
 
+  /*
+   * dst = scaling_factor * (M^-1 * src), where operation_after_loop(start_range, end_range) is
+   * called for ranges of locally owned DoFs once dst is complete for these DoFs. In the
+   * InverseMassType::MatrixfreeOperator case, this allows to fuse vector updates with the inverse
+   * mass operator while the entries of dst are still in cache. src and dst must not be the same
+   * vector.
+   */
+  void
+  apply_scale(
+    VectorType &                                                        dst,
+    double const                                                        scaling_factor,
+    VectorType const &                                                  src,
+    std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop) const
+  {
+    if(data.implementation_type == InverseMassType::MatrixfreeOperator)
+    {
+      // ghost have to be zeroed out before MatrixFree::cell_loop().
+      dst.zero_out_ghost_values();
+
+      matrix_free->cell_loop(
+        &This::cell_loop_matrix_free_operator,
+        this,
+        dst,
+        src,
+        /*operation before cell operation*/ {}, /*operation after cell operation*/
+        [&](const unsigned int start_range, const unsigned int end_range) {
+          for(unsigned int i = start_range; i < end_range; ++i)
+            dst.local_element(i) *= scaling_factor;
+
+          operation_after_loop(start_range, end_range);
+        },
+        dof_index);
+    }
+    else
+    {
+      apply(dst, src);
+      dst *= scaling_factor;
+
+      operation_after_loop(0, dst.locally_owned_size());
+    }
+  }
+
 
 private:
   void
-  cell_loop_matrix_free_operator(dealii::MatrixFree<dim, Number> const &,
-                                 VectorType &       dst,
-                                 VectorType const & src,
-                                 Range const &      cell_range) const
+  cell_loop_matrix_free_operator(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                                 VectorType &                            dst,
+                                 VectorType const &                      src,
+                                 Range const &                           cell_range) const
   {
+    if(use_reference_inverse_mass)
+    {
+      cell_loop_reference_inverse_mass(matrix_free_in, dst, src, cell_range);
+      return;
+    }
+
     Integrator                      integrator(*matrix_free, dof_index, quad_index);
     InverseMassAsMatrixFreeOperator inverse_mass(integrator);
 
@@ -240,12 +324,78 @@ private:
     }
   }
 
+  /*
+   * Inverse mass for simplex elements and hypercube elements with n_q_points_1d != n_nodes_1d, see
+   * ReferenceInverseMassKernel: exact for affine cells and weight-adjusted for curved cells.
+   */
+  void
+  cell_loop_reference_inverse_mass(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                                   VectorType &                            dst,
+                                   VectorType const &                      src,
+                                   Range const &                           cell_range) const
+  {
+    typedef dealii::VectorizedArray<Number> scalar;
+
+    Integrator integrator(*matrix_free, dof_index, quad_index);
+
+    unsigned int const dofs_per_component = integrator.dofs_per_component;
+
+    dealii::AlignedVector<scalar> values(integrator.dofs_per_cell), temp(dofs_per_component);
+
+    scalar const one = dealii::make_vectorized_array<Number>(1.0);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src, 0);
+
+      if(reference_inverse_mass.cell_is_affine(matrix_free_in, cell))
+      {
+        scalar const inverse_determinant =
+          one / reference_inverse_mass.get_determinant(integrator, 0);
+
+        reference_inverse_mass.apply_reference_inverse(integrator.begin_dof_values(),
+                                                       values.begin(),
+                                                       temp.begin(),
+                                                       inverse_determinant,
+                                                       n_components);
+      }
+      else
+      {
+        // M^{-1} = M_ref^{-1} M_{1/J} M_ref^{-1}
+        reference_inverse_mass.apply_reference_inverse(
+          integrator.begin_dof_values(), values.begin(), temp.begin(), one, n_components);
+        std::copy(values.begin(), values.end(), integrator.begin_dof_values());
+
+        integrator.evaluate(dealii::EvaluationFlags::values);
+        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          scalar const determinant = reference_inverse_mass.get_determinant(integrator, q);
+          integrator.submit_value(integrator.get_value(q) / (determinant * determinant), q);
+        }
+        integrator.integrate(dealii::EvaluationFlags::values);
+
+        reference_inverse_mass.apply_reference_inverse(
+          integrator.begin_dof_values(), values.begin(), temp.begin(), one, n_components);
+      }
+
+      std::copy(values.begin(), values.end(), integrator.begin_dof_values());
+      integrator.set_dof_values(dst, 0);
+    }
+  }
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   unsigned int dof_index, quad_index;
 
   InverseMassParameters data;
 
+  // This variable is only relevant for InverseMassType::MatrixfreeOperator in case the inverse
+  // mass of deal.II is not available.
+  bool use_reference_inverse_mass;
+
+  ReferenceInverseMassKernel<dim, Number> reference_inverse_mass;
+
   // This variable is only relevant if the inverse mass can not be realized as a matrix-free
   // operator. Since this class allows only L2-conforming spaces (discontinuous Galerkin method),
   // the mass matrix is block-diagonal and a block-Jacobi preconditioner inverts the mass operator
@@ -29,8 +29,9 @@ namespace ExaDG
 {
 enum class InverseMassType
 {
-  MatrixfreeOperator, // currently only available via deal.II for Hypercube elements with n_nodes_1d
-                      // = n_q_points_1d
+  MatrixfreeOperator, // via deal.II for hypercube elements with n_nodes_1d = n_q_points_1d and
+                      // via the reference inverse mass otherwise (exact for affine cells,
+                      // weight-adjusted for curved cells)
   ElementwiseKrylovSolver,
   BlockMatrices
 };
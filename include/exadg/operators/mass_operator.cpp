@@ -38,6 +38,9 @@ MassOperator<dim, n_components, Number>::initialize(
   Base::reinit(matrix_free, affine_constraints, data);
 
   this->integrator_flags = kernel.get_integrator_flags();
+
+  if(data.use_dense_simplex_kernels)
+    dense_simplex_kernel.reinit(matrix_free, data.dof_index, data.quad_index);
 }
 
 template<int dim, int n_components, typename Number>
@@ -76,6 +79,14 @@ MassOperator<dim, n_components, Number>::apply_scale_add(VectorType &       dst,
 template<int dim, int n_components, typename Number>
 void
 MassOperator<dim, n_components, Number>::do_cell_integral(IntegratorCell & integrator) const
+{
+  do_cell_integral_templated(integrator);
+}
+
+template<int dim, int n_components, typename Number>
+template<typename Integrator>
+void
+MassOperator<dim, n_components, Number>::do_cell_integral_templated(Integrator & integrator) const
 {
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
@@ -83,6 +94,85 @@ MassOperator<dim, n_components, Number>::do_cell_integral(IntegratorCell & integ
   }
 }
 
+template<int dim, int n_components, typename Number>
+bool
+MassOperator<dim, n_components, Number>::cell_loop_fixed_degree(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  return expand_fixed_degree(
+    matrix_free,
+    this->get_dof_index(),
+    this->get_quad_index(),
+    [&](auto degree, auto n_q_points_1d) {
+      CellIntegratorFixedDegree<dim,
+                                decltype(degree)::value,
+                                decltype(n_q_points_1d)::value,
+                                n_components,
+                                Number>
+        integrator(matrix_free, this->get_dof_index(), this->get_quad_index());
+
+      for(auto cell = range.first; cell < range.second; ++cell)
+      {
+        integrator.reinit(cell);
+
+        integrator.gather_evaluate(src, this->integrator_flags.cell_evaluate);
+
+        do_cell_integral_templated(integrator);
+
+        integrator.integrate_scatter(this->integrator_flags.cell_integrate, dst);
+      }
+    });
+}
+
+template<int dim, int n_components, typename Number>
+bool
+MassOperator<dim, n_components, Number>::cell_loop_dense_simplex(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  if(not dense_simplex_kernel.is_active())
+    return false;
+
+  IntegratorCell integrator(matrix_free, this->get_dof_index(), this->get_quad_index());
+
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> dst_values(integrator.dofs_per_cell);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    this->reinit_cell(integrator, cell);
+
+    if(dense_simplex_kernel.cell_is_affine(matrix_free, cell))
+    {
+      integrator.read_dof_values(src);
+
+      dense_simplex_kernel.apply_mass(integrator.begin_dof_values(),
+                                      dst_values.begin(),
+                                      scaling_factor *
+                                        dense_simplex_kernel.get_determinant(integrator),
+                                      n_components);
+
+      std::copy(dst_values.begin(), dst_values.end(), integrator.begin_dof_values());
+
+      integrator.distribute_local_to_global(dst);
+    }
+    else
+    {
+      integrator.gather_evaluate(src, this->integrator_flags.cell_evaluate);
+
+      do_cell_integral(integrator);
+
+      integrator.integrate_scatter(this->integrator_flags.cell_integrate, dst);
+    }
+  }
+
+  return true;
+}
+
 // 1 component
 template class MassOperator<2, 1, float>;
 template class MassOperator<2, 1, double>;
@@ -23,6 +23,7 @@
 #define INCLUDE_OPERATORS_MASS_OPERATOR_H_
 
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/dense_simplex_kernel.h>
 #include <exadg/operators/mass_kernel.h>
 #include <exadg/operators/operator_base.h>
 
@@ -46,6 +47,7 @@ public:
 
   typedef typename Base::VectorType     VectorType;
   typedef typename Base::IntegratorCell IntegratorCell;
+  typedef typename Base::Range          Range;
 
   MassOperator();
 
@@ -67,8 +69,27 @@ private:
   void
   do_cell_integral(IntegratorCell & integrator) const final;
 
+  // cell integral for integrators with runtime or compile-time polynomial degree
+  template<typename Integrator>
+  void
+  do_cell_integral_templated(Integrator & integrator) const;
+
+  bool
+  cell_loop_fixed_degree(dealii::MatrixFree<dim, Number> const & matrix_free,
+                         VectorType &                            dst,
+                         VectorType const &                      src,
+                         Range const &                           range) const final;
+
+  bool
+  cell_loop_dense_simplex(dealii::MatrixFree<dim, Number> const & matrix_free,
+                          VectorType &                            dst,
+                          VectorType const &                      src,
+                          Range const &                           range) const final;
+
   MassKernel<dim, Number> kernel;
 
+  DenseSimplexKernel<dim, Number> dense_simplex_kernel;
+
   mutable double scaling_factor;
 };
 
@@ -0,0 +1,92 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_MIXED_PRECISION_OPERATOR_H_
+#define INCLUDE_EXADG_OPERATORS_MIXED_PRECISION_OPERATOR_H_
+
+// deal.II
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Wrapper providing the interface of a double-precision operator (as required by Krylov solvers)
+ * for an operator of type OperatorBase that is set up in reduced precision (typically float). The
+ * matrix-vector product is computed with the float kernel via apply_mixed_precision(), i.e., only
+ * the geometry data and the arithmetic of the matrix-free kernel are in reduced precision, while
+ * the vectors of the Krylov solver are stored in double precision.
+ */
+template<typename Operator>
+class MixedPrecisionOperator : public dealii::Subscriptor
+{
+public:
+  typedef double                                             value_type;
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  MixedPrecisionOperator(std::shared_ptr<Operator const> op) : pde_operator(op)
+  {
+    AssertThrow(pde_operator.get() != 0, dealii::ExcMessage("Invalid pointer"));
+  }
+
+  std::shared_ptr<Operator const>
+  get_pde_operator() const
+  {
+    return pde_operator;
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    pde_operator->get_matrix_free().initialize_dof_vector(vector, pde_operator->get_dof_index());
+  }
+
+  dealii::types::global_dof_index
+  m() const
+  {
+    return pde_operator->m();
+  }
+
+  dealii::types::global_dof_index
+  n() const
+  {
+    return pde_operator->n();
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->apply_mixed_precision(dst, src);
+  }
+
+  void
+  vmult_add(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->apply_add_mixed_precision(dst, src);
+  }
+
+private:
+  std::shared_ptr<Operator const> pde_operator;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_MIXED_PRECISION_OPERATOR_H_ */
@@ -0,0 +1,272 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_MODAL_FILTER_H_
+#define INCLUDE_EXADG_OPERATORS_MODAL_FILTER_H_
+
+// C++
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+struct ModalFilterData
+{
+  ModalFilterData() : dof_index(0), quad_index(0), strength(36.0), order(16), cutoff_degree(0)
+  {
+  }
+
+  unsigned int dof_index;
+  unsigned int quad_index;
+
+  // parameters alpha, s, and N_c of the exponential filter, see ModalFilter
+  double       strength;
+  unsigned int order;
+  unsigned int cutoff_degree;
+};
+
+/*
+ * Cell-local exponential filter of the modal coefficients of a DG function, which damps the
+ * highest polynomial modes in each cell. In one dimension, the function u = sum_k c_k L_k given in
+ * terms of the orthonormal Legendre polynomials L_k of degree k = 0, ..., N is replaced by
+ * sum_k sigma_k c_k L_k with
+ *
+ *   sigma_k = 1 for k <= N_c ,  sigma_k = exp(-alpha ((k - N_c)/(N - N_c))^s) for k > N_c .
+ *
+ * The filter is independent of the nodal basis of the finite element, since the modal
+ * coefficients are obtained by the L2 projection c = A u with A_kj = (L_k, phi_j). Hence, the 1D
+ * filter matrix in terms of the nodal coefficients reads M^{-1} A^T diag(sigma) A, where M is the
+ * 1D mass matrix. In dim dimensions, the 1D filter is applied in all coordinate directions by sum
+ * factorization, such that the cost is that of the application of a cell-local tensor-product
+ * matrix. The filter preserves the cell mean values.
+ *
+ * The filter is set up for hypercube elements with a single tensor-product base element.
+ */
+template<int dim, int n_components, typename Number>
+class ModalFilter
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  typedef CellIntegrator<dim, n_components, Number> Integrator;
+
+  typedef std::pair<unsigned int, unsigned int> Range;
+
+public:
+  ModalFilter() : matrix_free(nullptr), n_dofs_1d(0), n_dofs(0)
+  {
+  }
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+             ModalFilterData const &                 data_in)
+  {
+    matrix_free = &matrix_free_in;
+    data        = data_in;
+
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free->get_dof_handler(data.dof_index);
+
+    AssertThrow(dof_handler.get_triangulation().all_reference_cells_are_hyper_cube(),
+                dealii::ExcMessage("The modal filter is only implemented for hypercube elements."));
+
+    AssertThrow(dof_handler.get_fe().n_base_elements() == 1,
+                dealii::ExcMessage("The modal filter requires a single base element."));
+
+    auto const & shape_data =
+      matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+    auto const & quadrature_1d = shape_data.quadrature;
+
+    unsigned int const degree        = shape_data.fe_degree;
+    unsigned int const n_q_points_1d = shape_data.n_q_points_1d;
+
+    n_dofs_1d = degree + 1;
+    n_dofs    = dealii::Utilities::pow(n_dofs_1d, dim);
+
+    AssertThrow(dof_handler.get_fe().base_element(0).n_dofs_per_cell() == n_dofs,
+                dealii::ExcMessage("The modal filter requires tensor-product elements."));
+
+    AssertThrow(n_q_points_1d >= n_dofs_1d,
+                dealii::ExcMessage("The quadrature has to integrate the mass matrix exactly."));
+
+    // values of the orthonormal Legendre polynomials in the quadrature points
+    dealii::FullMatrix<double> legendre_values(n_dofs_1d, n_q_points_1d);
+    for(unsigned int k = 0; k < n_dofs_1d; ++k)
+    {
+      dealii::Polynomials::Legendre const legendre(k);
+
+      double norm_squared = 0.0;
+      for(unsigned int q = 0; q < n_q_points_1d; ++q)
+      {
+        legendre_values(k, q) = legendre.value(quadrature_1d.point(q)[0]);
+        norm_squared += quadrature_1d.weight(q) * legendre_values(k, q) * legendre_values(k, q);
+      }
+
+      for(unsigned int q = 0; q < n_q_points_1d; ++q)
+        legendre_values(k, q) /= std::sqrt(norm_squared);
+    }
+
+    // mass matrix M and projection matrix A_kj = (L_k, phi_j)
+    dealii::FullMatrix<double> mass(n_dofs_1d, n_dofs_1d), projection(n_dofs_1d, n_dofs_1d);
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+      for(unsigned int j = 0; j < n_dofs_1d; ++j)
+        for(unsigned int q = 0; q < n_q_points_1d; ++q)
+        {
+          double const phi_j = shape_data.shape_values[j * n_q_points_1d + q];
+
+          mass(i, j) += quadrature_1d.weight(q) * shape_data.shape_values[i * n_q_points_1d + q] *
+                        phi_j;
+          projection(i, j) += quadrature_1d.weight(q) * legendre_values(i, q) * phi_j;
+        }
+
+    // A^T diag(sigma) A
+    dealii::FullMatrix<double> filtered_mass(n_dofs_1d, n_dofs_1d);
+    for(unsigned int k = 0; k < n_dofs_1d; ++k)
+    {
+      double const sigma = get_filter_factor(k, degree);
+      for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          filtered_mass(i, j) += projection(k, i) * sigma * projection(k, j);
+    }
+
+    mass.gauss_jordan();
+
+    dealii::FullMatrix<double> filter(n_dofs_1d, n_dofs_1d);
+    mass.mmult(filter, filtered_mass);
+
+    filter_matrix.resize(n_dofs_1d * n_dofs_1d);
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+      for(unsigned int j = 0; j < n_dofs_1d; ++j)
+        filter_matrix[i * n_dofs_1d + j] = filter(i, j);
+  }
+
+  /*
+   * Filter factor sigma_k of the modal coefficient of degree k for polynomials of the given degree.
+   */
+  double
+  get_filter_factor(unsigned int const k, unsigned int const degree) const
+  {
+    if(k <= data.cutoff_degree or degree <= data.cutoff_degree)
+      return 1.0;
+
+    double const eta = double(k - data.cutoff_degree) / double(degree - data.cutoff_degree);
+
+    return std::exp(-data.strength * std::pow(eta, data.order));
+  }
+
+  /*
+   * Computes dst = F src with the filter F. The vectors dst and src must not be the same vector.
+   */
+  void
+  apply(VectorType & dst, VectorType const & src) const
+  {
+    matrix_free->cell_loop(&ModalFilter::cell_loop, this, dst, src, false);
+  }
+
+private:
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+            VectorType &                            dst,
+            VectorType const &                      src,
+            Range const &                           cell_range) const
+  {
+    Integrator integrator(matrix_free_in, data.dof_index, data.quad_index);
+
+    dealii::AlignedVector<scalar> values(n_components * n_dofs), temp(n_dofs);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src);
+
+      scalar * dof_values = integrator.begin_dof_values();
+
+      for(unsigned int c = 0; c < n_components; ++c)
+        apply_tensor_product(dof_values + c * n_dofs, values.data() + c * n_dofs, temp.data());
+
+      for(unsigned int i = 0; i < n_components * n_dofs; ++i)
+        dof_values[i] = values[i];
+
+      integrator.set_dof_values(dst);
+    }
+  }
+
+  /*
+   * Applies the 1D filter matrix in all coordinate directions, alternating between dst and a
+   * temporary array such that the result ends up in dst.
+   */
+  void
+  apply_tensor_product(scalar const * src, scalar * dst, scalar * temp) const
+  {
+    scalar const * in  = src;
+    scalar *       out = (dim % 2 == 1) ? dst : temp;
+
+    unsigned int stride = 1;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      unsigned int const n_outer = n_dofs / (stride * n_dofs_1d);
+      for(unsigned int outer = 0; outer < n_outer; ++outer)
+      {
+        for(unsigned int inner = 0; inner < stride; ++inner)
+        {
+          unsigned int const offset = outer * stride * n_dofs_1d + inner;
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+          {
+            scalar sum = filter_matrix[i * n_dofs_1d] * in[offset];
+            for(unsigned int j = 1; j < n_dofs_1d; ++j)
+              sum += filter_matrix[i * n_dofs_1d + j] * in[offset + j * stride];
+            out[offset + i * stride] = sum;
+          }
+        }
+      }
+
+      in     = out;
+      out    = (out == dst) ? temp : dst;
+      stride = stride * n_dofs_1d;
+    }
+  }
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  ModalFilterData data;
+
+  unsigned int n_dofs_1d;
+
+  unsigned int n_dofs;
+
+  // row-major 1D filter matrix in terms of the nodal coefficients
+  std::vector<Number> filter_matrix;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_MODAL_FILTER_H_ */
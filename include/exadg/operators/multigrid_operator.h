@@ -98,6 +98,16 @@ public:
     pde_operator->vmult(dst, src);
   }
 
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after)
+    const final
+  {
+    pde_operator->vmult(dst, src, operation_before, operation_after);
+  }
+
   void
   vmult_add(VectorType & dst, VectorType const & src) const final
   {
@@ -152,6 +162,18 @@ public:
     pde_operator->compute_factorized_additive_schwarz_matrices();
   }
 
+  void
+  update_fast_diagonalization() const final
+  {
+    pde_operator->update_fast_diagonalization();
+  }
+
+  void
+  apply_inverse_fast_diagonalization(VectorType & dst, VectorType const & src) const final
+  {
+    pde_operator->apply_inverse_fast_diagonalization(dst, src);
+  }
+
 #ifdef DEAL_II_WITH_TRILINOS
   void
   init_system_matrix(dealii::TrilinosWrappers::SparseMatrix & system_matrix,
@@ -22,6 +22,8 @@
 #ifndef OPERATOR_PRECONDITIONABLE_H
 #define OPERATOR_PRECONDITIONABLE_H
 
+#include <functional>
+
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_sparse_matrix.h>
@@ -69,6 +71,13 @@ public:
   virtual void
   vmult(VectorType & dst, VectorType const & src) const = 0;
 
+  virtual void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after)
+    const = 0;
+
   virtual void
   vmult_add(VectorType & dst, VectorType const & src) const = 0;
 
@@ -96,6 +105,12 @@ public:
   virtual void
   compute_factorized_additive_schwarz_matrices() const = 0;
 
+  virtual void
+  update_fast_diagonalization() const = 0;
+
+  virtual void
+  apply_inverse_fast_diagonalization(VectorType & dst, VectorType const & src) const = 0;
+
 #ifdef DEAL_II_WITH_TRILINOS
   virtual void
   init_system_matrix(dealii::TrilinosWrappers::SparseMatrix & system_matrix,
@@ -342,6 +342,201 @@ QCriterionCalculator<dim, Number>::cell_loop(dealii::MatrixFree<dim, Number> con
   }
 }
 
+template<int dim, typename Number>
+DerivedQuantitiesCalculator<dim, Number>::DerivedQuantitiesCalculator()
+  : matrix_free(nullptr),
+    dof_index_u(0),
+    dof_index_u_scalar(0),
+    quad_index(0),
+    compressible_flow(false)
+{
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantitiesCalculator<dim, Number>::initialize(
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_u_in,
+  unsigned int const                      dof_index_u_scalar_in,
+  unsigned int const                      quad_index_in,
+  bool const                              compressible_flow_in)
+{
+  matrix_free        = &matrix_free_in;
+  dof_index_u        = dof_index_u_in;
+  dof_index_u_scalar = dof_index_u_scalar_in;
+  quad_index         = quad_index_in;
+  compressible_flow  = compressible_flow_in;
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantitiesCalculator<dim, Number>::compute(Fields const &     fields,
+                                                  VectorType const & src) const
+{
+  std::vector<VectorType *> dst;
+  Slots                     slots;
+
+  auto const add_field = [&](VectorType * field, unsigned int & slot) {
+    if(field != nullptr)
+    {
+      *field = 0;
+      slot   = dst.size();
+      dst.push_back(field);
+    }
+  };
+
+  add_field(fields.vorticity, slots.vorticity);
+  add_field(fields.divergence, slots.divergence);
+  add_field(fields.shear_rate, slots.shear_rate);
+  add_field(fields.velocity_magnitude, slots.velocity_magnitude);
+  add_field(fields.q_criterion, slots.q_criterion);
+
+  if(dst.empty())
+    return;
+
+  matrix_free->template cell_loop<std::vector<VectorType *>, VectorType>(
+    [&](auto const & matrix_free, auto & dst, auto const & src, auto const & range) {
+      cell_loop(slots, matrix_free, dst, src, range);
+    },
+    dst,
+    src);
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantitiesCalculator<dim, Number>::cell_loop(
+  Slots const &                           slots,
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  VectorType const &                      src,
+  Range const &                           cell_range) const
+{
+  unsigned int const invalid = dealii::numbers::invalid_unsigned_int;
+
+  bool const need_values = slots.velocity_magnitude != invalid;
+  bool const need_gradients =
+    slots.vorticity != invalid or slots.divergence != invalid or slots.shear_rate != invalid or
+    slots.q_criterion != invalid;
+
+  dealii::EvaluationFlags::EvaluationFlags evaluation_flags = dealii::EvaluationFlags::nothing;
+  if(need_values)
+    evaluation_flags = evaluation_flags | dealii::EvaluationFlags::values;
+  if(need_gradients)
+    evaluation_flags = evaluation_flags | dealii::EvaluationFlags::gradients;
+
+  CellIntegratorVector integrator_velocity(matrix_free, dof_index_u, quad_index);
+
+  // every field needs its own integrator since the quadrature point data is overwritten by
+  // submit_value()
+  std::shared_ptr<CellIntegratorVector> integrator_vorticity;
+  if(slots.vorticity != invalid)
+    integrator_vorticity =
+      std::make_shared<CellIntegratorVector>(matrix_free, dof_index_u, quad_index);
+
+  std::vector<std::shared_ptr<CellIntegratorScalar>> integrators_scalar(dst.size());
+  for(unsigned int const slot :
+      {slots.divergence, slots.shear_rate, slots.velocity_magnitude, slots.q_criterion})
+  {
+    if(slot != invalid)
+      integrators_scalar[slot] =
+        std::make_shared<CellIntegratorScalar>(matrix_free, dof_index_u_scalar, quad_index);
+  }
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator_velocity.reinit(cell);
+    integrator_velocity.gather_evaluate(src, evaluation_flags);
+
+    if(integrator_vorticity)
+      integrator_vorticity->reinit(cell);
+    for(auto & integrator : integrators_scalar)
+      if(integrator)
+        integrator->reinit(cell);
+
+    for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
+    {
+      if(need_values)
+      {
+        scalar const magnitude = integrator_velocity.get_value(q).norm();
+        integrators_scalar[slots.velocity_magnitude]->submit_value(magnitude, q);
+      }
+
+      if(not need_gradients)
+        continue;
+
+      tensor const grad_u = integrator_velocity.get_gradient(q);
+
+      if(slots.vorticity != invalid)
+      {
+        // for dim=2, the vorticity is stored in the first component of a vector with dim
+        // components, see VorticityCalculator
+        vector omega;
+        if(dim == 2)
+        {
+          omega[0] = grad_u[1][0] - grad_u[0][1];
+        }
+        else
+        {
+          for(unsigned int d = 0; d < number_vorticity_components; ++d)
+          {
+            unsigned int const i = (d + 1) % dim;
+            unsigned int const j = (d + 2) % dim;
+            omega[d]             = grad_u[j][i] - grad_u[i][j];
+          }
+        }
+        integrator_vorticity->submit_value(omega, q);
+      }
+
+      if(slots.divergence != invalid)
+      {
+        integrators_scalar[slots.divergence]->submit_value(trace(grad_u), q);
+      }
+
+      if(slots.shear_rate != invalid or slots.q_criterion != invalid)
+      {
+        tensor Om, S;
+        for(unsigned int i = 0; i < dim; i++)
+        {
+          for(unsigned int j = 0; j < dim; j++)
+          {
+            Om[i][j] = 0.5 * (grad_u[i][j] - grad_u[j][i]);
+            S[i][j]  = 0.5 * (grad_u[i][j] + grad_u[j][i]);
+          }
+        }
+
+        // Shear rate definition according to Galdi et al., 2008, see ShearRateCalculator
+        if(slots.shear_rate != invalid)
+        {
+          scalar const shear_rate = std::sqrt(2.0 * S.norm_square());
+          integrators_scalar[slots.shear_rate]->submit_value(shear_rate, q);
+        }
+
+        if(slots.q_criterion != invalid)
+        {
+          // deviatoric part of S for compressible flow, see QCriterionCalculator
+          if(compressible_flow)
+          {
+            scalar const one_third_trace_grad_u = trace(grad_u) / 3.0;
+            for(unsigned int i = 0; i < dim; i++)
+              S[i][i] -= one_third_trace_grad_u;
+          }
+
+          scalar const Q = 0.5 * (Om.norm_square() - S.norm_square());
+          integrators_scalar[slots.q_criterion]->submit_value(Q, q);
+        }
+      }
+    }
+
+    if(integrator_vorticity)
+      integrator_vorticity->integrate_scatter(dealii::EvaluationFlags::values,
+                                              *dst[slots.vorticity]);
+
+    for(unsigned int slot = 0; slot < dst.size(); ++slot)
+      if(integrators_scalar[slot])
+        integrators_scalar[slot]->integrate_scatter(dealii::EvaluationFlags::values, *dst[slot]);
+  }
+}
+
 template class DivergenceCalculator<2, float>;
 template class DivergenceCalculator<2, double>;
 
@@ -372,4 +567,10 @@ template class QCriterionCalculator<2, double>;
 template class QCriterionCalculator<3, float>;
 template class QCriterionCalculator<3, double>;
 
+template class DerivedQuantitiesCalculator<2, float>;
+template class DerivedQuantitiesCalculator<2, double>;
+
+template class DerivedQuantitiesCalculator<3, float>;
+template class DerivedQuantitiesCalculator<3, double>;
+
 } // namespace ExaDG
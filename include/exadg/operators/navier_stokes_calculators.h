@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_OPERATORS_NAVIER_STOKES_CALCULATORS_H_
 #define INCLUDE_EXADG_OPERATORS_NAVIER_STOKES_CALCULATORS_H_
 
+// C/C++
+#include <memory>
+#include <vector>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -230,6 +234,85 @@ private:
   bool         compressible_flow;
 };
 
+/*
+ * Computes several derived quantities of the velocity field in a single cell loop: the velocity
+ * values and gradients are evaluated only once per cell and quadrature point, and each requested
+ * field is integrated into its own dst vector (right-hand side of the L2 projection, i.e., the
+ * inverse mass operator still has to be applied). Fields that are not requested are skipped.
+ */
+template<int dim, typename Number>
+class DerivedQuantitiesCalculator
+{
+private:
+  typedef DerivedQuantitiesCalculator<dim, Number> This;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef dealii::VectorizedArray<Number>                                  scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>          vector;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>          tensor;
+  typedef dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>> symmetrictensor;
+
+  typedef std::pair<unsigned int, unsigned int> Range;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
+
+public:
+  static unsigned int const number_vorticity_components = (dim == 2) ? 1 : dim;
+
+  /*
+   * dst vectors of the derived quantities, a nullptr means that the field is not computed. The
+   * vorticity is a vector-valued field in the space of the velocity, all other fields are scalar
+   * fields in the space of one velocity component.
+   */
+  struct Fields
+  {
+    VectorType * vorticity          = nullptr;
+    VectorType * divergence         = nullptr;
+    VectorType * shear_rate         = nullptr;
+    VectorType * velocity_magnitude = nullptr;
+    VectorType * q_criterion        = nullptr;
+  };
+
+  DerivedQuantitiesCalculator();
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+             unsigned int const                      dof_index_u_in,
+             unsigned int const                      dof_index_u_scalar_in,
+             unsigned int const                      quad_index_in,
+             bool const                              compressible_flow);
+
+  void
+  compute(Fields const & dst, VectorType const & src) const;
+
+private:
+  // position of the individual fields in the vector of dst vectors passed to the cell loop
+  struct Slots
+  {
+    unsigned int vorticity          = dealii::numbers::invalid_unsigned_int;
+    unsigned int divergence         = dealii::numbers::invalid_unsigned_int;
+    unsigned int shear_rate         = dealii::numbers::invalid_unsigned_int;
+    unsigned int velocity_magnitude = dealii::numbers::invalid_unsigned_int;
+    unsigned int q_criterion        = dealii::numbers::invalid_unsigned_int;
+  };
+
+  void
+  cell_loop(Slots const &                           slots,
+            dealii::MatrixFree<dim, Number> const & matrix_free,
+            std::vector<VectorType *> &             dst,
+            VectorType const &                      src,
+            Range const &                           cell_range) const;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int dof_index_u;
+  unsigned int dof_index_u_scalar;
+  unsigned int quad_index;
+  bool         compressible_flow;
+};
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_OPERATORS_NAVIER_STOKES_CALCULATORS_H_ \
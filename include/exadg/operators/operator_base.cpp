@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// C++
+#include <algorithm>
+
 // deal.II
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/lac/sparse_matrix_tools.h>
@@ -84,6 +87,10 @@ OperatorBase<dim, Number, n_components>::reinit(
     this->matrix_free->get_dof_handler(this->data.dof_index);
 
   n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(dof_handler.get_communicator());
+
+  system_matrix_dof_indices.clear();
+  system_matrix_element_matrices.clear();
+  system_matrix_cell_batch_is_cached.clear();
 }
 
 template<int dim, typename Number, int n_components>
@@ -149,6 +156,52 @@ OperatorBase<dim, Number, n_components>::vmult(VectorType & dst, VectorType cons
   this->apply(dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::vmult(
+  VectorType &                                                        dst,
+  VectorType const &                                                  src,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_before,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_after) const
+{
+  if(is_dg)
+  {
+    if(evaluate_face_integrals())
+    {
+      matrix_free->loop(&This::cell_loop,
+                        &This::face_loop,
+                        &This::boundary_face_loop_hom_operator,
+                        this,
+                        dst,
+                        src,
+                        operation_before,
+                        operation_after,
+                        this->data.dof_index);
+    }
+    else
+    {
+      matrix_free->cell_loop(
+        &This::cell_loop, this, dst, src, operation_before, operation_after, this->data.dof_index);
+    }
+  }
+  else
+  {
+    // The constrained degrees of freedom of dst are only set after the loop (see function apply()),
+    // so that the operations have to be applied to the whole vector outside of the loop.
+    operation_before(0, dst.locally_owned_size());
+
+    matrix_free->cell_loop(&This::cell_loop, this, dst, src);
+
+    for(unsigned int const constrained_index :
+        matrix_free->get_constrained_dofs(this->data.dof_index))
+    {
+      dst.local_element(constrained_index) = src.local_element(constrained_index);
+    }
+
+    operation_after(0, dst.locally_owned_size());
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::vmult_add(VectorType & dst, VectorType const & src) const
@@ -240,6 +293,8 @@ template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::apply(VectorType & dst, VectorType const & src) const
 {
+  bool const ghost_values_imported = import_ghost_values(src);
+
   if(is_dg)
   {
     if(evaluate_face_integrals())
@@ -274,12 +329,17 @@ OperatorBase<dim, Number, n_components>::apply(VectorType & dst, VectorType cons
       dst.local_element(constrained_index) = src.local_element(constrained_index);
     }
   }
+
+  if(ghost_values_imported)
+    src.zero_out_ghost_values();
 }
 
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::apply_add(VectorType & dst, VectorType const & src) const
 {
+  bool const ghost_values_imported = import_ghost_values(src);
+
   if(is_dg)
   {
     if(evaluate_face_integrals())
@@ -304,6 +364,72 @@ OperatorBase<dim, Number, n_components>::apply_add(VectorType & dst, VectorType
       dst.local_element(constrained_index) += src.local_element(constrained_index);
     }
   }
+
+  if(ghost_values_imported)
+    src.zero_out_ghost_values();
+}
+
+template<int dim, typename Number, int n_components>
+bool
+OperatorBase<dim, Number, n_components>::import_ghost_values(VectorType const & src) const
+{
+  // nothing to do if the ghost values are already up to date or there are no ghost values
+  if(not this->data.use_persistent_ghost_exchange or src.has_ghost_elements() or
+     n_mpi_processes == 1)
+  {
+    return false;
+  }
+
+  if(ghost_exchange.get() == nullptr)
+    ghost_exchange = std::make_shared<PersistentGhostExchange<Number>>();
+
+  // MatrixFree loops do not exchange ghost values of vectors that are already in ghosted state
+  ghost_exchange->update_ghost_values(src);
+
+  return true;
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_mixed_precision(VectorTypeDouble &       dst,
+                                                               VectorTypeDouble const & src) const
+{
+  dst = 0.0;
+  apply_add_mixed_precision(dst, src);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_add_mixed_precision(
+  VectorTypeDouble &       dst,
+  VectorTypeDouble const & src) const
+{
+  // The vector entries are converted to/from Number when reading/writing dof values in the
+  // integrators, i.e., the vectors are accessed only once within the matrix-free loop.
+  if(is_dg and evaluate_face_integrals())
+  {
+    matrix_free->loop(&This::cell_loop_mixed_precision,
+                      &This::face_loop_mixed_precision,
+                      &This::boundary_face_loop_mixed_precision,
+                      this,
+                      dst,
+                      src);
+  }
+  else
+  {
+    matrix_free->cell_loop(&This::cell_loop_mixed_precision, this, dst, src);
+  }
+
+  if(not is_dg)
+  {
+    // See function apply_add() for a description of the treatment of constrained degrees of
+    // freedom.
+    for(unsigned int const constrained_index :
+        matrix_free->get_constrained_dofs(this->data.dof_index))
+    {
+      dst.local_element(constrained_index) += src.local_element(constrained_index);
+    }
+  }
 }
 
 template<int dim, typename Number, int n_components>
@@ -407,6 +533,443 @@ OperatorBase<dim, Number, n_components>::evaluate_add(VectorType &       dst,
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::vmult_multiple(std::vector<VectorType *> const & dst,
+                                                        std::vector<VectorType *> const & src) const
+{
+  AssertThrow(dst.size() == src.size(),
+              dealii::ExcMessage("vmult_multiple() requires one dst vector per src vector."));
+
+  if(dst.empty())
+    return;
+
+  std::vector<VectorType *> dst_vectors = dst;
+
+  if(is_dg and evaluate_face_integrals())
+  {
+    matrix_free->loop(&This::cell_loop_multiple,
+                      &This::face_loop_multiple,
+                      &This::boundary_face_loop_multiple,
+                      this,
+                      dst_vectors,
+                      src,
+                      true);
+  }
+  else
+  {
+    matrix_free->cell_loop(&This::cell_loop_multiple, this, dst_vectors, src, true);
+  }
+
+  if(not is_dg)
+  {
+    // See function apply() for a description of the treatment of constrained degrees of freedom.
+    for(unsigned int i = 0; i < dst.size(); ++i)
+    {
+      for(unsigned int const constrained_index :
+          matrix_free->get_constrained_dofs(this->data.dof_index))
+      {
+        dst[i]->local_element(constrained_index) = src[i]->local_element(constrained_index);
+      }
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_loop_multiple(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  std::vector<VectorType *> const &       src,
+  Range const &                           range) const
+{
+  IntegratorCell integrator =
+    IntegratorCell(matrix_free, this->data.dof_index, this->data.quad_index);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    this->reinit_cell(integrator, cell);
+
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      integrator.gather_evaluate(*src[i], integrator_flags.cell_evaluate);
+
+      this->do_cell_integral(integrator);
+
+      integrator.integrate_scatter(integrator_flags.cell_integrate, *dst[i]);
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::face_loop_multiple(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  std::vector<VectorType *> const &       src,
+  Range const &                           range) const
+{
+  IntegratorFace integrator_m =
+    IntegratorFace(matrix_free, true, this->data.dof_index, this->data.quad_index);
+  IntegratorFace integrator_p =
+    IntegratorFace(matrix_free, false, this->data.dof_index, this->data.quad_index);
+
+  for(auto face = range.first; face < range.second; ++face)
+  {
+    this->reinit_face(integrator_m, integrator_p, face);
+
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      integrator_m.gather_evaluate(*src[i], integrator_flags.face_evaluate);
+      integrator_p.gather_evaluate(*src[i], integrator_flags.face_evaluate);
+
+      this->do_face_integral(integrator_m, integrator_p);
+
+      integrator_m.integrate_scatter(integrator_flags.face_integrate, *dst[i]);
+      integrator_p.integrate_scatter(integrator_flags.face_integrate, *dst[i]);
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::boundary_face_loop_multiple(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  std::vector<VectorType *> const &       src,
+  Range const &                           range) const
+{
+  IntegratorFace integrator_m =
+    IntegratorFace(matrix_free, true, this->data.dof_index, this->data.quad_index);
+
+  for(unsigned int face = range.first; face < range.second; face++)
+  {
+    this->reinit_boundary_face(integrator_m, face);
+
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      integrator_m.gather_evaluate(*src[i], integrator_flags.face_evaluate);
+
+      do_boundary_integral(integrator_m,
+                           OperatorType::homogeneous,
+                           matrix_free.get_boundary_id(face));
+
+      integrator_m.integrate_scatter(integrator_flags.face_integrate, *dst[i]);
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_add_fused(
+  std::vector<This const *> const & operators,
+  std::vector<VectorType *> const & dst,
+  VectorType const &                src)
+{
+  internal_evaluate_add_fused(operators, dst, src, OperatorType::homogeneous);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::evaluate_add_fused(
+  std::vector<This const *> const & operators,
+  std::vector<VectorType *> const & dst,
+  VectorType const &                src)
+{
+  internal_evaluate_add_fused(operators, dst, src, OperatorType::full);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::internal_evaluate_add_fused(
+  std::vector<This const *> const & operators,
+  std::vector<VectorType *> const & dst,
+  VectorType const &                src,
+  OperatorType const &              operator_type)
+{
+  AssertThrow(operators.size() > 0, dealii::ExcMessage("No operators given for fused evaluation."));
+  AssertThrow(operators.size() == dst.size(),
+              dealii::ExcMessage("Fused evaluation requires one dst vector per operator."));
+
+  This const & first = *operators[0];
+
+  bool evaluate_faces = false;
+  for(auto const op : operators)
+  {
+    AssertThrow(&op->get_matrix_free() == &first.get_matrix_free() and
+                  op->data.dof_index == first.data.dof_index and
+                  op->data.quad_index == first.data.quad_index and op->is_dg == first.is_dg,
+                dealii::ExcMessage("Fused evaluation requires all operators to be defined on the "
+                                   "same MatrixFree object, dof_index, and quad_index."));
+
+    evaluate_faces = evaluate_faces or op->evaluate_face_integrals();
+  }
+
+  AssertThrow(first.is_dg or operator_type == OperatorType::homogeneous,
+              dealii::ExcMessage("Fused evaluation of the full operator is only implemented for "
+                                 "DG discretizations."));
+
+  // MatrixFree can not write into the same vector twice within one loop. Hence, contributions to
+  // identical vectors are summed up locally and each unique dst vector is written once.
+  std::vector<VectorType *> dst_unique;
+  std::vector<unsigned int> dst_slot(operators.size());
+  for(unsigned int i = 0; i < dst.size(); ++i)
+  {
+    auto it = std::find(dst_unique.begin(), dst_unique.end(), dst[i]);
+    dst_slot[i] = std::distance(dst_unique.begin(), it);
+    if(it == dst_unique.end())
+      dst_unique.push_back(dst[i]);
+  }
+
+  auto cell_operation =
+    [&](auto const & matrix_free, auto & dst, auto const & src, auto const & range) {
+      cell_loop_fused(operators, dst_slot, matrix_free, dst, src, range);
+    };
+
+  if(first.is_dg and evaluate_faces)
+  {
+    first.matrix_free->template loop<std::vector<VectorType *>, VectorType>(
+      cell_operation,
+      [&](auto const & matrix_free, auto & dst, auto const & src, auto const & range) {
+        face_loop_fused(operators, dst_slot, matrix_free, dst, src, range);
+      },
+      [&](auto const & matrix_free, auto & dst, auto const & src, auto const & range) {
+        boundary_face_loop_fused(operators, dst_slot, operator_type, matrix_free, dst, src, range);
+      },
+      dst_unique,
+      src);
+  }
+  else
+  {
+    first.matrix_free->template cell_loop<std::vector<VectorType *>, VectorType>(cell_operation,
+                                                                                 dst_unique,
+                                                                                 src);
+  }
+
+  if(not first.is_dg)
+  {
+    // See function apply_add() for a description of the treatment of constrained degrees of
+    // freedom.
+    for(unsigned int i = 0; i < operators.size(); ++i)
+    {
+      for(unsigned int const constrained_index :
+          first.matrix_free->get_constrained_dofs(first.data.dof_index))
+      {
+        dst[i]->local_element(constrained_index) += src.local_element(constrained_index);
+      }
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_loop_fused(
+  std::vector<This const *> const &       operators,
+  std::vector<unsigned int> const &       dst_slot,
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  VectorType const &                      src,
+  Range const &                           range)
+{
+  unsigned int const dof_index  = operators[0]->data.dof_index;
+  unsigned int const quad_index = operators[0]->data.quad_index;
+
+  // every operator needs its own integrator since the quadrature point data is overwritten by
+  // do_cell_integral()
+  std::vector<std::shared_ptr<IntegratorCell>> integrators(operators.size());
+  for(auto & integrator : integrators)
+    integrator = std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index);
+
+  // the first operator writing into a dst vector collects the contributions of all other operators
+  // writing into the same vector
+  std::vector<unsigned int> first_of_slot(dst.size(), dealii::numbers::invalid_unsigned_int);
+  for(unsigned int i = 0; i < operators.size(); ++i)
+    if(first_of_slot[dst_slot[i]] == dealii::numbers::invalid_unsigned_int)
+      first_of_slot[dst_slot[i]] = i;
+
+  unsigned int const dofs_per_cell = integrators[0]->dofs_per_cell;
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    for(unsigned int i = 0; i < operators.size(); ++i)
+      operators[i]->reinit_cell(*integrators[i], cell);
+
+    // read src only once
+    integrators[0]->read_dof_values(src);
+    for(unsigned int i = 1; i < operators.size(); ++i)
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+        integrators[i]->begin_dof_values()[j] = integrators[0]->begin_dof_values()[j];
+
+    for(unsigned int i = 0; i < operators.size(); ++i)
+    {
+      integrators[i]->evaluate(operators[i]->integrator_flags.cell_evaluate);
+
+      operators[i]->do_cell_integral(*integrators[i]);
+
+      integrators[i]->integrate(operators[i]->integrator_flags.cell_integrate);
+
+      unsigned int const first = first_of_slot[dst_slot[i]];
+      if(first != i)
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          integrators[first]->begin_dof_values()[j] += integrators[i]->begin_dof_values()[j];
+    }
+
+    // write each dst vector only once
+    for(unsigned int slot = 0; slot < dst.size(); ++slot)
+      integrators[first_of_slot[slot]]->distribute_local_to_global(*dst[slot]);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::face_loop_fused(
+  std::vector<This const *> const &       operators,
+  std::vector<unsigned int> const &       dst_slot,
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  VectorType const &                      src,
+  Range const &                           range)
+{
+  unsigned int const dof_index  = operators[0]->data.dof_index;
+  unsigned int const quad_index = operators[0]->data.quad_index;
+
+  // only operators with face integrals take part in the face loop
+  std::vector<unsigned int> active;
+  for(unsigned int i = 0; i < operators.size(); ++i)
+    if(operators[i]->evaluate_face_integrals())
+      active.push_back(i);
+
+  std::vector<std::shared_ptr<IntegratorFace>> integrators_m(operators.size());
+  std::vector<std::shared_ptr<IntegratorFace>> integrators_p(operators.size());
+  for(auto const i : active)
+  {
+    integrators_m[i] = std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index);
+    integrators_p[i] = std::make_shared<IntegratorFace>(matrix_free, false, dof_index, quad_index);
+  }
+
+  std::vector<unsigned int> first_of_slot(dst.size(), dealii::numbers::invalid_unsigned_int);
+  for(auto const i : active)
+    if(first_of_slot[dst_slot[i]] == dealii::numbers::invalid_unsigned_int)
+      first_of_slot[dst_slot[i]] = i;
+
+  unsigned int const leader        = active[0];
+  unsigned int const dofs_per_cell = integrators_m[leader]->dofs_per_cell;
+
+  for(auto face = range.first; face < range.second; ++face)
+  {
+    for(auto const i : active)
+      operators[i]->reinit_face(*integrators_m[i], *integrators_p[i], face);
+
+    integrators_m[leader]->read_dof_values(src);
+    integrators_p[leader]->read_dof_values(src);
+    for(auto const i : active)
+    {
+      if(i != leader)
+      {
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          integrators_m[i]->begin_dof_values()[j] = integrators_m[leader]->begin_dof_values()[j];
+          integrators_p[i]->begin_dof_values()[j] = integrators_p[leader]->begin_dof_values()[j];
+        }
+      }
+    }
+
+    for(auto const i : active)
+    {
+      integrators_m[i]->evaluate(operators[i]->integrator_flags.face_evaluate);
+      integrators_p[i]->evaluate(operators[i]->integrator_flags.face_evaluate);
+
+      operators[i]->do_face_integral(*integrators_m[i], *integrators_p[i]);
+
+      integrators_m[i]->integrate(operators[i]->integrator_flags.face_integrate);
+      integrators_p[i]->integrate(operators[i]->integrator_flags.face_integrate);
+
+      unsigned int const first = first_of_slot[dst_slot[i]];
+      if(first != i)
+      {
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          integrators_m[first]->begin_dof_values()[j] += integrators_m[i]->begin_dof_values()[j];
+          integrators_p[first]->begin_dof_values()[j] += integrators_p[i]->begin_dof_values()[j];
+        }
+      }
+    }
+
+    for(unsigned int slot = 0; slot < dst.size(); ++slot)
+    {
+      if(first_of_slot[slot] != dealii::numbers::invalid_unsigned_int)
+      {
+        integrators_m[first_of_slot[slot]]->distribute_local_to_global(*dst[slot]);
+        integrators_p[first_of_slot[slot]]->distribute_local_to_global(*dst[slot]);
+      }
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::boundary_face_loop_fused(
+  std::vector<This const *> const &       operators,
+  std::vector<unsigned int> const &       dst_slot,
+  OperatorType const &                    operator_type,
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  VectorType const &                      src,
+  Range const &                           range)
+{
+  unsigned int const dof_index  = operators[0]->data.dof_index;
+  unsigned int const quad_index = operators[0]->data.quad_index;
+
+  std::vector<unsigned int> active;
+  for(unsigned int i = 0; i < operators.size(); ++i)
+    if(operators[i]->evaluate_face_integrals())
+      active.push_back(i);
+
+  std::vector<std::shared_ptr<IntegratorFace>> integrators_m(operators.size());
+  for(auto const i : active)
+    integrators_m[i] = std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index);
+
+  std::vector<unsigned int> first_of_slot(dst.size(), dealii::numbers::invalid_unsigned_int);
+  for(auto const i : active)
+    if(first_of_slot[dst_slot[i]] == dealii::numbers::invalid_unsigned_int)
+      first_of_slot[dst_slot[i]] = i;
+
+  unsigned int const leader        = active[0];
+  unsigned int const dofs_per_cell = integrators_m[leader]->dofs_per_cell;
+
+  for(unsigned int face = range.first; face < range.second; face++)
+  {
+    for(auto const i : active)
+      operators[i]->reinit_boundary_face(*integrators_m[i], face);
+
+    integrators_m[leader]->read_dof_values(src);
+    for(auto const i : active)
+      if(i != leader)
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          integrators_m[i]->begin_dof_values()[j] = integrators_m[leader]->begin_dof_values()[j];
+
+    for(auto const i : active)
+    {
+      integrators_m[i]->evaluate(operators[i]->integrator_flags.face_evaluate);
+
+      operators[i]->do_boundary_integral(*integrators_m[i],
+                                         operator_type,
+                                         matrix_free.get_boundary_id(face));
+
+      integrators_m[i]->integrate(operators[i]->integrator_flags.face_integrate);
+
+      unsigned int const first = first_of_slot[dst_slot[i]];
+      if(first != i)
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          integrators_m[first]->begin_dof_values()[j] += integrators_m[i]->begin_dof_values()[j];
+    }
+
+    for(unsigned int slot = 0; slot < dst.size(); ++slot)
+      if(first_of_slot[slot] != dealii::numbers::invalid_unsigned_int)
+        integrators_m[first_of_slot[slot]]->distribute_local_to_global(*dst[slot]);
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::calculate_diagonal(VectorType & diagonal) const
@@ -602,6 +1165,7 @@ OperatorBase<dim, Number, n_components>::initialize_block_diagonal_preconditione
   auto dofs =
     matrix_free->get_shape_info(this->data.dof_index).dofs_per_component_on_cell * n_components;
   matrices.resize(matrix_free->n_cell_batches() * vectorization_length, LAPACKMatrix(dofs, dofs));
+  memory_block_diagonal.set(matrices.size() * dofs * dofs * sizeof(Number));
 
   // compute and factorize matrices
   if(initialize)
@@ -822,6 +1386,14 @@ void
 OperatorBase<dim, Number, n_components>::internal_calculate_system_matrix(
   SparseMatrix & system_matrix) const
 {
+  fill_system_matrix_dof_indices();
+
+  if(this->data.cache_system_matrix_element_matrices and system_matrix_element_matrices.empty())
+  {
+    system_matrix_element_matrices.resize(matrix_free->n_cell_batches() * vectorization_length);
+    system_matrix_cell_batch_is_cached.assign(matrix_free->n_cell_batches(), false);
+  }
+
   // assemble matrix locally on each process
   if(evaluate_face_integrals() and is_dg)
   {
@@ -842,6 +1414,74 @@ OperatorBase<dim, Number, n_components>::internal_calculate_system_matrix(
 
   // communicate overlapping matrix parts
   system_matrix.compress(dealii::VectorOperation::add);
+
+  // all element matrices have been computed in the above loop
+  if(this->data.cache_system_matrix_element_matrices)
+    std::fill(system_matrix_cell_batch_is_cached.begin(),
+              system_matrix_cell_batch_is_cached.end(),
+              true);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::invalidate_system_matrix_element_matrices() const
+{
+  std::fill(system_matrix_cell_batch_is_cached.begin(),
+            system_matrix_cell_batch_is_cached.end(),
+            false);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::invalidate_system_matrix_element_matrices(
+  std::vector<unsigned int> const & cell_batches) const
+{
+  // the cache is empty before the first call of calculate_system_matrix()
+  for(unsigned int const cell : cell_batches)
+    if(cell < system_matrix_cell_batch_is_cached.size())
+      system_matrix_cell_batch_is_cached[cell] = false;
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::fill_system_matrix_dof_indices() const
+{
+  if(not system_matrix_dof_indices.empty())
+    return;
+
+  unsigned int const n_cell_batches =
+    matrix_free->n_cell_batches() + matrix_free->n_ghost_cell_batches();
+  unsigned int const dofs_per_cell =
+    matrix_free->get_dof_handler(this->data.dof_index).get_fe().n_dofs_per_cell();
+
+  system_matrix_dof_indices.resize(n_cell_batches * vectorization_length);
+
+  for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      auto const cell_v = matrix_free->get_cell_iterator(cell, v, this->data.dof_index);
+
+      std::vector<dealii::types::global_dof_index> & dof_indices =
+        system_matrix_dof_indices[cell * vectorization_length + v];
+      dof_indices.resize(dofs_per_cell);
+      if(is_mg)
+        cell_v->get_mg_dof_indices(dof_indices);
+      else
+        cell_v->get_dof_indices(dof_indices);
+
+      if(not is_dg)
+      {
+        // in the case of CG: shape functions are not ordered lexicographically
+        // see (https://www.dealii.org/8.5.1/doxygen/deal.II/classFE__Q.html)
+        // so we have to fix the order
+        auto const temp = dof_indices;
+        for(unsigned int j = 0; j < dof_indices.size(); j++)
+          dof_indices[j] =
+            temp[matrix_free->get_shape_info(this->data.dof_index).lexicographic_numbering[j]];
+      }
+    }
+  }
 }
 
 template<int dim, typename Number, int n_components>
@@ -1012,32 +1652,78 @@ OperatorBase<dim, Number, n_components>::reinit_face_cell_based(
     integrator_p.reinit(cell, face);
   }
 
-  reinit_face_cell_based_derived(integrator_m, integrator_p, cell, face, boundary_id);
+  reinit_face_cell_based_derived(integrator_m, integrator_p, cell, face, boundary_id);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::reinit_face_cell_based_derived(
+  IntegratorFace &                 integrator_m,
+  IntegratorFace &                 integrator_p,
+  unsigned int const               cell,
+  unsigned int const               face,
+  dealii::types::boundary_id const boundary_id) const
+{
+  (void)integrator_m;
+  (void)integrator_p;
+  (void)cell;
+  (void)face;
+  (void)boundary_id;
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::do_face_int_integral_cell_based(
+  IntegratorFace & integrator_m,
+  IntegratorFace & integrator_p) const
+{
+  this->do_face_int_integral(integrator_m, integrator_p);
+}
+
+template<int dim, typename Number, int n_components>
+bool
+OperatorBase<dim, Number, n_components>::cell_loop_fixed_degree(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  (void)matrix_free;
+  (void)dst;
+  (void)src;
+  (void)range;
+
+  // override this function in derived classes providing cell integrals with compile-time degree
+  return false;
+}
+
+template<int dim, typename Number, int n_components>
+bool
+OperatorBase<dim, Number, n_components>::cell_loop_dense_simplex(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  (void)matrix_free;
+  (void)dst;
+  (void)src;
+  (void)range;
+
+  // override this function in derived classes providing dense cell integrals for simplex elements
+  return false;
 }
 
 template<int dim, typename Number, int n_components>
-void
-OperatorBase<dim, Number, n_components>::reinit_face_cell_based_derived(
-  IntegratorFace &                 integrator_m,
-  IntegratorFace &                 integrator_p,
-  unsigned int const               cell,
-  unsigned int const               face,
-  dealii::types::boundary_id const boundary_id) const
+FastDiagonalizationCoefficients
+OperatorBase<dim, Number, n_components>::get_fast_diagonalization_coefficients() const
 {
-  (void)integrator_m;
-  (void)integrator_p;
-  (void)cell;
-  (void)face;
-  (void)boundary_id;
-}
+  // override this function in derived classes supporting the fast diagonalization preconditioner
+  AssertThrow(false,
+              dealii::ExcMessage(
+                "The fast diagonalization preconditioner is not implemented for this operator."));
 
-template<int dim, typename Number, int n_components>
-void
-OperatorBase<dim, Number, n_components>::do_face_int_integral_cell_based(
-  IntegratorFace & integrator_m,
-  IntegratorFace & integrator_p) const
-{
-  this->do_face_int_integral(integrator_m, integrator_p);
+  return FastDiagonalizationCoefficients();
 }
 
 template<int dim, typename Number, int n_components>
@@ -1119,6 +1805,14 @@ OperatorBase<dim, Number, n_components>::cell_loop(
   VectorType const &                      src,
   Range const &                           range) const
 {
+  if(this->data.use_dense_simplex_kernels and
+     this->cell_loop_dense_simplex(matrix_free, dst, src, range))
+    return;
+
+  if(this->data.use_fixed_degree_kernels and
+     this->cell_loop_fixed_degree(matrix_free, dst, src, range))
+    return;
+
   IntegratorCell integrator =
     IntegratorCell(matrix_free, this->data.dof_index, this->data.quad_index);
 
@@ -1186,6 +1880,81 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_hom_operator(
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_loop_mixed_precision(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorTypeDouble &                      dst,
+  VectorTypeDouble const &                src,
+  Range const &                           range) const
+{
+  IntegratorCell integrator =
+    IntegratorCell(matrix_free, this->data.dof_index, this->data.quad_index);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    this->reinit_cell(integrator, cell);
+
+    integrator.gather_evaluate(src, integrator_flags.cell_evaluate);
+
+    this->do_cell_integral(integrator);
+
+    integrator.integrate_scatter(integrator_flags.cell_integrate, dst);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::face_loop_mixed_precision(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorTypeDouble &                      dst,
+  VectorTypeDouble const &                src,
+  Range const &                           range) const
+{
+  IntegratorFace integrator_m =
+    IntegratorFace(matrix_free, true, this->data.dof_index, this->data.quad_index);
+  IntegratorFace integrator_p =
+    IntegratorFace(matrix_free, false, this->data.dof_index, this->data.quad_index);
+
+  for(auto face = range.first; face < range.second; ++face)
+  {
+    this->reinit_face(integrator_m, integrator_p, face);
+
+    integrator_m.gather_evaluate(src, integrator_flags.face_evaluate);
+    integrator_p.gather_evaluate(src, integrator_flags.face_evaluate);
+
+    this->do_face_integral(integrator_m, integrator_p);
+
+    integrator_m.integrate_scatter(integrator_flags.face_integrate, dst);
+    integrator_p.integrate_scatter(integrator_flags.face_integrate, dst);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::boundary_face_loop_mixed_precision(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorTypeDouble &                      dst,
+  VectorTypeDouble const &                src,
+  Range const &                           range) const
+{
+  IntegratorFace integrator_m =
+    IntegratorFace(matrix_free, true, this->data.dof_index, this->data.quad_index);
+
+  for(unsigned int face = range.first; face < range.second; face++)
+  {
+    this->reinit_boundary_face(integrator_m, face);
+
+    integrator_m.gather_evaluate(src, integrator_flags.face_evaluate);
+
+    do_boundary_integral(integrator_m,
+                         OperatorType::homogeneous,
+                         matrix_free.get_boundary_id(face));
+
+    integrator_m.integrate_scatter(integrator_flags.face_integrate, dst);
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::boundary_face_loop_inhom_operator(
@@ -1813,6 +2582,8 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
 
   unsigned int const dofs_per_cell = integrator.dofs_per_cell;
 
+  bool const use_cache = this->data.cache_system_matrix_element_matrices;
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
@@ -1820,54 +2591,49 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
     // create a temporal full matrix for the local element matrix of each ...
     // cell of each macro cell and ...
     FullMatrix_ matrices[vectorization_length];
-    // set their size
-    std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
 
-    this->reinit_cell(integrator, cell);
+    bool const is_cached = use_cache and system_matrix_cell_batch_is_cached[cell];
 
-    for(unsigned int j = 0; j < dofs_per_cell; ++j)
+    if(not is_cached)
     {
-      this->create_standard_basis(j, integrator);
+      // set their size
+      std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
 
-      integrator.evaluate(integrator_flags.cell_evaluate);
+      this->reinit_cell(integrator, cell);
 
-      this->do_cell_integral(integrator);
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+      {
+        this->create_standard_basis(j, integrator);
 
-      integrator.integrate(integrator_flags.cell_integrate);
+        integrator.evaluate(integrator_flags.cell_evaluate);
 
-      for(unsigned int i = 0; i < dofs_per_cell; ++i)
-        for(unsigned int v = 0; v < n_filled_lanes; ++v)
-          matrices[v](i, j) = integrator.begin_dof_values()[i][v];
+        this->do_cell_integral(integrator);
+
+        integrator.integrate(integrator_flags.cell_integrate);
+
+        for(unsigned int i = 0; i < dofs_per_cell; ++i)
+          for(unsigned int v = 0; v < n_filled_lanes; ++v)
+            matrices[v](i, j) = integrator.begin_dof_values()[i][v];
+      }
+
+      if(use_cache)
+        for(unsigned int v = 0; v < n_filled_lanes; v++)
+          system_matrix_element_matrices[cell * vectorization_length + v] = matrices[v];
     }
 
     // finally assemble local matrices into global matrix
     for(unsigned int v = 0; v < n_filled_lanes; v++)
     {
-      auto cell_v = matrix_free.get_cell_iterator(cell, v);
-
-      std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
-      if(is_mg)
-        cell_v->get_mg_dof_indices(dof_indices);
-      else
-        cell_v->get_dof_indices(dof_indices);
-
-      if(not is_dg)
-      {
-        // in the case of CG: shape functions are not ordered lexicographically
-        // see (https://www.dealii.org/8.5.1/doxygen/deal.II/classFE__Q.html)
-        // so we have to fix the order
-        auto temp = dof_indices;
-        for(unsigned int j = 0; j < dof_indices.size(); j++)
-          dof_indices[j] =
-            temp[matrix_free.get_shape_info(this->data.dof_index).lexicographic_numbering[j]];
-      }
+      FullMatrix_ const & matrix =
+        is_cached ? system_matrix_element_matrices[cell * vectorization_length + v] : matrices[v];
 
       // choose the version of distribute_local_to_global with a single
       // `dof_indices` argument to indicate that we write to a diagonal block
       // of the matrix (vs 2 for off-diagonal ones); this implies a non-zero
       // entry is added to the diagonal of constrained matrix rows, ensuring
       // positive definiteness
-      constraint_double.distribute_local_to_global(matrices[v], dof_indices, dst);
+      constraint_double.distribute_local_to_global(
+        matrix, system_matrix_dof_indices[cell * vectorization_length + v], dst);
     }
   }
 }
@@ -1945,24 +2711,11 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
       auto const cell_number_m = matrix_free.get_face_info(face).cells_interior[v];
       auto const cell_number_p = matrix_free.get_face_info(face).cells_exterior[v];
 
-      auto cell_m = matrix_free.get_cell_iterator(cell_number_m / vectorization_length,
-                                                  cell_number_m % vectorization_length);
-      auto cell_p = matrix_free.get_cell_iterator(cell_number_p / vectorization_length,
-                                                  cell_number_p % vectorization_length);
-
       // get position in global matrix
-      std::vector<dealii::types::global_dof_index> dof_indices_m(dofs_per_cell);
-      std::vector<dealii::types::global_dof_index> dof_indices_p(dofs_per_cell);
-      if(is_mg)
-      {
-        cell_m->get_mg_dof_indices(dof_indices_m);
-        cell_p->get_mg_dof_indices(dof_indices_p);
-      }
-      else
-      {
-        cell_m->get_dof_indices(dof_indices_m);
-        cell_p->get_dof_indices(dof_indices_p);
-      }
+      std::vector<dealii::types::global_dof_index> const & dof_indices_m =
+        system_matrix_dof_indices[cell_number_m];
+      std::vector<dealii::types::global_dof_index> const & dof_indices_p =
+        system_matrix_dof_indices[cell_number_p];
 
       // save M_mm
       constraint_double.distribute_local_to_global(matrices_m[v], dof_indices_m, dst);
@@ -2005,24 +2758,11 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
       auto const cell_number_m = matrix_free.get_face_info(face).cells_interior[v];
       auto const cell_number_p = matrix_free.get_face_info(face).cells_exterior[v];
 
-      auto cell_m = matrix_free.get_cell_iterator(cell_number_m / vectorization_length,
-                                                  cell_number_m % vectorization_length);
-      auto cell_p = matrix_free.get_cell_iterator(cell_number_p / vectorization_length,
-                                                  cell_number_p % vectorization_length);
-
       // get position in global matrix
-      std::vector<dealii::types::global_dof_index> dof_indices_m(dofs_per_cell);
-      std::vector<dealii::types::global_dof_index> dof_indices_p(dofs_per_cell);
-      if(is_mg)
-      {
-        cell_m->get_mg_dof_indices(dof_indices_m);
-        cell_p->get_mg_dof_indices(dof_indices_p);
-      }
-      else
-      {
-        cell_m->get_dof_indices(dof_indices_m);
-        cell_p->get_dof_indices(dof_indices_p);
-      }
+      std::vector<dealii::types::global_dof_index> const & dof_indices_m =
+        system_matrix_dof_indices[cell_number_m];
+      std::vector<dealii::types::global_dof_index> const & dof_indices_p =
+        system_matrix_dof_indices[cell_number_p];
 
       // save M_mp
       constraint_double.distribute_local_to_global(matrices_m[v],
@@ -2083,16 +2823,9 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
     {
       unsigned int const cell_number = matrix_free.get_face_info(face).cells_interior[v];
 
-      auto cell_v = matrix_free.get_cell_iterator(cell_number / vectorization_length,
-                                                  cell_number % vectorization_length);
-
-      std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
-      if(is_mg)
-        cell_v->get_mg_dof_indices(dof_indices);
-      else
-        cell_v->get_dof_indices(dof_indices);
-
-      constraint_double.distribute_local_to_global(matrices[v], dof_indices, dst);
+      constraint_double.distribute_local_to_global(matrices[v],
+                                                   system_matrix_dof_indices[cell_number],
+                                                   dst);
     }
   }
 }
@@ -2157,38 +2890,9 @@ OperatorBase<dim, Number, n_components>::internal_compute_factorized_additive_sc
     internal_init_system_matrix(tmp_matrix, dsp, dof_handler.get_communicator());
     internal_calculate_system_matrix(tmp_matrix);
 
-    // collect the DoF indices of all cells
-    std::vector<std::vector<dealii::types::global_dof_index>> dof_indices_all_cells(
-      n_cells, std::vector<dealii::types::global_dof_index>(dofs_per_cell));
-    // and compute weights by counting the contributions to a DoF
-    initialize_dof_vector(weights);
-    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
-    {
-      unsigned int const n_filled_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
-
-      for(unsigned int v = 0; v < n_filled_lanes; ++v)
-      {
-        auto const & cell_v = matrix_free->get_cell_iterator(cell, v);
-
-        auto & dof_indices = dof_indices_all_cells[cell * vectorization_length + v];
-        if(is_mg)
-          cell_v->get_mg_dof_indices(dof_indices);
-        else
-          cell_v->get_dof_indices(dof_indices);
-
-        for(auto const & i : dof_indices)
-          weights[i] += 1.;
-      }
-    }
-    weights.compress(dealii::VectorOperation::add);
-
-    // prepare the weights vector for symmetric weighting
-    for(unsigned int i = 0; i < weights.size(); ++i)
-    {
-      if(weights.in_local_range(i))
-        weights[i] = 1. / std::sqrt(weights[i]);
-    }
-    weights.update_ghost_values();
+    // collect the DoF indices of all cells and compute weights
+    std::vector<std::vector<dealii::types::global_dof_index>> dof_indices_all_cells =
+      compute_additive_schwarz_weights();
 
     // cut out overlapped block matrices
     std::vector<dealii::FullMatrix<Number>> overlapped_cell_matrices(
@@ -2230,6 +2934,50 @@ OperatorBase<dim, Number, n_components>::internal_compute_factorized_additive_sc
   }
 }
 
+template<int dim, typename Number, int n_components>
+std::vector<std::vector<dealii::types::global_dof_index>>
+OperatorBase<dim, Number, n_components>::compute_additive_schwarz_weights() const
+{
+  unsigned int const dofs_per_cell = matrix_free->get_dofs_per_cell(this->data.dof_index);
+
+  unsigned int const n_cells = matrix_free->n_cell_batches() * vectorization_length;
+
+  // collect the DoF indices of all cells
+  std::vector<std::vector<dealii::types::global_dof_index>> dof_indices_all_cells(
+    n_cells, std::vector<dealii::types::global_dof_index>(dofs_per_cell));
+  // and compute weights by counting the contributions to a DoF
+  initialize_dof_vector(weights);
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    unsigned int const n_filled_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
+
+    for(unsigned int v = 0; v < n_filled_lanes; ++v)
+    {
+      auto const & cell_v = matrix_free->get_cell_iterator(cell, v);
+
+      auto & dof_indices = dof_indices_all_cells[cell * vectorization_length + v];
+      if(is_mg)
+        cell_v->get_mg_dof_indices(dof_indices);
+      else
+        cell_v->get_dof_indices(dof_indices);
+
+      for(auto const & i : dof_indices)
+        weights[i] += 1.;
+    }
+  }
+  weights.compress(dealii::VectorOperation::add);
+
+  // prepare the weights vector for symmetric weighting
+  for(unsigned int i = 0; i < weights.size(); ++i)
+  {
+    if(weights.in_local_range(i))
+      weights[i] = 1. / std::sqrt(weights[i]);
+  }
+  weights.update_ghost_values();
+
+  return dof_indices_all_cells;
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::apply_inverse_additive_schwarz_matrices(
@@ -2287,6 +3035,124 @@ OperatorBase<dim, Number, n_components>::apply_inverse_additive_schwarz_matrices
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::update_fast_diagonalization() const
+{
+  // continuous elements: overlapping cell blocks with symmetric weighting as for additive Schwarz
+  if(not is_dg)
+    compute_additive_schwarz_weights();
+
+  this->reinit_fast_diagonalization_kernel(fast_diagonalization_kernel);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::reinit_fast_diagonalization_kernel(
+  FastDiagonalizationKernel<dim, Number> & kernel) const
+{
+  AssertThrow(is_dg,
+              dealii::ExcMessage("The separable approximation of the fast diagonalization "
+                                 "preconditioner is only implemented for DG."));
+
+  kernel.reinit(*matrix_free,
+                this->data.dof_index,
+                this->data.quad_index,
+                this->get_fast_diagonalization_coefficients());
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_inverse_fast_diagonalization(
+  VectorType &       dst,
+  VectorType const & src) const
+{
+  if(is_dg)
+  {
+    matrix_free->template cell_loop<VectorType, VectorType>(
+      [&](auto const & matrix_free, auto & dst, auto const & src, auto const & cell_range) {
+        IntegratorCell integrator =
+          IntegratorCell(matrix_free, this->data.dof_index, this->data.quad_index);
+
+        dealii::AlignedVector<dealii::VectorizedArray<Number>> local_src(integrator.dofs_per_cell);
+        for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+        {
+          this->reinit_cell(integrator, cell);
+
+          integrator.read_dof_values(src);
+
+          for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+            local_src[i] = integrator.begin_dof_values()[i];
+
+          fast_diagonalization_kernel.apply_inverse(cell,
+                                                    integrator.begin_dof_values(),
+                                                    local_src.data(),
+                                                    n_components);
+
+          integrator.set_dof_values(dst);
+        }
+      },
+      dst,
+      src);
+  }
+  else
+  {
+    // sum of the overlapping cell contributions with the same symmetric weighting as
+    // apply_inverse_additive_schwarz_matrices()
+    matrix_free->template cell_loop<VectorType, VectorType>(
+      [&](auto const & matrix_free, auto & dst, auto const & src, auto const & cell_range) {
+        IntegratorCell integrator =
+          IntegratorCell(matrix_free, this->data.dof_index, this->data.quad_index);
+
+        dealii::AlignedVector<dealii::VectorizedArray<Number>> local_weights(
+          integrator.dofs_per_cell);
+        dealii::AlignedVector<dealii::VectorizedArray<Number>> local_src(integrator.dofs_per_cell);
+        for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+        {
+          this->reinit_cell(integrator, cell);
+
+          integrator.read_dof_values(weights);
+          for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+            local_weights[i] = integrator.begin_dof_values()[i];
+
+          integrator.read_dof_values(src);
+          for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+            local_src[i] = integrator.begin_dof_values()[i] * local_weights[i];
+
+          fast_diagonalization_kernel.apply_inverse(cell,
+                                                    integrator.begin_dof_values(),
+                                                    local_src.data(),
+                                                    n_components);
+
+          for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+            integrator.begin_dof_values()[i] *= local_weights[i];
+
+          integrator.distribute_local_to_global(dst);
+        }
+      },
+      dst,
+      src,
+      true);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_inverse_fast_diagonalization_cell(
+  unsigned int const                      cell,
+  dealii::VectorizedArray<Number> *       dst,
+  dealii::VectorizedArray<Number> const * src) const
+{
+  fast_diagonalization_kernel.apply_inverse(cell, dst, src, n_components);
+}
+
+template<int dim, typename Number, int n_components>
+std::size_t
+OperatorBase<dim, Number, n_components>::memory_consumption_fast_diagonalization() const
+{
+  return fast_diagonalization_kernel.memory_consumption();
+}
+
 
 template class OperatorBase<2, float, 1>;
 template class OperatorBase<2, float, 2>;
@@ -22,6 +22,9 @@
 #ifndef OPERATION_BASE_H
 #define OPERATION_BASE_H
 
+// C++
+#include <functional>
+
 // deal.II
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/dofs/dof_handler.h>
@@ -39,6 +42,7 @@
 // ExaDG
 #include <exadg/matrix_free/categorization.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/utilities/memory_report.h>
 
 #include <exadg/solvers_and_preconditioners/preconditioners/elementwise_preconditioners.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
@@ -49,9 +53,11 @@
 #include <exadg/utilities/lazy_ptr.h>
 
 #include <exadg/operators/elementwise_operator.h>
+#include <exadg/operators/fast_diagonalization_kernel.h>
 #include <exadg/operators/integrator_flags.h>
 #include <exadg/operators/mapping_flags.h>
 #include <exadg/operators/operator_type.h>
+#include <exadg/operators/persistent_ghost_exchange.h>
 
 namespace ExaDG
 {
@@ -63,6 +69,10 @@ struct OperatorBaseData
       quad_index(0),
       operator_is_singular(false),
       use_cell_based_loops(false),
+      use_fixed_degree_kernels(false),
+      use_dense_simplex_kernels(false),
+      cache_system_matrix_element_matrices(false),
+      use_persistent_ghost_exchange(false),
       implement_block_diagonal_preconditioner_matrix_free(false),
       solver_block_diagonal(Elementwise::Solver::GMRES),
       preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
@@ -84,6 +94,26 @@ struct OperatorBaseData
 
   bool use_cell_based_loops;
 
+  // Evaluate cell integrals with integrators having the polynomial degree known at compile time
+  // (see CellIntegratorFixedDegree), if the derived operator provides such an implementation. If
+  // not available, the default integrators with runtime polynomial degree are used.
+  bool use_fixed_degree_kernels;
+
+  // Evaluate cell integrals on affine simplex cells with dense reference matrices (see
+  // DenseSimplexKernel), if the derived operator provides such an implementation. Non-affine cells
+  // and hypercube meshes are treated by the default integrators.
+  bool use_dense_simplex_kernels;
+
+  // Keep the element matrices of the cell integrals computed in calculate_system_matrix() and
+  // reuse them in subsequent calls, e.g. when an AMG preconditioner is updated. Only cell batches
+  // marked via invalidate_system_matrix_element_matrices() are recomputed. Face integrals are
+  // always recomputed.
+  bool cache_system_matrix_element_matrices;
+
+  // Import the ghost values of the src-vector in apply() and apply_add() via persistent MPI
+  // requests, see PersistentGhostExchange, instead of the exchange within the MatrixFree loops.
+  bool use_persistent_ghost_exchange;
+
   // block Jacobi preconditioner
   bool implement_block_diagonal_preconditioner_matrix_free;
 
@@ -100,6 +130,7 @@ public:
   typedef OperatorBase<dim, Number, n_components> This;
 
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorTypeDouble;
   typedef std::pair<unsigned int, unsigned int>              Range;
   typedef CellIntegrator<dim, n_components, Number>          IntegratorCell;
   typedef FaceIntegrator<dim, n_components, Number>          IntegratorFace;
@@ -150,6 +181,20 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Matrix-vector product with operations on index ranges of the locally owned dofs that are
+   * executed within the matrix-free loop before the first and after the last access to the
+   * respective vector entries, see dealii::MatrixFree::loop(). The operation before the
+   * matrix-vector product is responsible for zeroing dst. This interface is detected by
+   * dealii::PreconditionChebyshev to merge the vector updates of the Chebyshev recurrence into the
+   * operator evaluation.
+   */
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after) const;
+
   void
   vmult_add(VectorType & dst, VectorType const & src) const;
 
@@ -232,6 +277,18 @@ public:
   calculate_system_matrix(dealii::PETScWrappers::MPI::SparseMatrix & system_matrix) const;
 #endif
 
+  /*
+   * Marks the cached element matrices of all cell batches (or of the given cell batches) as
+   * outdated so that they are recomputed in the next call of calculate_system_matrix(). Only
+   * relevant if OperatorBaseData::cache_system_matrix_element_matrices is set, in which case the
+   * owner of the operator has to call this function whenever the cell integrals change.
+   */
+  void
+  invalidate_system_matrix_element_matrices() const;
+
+  void
+  invalidate_system_matrix_element_matrices(std::vector<unsigned int> const & cell_batches) const;
+
   /*
    * Evaluate the homogeneous part of an operator. The homogeneous operator is the operator that is
    * obtained for homogeneous boundary conditions. This operation is typically applied in linear
@@ -293,9 +350,62 @@ public:
   evaluate_add(VectorType & dst, VectorType const & src) const;
 
   /*
-   * point Jacobi preconditioner (diagonal)
+   * Applies the homogeneous operator to several vectors src[i] within a single loop over cells and
+   * faces, dst[i] = A src[i]. The integrators are initialized only once per cell/face batch for all
+   * vectors, i.e., the geometry data is loaded from memory once and reused from cache for the
+   * other vectors, which increases the arithmetic intensity of the operator application. The
+   * typical use case is the solution of linear systems with many right-hand sides. The generic
+   * cell kernel do_cell_integral() is used for all vectors, i.e., the specialized kernels of
+   * cell_loop() (fixed-degree and dense simplex kernels) are not used by this function.
+   */
+  void
+  vmult_multiple(std::vector<VectorType *> const & dst,
+                 std::vector<VectorType *> const & src) const;
+
+  /*
+   * Fused evaluation of several operators: The homogeneous parts of all operators are evaluated
+   * within a single loop over cells and faces, i.e., the vector src is read only once per cell/face
+   * batch and the contribution of operators[i] is added to the vector dst[i]. If several entries of
+   * dst refer to the same vector, the contributions are summed up locally and the vector is written
+   * only once per cell/face batch. All operators have to be initialized with the same MatrixFree
+   * object, dof_index, and quad_index.
+   */
+  static void
+  apply_add_fused(std::vector<This const *> const & operators,
+                  std::vector<VectorType *> const & dst,
+                  VectorType const &                src);
+
+  /*
+   * Same as apply_add_fused(), but for the full operator (homogeneous and inhomogeneous
+   * contributions), see function evaluate(). This function is only implemented for DG
+   * discretizations.
+   */
+  static void
+  evaluate_add_fused(std::vector<This const *> const & operators,
+                     std::vector<VectorType *> const & dst,
+                     VectorType const &                src);
+
+  /*
+   * Mixed-precision variant of apply(): The matrix-free kernel is evaluated in precision Number
+   * (typically float, i.e., geometry data and arithmetic in single precision), while the vectors
+   * src and dst are stored in double precision. The conversion between the two number types is
+   * done when reading/writing vector entries within the matrix-free loop, so that no additional
+   * sweeps over the vectors are required. The typical use case is the matrix-vector product of
+   * an outer Krylov solver operating on double vectors.
+   */
+  void
+  apply_mixed_precision(VectorTypeDouble & dst, VectorTypeDouble const & src) const;
+
+  /*
+   * See function apply_mixed_precision() for a description.
    */
   void
+  apply_add_mixed_precision(VectorTypeDouble & dst, VectorTypeDouble const & src) const;
+
+  /*
+   * point Jacobi preconditioner (diagonal)
+   */
+  virtual void
   calculate_diagonal(VectorType & diagonal) const;
 
   void
@@ -304,7 +414,7 @@ public:
   /*
    * block Jacobi preconditioner (block-diagonal)
    */
-  void
+  virtual void
   add_block_diagonal_matrices(std::vector<LAPACKMatrix> & matrices) const;
 
   void
@@ -346,6 +456,30 @@ public:
   void
   apply_inverse_additive_schwarz_matrices(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * fast diagonalization preconditioner (cellwise block-diagonal on hypercube meshes with
+   * separable approximations of the cell blocks, see FastDiagonalizationKernel; for continuous
+   * elements, the overlapping cell blocks are weighted as for the additive Schwarz preconditioner)
+   */
+  void
+  update_fast_diagonalization() const;
+
+  void
+  apply_inverse_fast_diagonalization(VectorType & dst, VectorType const & src) const;
+
+  /*
+   * Applies the inverse cell block of cell batch cell to the dof values src in the layout of
+   * FEEvaluation::begin_dof_values(), as needed by elementwise solvers. The arrays dst and src
+   * must not overlap.
+   */
+  void
+  apply_inverse_fast_diagonalization_cell(unsigned int const                      cell,
+                                          dealii::VectorizedArray<Number> *       dst,
+                                          dealii::VectorizedArray<Number> const * src) const;
+
+  std::size_t
+  memory_consumption_fast_diagonalization() const;
+
 protected:
   void
   reinit(dealii::MatrixFree<dim, Number> const &   matrix_free,
@@ -410,6 +544,46 @@ protected:
   do_face_int_integral_cell_based(IntegratorFace & integrator_m,
                                   IntegratorFace & integrator_p) const;
 
+  /*
+   * Cell loop with integrators of compile-time polynomial degree, see
+   * OperatorBaseData::use_fixed_degree_kernels. Derived classes may override this function, which
+   * has to return true if the cell integrals have been computed for the given range. If false is
+   * returned, the default cell loop is used.
+   */
+  virtual bool
+  cell_loop_fixed_degree(dealii::MatrixFree<dim, Number> const & matrix_free,
+                         VectorType &                            dst,
+                         VectorType const &                      src,
+                         Range const &                           range) const;
+
+  /*
+   * Cell loop with dense reference-cell matrices for simplex meshes, see
+   * OperatorBaseData::use_dense_simplex_kernels. The same conventions as for
+   * cell_loop_fixed_degree() apply.
+   */
+  virtual bool
+  cell_loop_dense_simplex(dealii::MatrixFree<dim, Number> const & matrix_free,
+                          VectorType &                            dst,
+                          VectorType const &                      src,
+                          Range const &                           range) const;
+
+  /*
+   * Coefficients of the separable approximation of the cell blocks used by the fast
+   * diagonalization preconditioner. Derived classes supporting this preconditioner have to
+   * override this function.
+   */
+  virtual FastDiagonalizationCoefficients
+  get_fast_diagonalization_coefficients() const;
+
+  /*
+   * Sets up the cell blocks of the fast diagonalization preconditioner. The default
+   * implementation uses the separable approximation given by
+   * get_fast_diagonalization_coefficients(). Derived classes with other separable approximations
+   * may override this function.
+   */
+  virtual void
+  reinit_fast_diagonalization_kernel(FastDiagonalizationKernel<dim, Number> & kernel) const;
+
   /*
    * Matrix-free object.
    */
@@ -555,6 +729,93 @@ private:
                                    VectorType const &                      src,
                                    Range const &                           range) const;
 
+  /*
+   * Imports the ghost values of src via the persistent exchange if requested by
+   * OperatorBaseData::use_persistent_ghost_exchange. Returns true if this is the case, and the
+   * ghost values have to be zeroed by the caller after the MatrixFree loop.
+   */
+  bool
+  import_ghost_values(VectorType const & src) const;
+
+  /*
+   * Fused evaluation of several operators, see function apply_add_fused(). The vector dst_slot
+   * maps operator i to the (unique) dst vector the contribution is added to.
+   */
+  static void
+  internal_evaluate_add_fused(std::vector<This const *> const & operators,
+                              std::vector<VectorType *> const & dst,
+                              VectorType const &                src,
+                              OperatorType const &              operator_type);
+
+  /*
+   * Loops applying the homogeneous operator to several vectors, see function vmult_multiple().
+   */
+  void
+  cell_loop_multiple(dealii::MatrixFree<dim, Number> const & matrix_free,
+                     std::vector<VectorType *> &             dst,
+                     std::vector<VectorType *> const &       src,
+                     Range const &                           range) const;
+
+  void
+  face_loop_multiple(dealii::MatrixFree<dim, Number> const & matrix_free,
+                     std::vector<VectorType *> &             dst,
+                     std::vector<VectorType *> const &       src,
+                     Range const &                           range) const;
+
+  void
+  boundary_face_loop_multiple(dealii::MatrixFree<dim, Number> const & matrix_free,
+                              std::vector<VectorType *> &             dst,
+                              std::vector<VectorType *> const &       src,
+                              Range const &                           range) const;
+
+  static void
+  cell_loop_fused(std::vector<This const *> const &       operators,
+                  std::vector<unsigned int> const &       dst_slot,
+                  dealii::MatrixFree<dim, Number> const & matrix_free,
+                  std::vector<VectorType *> &             dst,
+                  VectorType const &                      src,
+                  Range const &                           range);
+
+  static void
+  face_loop_fused(std::vector<This const *> const &       operators,
+                  std::vector<unsigned int> const &       dst_slot,
+                  dealii::MatrixFree<dim, Number> const & matrix_free,
+                  std::vector<VectorType *> &             dst,
+                  VectorType const &                      src,
+                  Range const &                           range);
+
+  static void
+  boundary_face_loop_fused(std::vector<This const *> const &       operators,
+                           std::vector<unsigned int> const &       dst_slot,
+                           OperatorType const &                    operator_type,
+                           dealii::MatrixFree<dim, Number> const & matrix_free,
+                           std::vector<VectorType *> &             dst,
+                           VectorType const &                      src,
+                           Range const &                           range);
+
+  /*
+   * Loops of the mixed-precision evaluation of the homogeneous operator, see function
+   * apply_mixed_precision(). The integrators operate in precision Number, while the vector entries
+   * are read from/written to double vectors.
+   */
+  void
+  cell_loop_mixed_precision(dealii::MatrixFree<dim, Number> const & matrix_free,
+                            VectorTypeDouble &                      dst,
+                            VectorTypeDouble const &                src,
+                            Range const &                           range) const;
+
+  void
+  face_loop_mixed_precision(dealii::MatrixFree<dim, Number> const & matrix_free,
+                            VectorTypeDouble &                      dst,
+                            VectorTypeDouble const &                src,
+                            Range const &                           range) const;
+
+  void
+  boundary_face_loop_mixed_precision(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                     VectorTypeDouble &                      dst,
+                                     VectorTypeDouble const &                src,
+                                     Range const &                           range) const;
+
   /*
    * inhomogeneous operator: For the inhomogeneous operator, we only have to calculate boundary face
    * integrals. The matrix-free implementation, however, does not offer interfaces for boundary face
@@ -653,6 +914,13 @@ private:
   void
   internal_calculate_system_matrix(SparseMatrix & system_matrix) const;
 
+  /*
+   * Fills the global dof indices of all locally owned and ghost cells, which map the rows and
+   * columns of element matrices to the sparse matrix.
+   */
+  void
+  fill_system_matrix_dof_indices() const;
+
   /*
    * Calculate sparse matrix.
    */
@@ -697,6 +965,14 @@ private:
   void
   internal_compute_factorized_additive_schwarz_matrices() const;
 
+  /*
+   * Computes the weights of the additive Schwarz preconditioner for continuous elements, i.e., one
+   * over the square root of the number of cells sharing a DoF, and returns the DoF indices of all
+   * cells.
+   */
+  std::vector<std::vector<dealii::types::global_dof_index>>
+  compute_additive_schwarz_weights() const;
+
   /*
    * Data structure containing all operator-specific data.
    */
@@ -713,11 +989,39 @@ private:
    */
   mutable std::vector<LAPACKMatrix> matrices;
 
+  /*
+   * Memory of the block-diagonal matrices, see MemoryReport.
+   */
+  mutable MemoryReport::Entry memory_block_diagonal{MemoryCategory::BlockDiagonalMatrices};
+
   /*
    * Vector with weights for additive Schwarz preconditioner.
    */
   mutable VectorType weights;
 
+  /*
+   * Separable cell blocks for the fast diagonalization preconditioner.
+   */
+  mutable FastDiagonalizationKernel<dim, Number> fast_diagonalization_kernel;
+
+  /*
+   * Global dof indices of the cells in the ordering of the integrators, with index
+   * cell_batch * vectorization_length + lane.
+   */
+  mutable std::vector<std::vector<dealii::types::global_dof_index>> system_matrix_dof_indices;
+
+  /*
+   * Cached element matrices of the cell integrals (same indexing as system_matrix_dof_indices)
+   * and flags indicating which cell batches hold up-to-date element matrices.
+   */
+  mutable std::vector<FullMatrix_> system_matrix_element_matrices;
+  mutable std::vector<bool>        system_matrix_cell_batch_is_cached;
+
+  /*
+   * Persistent exchange of the ghost values of the src-vector, created at first use.
+   */
+  mutable std::shared_ptr<PersistentGhostExchange<Number>> ghost_exchange;
+
   unsigned int n_mpi_processes;
 };
 } // namespace ExaDG
@@ -0,0 +1,178 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_OPERATORS_PERSISTENT_GHOST_EXCHANGE_H_
+#define INCLUDE_EXADG_OPERATORS_PERSISTENT_GHOST_EXCHANGE_H_
+
+// C/C++
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Imports the ghost values of distributed vectors via persistent MPI requests (MPI_Send_init/
+ * MPI_Recv_init and MPI_Startall), which are created once per partitioner and reused for all
+ * subsequent exchanges. Compared to update_ghost_values(), which posts new non-blocking messages in
+ * every call, this saves the setup of the messages, which dominates the exchange for small numbers
+ * of unknowns per process, e.g. on the coarse levels of multigrid.
+ *
+ * The exchange always transfers the complete ghost range of the partitioner. In contrast,
+ * MatrixFree loops might only exchange the ghost values needed by the face integrals, such that
+ * more data is transferred if the persistent exchange is used for high polynomial degrees.
+ *
+ * The requests refer to buffers owned by this class, the values are copied from/to the vector.
+ * Vectors with a different partitioner than the last one lead to the creation of new requests.
+ */
+template<typename Number>
+class PersistentGhostExchange
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  PersistentGhostExchange()
+  {
+  }
+
+  PersistentGhostExchange(PersistentGhostExchange const &) = delete;
+
+  PersistentGhostExchange &
+  operator=(PersistentGhostExchange const &) = delete;
+
+  ~PersistentGhostExchange()
+  {
+    clear();
+  }
+
+  /*
+   * Fills the ghost entries of the vector with the values of the owning processes and sets the
+   * state of the vector to ghosted. Like update_ghost_values(), this function modifies the ghost
+   * entries of a const vector only.
+   */
+  void
+  update_ghost_values(VectorType const & vector)
+  {
+    if(vector.get_partitioner().get() != partitioner.get())
+      reinit(vector.get_partitioner());
+
+    VectorType & ghosted_vector = const_cast<VectorType &>(vector);
+    Number *     values         = ghosted_vector.begin();
+
+    unsigned int offset = 0;
+    for(auto const & range : partitioner->import_indices())
+      for(unsigned int i = range.first; i < range.second; ++i, ++offset)
+        send_buffer[offset] = values[i];
+
+    if(not requests.empty())
+    {
+      int ierr = MPI_Startall(requests.size(), requests.data());
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+
+    Number * ghost_values = values + partitioner->locally_owned_size();
+    for(unsigned int i = 0; i < receive_buffer.size(); ++i)
+      ghost_values[i] = receive_buffer[i];
+
+    vector.set_ghost_state(true);
+  }
+
+private:
+  void
+  reinit(std::shared_ptr<dealii::Utilities::MPI::Partitioner const> const & partitioner_in)
+  {
+    clear();
+
+    partitioner = partitioner_in;
+
+    send_buffer.resize(partitioner->n_import_indices());
+    receive_buffer.resize(partitioner->n_ghost_indices());
+
+    MPI_Comm const     comm = partitioner->get_mpi_communicator();
+    MPI_Datatype const type = dealii::Utilities::MPI::mpi_type_id_for_type<Number>;
+
+    unsigned int offset = 0;
+    for(auto const & target : partitioner->ghost_targets())
+    {
+      requests.emplace_back();
+      int const ierr = MPI_Recv_init(receive_buffer.data() + offset,
+                                     target.second,
+                                     type,
+                                     target.first,
+                                     tag,
+                                     comm,
+                                     &requests.back());
+      AssertThrowMPI(ierr);
+      offset += target.second;
+    }
+
+    offset = 0;
+    for(auto const & target : partitioner->import_targets())
+    {
+      requests.emplace_back();
+      int const ierr = MPI_Send_init(send_buffer.data() + offset,
+                                     target.second,
+                                     type,
+                                     target.first,
+                                     tag,
+                                     comm,
+                                     &requests.back());
+      AssertThrowMPI(ierr);
+      offset += target.second;
+    }
+  }
+
+  void
+  clear()
+  {
+    for(MPI_Request & request : requests)
+    {
+      int const ierr = MPI_Request_free(&request);
+      AssertNothrow(ierr == MPI_SUCCESS, dealii::ExcMessage("MPI_Request_free failed."));
+      (void)ierr;
+    }
+
+    requests.clear();
+    partitioner.reset();
+  }
+
+  // tag distinct from the tags used by deal.II for the exchange of ghost values
+  static constexpr int tag = 4711;
+
+  std::shared_ptr<dealii::Utilities::MPI::Partitioner const> partitioner;
+
+  std::vector<Number> send_buffer;
+  std::vector<Number> receive_buffer;
+
+  std::vector<MPI_Request> requests;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_PERSISTENT_GHOST_EXCHANGE_H_ */
@@ -0,0 +1,238 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_REFERENCE_INVERSE_MASS_KERNEL_H_
+#define INCLUDE_EXADG_OPERATORS_REFERENCE_INVERSE_MASS_KERNEL_H_
+
+// C++
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+/*
+ * Inverse of the mass matrix of the reference cell, used to apply the inverse mass operator of
+ * DG discretizations for which dealii::MatrixFreeOperators::CellwiseInverseMassMatrix is not
+ * available, i.e., simplex elements and hypercube elements with n_q_points_1d != n_nodes_1d.
+ *
+ * For affine cells, the mass matrix is M = det(J) M_ref, so that the inverse is given exactly by
+ * the precomputed reference inverse scaled by 1/det(J). For non-affine cells, the weight-adjusted
+ * approximation
+ *
+ *   M^{-1} ≈ M_ref^{-1} M_{1/J} M_ref^{-1}
+ *
+ * is used (Chan, Hewett, Warburton (2017), "Weight-adjusted discontinuous Galerkin methods:
+ * curvilinear meshes"), where M_{1/J} is the reference mass matrix weighted by 1/det(J) and
+ * applied by matrix-free evaluation. This approximation is exact for affine cells and converges
+ * with optimal order on curved cells.
+ *
+ * For hypercube elements, the reference inverse is the tensor product of the inverse 1D mass
+ * matrices and is applied by sum factorization. For simplex elements, the reference inverse is a
+ * dense matrix. The matrices are set up for the scalar base element, i.e., all components are
+ * treated with the same matrices.
+ */
+template<int dim, typename Number>
+class ReferenceInverseMassKernel
+{
+private:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+public:
+  ReferenceInverseMassKernel() : tensor_product(true), n_dofs_1d(0), n_dofs(0)
+  {
+  }
+
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
+         unsigned int const                      dof_index,
+         unsigned int const                      quad_index)
+  {
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free.get_dof_handler(dof_index);
+
+    AssertThrow(dof_handler.get_fe().n_base_elements() == 1,
+                dealii::ExcMessage(
+                  "The reference inverse mass requires elements with a single base element."));
+
+    dealii::Quadrature<dim> const & quadrature = matrix_free.get_quadrature(quad_index);
+
+    weights.resize(quadrature.size());
+    for(unsigned int q = 0; q < quadrature.size(); ++q)
+      weights[q] = quadrature.weight(q);
+
+    tensor_product = dof_handler.get_triangulation().all_reference_cells_are_hyper_cube();
+
+    dealii::FullMatrix<double> mass;
+    if(tensor_product)
+    {
+      auto const & shape_data    = matrix_free.get_shape_info(dof_index, quad_index).data[0];
+      auto const & quadrature_1d = shape_data.quadrature;
+
+      n_dofs_1d = shape_data.fe_degree + 1;
+      n_dofs    = dealii::Utilities::pow(n_dofs_1d, dim);
+
+      AssertThrow(dof_handler.get_fe().base_element(0).n_dofs_per_cell() == n_dofs,
+                  dealii::ExcMessage(
+                    "The reference inverse mass requires tensor-product elements on hypercubes."));
+
+      unsigned int const n_q_points_1d = shape_data.n_q_points_1d;
+
+      mass.reinit(n_dofs_1d, n_dofs_1d);
+      for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          for(unsigned int q = 0; q < n_q_points_1d; ++q)
+            mass(i, j) += quadrature_1d.weight(q) *
+                          shape_data.shape_values[i * n_q_points_1d + q] *
+                          shape_data.shape_values[j * n_q_points_1d + q];
+    }
+    else
+    {
+      AssertThrow(dof_handler.get_triangulation().all_reference_cells_are_simplex(),
+                  dealii::ExcMessage("Mixed meshes are not supported."));
+
+      dealii::FiniteElement<dim> const & fe = dof_handler.get_fe().base_element(0);
+
+      n_dofs = fe.n_dofs_per_cell();
+
+      mass.reinit(n_dofs, n_dofs);
+      for(unsigned int q = 0; q < quadrature.size(); ++q)
+        for(unsigned int i = 0; i < n_dofs; ++i)
+          for(unsigned int j = 0; j < n_dofs; ++j)
+            mass(i, j) += quadrature.weight(q) * fe.shape_value(i, quadrature.point(q)) *
+                          fe.shape_value(j, quadrature.point(q));
+    }
+
+    mass.gauss_jordan();
+
+    inverse_mass.resize(mass.m() * mass.n());
+    for(unsigned int i = 0; i < mass.m(); ++i)
+      for(unsigned int j = 0; j < mass.n(); ++j)
+        inverse_mass[i * mass.n() + j] = mass(i, j);
+  }
+
+  static bool
+  cell_is_affine(dealii::MatrixFree<dim, Number> const & matrix_free, unsigned int const cell)
+  {
+    return matrix_free.get_mapping_info().get_cell_type(cell) <=
+           dealii::internal::MatrixFreeFunctions::affine;
+  }
+
+  /*
+   * Determinant of the Jacobian in quadrature point q.
+   */
+  template<typename Integrator>
+  scalar
+  get_determinant(Integrator const & integrator, unsigned int const q) const
+  {
+    return integrator.JxW(q) / weights[q];
+  }
+
+  /*
+   * Computes dst = factor * M_ref^{-1} src. The arrays hold the dof values of all components in
+   * the layout of FEEvaluation::begin_dof_values() and must not overlap. The array temp needs to
+   * hold the dof values of one component.
+   */
+  void
+  apply_reference_inverse(scalar const *     src,
+                          scalar *           dst,
+                          scalar *           temp,
+                          scalar const &     factor,
+                          unsigned int const n_components) const
+  {
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      if(tensor_product)
+        apply_tensor_product(src + c * n_dofs, dst + c * n_dofs, temp);
+      else
+        apply_dense(src + c * n_dofs, dst + c * n_dofs);
+
+      for(unsigned int i = 0; i < n_dofs; ++i)
+        dst[c * n_dofs + i] *= factor;
+    }
+  }
+
+private:
+  void
+  apply_dense(scalar const * src, scalar * dst) const
+  {
+    for(unsigned int i = 0; i < n_dofs; ++i)
+    {
+      scalar sum = inverse_mass[i * n_dofs] * src[0];
+      for(unsigned int j = 1; j < n_dofs; ++j)
+        sum += inverse_mass[i * n_dofs + j] * src[j];
+      dst[i] = sum;
+    }
+  }
+
+  /*
+   * Applies the 1D inverse mass matrix in all coordinate directions, alternating between dst and
+   * a temporary array such that the result ends up in dst.
+   */
+  void
+  apply_tensor_product(scalar const * src, scalar * dst, scalar * temp) const
+  {
+    scalar const * in  = src;
+    scalar *       out = (dim % 2 == 1) ? dst : temp;
+
+    unsigned int stride = 1;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      unsigned int const n_outer = n_dofs / (stride * n_dofs_1d);
+      for(unsigned int outer = 0; outer < n_outer; ++outer)
+      {
+        for(unsigned int inner = 0; inner < stride; ++inner)
+        {
+          unsigned int const offset = outer * stride * n_dofs_1d + inner;
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+          {
+            scalar sum = inverse_mass[i * n_dofs_1d] * in[offset];
+            for(unsigned int j = 1; j < n_dofs_1d; ++j)
+              sum += inverse_mass[i * n_dofs_1d + j] * in[offset + j * stride];
+            out[offset + i * stride] = sum;
+          }
+        }
+      }
+
+      in     = out;
+      out    = (out == dst) ? temp : dst;
+      stride = stride * n_dofs_1d;
+    }
+  }
+
+  bool tensor_product;
+
+  unsigned int n_dofs_1d;
+
+  unsigned int n_dofs;
+
+  // row-major inverse of the 1D reference mass matrix (hypercubes) or of the reference mass
+  // matrix (simplices)
+  std::vector<Number> inverse_mass;
+
+  // quadrature weights on the reference cell
+  std::vector<Number> weights;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_REFERENCE_INVERSE_MASS_KERNEL_H_ */
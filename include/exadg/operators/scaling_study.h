@@ -0,0 +1,253 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_OPERATORS_SCALING_STUDY_H_
+#define INCLUDE_EXADG_OPERATORS_SCALING_STUDY_H_
+
+// C/C++
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+
+// ExaDG
+#include <exadg/operators/hypercube_resolution_parameters.h>
+#include <exadg/operators/throughput_parameters.h>
+#include <exadg/utilities/enum_patterns.h>
+
+namespace ExaDG
+{
+/*
+ * Scaling studies run the throughput study on a series of sub-communicators of increasing size
+ * within one job, which consist of the first n_processes ranks of the global communicator.
+ */
+enum class ScalingType
+{
+  None,   // run the throughput study once on the global communicator
+  Strong, // same problem sizes for all numbers of processes
+  Weak    // the problem size (DofsMin, DofsMax) is specified per process
+};
+
+typedef std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> ResolutionsVector;
+
+struct ScalingStudyParameters
+{
+  ScalingStudyParameters()
+  {
+  }
+
+  ScalingStudyParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    prm.enter_subsection("Scaling");
+    {
+      prm.add_parameter(
+        "ScalingType", scaling_type, "Type of scaling study.", Patterns::Enum<ScalingType>(), true);
+      prm.add_parameter("ProcessesMin",
+                        n_processes_min,
+                        "Number of processes of the smallest sub-communicator.",
+                        dealii::Patterns::Integer(1),
+                        true);
+      prm.add_parameter("ProcessesFactor",
+                        n_processes_factor,
+                        "Factor between the numbers of processes of subsequent sub-communicators.",
+                        dealii::Patterns::Integer(2),
+                        true);
+      prm.add_parameter("ReportFile",
+                        report_file,
+                        "Name of the CSV file to which the results are written.",
+                        dealii::Patterns::Anything(),
+                        true);
+    }
+    prm.leave_subsection();
+  }
+
+  /*
+   * Returns the numbers of processes of the sub-communicators, which do not exceed the size of the
+   * global communicator. The last entry is the size of the global communicator.
+   */
+  std::vector<unsigned int>
+  get_process_counts(MPI_Comm const & mpi_comm) const
+  {
+    unsigned int const n_processes_global = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    std::vector<unsigned int> n_processes;
+
+    if(scaling_type != ScalingType::None)
+    {
+      for(unsigned int n = n_processes_min; n < n_processes_global; n *= n_processes_factor)
+        n_processes.push_back(n);
+    }
+
+    n_processes.push_back(n_processes_global);
+
+    return n_processes;
+  }
+
+  ScalingType scaling_type = ScalingType::None;
+
+  unsigned int n_processes_min = 1;
+
+  unsigned int n_processes_factor = 2;
+
+  std::string report_file = "scaling_study.csv";
+};
+
+/*
+ * Returns a communicator consisting of the first n_processes ranks of mpi_comm, and MPI_COMM_NULL
+ * on all other ranks.
+ */
+inline MPI_Comm
+create_sub_communicator(MPI_Comm const & mpi_comm, unsigned int const n_processes)
+{
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  int const color = rank < n_processes ? 0 : MPI_UNDEFINED;
+
+  MPI_Comm  sub_comm;
+  int const ierr = MPI_Comm_split(mpi_comm, color, rank, &sub_comm);
+  AssertThrowMPI(ierr);
+
+  return sub_comm;
+}
+
+/*
+ * Runs the throughput study for the resolutions defined by the resolution parameters on each
+ * communicator of the scaling study, where run(resolutions, sub_comm) runs the simulations for the
+ * given resolutions vector and communicator and adds the results to throughput.wall_times. For
+ * scaling studies, a report is written in CSV format containing the throughput and the parallel
+ * efficiency, i.e., the throughput per process relative to the smallest number of processes for
+ * the same entry of the resolutions vector.
+ */
+template<typename EnumOperatorType, typename RunFunction>
+inline void
+run_scaling_study(
+  ScalingStudyParameters const &                                               scaling,
+  HypercubeResolutionParameters const &                                        resolution,
+  std::function<unsigned int(unsigned int, unsigned int, ElementType)> const & get_dofs_per_element,
+  ThroughputParameters<EnumOperatorType> const &                               throughput,
+  RunFunction const &                                                          run,
+  MPI_Comm const &                                                             mpi_comm)
+{
+  AssertThrow(scaling.scaling_type != ScalingType::Weak or
+                resolution.run_type != RunType::RefineHAndP,
+              dealii::ExcMessage("Weak scaling requires RunType FixedProblemSize or "
+                                 "IncreasingProblemSize to scale the problem size."));
+
+  if(scaling.scaling_type == ScalingType::None)
+  {
+    HypercubeResolutionParameters resolution_global = resolution;
+    resolution_global.fill_resolution_vector(get_dofs_per_element);
+
+    run(resolution_global.resolutions, mpi_comm);
+
+    return;
+  }
+
+  // tuples of the form (number of processes, index in resolutions vector, degree, DoFs, DoFs/s)
+  std::vector<
+    std::tuple<unsigned int, unsigned int, unsigned int, dealii::types::global_dof_index, double>>
+    results;
+
+  for(unsigned int const n_processes : scaling.get_process_counts(mpi_comm))
+  {
+    HypercubeResolutionParameters resolution_sub = resolution;
+
+    if(scaling.scaling_type == ScalingType::Weak)
+    {
+      resolution_sub.n_dofs_min *= n_processes;
+      resolution_sub.n_dofs_max *= n_processes;
+    }
+
+    resolution_sub.resolutions.clear();
+    resolution_sub.fill_resolution_vector(get_dofs_per_element);
+
+    unsigned int const n_results_before = throughput.wall_times.size();
+
+    MPI_Comm sub_comm = create_sub_communicator(mpi_comm, n_processes);
+
+    if(sub_comm != MPI_COMM_NULL)
+    {
+      run(resolution_sub.resolutions, sub_comm);
+
+      int const ierr = MPI_Comm_free(&sub_comm);
+      AssertThrowMPI(ierr);
+    }
+
+    for(unsigned int i = n_results_before; i < throughput.wall_times.size(); ++i)
+    {
+      auto const & result = throughput.wall_times[i];
+      results.emplace_back(n_processes,
+                           i - n_results_before,
+                           std::get<0>(result),
+                           std::get<1>(result),
+                           std::get<2>(result));
+    }
+
+    int const ierr = MPI_Barrier(mpi_comm);
+    AssertThrowMPI(ierr);
+  }
+
+  // rank 0 is part of all sub-communicators and has all results
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    // reference throughput per process for each entry of the resolutions vector
+    std::map<unsigned int, double> reference;
+    for(auto const & result : results)
+      if(reference.find(std::get<1>(result)) == reference.end())
+        reference[std::get<1>(result)] = std::get<4>(result) / (double)std::get<0>(result);
+
+    std::ofstream stream(scaling.report_file);
+    AssertThrow(stream, dealii::ExcMessage("Could not open file " + scaling.report_file));
+
+    stream << "n_processes,degree,n_dofs,dofs_per_second,dofs_per_second_per_process,"
+           << "parallel_efficiency" << std::endl;
+
+    for(auto const & result : results)
+    {
+      double const throughput_per_process = std::get<4>(result) / (double)std::get<0>(result);
+
+      stream << std::get<0>(result) << "," << std::get<2>(result) << "," << std::get<3>(result)
+             << "," << std::scientific << std::setprecision(6) << std::get<4>(result) << ","
+             << throughput_per_process << "," << std::fixed << std::setprecision(4)
+             << throughput_per_process / reference[std::get<1>(result)] << std::endl;
+    }
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_SCALING_STUDY_H_ */
@@ -22,10 +22,19 @@
 #ifndef INCLUDE_EXADG_OPERATORS_SOLUTION_INTERPOLATION_BETWEEN_TRIANGULATIONS_H
 #define INCLUDE_EXADG_OPERATORS_SOLUTION_INTERPOLATION_BETWEEN_TRIANGULATIONS_H
 
+// C/C++
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 // deal.II
 #include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_point_evaluation.h>
 #include <deal.II/fe/mapping.h>
+#include <deal.II/hp/fe_values.h>
+#include <deal.II/hp/mapping_collection.h>
+#include <deal.II/hp/q_collection.h>
 #include <deal.II/numerics/vector_tools.h>
 
 namespace ExaDG
@@ -33,6 +42,11 @@ namespace ExaDG
 /**
  * Class to transfer solutions between different DoFHandlers via interpolation. This class requires,
  * that the destination DoFHandler has generalized support points.
+ *
+ * The support points of the destination DoFHandler, the communication pattern of the
+ * RemotePointEvaluation, and the map from point values to the DoFs of the destination vector are
+ * set up once in reinit() and are reused by all subsequent interpolations. Several vectors, e.g.,
+ * the solution history of a time integrator, can be interpolated with a single communication.
  */
 template<int dim>
 class SolutionInterpolationBetweenTriangulations
@@ -59,6 +73,7 @@ public:
 
     dof_handler_dst = &dof_handler_dst_in;
     dof_handler_src = &dof_handler_src_in;
+    mapping_src     = &mapping_src_in;
 
     rpe.reinit(collect_mapped_support_points(dof_handler_dst_in, mapping_dst_in),
                dof_handler_src_in.get_triangulation(),
@@ -80,34 +95,210 @@ public:
                        dealii::VectorTools::EvaluationFlags::EvaluationFlags const flags =
                          dealii::VectorTools::EvaluationFlags::avg) const
   {
-    AssertThrow(src.size() == dof_handler_src->n_dofs(),
-                dealii::ExcMessage("Dimensions do not fit."));
-    AssertThrow(dst.size() == dof_handler_dst->n_dofs(),
-                dealii::ExcMessage("Dimensions do not fit."));
+    interpolate_solutions<n_components, VectorType1, VectorType2>({&dst}, {&src}, flags);
+  }
+
+  /**
+   * Same as above, but for several vectors, e.g., the vectors of a multistep time integrator,
+   * which are evaluated at the support points with a single communication.
+   *
+   * @param[in] dst Target DoF Vectors.
+   * @param[in] src Source DoF Vectors.
+   */
+  template<int n_components, typename VectorType1, typename VectorType2>
+  void
+  interpolate_solutions(std::vector<VectorType1 *> const &                          dst,
+                        std::vector<VectorType2 const *> const &                    src,
+                        dealii::VectorTools::EvaluationFlags::EvaluationFlags const flags =
+                          dealii::VectorTools::EvaluationFlags::avg) const
+  {
+    typedef typename VectorType2::value_type Number;
+
+    AssertThrow(dst.size() == src.size(), dealii::ExcMessage("Number of vectors do not fit."));
+    AssertThrow(dof_handler_src->get_fe().n_components() == n_components and
+                  dof_handler_dst->get_fe().n_components() == n_components,
+                dealii::ExcMessage("Number of components do not fit."));
+    for(unsigned int v = 0; v < src.size(); ++v)
+    {
+      AssertThrow(src[v]->size() == dof_handler_src->n_dofs(),
+                  dealii::ExcMessage("Dimensions do not fit."));
+      AssertThrow(dst[v]->size() == dof_handler_dst->n_dofs(),
+                  dealii::ExcMessage("Dimensions do not fit."));
+    }
+
+    unsigned int const n_vectors = src.size();
+
+    std::vector<bool> has_ghost_elements(n_vectors);
+    for(unsigned int v = 0; v < n_vectors; ++v)
+    {
+      has_ghost_elements[v] = src[v]->has_ghost_elements();
+      if(not has_ghost_elements[v])
+        src[v]->update_ghost_values();
+    }
+
+    // evaluate all vectors on the source cells, the values of all vectors at a point are
+    // communicated together
+    auto const evaluation_function =
+      [&](dealii::ArrayView<std::vector<Number>> const &                               values,
+          typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::CellData const & cell_data) {
+        std::vector<std::unique_ptr<dealii::FEPointEvaluation<n_components, dim, dim, Number>>>
+          evaluators(dof_handler_src->get_fe_collection().size());
+
+        std::vector<Number> dof_values;
+
+        for(unsigned int i = 0; i < cell_data.cells.size(); ++i)
+        {
+          typename dealii::DoFHandler<dim>::active_cell_iterator const cell(
+            &dof_handler_src->get_triangulation(),
+            cell_data.cells[i].first,
+            cell_data.cells[i].second,
+            dof_handler_src);
+
+          dealii::ArrayView<dealii::Point<dim> const> const unit_points(
+            cell_data.reference_point_values.data() + cell_data.reference_point_ptrs[i],
+            cell_data.reference_point_ptrs[i + 1] - cell_data.reference_point_ptrs[i]);
+
+          auto & evaluator = evaluators[cell->active_fe_index()];
+          if(evaluator.get() == nullptr)
+            evaluator = std::make_unique<dealii::FEPointEvaluation<n_components, dim, dim, Number>>(
+              *mapping_src, cell->get_fe(), dealii::update_values);
+
+          evaluator->reinit(cell, unit_points);
 
-    src.update_ghost_values();
-    auto const values =
-      dealii::VectorTools::point_values<n_components>(rpe, *dof_handler_src, src, flags);
-    src.zero_out_ghost_values();
+          dof_values.resize(cell->get_fe().n_dofs_per_cell());
 
-    fill_dof_vector_with_values<n_components>(dst, *dof_handler_dst, values);
+          for(unsigned int q = 0; q < unit_points.size(); ++q)
+            values[cell_data.reference_point_ptrs[i] + q].resize(n_vectors * n_components);
+
+          for(unsigned int v = 0; v < n_vectors; ++v)
+          {
+            cell->get_dof_values(*src[v], dof_values.begin(), dof_values.end());
+            evaluator->evaluate(dof_values, dealii::EvaluationFlags::values);
+
+            for(unsigned int q = 0; q < unit_points.size(); ++q)
+              set_components<n_components>(values[cell_data.reference_point_ptrs[i] + q],
+                                           v * n_components,
+                                           evaluator->get_value(q));
+          }
+        }
+      };
+
+    std::vector<std::vector<Number>> point_values;
+    std::vector<std::vector<Number>> buffer;
+    rpe.template evaluate_and_process<std::vector<Number>>(point_values,
+                                                           buffer,
+                                                           evaluation_function);
+
+    for(unsigned int v = 0; v < n_vectors; ++v)
+      if(not has_ghost_elements[v])
+        src[v]->zero_out_ghost_values();
+
+    // a point might be found on several cells of the source triangulation
+    std::vector<unsigned int> const & point_ptrs = rpe.get_point_ptrs();
+    unsigned int const                n_points   = point_ptrs.size() - 1;
+    unsigned int const                n_values   = n_vectors * n_components;
+
+    std::vector<Number> reduced_values(n_points * n_values, Number(0.0));
+    for(unsigned int p = 0; p < n_points; ++p)
+    {
+      unsigned int const n_entries = point_ptrs[p + 1] - point_ptrs[p];
+      if(n_entries == 0)
+        continue;
+
+      Number * const value = reduced_values.data() + p * n_values;
+      std::copy(point_values[point_ptrs[p]].begin(), point_values[point_ptrs[p]].end(), value);
+
+      if(flags & dealii::VectorTools::EvaluationFlags::insert)
+        continue;
+
+      for(unsigned int e = 1; e < n_entries; ++e)
+      {
+        std::vector<Number> const & entry = point_values[point_ptrs[p] + e];
+        for(unsigned int k = 0; k < n_values; ++k)
+        {
+          if(flags & dealii::VectorTools::EvaluationFlags::max)
+            value[k] = std::max(value[k], entry[k]);
+          else if(flags & dealii::VectorTools::EvaluationFlags::min)
+            value[k] = std::min(value[k], entry[k]);
+          else
+            value[k] += entry[k];
+        }
+      }
+
+      if(flags & dealii::VectorTools::EvaluationFlags::avg)
+        for(unsigned int k = 0; k < n_values; ++k)
+          value[k] /= Number(n_entries);
+    }
+
+    for(unsigned int v = 0; v < n_vectors; ++v)
+      fill_dof_vector_with_values(*dst[v], reduced_values, v, n_vectors);
   }
 
 private:
+  /*
+   * Collects the support points of the locally owned cells in real space. For elements whose
+   * shape functions are nodal in the generalized support points, the DoF of the destination
+   * vector and the point value it receives are stored such that the destination vector can be
+   * filled without converting point values to DoF values cell by cell.
+   */
   std::vector<dealii::Point<dim>>
   collect_mapped_support_points(dealii::DoFHandler<dim> const & dof_handler,
-                                dealii::Mapping<dim> const &    mapping) const
+                                dealii::Mapping<dim> const &    mapping)
   {
+    dealii::hp::FECollection<dim> const & fe_collection = dof_handler.get_fe_collection();
+
+    dealii::hp::QCollection<dim> q_collection;
+    for(unsigned int i = 0; i < fe_collection.size(); ++i)
+      q_collection.push_back(
+        dealii::Quadrature<dim>(fe_collection[i].get_generalized_support_points()));
+
+    dealii::hp::FEValues<dim> fe_values(dealii::hp::MappingCollection<dim>(mapping),
+                                        fe_collection,
+                                        q_collection,
+                                        dealii::update_quadrature_points);
+
+    std::vector<std::vector<unsigned int>> point_of_dof(fe_collection.size());
+    is_nodal = true;
+    for(unsigned int i = 0; i < fe_collection.size(); ++i)
+    {
+      point_of_dof[i] = compute_point_of_dof(fe_collection[i]);
+      is_nodal        = is_nodal and (not point_of_dof[i].empty());
+    }
+
     std::vector<dealii::Point<dim>> support_points;
 
+    dofs_dst.clear();
+    value_indices_dst.clear();
+
+    std::vector<dealii::types::global_dof_index> dof_indices;
+
     for(auto const & cell : dof_handler.active_cell_iterators())
     {
       if(cell->is_locally_owned())
       {
-        auto cellwise_support_points = cell->get_fe().get_generalized_support_points();
+        fe_values.reinit(cell);
+
+        std::vector<dealii::Point<dim>> const & cellwise_support_points =
+          fe_values.get_present_fe_values().get_quadrature_points();
+
+        if(is_nodal)
+        {
+          auto const &       fe           = cell->get_fe();
+          unsigned int const n_components = fe.n_components();
+
+          dof_indices.resize(fe.n_dofs_per_cell());
+          cell->get_dof_indices(dof_indices);
+
+          for(unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+          {
+            unsigned int const point = support_points.size() +
+                                       point_of_dof[cell->active_fe_index()][i];
 
-        for(auto & csp : cellwise_support_points)
-          csp = mapping.transform_unit_to_real_cell(cell, csp);
+            dofs_dst.push_back(dof_indices[i]);
+            value_indices_dst.push_back(point * n_components +
+                                        fe.system_to_component_index(i).first);
+          }
+        }
 
         support_points.insert(support_points.end(),
                               cellwise_support_points.begin(),
@@ -118,14 +309,77 @@ private:
     return support_points;
   }
 
-  template<int n_components, typename VectorType, typename value_type>
+  /*
+   * Returns the index of the generalized support point for each DoF of a primitive element whose
+   * shape functions are nodal in these points, and an empty vector otherwise.
+   */
+  static std::vector<unsigned int>
+  compute_point_of_dof(dealii::FiniteElement<dim> const & fe)
+  {
+    if(not(fe.is_primitive() and fe.has_support_points()))
+      return {};
+
+    std::vector<dealii::Point<dim>> const & points = fe.get_generalized_support_points();
+
+    std::vector<unsigned int> point_of_dof(fe.n_dofs_per_cell(),
+                                           dealii::numbers::invalid_unsigned_int);
+    for(unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+    {
+      for(unsigned int j = 0; j < points.size(); ++j)
+        if(points[j].distance(fe.get_unit_support_point(i)) < 1e-12)
+          point_of_dof[i] = j;
+
+      if(point_of_dof[i] == dealii::numbers::invalid_unsigned_int)
+        return {};
+    }
+
+    for(unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+      for(unsigned int j = 0; j < fe.n_dofs_per_cell(); ++j)
+        if(std::abs(fe.shape_value(i, fe.get_unit_support_point(j)) - (i == j ? 1.0 : 0.0)) > 1e-10)
+          return {};
+
+    return point_of_dof;
+  }
+
+  template<int n_components, typename ValueType, typename Number>
+  static void
+  set_components(std::vector<Number> & dst, unsigned int const offset, ValueType const & src)
+  {
+    if constexpr(n_components == 1)
+      dst[offset] = src;
+    else
+      for(unsigned int c = 0; c < n_components; ++c)
+        dst[offset + c] = src[c];
+  }
+
+  /*
+   * Fills the destination vector with vector v of the point values ordered as
+   * [point][vector][component].
+   */
+  template<typename VectorType, typename Number>
   void
-  fill_dof_vector_with_values(VectorType &                    dst,
-                              dealii::DoFHandler<dim> const & dof_handler,
-                              std::vector<value_type> const & values) const
+  fill_dof_vector_with_values(VectorType &                dst,
+                              std::vector<Number> const & values,
+                              unsigned int const          v,
+                              unsigned int const          n_vectors) const
   {
-    auto ptr = values.begin();
-    for(auto const & cell : dof_handler.active_cell_iterators())
+    unsigned int const n_components = dof_handler_dst->get_fe().n_components();
+
+    if(is_nodal)
+    {
+      for(unsigned int i = 0; i < dofs_dst.size(); ++i)
+      {
+        unsigned int const point     = value_indices_dst[i] / n_components;
+        unsigned int const component = value_indices_dst[i] % n_components;
+
+        dst(dofs_dst[i]) = values[(point * n_vectors + v) * n_components + component];
+      }
+
+      return;
+    }
+
+    unsigned int point = 0;
+    for(auto const & cell : dof_handler_dst->active_cell_iterators())
     {
       if(cell->is_locally_owned())
       {
@@ -136,20 +390,9 @@ private:
         std::vector<dealii::Vector<double>> component_dof_values(
           n_support_points, dealii::Vector<double>(n_components));
 
-        for(unsigned int i = 0; i < n_support_points; ++i)
-        {
-          if constexpr(n_components == 1)
-          {
-            component_dof_values[i] = *ptr;
-          }
-          else
-          {
-            component_dof_values[i] =
-              std::move(dealii::Vector<double>(ptr->begin_raw(), ptr->end_raw()));
-          }
-
-          ++ptr;
-        }
+        for(unsigned int i = 0; i < n_support_points; ++i, ++point)
+          for(unsigned int c = 0; c < n_components; ++c)
+            component_dof_values[i][c] = values[(point * n_vectors + v) * n_components + c];
 
         fe.convert_generalized_support_point_values_to_dof_values(component_dof_values, dof_values);
 
@@ -162,7 +405,13 @@ private:
 
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_dst;
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_src;
+  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping_src;
   dealii::Utilities::MPI::RemotePointEvaluation<dim>  rpe;
+
+  // map from point values to the DoFs of the destination vector if all elements are nodal
+  bool                                         is_nodal = false;
+  std::vector<dealii::types::global_dof_index> dofs_dst;
+  std::vector<unsigned int>                    value_indices_dst;
 };
 
 } // namespace ExaDG
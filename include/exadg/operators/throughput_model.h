@@ -0,0 +1,133 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_OPERATORS_THROUGHPUT_MODEL_H_
+#define INCLUDE_EXADG_OPERATORS_THROUGHPUT_MODEL_H_
+
+// C/C++
+#include <cmath>
+#include <iomanip>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/types.h>
+
+namespace ExaDG
+{
+/**
+ * Roofline-type performance model of one matrix-free operator evaluation in terms of the main
+ * memory traffic and the floating point operations per DoF. Together with a measured wall time,
+ * the model yields the achieved memory bandwidth and flop rate as well as the arithmetic
+ * intensity, which tell whether an operator runs at the memory bandwidth limit of the hardware
+ * (low arithmetic intensity) or at the flop limit.
+ *
+ * The memory traffic counts the vector entries read and written as well as the data structures of
+ * the operator (geometry, DoF indices, coefficients), which are assumed to be read once per
+ * evaluation from main memory, i.e., caches are neglected. The arithmetic work counts the cell
+ * integrals evaluated by sum factorization for values and gradients with n_q_points_1d = degree + 1
+ * and without even-odd decomposition, plus the transformation of the gradients at the quadrature
+ * points. Face integrals are neglected, i.e., the flops are a lower bound for DG discretizations.
+ */
+struct ThroughputModel
+{
+  ThroughputModel() : bytes_per_dof(0.0), flops_per_dof(0.0)
+  {
+  }
+
+  /**
+   * Sets up the model of a second-order operator (e.g. Laplace) with n_components components.
+   * n_vector_accesses is the number of vector entries accessed per DoF, e.g. 3 for dst = A * src
+   * (read src, write dst including the write-allocate transfer). bytes_data is the global memory
+   * consumption of the data structures read by the operator.
+   */
+  ThroughputModel(unsigned int const                     dim,
+                  unsigned int const                     degree,
+                  unsigned int const                     n_components,
+                  dealii::types::global_dof_index const  n_dofs,
+                  dealii::types::global_cell_index const n_cells,
+                  unsigned int const                     n_vector_accesses,
+                  unsigned int const                     size_of_number,
+                  double const                           bytes_data)
+  {
+    double const n = degree + 1;
+
+    // values and gradients to quadrature points and back via 4 * dim sweeps of 1D kernels, each
+    // with n multiply-adds per point of the tensor-product grid of n^dim points
+    double const flops_sum_factorization = 4.0 * dim * 2.0 * std::pow(n, dim + 1);
+
+    // transformation of the gradient with the inverse Jacobian and back, scaling by JxW
+    double const flops_quadrature = (4.0 * dim * dim + dim) * std::pow(n, dim);
+
+    double const flops =
+      (double)n_cells * n_components * (flops_sum_factorization + flops_quadrature);
+
+    flops_per_dof = flops / (double)n_dofs;
+    bytes_per_dof = n_vector_accesses * size_of_number + bytes_data / (double)n_dofs;
+  }
+
+  double
+  get_arithmetic_intensity() const
+  {
+    return flops_per_dof / bytes_per_dof;
+  }
+
+  /**
+   * Prints the model quantities and the achieved performance for the given throughput in DoFs/s.
+   * mpi_wait_share is the share of the wall time spent waiting for other processes, see
+   * measure_operator_evaluation_time().
+   */
+  void
+  print(dealii::ConditionalOStream const & pcout,
+        double const                       throughput,
+        unsigned int const                 n_mpi_processes,
+        double const                       mpi_wait_share) const
+  {
+    double const bandwidth = bytes_per_dof * throughput;
+    double const flop_rate = flops_per_dof * throughput;
+
+    // clang-format off
+    pcout << std::endl
+          << "Roofline model (per operator evaluation):" << std::endl
+          << std::scientific << std::setprecision(4)
+          << "  Modeled memory transfer:  " << bytes_per_dof << " Bytes/DoF" << std::endl
+          << "  Modeled arithmetic work:  " << flops_per_dof << " Flop/DoF" << std::endl
+          << "  Arithmetic intensity:     " << get_arithmetic_intensity() << " Flop/Byte"
+          << std::endl
+          << "  Achieved bandwidth:       " << bandwidth / 1.e9 << " GB/s, "
+          << bandwidth / 1.e9 / (double)n_mpi_processes << " GB/s/core" << std::endl
+          << "  Achieved flop rate:       " << flop_rate / 1.e9 << " GFlop/s, "
+          << flop_rate / 1.e9 / (double)n_mpi_processes << " GFlop/s/core" << std::endl
+          << std::fixed << std::setprecision(2)
+          << "  MPI wait share:           " << 100.0 * mpi_wait_share << " %" << std::endl;
+    // clang-format on
+  }
+
+  // main memory traffic in bytes per DoF
+  double bytes_per_dof;
+
+  // floating point operations per DoF
+  double flops_per_dof;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_THROUGHPUT_MODEL_H_ */
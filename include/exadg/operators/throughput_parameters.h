@@ -38,12 +38,20 @@
 
 namespace ExaDG
 {
+/*
+ * Returns the minimum over the outer repetitions of the average wall time of one operator
+ * evaluation. If mpi_wait_share is provided, it is set to the share of the wall time that the
+ * average process waits for the slowest process in the measurement of the minimum wall time,
+ * i.e., 1 - t_avg / t_max, which quantifies the time spent in MPI synchronization due to load
+ * imbalance and communication.
+ */
 inline double
 measure_operator_evaluation_time(std::function<void(void)> const & evaluate_operator,
                                  unsigned int const                degree,
                                  unsigned int const                n_repetitions_inner,
                                  unsigned int const                n_repetitions_outer,
-                                 MPI_Comm const &                  mpi_comm)
+                                 MPI_Comm const &                  mpi_comm,
+                                 double * const                    mpi_wait_share = nullptr)
 {
   (void)degree;
 
@@ -78,7 +86,13 @@ measure_operator_evaluation_time(std::function<void(void)> const & evaluate_oper
       dealii::Utilities::MPI::MinMaxAvg wall_time_inner =
         dealii::Utilities::MPI::min_max_avg(timer.wall_time(), mpi_comm);
 
-      wall_time = std::min(wall_time, wall_time_inner.avg / (double)n_repetitions_inner);
+      if(wall_time_inner.avg / (double)n_repetitions_inner < wall_time)
+      {
+        wall_time = wall_time_inner.avg / (double)n_repetitions_inner;
+
+        if(mpi_wait_share != nullptr)
+          *mpi_wait_share = 1.0 - wall_time_inner.avg / wall_time_inner.max;
+      }
     }
 
     global_time = dealii::Utilities::MPI::min_max_avg(global_timer.wall_time(), mpi_comm);
@@ -21,8 +21,176 @@
 #ifndef INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_H_
 #define INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_H_
 
+// deal.II
+#include <deal.II/base/table.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+// ExaDG
+#include <exadg/utilities/memory_report.h>
+
 namespace ExaDG
 {
+namespace internal
+{
+/**
+ * Type used to store coefficients of type @p coefficient_type in reduced precision. By default,
+ * no compression is applied. For vectorized scalar coefficients, the lanes are stored in single
+ * precision with the same number of lanes, which halves the memory and the memory transfer
+ * for double precision operators.
+ */
+template<typename coefficient_type>
+struct ReducedPrecisionCoefficient
+{
+  typedef coefficient_type type;
+
+  static type
+  compress(coefficient_type const & coefficient)
+  {
+    return coefficient;
+  }
+
+  static coefficient_type
+  decompress(type const & coefficient)
+  {
+    return coefficient;
+  }
+};
+
+template<typename Number, std::size_t width>
+struct ReducedPrecisionCoefficient<dealii::VectorizedArray<Number, width>>
+{
+  typedef dealii::VectorizedArray<float, width> type;
+
+  static type
+  compress(dealii::VectorizedArray<Number, width> const & coefficient)
+  {
+    type result;
+    for(unsigned int v = 0; v < width; ++v)
+      result[v] = static_cast<float>(coefficient[v]);
+    return result;
+  }
+
+  static dealii::VectorizedArray<Number, width>
+  decompress(type const & coefficient)
+  {
+    dealii::VectorizedArray<Number, width> result;
+    for(unsigned int v = 0; v < width; ++v)
+      result[v] = static_cast<Number>(coefficient[v]);
+    return result;
+  }
+};
+
+/**
+ * Tensors of vectorized coefficients are stored component-wise in reduced precision.
+ */
+template<int rank, int dim, typename Number, std::size_t width>
+struct ReducedPrecisionCoefficient<
+  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number, width>>>
+{
+  typedef dealii::Tensor<rank, dim, dealii::VectorizedArray<Number, width>> coefficient_type;
+
+  typedef ReducedPrecisionCoefficient<dealii::VectorizedArray<Number, width>> ComponentType;
+
+  typedef dealii::Tensor<rank, dim, typename ComponentType::type> type;
+
+  static type
+  compress(coefficient_type const & coefficient)
+  {
+    type result;
+    for(unsigned int i = 0; i < coefficient_type::n_independent_components; ++i)
+    {
+      dealii::TableIndices<rank> const indices = coefficient_type::unrolled_to_component_indices(i);
+      result[indices] = ComponentType::compress(coefficient[indices]);
+    }
+    return result;
+  }
+
+  static coefficient_type
+  decompress(type const & coefficient)
+  {
+    coefficient_type result;
+    for(unsigned int i = 0; i < coefficient_type::n_independent_components; ++i)
+    {
+      dealii::TableIndices<rank> const indices = coefficient_type::unrolled_to_component_indices(i);
+      result[indices] = ComponentType::decompress(coefficient[indices]);
+    }
+    return result;
+  }
+};
+
+/**
+ * Table of coefficients with a row per cell/face batch and a column per quadrature point, which
+ * is stored either with the full @p coefficient_type or in reduced precision. In the latter
+ * case, the coefficients are converted back to @p coefficient_type when accessed.
+ */
+template<typename coefficient_type>
+class CoefficientTable
+{
+private:
+  typedef ReducedPrecisionCoefficient<coefficient_type> Reduced;
+
+public:
+  void
+  reinit(unsigned int const n_rows, unsigned int const n_columns, bool const reduced_precision)
+  {
+    use_reduced_precision = reduced_precision;
+
+    if(use_reduced_precision)
+    {
+      table_reduced.reinit(n_rows, n_columns);
+      table.reinit(0, 0);
+    }
+    else
+    {
+      table.reinit(n_rows, n_columns);
+      table_reduced.reinit(0, 0);
+    }
+  }
+
+  coefficient_type
+  get(unsigned int const row, unsigned int const q) const
+  {
+    if(use_reduced_precision)
+      return Reduced::decompress(table_reduced[row][q]);
+    else
+      return table[row][q];
+  }
+
+  void
+  set(unsigned int const row, unsigned int const q, coefficient_type const & coefficient)
+  {
+    if(use_reduced_precision)
+      table_reduced[row][q] = Reduced::compress(coefficient);
+    else
+      table[row][q] = coefficient;
+  }
+
+  void
+  fill(coefficient_type const & constant_coefficient)
+  {
+    if(use_reduced_precision)
+      table_reduced.fill(Reduced::compress(constant_coefficient));
+    else
+      table.fill(constant_coefficient);
+  }
+
+  std::size_t
+  memory_consumption() const
+  {
+    return table.memory_consumption() + table_reduced.memory_consumption();
+  }
+
+private:
+  dealii::Table<2, coefficient_type> table;
+
+  dealii::Table<2, typename Reduced::type> table_reduced;
+
+  bool use_reduced_precision{false};
+};
+
+} // namespace internal
+
 /**
  * This class serves as a manager of several table objects, which hold quadrature-point-level
  * coefficient information for the different matrix-free loop types and access methods.
@@ -51,13 +219,17 @@ public:
    * @param store_cell_based_face_data_in Boolean switch to use a coefficient table for cell-based
    * face access. This is an additional and optional way of accessing the face coefficients and
    * should be `false` if @p store_face_data_in is `false`.
+   * @param store_in_reduced_precision_in Boolean switch to store the coefficients in reduced
+   * precision, see internal::ReducedPrecisionCoefficient. The accessors convert the coefficients
+   * from and to @p coefficient_type.
    */
   template<int dim, typename Number>
   void
   initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
              unsigned int const                      quad_index,
              bool const                              store_face_data_in,
-             bool const                              store_cell_based_face_data_in)
+             bool const                              store_cell_based_face_data_in,
+             bool const                              store_in_reduced_precision_in = false)
   {
     if(not store_face_data_in)
       AssertThrow(not store_cell_based_face_data_in,
@@ -66,6 +238,7 @@ public:
 
     store_face_data            = store_face_data_in;
     store_cell_based_face_data = store_cell_based_face_data_in;
+    store_in_reduced_precision = store_in_reduced_precision_in;
 
     reinit(matrix_free, quad_index);
   }
@@ -85,7 +258,7 @@ public:
   coefficient_type
   get_coefficient_cell(unsigned int const cell, unsigned int const q) const
   {
-    return coefficients_cell[cell][q];
+    return coefficients_cell.get(cell, q);
   }
 
   /**
@@ -97,7 +270,7 @@ public:
                        unsigned int const       q,
                        coefficient_type const & coefficient)
   {
-    coefficients_cell[cell][q] = coefficient;
+    coefficients_cell.set(cell, q, coefficient);
   }
 
   /**
@@ -106,7 +279,7 @@ public:
   coefficient_type
   get_coefficient_face(unsigned int const face, unsigned int const q) const
   {
-    return coefficients_face[face][q];
+    return coefficients_face.get(face, q);
   }
 
   /**
@@ -117,7 +290,7 @@ public:
                        unsigned int const       q,
                        coefficient_type const & coefficient)
   {
-    coefficients_face[face][q] = coefficient;
+    coefficients_face.set(face, q, coefficient);
   }
 
   /**
@@ -126,7 +299,7 @@ public:
   coefficient_type
   get_coefficient_face_neighbor(unsigned int const face, unsigned int const q) const
   {
-    return coefficients_face_neighbor[face][q];
+    return coefficients_face_neighbor.get(face, q);
   }
 
   /**
@@ -138,7 +311,7 @@ public:
                                 unsigned int const       q,
                                 coefficient_type const & coefficient)
   {
-    coefficients_face_neighbor[face][q] = coefficient;
+    coefficients_face_neighbor.set(face, q, coefficient);
   }
 
   /**
@@ -148,7 +321,7 @@ public:
   coefficient_type
   get_coefficient_face_cell_based(unsigned int const cell_based_face, unsigned int const q) const
   {
-    return coefficients_face_cell_based[cell_based_face][q];
+    return coefficients_face_cell_based.get(cell_based_face, q);
   }
 
   /**
@@ -160,7 +333,18 @@ public:
                                   unsigned int const       q,
                                   coefficient_type const & coefficient)
   {
-    coefficients_face_cell_based[cell_based_face][q] = coefficient;
+    coefficients_face_cell_based.set(cell_based_face, q, coefficient);
+  }
+
+  /**
+   * Returns the memory consumption of all coefficient tables in bytes.
+   */
+  std::size_t
+  memory_consumption() const
+  {
+    return coefficients_cell.memory_consumption() + coefficients_face.memory_consumption() +
+           coefficients_face_neighbor.memory_consumption() +
+           coefficients_face_cell_based.memory_consumption();
   }
 
 private:
@@ -172,15 +356,19 @@ private:
   void
   reinit(dealii::MatrixFree<dim, Number> const & matrix_free, unsigned int const quad_index)
   {
-    coefficients_cell.reinit(matrix_free.n_cell_batches(), matrix_free.get_n_q_points(quad_index));
+    coefficients_cell.reinit(matrix_free.n_cell_batches(),
+                             matrix_free.get_n_q_points(quad_index),
+                             store_in_reduced_precision);
 
     if(store_face_data)
     {
       coefficients_face.reinit(matrix_free.n_inner_face_batches() +
                                  matrix_free.n_boundary_face_batches(),
-                               matrix_free.get_n_q_points_face(quad_index));
+                               matrix_free.get_n_q_points_face(quad_index),
+                               store_in_reduced_precision);
       coefficients_face_neighbor.reinit(matrix_free.n_inner_face_batches(),
-                                        matrix_free.get_n_q_points_face(quad_index));
+                                        matrix_free.get_n_q_points_face(quad_index),
+                                        store_in_reduced_precision);
 
       if(store_cell_based_face_data)
       {
@@ -188,9 +376,12 @@ private:
           matrix_free.get_dof_handler().get_triangulation().get_reference_cells()[0].n_faces();
 
         coefficients_face_cell_based.reinit(matrix_free.n_cell_batches() * n_faces_per_cell,
-                                            matrix_free.get_n_q_points_face(quad_index));
+                                            matrix_free.get_n_q_points_face(quad_index),
+                                            store_in_reduced_precision);
       }
     }
+
+    memory.set(memory_consumption());
   }
 
   /**
@@ -212,16 +403,16 @@ private:
   }
 
   //! Coefficient table for cells
-  dealii::Table<2, coefficient_type> coefficients_cell;
+  internal::CoefficientTable<coefficient_type> coefficients_cell;
 
   //! Coefficient table for faces
-  dealii::Table<2, coefficient_type> coefficients_face;
+  internal::CoefficientTable<coefficient_type> coefficients_face;
 
   //! Coefficient table for neighbor faces
-  dealii::Table<2, coefficient_type> coefficients_face_neighbor;
+  internal::CoefficientTable<coefficient_type> coefficients_face_neighbor;
 
   //! Coefficient table for faces with cell-based access
-  dealii::Table<2, coefficient_type> coefficients_face_cell_based;
+  internal::CoefficientTable<coefficient_type> coefficients_face_cell_based;
 
   //! Boolean switch to use a coefficient table for faces
   bool store_face_data{false};
@@ -233,6 +424,12 @@ private:
    * is required alongside the separate face access.
    */
   bool store_cell_based_face_data{false};
+
+  //! Boolean switch to store the coefficients in reduced precision
+  bool store_in_reduced_precision{false};
+
+  //! Memory of the coefficient tables, see MemoryReport
+  MemoryReport::Entry memory{MemoryCategory::VariableCoefficients};
 };
 
 } // namespace ExaDG
@@ -25,8 +25,11 @@
 #endif
 
 // ExaDG
+#include <exadg/operators/throughput_model.h>
 #include <exadg/operators/throughput_parameters.h>
 #include <exadg/poisson/driver.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator_device.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -62,6 +65,9 @@ Driver<dim, Number>::setup()
 
   application->setup(grid, mapping, multigrid_mappings);
 
+  application->get_parameters().parallelization.setup_threads();
+  application->get_parameters().parallelization.setup_shared_memory_communicator();
+
   pde_operator = std::make_shared<Operator<dim, 1, Number>>(grid,
                                                             mapping,
                                                             multigrid_mappings,
@@ -80,6 +86,9 @@ Driver<dim, Number>::setup()
   }
 
   timer_tree.insert({"Poisson", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -161,6 +170,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     pcout << std::endl << "Timings for level 3:" << std::endl;
     timer_tree.print_level(pcout, 3);
 
+    pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+    timer_tree.print_imbalance(pcout, 2);
+
+    PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
     // Throughput of linear solver in DoFs/s per core
     print_throughput_10(pcout, DoFs, t_10, N_mpi_processes);
 
@@ -188,25 +202,62 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
   pcout << std::endl << "Computing matrix-vector product ..." << std::endl;
 
   dealii::LinearAlgebra::distributed::Vector<Number> dst, src;
-  pde_operator->initialize_dof_vector(src);
-  pde_operator->initialize_dof_vector(dst);
-  src = 1.0;
+
+#ifdef EXADG_WITH_DEVICE_OPERATORS
+  LaplaceOperatorDevice<dim, Number>                     laplace_operator_device;
+  typename LaplaceOperatorDevice<dim, Number>::VectorType dst_device, src_device;
+#endif
+
+  if(operator_type == OperatorType::ApplyDevice)
+  {
+#ifdef EXADG_WITH_DEVICE_OPERATORS
+    AssertThrow(application->get_parameters().spatial_discretization == SpatialDiscretization::CG,
+                dealii::ExcMessage("OperatorType::ApplyDevice requires a CG discretization."));
+
+    laplace_operator_device.initialize(*pde_operator->get_mapping(),
+                                       pde_operator->get_dof_handler(),
+                                       pde_operator->get_affine_constraints());
+    laplace_operator_device.initialize_dof_vector(src_device);
+    laplace_operator_device.initialize_dof_vector(dst_device);
+    src_device = 1.0;
+#else
+    AssertThrow(false,
+                dealii::ExcMessage("OperatorType::ApplyDevice requires deal.II 9.6 or newer."));
+#endif
+  }
+  else
+  {
+    pde_operator->initialize_dof_vector(src);
+    pde_operator->initialize_dof_vector(dst);
+    src = 1.0;
+  }
 
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::Evaluate)
       pde_operator->evaluate(dst, src, 0.0);
     else if(operator_type == OperatorType::Apply)
       pde_operator->vmult(dst, src);
+#ifdef EXADG_WITH_DEVICE_OPERATORS
+    else if(operator_type == OperatorType::ApplyDevice)
+    {
+      laplace_operator_device.vmult(dst_device, src_device);
+      // kernels are launched asynchronously
+      Kokkos::fence();
+    }
+#endif
     else
       AssertThrow(false, dealii::ExcMessage("not implemented."));
   };
 
   // do the measurements
+  double mpi_wait_share = 0.0;
+
   double const wall_time = measure_operator_evaluation_time(operator_evaluation,
                                                             application->get_parameters().degree,
                                                             n_repetitions_inner,
                                                             n_repetitions_outer,
-                                                            mpi_comm);
+                                                            mpi_comm,
+                                                            &mpi_wait_share);
 
   // calculate throughput
   dealii::types::global_dof_index const dofs = pde_operator->get_number_of_dofs();
@@ -217,12 +268,29 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
 
   if(not(is_test))
   {
+    std::pair<std::size_t, std::size_t> const memory =
+      pde_operator->get_memory_consumption_geometry();
+
     // clang-format off
     pcout << std::endl
           << std::scientific << std::setprecision(4)
           << "DoFs/sec:        " << throughput << std::endl
-          << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
+          << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl
+          << "Memory MatrixFree:          " << (double)memory.first / 1.e6 << " MB" << std::endl
+          << "Memory merged coefficients: " << (double)memory.second / 1.e6 << " MB" << std::endl;
     // clang-format on
+
+    // dst = A * src reads src and writes dst
+    ThroughputModel const model(dim,
+                                application->get_parameters().degree,
+                                1 /* n_components */,
+                                dofs,
+                                grid->triangulation->n_global_active_cells(),
+                                3 /* n_vector_accesses */,
+                                sizeof(Number),
+                                (double)(memory.first + memory.second));
+
+    model.print(pcout, throughput, N_mpi_processes, mpi_wait_share);
   }
 
   pcout << std::endl << " ... done." << std::endl << std::endl;
@@ -40,7 +40,8 @@ namespace Poisson
 enum class OperatorType
 {
   Evaluate,
-  Apply
+  Apply,
+  ApplyDevice // matrix-free operator evaluation on the device (only CG discretizations)
 };
 
 template<int dim, typename Number>
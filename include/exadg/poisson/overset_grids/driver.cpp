@@ -19,6 +19,11 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
 // ExaDG
 #include <exadg/poisson/overset_grids/driver.h>
 #include <exadg/utilities/print_general_infos.h>
@@ -54,6 +59,9 @@ Driver<dim, n_components, Number>::setup()
   AssertThrow(application->domain1.get(), dealii::ExcMessage("Domain 1 is uninitialized."));
   AssertThrow(application->domain2.get(), dealii::ExcMessage("Domain 2 is uninitialized."));
 
+  application->parse_parameters();
+  application->schwarz.print(pcout);
+
   application->domain1->setup_pre(grid1, mapping1, multigrid_mappings1, {"Domain1"});
   application->domain2->setup_pre(grid2, mapping2, multigrid_mappings2, {"Domain2"});
 
@@ -126,10 +134,96 @@ Driver<dim, n_components, Number>::solve()
   poisson1->postprocessor->do_postprocessing(sol_1);
   poisson2->postprocessor->do_postprocessing(sol_2);
 
-  // solve linear system of equations
+  SchwarzParameters const & schwarz = application->schwarz;
+
+  // The interface data entering a Schwarz iteration is the state of the fixed-point iteration. In
+  // case of the multiplicative coupling, the interface data of the second domain is determined by
+  // the first domain within the iteration and is not part of the state.
+  Containers containers = {poisson1->pde_operator->get_container_interface_data()};
+  if(schwarz.coupling == SchwarzCoupling::Additive)
+    containers.push_back(poisson2->pde_operator->get_container_interface_data());
+
+  std::vector<double> data     = get_interface_data(containers);
+  std::vector<double> residual = data, residual_old = data;
+
+  double omega    = schwarz.omega_init;
+  double norm_r_0 = 1.0;
+
   bool         converged = false;
   unsigned int iter      = 0;
-  while(not(converged))
+  while(not(converged) and iter < schwarz.max_iter)
+  {
+    do_schwarz_iteration(sol_1, rhs_1, sol_2, rhs_2);
+
+    // postprocessing of results
+    poisson1->postprocessor->do_postprocessing(sol_1);
+    poisson2->postprocessor->do_postprocessing(sol_2);
+
+    // change of the interface data
+    std::vector<double> const data_new = get_interface_data(containers);
+    for(unsigned int i = 0; i < data.size(); ++i)
+      residual[i] = data_new[i] - data[i];
+
+    double norm_r = 0.0;
+    for(double const r_i : residual)
+      norm_r += r_i * r_i;
+    norm_r = std::sqrt(dealii::Utilities::MPI::sum(norm_r, mpi_comm));
+
+    if(iter == 0)
+      norm_r_0 = norm_r;
+
+    converged = norm_r <= schwarz.abs_tol or norm_r <= schwarz.rel_tol * norm_r_0;
+
+    // relaxation
+    if(not(converged))
+    {
+      if(schwarz.acceleration == SchwarzAcceleration::Aitken and iter > 0)
+      {
+        double r_old_times_delta_r = 0.0, norm_delta_r_sqr = 0.0;
+        for(unsigned int i = 0; i < residual.size(); ++i)
+        {
+          double const delta_r = residual[i] - residual_old[i];
+          r_old_times_delta_r += residual_old[i] * delta_r;
+          norm_delta_r_sqr += delta_r * delta_r;
+        }
+        r_old_times_delta_r = dealii::Utilities::MPI::sum(r_old_times_delta_r, mpi_comm);
+        norm_delta_r_sqr    = dealii::Utilities::MPI::sum(norm_delta_r_sqr, mpi_comm);
+
+        if(norm_delta_r_sqr > 0.0)
+          omega *= -r_old_times_delta_r / norm_delta_r_sqr;
+      }
+
+      for(unsigned int i = 0; i < data.size(); ++i)
+        data[i] += omega * residual[i];
+
+      set_interface_data(containers, data);
+
+      residual_old.swap(residual);
+    }
+
+    ++iter;
+
+    pcout << std::endl
+          << "Schwarz iteration " << iter << ": |r| = " << std::scientific << std::setprecision(4)
+          << norm_r << ", omega = " << omega << std::defaultfloat << std::endl;
+  }
+
+  if(converged)
+    pcout << std::endl << "Schwarz iteration converged in " << iter << " iterations." << std::endl;
+  else
+    pcout << std::endl
+          << "Schwarz iteration did not converge within " << iter << " iterations." << std::endl;
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::do_schwarz_iteration(
+  dealii::LinearAlgebra::distributed::Vector<Number> & sol_1,
+  dealii::LinearAlgebra::distributed::Vector<Number> & rhs_1,
+  dealii::LinearAlgebra::distributed::Vector<Number> & sol_2,
+  dealii::LinearAlgebra::distributed::Vector<Number> & rhs_2) const
+{
+  if(application->schwarz.coupling == SchwarzCoupling::Multiplicative)
   {
     // solve on domain 1
     poisson1->pde_operator->rhs(rhs_1);
@@ -144,16 +238,69 @@ Driver<dim, n_components, Number>::solve()
 
     // Transfer data from 2 to 1
     second_to_first->update_data(sol_2);
+  }
+  else if(application->schwarz.coupling == SchwarzCoupling::Additive)
+  {
+    // both solves use the interface data of the previous iteration
+    poisson1->pde_operator->rhs(rhs_1);
+    poisson1->pde_operator->solve(sol_1, rhs_1, 0.0 /* time */);
 
-    // postprocessing of results
-    poisson1->postprocessor->do_postprocessing(sol_1);
-    poisson2->postprocessor->do_postprocessing(sol_2);
+    poisson2->pde_operator->rhs(rhs_2);
+    poisson2->pde_operator->solve(sol_2, rhs_2, 0.0 /* time */);
 
-    // TODO check convergence
-    ++iter;
-    if(iter > 10)
-      converged = true;
+    first_to_second->update_data(sol_1);
+    second_to_first->update_data(sol_2);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+}
+
+template<int dim, int n_components, typename Number>
+std::vector<double>
+Driver<dim, n_components, Number>::get_interface_data(Containers const & containers) const
+{
+  typedef typename ContainerInterfaceData<rank, dim, double>::data_type DataType;
+
+  std::vector<double> data;
+  for(auto const & container : containers)
+  {
+    for(auto const q_index : container->get_quad_indices())
+    {
+      for(DataType const & value : container->get_array_solution(q_index))
+        data.insert(data.end(),
+                    value.begin_raw(),
+                    value.begin_raw() + DataType::n_independent_components);
+    }
   }
+
+  return data;
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::set_interface_data(Containers const &          containers,
+                                                      std::vector<double> const & data) const
+{
+  typedef typename ContainerInterfaceData<rank, dim, double>::data_type DataType;
+
+  unsigned int i = 0;
+  for(auto const & container : containers)
+  {
+    for(auto const q_index : container->get_quad_indices())
+    {
+      for(DataType & value : container->get_array_solution(q_index))
+      {
+        std::copy(data.begin() + i,
+                  data.begin() + i + DataType::n_independent_components,
+                  value.begin_raw());
+        i += DataType::n_independent_components;
+      }
+    }
+  }
+
+  AssertThrow(i == data.size(), dealii::ExcMessage("Size of interface data does not match."));
 }
 
 template class Driver<2, 1, float>;
@@ -82,6 +82,30 @@ private:
   static unsigned int const rank =
     (n_components == 1) ? 0 : ((n_components == dim) ? 1 : dealii::numbers::invalid_unsigned_int);
 
+  typedef std::vector<std::shared_ptr<ContainerInterfaceData<rank, dim, double>>> Containers;
+
+  /*
+   * Solves both domains once and transfers the solutions to the interface data of the respective
+   * other domain.
+   */
+  void
+  do_schwarz_iteration(dealii::LinearAlgebra::distributed::Vector<Number> & sol_1,
+                       dealii::LinearAlgebra::distributed::Vector<Number> & rhs_1,
+                       dealii::LinearAlgebra::distributed::Vector<Number> & sol_2,
+                       dealii::LinearAlgebra::distributed::Vector<Number> & rhs_2) const;
+
+  /*
+   * Copies the interface data of all quadrature points of the containers into a single vector.
+   */
+  std::vector<double>
+  get_interface_data(Containers const & containers) const;
+
+  /*
+   * Inverse operation of get_interface_data().
+   */
+  void
+  set_interface_data(Containers const & containers, std::vector<double> const & data) const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
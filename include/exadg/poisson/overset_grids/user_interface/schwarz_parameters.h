@@ -0,0 +1,137 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_POISSON_OVERSET_GRIDS_USER_INTERFACE_SCHWARZ_PARAMETERS_H_
+#define INCLUDE_EXADG_POISSON_OVERSET_GRIDS_USER_INTERFACE_SCHWARZ_PARAMETERS_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/parameter_handler.h>
+
+// ExaDG
+#include <exadg/utilities/enum_patterns.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace Poisson
+{
+namespace OversetGrids
+{
+/*
+ * Multiplicative: the second domain is solved with the interface data of the first domain of the
+ * same Schwarz iteration (alternating Schwarz method).
+ *
+ * Additive: both domains are solved with the interface data of the previous Schwarz iteration,
+ * such that the two solves of an iteration do not depend on each other.
+ */
+enum class SchwarzCoupling
+{
+  Multiplicative,
+  Additive
+};
+
+/*
+ * Relaxation of the interface data between two Schwarz iterations, where Aitken uses the dynamic
+ * relaxation parameter of Aitken's delta^2 method.
+ */
+enum class SchwarzAcceleration
+{
+  None,
+  Aitken
+};
+
+struct SchwarzParameters
+{
+  SchwarzParameters()
+  {
+  }
+
+  SchwarzParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    prm.enter_subsection("Schwarz");
+    {
+      prm.add_parameter("Coupling",
+                        coupling,
+                        "Multiplicative or additive coupling of the two domains.");
+      prm.add_parameter("Acceleration",
+                        acceleration,
+                        "Relaxation of the interface data between Schwarz iterations.");
+      prm.add_parameter("OmegaInit",
+                        omega_init,
+                        "(Initial) relaxation parameter.",
+                        dealii::Patterns::Double(0.0, 1.0));
+      prm.add_parameter("AbsTol",
+                        abs_tol,
+                        "Absolute tolerance for the change of the interface data.",
+                        dealii::Patterns::Double(0.0));
+      prm.add_parameter("RelTol",
+                        rel_tol,
+                        "Relative tolerance for the change of the interface data.",
+                        dealii::Patterns::Double(0.0));
+      prm.add_parameter("MaxIter",
+                        max_iter,
+                        "Maximum number of Schwarz iterations.",
+                        dealii::Patterns::Integer(1));
+    }
+    prm.leave_subsection();
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    pcout << std::endl << "Schwarz iteration:" << std::endl;
+
+    print_parameter(pcout, "Coupling", coupling);
+    print_parameter(pcout, "Acceleration", acceleration);
+    print_parameter(pcout, "Omega init", omega_init);
+    print_parameter(pcout, "Absolute tolerance", abs_tol);
+    print_parameter(pcout, "Relative tolerance", rel_tol);
+    print_parameter(pcout, "Maximum number of iterations", max_iter);
+  }
+
+  SchwarzCoupling coupling = SchwarzCoupling::Multiplicative;
+
+  SchwarzAcceleration acceleration = SchwarzAcceleration::None;
+
+  double omega_init = 1.0;
+
+  double abs_tol = 1.e-12;
+
+  double rel_tol = 1.e-6;
+
+  unsigned int max_iter = 100;
+};
+
+} // namespace OversetGrids
+} // namespace Poisson
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POISSON_OVERSET_GRIDS_USER_INTERFACE_SCHWARZ_PARAMETERS_H_ */
@@ -69,8 +69,8 @@ void
 MultigridPreconditioner<dim, Number, n_components>::update()
 {
   // update of this multigrid preconditioner is only needed
-  // if the mesh is moving
-  if(mesh_is_moving)
+  // if the mesh has moved since the last update
+  if(mesh_is_moving and this->geometry_has_changed())
   {
     this->initialize_mapping();
 
@@ -30,7 +30,10 @@
 // utilities
 #include <exadg/grid/grid_data.h>
 #include <exadg/operators/resolution_parameters.h>
+#include <exadg/utilities/ensemble.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
+#include <exadg/utilities/profiling.h>
 
 // application
 #include <exadg/poisson/user_interface/declare_get_application.h>
@@ -86,44 +89,17 @@ run(std::vector<SolverResult> & results,
   SolverResult result = driver->print_performance_results(timer.wall_time());
   results.push_back(result);
 }
-} // namespace ExaDG
 
-int
-main(int argc, char ** argv)
+/*
+ * Runs the convergence study defined by the input file on the given communicator.
+ */
+void
+run_input_file(std::string const & input_file, MPI_Comm const & mpi_comm)
 {
-  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  GeneralParameters                 general(input_file);
+  SpatialResolutionParametersMinMax spatial(input_file);
 
-  MPI_Comm mpi_comm(MPI_COMM_WORLD);
-
-  std::string input_file;
-
-  if(argc == 1)
-  {
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-    {
-      std::cout << "To run the program, use:      ./solver input_file" << std::endl
-                << "To setup the input file, use: ./solver input_file --help" << std::endl;
-    }
-
-    return 0;
-  }
-  else if(argc >= 2)
-  {
-    input_file = std::string(argv[1]);
-
-    if(argc == 3 and std::string(argv[2]) == "--help")
-    {
-      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-        ExaDG::create_input_file(input_file);
-
-      return 0;
-    }
-  }
-
-  ExaDG::GeneralParameters                 general(input_file);
-  ExaDG::SpatialResolutionParametersMinMax spatial(input_file);
-
-  std::vector<ExaDG::SolverResult> results;
+  std::vector<SolverResult> results;
 
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
@@ -135,19 +111,19 @@ main(int argc, char ** argv)
     {
       if(general.dim == 2 and general.precision == "float")
       {
-        ExaDG::run<2, float>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
+        run<2, float>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
       }
       else if(general.dim == 2 and general.precision == "double")
       {
-        ExaDG::run<2, double>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
+        run<2, double>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
       }
       else if(general.dim == 3 and general.precision == "float")
       {
-        ExaDG::run<3, float>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
+        run<3, float>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
       }
       else if(general.dim == 3 and general.precision == "double")
       {
-        ExaDG::run<3, double>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
+        run<3, double>(results, input_file, degree, refine_space, mpi_comm, general.is_test);
       }
       else
       {
@@ -160,6 +136,56 @@ main(int argc, char ** argv)
   if(not(general.is_test))
     print_results(results, mpi_comm);
 
+  if(not general.performance_report.empty())
+    PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+}
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  ExaDG::ProfilingSession profiling;
+
+  MPI_Comm mpi_comm(MPI_COMM_WORLD);
+
+  std::string input_file;
+
+  if(argc == 1)
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      std::cout << "To run the program, use:      ./solver input_file" << std::endl
+                << "To setup the input file, use: ./solver input_file --help" << std::endl
+                << "To run an ensemble, use:      ./solver --ensemble ensemble_file" << std::endl;
+    }
+
+    return 0;
+  }
+  else if(argc == 3 and std::string(argv[1]) == "--ensemble")
+  {
+    ExaDG::EnsembleParameters ensemble(argv[2]);
+
+    ExaDG::run_ensemble(ensemble, ExaDG::run_input_file, mpi_comm);
+
+    return 0;
+  }
+  else if(argc >= 2)
+  {
+    input_file = std::string(argv[1]);
+
+    if(argc == 3 and std::string(argv[2]) == "--help")
+    {
+      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+        ExaDG::create_input_file(input_file);
+
+      return 0;
+    }
+  }
+
+  ExaDG::run_input_file(input_file, mpi_comm);
+
   return 0;
 }
 
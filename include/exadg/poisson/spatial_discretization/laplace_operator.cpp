@@ -41,7 +41,10 @@ LaplaceOperator<dim, Number, n_components>::initialize(
 
   Base::reinit(matrix_free, affine_constraints, data);
 
-  kernel.reinit(matrix_free, data.kernel_data, data.dof_index);
+  kernel.reinit(matrix_free, data.kernel_data, data.dof_index, data.quad_index);
+
+  if(data.use_dense_simplex_kernels)
+    dense_simplex_kernel.reinit(matrix_free, data.dof_index, data.quad_index);
 
   this->integrator_flags = kernel.get_integrator_flags(this->is_dg);
 }
@@ -60,6 +63,18 @@ void
 LaplaceOperator<dim, Number, n_components>::update_penalty_parameter()
 {
   calculate_penalty_parameter(this->get_matrix_free(), this->get_data().dof_index);
+
+  if(kernel.use_merged_coefficients())
+    kernel.calculate_merged_coefficients(this->get_matrix_free(),
+                                         this->get_data().dof_index,
+                                         this->get_data().quad_index);
+}
+
+template<int dim, typename Number, int n_components>
+std::size_t
+LaplaceOperator<dim, Number, n_components>::memory_consumption_merged_coefficients() const
+{
+  return kernel.memory_consumption_merged_coefficients();
 }
 
 template<int dim, typename Number, int n_components>
@@ -126,12 +141,116 @@ template<int dim, typename Number, int n_components>
 void
 LaplaceOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & integrator) const
 {
+  do_cell_integral_templated(integrator);
+}
+
+template<int dim, typename Number, int n_components>
+template<typename Integrator>
+void
+LaplaceOperator<dim, Number, n_components>::do_cell_integral_templated(
+  Integrator & integrator) const
+{
+  if(kernel.use_merged_coefficients())
+  {
+    kernel.do_cell_integral_merged_coefficients(integrator);
+    return;
+  }
+
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     integrator.submit_gradient(integrator.get_gradient(q), q);
   }
 }
 
+template<int dim, typename Number, int n_components>
+bool
+LaplaceOperator<dim, Number, n_components>::cell_loop_fixed_degree(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  return expand_fixed_degree(
+    matrix_free,
+    operator_data.dof_index,
+    operator_data.quad_index,
+    [&](auto degree, auto n_q_points_1d) {
+      CellIntegratorFixedDegree<dim,
+                                decltype(degree)::value,
+                                decltype(n_q_points_1d)::value,
+                                n_components,
+                                Number>
+        integrator(matrix_free, operator_data.dof_index, operator_data.quad_index);
+
+      for(auto cell = range.first; cell < range.second; ++cell)
+      {
+        integrator.reinit(cell);
+
+        integrator.gather_evaluate(src, this->integrator_flags.cell_evaluate);
+
+        do_cell_integral_templated(integrator);
+
+        integrator.integrate_scatter(this->integrator_flags.cell_integrate, dst);
+      }
+    });
+}
+
+template<int dim, typename Number, int n_components>
+bool
+LaplaceOperator<dim, Number, n_components>::cell_loop_dense_simplex(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  if(not dense_simplex_kernel.is_active())
+    return false;
+
+  IntegratorCell integrator(matrix_free, operator_data.dof_index, operator_data.quad_index);
+
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> dst_values(integrator.dofs_per_cell);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    this->reinit_cell(integrator, cell);
+
+    if(dense_simplex_kernel.cell_is_affine(matrix_free, cell))
+    {
+      integrator.read_dof_values(src);
+
+      dense_simplex_kernel.apply_laplace(integrator.begin_dof_values(),
+                                         dst_values.begin(),
+                                         dense_simplex_kernel.get_laplace_coefficient(integrator),
+                                         n_components);
+
+      std::copy(dst_values.begin(), dst_values.end(), integrator.begin_dof_values());
+
+      integrator.distribute_local_to_global(dst);
+    }
+    else
+    {
+      integrator.gather_evaluate(src, this->integrator_flags.cell_evaluate);
+
+      do_cell_integral_templated(integrator);
+
+      integrator.integrate_scatter(this->integrator_flags.cell_integrate, dst);
+    }
+  }
+
+  return true;
+}
+
+template<int dim, typename Number, int n_components>
+FastDiagonalizationCoefficients
+LaplaceOperator<dim, Number, n_components>::get_fast_diagonalization_coefficients() const
+{
+  FastDiagonalizationCoefficients coefficients;
+  coefficients.laplace_factor = 1.0;
+  coefficients.IP_factor      = operator_data.kernel_data.IP_factor;
+
+  return coefficients;
+}
+
 template<int dim, typename Number, int n_components>
 void
 LaplaceOperator<dim, Number, n_components>::do_face_integral(IntegratorFace & integrator_m,
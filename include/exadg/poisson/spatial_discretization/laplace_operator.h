@@ -22,7 +22,12 @@
 #ifndef LAPLACE_OPERATOR_H
 #define LAPLACE_OPERATOR_H
 
+// deal.II
+#include <deal.II/base/symmetric_tensor.h>
+
+// ExaDG
 #include <exadg/grid/grid_data.h>
+#include <exadg/operators/dense_simplex_kernel.h>
 #include <exadg/operators/interior_penalty_parameter.h>
 #include <exadg/operators/operator_base.h>
 #include <exadg/operators/operator_type.h>
@@ -36,11 +41,16 @@ namespace Operators
 {
 struct LaplaceKernelData
 {
-  LaplaceKernelData() : IP_factor(1.0)
+  LaplaceKernelData() : IP_factor(1.0), use_merged_coefficients(false)
   {
   }
 
   double IP_factor;
+
+  // Store the merged geometry coefficients J^{-1} J^{-T} det(J) w_q of the cell integrals instead
+  // of reading the inverse Jacobian and JxW values from the MatrixFree object, which reduces the
+  // memory traffic of cell integrals on non-affine meshes.
+  bool use_merged_coefficients;
 };
 
 template<int dim, typename Number, int n_components = 1>
@@ -51,17 +61,21 @@ private:
 
   typedef dealii::VectorizedArray<Number> scalar;
 
+  typedef dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>> symmetric_tensor;
+
+  typedef CellIntegrator<dim, n_components, Number> IntegratorCell;
   typedef FaceIntegrator<dim, n_components, Number> IntegratorFace;
 
 public:
-  LaplaceKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  LaplaceKernel() : degree(1), penalty_factor(1.0), tau(dealii::make_vectorized_array<Number>(0.0))
   {
   }
 
   void
   reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
          LaplaceKernelData const &               data_in,
-         unsigned int const                      dof_index)
+         unsigned int const                      dof_index,
+         unsigned int const                      quad_index)
   {
     data = data_in;
 
@@ -69,6 +83,9 @@ public:
     degree                                = fe.degree;
 
     calculate_penalty_parameter(matrix_free, dof_index);
+
+    if(data.use_merged_coefficients)
+      calculate_merged_coefficients(matrix_free, dof_index, quad_index);
   }
 
   void
@@ -76,6 +93,104 @@ public:
                               unsigned int const                      dof_index)
   {
     IP::calculate_penalty_parameter<dim, Number>(array_penalty_parameter, matrix_free, dof_index);
+
+    penalty_factor = IP::get_penalty_factor<dim, Number>(
+      degree,
+      get_element_type(matrix_free.get_dof_handler(dof_index).get_triangulation()),
+      data.IP_factor);
+
+    IP::calculate_face_penalty_parameter<dim, Number>(array_face_penalty_parameter,
+                                                      array_penalty_parameter,
+                                                      matrix_free,
+                                                      penalty_factor);
+  }
+
+  /*
+   * Computes the coefficients C_q = J^{-1} J^{-T} det(J) w_q, i.e. the geometry contribution of the
+   * cell integral (grad(v), grad(u)) written in reference coordinates. Only the symmetric part is
+   * stored.
+   */
+  void
+  calculate_merged_coefficients(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                unsigned int const                      dof_index,
+                                unsigned int const                      quad_index)
+  {
+    IntegratorCell integrator(matrix_free, dof_index, quad_index);
+
+    n_q_points_cell = integrator.n_q_points;
+    merged_coefficients.resize(matrix_free.n_cell_batches() * n_q_points_cell);
+
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+
+      for(unsigned int q = 0; q < n_q_points_cell; ++q)
+      {
+        // inverse_jacobian() returns the inverse and transposed Jacobian J^{-T}
+        dealii::Tensor<2, dim, scalar> const inv_jac_transposed = integrator.inverse_jacobian(q);
+        scalar const                         JxW                = integrator.JxW(q);
+
+        symmetric_tensor & coefficient = merged_coefficients[cell * n_q_points_cell + q];
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          for(unsigned int e = d; e < dim; ++e)
+          {
+            scalar sum = inv_jac_transposed[0][d] * inv_jac_transposed[0][e];
+            for(unsigned int k = 1; k < dim; ++k)
+              sum += inv_jac_transposed[k][d] * inv_jac_transposed[k][e];
+            coefficient[d][e] = sum * JxW;
+          }
+        }
+      }
+    }
+  }
+
+  bool
+  use_merged_coefficients() const
+  {
+    return data.use_merged_coefficients;
+  }
+
+  /*
+   * Cell integral using the merged coefficients: The gradients at quadrature points are accessed in
+   * reference coordinates and the result is written back in reference coordinates, so that the
+   * subsequent integrate() step does not need any geometry information.
+   */
+  template<typename Integrator>
+  void
+  do_cell_integral_merged_coefficients(Integrator & integrator) const
+  {
+    unsigned int const cell = integrator.get_current_cell_index();
+
+    AssertThrow(integrator.n_q_points == n_q_points_cell,
+                dealii::ExcMessage("Merged coefficients have been computed for a different "
+                                   "quadrature rule."));
+
+    scalar * gradients = integrator.begin_gradients();
+
+    for(unsigned int q = 0; q < n_q_points_cell; ++q)
+    {
+      symmetric_tensor const & coefficient = merged_coefficients[cell * n_q_points_cell + q];
+
+      for(unsigned int c = 0; c < n_components; ++c)
+      {
+        scalar * gradients_c = gradients + c * dim * n_q_points_cell + q;
+
+        dealii::Tensor<1, dim, scalar> gradient_ref;
+        for(unsigned int d = 0; d < dim; ++d)
+          gradient_ref[d] = gradients_c[d * n_q_points_cell];
+
+        dealii::Tensor<1, dim, scalar> const flux = coefficient * gradient_ref;
+        for(unsigned int d = 0; d < dim; ++d)
+          gradients_c[d * n_q_points_cell] = flux[d];
+      }
+    }
+  }
+
+  std::size_t
+  memory_consumption_merged_coefficients() const
+  {
+    return merged_coefficients.memory_consumption();
   }
 
   IntegratorFlags
@@ -129,24 +244,18 @@ public:
               IntegratorFace &   integrator_p,
               unsigned int const dof_index) const
   {
-    tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
-                   integrator_p.read_cell_data(array_penalty_parameter)) *
-          IP::get_penalty_factor<dim, Number>(
-            degree,
-            get_element_type(
-              integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-            data.IP_factor);
+    (void)integrator_p;
+    (void)dof_index;
+
+    tau = array_face_penalty_parameter[integrator_m.get_current_cell_index()];
   }
 
   void
   reinit_boundary_face(IntegratorFace & integrator_m, unsigned int const dof_index) const
   {
-    tau = integrator_m.read_cell_data(array_penalty_parameter) *
-          IP::get_penalty_factor<dim, Number>(
-            degree,
-            get_element_type(
-              integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-            data.IP_factor);
+    (void)dof_index;
+
+    tau = array_face_penalty_parameter[integrator_m.get_current_cell_index()];
   }
 
   void
@@ -155,24 +264,17 @@ public:
                          IntegratorFace &                 integrator_p,
                          unsigned int const               dof_index) const
   {
+    (void)dof_index;
+
     if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
     {
       tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
                      integrator_p.read_cell_data(array_penalty_parameter)) *
-            IP::get_penalty_factor<dim, Number>(
-              degree,
-              get_element_type(
-                integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-              data.IP_factor);
+            penalty_factor;
     }
     else // boundary face
     {
-      tau = integrator_m.read_cell_data(array_penalty_parameter) *
-            IP::get_penalty_factor<dim, Number>(
-              degree,
-              get_element_type(
-                integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
-              data.IP_factor);
+      tau = integrator_m.read_cell_data(array_penalty_parameter) * penalty_factor;
     }
   }
 
@@ -202,6 +304,14 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
+  // penalty parameter of each face batch including the penalty factor
+  dealii::AlignedVector<scalar> array_face_penalty_parameter;
+
+  Number penalty_factor;
+
+  unsigned int                            n_q_points_cell = 0;
+  dealii::AlignedVector<symmetric_tensor> merged_coefficients;
+
   mutable scalar tau;
 };
 
@@ -264,6 +374,10 @@ public:
   void
   update_penalty_parameter();
 
+  // Memory used by the merged geometry coefficients (zero if this option is not used).
+  std::size_t
+  memory_consumption_merged_coefficients() const;
+
   // continuous FE: This function sets the inhomogeneous Dirichlet boundary values for Dirichlet
   // degrees of freedom.
   void
@@ -295,6 +409,26 @@ private:
   void
   do_cell_integral(IntegratorCell & integrator) const final;
 
+  // cell integral for integrators with runtime or compile-time polynomial degree
+  template<typename Integrator>
+  void
+  do_cell_integral_templated(Integrator & integrator) const;
+
+  bool
+  cell_loop_fixed_degree(dealii::MatrixFree<dim, Number> const & matrix_free,
+                         VectorType &                            dst,
+                         VectorType const &                      src,
+                         Range const &                           range) const final;
+
+  bool
+  cell_loop_dense_simplex(dealii::MatrixFree<dim, Number> const & matrix_free,
+                          VectorType &                            dst,
+                          VectorType const &                      src,
+                          Range const &                           range) const final;
+
+  FastDiagonalizationCoefficients
+  get_fast_diagonalization_coefficients() const final;
+
   void
   do_face_integral(IntegratorFace & integrator_m, IntegratorFace & integrator_p) const final;
 
@@ -344,6 +478,8 @@ private:
   LaplaceOperatorData<rank, dim> operator_data;
 
   Operators::LaplaceKernel<dim, Number, n_components> kernel;
+
+  DenseSimplexKernel<dim, Number> dense_simplex_kernel;
 };
 
 } // namespace Poisson
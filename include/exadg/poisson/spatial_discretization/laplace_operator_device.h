@@ -0,0 +1,167 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POISSON_SPATIAL_DISCRETIZATION_LAPLACE_OPERATOR_DEVICE_H_
+#define INCLUDE_EXADG_POISSON_SPATIAL_DISCRETIZATION_LAPLACE_OPERATOR_DEVICE_H_
+
+// deal.II
+#include <deal.II/base/config.h>
+
+// The portable (Kokkos-based) matrix-free framework of deal.II is available with the interface
+// used below since deal.II 9.6.
+#if DEAL_II_VERSION_GTE(9, 6, 0)
+#  define EXADG_WITH_DEVICE_OPERATORS
+#endif
+
+#ifdef EXADG_WITH_DEVICE_OPERATORS
+
+// deal.II
+#  include <deal.II/base/quadrature_lib.h>
+#  include <deal.II/dofs/dof_handler.h>
+#  include <deal.II/fe/mapping.h>
+#  include <deal.II/lac/affine_constraints.h>
+#  include <deal.II/lac/la_parallel_vector.h>
+#  include <deal.II/matrix_free/portable_fe_evaluation.h>
+#  include <deal.II/matrix_free/portable_matrix_free.h>
+
+// ExaDG
+#  include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+namespace Poisson
+{
+namespace internal
+{
+template<int dim, int degree, typename Number>
+class LaplaceQuadPointDevice
+{
+public:
+  DEAL_II_HOST_DEVICE void
+  operator()(dealii::Portable::FEEvaluation<dim, degree, degree + 1, 1, Number> * integrator,
+             int const                                                          q) const
+  {
+    integrator->submit_gradient(integrator->get_gradient(q), q);
+  }
+};
+
+template<int dim, int degree, typename Number>
+class LaplaceCellKernelDevice
+{
+public:
+  static unsigned int const n_local_dofs = dealii::Utilities::pow(degree + 1, dim);
+  static unsigned int const n_q_points   = dealii::Utilities::pow(degree + 1, dim);
+
+  DEAL_II_HOST_DEVICE void
+  operator()(unsigned int const                                               cell,
+             typename dealii::Portable::MatrixFree<dim, Number>::Data const * data,
+             dealii::Portable::SharedData<dim, Number> *                      shared_data,
+             Number const *                                                   src,
+             Number *                                                         dst) const
+  {
+    (void)cell;
+
+    dealii::Portable::FEEvaluation<dim, degree, degree + 1, 1, Number> integrator(data,
+                                                                                  shared_data);
+    integrator.read_dof_values(src);
+    integrator.evaluate(dealii::EvaluationFlags::gradients);
+    integrator.apply_for_each_quad_point(LaplaceQuadPointDevice<dim, degree, Number>());
+    integrator.integrate(dealii::EvaluationFlags::gradients);
+    integrator.distribute_local_to_global(dst);
+  }
+};
+} // namespace internal
+
+/*
+ * Laplace operator of continuous Galerkin discretizations with scalar Lagrange elements on
+ * hypercube meshes, evaluated on the device via the portable matrix-free framework of deal.II
+ * (dealii::Portable::MatrixFree). The operator works on vectors in the default memory space of
+ * Kokkos and can be combined with the Krylov solvers of deal.II operating on these vectors. The
+ * cell kernels require the polynomial degree at compile time, which is translated from the
+ * runtime degree via internal::expand_fixed_degree().
+ */
+template<int dim, typename Number>
+class LaplaceOperatorDevice
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number, dealii::MemorySpace::Default>
+    VectorType;
+
+  LaplaceOperatorDevice() : degree(0)
+  {
+  }
+
+  void
+  initialize(dealii::Mapping<dim> const &              mapping,
+             dealii::DoFHandler<dim> const &           dof_handler,
+             dealii::AffineConstraints<Number> const & constraints)
+  {
+    AssertThrow(dof_handler.get_triangulation().all_reference_cells_are_hyper_cube(),
+                dealii::ExcMessage("LaplaceOperatorDevice requires hypercube elements."));
+    AssertThrow(dof_handler.get_fe().n_components() == 1 and
+                  dof_handler.get_fe().n_dofs_per_vertex() > 0,
+                dealii::ExcMessage("LaplaceOperatorDevice requires scalar continuous elements."));
+
+    degree = dof_handler.get_fe().degree;
+
+    AssertThrow(degree >= 1 and degree <= EXADG_FIXED_DEGREE_MAX,
+                dealii::ExcMessage("LaplaceOperatorDevice is not instantiated for this degree."));
+
+    typename dealii::Portable::MatrixFree<dim, Number>::AdditionalData additional_data;
+    additional_data.mapping_update_flags =
+      dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+    matrix_free.reinit(
+      mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    matrix_free.initialize_dof_vector(vector);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    dst = 0.0;
+
+    ExaDG::internal::expand_fixed_degree<1>(degree, degree + 1, [&](auto degree_constant, auto) {
+      internal::LaplaceCellKernelDevice<dim, decltype(degree_constant)::value, Number> kernel;
+      matrix_free.cell_loop(kernel, src, dst);
+    });
+
+    // the operator is the identity for constrained degrees of freedom
+    matrix_free.copy_constrained_values(src, dst);
+  }
+
+private:
+  unsigned int degree;
+
+  dealii::Portable::MatrixFree<dim, Number> matrix_free;
+};
+
+} // namespace Poisson
+} // namespace ExaDG
+
+#endif
+
+#endif /* INCLUDE_EXADG_POISSON_SPATIAL_DISCRETIZATION_LAPLACE_OPERATOR_DEVICE_H_ */
@@ -22,6 +22,7 @@
 // deal.II
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/lac/petsc_vector.h>
+#include <deal.II/lac/precondition.h>
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
@@ -37,6 +38,7 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_amg.h>
 #include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+#include <exadg/solvers_and_preconditioners/solvers/multiple_rhs_cg.h>
 #include <exadg/solvers_and_preconditioners/utilities/check_multigrid.h>
 #include <exadg/solvers_and_preconditioners/utilities/petsc_operation.h>
 #include <exadg/utilities/exceptions.h>
@@ -238,9 +240,14 @@ Operator<dim, n_components, Number>::setup_operators()
 
     laplace_operator_data.quad_index_gauss_lobatto = get_quad_index_gauss_lobatto();
   }
-  laplace_operator_data.bc                    = boundary_descriptor;
-  laplace_operator_data.use_cell_based_loops  = param.enable_cell_based_face_loops;
-  laplace_operator_data.kernel_data.IP_factor = param.IP_factor;
+  laplace_operator_data.bc                            = boundary_descriptor;
+  laplace_operator_data.use_cell_based_loops          = param.enable_cell_based_face_loops;
+  laplace_operator_data.use_fixed_degree_kernels      = param.use_fixed_degree_kernels;
+  laplace_operator_data.use_dense_simplex_kernels     = param.use_dense_simplex_kernels;
+  laplace_operator_data.use_persistent_ghost_exchange = param.use_persistent_ghost_exchange;
+  laplace_operator_data.kernel_data.IP_factor         = param.IP_factor;
+  laplace_operator_data.kernel_data.use_merged_coefficients =
+    param.use_merged_geometry_coefficients;
   laplace_operator.initialize(*matrix_free, affine_constraints, laplace_operator_data);
 
   // rhs operator
@@ -266,6 +273,8 @@ Operator<dim, n_components, Number>::setup()
 
   fill_matrix_free_data(*mf_data);
 
+  param.parallelization.fill_additional_data(mf_data->data, mpi_comm);
+
   if(param.enable_cell_based_face_loops)
     Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
   mf->reinit(*get_mapping(),
@@ -274,6 +283,8 @@ Operator<dim, n_components, Number>::setup()
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
+  memory_matrix_free.set(mf->memory_consumption());
+
   // Subsequently, call the other setup function with MatrixFree/MatrixFreeData objects as
   // arguments.
   this->setup(mf, mf_data);
@@ -492,6 +503,16 @@ Operator<dim, n_components, Number>::solve(VectorType &       sol,
     check_multigrid.check();
   }
 
+  if(param.use_full_multigrid_initial_guess)
+  {
+    typedef MultigridPreconditioner<dim, Number, n_components> Multigrid;
+
+    std::shared_ptr<Multigrid> mg_preconditioner =
+      std::dynamic_pointer_cast<Multigrid>(preconditioner);
+
+    mg_preconditioner->apply_full_multigrid(sol, rhs, param.full_multigrid_cycles_per_level);
+  }
+
   unsigned int n_iterations = iterative_solver->solve(sol, rhs);
 
   // Set Dirichlet degrees of freedom according to Dirichlet boundary condition.
@@ -504,6 +525,39 @@ Operator<dim, n_components, Number>::solve(VectorType &       sol,
   return n_iterations;
 }
 
+template<int dim, int n_components, typename Number>
+std::vector<unsigned int>
+Operator<dim, n_components, Number>::solve_multiple(
+  std::vector<VectorType *> const &       sol,
+  std::vector<VectorType const *> const & rhs,
+  double const                            time) const
+{
+  AssertThrow(param.solver == LinearSolver::CG,
+              dealii::ExcMessage("Solving for multiple right-hand sides requires the CG solver."));
+
+  dealii::ReductionControl const solver_control(param.solver_data.max_iter,
+                                                param.solver_data.abs_tol,
+                                                param.solver_data.rel_tol);
+
+  Krylov::MultipleRHSCG<VectorType> solver(solver_control);
+
+  std::vector<unsigned int> n_iterations;
+  if(param.preconditioner == Preconditioner::None)
+    n_iterations = solver.solve(laplace_operator, sol, rhs, dealii::PreconditionIdentity());
+  else
+    n_iterations = solver.solve(laplace_operator, sol, rhs, *preconditioner);
+
+  // Set Dirichlet degrees of freedom according to Dirichlet boundary condition.
+  if(param.spatial_discretization == SpatialDiscretization::CG)
+  {
+    laplace_operator.set_time(time);
+    for(VectorType * solution : sol)
+      laplace_operator.set_inhomogeneous_boundary_values(*solution);
+  }
+
+  return n_iterations;
+}
+
 template<int dim, int n_components, typename Number>
 std::shared_ptr<dealii::MatrixFree<dim, Number> const>
 Operator<dim, n_components, Number>::get_matrix_free() const
@@ -518,6 +572,13 @@ Operator<dim, n_components, Number>::get_dof_handler() const
   return dof_handler;
 }
 
+template<int dim, int n_components, typename Number>
+dealii::AffineConstraints<Number> const &
+Operator<dim, n_components, Number>::get_affine_constraints() const
+{
+  return affine_constraints;
+}
+
 template<int dim, int n_components, typename Number>
 dealii::types::global_dof_index
 Operator<dim, n_components, Number>::get_number_of_dofs() const
@@ -525,6 +586,19 @@ Operator<dim, n_components, Number>::get_number_of_dofs() const
   return dof_handler.n_dofs();
 }
 
+template<int dim, int n_components, typename Number>
+std::pair<std::size_t, std::size_t>
+Operator<dim, n_components, Number>::get_memory_consumption_geometry() const
+{
+  std::size_t const memory_matrix_free =
+    dealii::Utilities::MPI::sum(matrix_free->memory_consumption(), mpi_comm);
+  std::size_t const memory_merged_coefficients =
+    dealii::Utilities::MPI::sum(laplace_operator.memory_consumption_merged_coefficients(),
+                                mpi_comm);
+
+  return std::make_pair(memory_matrix_free, memory_merged_coefficients);
+}
+
 template<int dim, int n_components, typename Number>
 double
 Operator<dim, n_components, Number>::get_n10() const
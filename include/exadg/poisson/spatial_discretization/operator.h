@@ -32,6 +32,7 @@
 #include <exadg/poisson/user_interface/field_functions.h>
 #include <exadg/poisson/user_interface/parameters.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -98,6 +99,17 @@ public:
   unsigned int
   solve(VectorType & sol, VectorType const & rhs, double const time) const;
 
+  /*
+   * Solves the linear system for several right-hand sides rhs[i] with one setup of operator and
+   * preconditioner, where the operator is applied to all vectors within one matrix-free loop (see
+   * Krylov::MultipleRHSCG). Only available for the CG solver. Returns the number of iterations of
+   * each system.
+   */
+  std::vector<unsigned int>
+  solve_multiple(std::vector<VectorType *> const &       sol,
+                 std::vector<VectorType const *> const & rhs,
+                 double const                            time) const;
+
   /*
    * Setters and getters.
    */
@@ -108,9 +120,17 @@ public:
   dealii::DoFHandler<dim> const &
   get_dof_handler() const;
 
+  dealii::AffineConstraints<Number> const &
+  get_affine_constraints() const;
+
   dealii::types::global_dof_index
   get_number_of_dofs() const;
 
+  // memory consumption (in bytes, accumulated over all MPI processes) of the geometry data used by
+  // the Laplace operator: MatrixFree object and merged geometry coefficients
+  std::pair<std::size_t, std::size_t>
+  get_memory_consumption_geometry() const;
+
   double
   get_n10() const;
 
@@ -221,6 +241,9 @@ private:
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
 
+  // memory of the MatrixFree object created in setup(), see MemoryReport
+  MemoryReport::Entry memory_matrix_free{MemoryCategory::MatrixFree};
+
   /*
    * Interface coupling
    */
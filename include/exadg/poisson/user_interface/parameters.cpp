@@ -47,7 +47,14 @@ Parameters::Parameters()
     compute_performance_metrics(false),
     preconditioner(Preconditioner::Undefined),
     multigrid_data(MultigridData()),
-    enable_cell_based_face_loops(false)
+    use_full_multigrid_initial_guess(false),
+    full_multigrid_cycles_per_level(2),
+    enable_cell_based_face_loops(false),
+    use_merged_geometry_coefficients(false),
+    use_fixed_degree_kernels(false),
+    use_dense_simplex_kernels(false),
+    use_persistent_ghost_exchange(false),
+    parallelization(ParallelizationData())
 {
 }
 
@@ -68,6 +75,17 @@ Parameters::check() const
   AssertThrow(solver != LinearSolver::Undefined, dealii::ExcMessage("parameter must be defined."));
   AssertThrow(preconditioner != Preconditioner::Undefined,
               dealii::ExcMessage("parameter must be defined."));
+
+  if(use_full_multigrid_initial_guess)
+  {
+    AssertThrow(preconditioner == Preconditioner::Multigrid,
+                dealii::ExcMessage("Full multigrid requires the multigrid preconditioner."));
+    AssertThrow(full_multigrid_cycles_per_level > 0,
+                dealii::ExcMessage("Full multigrid requires at least one cycle per level."));
+  }
+
+  // NUMERICAL PARAMETERS
+  parallelization.check();
 }
 
 bool
@@ -137,7 +155,13 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
   print_parameter(pcout, "Preconditioner", preconditioner);
 
   if(preconditioner == Preconditioner::Multigrid)
+  {
     multigrid_data.print(pcout);
+
+    print_parameter(pcout, "Full multigrid initial guess", use_full_multigrid_initial_guess);
+    if(use_full_multigrid_initial_guess)
+      print_parameter(pcout, "Full multigrid cycles per level", full_multigrid_cycles_per_level);
+  }
 }
 
 
@@ -147,6 +171,12 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
   pcout << std::endl << "Numerical parameters:" << std::endl;
 
   print_parameter(pcout, "Enable cell-based face loops", enable_cell_based_face_loops);
+  print_parameter(pcout, "Use merged geometry coefficients", use_merged_geometry_coefficients);
+  print_parameter(pcout, "Use fixed-degree kernels", use_fixed_degree_kernels);
+  print_parameter(pcout, "Use dense simplex kernels", use_dense_simplex_kernels);
+  print_parameter(pcout, "Use persistent ghost exchange", use_persistent_ghost_exchange);
+
+  parallelization.print(pcout);
 }
 
 
@@ -23,6 +23,7 @@
 #define INCLUDE_LAPLACE_INPUT_PARAMETERS_H_
 
 #include <exadg/grid/grid_data.h>
+#include <exadg/matrix_free/parallelization_data.h>
 #include <exadg/poisson/user_interface/enum_types.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
@@ -115,6 +116,13 @@ public:
   // description: see declaration of MultigridData
   MultigridData multigrid_data;
 
+  // Compute the initial guess of the solver by full multigrid, i.e., by a solution on the
+  // coarsest level of the multigrid hierarchy that is prolongated level by level and improved by
+  // full_multigrid_cycles_per_level V-cycles on each level. Replaces the initial guess given by
+  // the initial solution. Requires the multigrid preconditioner.
+  bool         use_full_multigrid_initial_guess;
+  unsigned int full_multigrid_cycles_per_level;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                NUMERICAL PARAMETERS                                */
@@ -128,6 +136,29 @@ public:
   // individual cells (for example block Jacobi). With this parameter, the loop structure
   // can be changed to such an algorithm (cell_based_face_loops).
   bool enable_cell_based_face_loops;
+
+  // By default, the cell integrals of the Laplace operator read the inverse Jacobian and the JxW
+  // values at each quadrature point from the MatrixFree object. With this parameter, the merged
+  // coefficients J^{-1} J^{-T} det(J) w_q are precomputed and stored instead (dim*(dim+1)/2 instead
+  // of dim*dim+1 values per quadrature point), which reduces the memory traffic on non-affine
+  // meshes at the cost of additional memory.
+  bool use_merged_geometry_coefficients;
+
+  // Evaluate the cell integrals with sum-factorization kernels specialized for the polynomial degree
+  // at compile time (even-odd decomposition, collocation basis), see OperatorBaseData.
+  bool use_fixed_degree_kernels;
+
+  // Evaluate the cell integrals on affine simplex cells with dense reference-cell matrices instead
+  // of interpolating to quadrature points, see DenseSimplexKernel.
+  bool use_dense_simplex_kernels;
+
+  // Import the ghost values in the matrix-vector products of the Laplace operator, including the
+  // multigrid levels, via persistent MPI requests, see PersistentGhostExchange.
+  bool use_persistent_ghost_exchange;
+
+  // Shared-memory parallelization and overlap of communication and computation of the
+  // matrix-free loops.
+  ParallelizationData parallelization;
 };
 
 } // namespace Poisson
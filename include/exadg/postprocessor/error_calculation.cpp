@@ -30,6 +30,7 @@
 #include <exadg/operators/quadrature.h>
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/work_precision_report.h>
 
 namespace ExaDG
 {
@@ -184,6 +185,8 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
   pcout << ((relative == true) ? "  Relative " : "  Absolute ")
         << "error (L2-norm): " << std::scientific << std::setprecision(5) << error << std::endl;
 
+  WorkPrecisionReport::get().add_error(error_data.name + " L2", error);
+
   if(error_data.write_errors_to_file)
   {
     // write output file
@@ -231,6 +234,8 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
           << "error (H1-seminorm): " << std::scientific << std::setprecision(5) << error
           << std::endl;
 
+    WorkPrecisionReport::get().add_error(error_data.name + " H1-seminorm", error);
+
     if(error_data.write_errors_to_file)
     {
       // write output file
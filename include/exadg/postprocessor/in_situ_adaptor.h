@@ -0,0 +1,74 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_IN_SITU_ADAPTOR_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_IN_SITU_ADAPTOR_H_
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+namespace ExaDG
+{
+template<int dim>
+class SnapshotDataOut;
+
+/*
+ * Interface to hand the field output to an in-situ visualization or analysis pipeline (e.g.
+ * ParaView Catalyst or Ascent) instead of, or in addition to, writing files. The adaptor is called
+ * by the output generators at the output times defined by TimeControl with the DataOut object
+ * whose patches have just been built. The patches, i.e., the mesh in terms of the vertices of the
+ * subdivided cells and the field values at these vertices, are accessed in-place via
+ * SnapshotDataOut::get_patches(), as well as the names of the fields. The adaptor must not store
+ * references to the DataOut object, which is destroyed after the call.
+ *
+ * Derived classes implement the function for the dimension(s) they support.
+ */
+class InSituAdaptor
+{
+public:
+  virtual ~InSituAdaptor()
+  {
+  }
+
+  virtual void
+  execute(SnapshotDataOut<2> const & data_out, double const time, unsigned int const counter)
+  {
+    (void)data_out;
+    (void)time;
+    (void)counter;
+
+    AssertThrow(false, dealii::ExcMessage("In-situ adaptor is not implemented for dim = 2."));
+  }
+
+  virtual void
+  execute(SnapshotDataOut<3> const & data_out, double const time, unsigned int const counter)
+  {
+    (void)data_out;
+    (void)time;
+    (void)counter;
+
+    AssertThrow(false, dealii::ExcMessage("In-situ adaptor is not implemented for dim = 3."));
+  }
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_IN_SITU_ADAPTOR_H_ */
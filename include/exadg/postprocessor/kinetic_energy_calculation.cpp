@@ -79,6 +79,31 @@ KineticEnergyCalculator<dim, Number>::calculate_basic(VectorType const & velocit
 
   integrate(*matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
 
+  write_basic(time, kinetic_energy, enstrophy, dissipation, max_vorticity);
+}
+
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::write_integrals(
+  dealii::ArrayView<Number const> const & integrals,
+  Number const                            max_vorticity,
+  double const                            time)
+{
+  Number kinetic_energy = 0.0, enstrophy = 0.0, dissipation = 0.0;
+
+  normalize_integrals(integrals, kinetic_energy, enstrophy, dissipation);
+
+  write_basic(time, kinetic_energy, enstrophy, dissipation, max_vorticity);
+}
+
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::write_basic(double const time,
+                                                  Number const kinetic_energy,
+                                                  Number const enstrophy,
+                                                  Number const dissipation,
+                                                  Number const max_vorticity)
+{
   // write output file
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
@@ -126,21 +151,35 @@ KineticEnergyCalculator<dim, Number>::integrate(dealii::MatrixFree<dim, Number>
                                                 Number &                                dissipation,
                                                 Number & max_vorticity)
 {
-  std::vector<Number> dst(5, 0.0);
+  std::vector<Number> dst(n_integrals + 1, 0.0);
   matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
 
   // sum over all MPI processes
-  Number volume = 1.0;
-  volume        = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
-  energy        = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
-  enstrophy     = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
-  dissipation   = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+  dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(dst.data(), n_integrals),
+                              mpi_comm,
+                              dealii::ArrayView<Number>(dst.data(), n_integrals));
 
-  energy /= volume;
-  enstrophy /= volume;
-  dissipation /= volume;
+  max_vorticity = dealii::Utilities::MPI::max(dst.at(n_integrals), mpi_comm);
 
-  max_vorticity = dealii::Utilities::MPI::max(dst.at(4), mpi_comm);
+  return normalize_integrals(dealii::ArrayView<Number const>(dst.data(), n_integrals),
+                             energy,
+                             enstrophy,
+                             dissipation);
+}
+
+template<int dim, typename Number>
+Number
+KineticEnergyCalculator<dim, Number>::normalize_integrals(
+  dealii::ArrayView<Number const> const & integrals,
+  Number &                                energy,
+  Number &                                enstrophy,
+  Number &                                dissipation) const
+{
+  Number const volume = integrals[0];
+
+  energy      = integrals[1] / volume;
+  enstrophy   = integrals[2] / volume;
+  dissipation = integrals[3] / volume;
 
   return volume;
 }
@@ -155,12 +194,6 @@ KineticEnergyCalculator<dim, Number>::cell_loop(
 {
   CellIntegrator<dim, dim, Number> fe_eval(matrix_free, dof_index, quad_index);
 
-  Number volume        = 0.;
-  Number energy        = 0.;
-  Number enstrophy     = 0.;
-  Number dissipation   = 0.;
-  Number max_vorticity = 0.;
-
   // Loop over all elements
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
@@ -168,52 +201,59 @@ KineticEnergyCalculator<dim, Number>::cell_loop(
     fe_eval.read_dof_values(src);
     fe_eval.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
 
-    scalar volume_vec        = dealii::make_vectorized_array<Number>(0.);
-    scalar energy_vec        = dealii::make_vectorized_array<Number>(0.);
-    scalar enstrophy_vec     = dealii::make_vectorized_array<Number>(0.);
-    scalar dissipation_vec   = dealii::make_vectorized_array<Number>(0.);
-    scalar max_vorticity_vec = dealii::make_vectorized_array<Number>(0.);
-
-    for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
-    {
-      volume_vec += fe_eval.JxW(q);
+    integrate_cell_batch(fe_eval,
+                         matrix_free.n_active_entries_per_cell_batch(cell),
+                         dealii::ArrayView<Number>(dst.data(), n_integrals),
+                         dst.at(n_integrals));
+  }
+}
 
-      vector velocity = fe_eval.get_value(q);
-      energy_vec +=
-        fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * velocity * velocity;
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::integrate_cell_batch(
+  CellIntegrator<dim, dim, Number> const & fe_eval,
+  unsigned int const                       n_active_entries,
+  dealii::ArrayView<Number> const &        integrals,
+  Number &                                 max_vorticity) const
+{
+  scalar volume_vec        = dealii::make_vectorized_array<Number>(0.);
+  scalar energy_vec        = dealii::make_vectorized_array<Number>(0.);
+  scalar enstrophy_vec     = dealii::make_vectorized_array<Number>(0.);
+  scalar dissipation_vec   = dealii::make_vectorized_array<Number>(0.);
+  scalar max_vorticity_vec = dealii::make_vectorized_array<Number>(0.);
 
-      tensor velocity_gradient = fe_eval.get_gradient(q);
-      dissipation_vec += fe_eval.JxW(q) *
-                         dealii::make_vectorized_array<Number>(this->data.viscosity) *
-                         scalar_product(velocity_gradient, velocity_gradient);
+  for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
+  {
+    volume_vec += fe_eval.JxW(q);
 
-      dealii::Tensor<1, number_vorticity_components, scalar> omega = fe_eval.get_curl(q);
+    vector velocity = fe_eval.get_value(q);
+    energy_vec += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * velocity * velocity;
 
-      scalar norm_omega = omega * omega;
+    tensor velocity_gradient = fe_eval.get_gradient(q);
+    dissipation_vec += fe_eval.JxW(q) *
+                       dealii::make_vectorized_array<Number>(this->data.viscosity) *
+                       scalar_product(velocity_gradient, velocity_gradient);
 
-      enstrophy_vec += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
+    dealii::Tensor<1, number_vorticity_components, scalar> omega = fe_eval.get_curl(q);
 
-      max_vorticity_vec = std::max(max_vorticity_vec, std::sqrt(norm_omega));
-    }
+    scalar norm_omega = omega * omega;
 
-    // sum over entries of dealii::VectorizedArray, but only over those
-    // that are "active"
-    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
-    {
-      volume += volume_vec[v];
-      energy += energy_vec[v];
-      enstrophy += enstrophy_vec[v];
-      dissipation += dissipation_vec[v];
+    enstrophy_vec += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
 
-      max_vorticity = std::max(max_vorticity, max_vorticity_vec[v]);
-    }
+    max_vorticity_vec = std::max(max_vorticity_vec, std::sqrt(norm_omega));
   }
 
-  dst.at(0) += volume;
-  dst.at(1) += energy;
-  dst.at(2) += enstrophy;
-  dst.at(3) += dissipation;
-  dst.at(4) = std::max(dst.at(4), max_vorticity);
+  // sum over entries of dealii::VectorizedArray, but only over those
+  // that are "active"
+  for(unsigned int v = 0; v < n_active_entries; ++v)
+  {
+    integrals[0] += volume_vec[v];
+    integrals[1] += energy_vec[v];
+    integrals[2] += enstrophy_vec[v];
+    integrals[3] += dissipation_vec[v];
+
+    max_vorticity = std::max(max_vorticity, max_vorticity_vec[v]);
+  }
 }
 
 template class KineticEnergyCalculator<2, float>;
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_POSTPROCESSOR_KINETIC_ENERGY_CALCULATION_H_
 
 // deal.II
+#include <deal.II/base/array_view.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
@@ -99,12 +100,49 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   *  Interface to evaluate the kinetic energy in a cell loop shared with other postprocessing
+   *  tools (evaluate_individual_terms = false only): integrate_cell_batch() adds the contributions
+   *  of a cell batch, whose values and gradients have been evaluated by the integrator, to the
+   *  n_integrals integrals (volume, kinetic energy, enstrophy, dissipation) and to the maximum
+   *  vorticity. After the reduction over all MPI processes by the caller, write_integrals() writes
+   *  the results.
+   */
+  static unsigned int const n_integrals = 4;
+
+  void
+  integrate_cell_batch(CellIntegrator<dim, dim, Number> const & fe_eval,
+                       unsigned int const                       n_active_entries,
+                       dealii::ArrayView<Number> const &        integrals,
+                       Number &                                 max_vorticity) const;
+
+  void
+  write_integrals(dealii::ArrayView<Number const> const & integrals,
+                  Number const                            max_vorticity,
+                  double const                            time);
+
   TimeControl time_control;
 
 protected:
   void
   calculate_basic(VectorType const & velocity, double const time);
 
+  void
+  write_basic(double const time,
+              Number const kinetic_energy,
+              Number const enstrophy,
+              Number const dissipation,
+              Number const max_vorticity);
+
+  /*
+   *  Normalizes the integrals summed over all MPI processes by the volume, which is returned.
+   */
+  Number
+  normalize_integrals(dealii::ArrayView<Number const> const & integrals,
+                      Number &                                energy,
+                      Number &                                enstrophy,
+                      Number &                                dissipation) const;
+
   /*
    *  This function calculates the kinetic energy
    *
@@ -350,222 +350,242 @@ namespace ExaDG
  * and
  *
  *  v_i (..., - x_j,..., t) = + v_i(..., x_j,..., t) if i != j
+ *
+ * The communication pattern to mirror the solution on the symmetric box to the full box is
+ * determined once in the constructor, since it only depends on the meshes, and is reused for all
+ * evaluations.
  */
-template<int dim, typename Number>
-void
-apply_taylor_green_symmetry(dealii::DoFHandler<dim> const & dof_handler_symm,
-                            dealii::DoFHandler<dim> const & dof_handler,
-                            double const                    n_cells_1d,
-                            double const                    delta,
-                            const dealii::LinearAlgebra::distributed::Vector<Number> & vector_symm,
-                            dealii::LinearAlgebra::distributed::Vector<Number> &       vector)
+template<int dim>
+class TaylorGreenSymmetry
 {
-  AssertThrow(
-    dof_handler_symm.get_triangulation().all_reference_cells_are_hyper_cube(),
-    dealii::ExcMessage(
-      "This functionality is only available for meshes consisting of hypercube elements."));
-  AssertThrow(
-    dof_handler.get_triangulation().all_reference_cells_are_hyper_cube(),
-    dealii::ExcMessage(
-      "This functionality is only available for meshes consisting of hypercube elements."));
-
-  // determine some useful constants
-  auto const & fe = dof_handler.get_fe();
-
-  MPI_Comm const comm = dof_handler.get_communicator();
-
-  // determine which process has which index (lex numbering) and wants which
-  dealii::IndexSet range_has_lex(dof_handler_symm.n_dofs());  // has in symm system
-  dealii::IndexSet range_want_lex(dof_handler_symm.n_dofs()); // want in full system
-
-  // ... and create a map: lex to cell iterators
-  std::map<unsigned int, typename dealii::DoFHandler<dim>::active_cell_iterator>
-    map_lex_to_cell_symm;
-  std::map<unsigned int, std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator>>
-    map_lex_to_cell_full;
-
+public:
+  TaylorGreenSymmetry(dealii::DoFHandler<dim> const & dof_handler_symm,
+                      dealii::DoFHandler<dim> const & dof_handler_full_in,
+                      double const                    n_cells_1d,
+                      double const                    delta)
+    : dof_handler_full(dof_handler_full_in), comm(dof_handler_full_in.get_communicator())
   {
-    auto norm_point_to_lex = [&](dealii::Point<dim> const c) {
-      // convert normalized point [0, 1] to lex
-      if(dim == 2)
-        return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1d * std::floor(c[1]));
-      else
-        return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1d * std::floor(c[1]) +
-                                        n_cells_1d * n_cells_1d * std::floor(c[2]));
-    };
+    AssertThrow(
+      dof_handler_symm.get_triangulation().all_reference_cells_are_hyper_cube(),
+      dealii::ExcMessage(
+        "This functionality is only available for meshes consisting of hypercube elements."));
+    AssertThrow(
+      dof_handler_full.get_triangulation().all_reference_cells_are_hyper_cube(),
+      dealii::ExcMessage(
+        "This functionality is only available for meshes consisting of hypercube elements."));
 
-    // ... has (symm)
-    for(auto const & cell : dof_handler_symm.active_cell_iterators())
-      if(cell->is_active() and cell->is_locally_owned())
-      {
-        auto c = cell->center();
-        for(unsigned int i = 0; i < dim; i++)
-          c[i] = c[i] / delta;
+    // determine which process has which index (lex numbering) and wants which
+    dealii::IndexSet range_has_lex(dof_handler_symm.n_dofs()); // has in symm system
+    range_want_lex.set_size(dof_handler_symm.n_dofs());        // want in full system
 
-        unsigned int const lid = norm_point_to_lex(c);
+    {
+      auto norm_point_to_lex = [&](dealii::Point<dim> const c) {
+        // convert normalized point [0, 1] to lex
+        if(dim == 2)
+          return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1d * std::floor(c[1]));
+        else
+          return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1d * std::floor(c[1]) +
+                                          n_cells_1d * n_cells_1d * std::floor(c[2]));
+      };
+
+      // ... has (symm)
+      for(auto const & cell : dof_handler_symm.active_cell_iterators())
+        if(cell->is_active() and cell->is_locally_owned())
+        {
+          auto c = cell->center();
+          for(unsigned int i = 0; i < dim; i++)
+            c[i] = c[i] / delta;
 
-        range_has_lex.add_index(lid);
-        map_lex_to_cell_symm[lid] = cell;
-      }
+          unsigned int const lid = norm_point_to_lex(c);
 
-    // want (full)
-    for(auto const & cell : dof_handler.active_cell_iterators())
-      if(cell->is_active() and cell->is_locally_owned())
-      {
-        auto c = cell->center();
-        for(unsigned int i = 0; i < dim; i++)
-          c[i] = std::abs(c[i]) / delta;
+          range_has_lex.add_index(lid);
+          map_lex_to_cell_symm[lid] = cell;
+        }
 
-        unsigned int const lex = norm_point_to_lex(c);
+      // want (full)
+      for(auto const & cell : dof_handler_full.active_cell_iterators())
+        if(cell->is_active() and cell->is_locally_owned())
+        {
+          auto c = cell->center();
+          for(unsigned int i = 0; i < dim; i++)
+            c[i] = std::abs(c[i]) / delta;
 
-        range_want_lex.add_index(lex);
-        map_lex_to_cell_full[lex].emplace_back(cell);
-      }
-  }
+          unsigned int const lex = norm_point_to_lex(c);
 
-  // determine who has and who wants data
-  std::map<unsigned int, std::vector<unsigned int>> recv_map_proc_to_lex_offset;
-  std::map<unsigned int, dealii::IndexSet>          send_map_proc_to_lex;
+          range_want_lex.add_index(lex);
+          map_lex_to_cell_full[lex].emplace_back(cell);
+        }
+    }
 
-  {
-    std::vector<unsigned int> owning_ranks_of_ghosts(range_want_lex.n_elements());
+    // determine who has and who wants data
+    {
+      std::vector<unsigned int> owning_ranks_of_ghosts(range_want_lex.n_elements());
 
-    // set up dictionary
-    dealii::Utilities::MPI::internal::ComputeIndexOwner::ConsensusAlgorithmsPayload process(
-      range_has_lex, range_want_lex, comm, owning_ranks_of_ghosts, true);
+      // set up dictionary
+      dealii::Utilities::MPI::internal::ComputeIndexOwner::ConsensusAlgorithmsPayload process(
+        range_has_lex, range_want_lex, comm, owning_ranks_of_ghosts, true);
 
-    dealii::Utilities::MPI::ConsensusAlgorithms::Selector<
-      std::vector<std::pair<dealii::types::global_dof_index, dealii::types::global_dof_index>>,
-      std::vector<unsigned int>>
-      consensus_algorithm;
-    consensus_algorithm.run(process, comm);
+      dealii::Utilities::MPI::ConsensusAlgorithms::Selector<
+        std::vector<std::pair<dealii::types::global_dof_index, dealii::types::global_dof_index>>,
+        std::vector<unsigned int>>
+        consensus_algorithm;
+      consensus_algorithm.run(process, comm);
 
-    for(auto const & owner : owning_ranks_of_ghosts)
-      recv_map_proc_to_lex_offset[owner] = std::vector<unsigned int>();
+      for(auto const & owner : owning_ranks_of_ghosts)
+        recv_map_proc_to_lex_offset[owner] = std::vector<unsigned int>();
 
-    for(unsigned int i = 0; i < owning_ranks_of_ghosts.size(); i++)
-      recv_map_proc_to_lex_offset[owning_ranks_of_ghosts[i]].push_back(i);
+      for(unsigned int i = 0; i < owning_ranks_of_ghosts.size(); i++)
+        recv_map_proc_to_lex_offset[owning_ranks_of_ghosts[i]].push_back(i);
 
-    send_map_proc_to_lex = process.get_requesters();
+      send_map_proc_to_lex = process.get_requesters();
+    }
   }
 
-  // perform data exchange and fill this buffer
-  std::vector<double> data_buffer(range_want_lex.n_elements() * fe.n_dofs_per_cell());
+  template<typename Number>
+  void
+  apply(dealii::LinearAlgebra::distributed::Vector<Number> const & vector_symm,
+        dealii::LinearAlgebra::distributed::Vector<Number> &       vector) const
   {
-    // data structure for MPI exchange
-    std::map<unsigned int, std::vector<double>> recv_buffer;
-    {
-      std::map<unsigned int, std::vector<double>> send_buffers;
+    auto const & fe = dof_handler_full.get_fe();
 
-      std::vector<MPI_Request> recv_requests(recv_map_proc_to_lex_offset.size());
-      std::vector<MPI_Request> send_requests(send_map_proc_to_lex.size());
+    // perform data exchange and fill this buffer
+    std::vector<double> data_buffer(range_want_lex.n_elements() * fe.n_dofs_per_cell());
+    {
+      // data structure for MPI exchange
+      std::map<unsigned int, std::vector<double>> recv_buffer;
+      {
+        std::map<unsigned int, std::vector<double>> send_buffers;
 
-      unsigned int recv_couter = 0;
-      unsigned int send_couter = 0;
+        std::vector<MPI_Request> recv_requests(recv_map_proc_to_lex_offset.size());
+        std::vector<MPI_Request> send_requests(send_map_proc_to_lex.size());
 
-      // post recv
-      for(auto const & recv_offset : recv_map_proc_to_lex_offset)
-      {
-        recv_buffer[recv_offset.first].resize(recv_offset.second.size() * fe.n_dofs_per_cell());
-        MPI_Irecv(recv_buffer[recv_offset.first].data(),
-                  recv_buffer[recv_offset.first].size(),
-                  MPI_DOUBLE,
-                  recv_offset.first,
-                  0,
-                  comm,
-                  &recv_requests[recv_couter++]);
-      }
+        unsigned int recv_couter = 0;
+        unsigned int send_couter = 0;
 
-      // post send
-      for(auto const & send_index_set : send_map_proc_to_lex)
-      {
-        // allocate memory
-        auto & send_buffer = send_buffers[send_index_set.first];
-        send_buffer.resize(send_index_set.second.n_elements() * fe.n_dofs_per_cell());
-
-        // collect data to be send
-        auto                                         send_buffer_ptr = &send_buffer[0];
-        std::vector<dealii::types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
-        for(auto const cell_index : send_index_set.second)
+        // post recv
+        for(auto const & recv_offset : recv_map_proc_to_lex_offset)
         {
-          auto const & cell_accessor = map_lex_to_cell_symm[cell_index];
-          cell_accessor->get_dof_indices(dof_indices);
-
-          for(unsigned int i = 0; i < fe.n_dofs_per_cell(); i++)
-            send_buffer_ptr[i] = vector_symm[dof_indices[i]];
-          send_buffer_ptr += fe.n_dofs_per_cell();
+          recv_buffer[recv_offset.first].resize(recv_offset.second.size() * fe.n_dofs_per_cell());
+          MPI_Irecv(recv_buffer[recv_offset.first].data(),
+                    recv_buffer[recv_offset.first].size(),
+                    MPI_DOUBLE,
+                    recv_offset.first,
+                    0,
+                    comm,
+                    &recv_requests[recv_couter++]);
         }
 
-        // send data
-        MPI_Isend(send_buffer.data(),
-                  send_buffer.size(),
-                  MPI_DOUBLE,
-                  send_index_set.first,
-                  0,
-                  comm,
-                  &send_requests[send_couter++]);
-      }
+        // post send
+        for(auto const & send_index_set : send_map_proc_to_lex)
+        {
+          // allocate memory
+          auto & send_buffer = send_buffers[send_index_set.first];
+          send_buffer.resize(send_index_set.second.n_elements() * fe.n_dofs_per_cell());
+
+          // collect data to be send
+          auto                                         send_buffer_ptr = &send_buffer[0];
+          std::vector<dealii::types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+          for(auto const cell_index : send_index_set.second)
+          {
+            auto const & cell_accessor = map_lex_to_cell_symm.at(cell_index);
+            cell_accessor->get_dof_indices(dof_indices);
+
+            for(unsigned int i = 0; i < fe.n_dofs_per_cell(); i++)
+              send_buffer_ptr[i] = vector_symm[dof_indices[i]];
+            send_buffer_ptr += fe.n_dofs_per_cell();
+          }
+
+          // send data
+          MPI_Isend(send_buffer.data(),
+                    send_buffer.size(),
+                    MPI_DOUBLE,
+                    send_index_set.first,
+                    0,
+                    comm,
+                    &send_requests[send_couter++]);
+        }
 
-      // wait that data has been send and received
-      MPI_Waitall(recv_couter, recv_requests.data(), MPI_STATUSES_IGNORE);
-      MPI_Waitall(send_couter, send_requests.data(), MPI_STATUSES_IGNORE);
+        // wait that data has been send and received
+        MPI_Waitall(recv_couter, recv_requests.data(), MPI_STATUSES_IGNORE);
+        MPI_Waitall(send_couter, send_requests.data(), MPI_STATUSES_IGNORE);
 
-      // copy received data into a single buffer
-      for(auto const & recv_offset : recv_map_proc_to_lex_offset)
-      {
-        auto const & buffer = recv_buffer[recv_offset.first];
+        // copy received data into a single buffer
+        for(auto const & recv_offset : recv_map_proc_to_lex_offset)
+        {
+          auto const & buffer = recv_buffer[recv_offset.first];
 
-        unsigned int counter = 0;
-        for(auto const & offset : recv_offset.second)
-          for(unsigned int i = 0; i < fe.n_dofs_per_cell(); i++)
-            data_buffer[offset * fe.n_dofs_per_cell() + i] = buffer[counter++];
+          unsigned int counter = 0;
+          for(auto const & offset : recv_offset.second)
+            for(unsigned int i = 0; i < fe.n_dofs_per_cell(); i++)
+              data_buffer[offset * fe.n_dofs_per_cell() + i] = buffer[counter++];
+        }
       }
     }
-  }
-
-  // read buffer and fill full vector
-  {
-    auto send_buffer_ptr = &data_buffer[0];
 
-    unsigned int const n_dofs_per_component = fe.n_dofs_per_cell() / dim;
-
-    std::vector<dealii::types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
-    for(auto const cell_index : range_want_lex)
+    // read buffer and fill full vector
     {
-      auto const & cell_accessors = map_lex_to_cell_full[cell_index];
+      auto send_buffer_ptr = &data_buffer[0];
+
+      unsigned int const n_dofs_per_component = fe.n_dofs_per_cell() / dim;
 
-      for(auto const & cell_accessor : cell_accessors)
+      std::vector<dealii::types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+      for(auto const cell_index : range_want_lex)
       {
-        cell_accessor->get_dof_indices(dof_indices);
+        auto const & cell_accessors = map_lex_to_cell_full.at(cell_index);
 
-        for(unsigned int i = 0; i < n_dofs_per_component; i++)
+        for(auto const & cell_accessor : cell_accessors)
         {
-          dealii::Point<dim, unsigned int> p =
-            dim == 2 ? dealii::Point<dim, unsigned int>(i % (fe.degree + 1), i / (fe.degree + 1)) :
-                       dealii::Point<dim, unsigned int>(i % (fe.degree + 1),
-                                                        (i % ((fe.degree + 1) * (fe.degree + 1))) /
-                                                          (fe.degree + 1),
-                                                        i / (fe.degree + 1) / (fe.degree + 1));
-
-          auto c = cell_accessor->center();
-
-          for(unsigned int v = 0; v < dim; v++)
-            if(c[v] < 0)
-              p[v] = fe.degree - p[v];
-
-          unsigned int const shift =
-            dim == 2 ? (p[0] + p[1] * (1 + fe.degree)) :
-                       (p[0] + p[1] * (1 + fe.degree) + p[2] * (1 + fe.degree) * (1 + fe.degree));
-
-          for(unsigned int d = 0; d < dim; d++)
-            vector[dof_indices[i + d * n_dofs_per_component]] =
-              send_buffer_ptr[shift + d * n_dofs_per_component] * (c[d] < 0.0 ? -1.0 : +1.0);
+          cell_accessor->get_dof_indices(dof_indices);
+
+          for(unsigned int i = 0; i < n_dofs_per_component; i++)
+          {
+            dealii::Point<dim, unsigned int> p =
+              dim == 2 ?
+                dealii::Point<dim, unsigned int>(i % (fe.degree + 1), i / (fe.degree + 1)) :
+                dealii::Point<dim, unsigned int>(i % (fe.degree + 1),
+                                                 (i % ((fe.degree + 1) * (fe.degree + 1))) /
+                                                   (fe.degree + 1),
+                                                 i / (fe.degree + 1) / (fe.degree + 1));
+
+            auto c = cell_accessor->center();
+
+            for(unsigned int v = 0; v < dim; v++)
+              if(c[v] < 0)
+                p[v] = fe.degree - p[v];
+
+            unsigned int const shift =
+              dim == 2 ?
+                (p[0] + p[1] * (1 + fe.degree)) :
+                (p[0] + p[1] * (1 + fe.degree) + p[2] * (1 + fe.degree) * (1 + fe.degree));
+
+            for(unsigned int d = 0; d < dim; d++)
+              vector[dof_indices[i + d * n_dofs_per_component]] =
+                send_buffer_ptr[shift + d * n_dofs_per_component] * (c[d] < 0.0 ? -1.0 : +1.0);
+          }
         }
+        send_buffer_ptr += fe.n_dofs_per_cell();
       }
-      send_buffer_ptr += fe.n_dofs_per_cell();
     }
   }
-}
+
+private:
+  dealii::DoFHandler<dim> const & dof_handler_full;
+
+  MPI_Comm const comm;
+
+  // lex indices of the cells the full system wants
+  dealii::IndexSet range_want_lex;
+
+  // map: lex to cell iterators
+  std::map<unsigned int, typename dealii::DoFHandler<dim>::active_cell_iterator>
+    map_lex_to_cell_symm;
+  std::map<unsigned int, std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator>>
+    map_lex_to_cell_full;
+
+  // who has and who wants data
+  std::map<unsigned int, std::vector<unsigned int>> recv_map_proc_to_lex_offset;
+  std::map<unsigned int, dealii::IndexSet>          send_map_proc_to_lex;
+};
 
 template<typename MeshType, typename Number>
 void
@@ -639,6 +659,19 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
       dof_handler_full = std::make_shared<dealii::DoFHandler<dim>>(*tria_full);
       dof_handler_full->distribute_dofs(*fe_full);
 
+      // the communication pattern and the vector of the full system are set up only once
+      unsigned int n_cells_1d =
+        data.n_cells_1d_coarse_grid * dealii::Utilities::pow(2, data.refine_level);
+
+      taylor_green_symmetry = std::make_shared<TaylorGreenSymmetry<dim>>(
+        *dof_handler,
+        *dof_handler_full,
+        n_cells_1d,
+        data.length_symmetric_domain / static_cast<double>(n_cells_1d));
+
+      velocity_full = std::make_shared<VectorType>();
+      initialize_dof_vector(*velocity_full, *dof_handler_full);
+
       int cells = tria_full->n_global_active_cells();
       cells     = static_cast<int>(std::round(std::pow(cells, 1.0 / dim)));
       deal_spectrum_wrapper->init(dim, cells, data.degree + 1, evaluation_points, *tria_full);
@@ -667,18 +700,7 @@ KineticEnergySpectrumCalculator<dim, Number>::evaluate(VectorType const & veloci
   {
     if(data.exploit_symmetry)
     {
-      unsigned int n_cells_1d =
-        data.n_cells_1d_coarse_grid * dealii::Utilities::pow(2, data.refine_level);
-
-      velocity_full = std::make_shared<VectorType>();
-      initialize_dof_vector(*velocity_full, *dof_handler_full);
-
-      apply_taylor_green_symmetry(*dof_handler,
-                                  *dof_handler_full,
-                                  n_cells_1d,
-                                  data.length_symmetric_domain / static_cast<double>(n_cells_1d),
-                                  velocity,
-                                  *velocity_full);
+      taylor_green_symmetry->apply(velocity, *velocity_full);
 
       do_evaluate(*velocity_full, time);
     }
@@ -33,9 +33,12 @@
 
 namespace ExaDG
 {
-// forward declaration
+// forward declarations
 class DealSpectrumWrapper;
 
+template<int dim>
+class TaylorGreenSymmetry;
+
 struct KineticEnergySpectrumData
 {
   KineticEnergySpectrumData()
@@ -144,6 +147,8 @@ private:
   std::shared_ptr<dealii::Triangulation<dim>> tria_full;
   std::shared_ptr<dealii::FESystem<dim>>      fe_full;
   std::shared_ptr<dealii::DoFHandler<dim>>    dof_handler_full;
+
+  std::shared_ptr<TaylorGreenSymmetry<dim>> taylor_green_symmetry;
 };
 } // namespace ExaDG
 
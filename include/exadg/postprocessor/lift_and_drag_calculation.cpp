@@ -37,7 +37,7 @@ calculate_lift_and_drag_force(dealii::Tensor<1, dim, Number> &             Force
                               unsigned int const                           dof_index_velocity,
                               unsigned int const                           quad_index_velocity,
                               unsigned int const                           dof_index_pressure,
-                              std::set<dealii::types::boundary_id> const & boundary_IDs,
+                              std::vector<unsigned int> const &            face_batches,
                               dealii::LinearAlgebra::distributed::Vector<Number> const & velocity,
                               dealii::LinearAlgebra::distributed::Vector<Number> const & pressure,
                               double const                                               viscosity,
@@ -55,9 +55,8 @@ calculate_lift_and_drag_force(dealii::Tensor<1, dim, Number> &             Force
   for(unsigned int d = 0; d < dim; ++d)
     Force[d] = 0.0;
 
-  for(unsigned int face = matrix_free.n_inner_face_batches();
-      face < (matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches());
-      face++)
+  // only the face batches on the boundaries of interest are visited
+  for(unsigned int const face : face_batches)
   {
     integrator_velocity.reinit(face);
     integrator_velocity.read_dof_values(velocity);
@@ -67,36 +66,30 @@ calculate_lift_and_drag_force(dealii::Tensor<1, dim, Number> &             Force
     integrator_pressure.read_dof_values(pressure);
     integrator_pressure.evaluate(dealii::EvaluationFlags::values);
 
-    dealii::types::boundary_id boundary_id = matrix_free.get_boundary_id(face);
-
-    typename std::set<dealii::types::boundary_id>::iterator it = boundary_IDs.find(boundary_id);
-    if(it != boundary_IDs.end())
+    for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
     {
-      for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
-      {
-        dealii::VectorizedArray<Number> pressure = integrator_pressure.get_value(q);
+      dealii::VectorizedArray<Number> pressure = integrator_pressure.get_value(q);
 
-        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal =
-          integrator_velocity.get_normal_vector(q);
-        dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> velocity_gradient =
-          integrator_velocity.get_gradient(q);
+      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal =
+        integrator_velocity.get_normal_vector(q);
+      dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> velocity_gradient =
+        integrator_velocity.get_gradient(q);
 
-        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> tau =
-          pressure * normal -
-          viscosity * (velocity_gradient + transpose(velocity_gradient)) * normal;
+      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> tau =
+        pressure * normal -
+        viscosity * (velocity_gradient + transpose(velocity_gradient)) * normal;
 
-        integrator_velocity.submit_value(tau, q);
-      }
+      integrator_velocity.submit_value(tau, q);
+    }
 
-      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> Force_local =
-        integrator_velocity.integrate_value();
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> Force_local =
+      integrator_velocity.integrate_value();
 
-      // sum over all entries of dealii::VectorizedArray
-      for(unsigned int d = 0; d < dim; ++d)
-      {
-        for(unsigned int n = 0; n < matrix_free.n_active_entries_per_face_batch(face); ++n)
-          Force[d] += Force_local[d][n];
-      }
+    // sum over all entries of dealii::VectorizedArray
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      for(unsigned int n = 0; n < matrix_free.n_active_entries_per_face_batch(face); ++n)
+        Force[d] += Force_local[d][n];
     }
   }
   Force = dealii::Utilities::MPI::sum(Force, mpi_comm);
@@ -156,6 +149,18 @@ LiftAndDragCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_ha
 
   time_control.setup(data_in.time_control_data);
 
+  // The boundary IDs are fixed during the simulation, so the face batches located on these
+  // boundaries are collected once instead of checking the boundary ID of every boundary face batch
+  // in each evaluation.
+  face_batches.clear();
+  for(unsigned int face = matrix_free->n_inner_face_batches();
+      face < (matrix_free->n_inner_face_batches() + matrix_free->n_boundary_face_batches());
+      face++)
+  {
+    if(data.boundary_IDs.find(matrix_free->get_boundary_id(face)) != data.boundary_IDs.end())
+      face_batches.push_back(face);
+  }
+
   if(data_in.boundary_IDs.size() > 0)
     create_directories(data.directory, mpi_comm);
 }
@@ -175,7 +180,7 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
                                                dof_index_velocity,
                                                quad_index,
                                                dof_index_pressure,
-                                               data.boundary_IDs,
+                                               face_batches,
                                                velocity,
                                                pressure,
                                                data.viscosity,
@@ -104,6 +104,9 @@ private:
   dealii::MatrixFree<dim, Number> const *             matrix_free;
   unsigned int dof_index_velocity, dof_index_pressure, quad_index;
 
+  // boundary face batches located on the boundaries with IDs contained in data.boundary_IDs
+  std::vector<unsigned int> face_batches;
+
   mutable double c_L_min, c_L_max, c_D_min, c_D_max;
 
   LiftAndDragData data;
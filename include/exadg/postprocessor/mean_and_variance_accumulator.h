@@ -0,0 +1,155 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_MEAN_AND_VARIANCE_ACCUMULATOR_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_MEAN_AND_VARIANCE_ACCUMULATOR_H_
+
+// C/C++
+#include <boost/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Incremental mean and variance of the entries of a DoF vector over a series of samples, using the
+ * update of Welford (1962)
+ *
+ *   n = n + 1,  delta = u - mean,  mean = mean + delta / n,  M2 = M2 + delta * (u - mean),
+ *
+ * with variance = M2 / n. In contrast to accumulating the sums of u and u^2, the update does not
+ * suffer from cancellation for small fluctuations around a large mean value. Both vectors are
+ * updated in one pass over the locally owned entries.
+ */
+template<typename Number>
+class MeanAndVarianceAccumulator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  MeanAndVarianceAccumulator() : n_samples(0)
+  {
+  }
+
+  void
+  reinit(VectorType const & model)
+  {
+    mean.reinit(model);
+    sum_of_squared_deviations.reinit(model);
+    n_samples = 0;
+  }
+
+  void
+  add_sample(VectorType const & sample)
+  {
+    ++n_samples;
+    Number const inverse_n_samples = 1.0 / static_cast<Number>(n_samples);
+
+    Number *       mean_ptr   = mean.begin();
+    Number *       m2_ptr     = sum_of_squared_deviations.begin();
+    Number const * sample_ptr = sample.begin();
+
+    unsigned int const size = mean.locally_owned_size();
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      Number const delta = sample_ptr[i] - mean_ptr[i];
+      mean_ptr[i] += inverse_n_samples * delta;
+      m2_ptr[i] += delta * (sample_ptr[i] - mean_ptr[i]);
+    }
+  }
+
+  VectorType const &
+  get_mean() const
+  {
+    return mean;
+  }
+
+  /*
+   * Root mean square of the fluctuations, i.e., the square root of the variance.
+   */
+  void
+  compute_rms(VectorType & rms) const
+  {
+    rms.reinit(mean, true /* omit_zeroing_entries */);
+
+    Number const inverse_n_samples = n_samples > 0 ? 1.0 / static_cast<Number>(n_samples) : 0.0;
+
+    Number const * m2_ptr  = sum_of_squared_deviations.begin();
+    Number *       rms_ptr = rms.begin();
+
+    unsigned int const size = mean.locally_owned_size();
+    for(unsigned int i = 0; i < size; ++i)
+      rms_ptr[i] = std::sqrt(std::max(m2_ptr[i] * inverse_n_samples, Number(0.0)));
+  }
+
+  unsigned int
+  get_n_samples() const
+  {
+    return n_samples;
+  }
+
+  /*
+   * Serialization of the locally owned data, e.g., to continue the averaging after a restart
+   * with the same mesh and partitioning.
+   */
+  template<typename Archive>
+  void
+  save(Archive & archive) const
+  {
+    std::vector<Number> const mean_local(mean.begin(), mean.end());
+    std::vector<Number> const m2_local(sum_of_squared_deviations.begin(),
+                                       sum_of_squared_deviations.end());
+
+    archive << n_samples << mean_local << m2_local;
+  }
+
+  template<typename Archive>
+  void
+  load(Archive & archive)
+  {
+    std::vector<Number> mean_local, m2_local;
+    archive >> n_samples >> mean_local >> m2_local;
+
+    AssertThrow(mean_local.size() == mean.locally_owned_size() and
+                  m2_local.size() == mean.locally_owned_size(),
+                dealii::ExcMessage("The time-averaged data has been computed on a different mesh "
+                                   "or with a different partitioning."));
+
+    std::copy(mean_local.begin(), mean_local.end(), mean.begin());
+    std::copy(m2_local.begin(), m2_local.end(), sum_of_squared_deviations.begin());
+  }
+
+private:
+  VectorType mean;
+  VectorType sum_of_squared_deviations;
+
+  unsigned int n_samples;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_MEAN_AND_VARIANCE_ACCUMULATOR_H_ */
@@ -22,11 +22,47 @@
 #ifndef INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_DATA_BASE_H_
 #define INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_DATA_BASE_H_
 
+// C/C++
+#include <memory>
+#include <set>
+
+// deal.II
+#include <deal.II/base/types.h>
+
+// ExaDG
+#include <exadg/postprocessor/in_situ_adaptor.h>
 #include <exadg/postprocessor/time_control.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
 {
+/*
+ * File format of the field output:
+ *
+ *  Vtu:    one vtu-file per MPI rank and output time and a pvtu-record
+ *  Hdf5:   one hdf5-file per output time written collectively by all MPI ranks and an xdmf-file
+ *          describing the time series (requires deal.II compiled with HDF5)
+ *  InSitu: no files are written, the output is only handed to the in-situ adaptor
+ */
+enum class OutputFormat
+{
+  Vtu,
+  Hdf5,
+  InSitu
+};
+
+/*
+ * Lossless zlib compression of the binary data in vtu-files, trading the size of the files
+ * against the time needed for compression.
+ */
+enum class OutputCompression
+{
+  None,
+  BestSpeed,
+  Default,
+  BestCompression
+};
+
 struct OutputDataBase
 {
   OutputDataBase()
@@ -37,7 +73,10 @@ struct OutputDataBase
       write_grid(false),
       write_processor_id(false),
       write_higher_order(true),
-      degree(1)
+      degree(1),
+      output_format(OutputFormat::Vtu),
+      compression(OutputCompression::BestSpeed),
+      write_asynchronously(false)
   {
   }
 
@@ -58,6 +97,22 @@ struct OutputDataBase
 
       print_parameter(pcout, "Write higher order", write_higher_order);
       print_parameter(pcout, "Polynomial degree", degree);
+
+      print_parameter(pcout, "Output format", output_format);
+      print_parameter(pcout, "In-situ adaptor", in_situ_adaptor.get() != nullptr);
+      if(output_format == OutputFormat::Vtu)
+      {
+        print_parameter(pcout, "Compression", compression);
+        print_parameter(pcout, "Write asynchronously", write_asynchronously);
+      }
+
+      if(not material_ids.empty())
+      {
+        std::string ids;
+        for(auto const & id : material_ids)
+          ids += dealii::Utilities::to_string(id) + " ";
+        print_parameter(pcout, "Output restricted to material IDs", ids);
+      }
     }
   }
 
@@ -94,6 +149,26 @@ struct OutputDataBase
   // case of write_higher_order = false, this variable defines the number of subdivisions of a cell,
   // with ParaView using linear interpolation for visualization on these subdivided cells.
   unsigned int degree;
+
+  // file format of the field output. The Hdf5 format does not support higher order cells, the cells
+  // are subdivided into degree^dim linear cells instead.
+  OutputFormat output_format;
+
+  // compression of the vtu-files. Note that the field data is written in single precision anyway.
+  OutputCompression compression;
+
+  // restrict the output to cells with one of these material IDs to reduce the amount of data, e.g.,
+  // to the region of interest of a simulation. All cells are written if the set is empty.
+  std::set<dealii::types::material_id> material_ids;
+
+  // write the vtu-files in a background thread while the time loop continues (the patches are
+  // still built synchronously). Each MPI rank writes its own file, as in the synchronous case. Only
+  // available for OutputFormat::Vtu.
+  bool write_asynchronously;
+
+  // in-situ visualization or analysis pipeline called at every output time, see InSituAdaptor.
+  // Files are written in addition unless output_format = OutputFormat::InSitu.
+  std::shared_ptr<InSituAdaptor> in_situ_adaptor;
 };
 
 } // namespace ExaDG
@@ -39,22 +39,26 @@ write_output(OutputDataBase const &          output_data,
              dealii::Mapping<dim> const &    mapping,
              VectorType const &              solution_vector,
              unsigned int const              output_counter,
-             MPI_Comm const &                mpi_comm)
+             double const                    time,
+             MPI_Comm const &                mpi_comm,
+             OutputWriter<dim> &             output_writer)
 {
   std::string folder = output_data.directory, file = output_data.filename;
 
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
+  flags.compression_level        = get_vtk_compression_level(output_data.compression);
 
-  dealii::DataOut<dim> data_out;
+  SnapshotDataOut<dim> data_out;
   data_out.set_flags(flags);
 
   data_out.attach_dof_handler(dof_handler);
 
   data_out.add_data_vector(solution_vector, "solution");
+  select_output_cells(data_out, output_data.material_ids);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  output_writer.write(data_out, folder, file, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -74,6 +78,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
 
   time_control.setup(output_data_in.time_control_data);
 
+  output_writer.setup(output_data_in);
+
   if(output_data_in.time_control_data.is_active)
   {
     create_directories(output_data.directory, mpi_comm);
@@ -121,8 +127,14 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & solution,
 {
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
-  write_output<dim>(
-    output_data, *dof_handler, *mapping, solution, time_control.get_counter(), mpi_comm);
+  write_output<dim>(output_data,
+                    *dof_handler,
+                    *mapping,
+                    solution,
+                    time_control.get_counter(),
+                    time,
+                    mpi_comm,
+                    output_writer);
 }
 
 template class OutputGenerator<2, float>;
@@ -0,0 +1,257 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_WRITER_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_WRITER_H_
+
+// C/C++
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/numerics/data_out.h>
+
+// ExaDG
+#include <exadg/postprocessor/in_situ_adaptor.h>
+#include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/write_output.h>
+
+namespace ExaDG
+{
+/*
+ * Self-contained copy of the patches built by a DataOut object. In contrast to the DataOut object,
+ * the copy does not reference the DoFHandler and the vectors, such that it can be written to file
+ * while the simulation continues to modify them.
+ */
+template<int dim>
+class PatchSnapshot : public dealii::DataOutInterface<dim, dim>
+{
+public:
+  typedef std::vector<std::tuple<unsigned int,
+                                 unsigned int,
+                                 std::string,
+                                 dealii::DataComponentInterpretation::DataComponentInterpretation>>
+    NonscalarDataRanges;
+
+  PatchSnapshot(std::vector<dealii::DataOutBase::Patch<dim, dim>> const & patches_in,
+                std::vector<std::string> const &                          dataset_names_in,
+                NonscalarDataRanges const &                               nonscalar_data_ranges_in)
+    : patches(patches_in),
+      dataset_names(dataset_names_in),
+      nonscalar_data_ranges(nonscalar_data_ranges_in)
+  {
+  }
+
+private:
+  std::vector<dealii::DataOutBase::Patch<dim, dim>> const &
+  get_patches() const final
+  {
+    return patches;
+  }
+
+  std::vector<std::string>
+  get_dataset_names() const final
+  {
+    return dataset_names;
+  }
+
+  NonscalarDataRanges
+  get_nonscalar_data_ranges() const final
+  {
+    return nonscalar_data_ranges;
+  }
+
+  std::vector<dealii::DataOutBase::Patch<dim, dim>> const patches;
+  std::vector<std::string> const                          dataset_names;
+  NonscalarDataRanges const                               nonscalar_data_ranges;
+};
+
+/*
+ * DataOut that allows to copy the built patches into a PatchSnapshot and gives access to the
+ * patches in-place, e.g., for an InSituAdaptor.
+ */
+template<int dim>
+class SnapshotDataOut : public dealii::DataOut<dim>
+{
+public:
+  using dealii::DataOut<dim>::get_patches;
+  using dealii::DataOut<dim>::get_dataset_names;
+  using dealii::DataOut<dim>::get_nonscalar_data_ranges;
+
+  void
+  set_flags(dealii::DataOutBase::VtkFlags const & flags)
+  {
+    vtk_flags = flags;
+    dealii::DataOut<dim>::set_flags(flags);
+  }
+
+  std::shared_ptr<PatchSnapshot<dim>>
+  create_snapshot() const
+  {
+    std::shared_ptr<PatchSnapshot<dim>> snapshot =
+      std::make_shared<PatchSnapshot<dim>>(this->get_patches(),
+                                           this->get_dataset_names(),
+                                           this->get_nonscalar_data_ranges());
+    snapshot->set_flags(vtk_flags);
+
+    return snapshot;
+  }
+
+private:
+  dealii::DataOutBase::VtkFlags vtk_flags;
+};
+
+/*
+ * Writes the output of a SnapshotDataOut object in the format selected by OutputDataBase.
+ *
+ * OutputFormat::Vtu follows DataOut::write_vtu_with_pvtu_record(), i.e., one vtu-file per MPI rank
+ * and a pvtu-record written by rank 0. In asynchronous mode, the patches are copied and written to
+ * file by a background thread, while the time loop continues. Building the patches remains
+ * synchronous since it evaluates the solution vectors and the mapping, which change in the next
+ * time step. Writing the files does not involve MPI communication, such that the background thread
+ * does not require a thread-safe MPI library. To bound the memory consumption, only one output is
+ * in flight at a time, i.e., the next call of write() and the destructor wait for the pending
+ * output to complete.
+ *
+ * OutputFormat::Hdf5 writes a single file per output time with collective MPI-IO, which is always
+ * done synchronously.
+ *
+ * If an InSituAdaptor is given, it is called first with the built patches, and
+ * OutputFormat::InSitu writes no files at all.
+ */
+template<int dim>
+class OutputWriter
+{
+public:
+  OutputWriter() : format(OutputFormat::Vtu), asynchronous(false)
+  {
+  }
+
+  ~OutputWriter()
+  {
+    wait();
+  }
+
+  void
+  setup(OutputDataBase const & output_data)
+  {
+    format          = output_data.output_format;
+    asynchronous    = output_data.write_asynchronously;
+    in_situ_adaptor = output_data.in_situ_adaptor;
+
+    AssertThrow(not(asynchronous and format == OutputFormat::Hdf5),
+                dealii::ExcMessage("Asynchronous output is only available for OutputFormat::Vtu."));
+
+    AssertThrow(format != OutputFormat::InSitu or in_situ_adaptor.get() != nullptr,
+                dealii::ExcMessage("OutputFormat::InSitu requires an in-situ adaptor."));
+
+    xdmf_entries.clear();
+  }
+
+  void
+  write(SnapshotDataOut<dim> const & data_out,
+        std::string const &          directory,
+        std::string const &          filename,
+        unsigned int const           counter,
+        double const                 time,
+        MPI_Comm const &             mpi_comm)
+  {
+    if(in_situ_adaptor.get() != nullptr)
+      in_situ_adaptor->execute(data_out, time, counter);
+
+    if(format == OutputFormat::InSitu)
+      return;
+
+    if(format == OutputFormat::Hdf5)
+    {
+      write_xdmf_hdf5(data_out, directory, filename, counter, time, xdmf_entries, mpi_comm);
+      return;
+    }
+
+    if(not asynchronous)
+    {
+      data_out.write_vtu_with_pvtu_record(directory, filename, counter, mpi_comm, 4);
+      return;
+    }
+
+    wait();
+
+    unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+    unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    // same file names as DataOut::write_vtu_with_pvtu_record()
+    std::string const  basename = filename + "_" + dealii::Utilities::int_to_string(counter, 4);
+    unsigned int const n_digits = dealii::Utilities::needed_digits(n_ranks - 1);
+
+    std::shared_ptr<PatchSnapshot<dim>> snapshot = data_out.create_snapshot();
+
+    if(rank == 0)
+    {
+      std::vector<std::string> piece_names;
+      for(unsigned int i = 0; i < n_ranks; ++i)
+        piece_names.push_back(basename + "." + dealii::Utilities::int_to_string(i, n_digits) +
+                              ".vtu");
+
+      std::ofstream output(directory + basename + ".pvtu");
+      snapshot->write_pvtu_record(output, piece_names);
+    }
+
+    std::string const file =
+      directory + basename + "." + dealii::Utilities::int_to_string(rank, n_digits) + ".vtu";
+
+    pending_output = std::async(std::launch::async, [snapshot, file]() {
+      std::ofstream output(file);
+      snapshot->write_vtu(output);
+    });
+  }
+
+  /*
+   * Blocks until the pending output, if any, has been written.
+   */
+  void
+  wait()
+  {
+    if(pending_output.valid())
+      pending_output.get();
+  }
+
+private:
+  OutputFormat format;
+
+  bool asynchronous;
+
+  std::shared_ptr<InSituAdaptor> in_situ_adaptor;
+
+  std::future<void> pending_output;
+
+  // time series of the xdmf-file
+  std::vector<dealii::XDMFEntry> xdmf_entries;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_WRITER_H_ */
@@ -0,0 +1,256 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// deal.II
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/grid/filtered_iterator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/particles/data_out.h>
+#include <deal.II/particles/generators.h>
+
+// ExaDG
+#include <exadg/postprocessor/particle_tracking.h>
+#include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+template<int dim>
+void
+ParticleTrackingData<dim>::print(dealii::ConditionalOStream & pcout, bool const unsteady) const
+{
+  if(time_control_data.is_active)
+  {
+    pcout << std::endl << "Particle tracking" << std::endl;
+    time_control_data.print(pcout, unsteady);
+
+    print_parameter(pcout, "Number of initial positions", initial_positions.size());
+    print_parameter(pcout, "Particles per cell and direction", n_particles_per_cell_direction);
+    print_parameter(pcout, "Weight per particle", weight_per_particle);
+
+    print_parameter(pcout, "Directory", directory);
+    print_parameter(pcout, "Filename", filename);
+  }
+}
+
+template<int dim, typename Number>
+ParticleTracker<dim, Number>::ParticleTracker(MPI_Comm const & comm)
+  : mpi_comm(comm), time_last(0.0), first_evaluation(true)
+{
+}
+
+template<int dim, typename Number>
+ParticleTracker<dim, Number>::~ParticleTracker()
+{
+  connection_weight.disconnect();
+}
+
+template<int dim, typename Number>
+void
+ParticleTracker<dim, Number>::setup(dealii::DoFHandler<dim> const &   dof_handler_velocity_in,
+                                    dealii::Mapping<dim> const &      mapping_in,
+                                    ParticleTrackingData<dim> const & data_in)
+{
+  dof_handler_velocity = &dof_handler_velocity_in;
+  mapping              = &mapping_in;
+  data                 = data_in;
+
+  time_control.setup(data.time_control_data);
+
+  if(not(data.time_control_data.is_active))
+    return;
+
+  create_directories(data.directory, mpi_comm);
+
+  dealii::Triangulation<dim> const & tria = dof_handler_velocity->get_triangulation();
+
+  particle_handler = std::make_shared<dealii::Particles::ParticleHandler<dim>>(tria, *mapping);
+
+  // particles at regular positions in reference coordinates of each cell
+  if(data.n_particles_per_cell_direction > 0)
+  {
+    dealii::QIterated<dim> const quadrature(dealii::QMidpoint<1>(),
+                                            data.n_particles_per_cell_direction);
+
+    dealii::Particles::Generators::regular_reference_locations(tria,
+                                                               quadrature.get_points(),
+                                                               *particle_handler,
+                                                               *mapping);
+  }
+
+  // particles at given positions, which are sent from the first process to the owners of the
+  // cells containing them
+  if(data.initial_positions.size() > 0)
+  {
+    std::vector<dealii::BoundingBox<dim>> const local_boxes =
+      dealii::GridTools::compute_mesh_predicate_bounding_box(
+        tria, dealii::IteratorFilters::LocallyOwnedCell());
+
+    std::vector<std::vector<dealii::BoundingBox<dim>>> const global_boxes =
+      dealii::Utilities::MPI::all_gather(mpi_comm, local_boxes);
+
+    std::vector<dealii::Point<dim>> positions;
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      positions = data.initial_positions;
+
+    particle_handler->insert_global_particles(positions, global_boxes);
+  }
+
+  // the cell weights are used whenever the triangulation is repartitioned, while the particles are
+  // transferred to the new owners by the ParticleHandler
+  if(data.weight_per_particle > 0)
+  {
+    connection_weight = tria.signals.weight.connect(
+      [this](typename dealii::Triangulation<dim>::cell_iterator const & cell, auto const status) {
+        (void)status;
+        return get_cell_weight(cell);
+      });
+  }
+}
+
+template<int dim, typename Number>
+void
+ParticleTracker<dim, Number>::evaluate(VectorType const & velocity, double const time)
+{
+  if(not(first_evaluation) and time > time_last)
+    move_particles(velocity, time - time_last);
+
+  time_last        = time;
+  first_evaluation = false;
+}
+
+template<int dim, typename Number>
+void
+ParticleTracker<dim, Number>::move_particles(VectorType const & velocity,
+                                             double const       time_step_size)
+{
+  // a continuous velocity needs the values of ghost DoFs
+  bool const has_ghost_elements = velocity.has_ghost_elements();
+  if(not(has_ghost_elements))
+    velocity.update_ghost_values();
+
+  dealii::FiniteElement<dim> const & fe = dof_handler_velocity->get_fe();
+
+  dealii::FEPointEvaluation<dim, dim, dim, Number> evaluator(*mapping, fe, dealii::update_values);
+
+  dealii::Vector<Number>          dof_values(fe.n_dofs_per_cell());
+  std::vector<dealii::Point<dim>> reference_locations;
+
+  // pass through the particles cell by cell in the order they are stored
+  auto particle = particle_handler->begin();
+  while(particle != particle_handler->end())
+  {
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    auto const cell = particle->get_surrounding_cell();
+#else
+    auto const cell = particle->get_surrounding_cell(dof_handler_velocity->get_triangulation());
+#endif
+
+    typename dealii::DoFHandler<dim>::active_cell_iterator const cell_dof(*cell,
+                                                                          dof_handler_velocity);
+    cell_dof->get_dof_values(velocity, dof_values);
+
+    auto const particles_in_cell = particle_handler->particles_in_cell(cell);
+
+    reference_locations.clear();
+    for(auto const & p : particles_in_cell)
+      reference_locations.push_back(p.get_reference_location());
+
+    evaluator.reinit(cell, reference_locations);
+    evaluator.evaluate(dealii::make_array_view(dof_values), dealii::EvaluationFlags::values);
+
+    unsigned int q = 0;
+    for(auto & p : particles_in_cell)
+    {
+      dealii::Tensor<1, dim, Number> const u = evaluator.get_value(q++);
+
+      dealii::Point<dim> location = p.get_location();
+      for(unsigned int d = 0; d < dim; ++d)
+        location[d] += time_step_size * u[d];
+      p.set_location(location);
+    }
+
+    particle = particles_in_cell.end();
+  }
+
+  if(not(has_ghost_elements))
+    velocity.zero_out_ghost_values();
+
+  // find the new cells and owners of the particles and remove the particles leaving the domain
+  particle_handler->sort_particles_into_subdomains_and_cells();
+}
+
+template<int dim, typename Number>
+void
+ParticleTracker<dim, Number>::write_output() const
+{
+  dealii::Particles::DataOut<dim> data_out;
+  data_out.build_patches(*particle_handler);
+  data_out.write_vtu_with_pvtu_record(
+    data.directory, data.filename, time_control.get_counter(), mpi_comm, 4);
+}
+
+template<int dim, typename Number>
+dealii::types::particle_index
+ParticleTracker<dim, Number>::get_n_global_particles() const
+{
+  if(particle_handler.get() == nullptr)
+    return 0;
+
+  return particle_handler->n_global_particles();
+}
+
+template<int dim, typename Number>
+unsigned int
+ParticleTracker<dim, Number>::get_cell_weight(
+  typename dealii::Triangulation<dim>::cell_iterator const & cell) const
+{
+  // in case of coarsening, the children are active and carry the particles
+  unsigned int n_particles = 0;
+  if(cell->is_active())
+  {
+    if(cell->is_locally_owned())
+      n_particles = particle_handler->n_particles_in_cell(cell);
+  }
+  else
+  {
+    for(unsigned int c = 0; c < cell->n_children(); ++c)
+      if(cell->child(c)->is_active() and cell->child(c)->is_locally_owned())
+        n_particles += particle_handler->n_particles_in_cell(cell->child(c));
+  }
+
+  return n_particles * data.weight_per_particle;
+}
+
+template struct ParticleTrackingData<2>;
+template struct ParticleTrackingData<3>;
+
+template class ParticleTracker<2, float>;
+template class ParticleTracker<2, double>;
+
+template class ParticleTracker<3, float>;
+template class ParticleTracker<3, double>;
+
+} // namespace ExaDG
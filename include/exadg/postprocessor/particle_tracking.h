@@ -0,0 +1,145 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_PARTICLE_TRACKING_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_PARTICLE_TRACKING_H_
+
+// C/C++
+#include <memory>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/particles/particle_handler.h>
+
+// ExaDG
+#include <exadg/postprocessor/time_control.h>
+
+namespace ExaDG
+{
+template<int dim>
+struct ParticleTrackingData
+{
+  ParticleTrackingData()
+    : n_particles_per_cell_direction(0),
+      weight_per_particle(0),
+      directory("output/"),
+      filename("particles")
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout, bool const unsteady) const;
+
+  /*
+   * Particles are tracked if is_active is true, while the time control determines the output of
+   * the particles.
+   */
+  TimeControlData time_control_data;
+
+  /*
+   * Initial positions of the particles: the particles at the given points are inserted by the
+   * processes owning the cells containing them. In addition, n^dim particles are placed in each
+   * cell at regular positions in reference coordinates for n = n_particles_per_cell_direction > 0.
+   */
+  std::vector<dealii::Point<dim>> initial_positions;
+  unsigned int                    n_particles_per_cell_direction;
+
+  /*
+   * Weight of a particle which is added to the weight of the cell containing it when the
+   * triangulation is repartitioned, balancing the work of the particle tracking. Not used if 0.
+   */
+  unsigned int weight_per_particle;
+
+  /*
+   *  directory and filename
+   */
+  std::string directory;
+  std::string filename;
+};
+
+/*
+ * Tracks massless particles in the velocity field, i.e., the particles follow dx/dt = u(x, t),
+ * which is integrated by the explicit Euler method from one call of evaluate() to the next with
+ * the velocity evaluated at the particle positions. The particles are stored by the
+ * ParticleHandler of deal.II, which keeps the particles of a cell together. The velocity is
+ * therefore evaluated for all particles of a cell at once with FEPointEvaluation, passing through
+ * the particles in the order they are stored. Particles leaving the domain are removed.
+ */
+template<int dim, typename Number>
+class ParticleTracker
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  ParticleTracker(MPI_Comm const & comm);
+
+  ~ParticleTracker();
+
+  void
+  setup(dealii::DoFHandler<dim> const &   dof_handler_velocity_in,
+        dealii::Mapping<dim> const &      mapping_in,
+        ParticleTrackingData<dim> const & data_in);
+
+  /*
+   * Moves the particles from the time of the previous call to the given time.
+   */
+  void
+  evaluate(VectorType const & velocity, double const time);
+
+  void
+  write_output() const;
+
+  dealii::types::particle_index
+  get_n_global_particles() const;
+
+  TimeControl time_control;
+
+private:
+  void
+  move_particles(VectorType const & velocity, double const time_step_size);
+
+  unsigned int
+  get_cell_weight(typename dealii::Triangulation<dim>::cell_iterator const & cell) const;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
+  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  ParticleTrackingData<dim> data;
+
+  std::shared_ptr<dealii::Particles::ParticleHandler<dim>> particle_handler;
+
+  // time of the previous call of evaluate()
+  double time_last;
+  bool   first_evaluation;
+
+  boost::signals2::connection connection_weight;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_PARTICLE_TRACKING_H_ */
@@ -76,7 +76,7 @@ PointwiseOutputGeneratorBase<dim, Number>::do_evaluate(std::function<void()> con
                     "Only implemented in the case that the simulation is not restarted"));
     }
 
-    if(pointwise_output_data.update_points_before_evaluation)
+    if(pointwise_output_data.update_points_before_evaluation or triangulation_has_changed)
       reinit_remote_evaluator();
 
     write_time(time);
@@ -87,10 +87,19 @@ PointwiseOutputGeneratorBase<dim, Number>::do_evaluate(std::function<void()> con
 
 template<int dim, typename Number>
 PointwiseOutputGeneratorBase<dim, Number>::PointwiseOutputGeneratorBase(MPI_Comm const & comm)
-  : mpi_comm(comm), n_out_samples(dealii::numbers::invalid_unsigned_int), first_evaluation(true)
+  : mpi_comm(comm),
+    n_out_samples(dealii::numbers::invalid_unsigned_int),
+    first_evaluation(true),
+    triangulation_has_changed(false)
 {
 }
 
+template<int dim, typename Number>
+PointwiseOutputGeneratorBase<dim, Number>::~PointwiseOutputGeneratorBase()
+{
+  triangulation_signal.disconnect();
+}
+
 template<int dim, typename Number>
 void
 PointwiseOutputGeneratorBase<dim, Number>::setup_base(
@@ -179,6 +188,9 @@ PointwiseOutputGeneratorBase<dim, Number>::setup_remote_evaluator()
   remote_evaluator =
     std::make_shared<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(1e-6, false, 0);
   reinit_remote_evaluator();
+
+  triangulation_signal =
+    triangulation->signals.any_change.connect([&]() { triangulation_has_changed = true; });
 }
 
 template<int dim, typename Number>
@@ -188,6 +200,8 @@ PointwiseOutputGeneratorBase<dim, Number>::reinit_remote_evaluator()
   remote_evaluator->reinit(pointwise_output_data.evaluation_points, *triangulation, *mapping);
   AssertThrow(remote_evaluator->all_points_found(),
               dealii::ExcMessage("Not all remote points found."));
+
+  triangulation_has_changed = false;
 }
 
 template<int dim, typename Number>
@@ -36,6 +36,8 @@
 
 #include <deal.II/fe/mapping.h>
 
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
@@ -79,7 +81,7 @@ protected:
 
   PointwiseOutputGeneratorBase(MPI_Comm const & comm);
 
-  virtual ~PointwiseOutputGeneratorBase() = default;
+  virtual ~PointwiseOutputGeneratorBase();
 
   void
   setup_base(dealii::Triangulation<dim> const &   triangulation_in,
@@ -120,7 +122,115 @@ protected:
                                                            solution);
   }
 
+  /*
+   * Evaluates two fields, possibly defined on different DoFHandlers, in a single communication
+   * round of the remote evaluator instead of one round per field.
+   */
+  template<int n_components_1, int n_components_2>
+  void
+  compute_point_values(
+    std::vector<typename dealii::FEPointEvaluation<n_components_1, dim, dim, Number>::value_type> &
+      values_1,
+    std::vector<typename dealii::FEPointEvaluation<n_components_2, dim, dim, Number>::value_type> &
+                                                               values_2,
+    dealii::LinearAlgebra::distributed::Vector<Number> const & solution_1,
+    dealii::DoFHandler<dim> const &                            dof_handler_1,
+    dealii::LinearAlgebra::distributed::Vector<Number> const & solution_2,
+    dealii::DoFHandler<dim> const &                            dof_handler_2) const
+  {
+    typedef dealii::Tensor<1, n_components_1 + n_components_2, Number> CombinedValueType;
+
+    bool const has_ghost_elements_1 = solution_1.has_ghost_elements();
+    bool const has_ghost_elements_2 = solution_2.has_ghost_elements();
+    if(not has_ghost_elements_1)
+      solution_1.update_ghost_values();
+    if(not has_ghost_elements_2)
+      solution_2.update_ghost_values();
+
+    auto const evaluation_function =
+      [&](dealii::ArrayView<CombinedValueType> const &                                values,
+          typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::CellData const & cell_data) {
+        dealii::FEPointEvaluation<n_components_1, dim, dim, Number> evaluator_1(
+          *mapping, dof_handler_1.get_fe(), dealii::update_values);
+        dealii::FEPointEvaluation<n_components_2, dim, dim, Number> evaluator_2(
+          *mapping, dof_handler_2.get_fe(), dealii::update_values);
+
+        std::vector<Number> dof_values_1(dof_handler_1.get_fe().dofs_per_cell);
+        std::vector<Number> dof_values_2(dof_handler_2.get_fe().dofs_per_cell);
+
+        for(unsigned int i = 0; i < cell_data.cells.size(); ++i)
+        {
+          typename dealii::Triangulation<dim>::active_cell_iterator const cell(
+            triangulation, cell_data.cells[i].first, cell_data.cells[i].second);
+
+          dealii::ArrayView<dealii::Point<dim> const> const unit_points(
+            cell_data.reference_point_values.data() + cell_data.reference_point_ptrs[i],
+            cell_data.reference_point_ptrs[i + 1] - cell_data.reference_point_ptrs[i]);
+
+          typename dealii::DoFHandler<dim>::active_cell_iterator const cell_1(
+            triangulation, cell->level(), cell->index(), &dof_handler_1);
+          cell_1->get_dof_values(solution_1, dof_values_1.begin(), dof_values_1.end());
+          evaluator_1.reinit(cell, unit_points);
+          evaluator_1.evaluate(dof_values_1, dealii::EvaluationFlags::values);
+
+          typename dealii::DoFHandler<dim>::active_cell_iterator const cell_2(
+            triangulation, cell->level(), cell->index(), &dof_handler_2);
+          cell_2->get_dof_values(solution_2, dof_values_2.begin(), dof_values_2.end());
+          evaluator_2.reinit(cell, unit_points);
+          evaluator_2.evaluate(dof_values_2, dealii::EvaluationFlags::values);
+
+          for(unsigned int q = 0; q < unit_points.size(); ++q)
+          {
+            CombinedValueType & value = values[cell_data.reference_point_ptrs[i] + q];
+            set_components<n_components_1>(value, 0, evaluator_1.get_value(q));
+            set_components<n_components_2>(value, n_components_1, evaluator_2.get_value(q));
+          }
+        }
+      };
+
+    std::vector<CombinedValueType> combined_values;
+    std::vector<CombinedValueType> buffer;
+    remote_evaluator->template evaluate_and_process<CombinedValueType>(combined_values,
+                                                                       buffer,
+                                                                       evaluation_function);
+
+    if(not has_ghost_elements_1)
+      solution_1.zero_out_ghost_values();
+    if(not has_ghost_elements_2)
+      solution_2.zero_out_ghost_values();
+
+    values_1.resize(combined_values.size());
+    values_2.resize(combined_values.size());
+    for(unsigned int p = 0; p < combined_values.size(); ++p)
+    {
+      get_components<n_components_1>(values_1[p], combined_values[p], 0);
+      get_components<n_components_2>(values_2[p], combined_values[p], n_components_1);
+    }
+  }
+
 private:
+  template<int n_components, typename CombinedValueType, typename ValueType>
+  static void
+  set_components(CombinedValueType & dst, unsigned int const offset, ValueType const & src)
+  {
+    if constexpr(n_components == 1)
+      dst[offset] = src;
+    else
+      for(unsigned int c = 0; c < n_components; ++c)
+        dst[offset + c] = src[c];
+  }
+
+  template<int n_components, typename ValueType, typename CombinedValueType>
+  static void
+  get_components(ValueType & dst, CombinedValueType const & src, unsigned int const offset)
+  {
+    if constexpr(n_components == 1)
+      dst = src[offset];
+    else
+      for(unsigned int c = 0; c < n_components; ++c)
+        dst[c] = src[offset + c];
+  }
+
   void
   setup_remote_evaluator();
 
@@ -175,6 +285,11 @@ private:
   std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>> remote_evaluator;
   bool                                                                first_evaluation;
 
+  // the remote evaluator, i.e., the map of points to cells, is only reinitialized once the
+  // triangulation has changed or if the points move with the mesh
+  bool                        triangulation_has_changed;
+  boost::signals2::connection triangulation_signal;
+
   std::map<std::string, unsigned int> name_to_components;
 
 #ifdef DEAL_II_WITH_HDF5
@@ -25,6 +25,8 @@
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <exadg/utilities/memory_report.h>
+
 namespace ExaDG
 {
 enum class SolutionFieldType
@@ -46,6 +48,7 @@ public:
       type(SolutionFieldType::scalar),
       name("solution"),
       dof_handler(nullptr),
+      is_initialized(false),
       is_available(false)
   {
   }
@@ -58,6 +61,9 @@ public:
   reinit()
   {
     initialize_vector(solution_vector);
+    is_initialized = true;
+
+    memory.set(solution_vector.memory_consumption());
   }
 
   /**
@@ -69,11 +75,19 @@ public:
     is_available = false;
   }
 
+  /**
+   * This function computes the solution field unless it is still available. If reinit() has not
+   * been called before, the DoF vector is initialized here, i.e., the memory is only allocated
+   * for fields that are actually evaluated.
+   */
   void
   evaluate(VectorType const & src)
   {
     if(not is_available)
     {
+      if(not is_initialized)
+        reinit();
+
       recompute_solution_field(solution_vector, src);
       is_available = true;
     }
@@ -88,6 +102,35 @@ public:
     return solution_vector;
   }
 
+  /**
+   * These functions allow to compute the solution field outside of this class, e.g., jointly with
+   * other fields in a fused kernel: get_for_update() provides write access to the DoF vector, and
+   * set_available() has to be called once the DoF vector has been filled.
+   */
+  VectorType &
+  get_for_update()
+  {
+    if(not is_initialized)
+      reinit();
+
+    return solution_vector;
+  }
+
+  void
+  set_available()
+  {
+    AssertThrow(is_initialized,
+                dealii::ExcMessage("You are trying to validate a Vector that is not initialized."));
+
+    is_available = true;
+  }
+
+  bool
+  available() const
+  {
+    return is_available;
+  }
+
   VectorType const &
   evaluate_get(VectorType const & src)
   {
@@ -126,8 +169,12 @@ public:
   dealii::DoFHandler<dim> const * dof_handler;
 
 private:
+  bool       is_initialized;
   bool       is_available;
   VectorType solution_vector;
+
+  // memory of the DoF vector, see MemoryReport
+  MemoryReport::Entry memory{MemoryCategory::Postprocessing};
 };
 
 } // namespace ExaDG
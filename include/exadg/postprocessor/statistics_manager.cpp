@@ -20,6 +20,10 @@
  */
 
 // C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
+
 #include <fstream>
 
 // deal.II
@@ -292,7 +296,12 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
 
     AssertThrow(y_glob.size() == n_points_y_glob, dealii::ExcInternalError());
 
+    initialize_sampling_data();
+
     create_directories(data.directory, mpi_comm);
+
+    if(data.merge_previous_statistics)
+      read_state(data.directory + data.filename);
   }
 }
 
@@ -312,6 +321,7 @@ StatisticsManager<dim, Number>::write_output()
 {
   std::string filename = data.directory + data.filename;
   this->do_write_output(filename, data.viscosity, data.density);
+  this->write_state(filename);
 }
 
 template<int dim, typename Number>
@@ -368,29 +378,19 @@ StatisticsManager<dim, Number>::evaluate_statistics(std::vector<VectorType> cons
  */
 template<int dim, typename Number>
 void
-StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *> & velocity)
+StatisticsManager<dim, Number>::initialize_sampling_data()
 {
-  // Use local vectors xxx_loc in order to average/integrate over all
-  // locally owned cells of current processor.
-  std::vector<double> area_loc(vel_glob[0].size());
-
-  std::vector<std::vector<double>> vel_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    vel_loc[i].resize(vel_glob[0].size());
-
-  std::vector<std::vector<double>> velsq_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    velsq_loc[i].resize(vel_glob[0].size());
-
-  std::vector<double> veluv_loc(vel_glob[0].size());
-
   // use 2d quadrature to integrate over x-z-planes
   unsigned int const      fe_degree = dof_handler.get_fe().degree;
   dealii::QGauss<dim - 1> gauss_2d(fe_degree + 1);
 
+  dealii::FiniteElement<dim> const & fe_scalar = dof_handler.get_fe().base_element(0);
+
   // vector of dealii::FEValues for all x-z-planes of a cell
   std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
 
+  plane_shape_values.resize(n_points_y_per_cell);
+
   for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
   {
     std::vector<dealii::Point<dim>> points(gauss_2d.size());
@@ -405,59 +405,38 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
     }
 
     fe_values[i].reset(new dealii::FEValues<dim>(mapping,
-                                                 dof_handler.get_fe().base_element(0),
+                                                 fe_scalar,
                                                  dealii::Quadrature<dim>(points, weights),
-                                                 dealii::update_values | dealii::update_jacobians |
+                                                 dealii::update_jacobians |
                                                    dealii::update_quadrature_points));
+
+    // the shape values do not depend on the mapping
+    plane_shape_values[i].resize(points.size(), std::vector<double>(fe_scalar.dofs_per_cell));
+    for(unsigned int q = 0; q < points.size(); ++q)
+      for(unsigned int j = 0; j < fe_scalar.dofs_per_cell; ++j)
+        plane_shape_values[i][q][j] = fe_scalar.shape_value(j, points[q]);
   }
 
-  unsigned int const scalar_dofs_per_cell = dof_handler.get_fe().base_element(0).dofs_per_cell;
-  std::vector<dealii::Tensor<1, dim>>          velocity_vector(scalar_dofs_per_cell);
-  std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
+  plane_indices.clear();
+  area_elements.clear();
+
+  std::vector<double> area_loc(y_glob.size(), 0.0);
 
-  // loop over all cells and perform averaging/integration for all locally owned cells
   for(auto const & cell : dof_handler.active_cell_iterators())
   {
     if(cell->is_locally_owned())
     {
-      cell->get_dof_indices(dof_indices);
-
-      // vector-valued FE where all components are explicitly listed in the dealii::DoFHandler
-      if(dof_handler.get_fe().element_multiplicity(0) >= dim)
-      {
-        for(unsigned int j = 0; j < dof_indices.size(); ++j)
-        {
-          const std::pair<unsigned int, unsigned int> comp =
-            dof_handler.get_fe().system_to_component_index(j);
-          if(comp.first < dim)
-            velocity_vector[comp.second][comp.first] = (*velocity[0])(dof_indices[j]);
-        }
-      }
-      else // scalar FE where we have several vectors referring to the same dealii::DoFHandler
-      {
-        AssertDimension(dof_handler.get_fe().element_multiplicity(0), 1);
-        for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
-          for(unsigned int d = 0; d < dim; ++d)
-            velocity_vector[j][d] = (*velocity[d])(dof_indices[j]);
-      }
+      std::vector<unsigned int>        indices(n_points_y_per_cell);
+      std::vector<std::vector<double>> areas(n_points_y_per_cell);
 
       // loop over all x-z-planes of current cell
       for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
       {
         fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
 
-        std::vector<double> vel(dim, 0.);
-        std::vector<double> velsq(dim, 0.);
-        double              area = 0, veluv = 0;
-
-        // perform integral over current x-z-plane of current cell
+        areas[i].resize(fe_values[i]->n_quadrature_points);
         for(unsigned int q = 0; q < fe_values[i]->n_quadrature_points; ++q)
         {
-          // interpolate velocity to the quadrature point
-          dealii::Tensor<1, dim> velocity;
-          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-            velocity += fe_values[i]->shape_value(j, q) * velocity_vector[j];
-
           double det = 0.;
           if(dim == 3)
           {
@@ -473,16 +452,7 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
             det = std::abs(fe_values[i]->jacobian(q)[0][0]);
           }
 
-          double area_ele = det * fe_values[i]->get_quadrature().weight(q);
-          area += area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            vel[i] += velocity[i] * area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            velsq[i] += velocity[i] * velocity[i] * area_ele;
-
-          veluv += velocity[0] * velocity[1] * area_ele;
+          areas[i][q] = det * fe_values[i]->get_quadrature().weight(q);
         }
 
         // Tranform cell index 'i' to global index 'idx' of y_glob-vector
@@ -512,50 +482,196 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
                                        std::to_string(std::abs(y_glob[idx] - y)) +
                                        ". Check transform() function given to constructor."));
 
-        // Add results of cellwise integral to xxx_loc vectors since we want
-        // to average/integrate over all locally owned cells.
-        for(unsigned int i = 0; i < dim; i++)
-          vel_loc[i].at(idx) += vel[i];
-
-        for(unsigned int i = 0; i < dim; i++)
-          velsq_loc[i].at(idx) += velsq[i];
+        indices[i] = idx;
 
-        veluv_loc.at(idx) += veluv;
-        area_loc.at(idx) += area;
+        for(auto const & area_ele : areas[i])
+          area_loc[idx] += area_ele;
       }
+
+      plane_indices.push_back(indices);
+      area_elements.push_back(areas);
     }
   }
 
-  // accumulate data over all processors overwriting
-  // the processor-local data in xxx_loc since we want
-  // to average/integrate over the global x-z-plane.
-  for(unsigned int i = 0; i < dim; i++)
-    dealii::Utilities::MPI::sum(vel_loc[i], mpi_comm, vel_loc[i]);
+  // the area of the global x-z-planes is needed to average over the homogeneous directions
+  area_glob.resize(y_glob.size());
+  dealii::Utilities::MPI::sum(area_loc, mpi_comm, area_glob);
+}
 
-  for(unsigned int i = 0; i < dim; i++)
-    dealii::Utilities::MPI::sum(velsq_loc[i], mpi_comm, velsq_loc[i]);
+/*
+ *  This function calculates the following statistical quantities of the flow ...
+ *
+ *   - Mean velocity:  <u>
+ *   - rms values of velocity: sqrt(<u'²>)
+ *   - and Reynolds shear stress: <u'v'>
+ *
+ *  Averaging is performed by ...
+ *
+ *   - averaging over homogeneous directions (=averaging over x-z-planes)
+ *   - and subsequently averaging the x-z-plane-averaged quantities over time samples
+ *
+ *  Therefore, we have to compute the following quantities: <u>, <u²>, <u*v>, since ...
+ *
+ *   - <u'²> = <(u-<u>)²> = <u² - 2*u<u> + <u>²> = <u²> - 2*<u>² + <u>² = <u²> - <u>²
+ *   - <u'v'> = <(u-<u>)*(v-<v>)> = <u*v> - <u*<v>> - <<u>*v> + <u><v> = <u*v> - <u><v>
+ *            = <u*v> since <v> = 0
+ *
+ *  The geometry of the x-z-planes has been evaluated in initialize_sampling_data(), such that all
+ *  moments are accumulated in a single loop over the cells and summed up over all processors with
+ *  a single reduction.
+ */
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *> & velocity)
+{
+  unsigned int const n_points_y_glob = y_glob.size();
 
-  dealii::Utilities::MPI::sum(veluv_loc, mpi_comm, veluv_loc);
-  dealii::Utilities::MPI::sum(area_loc, mpi_comm, area_loc);
+  // Integrals of u_i, u_i², and u*v over the locally owned parts of the x-z-planes, stored
+  // contiguously in this order for all y-coordinates.
+  std::vector<double> moments_loc((2 * dim + 1) * n_points_y_glob, 0.0);
+
+  unsigned int const scalar_dofs_per_cell = dof_handler.get_fe().base_element(0).dofs_per_cell;
+  std::vector<dealii::Tensor<1, dim>>          velocity_vector(scalar_dofs_per_cell);
+  std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
 
-  // Add values averaged over global x-z-planes
-  // (=MPI::sum(xxx_loc)/MPI::sum(area_loc)) to xxx_glob vectors.
+  // loop over all cells and perform averaging/integration for all locally owned cells
+  unsigned int cell_index = 0;
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      AssertThrow(cell_index < plane_indices.size(),
+                  dealii::ExcMessage("The mesh has changed since the setup of the statistics."));
+
+      cell->get_dof_indices(dof_indices);
+
+      // vector-valued FE where all components are explicitly listed in the dealii::DoFHandler
+      if(dof_handler.get_fe().element_multiplicity(0) >= dim)
+      {
+        for(unsigned int j = 0; j < dof_indices.size(); ++j)
+        {
+          const std::pair<unsigned int, unsigned int> comp =
+            dof_handler.get_fe().system_to_component_index(j);
+          if(comp.first < dim)
+            velocity_vector[comp.second][comp.first] = (*velocity[0])(dof_indices[j]);
+        }
+      }
+      else // scalar FE where we have several vectors referring to the same dealii::DoFHandler
+      {
+        AssertDimension(dof_handler.get_fe().element_multiplicity(0), 1);
+        for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
+          for(unsigned int d = 0; d < dim; ++d)
+            velocity_vector[j][d] = (*velocity[d])(dof_indices[j]);
+      }
+
+      // loop over all x-z-planes of current cell
+      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+      {
+        unsigned int const idx = plane_indices[cell_index][i];
+
+        // perform integral over current x-z-plane of current cell
+        for(unsigned int q = 0; q < plane_shape_values[i].size(); ++q)
+        {
+          // interpolate velocity to the quadrature point
+          dealii::Tensor<1, dim> velocity;
+          for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
+            velocity += plane_shape_values[i][q][j] * velocity_vector[j];
+
+          double const area_ele = area_elements[cell_index][i][q];
+
+          for(unsigned int d = 0; d < dim; d++)
+          {
+            moments_loc[d * n_points_y_glob + idx] += velocity[d] * area_ele;
+            moments_loc[(dim + d) * n_points_y_glob + idx] += velocity[d] * velocity[d] * area_ele;
+          }
+
+          moments_loc[2 * dim * n_points_y_glob + idx] += velocity[0] * velocity[1] * area_ele;
+        }
+      }
+
+      ++cell_index;
+    }
+  }
+
+  AssertThrow(cell_index == plane_indices.size(),
+              dealii::ExcMessage("The mesh has changed since the setup of the statistics."));
+
+  // accumulate data over all processors since we want to average/integrate over the global
+  // x-z-plane
+  dealii::Utilities::MPI::sum(moments_loc, mpi_comm, moments_loc);
+
+  // Add values averaged over global x-z-planes to xxx_glob vectors.
   // Averaging over time-samples is performed when writing the output.
-  for(unsigned int idx = 0; idx < y_glob.size(); idx++)
+  for(unsigned int idx = 0; idx < n_points_y_glob; idx++)
   {
-    for(unsigned int i = 0; i < dim; i++)
-      vel_glob[i].at(idx) += vel_loc[i][idx] / area_loc[idx];
+    for(unsigned int d = 0; d < dim; d++)
+      vel_glob[d].at(idx) += moments_loc[d * n_points_y_glob + idx] / area_glob[idx];
 
-    for(unsigned int i = 0; i < dim; i++)
-      velsq_glob[i].at(idx) += velsq_loc[i][idx] / area_loc[idx];
+    for(unsigned int d = 0; d < dim; d++)
+      velsq_glob[d].at(idx) += moments_loc[(dim + d) * n_points_y_glob + idx] / area_glob[idx];
 
-    veluv_glob.at(idx) += veluv_loc[idx] / area_loc[idx];
+    veluv_glob.at(idx) += moments_loc[2 * dim * n_points_y_glob + idx] / area_glob[idx];
   }
 
   // increment number of samples
   number_of_samples++;
 }
 
+/*
+ * The accumulated statistics are sums over the samples, such that the statistics of several
+ * simulations are merged by adding them up.
+ */
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::write_state(std::string const filename) const
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::ofstream                   out(filename + ".flow_statistics_state");
+    boost::archive::binary_oarchive oa(out);
+
+    oa << y_glob << vel_glob << velsq_glob << veluv_glob << number_of_samples;
+  }
+}
+
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::read_state(std::string const filename)
+{
+  std::string const state_filename = filename + ".flow_statistics_state";
+
+  std::ifstream in(state_filename);
+  AssertThrow(in, dealii::ExcMessage("File " + state_filename + " does not exist."));
+
+  boost::archive::binary_iarchive ia(in);
+
+  std::vector<double>              y, veluv;
+  std::vector<std::vector<double>> vel, velsq;
+  int                              n_samples;
+  ia >> y >> vel >> velsq >> veluv >> n_samples;
+
+  AssertThrow(y.size() == y_glob.size(),
+              dealii::ExcMessage("The statistics in " + state_filename +
+                                 " have been computed on a different mesh."));
+
+  for(unsigned int idx = 0; idx < y_glob.size(); idx++)
+  {
+    AssertThrow(std::abs(y[idx] - y_glob[idx]) < 1e-12,
+                dealii::ExcMessage("The statistics in " + state_filename +
+                                   " have been computed on a different mesh."));
+
+    for(unsigned int i = 0; i < vel_glob.size(); i++)
+      vel_glob[i][idx] += vel[i][idx];
+
+    for(unsigned int i = 0; i < velsq_glob.size(); i++)
+      velsq_glob[i][idx] += velsq[i][idx];
+
+    veluv_glob[idx] += veluv[idx];
+  }
+
+  number_of_samples += n_samples;
+}
+
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::do_write_output(std::string const filename,
@@ -41,7 +41,8 @@ struct TurbulentChannelData
       viscosity(1.0),
       density(1.0),
       directory("output/"),
-      filename("channel")
+      filename("channel"),
+      merge_previous_statistics(false)
   {
   }
 
@@ -61,6 +62,7 @@ struct TurbulentChannelData
       print_parameter(pcout, "Density", density);
       print_parameter(pcout, "Directory of output files", directory);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Merge previous statistics", merge_previous_statistics);
     }
   }
 
@@ -78,6 +80,11 @@ struct TurbulentChannelData
   // directory and filename
   std::string directory;
   std::string filename;
+
+  // continue the sampling of a previous simulation with the same mesh, e.g., after a restart: the
+  // accumulated statistics written by the previous simulation along with the output (file ending
+  // .flow_statistics_state) are read in setup() and merged with the new samples
+  bool merge_previous_statistics;
 };
 
 template<int dim, typename Number>
@@ -123,6 +130,20 @@ private:
   void
   do_write_output(std::string const filename, double const dynamic_viscosity, double const density);
 
+  /*
+   * Evaluates the geometry of all sampling planes once, since it does not change during the
+   * simulation. Afterwards, a sample only requires interpolating the velocity to the quadrature
+   * points and accumulating the moments in a single loop over all cells.
+   */
+  void
+  initialize_sampling_data();
+
+  void
+  write_state(std::string const filename) const;
+
+  void
+  read_state(std::string const filename);
+
   dealii::DoFHandler<dim> const & dof_handler;
   dealii::Mapping<dim> const &    mapping;
   MPI_Comm                        mpi_comm;
@@ -142,6 +163,20 @@ private:
   // number of samples
   int number_of_samples;
 
+  // values of the scalar shape functions at the quadrature points of all x-z-planes of a cell,
+  // which are the same for all cells (index: plane, quadrature point, shape function)
+  std::vector<std::vector<std::vector<double>>> plane_shape_values;
+
+  // index of the y-coordinate of all x-z-planes of the locally owned cells (index: cell, plane)
+  std::vector<std::vector<unsigned int>> plane_indices;
+
+  // area element of all quadrature points of all x-z-planes of the locally owned cells (index:
+  // cell, plane, quadrature point)
+  std::vector<std::vector<std::vector<double>>> area_elements;
+
+  // area of the global x-z-planes (for all y-coordinates)
+  std::vector<double> area_glob;
+
   bool write_final_output;
 
   TurbulentChannelData data;
@@ -24,9 +24,12 @@
 
 // C/C++
 #include <fstream>
+#include <set>
+#include <vector>
 
 // deal.II
 #include <deal.II/base/bounding_box.h>
+#include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/numerics/data_out.h>
@@ -34,8 +37,95 @@
 #include <deal.II/particles/data_out.h>
 #include <deal.II/particles/particle_handler.h>
 
+// ExaDG
+#include <exadg/postprocessor/output_data_base.h>
+
 namespace ExaDG
 {
+/*
+ * Converts OutputCompression into the compression level of deal.II's VtkFlags.
+ */
+inline auto
+get_vtk_compression_level(OutputCompression const compression)
+{
+#if DEAL_II_VERSION_GTE(9, 5, 0)
+  typedef dealii::DataOutBase::CompressionLevel CompressionLevel;
+#else
+  typedef dealii::DataOutBase::VtkFlags::ZlibCompressionLevel CompressionLevel;
+#endif
+
+  switch(compression)
+  {
+    case OutputCompression::None:
+      return CompressionLevel::no_compression;
+    case OutputCompression::BestSpeed:
+      return CompressionLevel::best_speed;
+    case OutputCompression::Default:
+      return CompressionLevel::default_compression;
+    case OutputCompression::BestCompression:
+      return CompressionLevel::best_compression;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      return CompressionLevel::best_speed;
+  }
+}
+
+/*
+ * Restricts the output of data_out to the locally owned cells with one of the given material IDs.
+ * All locally owned cells are written if the set is empty.
+ */
+template<int dim>
+void
+select_output_cells(dealii::DataOut<dim> &                       data_out,
+                    std::set<dealii::types::material_id> const & material_ids)
+{
+  if(material_ids.empty())
+    return;
+
+  data_out.set_cell_selection(
+    dealii::FilteredIterator<typename dealii::Triangulation<dim>::active_cell_iterator>(
+      dealii::IteratorFilters::MaterialIdEqualTo(material_ids, true /* only_locally_owned */)));
+}
+
+/*
+ * Writes the patches of data_out into a single hdf5-file written collectively by all MPI ranks,
+ * and appends the output time to the xdmf-file describing the time series. The entries of all
+ * previous output times are stored in xdmf_entries.
+ */
+template<int dim>
+void
+write_xdmf_hdf5(dealii::DataOut<dim> const &     data_out,
+                std::string const &              folder,
+                std::string const &              file,
+                unsigned int const               counter,
+                double const                     time,
+                std::vector<dealii::XDMFEntry> & xdmf_entries,
+                MPI_Comm const &                 mpi_comm)
+{
+#ifdef DEAL_II_WITH_HDF5
+  dealii::DataOutBase::DataOutFilter data_filter(
+    dealii::DataOutBase::DataOutFilterFlags(true /* filter_duplicate_vertices */,
+                                            true /* xdmf_hdf5_output */));
+  data_out.write_filtered_data(data_filter);
+
+  // the xdmf-file refers to the hdf5-file relative to the output folder
+  std::string const h5_file = file + "_" + dealii::Utilities::int_to_string(counter, 4) + ".h5";
+  data_out.write_hdf5_parallel(data_filter, folder + h5_file, mpi_comm);
+
+  xdmf_entries.push_back(data_out.create_xdmf_entry(data_filter, h5_file, time, mpi_comm));
+  data_out.write_xdmf_file(xdmf_entries, folder + file + ".xdmf", mpi_comm);
+#else
+  (void)data_out;
+  (void)folder;
+  (void)file;
+  (void)counter;
+  (void)time;
+  (void)xdmf_entries;
+  (void)mpi_comm;
+  AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with HDF5!"));
+#endif
+}
+
 template<int dim>
 void
 write_surface_mesh(dealii::Triangulation<dim> const & triangulation,
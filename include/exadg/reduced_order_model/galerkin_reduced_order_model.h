@@ -0,0 +1,254 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_REDUCED_ORDER_MODEL_GALERKIN_REDUCED_ORDER_MODEL_H_
+#define INCLUDE_EXADG_REDUCED_ORDER_MODEL_GALERKIN_REDUCED_ORDER_MODEL_H_
+
+// C/C++
+#include <functional>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/reduced_order_model/proper_orthogonal_decomposition.h>
+
+namespace ExaDG
+{
+/*
+ * Galerkin reduced-order model of a semi-discrete problem M du/dt = F(u) with a right-hand side F
+ * that is (at most) quadratic in u, as it is the case for the convective and viscous terms of the
+ * incompressible Navier-Stokes equations. With the ansatz u = u_0 + sum_k a_k phi_k, where u_0 is
+ * an offset (e.g., the mean of the snapshots) and the modes phi_k are M-orthonormal, the Galerkin
+ * projection yields the system of ordinary differential equations
+ *
+ *   da_i/dt = f_i + sum_j L_ij a_j + sum_jk Q_ijk a_j a_k ,
+ *
+ * with f_i = phi_i^T F(u_0). The reduced operators are computed once in setup() by evaluations of
+ * the full-order right-hand side F, i.e., the existing operators, for the offset displaced in the
+ * direction of the modes and of pairs of modes. This requires 1 + 2r + r(r-1)/2 evaluations for r
+ * modes. Afterwards, the evaluation of the reduced right-hand side costs O(r^3) operations,
+ * independently of the size of the full-order model. For terms of F that are not quadratic (e.g.,
+ * upwind fluxes), the reduced operators represent the quadratic interpolant of F in the reduced
+ * space.
+ *
+ * The class provides the interface of the explicit time integrators, see
+ * ExplicitTimeIntegrator, for the reduced coefficient vector.
+ */
+template<typename Number>
+class GalerkinReducedOrderModel
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  typedef dealii::Vector<double> ReducedVectorType;
+
+  /*
+   * The function evaluate_full_order computes dst = F(src) as a vector of the dual space (i.e.,
+   * not multiplied by M^{-1}), apply_weight computes dst = M src.
+   */
+  void
+  setup(std::vector<VectorType> const &                               modes_in,
+        VectorType const &                                            offset_in,
+        std::function<void(VectorType &, VectorType const &)> const & evaluate_full_order,
+        std::function<void(VectorType &, VectorType const &)> const & apply_weight_in)
+  {
+    modes        = modes_in;
+    offset       = offset_in;
+    apply_weight = apply_weight_in;
+
+    unsigned int const r = modes.size();
+
+    AssertThrow(r > 0, dealii::ExcMessage("The reduced-order model requires at least one mode."));
+
+    VectorType state, full_order_rhs, offset_rhs;
+    state.reinit(offset);
+    full_order_rhs.reinit(offset);
+    offset_rhs.reinit(offset);
+
+    evaluate_full_order(offset_rhs, offset);
+    constant.reinit(r);
+    project(constant, offset_rhs);
+
+    // G(x) = F(u_0 + x) - F(u_0) projected onto the modes
+    ReducedVectorType projection(r);
+    auto const evaluate_increment = [&](ReducedVectorType &       dst,
+                                        std::vector<double> const & coefficients) {
+      state = offset;
+      for(unsigned int k = 0; k < r; ++k)
+        if(coefficients[k] != 0.0)
+          state.add(coefficients[k], modes[k]);
+
+      evaluate_full_order(full_order_rhs, state);
+      full_order_rhs -= offset_rhs;
+
+      project(dst, full_order_rhs);
+    };
+
+    linear.reinit(r, r);
+    quadratic.assign(r * r * r, 0.0);
+
+    std::vector<double> coefficients(r, 0.0);
+
+    // G(phi_j) = L phi_j + Q(phi_j, phi_j), G(-phi_j) = -L phi_j + Q(phi_j, phi_j)
+    ReducedVectorType plus(r), minus(r);
+    for(unsigned int j = 0; j < r; ++j)
+    {
+      coefficients[j] = 1.0;
+      evaluate_increment(plus, coefficients);
+      coefficients[j] = -1.0;
+      evaluate_increment(minus, coefficients);
+      coefficients[j] = 0.0;
+
+      for(unsigned int i = 0; i < r; ++i)
+      {
+        linear(i, j)                 = 0.5 * (plus[i] - minus[i]);
+        quadratic[index(i, j, j, r)] = 0.5 * (plus[i] + minus[i]);
+      }
+    }
+
+    // G(phi_j + phi_k) = L (phi_j + phi_k) + Q(phi_j, phi_j) + Q(phi_k, phi_k) + 2 Q(phi_j, phi_k)
+    for(unsigned int j = 0; j < r; ++j)
+      for(unsigned int k = j + 1; k < r; ++k)
+      {
+        coefficients[j] = 1.0;
+        coefficients[k] = 1.0;
+        evaluate_increment(projection, coefficients);
+        coefficients[j] = 0.0;
+        coefficients[k] = 0.0;
+
+        for(unsigned int i = 0; i < r; ++i)
+        {
+          double const value = 0.5 * (projection[i] - linear(i, j) - linear(i, k) -
+                                      quadratic[index(i, j, j, r)] - quadratic[index(i, k, k, r)]);
+
+          quadratic[index(i, j, k, r)] = value;
+          quadratic[index(i, k, j, r)] = value;
+        }
+      }
+  }
+
+  unsigned int
+  n_modes() const
+  {
+    return modes.size();
+  }
+
+  void
+  initialize_dof_vector(ReducedVectorType & vector) const
+  {
+    vector.reinit(modes.size());
+  }
+
+  /*
+   * Evaluates the reduced right-hand side dst = f + L src + Q(src, src). The reduced operators are
+   * independent of time.
+   */
+  void
+  evaluate(ReducedVectorType & dst, ReducedVectorType const & src, double const time) const
+  {
+    (void)time;
+
+    unsigned int const r = modes.size();
+
+    for(unsigned int i = 0; i < r; ++i)
+    {
+      double sum = constant[i];
+      for(unsigned int j = 0; j < r; ++j)
+      {
+        double quadratic_sum = linear(i, j);
+        for(unsigned int k = 0; k < r; ++k)
+          quadratic_sum += quadratic[index(i, j, k, r)] * src[k];
+        sum += quadratic_sum * src[j];
+      }
+      dst[i] = sum;
+    }
+  }
+
+  /*
+   * Coefficients a = Phi^T M (u - u_0) of the best approximation of u in the reduced space.
+   */
+  void
+  project_state(ReducedVectorType & dst, VectorType const & src) const
+  {
+    VectorType fluctuation, weighted_fluctuation;
+    fluctuation.reinit(src, true);
+    weighted_fluctuation.reinit(src, true);
+
+    fluctuation.equ(1.0, src);
+    fluctuation -= offset;
+    apply_weight(weighted_fluctuation, fluctuation);
+
+    project(dst, weighted_fluctuation);
+  }
+
+  /*
+   * Full-order state u = u_0 + Phi a.
+   */
+  void
+  reconstruct(VectorType & dst, ReducedVectorType const & src) const
+  {
+    dst.equ(1.0, offset);
+    for(unsigned int k = 0; k < modes.size(); ++k)
+      dst.add(src[k], modes[k]);
+  }
+
+private:
+  static unsigned int
+  index(unsigned int const i, unsigned int const j, unsigned int const k, unsigned int const r)
+  {
+    return (i * r + j) * r + k;
+  }
+
+  /*
+   * dst = Phi^T src with a single global reduction.
+   */
+  void
+  project(ReducedVectorType & dst, VectorType const & src) const
+  {
+    std::vector<double> local_products(modes.size(), 0.0);
+    for(unsigned int k = 0; k < modes.size(); ++k)
+      for(unsigned int l = 0; l < src.locally_owned_size(); ++l)
+        local_products[k] += modes[k].local_element(l) * src.local_element(l);
+
+    dealii::Utilities::MPI::sum(dealii::make_array_view(local_products),
+                                src.get_mpi_communicator(),
+                                dealii::make_array_view(dst.begin(), dst.end()));
+  }
+
+  std::vector<VectorType> modes;
+
+  VectorType offset;
+
+  std::function<void(VectorType &, VectorType const &)> apply_weight;
+
+  ReducedVectorType          constant;
+  dealii::FullMatrix<double> linear;
+  std::vector<double>        quadratic;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_REDUCED_ORDER_MODEL_GALERKIN_REDUCED_ORDER_MODEL_H_ */
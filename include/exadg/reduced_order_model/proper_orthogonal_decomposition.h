@@ -0,0 +1,224 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_REDUCED_ORDER_MODEL_PROPER_ORTHOGONAL_DECOMPOSITION_H_
+#define INCLUDE_EXADG_REDUCED_ORDER_MODEL_PROPER_ORTHOGONAL_DECOMPOSITION_H_
+
+// C/C++
+#include <cmath>
+#include <functional>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Computes the inner products (a_i, b_j) = a_i^T b_j of two sets of distributed vectors with a
+ * single global reduction. The result is a matrix of size a.size() x b.size() in row-major format.
+ */
+template<typename Number>
+std::vector<double>
+compute_inner_products(std::vector<dealii::LinearAlgebra::distributed::Vector<Number>> const & a,
+                       std::vector<dealii::LinearAlgebra::distributed::Vector<Number>> const & b)
+{
+  std::vector<double> local_products(a.size() * b.size(), 0.0);
+
+  if(a.empty() or b.empty())
+    return local_products;
+
+  unsigned int const locally_owned_size = a[0].locally_owned_size();
+  for(unsigned int i = 0; i < a.size(); ++i)
+    for(unsigned int j = 0; j < b.size(); ++j)
+    {
+      double sum = 0.0;
+      for(unsigned int k = 0; k < locally_owned_size; ++k)
+        sum += a[i].local_element(k) * b[j].local_element(k);
+      local_products[i * b.size() + j] = sum;
+    }
+
+  std::vector<double> products(local_products.size());
+  dealii::Utilities::MPI::sum(dealii::make_array_view(local_products),
+                              a[0].get_mpi_communicator(),
+                              dealii::make_array_view(products));
+
+  return products;
+}
+
+/*
+ * Proper orthogonal decomposition (POD) of a set of snapshots u_1, ..., u_n by the method of
+ * snapshots (Sirovich 1987): The POD modes are the left singular vectors of the matrix of the
+ * fluctuations u_j - u_mean around the mean value u_mean with respect to the inner product
+ * (u, v) = u^T W v, e.g., the L2 inner product given by the mass matrix W = M. They follow from
+ * the eigendecomposition of the small n x n correlation matrix C_ij = (u_i - u_mean, u_j - u_mean)
+ * = sum_k V_ik lambda_k V_jk as
+ *
+ *   phi_k = 1/sqrt(lambda_k) sum_j V_jk (u_j - u_mean) ,
+ *
+ * such that the modes are orthonormal with respect to the inner product. In parallel, the
+ * correlation matrix is assembled with a single global reduction and the small eigenvalue problem
+ * is solved redundantly on all processes, i.e., the amount of communication is independent of the
+ * global problem size.
+ */
+template<typename Number>
+class ProperOrthogonalDecomposition
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  void
+  add_snapshot(VectorType const & snapshot)
+  {
+    snapshots.push_back(snapshot);
+  }
+
+  unsigned int
+  n_snapshots() const
+  {
+    return snapshots.size();
+  }
+
+  /*
+   * Computes the POD basis consisting of at most max_modes modes. Modes are discarded once the
+   * relative energy of the remaining modes, sum_{k>r} lambda_k / sum_k lambda_k, falls below
+   * energy_tolerance. The function apply_weight computes dst = W src. The snapshots are released
+   * afterwards.
+   */
+  void
+  compute(std::function<void(VectorType &, VectorType const &)> const & apply_weight,
+          unsigned int const                                            max_modes,
+          double const                                                  energy_tolerance)
+  {
+    AssertThrow(snapshots.size() > 1,
+                dealii::ExcMessage("The POD requires at least two snapshots."));
+
+    unsigned int const n = snapshots.size();
+
+    mean.reinit(snapshots[0]);
+    for(auto const & snapshot : snapshots)
+      mean.add(1.0 / n, snapshot);
+
+    std::vector<VectorType> weighted_snapshots(n);
+    for(unsigned int j = 0; j < n; ++j)
+    {
+      snapshots[j] -= mean;
+
+      weighted_snapshots[j].reinit(snapshots[j], true);
+      apply_weight(weighted_snapshots[j], snapshots[j]);
+    }
+
+    std::vector<double> const products = compute_inner_products(snapshots, weighted_snapshots);
+
+    // symmetrize to remove round-off errors of the weighting operator
+    dealii::LAPACKFullMatrix<double> correlation_matrix(n, n);
+    for(unsigned int i = 0; i < n; ++i)
+      for(unsigned int j = 0; j < n; ++j)
+        correlation_matrix(i, j) = 0.5 * (products[i * n + j] + products[j * n + i]);
+
+    // for a symmetric positive semi-definite matrix, the SVD is the eigendecomposition with
+    // eigenvalues sorted in descending order
+    correlation_matrix.compute_svd();
+
+    double total_energy = 0.0;
+    for(unsigned int k = 0; k < n; ++k)
+      total_energy += correlation_matrix.singular_value(k);
+
+    AssertThrow(total_energy > 0.0,
+                dealii::ExcMessage("The snapshots do not contain any fluctuations."));
+
+    eigenvalues.clear();
+    double remaining_energy = total_energy;
+    for(unsigned int k = 0; k < std::min(n, max_modes); ++k)
+    {
+      double const lambda = correlation_matrix.singular_value(k);
+
+      if(remaining_energy < energy_tolerance * total_energy or lambda < 1.e-12 * total_energy)
+        break;
+
+      eigenvalues.push_back(lambda);
+      remaining_energy -= lambda;
+    }
+
+    captured_energy = 1.0 - remaining_energy / total_energy;
+
+    dealii::LAPACKFullMatrix<double> const & eigenvectors = correlation_matrix.get_svd_u();
+
+    modes.resize(eigenvalues.size());
+    for(unsigned int k = 0; k < modes.size(); ++k)
+    {
+      modes[k].reinit(mean);
+      for(unsigned int j = 0; j < n; ++j)
+        modes[k].add(eigenvectors(j, k) / std::sqrt(eigenvalues[k]), snapshots[j]);
+    }
+
+    snapshots.clear();
+  }
+
+  std::vector<VectorType> const &
+  get_modes() const
+  {
+    return modes;
+  }
+
+  VectorType const &
+  get_mean() const
+  {
+    return mean;
+  }
+
+  /*
+   * Eigenvalues lambda_k of the correlation matrix, i.e., the energy of the POD modes.
+   */
+  std::vector<double> const &
+  get_eigenvalues() const
+  {
+    return eigenvalues;
+  }
+
+  /*
+   * Fraction of the energy of the fluctuations represented by the POD basis.
+   */
+  double
+  get_captured_energy() const
+  {
+    return captured_energy;
+  }
+
+private:
+  std::vector<VectorType> snapshots;
+
+  VectorType mean;
+
+  std::vector<VectorType> modes;
+
+  std::vector<double> eigenvalues;
+
+  double captured_energy = 0.0;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_REDUCED_ORDER_MODEL_PROPER_ORTHOGONAL_DECOMPOSITION_H_ */
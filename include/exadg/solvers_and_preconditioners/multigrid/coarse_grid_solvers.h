@@ -28,6 +28,7 @@
 #include <deal.II/lac/solver_cg.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/trilinos_solver.h>
 #include <deal.II/multigrid/mg_base.h>
 #include <deal.II/numerics/vector_tools_mean_value.h>
 
@@ -57,6 +58,15 @@ public:
 
   virtual void
   update() = 0;
+
+  /*
+   * Memory consumption of the data owned by the coarse-grid solver (in bytes).
+   */
+  virtual std::size_t
+  memory_consumption() const
+  {
+    return 0;
+  }
 };
 
 enum class KrylovSolverType
@@ -463,6 +473,9 @@ private:
 
 public:
   MGCoarseAMG(Operator const & op, bool const initialize, AMGData data = AMGData())
+    : n_updates_reuse_setup(data.n_updates_reuse_setup),
+      n_updates_skipped(0),
+      setup_is_available(initialize)
   {
     (void)op;
     (void)data;
@@ -481,8 +494,8 @@ public:
     else if(data.amg_type == AMGType::ML)
     {
 #ifdef DEAL_II_WITH_TRILINOS
-      amg_preconditioner =
-        std::make_shared<PreconditionerML<Operator, NumberAMG>>(op, initialize, data.ml_data);
+      amg_preconditioner = std::make_shared<PreconditionerML<Operator, NumberAMG>>(
+        op, initialize, data.ml_data, data.reuse_hierarchy, data.rigid_body_modes);
 #else
       AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
@@ -496,7 +509,18 @@ public:
   void
   update() final
   {
-    amg_preconditioner->update();
+    // reuse the (possibly stale) setup of a previous update, see AMGData::n_updates_reuse_setup
+    if(setup_is_available and n_updates_skipped < n_updates_reuse_setup)
+    {
+      ++n_updates_skipped;
+    }
+    else
+    {
+      amg_preconditioner->update();
+
+      n_updates_skipped  = 0;
+      setup_is_available = true;
+    }
   }
 
   void
@@ -520,8 +544,200 @@ public:
     dst.copy_locally_owned_data_from(dst_amg);
   }
 
+  std::size_t
+  memory_consumption() const final
+  {
+#ifdef DEAL_II_WITH_TRILINOS
+    if(auto amg = std::dynamic_pointer_cast<PreconditionerML<Operator, NumberAMG>>(
+         amg_preconditioner))
+      return amg->system_matrix.memory_consumption();
+#endif
+#ifdef DEAL_II_WITH_PETSC
+    if(auto amg = std::dynamic_pointer_cast<PreconditionerBoomerAMG<Operator, NumberAMG>>(
+         amg_preconditioner))
+      return amg->system_matrix.memory_consumption();
+#endif
+    return 0;
+  }
+
 private:
   std::shared_ptr<PreconditionerBase<NumberAMG>> amg_preconditioner;
+
+  unsigned int n_updates_reuse_setup;
+  unsigned int n_updates_skipped;
+  bool         setup_is_available;
+};
+
+/*
+ * Coarse-grid solver using a sparse direct solver. The system matrix is assembled and factorized
+ * in update(), and the factorization is reused for all coarse-grid solves until the next update.
+ * This is attractive if the coarse problem is small but ill-conditioned, e.g., for high aspect
+ * ratio cells, where iterative coarse-grid solvers need many iterations.
+ */
+template<typename Operator>
+class MGCoarseDirect : public CoarseGridSolverBase<Operator>
+{
+private:
+  typedef double NumberDirect;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<NumberDirect> VectorTypeDirect;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<typename Operator::value_type>
+    VectorTypeMultigrid;
+
+public:
+  MGCoarseDirect(Operator const &                      op,
+                 bool const                            initialize,
+                 MultigridCoarseGridDirectSolver const direct_solver_type,
+                 bool const                            operator_is_singular)
+    : pde_operator(op), direct_solver_type(direct_solver_type), solver_control(1, 0.0)
+  {
+    AssertThrow(not operator_is_singular,
+                dealii::ExcMessage("The coarse-grid operator is singular, which can not be "
+                                   "handled by a sparse direct solver. Use an iterative "
+                                   "coarse-grid solver instead."));
+
+    if(direct_solver_type == MultigridCoarseGridDirectSolver::PETScMUMPS)
+    {
+#ifdef DEAL_II_WITH_PETSC
+      subcommunicator =
+        create_subcommunicator(pde_operator.get_matrix_free().get_dof_handler(op.get_dof_index()));
+      pde_operator.init_system_matrix(petsc_matrix, *subcommunicator);
+#else
+      AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with PETSc!"));
+#endif
+    }
+    else
+    {
+#ifdef DEAL_II_WITH_TRILINOS
+      pde_operator.init_system_matrix(
+        trilinos_matrix, op.get_matrix_free().get_dof_handler().get_communicator());
+#else
+      AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
+#endif
+    }
+
+    if(initialize)
+    {
+      this->update();
+    }
+  }
+
+  void
+  update() final
+  {
+    if(direct_solver_type == MultigridCoarseGridDirectSolver::PETScMUMPS)
+    {
+#ifdef DEAL_II_WITH_PETSC
+      // skip the processes that do not participate in the sub-communicator
+      if(petsc_matrix.m() > 0)
+      {
+        petsc_matrix = 0.0;
+        pde_operator.calculate_system_matrix(petsc_matrix);
+
+        // MUMPS factorizes the matrix in the first solve and keeps the factorization as long as
+        // the matrix is not modified. A new solver object ensures that the factorization of the
+        // previous matrix is discarded.
+        petsc_solver = std::make_unique<dealii::PETScWrappers::SparseDirectMUMPS>(solver_control);
+      }
+#endif
+    }
+    else
+    {
+#ifdef DEAL_II_WITH_TRILINOS
+      trilinos_matrix *= 0.0;
+      pde_operator.calculate_system_matrix(trilinos_matrix);
+
+      std::string solver_name = "Amesos_Klu";
+      if(direct_solver_type == MultigridCoarseGridDirectSolver::AmesosMUMPS)
+        solver_name = "Amesos_Mumps";
+      else if(direct_solver_type == MultigridCoarseGridDirectSolver::AmesosSuperLUDist)
+        solver_name = "Amesos_Superludist";
+
+      trilinos_solver = std::make_unique<dealii::TrilinosWrappers::SolverDirect>(
+        solver_control, dealii::TrilinosWrappers::SolverDirect::AdditionalData(false, solver_name));
+
+      // compute the factorization once, which is reused in all subsequent solves
+      trilinos_solver->initialize(trilinos_matrix);
+#endif
+    }
+  }
+
+  void
+  operator()(unsigned int const /*level*/,
+             VectorTypeMultigrid &       dst,
+             VectorTypeMultigrid const & src) const final
+  {
+    // create temporal vectors of type VectorTypeDirect (double)
+    VectorTypeDirect dst_direct;
+    dst_direct.reinit(dst, false);
+    VectorTypeDirect src_direct;
+    src_direct.reinit(src, true);
+
+    // convert: VectorTypeMultigrid -> VectorTypeDirect
+    src_direct.copy_locally_owned_data_from(src);
+
+    if(direct_solver_type == MultigridCoarseGridDirectSolver::PETScMUMPS)
+    {
+#ifdef DEAL_II_WITH_PETSC
+      if(petsc_matrix.m() > 0)
+        apply_petsc_operation(dst_direct,
+                              src_direct,
+                              petsc_matrix.get_mpi_communicator(),
+                              [&](dealii::PETScWrappers::VectorBase &       petsc_dst,
+                                  dealii::PETScWrappers::VectorBase const & petsc_src) {
+                                petsc_solver->solve(petsc_matrix, petsc_dst, petsc_src);
+                              });
+#endif
+    }
+    else
+    {
+#ifdef DEAL_II_WITH_TRILINOS
+      trilinos_solver->solve(dst_direct, src_direct);
+#endif
+    }
+
+    // convert: VectorTypeDirect -> VectorTypeMultigrid
+    dst.copy_locally_owned_data_from(dst_direct);
+  }
+
+  std::size_t
+  memory_consumption() const final
+  {
+#ifdef DEAL_II_WITH_TRILINOS
+    if(direct_solver_type != MultigridCoarseGridDirectSolver::PETScMUMPS)
+      return trilinos_matrix.memory_consumption();
+#endif
+#ifdef DEAL_II_WITH_PETSC
+    if(direct_solver_type == MultigridCoarseGridDirectSolver::PETScMUMPS)
+      return petsc_matrix.memory_consumption();
+#endif
+    return 0;
+  }
+
+private:
+  Operator const & pde_operator;
+
+  MultigridCoarseGridDirectSolver const direct_solver_type;
+
+  // the direct solvers ignore the tolerances but store a reference to the solver control
+  dealii::SolverControl solver_control;
+
+#ifdef DEAL_II_WITH_TRILINOS
+  dealii::TrilinosWrappers::SparseMatrix                  trilinos_matrix;
+  std::unique_ptr<dealii::TrilinosWrappers::SolverDirect> trilinos_solver;
+#endif
+
+#ifdef DEAL_II_WITH_PETSC
+  // subcommunicator; declared before the matrix to ensure that it gets deleted after the matrix
+  // and the solver depending on it
+  std::unique_ptr<MPI_Comm, void (*)(MPI_Comm *)> subcommunicator{nullptr, [](MPI_Comm *) {}};
+
+  dealii::PETScWrappers::MPI::SparseMatrix petsc_matrix;
+
+  // mutable since PETSc computes the factorization in the first solve after an update
+  mutable std::unique_ptr<dealii::PETScWrappers::SparseDirectMUMPS> petsc_solver;
+#endif
 };
 
 } // namespace ExaDG
@@ -23,6 +23,7 @@
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_PRECONDITIONER_H_
 
 // deal.II
+#include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/function_lib.h>
 #include <deal.II/base/timer.h>
 #include <deal.II/lac/la_parallel_vector.h>
@@ -32,34 +33,47 @@
 #include <deal.II/multigrid/multigrid.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfer_base.h>
+#include <exadg/utilities/enum_utilities.h>
+#include <exadg/utilities/profiling.h>
 #include <exadg/utilities/timer_tree.h>
 
-/*
- * Activate timings if desired.
- */
-#define ENABLE_TIMING false
-
-#ifndef ENABLE_TIMING
-#  define ENABLE_TIMING false
-#endif
-
 namespace ExaDG
 {
 /*
- * Re-implementation of multigrid preconditioner (V-cycle) in order to have more direct control over
- * its individual components and avoid inner products and other expensive stuff.
+ * Re-implementation of multigrid preconditioner (V-, W-, and F-cycles, see CycleData) in order to
+ * have more direct control over its individual components and avoid inner products and other
+ * expensive stuff.
  */
 template<typename VectorType, typename MatrixType, typename SmootherType>
 class MultigridAlgorithm
 {
 public:
+  /*
+   * Number of cycles applied per cycle type, and the latest residual reduction measured by the
+   * adaptive cycle.
+   */
+  struct CycleStatistics
+  {
+    CycleStatistics() : n_v_cycles(0), n_f_cycles(0), n_w_cycles(0), n_switches(0), last_rate(-1.0)
+    {
+    }
+
+    unsigned int n_v_cycles;
+    unsigned int n_f_cycles;
+    unsigned int n_w_cycles;
+    unsigned int n_switches;
+    double       last_rate;
+  };
+
   MultigridAlgorithm(dealii::MGLevelObject<std::shared_ptr<MatrixType>> const &   matrix,
                      dealii::MGCoarseGridBase<VectorType> const &                 coarse,
                      MultigridTransferBase<VectorType> const &                    transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     CycleData const & cycle_data       = CycleData(),
+                     bool const        detailed_timings = false)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
@@ -70,9 +84,15 @@ public:
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      cycle_data(cycle_data),
+      detailed_timings(detailed_timings),
+      current_cycle(cycle_data.cycle == MultigridCycle::Adaptive ? MultigridCycle::V :
+                                                                   cycle_data.cycle),
+      n_applications(0)
   {
-    AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
+    AssertThrow(cycle_data.cycle != MultigridCycle::Adaptive or
+                  cycle_data.adaptive_check_interval > 0,
+                dealii::ExcMessage("adaptive_check_interval has to be larger than zero."));
 
     for(unsigned int level = minlevel; level <= maxlevel; ++level)
     {
@@ -88,23 +108,17 @@ public:
   void
   vmult(OtherVectorType & dst, OtherVectorType const & src) const
   {
-#if ENABLE_TIMING
-    dealii::Timer timer;
-#endif
+    ProfilingRegion region(timer_tree, {"Multigrid"});
 
-    for(unsigned int i = minlevel; i < maxlevel; i++)
-    {
-      defect[i] = 0.0;
-    }
     defect[maxlevel].copy_locally_owned_data_from(src);
 
-    v_cycle(maxlevel, false);
+    apply_cycle(maxlevel, current_cycle, false);
+    count_cycle(current_cycle);
 
-    dst.copy_locally_owned_data_from(solution[maxlevel]);
+    if(cycle_data.cycle == MultigridCycle::Adaptive)
+      adapt_cycle();
 
-#if ENABLE_TIMING
-    timer_tree->insert({"Multigrid"}, timer.wall_time());
-#endif
+    dst.copy_locally_owned_data_from(solution[maxlevel]);
   }
 
   template<class OtherVectorType>
@@ -130,12 +144,8 @@ public:
     bool converged = norm_r_0 < abstol;
     while(not converged)
     {
-      for(unsigned int i = minlevel; i < maxlevel; i++)
-      {
-        defect[i] = 0.0;
-      }
-
-      v_cycle(maxlevel, true);
+      apply_cycle(maxlevel, current_cycle, true);
+      count_cycle(current_cycle);
 
       // calculate residual and check convergence
       norm_r = calculate_residual(residual);
@@ -150,6 +160,45 @@ public:
     return n_iter;
   }
 
+  /*
+   * Full multigrid (nested iteration) for the system with right-hand side src: The right-hand
+   * side is restricted to all levels, the problem is solved on the coarsest level, and the
+   * solution is prolongated to the next finer level, where it serves as initial guess for
+   * n_cycles_per_level V-cycles. This is repeated up to the finest level. The result is an
+   * approximation of the solution with an error typically in the order of the discretization
+   * error, e.g. to be used as initial guess of a Krylov solver.
+   */
+  template<class OtherVectorType>
+  void
+  full_multigrid(OtherVectorType &       dst,
+                 OtherVectorType const & src,
+                 unsigned int const      n_cycles_per_level) const
+  {
+    ProfilingRegion region(timer_tree, {"Full multigrid"});
+
+    // The vectors defect[level] store the right-hand sides, where the cycles on a level only
+    // overwrite the vectors on the coarser levels, which are no longer needed.
+    defect[maxlevel].copy_locally_owned_data_from(src);
+    for(unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      defect[level - 1] = 0.0;
+      transfer.restrict_and_add(level, defect[level - 1], defect[level]);
+    }
+
+    (*coarse)(minlevel, solution[minlevel], defect[minlevel]);
+
+    for(unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      solution[level] = 0.0;
+      transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
+
+      for(unsigned int i = 0; i < n_cycles_per_level; ++i)
+        apply_cycle(level, MultigridCycle::V, true);
+    }
+
+    dst.copy_locally_owned_data_from(solution[maxlevel]);
+  }
+
   template<class OtherVectorType>
   double
   calculate_residual(OtherVectorType & residual) const
@@ -165,37 +214,35 @@ public:
     return timer_tree;
   }
 
+  CycleStatistics const &
+  get_cycle_statistics() const
+  {
+    return statistics;
+  }
+
 private:
   /**
-   * Implements the V-cycle
+   * Implements the V-, W-, and F-cycle on the given level. The coarse-grid solver does not take
+   * into account an initial guess and is therefore applied only once per visit of the second
+   * coarsest level, independently of the cycle type.
    */
   void
-  v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
+  apply_cycle(unsigned int const   level,
+              MultigridCycle const cycle_type,
+              bool const           multigrid_is_a_solver) const
   {
-#if ENABLE_TIMING
-    dealii::Timer timer;
-#endif
-
     // call coarse grid solver
     if(level == minlevel)
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      ProfilingRegion region = level_region(level, "Coarse solver");
 
       (*coarse)(level, solution[level], defect[level]);
-
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
     }
     else
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
-
       // pre-smoothing
+      ProfilingRegion pre_smoothing = level_region(level, "Pre-smoothing");
+
       if(multigrid_is_a_solver)
       {
         // One has to take into account the initial guess of the solution when used as a solver
@@ -211,31 +258,130 @@ private:
         (*smoother)[level]->vmult(solution[level], defect[level]);
       }
 
-      // restriction
-      (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
-      t[level].sadd(-1.0, 1.0, defect[level]);
-      transfer.restrict_and_add(level, defect[level - 1], t[level]);
-
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
-
-      // coarse grid correction
-      v_cycle(level - 1, false);
-
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      pre_smoothing.stop();
+
+      // restriction: The residual t = defect - A * solution is computed within the matrix-free
+      // loop of the operator on the index ranges just completed by the operator, so that the
+      // vectors are only read once. Note that vmult_interface_down() coincides with vmult() for
+      // the global-coarsening transfers used here.
+      ProfilingRegion restriction = level_region(level, "Restriction");
+
+      VectorType &       residual    = t[level];
+      VectorType const & defect_fine = defect[level];
+      (*matrix)[level]->vmult(
+        residual,
+        solution[level],
+        [&](unsigned int const start_range, unsigned int const end_range) {
+          for(unsigned int i = start_range; i < end_range; ++i)
+            residual.local_element(i) = 0.0;
+        },
+        [&](unsigned int const start_range, unsigned int const end_range) {
+          for(unsigned int i = start_range; i < end_range; ++i)
+            residual.local_element(i) = defect_fine.local_element(i) - residual.local_element(i);
+        });
+      defect[level - 1] = 0.0;
+      transfer.restrict_and_add(level, defect[level - 1], residual);
+
+      restriction.stop();
+
+      // coarse grid correction: the W- and F-cycles visit the coarser level twice, where the
+      // second visit improves the coarse-level solution of the first one. For the F-cycle, the
+      // second visit is a V-cycle.
+      bool const single_visit = cycle_type == MultigridCycle::V or level - 1 == minlevel or
+                                maxlevel - level < cycle_data.n_fine_levels_v_cycle;
+      unsigned int const n_visits = single_visit ? 1 : 2;
+      for(unsigned int visit = 0; visit < n_visits; ++visit)
+      {
+        MultigridCycle const coarse_cycle_type =
+          (cycle_type == MultigridCycle::F and visit > 0) ? MultigridCycle::V : cycle_type;
+        apply_cycle(level - 1, coarse_cycle_type, visit > 0);
+      }
 
       // prolongation
+      ProfilingRegion prolongation = level_region(level, "Prolongation");
+
       transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
 
+      prolongation.stop();
+
       // post-smoothing
+      ProfilingRegion post_smoothing = level_region(level, "Post-smoothing");
+
       (*smoother)[level]->step(solution[level], defect[level]);
+    }
+  }
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+  /**
+   * Returns the profiling region for the item name of the given level. Only active if detailed
+   * timings are requested.
+   */
+  ProfilingRegion
+  level_region(unsigned int const level, std::string const & name) const
+  {
+    return ProfilingRegion(timer_tree,
+                           {"Multigrid", "level " + std::to_string(level), name},
+                           detailed_timings);
+  }
+
+  void
+  count_cycle(MultigridCycle const cycle_type) const
+  {
+    if(cycle_type == MultigridCycle::V)
+      ++statistics.n_v_cycles;
+    else if(cycle_type == MultigridCycle::F)
+      ++statistics.n_f_cycles;
+    else if(cycle_type == MultigridCycle::W)
+      ++statistics.n_w_cycles;
+    else
+      AssertThrow(false, dealii::ExcNotImplemented());
+  }
+
+  /**
+   * Measures the residual reduction of the cycle just applied every adaptive_check_interval
+   * applications and selects the cycle type for the subsequent applications, see CycleData.
+   */
+  void
+  adapt_cycle() const
+  {
+    ++n_applications;
+    if(n_applications % cycle_data.adaptive_check_interval != 0)
+      return;
+
+    double const norm_rhs = defect[maxlevel].l2_norm();
+    if(norm_rhs == 0.0)
+      return;
+
+    (*matrix)[maxlevel]->vmult(t[maxlevel], solution[maxlevel]);
+    t[maxlevel].sadd(-1.0, 1.0, defect[maxlevel]);
+    double const rate = t[maxlevel].l2_norm() / norm_rhs;
+
+    statistics.last_rate = rate;
+
+    MultigridCycle const previous_cycle = current_cycle;
+    if(rate > cycle_data.adaptive_threshold)
+    {
+      if(current_cycle == MultigridCycle::V)
+        current_cycle = MultigridCycle::F;
+      else if(current_cycle == MultigridCycle::F)
+        current_cycle = MultigridCycle::W;
+    }
+    else if(rate < 0.25 * cycle_data.adaptive_threshold)
+    {
+      if(current_cycle == MultigridCycle::W)
+        current_cycle = MultigridCycle::F;
+      else if(current_cycle == MultigridCycle::F)
+        current_cycle = MultigridCycle::V;
+    }
+
+    if(current_cycle != previous_cycle)
+    {
+      ++statistics.n_switches;
+
+      dealii::ConditionalOStream pcout(std::cout,
+                                       dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+      pcout << "Multigrid: residual reduction " << rate << ", switching from "
+            << Utilities::enum_to_string(previous_cycle) << "-cycle to "
+            << Utilities::enum_to_string(current_cycle) << "-cycle." << std::endl;
     }
   }
 
@@ -287,7 +433,19 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  unsigned int const n_cycles;
+  CycleData const cycle_data;
+
+  // record the time spent in the individual components of each level
+  bool const detailed_timings;
+
+  /**
+   * Cycle type of the next application, which differs from cycle_data.cycle in adaptive mode.
+   */
+  mutable MultigridCycle current_cycle;
+
+  mutable unsigned int n_applications;
+
+  mutable CycleStatistics statistics;
 
   std::shared_ptr<TimerTree> timer_tree;
 };
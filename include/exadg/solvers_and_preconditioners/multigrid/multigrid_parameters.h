@@ -64,6 +64,14 @@ enum class PSequenceType
   Manual
 };
 
+enum class MultigridCycle
+{
+  V,
+  W,
+  F,
+  Adaptive
+};
+
 enum class MultigridSmoother
 {
   Chebyshev,
@@ -83,7 +91,20 @@ enum class MultigridCoarseGridSolver
   Chebyshev,
   CG,
   GMRES,
-  AMG
+  AMG,
+  Direct
+};
+
+/*
+ * Sparse direct solvers for MultigridCoarseGridSolver::Direct, available via the Amesos package
+ * of Trilinos or via PETSc.
+ */
+enum class MultigridCoarseGridDirectSolver
+{
+  AmesosKLU,
+  AmesosMUMPS,
+  AmesosSuperLUDist,
+  PETScMUMPS
 };
 
 enum class MultigridCoarseGridPreconditioner
@@ -100,6 +121,10 @@ struct AMGData
   {
     amg_type = AMGType::ML;
 
+    reuse_hierarchy       = false;
+    rigid_body_modes      = false;
+    n_updates_reuse_setup = 0;
+
 #ifdef DEAL_II_WITH_TRILINOS
     ml_data.smoother_sweeps = 1;
     ml_data.n_cycles        = 1;
@@ -130,6 +155,8 @@ struct AMGData
       print_parameter(pcout, "    Number of cycles", ml_data.n_cycles);
       print_parameter(pcout, "    Smoother type", ml_data.smoother_type);
 #endif
+      print_parameter(pcout, "    Reuse hierarchy", reuse_hierarchy);
+      print_parameter(pcout, "    Rigid body modes", rigid_body_modes);
     }
     else if(amg_type == AMGType::BoomerAMG)
     {
@@ -145,10 +172,28 @@ struct AMGData
     {
       AssertThrow(false, dealii::ExcNotImplemented());
     }
+
+    print_parameter(pcout, "    Updates reusing setup", n_updates_reuse_setup);
   }
 
   AMGType amg_type;
 
+  // ML only: keep the aggregation (i.e. the AMG hierarchy) of the first setup when the
+  // preconditioner is updated and only recompute the matrix values on all levels. This is valid if
+  // the sparsity pattern does not change, e.g. for a moving mesh.
+  bool reuse_hierarchy;
+
+  // ML only: use the rigid body modes (translations and rotations) of a vector-valued problem
+  // with dim components as near-nullspace, e.g. for elasticity, instead of the constant modes of
+  // the individual components. Rotations are poorly represented by the default near-nullspace,
+  // which deteriorates the convergence for thin structures.
+  bool rigid_body_modes;
+
+  // Number of calls to update() that are skipped after a setup of the AMG preconditioner, i.e.
+  // the possibly stale setup is reused for this number of updates (e.g. time steps of an ALE
+  // simulation). A value of zero recomputes the setup in every update.
+  unsigned int n_updates_reuse_setup;
+
 #ifdef DEAL_II_WITH_TRILINOS
   dealii::TrilinosWrappers::PreconditionAMG::AdditionalData ml_data;
 #endif
@@ -163,7 +208,8 @@ enum class PreconditionerSmoother
   None,
   PointJacobi,
   BlockJacobi,
-  AdditiveSchwarz
+  AdditiveSchwarz,
+  FastDiagonalization
 };
 
 struct SmootherData
@@ -174,7 +220,9 @@ struct SmootherData
       iterations(5),
       relaxation_factor(0.8),
       smoothing_range(20),
-      iterations_eigenvalue_estimation(20)
+      iterations_eigenvalue_estimation(20),
+      n_updates_reuse_eigenvalues(0),
+      eigenvalue_reestimation_tolerance(0.1)
   {
   }
 
@@ -194,6 +242,11 @@ struct SmootherData
     {
       print_parameter(pcout, "Smoothing range", smoothing_range);
       print_parameter(pcout, "Iterations eigenvalue estimation", iterations_eigenvalue_estimation);
+      print_parameter(pcout, "Updates reusing eigenvalues", n_updates_reuse_eigenvalues);
+      if(n_updates_reuse_eigenvalues > 0 and preconditioner == PreconditionerSmoother::PointJacobi)
+        print_parameter(pcout,
+                        "Eigenvalue re-estimation tolerance",
+                        eigenvalue_reestimation_tolerance);
     }
   }
 
@@ -214,6 +267,16 @@ struct SmootherData
 
   // Chebyshev smmother: number of CG iterations for estimation of eigenvalues
   unsigned int iterations_eigenvalue_estimation;
+
+  // Chebyshev smoother: number of updates of the smoother (e.g. Newton steps) that reuse the
+  // cached estimate of the maximum eigenvalue instead of running the CG-based estimation again. A
+  // value of zero estimates the eigenvalues in every update.
+  unsigned int n_updates_reuse_eigenvalues;
+
+  // Chebyshev smoother with point Jacobi preconditioner and n_updates_reuse_eigenvalues > 0: the
+  // eigenvalues are re-estimated before n_updates_reuse_eigenvalues is reached if the l2-norm of
+  // the inverse diagonal changes by more than this relative tolerance since the last estimation.
+  double eigenvalue_reestimation_tolerance;
 };
 
 struct CoarseGridData
@@ -222,7 +285,8 @@ struct CoarseGridData
     : solver(MultigridCoarseGridSolver::Chebyshev),
       preconditioner(MultigridCoarseGridPreconditioner::PointJacobi),
       solver_data(SolverData(1e4, 1.e-12, 1.e-3)),
-      amg_data(AMGData())
+      amg_data(AMGData()),
+      direct_solver(MultigridCoarseGridDirectSolver::AmesosKLU)
   {
   }
 
@@ -230,6 +294,12 @@ struct CoarseGridData
   print(dealii::ConditionalOStream const & pcout) const
   {
     print_parameter(pcout, "Coarse grid solver", solver);
+    if(solver == MultigridCoarseGridSolver::Direct)
+    {
+      print_parameter(pcout, "Coarse grid direct solver", direct_solver);
+      return;
+    }
+
     print_parameter(pcout, "Coarse grid preconditioner", preconditioner);
 
     solver_data.print(pcout);
@@ -252,14 +322,71 @@ struct CoarseGridData
 
   // Configuration of AMG settings
   AMGData amg_data;
+
+  // Sparse direct solver used for MultigridCoarseGridSolver::Direct. The matrix is factorized in
+  // each update of the multigrid preconditioner and the factorization is reused for all coarse
+  // solves until the next update.
+  MultigridCoarseGridDirectSolver direct_solver;
 };
 
 
+struct CycleData
+{
+  CycleData()
+    : cycle(MultigridCycle::V),
+      n_fine_levels_v_cycle(0),
+      adaptive_threshold(0.1),
+      adaptive_check_interval(10)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Multigrid cycle", cycle);
+
+    if(cycle != MultigridCycle::V)
+    {
+      print_parameter(pcout, "Fine levels with V-cycle", n_fine_levels_v_cycle);
+    }
+
+    if(cycle == MultigridCycle::Adaptive)
+    {
+      print_parameter(pcout, "Adaptive cycle threshold", adaptive_threshold);
+      print_parameter(pcout, "Adaptive cycle check interval", adaptive_check_interval);
+    }
+  }
+
+  // Type of multigrid cycle. For the W-cycle, the next coarser level is visited twice from each
+  // level. The F-cycle visits the next coarser level with an F-cycle followed by a V-cycle.
+  // In adaptive mode, the cycle starts as a V-cycle and switches between V-, F-, and W-cycles
+  // depending on the observed reduction of the residual.
+  MultigridCycle cycle;
+
+  // Number of finest levels on which the next coarser level is visited only once (as in a
+  // V-cycle), independently of the cycle type. This allows to combine cheap cycles on the fine
+  // levels with W/F-cycles on the cheap coarse levels.
+  unsigned int n_fine_levels_v_cycle;
+
+  // Adaptive cycle: every adaptive_check_interval applications of the multigrid preconditioner,
+  // the residual reduction ||b - A x|| / ||b|| of the cycle is measured (at the cost of one
+  // additional operator evaluation). If it exceeds adaptive_threshold, the next stronger cycle is
+  // selected (V -> F -> W). If it falls below a quarter of adaptive_threshold, the next cheaper
+  // cycle is selected.
+  double       adaptive_threshold;
+  unsigned int adaptive_check_interval;
+};
+
 struct MultigridData
 {
   MultigridData()
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
+      auto_tune(false),
+      auto_tune_n_cycles(5),
+      print_memory_consumption(false),
+      detailed_timings(false),
+      cycle_data(CycleData()),
       smoother_data(SmootherData()),
       coarse_problem(CoarseGridData())
   {
@@ -268,12 +395,26 @@ struct MultigridData
   void
   print(dealii::ConditionalOStream const & pcout) const
   {
-    print_parameter(pcout, "Multigrid type", type);
+    print_parameter(pcout, "Auto-tune multigrid type", auto_tune);
 
-    if(involves_p_transfer())
+    if(auto_tune)
     {
-      print_parameter(pcout, "p-sequence", p_sequence);
+      print_parameter(pcout, "Auto-tune cycles", auto_tune_n_cycles);
     }
+    else
+    {
+      print_parameter(pcout, "Multigrid type", type);
+
+      if(involves_p_transfer())
+      {
+        print_parameter(pcout, "p-sequence", p_sequence);
+      }
+    }
+
+    print_parameter(pcout, "Print memory consumption", print_memory_consumption);
+    print_parameter(pcout, "Detailed timings", detailed_timings);
+
+    cycle_data.print(pcout);
 
     smoother_data.print(pcout);
 
@@ -295,6 +436,26 @@ struct MultigridData
   // Sequence of polynomial degrees during p-multigrid
   PSequenceType p_sequence;
 
+  // Select type and p_sequence at setup among all multigrid hierarchies applicable to the given
+  // discretization. For each candidate, auto_tune_n_cycles multigrid cycles are timed and the
+  // candidate with the smallest estimated time-to-tolerance is chosen, see
+  // MultigridPreconditionerBase::initialize(). The parameters type and p_sequence are ignored.
+  bool auto_tune;
+
+  unsigned int auto_tune_n_cycles;
+
+  // Print the memory consumption of all multigrid levels after setup, see
+  // MultigridPreconditionerBase::print_memory_consumption()
+  bool print_memory_consumption;
+
+  // Record the time spent in the smoothers, transfers, and the coarse-grid solver for each level
+  // and each application of the multigrid cycle, see MultigridPreconditionerBase::get_timings().
+  // The setup is always timed per level and component.
+  bool detailed_timings;
+
+  // Multigrid cycle
+  CycleData cycle_data;
+
   // Smoother data
   SmootherData smoother_data;
 
@@ -19,7 +19,12 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <iomanip>
+#include <limits>
+
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_simplex_p.h>
@@ -41,14 +46,19 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/jacobi_smoother.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfer.h>
 #include <exadg/solvers_and_preconditioners/utilities/compute_eigenvalues.h>
+#include <exadg/utilities/enum_utilities.h>
 #include <exadg/utilities/mpi.h>
+#include <exadg/utilities/shared_memory_communicator.h>
 
 namespace ExaDG
 {
 template<int dim, typename Number, typename MultigridNumber>
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::MultigridPreconditionerBase(
   MPI_Comm const & comm)
-  : mpi_comm(comm)
+  : geometry_version_matrix_free(dealii::numbers::invalid_unsigned_int),
+    mpi_comm(comm),
+    timer_tree_setup(std::make_shared<TimerTree>()),
+    timer_tree_update(std::make_shared<TimerTree>())
 {
 }
 
@@ -64,36 +74,246 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize(
   Map_DBC_ComponentMask const &                         dirichlet_bc_component_mask,
   bool const                                            initialize_preconditioners)
 {
+  dealii::Timer timer;
+
+  timer_tree_setup->clear();
+  timer_tree_update->clear();
+
   this->data = data;
 
   this->grid = grid;
 
   this->multigrid_mappings = multigrid_mappings;
 
+  if(data.auto_tune)
+  {
+    AssertThrow(initialize_preconditioners,
+                dealii::ExcMessage("Auto-tuning the multigrid type requires an operator that "
+                                   "can be evaluated at setup (initialize_preconditioners)."));
+
+    this->data = auto_tune_multigrid_type(fe,
+                                          operator_is_singular,
+                                          dirichlet_bc,
+                                          dirichlet_bc_component_mask);
+  }
+
+  this->initialize_hierarchy(fe,
+                             operator_is_singular,
+                             dirichlet_bc,
+                             dirichlet_bc_component_mask,
+                             initialize_preconditioners);
+
+  timer_tree_setup->insert({"Setup"}, timer.wall_time());
+
+  if(this->data.print_memory_consumption)
+    this->print_memory_consumption();
+
+  memory_hierarchy.set(this->memory_consumption());
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_hierarchy(
+  dealii::FiniteElement<dim> const & fe,
+  bool const                         operator_is_singular,
+  Map_DBC const &                    dirichlet_bc,
+  Map_DBC_ComponentMask const &      dirichlet_bc_component_mask,
+  bool const                         initialize_preconditioners)
+{
   bool const is_dg = (fe.dofs_per_vertex == 0);
 
+  // the levels are filled via push_back()
+  level_info.clear();
+  p_levels.clear();
+
+  dealii::Timer timer;
+
   this->initialize_levels(fe.degree, is_dg);
 
   this->initialize_mapping();
 
+  timer_tree_setup->insert({"Setup", "Levels and mapping"}, timer.wall_time());
+
+  timer.restart();
   this->initialize_dof_handler_and_constraints(operator_is_singular,
                                                fe.n_components(),
                                                dirichlet_bc,
                                                dirichlet_bc_component_mask);
+  timer_tree_setup->insert({"Setup", "DoFs and constraints"}, timer.wall_time());
 
+  timer.restart();
   this->initialize_matrix_free_objects();
+  timer_tree_setup->insert({"Setup", "MatrixFree"}, timer.wall_time());
 
+  timer.restart();
   this->initialize_transfer_operators();
+  timer_tree_setup->insert({"Setup", "Transfer operators"}, timer.wall_time());
 
+  timer.restart();
   this->initialize_operators();
+  timer_tree_setup->insert({"Setup", "Operators"}, timer.wall_time());
 
+  timer.restart();
   this->initialize_smoothers(initialize_preconditioners);
+  timer_tree_setup->insert({"Setup", "Smoothers"}, timer.wall_time());
 
+  timer.restart();
   this->initialize_coarse_solver(operator_is_singular, initialize_preconditioners);
+  timer_tree_setup->insert({"Setup", "Coarse-grid solver"}, timer.wall_time());
 
   this->initialize_multigrid_algorithm();
 }
 
+template<int dim, typename Number, typename MultigridNumber>
+MultigridData
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::auto_tune_multigrid_type(
+  dealii::FiniteElement<dim> const & fe,
+  bool const                         operator_is_singular,
+  Map_DBC const &                    dirichlet_bc,
+  Map_DBC_ComponentMask const &      dirichlet_bc_component_mask)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  bool const is_dg = (fe.dofs_per_vertex == 0);
+
+  bool const h_levels_exist = grid->triangulation->n_global_levels() > 1;
+
+  std::vector<MultigridType> const types = {MultigridType::hMG,
+                                            MultigridType::chMG,
+                                            MultigridType::hcMG,
+                                            MultigridType::cMG,
+                                            MultigridType::pMG,
+                                            MultigridType::cpMG,
+                                            MultigridType::pcMG,
+                                            MultigridType::hpMG,
+                                            MultigridType::chpMG,
+                                            MultigridType::hcpMG,
+                                            MultigridType::hpcMG,
+                                            MultigridType::phMG,
+                                            MultigridType::cphMG,
+                                            MultigridType::pchMG,
+                                            MultigridType::phcMG};
+
+  std::vector<PSequenceType> const p_sequences = {PSequenceType::GoToOne,
+                                                  PSequenceType::DecreaseByOne,
+                                                  PSequenceType::Bisect};
+
+  // collect candidates applicable to the given discretization
+  std::vector<MultigridData> candidates;
+  for(MultigridType const type : types)
+  {
+    MultigridData candidate = this->data;
+    candidate.type          = type;
+
+    if(candidate.involves_c_transfer() and not is_dg)
+      continue;
+    if(candidate.involves_p_transfer() and fe.degree == 1)
+      continue;
+    if(candidate.involves_h_transfer() and not h_levels_exist)
+      continue;
+
+    if(candidate.involves_p_transfer())
+    {
+      for(PSequenceType const p_sequence : p_sequences)
+      {
+        candidate.p_sequence = p_sequence;
+        candidates.push_back(candidate);
+      }
+    }
+    else
+    {
+      candidates.push_back(candidate);
+    }
+  }
+
+  AssertThrow(not candidates.empty(),
+              dealii::ExcMessage("No multigrid hierarchy applicable for auto-tuning."));
+
+  pcout << std::endl << "Auto-tuning multigrid type:" << std::endl << std::endl;
+
+  MultigridData best      = candidates.front();
+  double        best_cost = std::numeric_limits<double>::max();
+
+  for(MultigridData const & candidate : candidates)
+  {
+    this->data = candidate;
+
+    this->initialize_hierarchy(
+      fe, operator_is_singular, dirichlet_bc, dirichlet_bc_component_mask, true);
+
+    std::pair<double, double> const rate_and_time =
+      measure_multigrid_cycles(candidate.auto_tune_n_cycles);
+
+    double const rate = rate_and_time.first;
+
+    // time needed to reduce the residual by a factor e, which is proportional to the
+    // time-to-tolerance for any tolerance
+    double const cost = (rate > 0.0 and rate < 1.0) ? rate_and_time.second / (-std::log(rate)) :
+                                                      std::numeric_limits<double>::max();
+
+    std::string name = Utilities::enum_to_string(candidate.type);
+    if(candidate.involves_p_transfer())
+      name += " (" + Utilities::enum_to_string(candidate.p_sequence) + ")";
+
+    pcout << "  " << std::setw(30) << std::left << name << std::scientific << std::setprecision(2)
+          << " rate = " << rate << ", time/cycle = " << rate_and_time.second << " s"
+          << std::endl;
+
+    if(cost < best_cost)
+    {
+      best_cost = cost;
+      best      = candidate;
+    }
+  }
+
+  pcout << std::endl << "Selected multigrid type: " << Utilities::enum_to_string(best.type);
+  if(best.involves_p_transfer())
+    pcout << " (" << Utilities::enum_to_string(best.p_sequence) << ")";
+  pcout << std::endl;
+
+  return best;
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+std::pair<double, double>
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::measure_multigrid_cycles(
+  unsigned int const n_cycles) const
+{
+  Operator const & fine_operator = *operators[operators.max_level()];
+
+  VectorTypeMG solution, residual, correction;
+  fine_operator.initialize_dof_vector(solution);
+  fine_operator.initialize_dof_vector(residual);
+  fine_operator.initialize_dof_vector(correction);
+
+  // deterministic pseudo-random initial guess containing all frequencies
+  unsigned int seed = 1 + dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  for(unsigned int i = 0; i < solution.locally_owned_size(); ++i)
+  {
+    seed                     = 1664525u * seed + 1013904223u;
+    solution.local_element(i) = static_cast<MultigridNumber>(seed) / 4294967296. - 0.5;
+  }
+
+  fine_operator.vmult(residual, solution);
+  double const norm_r_0 = residual.l2_norm();
+
+  dealii::Timer timer;
+  for(unsigned int i = 0; i < n_cycles; ++i)
+  {
+    multigrid_algorithm->vmult(correction, residual);
+    solution.add(-1.0, correction);
+    fine_operator.vmult(residual, solution);
+  }
+  double const time = dealii::Utilities::MPI::max(timer.wall_time(), mpi_comm);
+
+  double const norm_r = residual.l2_norm();
+
+  double const rate = (norm_r_0 > 0.0) ? std::pow(norm_r / norm_r_0, 1.0 / n_cycles) : 0.0;
+
+  return std::make_pair(rate, time / n_cycles);
+}
+
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_levels(
@@ -577,11 +797,16 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_matrix_fre
   matrix_free_objects.resize(0, get_number_of_levels() - 1);
 
   for_all_levels([&](unsigned int const level) {
+    dealii::Timer timer;
+
     matrix_free_data_objects[level] = std::make_shared<MatrixFreeData<dim, MultigridNumber>>();
     fill_matrix_free_data(*matrix_free_data_objects[level],
                           level,
                           level_info[level].dealii_tria_level());
 
+    SharedMemoryCommunicator::fill_additional_data(matrix_free_data_objects[level]->data,
+                                                   dof_handlers[level]->get_communicator());
+
     matrix_free_objects[level] = std::make_shared<dealii::MatrixFree<dim, MultigridNumber>>();
 
     matrix_free_objects[level]->reinit(get_mapping(level_info[level].h_level()),
@@ -589,16 +814,34 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_matrix_fre
                                        matrix_free_data_objects[level]->get_constraint_vector(),
                                        matrix_free_data_objects[level]->get_quadrature_vector(),
                                        matrix_free_data_objects[level]->data);
+
+    timer_tree_setup->insert({"Setup", "MatrixFree", "level " + std::to_string(level)},
+                             timer.wall_time());
   });
+
+  geometry_version_matrix_free = multigrid_mappings->get_geometry_version();
 }
 
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_matrix_free_objects()
 {
+  dealii::Timer timer;
+
   for_all_levels([&](unsigned int const level) {
     matrix_free_objects[level]->update_mapping(get_mapping(level_info[level].h_level()));
   });
+
+  geometry_version_matrix_free = multigrid_mappings->get_geometry_version();
+
+  timer_tree_update->insert({"Update", "MatrixFree"}, timer.wall_time());
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+bool
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::geometry_has_changed() const
+{
+  return geometry_version_matrix_free != multigrid_mappings->get_geometry_version();
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -607,8 +850,14 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_operators(
 {
   this->operators.resize(0, this->get_number_of_levels() - 1);
 
-  for_all_levels(
-    [&](unsigned int const level) { operators[level] = this->initialize_operator(level); });
+  for_all_levels([&](unsigned int const level) {
+    dealii::Timer timer;
+
+    operators[level] = this->initialize_operator(level);
+
+    timer_tree_setup->insert({"Setup", "Operators", "level " + std::to_string(level)},
+                             timer.wall_time());
+  });
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -637,7 +886,12 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoothers(
     this->smoothers.resize(1, get_number_of_levels() - 1);
 
   for_all_smoothing_levels([&](unsigned int const level) {
+    dealii::Timer timer;
+
     this->initialize_smoother(*this->operators[level], level, initialize_preconditioner);
+
+    timer_tree_setup->insert({"Setup", "Smoothers", "level " + std::to_string(level)},
+                             timer.wall_time());
   });
 }
 
@@ -652,7 +906,102 @@ template<int dim, typename Number, typename MultigridNumber>
 std::shared_ptr<TimerTree>
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_timings() const
 {
-  return multigrid_algorithm->get_timings();
+  std::shared_ptr<TimerTree> timings = std::make_shared<TimerTree>("Multigrid preconditioner");
+
+  timings->insert({"Multigrid preconditioner"}, timer_tree_setup);
+  timings->insert({"Multigrid preconditioner"}, timer_tree_update);
+  timings->insert({"Multigrid preconditioner"}, multigrid_algorithm->get_timings(), "Apply");
+
+  return timings;
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::print_memory_consumption() const
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  auto const to_MB = [&](std::size_t const bytes) {
+    return (double)dealii::Utilities::MPI::sum(bytes, mpi_comm) / 1.e6;
+  };
+
+  pcout << std::endl
+        << "Memory consumption of multigrid levels [MB]:" << std::endl
+        << std::endl
+        << "  level  h-level  degree  dg  MatrixFree   DoF vector   smoother     coarse solver"
+        << std::endl;
+
+  double total = 0.0;
+  for(unsigned int level = 0; level < get_number_of_levels(); ++level)
+  {
+    VectorTypeMG vector;
+    operators[level]->initialize_dof_vector(vector);
+
+    double const memory_matrix_free = to_MB(matrix_free_objects[level]->memory_consumption());
+    double const memory_vector      = to_MB(vector.locally_owned_size() * sizeof(MultigridNumber));
+    double const memory_smoother =
+      level > 0 ? to_MB(smoothers[level]->memory_consumption()) : 0.0;
+    double const memory_coarse =
+      level == 0 ? to_MB(coarse_grid_solver->memory_consumption()) : 0.0;
+
+    total += memory_matrix_free + memory_vector + memory_smoother + memory_coarse;
+
+    pcout << "  " << std::setw(5) << std::left << level << "  " << std::setw(7)
+          << level_info[level].h_level() << "  " << std::setw(6) << level_info[level].degree()
+          << "  " << std::setw(2) << level_info[level].is_dg() << std::scientific
+          << std::setprecision(3) << "  " << memory_matrix_free << "    " << memory_vector
+          << "    " << memory_smoother << "    " << memory_coarse << std::defaultfloat
+          << std::endl;
+  }
+
+  pcout << std::endl
+        << "  Total: " << std::scientific << std::setprecision(3) << total << " MB"
+        << std::defaultfloat << std::endl;
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+std::size_t
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::memory_consumption() const
+{
+  std::size_t bytes = 0;
+  for(unsigned int level = 0; level < get_number_of_levels(); ++level)
+  {
+    VectorTypeMG vector;
+    operators[level]->initialize_dof_vector(vector);
+
+    bytes += matrix_free_objects[level]->memory_consumption() +
+             3 * vector.locally_owned_size() * sizeof(MultigridNumber);
+
+    if(level > 0)
+      bytes += smoothers[level]->memory_consumption();
+    else
+      bytes += coarse_grid_solver->memory_consumption();
+  }
+
+  return bytes;
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::print_cycle_statistics() const
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  auto const & statistics = multigrid_algorithm->get_cycle_statistics();
+
+  pcout << std::endl << "Multigrid cycle statistics:" << std::endl << std::endl;
+  print_parameter(pcout, "Number of V-cycles", statistics.n_v_cycles);
+  print_parameter(pcout, "Number of F-cycles", statistics.n_f_cycles);
+  print_parameter(pcout, "Number of W-cycles", statistics.n_w_cycles);
+
+  if(data.cycle_data.cycle == MultigridCycle::Adaptive)
+  {
+    print_parameter(pcout, "Number of cycle switches", statistics.n_switches);
+    if(statistics.last_rate >= 0.0)
+      print_parameter(pcout, "Last measured residual reduction", statistics.last_rate);
+  }
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -679,6 +1028,50 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::solve(VectorType &
   return multigrid_algorithm->solve(dst, src);
 }
 
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::apply_full_multigrid(
+  VectorType &       dst,
+  VectorType const & src,
+  unsigned int const n_cycles_per_level) const
+{
+  AssertThrow(not this->update_needed,
+              dealii::ExcMessage(
+                "Multigrid preconditioner can not be applied because it needs to be updated."));
+
+  multigrid_algorithm->full_multigrid(dst, src, n_cycles_per_level);
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::vmult_multigrid_precision(
+  VectorTypeMG &       dst,
+  VectorTypeMG const & src) const
+{
+  AssertThrow(not this->update_needed,
+              dealii::ExcMessage(
+                "Multigrid preconditioner can not be applied because it needs to be updated."));
+
+  multigrid_algorithm->vmult(dst, src);
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::apply_fine_level_operator(
+  VectorTypeMG &       dst,
+  VectorTypeMG const & src) const
+{
+  this->operators[this->operators.max_level()]->vmult(dst, src);
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+void
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_dof_vector_fine_level(
+  VectorTypeMG & vector) const
+{
+  this->operators[this->operators.max_level()]->initialize_dof_vector(vector);
+}
+
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::apply_smoother_on_fine_level(
@@ -712,6 +1105,9 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoother(
       smoother_data.degree          = data.smoother_data.iterations;
       smoother_data.iterations_eigenvalue_estimation =
         data.smoother_data.iterations_eigenvalue_estimation;
+      smoother_data.n_updates_reuse_eigenvalues = data.smoother_data.n_updates_reuse_eigenvalues;
+      smoother_data.eigenvalue_reestimation_tolerance =
+        data.smoother_data.eigenvalue_reestimation_tolerance;
 
       std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
       smoother->setup(mg_operator, initialize_preconditioner, smoother_data);
@@ -768,14 +1164,25 @@ template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_smoothers()
 {
-  for_all_smoothing_levels([&](unsigned int const level) { smoothers[level]->update(); });
+  for_all_smoothing_levels([&](unsigned int const level) {
+    dealii::Timer timer;
+
+    smoothers[level]->update();
+
+    timer_tree_update->insert({"Update", "Smoothers", "level " + std::to_string(level)},
+                              timer.wall_time());
+  });
 }
 
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_coarse_solver()
 {
+  dealii::Timer timer;
+
   coarse_grid_solver->update();
+
+  timer_tree_update->insert({"Update", "Coarse-grid solver"}, timer.wall_time());
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -837,6 +1244,15 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_coarse_sol
 
       break;
     }
+    case MultigridCoarseGridSolver::Direct:
+    {
+      coarse_grid_solver =
+        std::make_shared<MGCoarseDirect<Operator>>(coarse_operator,
+                                                   initialize_preconditioners,
+                                                   data.coarse_problem.direct_solver,
+                                                   operator_is_singular);
+      break;
+    }
     default:
     {
       AssertThrow(false, dealii::ExcMessage("Unknown coarse-grid solver specified."));
@@ -867,8 +1283,14 @@ template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_multigrid_algorithm()
 {
-  multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    operators, *coarse_grid_solver, *transfers, smoothers, mpi_comm);
+  multigrid_algorithm =
+    std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(operators,
+                                                                           *coarse_grid_solver,
+                                                                           *transfers,
+                                                                           smoothers,
+                                                                           mpi_comm,
+                                                                           data.cycle_data,
+                                                                           data.detailed_timings);
 }
 
 template class MultigridPreconditionerBase<2, float>;
@@ -38,6 +38,7 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfer.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/utilities/memory_report.h>
 
 // forward declarations
 namespace ExaDG
@@ -126,6 +127,29 @@ public:
   unsigned int
   solve(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Full multigrid with n_cycles_per_level V-cycles per level, e.g. to compute an initial guess
+   * for the outer Krylov solver, see MultigridAlgorithm::full_multigrid().
+   */
+  void
+  apply_full_multigrid(VectorType &       dst,
+                       VectorType const & src,
+                       unsigned int const n_cycles_per_level) const;
+
+  /*
+   * Interface in the precision of the multigrid levels (MultigridNumber), e.g. for Krylov solvers
+   * running entirely in reduced precision: the multigrid cycle, the operator of the fine level,
+   * and the initialization of vectors of the fine level.
+   */
+  void
+  vmult_multigrid_precision(VectorTypeMG & dst, VectorTypeMG const & src) const;
+
+  void
+  apply_fine_level_operator(VectorTypeMG & dst, VectorTypeMG const & src) const;
+
+  void
+  initialize_dof_vector_fine_level(VectorTypeMG & vector) const;
+
   /*
    * This function applies the smoother on the fine level as a means to test the
    * multigrid ingredients.
@@ -133,9 +157,38 @@ public:
   virtual void
   apply_smoother_on_fine_level(VectorTypeMG & dst, VectorTypeMG const & src) const;
 
+  /*
+   * Returns the timings of the setup (per level for the matrix-free objects, operators, and
+   * smoothers including their preconditioners, e.g. the inverse diagonal, as well as for the
+   * transfer operators and the coarse-grid solver), of the updates, and of the applications of
+   * the multigrid cycle (per level and component if MultigridData::detailed_timings is set).
+   */
   std::shared_ptr<TimerTree>
   get_timings() const override;
 
+  /*
+   * Prints the memory consumption (summed over all MPI processes) of each multigrid level, split
+   * into matrix-free data (geometry and index data), one dof vector, the smoother, and the
+   * coarse-grid solver (e.g. the AMG matrix). The vectors of the multigrid algorithm hold three dof
+   * vectors per level.
+   */
+  void
+  print_memory_consumption() const;
+
+  /*
+   * Memory consumption of the multigrid hierarchy on the current process in bytes, summed over
+   * all levels and including the three dof vectors per level of the multigrid algorithm.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /*
+   * Prints the number of multigrid cycles applied per cycle type and, for the adaptive cycle, the
+   * number of switches between cycle types and the latest measured residual reduction.
+   */
+  void
+  print_cycle_statistics() const;
+
 protected:
   /*
    * Initialization of mapping depending on multigrid transfer type. Note that the mapping needs to
@@ -157,6 +210,15 @@ protected:
   void
   update_matrix_free_objects();
 
+  /*
+   * Returns true if the mesh has been deformed since the matrix-free objects have been initialized
+   * or updated the last time. Derived classes use this function to skip the update of the
+   * geometry-dependent data of all multigrid levels if the preconditioner is updated several
+   * times for the same mesh configuration.
+   */
+  bool
+  geometry_has_changed() const;
+
   /**
    * This function updates the smoother for all smoothing levels.
    * The prerequisite to call this function is that the multigrid operators have been updated.
@@ -253,6 +315,10 @@ protected:
 
   std::shared_ptr<MultigridMappings<dim, Number>> multigrid_mappings;
 
+  // geometry version of multigrid_mappings at the last (re-)initialization of the matrix-free
+  // objects
+  unsigned int geometry_version_matrix_free;
+
   dealii::MGLevelObject<std::shared_ptr<dealii::DoFHandler<dim> const>>              dof_handlers;
   dealii::MGLevelObject<std::shared_ptr<dealii::AffineConstraints<MultigridNumber>>> constraints;
 
@@ -268,6 +334,36 @@ protected:
   std::vector<MGLevelInfo> level_info;
 
 private:
+  /**
+   * Sets up the whole multigrid hierarchy (levels, dof handlers, matrix-free objects, transfer
+   * operators, operators, smoothers, coarse-grid solver) for the current multigrid data.
+   */
+  void
+  initialize_hierarchy(dealii::FiniteElement<dim> const & fe,
+                       bool const                         operator_is_singular,
+                       Map_DBC const &                    dirichlet_bc,
+                       Map_DBC_ComponentMask const &      dirichlet_bc_component_mask,
+                       bool const                         initialize_preconditioners);
+
+  /**
+   * Selects the multigrid type and p-sequence by setting up all applicable hierarchies and
+   * measuring the convergence rate and the wall time of a few multigrid cycles. The estimated
+   * time-to-tolerance of a candidate is proportional to t_cycle / (-log(rate)), independently of
+   * the tolerance. Returns the multigrid data of the fastest candidate.
+   */
+  MultigridData
+  auto_tune_multigrid_type(dealii::FiniteElement<dim> const & fe,
+                           bool const                         operator_is_singular,
+                           Map_DBC const &                    dirichlet_bc,
+                           Map_DBC_ComponentMask const &      dirichlet_bc_component_mask);
+
+  /**
+   * Applies multigrid cycles x <- x + P^{-1}(b - A x) with b = 0 to a random initial guess on the
+   * finest level. Returns the average residual reduction per cycle and the wall time per cycle.
+   */
+  std::pair<double, double>
+  measure_multigrid_cycles(unsigned int const n_cycles) const;
+
   /**
    * Initializes multigrid levels according to coarsening strategy (h-/p-/hp-/ph-MG).
    */
@@ -335,6 +431,12 @@ private:
   std::shared_ptr<CoarseGridSolverBase<Operator>> coarse_grid_solver;
 
   std::shared_ptr<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>> multigrid_algorithm;
+
+  std::shared_ptr<TimerTree> timer_tree_setup;
+  std::shared_ptr<TimerTree> timer_tree_update;
+
+  // memory of the multigrid hierarchy, see MemoryReport
+  MemoryReport::Entry memory_hierarchy{MemoryCategory::Multigrid};
 };
 } // namespace ExaDG
 
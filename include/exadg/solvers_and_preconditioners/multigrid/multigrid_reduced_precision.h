@@ -0,0 +1,110 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_MULTIGRID_REDUCED_PRECISION_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_MULTIGRID_REDUCED_PRECISION_H_
+
+// C/C++
+#include <memory>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+/*
+ * Operator and preconditioner in the precision of the multigrid levels, provided by the fine
+ * level of a multigrid preconditioner of type MultigridPreconditionerBase. Together, they allow to
+ * run Krylov solvers entirely in reduced precision, e.g. as inner solver of
+ * Krylov::SolverIterativeRefinement.
+ */
+template<typename Multigrid>
+class MultigridFineLevelOperator
+{
+public:
+  typedef typename Multigrid::MultigridNumber                    value_type;
+  typedef dealii::LinearAlgebra::distributed::Vector<value_type> VectorType;
+
+  MultigridFineLevelOperator(Multigrid const & multigrid) : multigrid(multigrid)
+  {
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    multigrid.initialize_dof_vector_fine_level(vector);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    multigrid.apply_fine_level_operator(dst, src);
+  }
+
+private:
+  Multigrid const & multigrid;
+};
+
+template<typename Multigrid>
+class MultigridReducedPrecisionPreconditioner
+{
+public:
+  typedef typename Multigrid::MultigridNumber                    value_type;
+  typedef dealii::LinearAlgebra::distributed::Vector<value_type> VectorType;
+
+  MultigridReducedPrecisionPreconditioner(Multigrid & multigrid) : multigrid(multigrid)
+  {
+  }
+
+  bool
+  needs_update() const
+  {
+    return multigrid.needs_update();
+  }
+
+  void
+  update()
+  {
+    multigrid.update();
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    multigrid.vmult_multigrid_precision(dst, src);
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const
+  {
+    return multigrid.get_timings();
+  }
+
+private:
+  Multigrid & multigrid;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_MULTIGRID_REDUCED_PRECISION_H_ */
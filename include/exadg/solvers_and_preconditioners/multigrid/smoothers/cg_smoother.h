@@ -29,6 +29,7 @@
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/fast_diagonalization_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 
 namespace ExaDG
@@ -86,6 +87,11 @@ public:
       preconditioner =
         new BlockJacobiPreconditioner<Operator>(*underlying_operator, initialize_preconditioner);
     }
+    else if(data.preconditioner == PreconditionerSmoother::FastDiagonalization)
+    {
+      preconditioner = new FastDiagonalizationPreconditioner<Operator>(*underlying_operator,
+                                                                       initialize_preconditioner);
+    }
     else
     {
       AssertThrow(data.preconditioner == PreconditionerSmoother::None,
@@ -22,7 +22,11 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVSMOOTHER_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVSMOOTHER_H_
 
+// C++
+#include <cmath>
+
 // deal.II
+#include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/precondition.h>
 
 // ExaDG
@@ -30,23 +34,39 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/additive_schwarz_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
-#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/fast_diagonalization_preconditioner.h>
 
 namespace ExaDG
 {
+/*
+ * Chebyshev smoother based on dealii::PreconditionChebyshev. For point Jacobi, the inverse
+ * diagonal is passed as dealii::DiagonalMatrix, for which deal.II merges the Chebyshev
+ * recurrence and the diagonal scaling into a single vector update per step. Moreover, the
+ * operator provides a vmult() with operations before/after the matrix-free loop, so that these
+ * vector updates are performed inside the loop on the index ranges just processed by the
+ * operator, i.e., each smoothing step touches the level vectors only once.
+ */
 template<typename Operator, typename VectorType>
 class ChebyshevSmoother : public SmootherBase<VectorType>
 {
 public:
-  typedef dealii::PreconditionChebyshev<Operator, VectorType, JacobiPreconditioner<Operator>>
+  typedef dealii::PreconditionChebyshev<Operator, VectorType, dealii::DiagonalMatrix<VectorType>>
     ChebyshevPointJacobi;
   typedef dealii::PreconditionChebyshev<Operator, VectorType, BlockJacobiPreconditioner<Operator>>
     ChebyshevBlockJacobi;
   typedef dealii::
     PreconditionChebyshev<Operator, VectorType, AdditiveSchwarzPreconditioner<Operator>>
       ChebyshevAdditiveSchwarz;
+  typedef dealii::
+    PreconditionChebyshev<Operator, VectorType, FastDiagonalizationPreconditioner<Operator>>
+      ChebyshevFastDiagonalization;
 
-  ChebyshevSmoother() : underlying_operator(nullptr)
+  ChebyshevSmoother()
+    : underlying_operator(nullptr),
+      eigenvalues_are_cached(false),
+      cached_max_eigenvalue(1.0),
+      cached_norm_inverse_diagonal(0.0),
+      n_updates_since_estimation(0)
   {
   }
 
@@ -59,7 +79,9 @@ public:
       : preconditioner(PreconditionerSmoother::PointJacobi),
         smoothing_range(20),
         degree(5),
-        iterations_eigenvalue_estimation(20)
+        iterations_eigenvalue_estimation(20),
+        n_updates_reuse_eigenvalues(0),
+        eigenvalue_reestimation_tolerance(0.1)
     {
     }
 
@@ -74,6 +96,12 @@ public:
 
     // number of CG iterations for estimation of eigenvalues
     unsigned int iterations_eigenvalue_estimation;
+
+    // number of updates reusing the cached eigenvalue estimate, see SmootherData
+    unsigned int n_updates_reuse_eigenvalues;
+
+    // relative change of the inverse diagonal triggering a re-estimation, see SmootherData
+    double eigenvalue_reestimation_tolerance;
   };
 
   void
@@ -91,6 +119,10 @@ public:
     {
       chebyshev_additive_schwarz->vmult(dst, src);
     }
+    else if(data.preconditioner == PreconditionerSmoother::FastDiagonalization)
+    {
+      chebyshev_fast_diagonalization->vmult(dst, src);
+    }
     else
     {
       AssertThrow(false, dealii::ExcNotImplemented());
@@ -112,6 +144,10 @@ public:
     {
       chebyshev_additive_schwarz->step(dst, src);
     }
+    else if(data.preconditioner == PreconditionerSmoother::FastDiagonalization)
+    {
+      chebyshev_fast_diagonalization->step(dst, src);
+    }
     else
     {
       AssertThrow(false, dealii::ExcNotImplemented());
@@ -126,19 +162,25 @@ public:
 
     if(data.preconditioner == PreconditionerSmoother::PointJacobi)
     {
-      preconditioner_point_jacobi->update();
-      chebyshev_point_jacobi->initialize(*underlying_operator, additional_data_point);
+      underlying_operator->calculate_inverse_diagonal(preconditioner_point_jacobi->get_vector());
+      initialize_chebyshev(*chebyshev_point_jacobi,
+                           additional_data_point,
+                           preconditioner_point_jacobi->get_vector().l2_norm());
     }
     else if(data.preconditioner == PreconditionerSmoother::BlockJacobi)
     {
       preconditioner_block_jacobi->update();
-      chebyshev_block_jacobi->initialize(*underlying_operator, additional_data_block);
+      initialize_chebyshev(*chebyshev_block_jacobi, additional_data_block);
     }
     else if(data.preconditioner == PreconditionerSmoother::AdditiveSchwarz)
     {
       preconditioner_additive_schwarz->update();
-      chebyshev_additive_schwarz->initialize(*underlying_operator,
-                                             additional_data_additive_schwarz);
+      initialize_chebyshev(*chebyshev_additive_schwarz, additional_data_additive_schwarz);
+    }
+    else if(data.preconditioner == PreconditionerSmoother::FastDiagonalization)
+    {
+      preconditioner_fast_diagonalization->update();
+      initialize_chebyshev(*chebyshev_fast_diagonalization, additional_data_fast_diagonalization);
     }
     else
     {
@@ -146,6 +188,15 @@ public:
     }
   }
 
+  std::size_t
+  memory_consumption() const final
+  {
+    if(preconditioner_point_jacobi.get() != nullptr)
+      return preconditioner_point_jacobi->get_vector().memory_consumption();
+    else
+      return 0;
+  }
+
   void
   setup(Operator const &       operator_in,
         bool const             initialize_preconditioner,
@@ -156,9 +207,10 @@ public:
 
     if(data.preconditioner == PreconditionerSmoother::PointJacobi)
     {
-      preconditioner_point_jacobi =
-        std::make_shared<JacobiPreconditioner<Operator>>(*underlying_operator,
-                                                         initialize_preconditioner);
+      preconditioner_point_jacobi = std::make_shared<dealii::DiagonalMatrix<VectorType>>();
+      underlying_operator->initialize_dof_vector(preconditioner_point_jacobi->get_vector());
+      if(initialize_preconditioner)
+        underlying_operator->calculate_inverse_diagonal(preconditioner_point_jacobi->get_vector());
 
       additional_data_point.preconditioner      = preconditioner_point_jacobi;
       additional_data_point.smoothing_range     = data.smoothing_range;
@@ -168,7 +220,9 @@ public:
       chebyshev_point_jacobi = std::make_shared<ChebyshevPointJacobi>();
 
       if(initialize_preconditioner)
-        chebyshev_point_jacobi->initialize(*underlying_operator, additional_data_point);
+        initialize_chebyshev(*chebyshev_point_jacobi,
+                             additional_data_point,
+                             preconditioner_point_jacobi->get_vector().l2_norm());
     }
     else if(data.preconditioner == PreconditionerSmoother::BlockJacobi)
     {
@@ -184,7 +238,7 @@ public:
       chebyshev_block_jacobi = std::make_shared<ChebyshevBlockJacobi>();
 
       if(initialize_preconditioner)
-        chebyshev_block_jacobi->initialize(*underlying_operator, additional_data_block);
+        initialize_chebyshev(*chebyshev_block_jacobi, additional_data_block);
     }
     else if(data.preconditioner == PreconditionerSmoother::AdditiveSchwarz)
     {
@@ -200,8 +254,25 @@ public:
       chebyshev_additive_schwarz = std::make_shared<ChebyshevAdditiveSchwarz>();
 
       if(initialize_preconditioner)
-        chebyshev_additive_schwarz->initialize(*underlying_operator,
-                                               additional_data_additive_schwarz);
+        initialize_chebyshev(*chebyshev_additive_schwarz, additional_data_additive_schwarz);
+    }
+    else if(data.preconditioner == PreconditionerSmoother::FastDiagonalization)
+    {
+      preconditioner_fast_diagonalization =
+        std::make_shared<FastDiagonalizationPreconditioner<Operator>>(*underlying_operator,
+                                                                      initialize_preconditioner);
+
+      additional_data_fast_diagonalization.preconditioner  = preconditioner_fast_diagonalization;
+      additional_data_fast_diagonalization.smoothing_range = data.smoothing_range;
+      additional_data_fast_diagonalization.degree          = data.degree;
+      additional_data_fast_diagonalization.eig_cg_n_iterations =
+        data.iterations_eigenvalue_estimation;
+
+      chebyshev_fast_diagonalization = std::make_shared<ChebyshevFastDiagonalization>();
+
+      if(initialize_preconditioner)
+        initialize_chebyshev(*chebyshev_fast_diagonalization,
+                             additional_data_fast_diagonalization);
     }
     else
     {
@@ -210,20 +281,78 @@ public:
   }
 
 private:
+  /*
+   * Initializes the Chebyshev iteration, where the eigenvalues are either estimated by CG
+   * iterations (and cached if n_updates_reuse_eigenvalues > 0) or taken from the cache. The
+   * argument norm_inverse_diagonal is only available for point Jacobi and is used to detect
+   * changes of the operator, a negative value disables this check.
+   */
+  template<typename Chebyshev>
+  void
+  initialize_chebyshev(Chebyshev &                          chebyshev,
+                       typename Chebyshev::AdditionalData & additional_data,
+                       double const                         norm_inverse_diagonal = -1.0)
+  {
+    bool const reuse_eigenvalues =
+      eigenvalues_are_cached and n_updates_since_estimation < data.n_updates_reuse_eigenvalues and
+      (norm_inverse_diagonal < 0.0 or
+       std::abs(norm_inverse_diagonal - cached_norm_inverse_diagonal) <=
+         data.eigenvalue_reestimation_tolerance * cached_norm_inverse_diagonal);
+
+    if(reuse_eigenvalues)
+    {
+      // deal.II uses max_eigenvalue and smoothing_range if no CG iterations are performed
+      additional_data.eig_cg_n_iterations = 0;
+      additional_data.max_eigenvalue      = cached_max_eigenvalue;
+
+      chebyshev.initialize(*underlying_operator, additional_data);
+
+      ++n_updates_since_estimation;
+    }
+    else
+    {
+      additional_data.eig_cg_n_iterations = data.iterations_eigenvalue_estimation;
+
+      chebyshev.initialize(*underlying_operator, additional_data);
+
+      if(data.n_updates_reuse_eigenvalues > 0)
+      {
+        // estimate the eigenvalues now instead of in the first application of the smoother, the
+        // vector only determines the parallel layout
+        VectorType vector;
+        underlying_operator->initialize_dof_vector(vector);
+        auto const eigenvalue_information = chebyshev.estimate_eigenvalues(vector);
+
+        cached_max_eigenvalue        = eigenvalue_information.max_eigenvalue_estimate;
+        cached_norm_inverse_diagonal = norm_inverse_diagonal;
+        eigenvalues_are_cached       = true;
+        n_updates_since_estimation   = 0;
+      }
+    }
+  }
+
   Operator const * underlying_operator;
   AdditionalData   data;
 
-  std::shared_ptr<ChebyshevPointJacobi>     chebyshev_point_jacobi;
-  std::shared_ptr<ChebyshevBlockJacobi>     chebyshev_block_jacobi;
-  std::shared_ptr<ChebyshevAdditiveSchwarz> chebyshev_additive_schwarz;
+  bool         eigenvalues_are_cached;
+  double       cached_max_eigenvalue;
+  double       cached_norm_inverse_diagonal;
+  unsigned int n_updates_since_estimation;
+
+  std::shared_ptr<ChebyshevPointJacobi>         chebyshev_point_jacobi;
+  std::shared_ptr<ChebyshevBlockJacobi>         chebyshev_block_jacobi;
+  std::shared_ptr<ChebyshevAdditiveSchwarz>     chebyshev_additive_schwarz;
+  std::shared_ptr<ChebyshevFastDiagonalization> chebyshev_fast_diagonalization;
 
-  std::shared_ptr<JacobiPreconditioner<Operator>>          preconditioner_point_jacobi;
-  std::shared_ptr<BlockJacobiPreconditioner<Operator>>     preconditioner_block_jacobi;
-  std::shared_ptr<AdditiveSchwarzPreconditioner<Operator>> preconditioner_additive_schwarz;
+  std::shared_ptr<dealii::DiagonalMatrix<VectorType>>          preconditioner_point_jacobi;
+  std::shared_ptr<BlockJacobiPreconditioner<Operator>>         preconditioner_block_jacobi;
+  std::shared_ptr<AdditiveSchwarzPreconditioner<Operator>>     preconditioner_additive_schwarz;
+  std::shared_ptr<FastDiagonalizationPreconditioner<Operator>> preconditioner_fast_diagonalization;
 
-  typename ChebyshevPointJacobi::AdditionalData     additional_data_point;
-  typename ChebyshevBlockJacobi::AdditionalData     additional_data_block;
-  typename ChebyshevAdditiveSchwarz::AdditionalData additional_data_additive_schwarz;
+  typename ChebyshevPointJacobi::AdditionalData         additional_data_point;
+  typename ChebyshevBlockJacobi::AdditionalData         additional_data_block;
+  typename ChebyshevAdditiveSchwarz::AdditionalData     additional_data_additive_schwarz;
+  typename ChebyshevFastDiagonalization::AdditionalData additional_data_fast_diagonalization;
 };
 
 } // namespace ExaDG
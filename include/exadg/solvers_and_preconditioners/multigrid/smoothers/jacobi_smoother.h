@@ -26,6 +26,7 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/additive_schwarz_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/fast_diagonalization_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 
 namespace ExaDG
@@ -95,10 +96,14 @@ public:
       preconditioner = new AdditiveSchwarzPreconditioner<Operator>(*underlying_operator,
                                                                    initialize_preconditioner);
     }
+    else if(data.preconditioner == PreconditionerSmoother::FastDiagonalization)
+    {
+      preconditioner = new FastDiagonalizationPreconditioner<Operator>(*underlying_operator,
+                                                                       initialize_preconditioner);
+    }
     else
     {
-      AssertThrow(data.preconditioner == PreconditionerSmoother::PointJacobi or
-                    data.preconditioner == PreconditionerSmoother::BlockJacobi,
+      AssertThrow(false,
                   dealii::ExcMessage(
                     "Specified type of preconditioner for Jacobi smoother not implemented."));
     }
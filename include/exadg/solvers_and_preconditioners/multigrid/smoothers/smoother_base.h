@@ -22,6 +22,9 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_SMOOTHER_BASE_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_SMOOTHER_BASE_H_
 
+// C/C++
+#include <cstddef>
+
 namespace ExaDG
 {
 template<typename VectorType>
@@ -40,6 +43,16 @@ public:
 
   virtual void
   update() = 0;
+
+  /*
+   * Memory consumption of the data owned by the smoother (in bytes). Data stored by the underlying
+   * operator, e.g. block-Jacobi matrices, is not included.
+   */
+  virtual std::size_t
+  memory_consumption() const
+  {
+    return 0;
+  }
 };
 
 } // namespace ExaDG
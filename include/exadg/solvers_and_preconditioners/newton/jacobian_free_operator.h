@@ -0,0 +1,144 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_JACOBIAN_FREE_OPERATOR_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_JACOBIAN_FREE_OPERATOR_H_
+
+// C/C++
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+namespace ExaDG
+{
+namespace Newton
+{
+/*
+ * Detects whether the linear operator of the Newton solver supports the Jacobian-free mode, i.e.,
+ * whether it provides a function set_jacobian_free_linearization(solution, rhs).
+ */
+template<typename LinearOperator, typename VectorType, typename = void>
+struct HasJacobianFreeLinearization : std::false_type
+{
+};
+
+template<typename LinearOperator, typename VectorType>
+struct HasJacobianFreeLinearization<
+  LinearOperator,
+  VectorType,
+  std::void_t<decltype(std::declval<LinearOperator &>().set_jacobian_free_linearization(
+    std::declval<VectorType const &>(),
+    std::declval<VectorType const &>()))>> : std::true_type
+{
+};
+
+/*
+ * Application of the Jacobian of a nonlinear residual F(u) via the finite-difference directional
+ * derivative
+ *
+ *   J(u) v ≈ (F(u + epsilon v) - F(u)) / epsilon,
+ *
+ * with epsilon = sqrt(machine epsilon) (1 + ||u||) / ||v||, so that linear operators of
+ * Jacobian-free Newton-Krylov methods only need to evaluate the nonlinear residual. Each
+ * application costs one evaluation of the nonlinear residual.
+ */
+template<typename VectorType, typename NonlinearOperator>
+class JacobianFreeOperator
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+public:
+  JacobianFreeOperator()
+    : nonlinear_operator(nullptr), solution(nullptr), rhs(nullptr), norm_solution(0.0)
+  {
+  }
+
+  void
+  initialize(NonlinearOperator const & nonlinear_operator_in)
+  {
+    nonlinear_operator = &nonlinear_operator_in;
+  }
+
+  bool
+  is_active() const
+  {
+    return solution != nullptr;
+  }
+
+  /*
+   * Sets the linearization point u and the right-hand side -F(u) of the linearized problem, which
+   * have to remain valid as long as the operator is applied.
+   */
+  void
+  set_linearization_point(VectorType const & solution_in, VectorType const & rhs_in)
+  {
+    AssertThrow(nonlinear_operator != nullptr,
+                dealii::ExcMessage("JacobianFreeOperator has not been initialized."));
+
+    solution      = &solution_in;
+    rhs           = &rhs_in;
+    norm_solution = solution->l2_norm();
+
+    perturbed_solution.reinit(solution_in, true);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    double const norm_src = src.l2_norm();
+
+    if(norm_src == 0.0)
+    {
+      dst = 0.0;
+      return;
+    }
+
+    double const epsilon =
+      std::sqrt(std::numeric_limits<Number>::epsilon()) * (1.0 + norm_solution) / norm_src;
+
+    perturbed_solution = *solution;
+    perturbed_solution.add(epsilon, src);
+
+    // dst = (F(u + epsilon v) - F(u)) / epsilon, where rhs = -F(u)
+    nonlinear_operator->evaluate_residual(dst, perturbed_solution);
+    dst.add(1.0, *rhs);
+    dst *= 1.0 / epsilon;
+  }
+
+private:
+  NonlinearOperator const * nonlinear_operator;
+
+  VectorType const * solution;
+  VectorType const * rhs;
+  double             norm_solution;
+
+  VectorType mutable perturbed_solution;
+};
+
+} // namespace Newton
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_JACOBIAN_FREE_OPERATOR_H_ */
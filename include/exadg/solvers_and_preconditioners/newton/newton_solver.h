@@ -22,16 +22,43 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_H_
 
+// C/C++
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
 // deal.II
 #include <deal.II/base/exceptions.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/newton/jacobian_free_operator.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
+#include <exadg/solvers_and_preconditioners/utilities/vector_pool.h>
 
 namespace ExaDG
 {
 namespace Newton
 {
+/*
+ * Detects whether the nonlinear operator of the Newton solver provides a cheaper evaluation of the
+ * residual in reduced precision, i.e., whether it provides a function
+ * evaluate_residual_reduced_precision(dst, src).
+ */
+template<typename NonlinearOperator, typename VectorType, typename = void>
+struct HasReducedPrecisionResidual : std::false_type
+{
+};
+
+template<typename NonlinearOperator, typename VectorType>
+struct HasReducedPrecisionResidual<
+  NonlinearOperator,
+  VectorType,
+  std::void_t<decltype(std::declval<NonlinearOperator &>().evaluate_residual_reduced_precision(
+    std::declval<VectorType &>(),
+    std::declval<VectorType const &>()))>> : std::true_type
+{
+};
+
 template<typename VectorType,
          typename NonlinearOperator,
          typename LinearOperator,
@@ -46,8 +73,18 @@ public:
     : solver_data(solver_data_in),
       nonlinear_operator(nonlinear_operator_in),
       linear_operator(linear_operator_in),
-      linear_solver(linear_solver_in)
+      linear_solver(linear_solver_in),
+      linear_iterations_last_update(0),
+      linear_iterations_last_solve(0)
   {
+    AssertThrow(not solver_data.jacobian_free or
+                  HasJacobianFreeLinearization<LinearOperator, VectorType>::value,
+                dealii::ExcMessage("The linear operator does not support the Jacobian-free mode."));
+
+    AssertThrow(not solver_data.reduced_precision_line_search or
+                  HasReducedPrecisionResidual<NonlinearOperator, VectorType>::value,
+                dealii::ExcMessage("The nonlinear operator does not support the evaluation of "
+                                   "the residual in reduced precision."));
   }
 
   std::tuple<unsigned int /* Newton iter */, unsigned int /* accumulated linear iter */>
@@ -55,10 +92,12 @@ public:
   {
     unsigned int newton_iterations = 0, linear_iterations = 0;
 
-    VectorType residual, increment, temporary;
-    residual.reinit(solution);
-    increment.reinit(solution);
-    temporary.reinit(solution);
+    // the vectors are taken from a pool in order to avoid allocations in every time step
+    TemporaryVector<VectorType> residual_vector(solution), increment_vector(solution),
+      temporary_vector(solution);
+    VectorType & residual  = *residual_vector;
+    VectorType & increment = *increment_vector;
+    VectorType & temporary = *temporary_vector;
 
     // evaluate residual using initial guess of solution
     nonlinear_operator.evaluate_residual(residual, solution);
@@ -75,12 +114,31 @@ public:
       // multiply by -1.0 since the linearized problem is "linear_operator * increment = - residual"
       residual *= -1.0;
 
-      // update linear operator (set linearization point)
-      linear_operator.set_solution_linearization(solution);
-
       // determine whether to update the operator/preconditioner of the linearized problem
-      bool const update_now =
-        update.do_update and (newton_iterations % update.update_every_newton_iter == 0);
+      bool update_now = false;
+      if(update.update_adaptively)
+      {
+        update_now = update.do_update and
+                     (linear_iterations_last_update == 0 or
+                      linear_iterations_last_solve >
+                        update.linear_iterations_increase_factor * linear_iterations_last_update);
+      }
+      else
+      {
+        update_now =
+          update.do_update and (newton_iterations % update.update_every_newton_iter == 0);
+      }
+
+      // update linear operator (set linearization point), where the linearization is only needed
+      // for the preconditioner in the Jacobian-free case
+      if(solver_data.jacobian_free == false or update_now)
+        linear_operator.set_solution_linearization(solution);
+
+      if constexpr(HasJacobianFreeLinearization<LinearOperator, VectorType>::value)
+      {
+        if(solver_data.jacobian_free)
+          linear_operator.set_jacobian_free_linearization(solution, residual);
+      }
 
       // update the preconditioner
       linear_solver.update_preconditioner(update_now);
@@ -88,20 +146,35 @@ public:
       // solve linear problem
       unsigned int const n_iter_linear = linear_solver.solve(increment, residual);
 
+      linear_iterations_last_solve = n_iter_linear;
+      if(update_now)
+        linear_iterations_last_update = std::max(n_iter_linear, 1U);
+
       // damped Newton scheme
       double             omega         = 1.0; // damping factor (begin with 1)
       double             norm_r_damp   = 1.0; // norm of residual using temporary solution
       unsigned int       n_iter_damp   = 0;   // counts iteration of damping scheme
       unsigned int const max_iter_damp = 10;  // max iterations of damping scheme
       double const       tau           = 0.5; // a parameter (has to be smaller than 1)
+      bool               accepted      = false;
+
+      // The undamped step is evaluated in full precision. Once it has been rejected, the trial
+      // steps are screened in reduced precision and only the accepted step is re-evaluated in
+      // full precision. If the screening turns out to be too optimistic, the line search continues
+      // in full precision.
+      bool screening_possible = solver_data.reduced_precision_line_search;
+      bool screen_trial       = false;
       do
       {
         // add increment to solution vector but scale by a factor omega <= 1
         temporary = solution;
         temporary.add(omega, increment);
 
+        // the last trial step is always evaluated in full precision
+        screen_trial = screen_trial and n_iter_damp + 1 < max_iter_damp;
+
         // evaluate residual using the temporary solution
-        nonlinear_operator.evaluate_residual(residual, temporary);
+        evaluate_trial_residual(residual, temporary, screen_trial);
 
         // calculate norm of residual (for temporary solution)
         norm_r_damp = residual.l2_norm();
@@ -111,14 +184,28 @@ public:
 
         // increment counter
         n_iter_damp++;
-      } while(norm_r_damp >= (1.0 - tau * omega) * norm_r and n_iter_damp < max_iter_damp);
 
-      AssertThrow(norm_r_damp < (1.0 - tau * omega) * norm_r,
+        accepted = norm_r_damp < (1.0 - tau * omega) * norm_r;
+
+        if(screen_trial and accepted)
+        {
+          evaluate_trial_residual(residual, temporary, false);
+          norm_r_damp = residual.l2_norm();
+          accepted    = norm_r_damp < (1.0 - tau * omega) * norm_r;
+
+          screening_possible = false;
+        }
+
+        screen_trial = screening_possible and not accepted;
+      } while(not accepted and n_iter_damp < max_iter_damp);
+
+      AssertThrow(accepted,
                   dealii::ExcMessage("Damped Newton iteration did not converge. "
                                      "Maximum number of iterations exceeded!"));
 
-      // update solution and residual
-      solution = temporary;
+      // update solution and residual, where the residual of the accepted step is re-used in the next
+      // Newton iteration
+      solution.swap(temporary);
       norm_r   = norm_r_damp;
 
       // increment iteration counter
@@ -137,16 +224,44 @@ public:
       linear_operator.set_solution_linearization(solution);
       // update preconditioner
       linear_solver.update_preconditioner(true);
+
+      // the number of linear iterations with the updated preconditioner is not known yet
+      linear_iterations_last_update = 0;
     }
 
     return std::tuple<unsigned int, unsigned int>(newton_iterations, linear_iterations);
   }
 
 private:
+  /*
+   * Evaluates the residual of a trial step of the line search in full or in reduced precision.
+   */
+  void
+  evaluate_trial_residual(VectorType &       residual,
+                          VectorType const & trial_solution,
+                          bool const         reduced_precision) const
+  {
+    if constexpr(HasReducedPrecisionResidual<NonlinearOperator, VectorType>::value)
+    {
+      if(reduced_precision)
+      {
+        nonlinear_operator.evaluate_residual_reduced_precision(residual, trial_solution);
+        return;
+      }
+    }
+
+    nonlinear_operator.evaluate_residual(residual, trial_solution);
+  }
+
   SolverData          solver_data;
   NonlinearOperator & nonlinear_operator;
   LinearOperator &    linear_operator;
   LinearSolver &      linear_solver;
+
+  // number of linear iterations of the first linear solve after the last update of the
+  // preconditioner (zero if unknown) and of the last linear solve
+  unsigned int linear_iterations_last_update;
+  unsigned int linear_iterations_last_solve;
 };
 
 } // namespace Newton
@@ -34,12 +34,21 @@ namespace Newton
 {
 struct SolverData
 {
-  SolverData() : max_iter(100), abs_tol(1.e-12), rel_tol(1.e-12)
+  SolverData()
+    : max_iter(100),
+      abs_tol(1.e-12),
+      rel_tol(1.e-12),
+      jacobian_free(false),
+      reduced_precision_line_search(false)
   {
   }
 
   SolverData(unsigned int const max_iter_, double const abs_tol_, double const rel_tol_)
-    : max_iter(max_iter_), abs_tol(abs_tol_), rel_tol(rel_tol_)
+    : max_iter(max_iter_),
+      abs_tol(abs_tol_),
+      rel_tol(rel_tol_),
+      jacobian_free(false),
+      reduced_precision_line_search(false)
   {
   }
 
@@ -49,22 +58,47 @@ struct SolverData
     print_parameter(pcout, "Maximum number of iterations", max_iter);
     print_parameter(pcout, "Absolute solver tolerance", abs_tol);
     print_parameter(pcout, "Relative solver tolerance", rel_tol);
+    print_parameter(pcout, "Jacobian-free", jacobian_free);
+    print_parameter(pcout, "Reduced precision line search", reduced_precision_line_search);
   }
 
   unsigned int max_iter;
   double       abs_tol;
   double       rel_tol;
+
+  // Jacobian-free Newton-Krylov method: The linearized operator is applied via finite differences
+  // of the nonlinear residual (see JacobianFreeOperator), and the linearization of the linear
+  // operator used by the preconditioner is only updated along with the preconditioner.
+  bool jacobian_free;
+
+  // The trial steps of the line search after a rejected undamped step are screened by evaluating
+  // the residual in reduced precision, and only the accepted step is re-evaluated in full
+  // precision. This requires the residual to be well above the accuracy of the reduced
+  // precision.
+  bool reduced_precision_line_search;
 };
 
 struct UpdateData
 {
-  UpdateData() : do_update(true), update_every_newton_iter(1), update_once_converged(false)
+  UpdateData()
+    : do_update(true),
+      update_every_newton_iter(1),
+      update_once_converged(false),
+      update_adaptively(false),
+      linear_iterations_increase_factor(1.5)
   {
   }
 
   bool         do_update;
   unsigned int update_every_newton_iter;
   bool         update_once_converged;
+
+  // Replaces the fixed schedule update_every_newton_iter: The preconditioner is only updated if
+  // the number of linear iterations of the previous linear solve exceeds the number of linear
+  // iterations directly after the last update of the preconditioner by the given factor. The
+  // reference is kept across calls of the Newton solver.
+  bool   update_adaptively;
+  double linear_iterations_increase_factor;
 };
 } // namespace Newton
 } // namespace ExaDG
@@ -169,6 +169,67 @@ private:
   dealii::LinearAlgebra::distributed::Vector<Number> global_inverse_diagonal;
 };
 
+/**
+ * This class implements a fast diagonalization preconditioner for iterative solvers for
+ * elementwise problems, which applies the inverse of a separable approximation of the cell block,
+ * see OperatorBase::update_fast_diagonalization().
+ */
+template<int dim, int n_components, typename Number, typename Operator>
+class FastDiagonalizationPreconditioner
+  : public Elementwise::PreconditionerBase<dealii::VectorizedArray<Number>>
+{
+public:
+  FastDiagonalizationPreconditioner(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                    unsigned int const                      dof_index,
+                                    unsigned int const                      quad_index,
+                                    Operator const &                        underlying_operator_in,
+                                    bool const                              initialize)
+    : underlying_operator(underlying_operator_in), current_cell(0)
+  {
+    CellIntegrator<dim, n_components, Number> integrator(matrix_free, dof_index, quad_index);
+    tmp.resize(integrator.dofs_per_cell);
+
+    if(initialize)
+    {
+      this->update();
+    }
+  }
+
+  void
+  setup(unsigned int cell) final
+  {
+    current_cell = cell;
+  }
+
+  void
+  update() final
+  {
+    underlying_operator.update_fast_diagonalization();
+
+    this->update_needed = false;
+  }
+
+  /**
+   * The pointers dst, src may point to the same data.
+   */
+  void
+  vmult(dealii::VectorizedArray<Number> *       dst,
+        dealii::VectorizedArray<Number> const * src) const final
+  {
+    for(unsigned int i = 0; i < tmp.size(); ++i)
+      tmp[i] = src[i];
+
+    underlying_operator.apply_inverse_fast_diagonalization_cell(current_cell, dst, tmp.data());
+  }
+
+private:
+  Operator const & underlying_operator;
+
+  unsigned int current_cell;
+
+  mutable dealii::AlignedVector<dealii::VectorizedArray<Number>> tmp;
+};
+
 /**
  * This class implements an elementwise inverse mass preconditioner. Currently, this class can only
  * be used if the inverse mass can be realized as a matrix-free operator evaluation available via
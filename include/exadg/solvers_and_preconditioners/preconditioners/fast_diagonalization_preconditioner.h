@@ -0,0 +1,84 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_FASTDIAGONALIZATIONPRECONDITIONER_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_FASTDIAGONALIZATIONPRECONDITIONER_H_
+
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+
+namespace ExaDG
+{
+/*
+ * Block Jacobi preconditioner with the cell blocks inverted by the fast diagonalization method,
+ * see FastDiagonalizationKernel. In contrast to BlockJacobiPreconditioner, the cell blocks are
+ * separable approximations of the operator, which the underlying operator has to provide.
+ */
+template<typename Operator>
+class FastDiagonalizationPreconditioner : public PreconditionerBase<typename Operator::value_type>
+{
+public:
+  typedef typename PreconditionerBase<typename Operator::value_type>::VectorType VectorType;
+
+  FastDiagonalizationPreconditioner(Operator const & underlying_operator_in,
+                                    bool const       initialize)
+    : underlying_operator(underlying_operator_in)
+  {
+    if(initialize)
+    {
+      this->update();
+    }
+  }
+
+  /*
+   *  This function applies the fast diagonalization preconditioner.
+   *  Make sure that the preconditioner has been updated when calling this function.
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const final
+  {
+    AssertThrow(not this->update_needed,
+                dealii::ExcMessage("Fast diagonalization preconditioner can not be applied "
+                                   "because it needs to be updated."));
+
+    underlying_operator.apply_inverse_fast_diagonalization(dst, src);
+  }
+
+  /*
+   *  This function updates the fast diagonalization preconditioner.
+   *  Make sure that the underlying operator has been updated
+   *  when calling this function.
+   */
+  void
+  update() final
+  {
+    underlying_operator.update_fast_diagonalization();
+
+    this->update_needed = false;
+  }
+
+private:
+  Operator const & underlying_operator;
+};
+
+} // namespace ExaDG
+
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_FASTDIAGONALIZATIONPRECONDITIONER_H_ */
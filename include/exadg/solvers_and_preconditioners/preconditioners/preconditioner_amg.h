@@ -22,11 +22,16 @@
 #ifndef PRECONDITIONER_AMG
 #define PRECONDITIONER_AMG
 
+#include <type_traits>
+#include <vector>
+
+#include <deal.II/base/function.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_precondition.h>
 #include <deal.II/lac/petsc_sparse_matrix.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
 
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
@@ -77,6 +82,86 @@ create_subcommunicator(dealii::DoFHandler<dim, spacedim> const & dof_handler)
   }
 }
 
+/*
+ * Rigid body mode of a vector-valued problem with dim components: the translations in the dim
+ * coordinate directions followed by the rotations about the coordinate axes (one rotation in 2D,
+ * three rotations in 3D).
+ */
+template<int dim>
+class RigidBodyMode : public dealii::Function<dim>
+{
+public:
+  static unsigned int const n_modes = dim * (dim + 1) / 2;
+
+  RigidBodyMode(unsigned int const mode) : dealii::Function<dim>(dim), mode(mode)
+  {
+    AssertThrow(mode < n_modes, dealii::ExcMessage("Invalid rigid body mode."));
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    if(mode < dim)
+      return (component == mode) ? 1.0 : 0.0;
+
+    // rotation about the axis mode - dim in 3D, about the z-axis in 2D
+    unsigned int const axis = (dim == 2) ? 2 : mode - dim;
+    unsigned int const i    = (axis + 1) % 3;
+    unsigned int const j    = (axis + 2) % 3;
+
+    if(component == i)
+      return -p[j];
+    else if(component == j)
+      return p[i];
+    else
+      return 0.0;
+  }
+
+private:
+  unsigned int const mode;
+};
+
+/*
+ * Returns the values of the rigid body modes for the locally owned degrees of freedom of the
+ * operator, in the format of the near-nullspace of ML. The modes are interpolated with the linear
+ * mapping, which is exact for the rigid body modes on the (typically low-order) coarse grid of
+ * multigrid.
+ */
+template<typename Operator>
+std::vector<std::vector<double>>
+compute_rigid_body_modes(Operator const & pde_operator)
+{
+  typedef dealii::LinearAlgebra::distributed::Vector<typename Operator::value_type> VectorType;
+
+  auto const & dof_handler = pde_operator.get_matrix_free().get_dof_handler(
+    pde_operator.get_dof_index());
+
+  constexpr int dim = std::decay_t<decltype(dof_handler)>::dimension;
+
+  AssertThrow(dof_handler.get_fe().n_components() == dim,
+              dealii::ExcMessage("Rigid body modes require a vector-valued problem with dim "
+                                 "components."));
+
+  auto const & mapping =
+    dof_handler.get_fe().reference_cell().template get_default_linear_mapping<dim, dim>();
+
+  VectorType vector;
+  pde_operator.initialize_dof_vector(vector);
+
+  std::vector<std::vector<double>> modes(RigidBodyMode<dim>::n_modes,
+                                         std::vector<double>(vector.locally_owned_size()));
+
+  for(unsigned int mode = 0; mode < modes.size(); ++mode)
+  {
+    dealii::VectorTools::interpolate(mapping, dof_handler, RigidBodyMode<dim>(mode), vector);
+
+    for(unsigned int i = 0; i < vector.locally_owned_size(); ++i)
+      modes[mode][i] = vector.local_element(i);
+  }
+
+  return modes;
+}
+
 #ifdef DEAL_II_WITH_TRILINOS
 template<typename Operator, typename Number>
 class PreconditionerML : public PreconditionerBase<Number>
@@ -94,13 +179,29 @@ private:
   dealii::TrilinosWrappers::PreconditionAMG amg;
 
 public:
-  PreconditionerML(Operator const & op, bool const initialize, MLData ml_data = MLData())
-    : pde_operator(op), ml_data(ml_data)
+  PreconditionerML(Operator const & op,
+                   bool const       initialize,
+                   MLData           ml_data          = MLData(),
+                   bool const       reuse_hierarchy  = false,
+                   bool const       rigid_body_modes = false)
+    : pde_operator(op), ml_data(ml_data), reuse_hierarchy(reuse_hierarchy), amg_is_set_up(false)
   {
     // initialize system matrix
     pde_operator.init_system_matrix(system_matrix,
                                     op.get_matrix_free().get_dof_handler().get_communicator());
 
+    // The near-nullspace is computed once since it only depends on the DoFHandler. The aggregation
+    // of ML builds the coarse spaces from these modes instead of the constant modes per component.
+    if(rigid_body_modes)
+    {
+#if DEAL_II_VERSION_GTE(9, 5, 0)
+      this->ml_data.constant_modes_values = compute_rigid_body_modes(pde_operator);
+#else
+      AssertThrow(false,
+                  dealii::ExcMessage("Rigid body modes for ML require deal.II 9.5 or newer."));
+#endif
+    }
+
     if(initialize)
     {
       this->update();
@@ -128,8 +229,13 @@ public:
     // re-calculate matrix
     pde_operator.calculate_system_matrix(system_matrix);
 
-    // initialize Trilinos' AMG
-    amg.initialize(system_matrix, ml_data);
+    // initialize Trilinos' AMG, or recompute the matrices of the existing hierarchy
+    if(reuse_hierarchy and amg_is_set_up)
+      amg.reinit();
+    else
+      amg.initialize(system_matrix, ml_data);
+
+    amg_is_set_up = true;
 
     this->update_needed = false;
   }
@@ -139,6 +245,10 @@ private:
   Operator const & pde_operator;
 
   MLData ml_data;
+
+  bool reuse_hierarchy;
+
+  bool amg_is_set_up;
 };
 #endif
 
@@ -277,6 +387,9 @@ private:
 
 public:
   PreconditionerAMG(Operator const & pde_operator, bool const initialize, AMGData const & data)
+    : n_updates_reuse_setup(data.n_updates_reuse_setup),
+      n_updates_skipped(0),
+      setup_is_available(initialize)
   {
     (void)pde_operator;
     (void)initialize;
@@ -296,9 +409,8 @@ public:
     else if(data.amg_type == AMGType::ML)
     {
 #ifdef DEAL_II_WITH_TRILINOS
-      preconditioner_amg = std::make_shared<PreconditionerML<Operator, double>>(pde_operator,
-                                                                                initialize,
-                                                                                data.ml_data);
+      preconditioner_amg = std::make_shared<PreconditionerML<Operator, double>>(
+        pde_operator, initialize, data.ml_data, data.reuse_hierarchy, data.rigid_body_modes);
 #else
       AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
@@ -336,12 +448,27 @@ private:
   void
   update() final
   {
-    preconditioner_amg->update();
+    // reuse the (possibly stale) setup of a previous update, see AMGData::n_updates_reuse_setup
+    if(setup_is_available and n_updates_skipped < n_updates_reuse_setup)
+    {
+      ++n_updates_skipped;
+    }
+    else
+    {
+      preconditioner_amg->update();
+
+      n_updates_skipped  = 0;
+      setup_is_available = true;
+    }
 
     this->update_needed = false;
   }
 
   std::shared_ptr<PreconditionerBase<NumberAMG>> preconditioner_amg;
+
+  unsigned int n_updates_reuse_setup;
+  unsigned int n_updates_skipped;
+  bool         setup_is_available;
 };
 
 } // namespace ExaDG
@@ -0,0 +1,349 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_DEFLATED_CG_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_DEFLATED_CG_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/solver_control.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Deflated preconditioned CG method according to Saad, Yeung, Erhel, Guyomarc'h (2000), "A
+ * deflated version of the conjugate gradient algorithm". The coarse space Z consists of piecewise
+ * constant functions on a partition of the degrees of freedom into subdomains, which is
+ * described by the subdomain index of each locally owned degree of freedom. The vectors W = A Z
+ * and the coarse matrix E = Z^T A Z are computed once in reinit() and reused by all subsequent
+ * calls of solve(), so that each iteration only adds one global reduction of size dim(Z) and the
+ * application of the (small) inverse coarse matrix to the costs of the preconditioned CG method.
+ *
+ * For singular matrices with the constant vector in the kernel (e.g. pure Neumann problems), the
+ * coarse matrix is singular as well and the constant mode is regularized, which only adds
+ * multiples of the constant vector to the iterates.
+ */
+template<typename VectorType>
+class DeflatedCG
+{
+public:
+  DeflatedCG() : n_coarse_vectors(0)
+  {
+  }
+
+  template<typename Operator>
+  void
+  reinit(Operator const &                  matrix,
+         VectorType const &                example_vector,
+         std::vector<unsigned int> const & subdomain_indices,
+         bool const                        matrix_is_singular)
+  {
+    AssertThrow(subdomain_indices.size() == example_vector.locally_owned_size(),
+                dealii::ExcMessage("The coarse space has to be defined for all locally owned "
+                                   "degrees of freedom."));
+
+    MPI_Comm const mpi_comm = example_vector.get_mpi_communicator();
+
+    // remove empty subdomains
+    unsigned int n_subdomains = 0;
+    for(unsigned int const index : subdomain_indices)
+      n_subdomains = std::max(n_subdomains, index + 1);
+    n_subdomains = dealii::Utilities::MPI::max(n_subdomains, mpi_comm);
+
+    std::vector<double> counts(n_subdomains, 0.0);
+    for(unsigned int const index : subdomain_indices)
+      counts[index] += 1.0;
+    dealii::Utilities::MPI::sum(counts, mpi_comm, counts);
+
+    std::vector<unsigned int> new_indices(n_subdomains, dealii::numbers::invalid_unsigned_int);
+    n_coarse_vectors = 0;
+    for(unsigned int j = 0; j < n_subdomains; ++j)
+      if(counts[j] > 0.0)
+        new_indices[j] = n_coarse_vectors++;
+
+    coarse_indices.resize(subdomain_indices.size());
+    for(unsigned int i = 0; i < subdomain_indices.size(); ++i)
+      coarse_indices[i] = new_indices[subdomain_indices[i]];
+
+    // W = A Z
+    VectorType z;
+    z.reinit(example_vector, true);
+
+    W.resize(n_coarse_vectors);
+    for(unsigned int j = 0; j < n_coarse_vectors; ++j)
+    {
+      z = 0.0;
+      for(unsigned int i = 0; i < coarse_indices.size(); ++i)
+        if(coarse_indices[i] == j)
+          z.local_element(i) = 1.0;
+
+      W[j].reinit(example_vector, true);
+      matrix.vmult(W[j], z);
+    }
+
+    // E = Z^T W
+    coarse_matrix_inverse.reinit(n_coarse_vectors, n_coarse_vectors);
+    for(unsigned int j = 0; j < n_coarse_vectors; ++j)
+    {
+      std::vector<double> const column = restrict(W[j]);
+      for(unsigned int i = 0; i < n_coarse_vectors; ++i)
+        coarse_matrix_inverse(i, j) = column[i];
+    }
+
+    if(matrix_is_singular)
+    {
+      double trace = 0.0;
+      for(unsigned int i = 0; i < n_coarse_vectors; ++i)
+        trace += coarse_matrix_inverse(i, i);
+
+      double const shift = trace / (n_coarse_vectors * n_coarse_vectors);
+      for(unsigned int i = 0; i < n_coarse_vectors; ++i)
+        for(unsigned int j = 0; j < n_coarse_vectors; ++j)
+          coarse_matrix_inverse(i, j) += shift;
+    }
+
+    coarse_matrix_inverse.gauss_jordan();
+  }
+
+  unsigned int
+  n_vectors() const
+  {
+    return n_coarse_vectors;
+  }
+
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(dealii::SolverControl & solver_control,
+        Operator const &        matrix,
+        VectorType &            x,
+        VectorType const &      b,
+        Preconditioner const &  preconditioner) const
+  {
+    AssertThrow(n_coarse_vectors > 0, dealii::ExcMessage("DeflatedCG has not been initialized."));
+
+    VectorType r, z, p, q;
+    r.reinit(x, true);
+    z.reinit(x, true);
+    p.reinit(x, true);
+    q.reinit(x, true);
+
+    // r = b - A x, followed by the coarse correction x += Z E^{-1} Z^T r so that Z^T r = 0
+    matrix.vmult(r, x);
+    r.sadd(-1.0, 1.0, b);
+
+    std::vector<double> mu = apply_coarse_inverse(restrict(r));
+    prolongate_add(x, mu, 1.0);
+    for(unsigned int j = 0; j < n_coarse_vectors; ++j)
+      r.add(-mu[j], W[j]);
+
+    unsigned int                 iteration = 0;
+    dealii::SolverControl::State state     = solver_control.check(iteration, r.l2_norm());
+
+    if(state == dealii::SolverControl::iterate)
+    {
+      // p = z - Z E^{-1} W^T z
+      preconditioner.vmult(z, r);
+      p = z;
+      mu = apply_coarse_inverse(inner_products_W(z));
+      prolongate_add(p, mu, -1.0);
+
+      double r_times_z = r * z;
+
+      while(state == dealii::SolverControl::iterate)
+      {
+        matrix.vmult(q, p);
+
+        double const alpha = r_times_z / (p * q);
+        x.add(alpha, p);
+        r.add(-alpha, q);
+
+        ++iteration;
+        state = solver_control.check(iteration, r.l2_norm());
+        if(state != dealii::SolverControl::iterate)
+          break;
+
+        preconditioner.vmult(z, r);
+
+        double const r_times_z_new = r * z;
+        double const beta          = r_times_z_new / r_times_z;
+        r_times_z                  = r_times_z_new;
+
+        // p = beta p + z - Z E^{-1} W^T z
+        mu = apply_coarse_inverse(inner_products_W(z));
+        p.sadd(beta, 1.0, z);
+        prolongate_add(p, mu, -1.0);
+      }
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  /*
+   * Computes Z^T v.
+   */
+  std::vector<double>
+  restrict(VectorType const & v) const
+  {
+    std::vector<double> result(n_coarse_vectors, 0.0);
+    for(unsigned int i = 0; i < coarse_indices.size(); ++i)
+      result[coarse_indices[i]] += v.local_element(i);
+
+    dealii::Utilities::MPI::sum(result, v.get_mpi_communicator(), result);
+
+    return result;
+  }
+
+  /*
+   * Computes W^T v with a single global reduction.
+   */
+  std::vector<double>
+  inner_products_W(VectorType const & v) const
+  {
+    std::vector<double> result(n_coarse_vectors, 0.0);
+    for(unsigned int j = 0; j < n_coarse_vectors; ++j)
+      for(unsigned int i = 0; i < v.locally_owned_size(); ++i)
+        result[j] += W[j].local_element(i) * v.local_element(i);
+
+    dealii::Utilities::MPI::sum(result, v.get_mpi_communicator(), result);
+
+    return result;
+  }
+
+  /*
+   * Computes v += factor * Z coefficients.
+   */
+  void
+  prolongate_add(VectorType &                v,
+                 std::vector<double> const & coefficients,
+                 double const                factor) const
+  {
+    for(unsigned int i = 0; i < coarse_indices.size(); ++i)
+      v.local_element(i) += factor * coefficients[coarse_indices[i]];
+  }
+
+  std::vector<double>
+  apply_coarse_inverse(std::vector<double> const & src) const
+  {
+    std::vector<double> dst(n_coarse_vectors, 0.0);
+    for(unsigned int i = 0; i < n_coarse_vectors; ++i)
+      for(unsigned int j = 0; j < n_coarse_vectors; ++j)
+        dst[i] += coarse_matrix_inverse(i, j) * src[j];
+
+    return dst;
+  }
+
+  unsigned int n_coarse_vectors;
+
+  // coarse space: index of the coarse vector for each locally owned degree of freedom
+  std::vector<unsigned int> coarse_indices;
+
+  // W = A Z and the inverse of the coarse matrix E = Z^T A Z
+  std::vector<VectorType>    W;
+  dealii::FullMatrix<double> coarse_matrix_inverse;
+};
+
+/*
+ * Partitions the locally owned degrees of freedom into subdomains given by a uniform subdivision
+ * of the bounding box of the mesh into n_subdivisions_1d^dim boxes, where each cell is assigned
+ * to the box containing its center. Together with DeflatedCG, this yields a coarse space of
+ * piecewise constant functions, which requires an element with a nodal basis (partition of
+ * unity).
+ */
+template<int dim>
+std::vector<unsigned int>
+compute_box_subdomain_indices(dealii::DoFHandler<dim> const & dof_handler,
+                              unsigned int const              n_subdivisions_1d)
+{
+  AssertThrow(dof_handler.get_fe().has_support_points(),
+              dealii::ExcMessage("A piecewise constant coarse space requires a nodal basis."));
+  AssertThrow(n_subdivisions_1d > 0,
+              dealii::ExcMessage("The number of subdivisions has to be at least 1."));
+
+  MPI_Comm const mpi_comm = dof_handler.get_communicator();
+
+  // bounding box of the mesh
+  std::vector<double> min_coordinates(dim, std::numeric_limits<double>::max()),
+    max_coordinates(dim, std::numeric_limits<double>::lowest());
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      for(unsigned int v = 0; v < cell->n_vertices(); ++v)
+      {
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          min_coordinates[d] = std::min(min_coordinates[d], cell->vertex(v)[d]);
+          max_coordinates[d] = std::max(max_coordinates[d], cell->vertex(v)[d]);
+        }
+      }
+    }
+  }
+  dealii::Utilities::MPI::min(min_coordinates, mpi_comm, min_coordinates);
+  dealii::Utilities::MPI::max(max_coordinates, mpi_comm, max_coordinates);
+
+  dealii::IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+  std::vector<unsigned int> subdomain_indices(locally_owned_dofs.n_elements(), 0);
+
+  std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().n_dofs_per_cell());
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      dealii::Point<dim> const center = cell->center();
+
+      unsigned int index = 0, stride = 1;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        double const extent = max_coordinates[d] - min_coordinates[d];
+        int const    box =
+          static_cast<int>((center[d] - min_coordinates[d]) / extent * n_subdivisions_1d);
+        index += stride * std::clamp(box, 0, static_cast<int>(n_subdivisions_1d) - 1);
+        stride *= n_subdivisions_1d;
+      }
+
+      cell->get_dof_indices(dof_indices);
+      for(dealii::types::global_dof_index const dof_index : dof_indices)
+        if(locally_owned_dofs.is_element(dof_index))
+          subdomain_indices[locally_owned_dofs.index_within_set(dof_index)] = index;
+    }
+  }
+
+  return subdomain_indices;
+}
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_DEFLATED_CG_H_ */
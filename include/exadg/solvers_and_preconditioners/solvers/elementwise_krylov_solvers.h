@@ -128,6 +128,28 @@ adjust_division_by_zero(dealii::VectorizedArray<Number> & x)
       x[i] = 1;
 }
 
+/*
+ * Sets x to zero for those lanes of a vectorized array that have already converged, i.e., where
+ * is_converged is positive. This freezes the iterates of converged lanes while the remaining lanes
+ * of the cell batch continue to iterate.
+ */
+template<typename Number>
+void
+set_zero_if_converged(Number & x, Number const is_converged)
+{
+  if(is_converged > 0.0)
+    x = 0.0;
+}
+
+template<typename Number>
+void
+set_zero_if_converged(dealii::VectorizedArray<Number> &     x,
+                      dealii::VectorizedArray<Number> const is_converged)
+{
+  x = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+    is_converged, dealii::VectorizedArray<Number>(0.0), dealii::VectorizedArray<Number>(0.0), x);
+}
+
 template<typename value_type>
 void
 scale(value_type * dst, value_type const scalar, unsigned int const size)
@@ -216,7 +238,11 @@ public:
   {
   }
 
-  virtual void
+  /*
+   * Returns the number of iterations, i.e., the maximum over the lanes for the
+   * dealii::VectorizedArray data type.
+   */
+  virtual unsigned int
   solve(Matrix const *         matrix,
         value_type *           solution,
         value_type const *     rhs,
@@ -224,7 +250,9 @@ public:
 };
 
 /*
- * CG solver.
+ * CG solver. For the dealii::VectorizedArray data type, the convergence criterion is checked
+ * separately for each lane. Lanes that have converged are frozen by setting the step lengths to
+ * zero, and the iteration stops as soon as all lanes have converged.
  */
 template<typename value_type, typename Matrix, typename Preconditioner>
 class SolverCG : public SolverBase<value_type, Matrix, Preconditioner>
@@ -232,7 +260,7 @@ class SolverCG : public SolverBase<value_type, Matrix, Preconditioner>
 public:
   SolverCG(unsigned int const unknowns, SolverData const & solver_data);
 
-  void
+  unsigned int
   solve(Matrix const *         matrix,
         value_type *           solution,
         value_type const *     rhs,
@@ -265,7 +293,7 @@ SolverCG<value_type, Matrix, Preconditioner>::SolverCG(unsigned int const unknow
 }
 
 template<typename value_type, typename Matrix, typename Preconditioner>
-void
+unsigned int
 SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matrix,
                                                     value_type *           solution,
                                                     value_type const *     rhs,
@@ -294,6 +322,10 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
   // compute (r^{0})^T * y^{0} = (r^{0})^T * p^{0}
   value_type r_times_y = inner_product(r, p, M);
 
+  // negative values = false (not converged)
+  value_type convergence_status;
+  convergence_status = -1.0;
+
   unsigned int n_iter = 0;
 
   while(true)
@@ -305,8 +337,9 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     value_type p_times_v = inner_product(p, v, M);
     adjust_division_by_zero(p_times_v);
 
-    // alpha = (r^T*y) / (p^T*v)
+    // alpha = (r^T*y) / (p^T*v), where converged lanes are not updated
     value_type alpha = (r_times_y) / (p_times_v);
+    set_zero_if_converged(alpha, convergence_status);
 
     // solution <- solution + alpha*p
     add(solution, alpha, p, M);
@@ -321,8 +354,8 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // increment iteration counter
     ++n_iter;
 
-    // check convergence
-    if(all_smaller(norm_r_abs, ABS_TOL) or all_smaller(norm_r_rel, REL_TOL) or (n_iter > MAX_ITER))
+    // check convergence for each lane separately
+    if(converged(convergence_status, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER))
     {
       break;
     }
@@ -337,6 +370,7 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
 
     // beta = (r^T*y)_new / (r^T*y)
     value_type beta = r_times_y_new / r_times_y;
+    set_zero_if_converged(beta, convergence_status);
 
     // p <- y + beta*p
     equ(p, one, v, beta, p, M);
@@ -345,6 +379,8 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
   }
 
   //    std::cout<<"Number of iterations = "<< n_iter << std::endl;
+
+  return n_iter;
 }
 
 
@@ -357,7 +393,7 @@ class SolverGMRES : public SolverBase<value_type, Matrix, Preconditioner>
 public:
   SolverGMRES(unsigned int const unknowns, SolverData const & solver_data);
 
-  void
+  unsigned int
   solve(Matrix const * A, value_type * x, value_type const * b, Preconditioner const * P) final;
 
 private:
@@ -391,12 +427,15 @@ private:
   // will be reset after restart
   unsigned int k;
 
-  // matrices of variable size
+  // matrices of variable size, the memory of which is kept for subsequent solves and restarts,
+  // i.e., only the first k vectors of V and H are valid
   dealii::AlignedVector<dealii::AlignedVector<value_type>> V;
   dealii::AlignedVector<dealii::AlignedVector<value_type>> H;
 
-  // temporary vector
+  // temporary vectors
   dealii::AlignedVector<value_type> temp;
+  dealii::AlignedVector<value_type> delta;
+  dealii::AlignedVector<value_type> y;
 
   // vectors of variable size
   dealii::AlignedVector<value_type> res;
@@ -454,7 +493,8 @@ SolverGMRES<value_type, Matrix, Preconditioner>::SolverGMRES(unsigned int const
   // negative values = false (not converged)
   convergence_status = -1.0;
 
-  temp = dealii::AlignedVector<value_type>(M);
+  temp  = dealii::AlignedVector<value_type>(M);
+  delta = dealii::AlignedVector<value_type>(M);
 
   one = 1.0;
 }
@@ -463,12 +503,11 @@ template<typename value_type, typename Matrix, typename Preconditioner>
 void
 SolverGMRES<value_type, Matrix, Preconditioner>::clear()
 {
-  // clear all data
-  V.clear();
-  H.clear();
-  res.clear();
-  s.clear();
-  c.clear();
+  // reset the data of variable size without releasing memory, the vectors of V and H are
+  // overwritten before they are read
+  res.resize(0);
+  s.resize(0);
+  c.resize(0);
 }
 
 template<typename value_type, typename Matrix, typename Preconditioner>
@@ -639,7 +678,7 @@ void
  *  r: residual r = b - A*x
  */
 template<typename value_type, typename Matrix, typename Preconditioner>
-void
+unsigned int
 SolverGMRES<value_type, Matrix, Preconditioner>::solve(Matrix const *         A,
                                                        value_type *           x,
                                                        value_type const *     b,
@@ -682,6 +721,8 @@ SolverGMRES<value_type, Matrix, Preconditioner>::solve(Matrix const *         A,
   //    // temp = b - temp2 = b - A*x = r
   //    equ(temp.begin(),one,b,-one,temp2.begin());
   //    print(l2_norm(temp.begin()),"l2-norm of residual");
+
+  return iterations;
 }
 
 template<typename value_type, typename Matrix, typename Preconditioner>
@@ -692,7 +733,8 @@ SolverGMRES<value_type, Matrix, Preconditioner>::do_solve(Matrix const *
                                                           Preconditioner const * P)
 {
   // apply matrix vector product: r = A*x
-  V.push_back(dealii::AlignedVector<value_type>(M));
+  if(V.size() < 1)
+    V.push_back(dealii::AlignedVector<value_type>(M));
   A->vmult(V[0].begin(), x);
 
   // compute residual r = b - A*x and its norm
@@ -731,7 +773,8 @@ SolverGMRES<value_type, Matrix, Preconditioner>::do_solve(Matrix const *
 
     // calculate new search direction by performing
     // matrix-vector product: V[k+1] = A*V[k]
-    V.push_back(dealii::AlignedVector<value_type>(M));
+    if(V.size() < k + 2)
+      V.push_back(dealii::AlignedVector<value_type>(M));
 
     // apply preconditioner
     P->vmult(temp.begin(), V[k].begin());
@@ -739,7 +782,8 @@ SolverGMRES<value_type, Matrix, Preconditioner>::do_solve(Matrix const *
     A->vmult(V[k + 1].begin(), temp.begin());
 
     // resize H
-    H.push_back(dealii::AlignedVector<value_type>(k + 2));
+    if(H.size() < k + 1)
+      H.push_back(dealii::AlignedVector<value_type>(k + 2));
 
     // perform modified Gram-Schmidt orthogonalization
     modified_gram_schmidt(V[k + 1], H, V, k + 1);
@@ -756,8 +800,8 @@ SolverGMRES<value_type, Matrix, Preconditioner>::do_solve(Matrix const *
   }
 
   // calculate solution
-  dealii::AlignedVector<value_type> y(k);
-  dealii::AlignedVector<value_type> delta = dealii::AlignedVector<value_type>(M);
+  y.resize(k);
+  vector_init(delta.begin(), M);
 
   /*
    *  calculate solution as linear combination of
@@ -0,0 +1,140 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_INITIAL_GUESS_PROJECTION_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_INITIAL_GUESS_PROJECTION_H_
+
+// C/C++
+#include <cmath>
+#include <vector>
+
+namespace ExaDG
+{
+/*
+ * Initial guess for a sequence of linear systems A x = b with the same symmetric positive
+ * (semi-)definite matrix A and slowly varying right-hand sides, e.g. the pressure Poisson
+ * equation of projection methods, according to Fischer (1998), "Projection techniques for
+ * iterative solution of Ax = b with successive right-hand sides": The previous solutions span a
+ * space with an A-orthonormal basis x_k, and the initial guess is the A-orthogonal projection of
+ * the new solution onto this space,
+ *
+ *   x_0 = sum_k (x_k, b) x_k,
+ *
+ * which only requires inner products with the right-hand side. After the solve, the new solution
+ * is A-orthogonalized against the basis and added to the basis at the cost of one operator
+ * evaluation. Once the basis holds max_size vectors, it is restarted with the latest solution.
+ */
+template<typename VectorType>
+class InitialGuessProjection
+{
+public:
+  InitialGuessProjection(unsigned int const max_size) : max_size(max_size)
+  {
+  }
+
+  /*
+   * Removes all vectors from the basis, e.g. if the matrix has changed.
+   */
+  void
+  clear()
+  {
+    basis.clear();
+    basis_times_matrix.clear();
+  }
+
+  unsigned int
+  size() const
+  {
+    return basis.size();
+  }
+
+  /*
+   * Overwrites initial_guess by the projection of the solution onto the space of previous
+   * solutions. The initial guess remains untouched if the space is empty.
+   */
+  void
+  compute_initial_guess(VectorType & initial_guess, VectorType const & rhs) const
+  {
+    if(basis.empty())
+      return;
+
+    initial_guess = 0.0;
+    for(VectorType const & vector : basis)
+      initial_guess.add(vector * rhs, vector);
+  }
+
+  /*
+   * Adds the solution of the latest linear system with right-hand side rhs to the space of
+   * previous solutions.
+   */
+  template<typename Operator>
+  void
+  add(Operator const & matrix, VectorType const & solution, VectorType const & rhs)
+  {
+    if(max_size == 0)
+      return;
+
+    if(basis.size() == max_size)
+      clear();
+
+    VectorType vector(solution), vector_times_matrix;
+    vector_times_matrix.reinit(solution, true);
+
+    // A-orthogonalize against the basis (classical Gram-Schmidt with one re-orthogonalization)
+    for(unsigned int pass = 0; pass < 2; ++pass)
+    {
+      std::vector<double> coefficients(basis.size());
+      for(unsigned int k = 0; k < basis.size(); ++k)
+        coefficients[k] = basis_times_matrix[k] * vector;
+      for(unsigned int k = 0; k < basis.size(); ++k)
+        vector.add(-coefficients[k], basis[k]);
+    }
+
+    matrix.vmult(vector_times_matrix, vector);
+
+    double const norm_squared = vector * vector_times_matrix;
+
+    // skip solutions that are (numerically) contained in the space already, where the squared
+    // A-norm of the solution is approximated by (x, b)
+    double const norm_squared_solution = solution * rhs;
+
+    if(norm_squared <= 1.e-16 * norm_squared_solution or norm_squared <= 0.0)
+      return;
+
+    double const scaling = 1.0 / std::sqrt(norm_squared);
+    vector *= scaling;
+    vector_times_matrix *= scaling;
+
+    basis.push_back(vector);
+    basis_times_matrix.push_back(vector_times_matrix);
+  }
+
+private:
+  unsigned int const max_size;
+
+  // A-orthonormal basis of previous solutions x_k and the vectors A x_k
+  std::vector<VectorType> basis;
+  std::vector<VectorType> basis_times_matrix;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_INITIAL_GUESS_PROJECTION_H_ */
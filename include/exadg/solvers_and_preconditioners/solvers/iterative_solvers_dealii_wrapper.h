@@ -22,6 +22,9 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_ITERATIVESOLVERS_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_ITERATIVESOLVERS_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/base/timer.h>
 #include <deal.II/lac/precondition.h>
@@ -29,6 +32,10 @@
 #include <deal.II/lac/solver_gmres.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/deflated_cg.h>
+#include <exadg/solvers_and_preconditioners/solvers/low_synchronization_krylov_solvers.h>
+#include <exadg/solvers_and_preconditioners/solvers/recycling_fgmres.h>
+#include <exadg/utilities/profiling.h>
 #include <exadg/utilities/timer_tree.h>
 
 namespace ExaDG
@@ -54,6 +61,17 @@ public:
   virtual void
   update_preconditioner(bool const update_preconditioner) const = 0;
 
+  /*
+   * Sets the relative tolerance used by subsequent calls of solve(), e.g. for inexact inner solves
+   * with adaptive tolerances.
+   */
+  virtual void
+  set_relative_tolerance(double const /* tolerance */)
+  {
+    AssertThrow(false,
+                dealii::ExcMessage("Adaptive tolerances are not implemented for this solver."));
+  }
+
   template<typename Control>
   void
   compute_performance_metrics(Control const & solver_control) const
@@ -95,7 +113,8 @@ struct SolverDataCG
       solver_tolerance_abs(1.e-20),
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      fused_vector_operations(true)
   {
   }
 
@@ -104,6 +123,9 @@ struct SolverDataCG
   double       solver_tolerance_rel;
   bool         use_preconditioner;
   bool         compute_performance_metrics;
+
+  // use FusedCG instead of dealii::SolverCG, see FusedCG (only used by SolverCG)
+  bool fused_vector_operations;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -131,16 +153,110 @@ public:
     }
   }
 
+  void
+  set_relative_tolerance(double const tolerance) override
+  {
+    solver_data.solver_tolerance_rel = tolerance;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
-    dealii::Timer timer;
+    ProfilingRegion region(this->timer_tree, {"SolverCG"});
 
     dealii::ReductionControl solver_control(solver_data.max_iter,
                                             solver_data.solver_tolerance_abs,
                                             solver_data.solver_tolerance_rel);
 
-    dealii::SolverCG<VectorType> solver(solver_control);
+    if(solver_data.fused_vector_operations)
+    {
+      FusedCG<VectorType> solver(solver_control);
+      do_solve(solver, dst, rhs);
+    }
+    else
+    {
+      dealii::SolverCG<VectorType> solver(solver_control);
+      do_solve(solver, dst, rhs);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      this->timer_tree->insert({"SolverCG"}, preconditioner.get_timings());
+    }
+
+    return this->timer_tree;
+  }
+
+private:
+  template<typename Solver>
+  void
+  do_solve(Solver & solver, VectorType & dst, VectorType const & rhs) const
+  {
+    if(solver_data.use_preconditioner == false)
+    {
+      solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+    }
+    else
+    {
+      solver.solve(underlying_operator, dst, rhs, preconditioner);
+    }
+  }
+
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataCG     solver_data;
+};
+
+/*
+ * Pipelined CG method, see PipelinedCG. Uses the same parameters as SolverCG.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  SolverPipelinedCG(Operator const &     underlying_operator_in,
+                    Preconditioner &     preconditioner_in,
+                    SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      if(preconditioner.needs_update() or update_preconditioner)
+      {
+        preconditioner.update();
+      }
+    }
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    ProfilingRegion region(this->timer_tree, {"SolverPipelinedCG"});
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    PipelinedCG<VectorType> solver(solver_control);
 
     if(solver_data.use_preconditioner == false)
     {
@@ -157,7 +273,84 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
-    this->timer_tree->insert({"SolverCG"}, timer.wall_time());
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      this->timer_tree->insert({"SolverPipelinedCG"}, preconditioner.get_timings());
+    }
+
+    return this->timer_tree;
+  }
+
+private:
+  Operator const &   underlying_operator;
+  Preconditioner &   preconditioner;
+  SolverDataCG const solver_data;
+};
+
+/*
+ * Deflated CG method with a coarse space of piecewise constant functions on subdomains, see
+ * DeflatedCG. The coarse space is set up once in the constructor. Uses the same parameters as
+ * SolverCG.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverDeflatedCG : public SolverBase<VectorType>
+{
+public:
+  SolverDeflatedCG(Operator const &                  underlying_operator_in,
+                   Preconditioner &                  preconditioner_in,
+                   SolverDataCG const &              solver_data_in,
+                   std::vector<unsigned int> const & subdomain_indices,
+                   bool const                        operator_is_singular)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+    VectorType vector;
+    underlying_operator.initialize_dof_vector(vector);
+    solver.reinit(underlying_operator, vector, subdomain_indices, operator_is_singular);
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      if(preconditioner.needs_update() or update_preconditioner)
+      {
+        preconditioner.update();
+      }
+    }
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    ProfilingRegion region(this->timer_tree, {"SolverDeflatedCG"});
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    if(solver_data.use_preconditioner == false)
+    {
+      solver.solve(solver_control, underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+    }
+    else
+    {
+      solver.solve(solver_control, underlying_operator, dst, rhs, preconditioner);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
 
     return solver_control.last_step();
   }
@@ -167,7 +360,7 @@ public:
   {
     if(solver_data.use_preconditioner)
     {
-      this->timer_tree->insert({"SolverCG"}, preconditioner.get_timings());
+      this->timer_tree->insert({"SolverDeflatedCG"}, preconditioner.get_timings());
     }
 
     return this->timer_tree;
@@ -177,6 +370,118 @@ private:
   Operator const &   underlying_operator;
   Preconditioner &   preconditioner;
   SolverDataCG const solver_data;
+
+  // holds the coarse space
+  DeflatedCG<VectorType> solver;
+};
+
+struct SolverDataIterativeRefinement
+{
+  SolverDataIterativeRefinement()
+    : max_iter(100),
+      solver_tolerance_abs(1.e-20),
+      solver_tolerance_rel(1.e-6),
+      compute_performance_metrics(false)
+  {
+  }
+
+  // the number of iterations refers to the outer refinement steps
+  unsigned int max_iter;
+  double       solver_tolerance_abs;
+  double       solver_tolerance_rel;
+  bool         compute_performance_metrics;
+};
+
+/*
+ * Mixed-precision iterative refinement: The residual r = b - A x is computed in the precision of
+ * VectorType (typically double) and the correction A d = r is approximated by an inner solver in
+ * the precision of VectorTypeInner (typically float), i.e., the Krylov iterations including the
+ * operator, the preconditioner, and the vectors run in reduced precision while the final accuracy
+ * is determined by the outer residual. The inner solver is typically set up with a moderate
+ * relative tolerance (e.g. 1e-2 to 1e-3), which is well above the accuracy of the reduced
+ * precision. The return value of solve() is the accumulated number of inner iterations.
+ */
+template<typename Operator, typename VectorType, typename VectorTypeInner>
+class SolverIterativeRefinement : public SolverBase<VectorType>
+{
+public:
+  SolverIterativeRefinement(Operator const &                                   operator_in,
+                            std::shared_ptr<SolverBase<VectorTypeInner>> const inner_solver_in,
+                            SolverDataIterativeRefinement const &              solver_data_in)
+    : underlying_operator(operator_in),
+      inner_solver(inner_solver_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    inner_solver->update_preconditioner(update_preconditioner);
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    ProfilingRegion region(this->timer_tree, {"SolverIterativeRefinement"});
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    VectorType residual, correction;
+    residual.reinit(dst, true);
+    correction.reinit(dst, true);
+
+    VectorTypeInner residual_inner, correction_inner;
+    residual_inner.reinit(dst.get_partitioner());
+    correction_inner.reinit(dst.get_partitioner());
+
+    unsigned int n_iterations_inner = 0;
+    unsigned int iteration          = 0;
+
+    underlying_operator.vmult(residual, dst);
+    residual.sadd(-1.0, 1.0, rhs);
+
+    dealii::SolverControl::State state = solver_control.check(iteration, residual.l2_norm());
+    while(state == dealii::SolverControl::iterate)
+    {
+      residual_inner.copy_locally_owned_data_from(residual);
+      correction_inner = 0.0;
+      n_iterations_inner += inner_solver->solve(correction_inner, residual_inner);
+
+      correction.copy_locally_owned_data_from(correction_inner);
+      dst += correction;
+
+      underlying_operator.vmult(residual, dst);
+      residual.sadd(-1.0, 1.0, rhs);
+
+      ++iteration;
+      state = solver_control.check(iteration, residual.l2_norm());
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    return n_iterations_inner;
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    this->timer_tree->insert({"SolverIterativeRefinement"}, inner_solver->get_timings());
+
+    return this->timer_tree;
+  }
+
+private:
+  Operator const &                                   underlying_operator;
+  std::shared_ptr<SolverBase<VectorTypeInner>> const inner_solver;
+  SolverDataIterativeRefinement const                solver_data;
 };
 
 template<class Number>
@@ -252,7 +557,7 @@ public:
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
-    dealii::Timer timer;
+    ProfilingRegion region(this->timer_tree, {"SolverGMRES"});
 
     dealii::ReductionControl solver_control(solver_data.max_iter,
                                             solver_data.solver_tolerance_abs,
@@ -287,8 +592,6 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
-    this->timer_tree->insert({"SolverGMRES"}, timer.wall_time());
-
     return solver_control.last_step();
   }
 
@@ -311,6 +614,86 @@ private:
   MPI_Comm const mpi_comm;
 };
 
+/*
+ * GMRES method with two global reductions per iteration, see LowSynchronizationGMRES. Uses the
+ * same parameters as SolverGMRES except for compute_eigenvalues, which is not supported.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverLowSynchronizationGMRES : public SolverBase<VectorType>
+{
+public:
+  SolverLowSynchronizationGMRES(Operator const &        underlying_operator_in,
+                                Preconditioner &        preconditioner_in,
+                                SolverDataGMRES const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+    AssertThrow(not solver_data.compute_eigenvalues,
+                dealii::ExcMessage("The low-synchronization GMRES solver can not compute "
+                                   "eigenvalues. Use SolverGMRES instead."));
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      if(preconditioner.needs_update() or update_preconditioner)
+      {
+        preconditioner.update();
+      }
+    }
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    ProfilingRegion region(this->timer_tree, {"SolverLowSynchronizationGMRES"});
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    typename LowSynchronizationGMRES<VectorType>::AdditionalData additional_data;
+    additional_data.max_n_tmp_vectors = solver_data.max_n_tmp_vectors;
+    LowSynchronizationGMRES<VectorType> solver(solver_control, additional_data);
+
+    if(solver_data.use_preconditioner == false)
+    {
+      solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+    }
+    else
+    {
+      solver.solve(underlying_operator, dst, rhs, preconditioner);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      this->timer_tree->insert({"SolverLowSynchronizationGMRES"}, preconditioner.get_timings());
+    }
+
+    return this->timer_tree;
+  }
+
+private:
+  Operator const &      underlying_operator;
+  Preconditioner &      preconditioner;
+  SolverDataGMRES const solver_data;
+};
+
 struct SolverDataFGMRES
 {
   SolverDataFGMRES()
@@ -360,10 +743,26 @@ public:
     }
   }
 
+  void
+  set_relative_tolerance(double const tolerance) override
+  {
+    solver_data.solver_tolerance_rel = tolerance;
+  }
+
+  /*
+   * The function monitor is called in every iteration with the iteration number and the norm of
+   * the residual, e.g. to adapt the tolerances of inner solves applied within the preconditioner.
+   */
+  void
+  set_residual_monitor(std::function<void(unsigned int const, double const)> const & monitor)
+  {
+    residual_monitor = monitor;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
-    dealii::Timer timer;
+    ProfilingRegion region(this->timer_tree, {"SolverFGMRES"});
 
     dealii::ReductionControl solver_control(solver_data.max_iter,
                                             solver_data.solver_tolerance_abs,
@@ -375,6 +774,14 @@ public:
 
     dealii::SolverFGMRES<VectorType> solver(solver_control, additional_data);
 
+    if(residual_monitor)
+    {
+      solver.connect([&](unsigned int const step, double const residual, VectorType const &) {
+        residual_monitor(step, residual);
+        return dealii::SolverControl::success;
+      });
+    }
+
     if(solver_data.use_preconditioner == false)
     {
       solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
@@ -390,8 +797,6 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
-    this->timer_tree->insert({"SolverFGMRES"}, timer.wall_time());
-
     return solver_control.last_step();
   }
 
@@ -407,9 +812,98 @@ public:
   }
 
 private:
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataFGMRES solver_data;
+
+  std::function<void(unsigned int const, double const)> residual_monitor;
+};
+
+/*
+ * FGMRES with a recycled subspace carried over from one call of solve() to the next, see
+ * RecyclingFGMRES. Uses the same parameters as SolverFGMRES.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverRecyclingFGMRES : public SolverBase<VectorType>
+{
+public:
+  SolverRecyclingFGMRES(Operator const &         underlying_operator_in,
+                        Preconditioner &         preconditioner_in,
+                        SolverDataFGMRES const & solver_data_in,
+                        unsigned int const       n_recycled_vectors)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in),
+      solver(make_additional_data(solver_data_in, n_recycled_vectors))
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      if(preconditioner.needs_update() or update_preconditioner)
+      {
+        preconditioner.update();
+      }
+    }
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    ProfilingRegion region(this->timer_tree, {"SolverRecyclingFGMRES"});
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    if(solver_data.use_preconditioner == false)
+    {
+      solver.solve(solver_control, underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+    }
+    else
+    {
+      solver.solve(solver_control, underlying_operator, dst, rhs, preconditioner);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      this->timer_tree->insert({"SolverRecyclingFGMRES"}, preconditioner.get_timings());
+    }
+
+    return this->timer_tree;
+  }
+
+private:
+  static typename RecyclingFGMRES<VectorType>::AdditionalData
+  make_additional_data(SolverDataFGMRES const & solver_data, unsigned int const n_recycled_vectors)
+  {
+    typename RecyclingFGMRES<VectorType>::AdditionalData additional_data;
+    additional_data.max_n_tmp_vectors  = solver_data.max_n_tmp_vectors;
+    additional_data.n_recycled_vectors = n_recycled_vectors;
+    return additional_data;
+  }
+
   Operator const &       underlying_operator;
   Preconditioner &       preconditioner;
   SolverDataFGMRES const solver_data;
+
+  // holds the recycled subspace
+  mutable RecyclingFGMRES<VectorType> solver;
 };
 } // namespace Krylov
 
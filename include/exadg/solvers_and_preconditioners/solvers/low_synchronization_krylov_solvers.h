@@ -0,0 +1,516 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_LOW_SYNCHRONIZATION_KRYLOV_SOLVERS_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_LOW_SYNCHRONIZATION_KRYLOV_SOLVERS_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/solver_control.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Krylov solvers for distributed vectors that reduce the number of global reductions and of
+ * sweeps over the vectors per iteration, which limit the strong scaling at small numbers of
+ * unknowns per process. The vector updates are done on the locally owned entries, i.e., the
+ * solution vector must not hold ghost values when calling solve().
+ */
+
+/*
+ * Detects operators providing vmult(dst, src, operation_before, operation_after), where the
+ * operations are applied to index ranges of the locally owned entries within the matrix-free
+ * loop, see OperatorBase::vmult().
+ */
+template<typename Operator, typename VectorType, typename = void>
+struct HasVmultWithOperations : std::false_type
+{
+};
+
+template<typename Operator, typename VectorType>
+struct HasVmultWithOperations<
+  Operator,
+  VectorType,
+  std::void_t<decltype(std::declval<Operator const &>().vmult(
+    std::declval<VectorType &>(),
+    std::declval<VectorType const &>(),
+    std::declval<std::function<void(unsigned int const, unsigned int const)>>(),
+    std::declval<std::function<void(unsigned int const, unsigned int const)>>()))>>
+  : std::true_type
+{
+};
+
+/*
+ * Preconditioned CG method with fused vector operations and merged reductions. An iteration
+ * consists of
+ *
+ *  - the operator application v = A p, where the update p = z + beta p and the local part of
+ *    (p,v) are done within the matrix-free loop in case the operator supports it (see
+ *    HasVmultWithOperations), i.e., while the vector entries are in cache,
+ *  - one sweep updating x and r and computing the local part of (r,r),
+ *  - the preconditioner application z = P r followed by the local part of (r,z),
+ *
+ * with two global reductions, one for (p,v) and one for (r,r) and (r,z) together, compared to
+ * three reductions and five separate vector operations of dealii::SolverCG without fusion. The
+ * iterates coincide with the standard preconditioned CG method.
+ */
+template<typename VectorType>
+class FusedCG
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  FusedCG(dealii::SolverControl & solver_control) : solver_control(solver_control)
+  {
+  }
+
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(Operator const &       matrix,
+        VectorType &           x,
+        VectorType const &     b,
+        Preconditioner const & preconditioner)
+  {
+    MPI_Comm const mpi_comm = b.get_mpi_communicator();
+
+    VectorType r, z, p, v;
+    for(VectorType * vector : {&r, &z, &p, &v})
+      vector->reinit(b);
+
+    unsigned int const size = b.locally_owned_size();
+
+    // r = b - A x, z = P r
+    matrix.vmult(r, x);
+    r.sadd(-1.0, 1.0, b);
+    preconditioner.vmult(z, r);
+
+    // (r,r) and (r,z) in one reduction
+    double sums[2] = {0.0, 0.0};
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      sums[0] += r.local_element(i) * r.local_element(i);
+      sums[1] += r.local_element(i) * z.local_element(i);
+    }
+    dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(sums, 2),
+                                mpi_comm,
+                                dealii::ArrayView<double>(sums, 2));
+
+    double rz   = sums[1];
+    double beta = 0.0;
+
+    dealii::SolverControl::State state = solver_control.check(0, std::sqrt(sums[0]));
+    for(unsigned int iteration = 1; state == dealii::SolverControl::iterate; ++iteration)
+    {
+      // p = z + beta p, v = A p, and the local part of (p,v)
+      double p_dot_v = 0.0;
+      if constexpr(HasVmultWithOperations<Operator, VectorType>::value)
+      {
+        matrix.vmult(
+          v,
+          p,
+          [&](unsigned int const start_range, unsigned int const end_range) {
+            for(unsigned int i = start_range; i < end_range; ++i)
+            {
+              p.local_element(i) = z.local_element(i) + beta * p.local_element(i);
+              v.local_element(i) = 0.0;
+            }
+          },
+          [&](unsigned int const start_range, unsigned int const end_range) {
+            for(unsigned int i = start_range; i < end_range; ++i)
+              p_dot_v += p.local_element(i) * v.local_element(i);
+          });
+      }
+      else
+      {
+        p.sadd(beta, 1.0, z);
+        matrix.vmult(v, p);
+        for(unsigned int i = 0; i < size; ++i)
+          p_dot_v += p.local_element(i) * v.local_element(i);
+      }
+      p_dot_v = dealii::Utilities::MPI::sum(p_dot_v, mpi_comm);
+
+      AssertThrow(p_dot_v > 0.0,
+                  dealii::ExcMessage("The operator of the CG method is not positive definite."));
+
+      double const alpha = rz / p_dot_v;
+
+      // x += alpha p, r -= alpha v, and the local part of (r,r)
+      sums[0] = 0.0;
+      for(unsigned int i = 0; i < size; ++i)
+      {
+        x.local_element(i) += alpha * p.local_element(i);
+        Number const r_i = r.local_element(i) - alpha * v.local_element(i);
+        r.local_element(i) = r_i;
+        sums[0] += r_i * r_i;
+      }
+
+      preconditioner.vmult(z, r);
+
+      sums[1] = 0.0;
+      for(unsigned int i = 0; i < size; ++i)
+        sums[1] += r.local_element(i) * z.local_element(i);
+
+      dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(sums, 2),
+                                  mpi_comm,
+                                  dealii::ArrayView<double>(sums, 2));
+
+      beta = sums[1] / rz;
+      rz   = sums[1];
+
+      state = solver_control.check(iteration, std::sqrt(sums[0]));
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  dealii::SolverControl & solver_control;
+};
+
+/*
+ * Preconditioned pipelined conjugate gradient method according to Ghysels and Vanroose (2014),
+ * Algorithm 4: The inner products (r,u), (w,u), and (r,r) of an iteration are combined into a
+ * single non-blocking reduction (MPI_Iallreduce), which is overlapped with the application of the
+ * preconditioner and the operator. In exact arithmetic, the iterates coincide with the standard
+ * preconditioned CG method. The price is four additional vectors and a slightly larger
+ * accumulation of round-off errors in the recursively updated residual, which is the residual
+ * checked by the solver control.
+ */
+template<typename VectorType>
+class PipelinedCG
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  PipelinedCG(dealii::SolverControl & solver_control) : solver_control(solver_control)
+  {
+  }
+
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(Operator const &       matrix,
+        VectorType &           x,
+        VectorType const &     b,
+        Preconditioner const & preconditioner)
+  {
+    MPI_Comm const mpi_comm = b.get_mpi_communicator();
+
+    VectorType r, u, w, m, n, z, q, s, p;
+    for(VectorType * vector : {&r, &u, &w, &m, &n, &z, &q, &s, &p})
+      vector->reinit(b);
+
+    // r = b - A x, u = P r, w = A u
+    matrix.vmult(r, x);
+    r.sadd(-1.0, 1.0, b);
+    preconditioner.vmult(u, r);
+    matrix.vmult(w, u);
+
+    unsigned int const size = b.locally_owned_size();
+
+    // local contributions to (r,u), (w,u), (r,r)
+    double sums[3] = {0.0, 0.0, 0.0};
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      sums[0] += r.local_element(i) * u.local_element(i);
+      sums[1] += w.local_element(i) * u.local_element(i);
+      sums[2] += r.local_element(i) * r.local_element(i);
+    }
+
+    double gamma_old = 1.0, alpha_old = 1.0;
+
+    dealii::SolverControl::State state = dealii::SolverControl::iterate;
+    for(unsigned int iteration = 0; true; ++iteration)
+    {
+      MPI_Request request;
+      MPI_Iallreduce(MPI_IN_PLACE, sums, 3, MPI_DOUBLE, MPI_SUM, mpi_comm, &request);
+
+      // m = P w, n = A m while the reduction is in flight
+      preconditioner.vmult(m, w);
+      matrix.vmult(n, m);
+
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+      double const gamma = sums[0];
+      double const delta = sums[1];
+
+      state = solver_control.check(iteration, std::sqrt(sums[2]));
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      double beta = 0.0, alpha = gamma / delta;
+      if(iteration > 0)
+      {
+        beta  = gamma / gamma_old;
+        alpha = gamma / (delta - beta * gamma / alpha_old);
+      }
+
+      // all vector updates in a single sweep over the vectors, which also computes the local
+      // contributions to the inner products of the next iteration
+      sums[0] = sums[1] = sums[2] = 0.0;
+      for(unsigned int i = 0; i < size; ++i)
+      {
+        Number const z_i = n.local_element(i) + beta * z.local_element(i);
+        Number const q_i = m.local_element(i) + beta * q.local_element(i);
+        Number const s_i = w.local_element(i) + beta * s.local_element(i);
+        Number const p_i = u.local_element(i) + beta * p.local_element(i);
+
+        x.local_element(i) += alpha * p_i;
+        Number const r_i = r.local_element(i) - alpha * s_i;
+        Number const u_i = u.local_element(i) - alpha * q_i;
+        Number const w_i = w.local_element(i) - alpha * z_i;
+
+        z.local_element(i) = z_i;
+        q.local_element(i) = q_i;
+        s.local_element(i) = s_i;
+        p.local_element(i) = p_i;
+        r.local_element(i) = r_i;
+        u.local_element(i) = u_i;
+        w.local_element(i) = w_i;
+
+        sums[0] += r_i * u_i;
+        sums[1] += w_i * u_i;
+        sums[2] += r_i * r_i;
+      }
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  dealii::SolverControl & solver_control;
+};
+
+/*
+ * Restarted GMRES method with right preconditioning, where the Arnoldi vectors are
+ * orthogonalized by classical Gram-Schmidt with one re-orthogonalization (CGS2). The inner
+ * products of a Gram-Schmidt pass are computed in a single reduction and the norm of the new
+ * Arnoldi vector is obtained from the second pass, so that an iteration needs two global
+ * reductions independently of the size of the Krylov space, instead of j+2 reductions of the
+ * modified Gram-Schmidt method in the j-th iteration.
+ */
+template<typename VectorType>
+class LowSynchronizationGMRES
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  struct AdditionalData
+  {
+    AdditionalData() : max_n_tmp_vectors(30)
+    {
+    }
+
+    unsigned int max_n_tmp_vectors;
+  };
+
+  LowSynchronizationGMRES(dealii::SolverControl & solver_control,
+                          AdditionalData const &  additional_data = AdditionalData())
+    : solver_control(solver_control), additional_data(additional_data)
+  {
+    AssertThrow(additional_data.max_n_tmp_vectors >= 2,
+                dealii::ExcMessage("GMRES needs at least two basis vectors."));
+  }
+
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(Operator const &       matrix,
+        VectorType &           x,
+        VectorType const &     b,
+        Preconditioner const & preconditioner)
+  {
+    MPI_Comm const mpi_comm = b.get_mpi_communicator();
+
+    unsigned int const max_size = additional_data.max_n_tmp_vectors - 1;
+
+    std::vector<VectorType> basis(max_size + 1);
+    for(VectorType & vector : basis)
+      vector.reinit(b);
+
+    VectorType r, z, w;
+    r.reinit(b);
+    z.reinit(b);
+    w.reinit(b);
+
+    // Hessenberg matrix (column-major), Givens rotations, and right-hand side of the least-squares
+    // problem
+    std::vector<double> H((max_size + 1) * max_size), cosines(max_size), sines(max_size),
+      g(max_size + 1), h(max_size + 2), c(max_size + 2);
+
+    unsigned int                 iteration = 0;
+    dealii::SolverControl::State state     = dealii::SolverControl::iterate;
+    while(state == dealii::SolverControl::iterate)
+    {
+      // r = b - A x
+      matrix.vmult(r, x);
+      r.sadd(-1.0, 1.0, b);
+
+      double const norm_r = r.l2_norm();
+
+      state = solver_control.check(iteration, norm_r);
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      basis[0].equ(1.0 / norm_r, r);
+      std::fill(g.begin(), g.end(), 0.0);
+      g[0] = norm_r;
+
+      unsigned int size = 0;
+      while(size < max_size and state == dealii::SolverControl::iterate)
+      {
+        unsigned int const j = size;
+
+        // w = A P v_j
+        preconditioner.vmult(z, basis[j]);
+        matrix.vmult(w, z);
+
+        // first Gram-Schmidt pass
+        project(basis, j + 1, w, h, false, mpi_comm);
+
+        // second Gram-Schmidt pass, which also yields (w,w)
+        project(basis, j + 1, w, c, true, mpi_comm);
+
+        double norm_c_squared = 0.0;
+        for(unsigned int k = 0; k <= j; ++k)
+        {
+          h[k] += c[k];
+          norm_c_squared += c[k] * c[k];
+        }
+
+        // (w,w) of the vector before the second pass minus the removed part gives the norm of
+        // the orthogonalized vector; recompute it explicitly in case of cancellation
+        double norm_w_squared = c[j + 1] - norm_c_squared;
+        if(norm_w_squared <= 1.e-4 * c[j + 1])
+          norm_w_squared = w.norm_sqr();
+        double const norm_w = std::sqrt(std::max(norm_w_squared, 0.0));
+
+        h[j + 1] = norm_w;
+        if(norm_w > 0.0)
+          basis[j + 1].equ(1.0 / norm_w, w);
+
+        // apply the previous Givens rotations to the new column and compute the new rotation
+        for(unsigned int k = 0; k < j; ++k)
+        {
+          double const tmp = cosines[k] * h[k] + sines[k] * h[k + 1];
+          h[k + 1]         = -sines[k] * h[k] + cosines[k] * h[k + 1];
+          h[k]             = tmp;
+        }
+        double const denominator = std::sqrt(h[j] * h[j] + h[j + 1] * h[j + 1]);
+        cosines[j]               = h[j] / denominator;
+        sines[j]                 = h[j + 1] / denominator;
+        h[j]                     = denominator;
+        g[j + 1]                 = -sines[j] * g[j];
+        g[j]                     = cosines[j] * g[j];
+
+        for(unsigned int k = 0; k <= j; ++k)
+          H[j * (max_size + 1) + k] = h[k];
+
+        ++size;
+        ++iteration;
+
+        state = solver_control.check(iteration, std::abs(g[j + 1]));
+      }
+
+      // solve the upper triangular system H y = g and update x += P V y
+      std::vector<double> y(size);
+      for(int k = size - 1; k >= 0; --k)
+      {
+        double sum = g[k];
+        for(unsigned int l = k + 1; l < size; ++l)
+          sum -= H[l * (max_size + 1) + k] * y[l];
+        y[k] = sum / H[k * (max_size + 1) + k];
+      }
+
+      r = 0.0;
+      for(unsigned int k = 0; k < size; ++k)
+        r.add(y[k], basis[k]);
+      preconditioner.vmult(z, r);
+      x += z;
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  /*
+   * Computes the coefficients v_k^T w of the first n_vectors basis vectors in a single reduction
+   * and subtracts the projection from w. If compute_norm is set, (w,w) of the input vector is
+   * computed in the same reduction and stored in coefficients[n_vectors].
+   */
+  void
+  project(std::vector<VectorType> const & basis,
+          unsigned int const              n_vectors,
+          VectorType &                    w,
+          std::vector<double> &           coefficients,
+          bool const                      compute_norm,
+          MPI_Comm const &                mpi_comm) const
+  {
+    unsigned int const size      = w.locally_owned_size();
+    unsigned int const n_entries = compute_norm ? n_vectors + 1 : n_vectors;
+
+    std::vector<double> local(n_entries, 0.0);
+    for(unsigned int k = 0; k < n_vectors; ++k)
+      for(unsigned int i = 0; i < size; ++i)
+        local[k] += basis[k].local_element(i) * w.local_element(i);
+    if(compute_norm)
+      for(unsigned int i = 0; i < size; ++i)
+        local[n_vectors] += w.local_element(i) * w.local_element(i);
+
+    std::vector<double> global(n_entries);
+    dealii::Utilities::MPI::sum(local, mpi_comm, global);
+    std::copy(global.begin(), global.end(), coefficients.begin());
+
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      double sum = 0.0;
+      for(unsigned int k = 0; k < n_vectors; ++k)
+        sum += coefficients[k] * basis[k].local_element(i);
+      w.local_element(i) -= sum;
+    }
+  }
+
+  dealii::SolverControl & solver_control;
+
+  AdditionalData const additional_data;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_LOW_SYNCHRONIZATION_KRYLOV_SOLVERS_H_ */
@@ -0,0 +1,234 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIPLE_RHS_CG_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIPLE_RHS_CG_H_
+
+// C/C++
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/solver_control.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Preconditioned CG method for several right-hand sides b[i] of the same linear system. The CG
+ * recurrences of the individual systems are run side by side, such that one iteration applies
+ * the operator to the search directions of all systems that have not yet converged within a
+ * single matrix-free loop, see OperatorBase::vmult_multiple(), and the inner products of all
+ * systems are summed up in one global reduction. Each system converges according to its own
+ * copy of the solver control passed to the constructor, i.e., the iterates and iteration numbers
+ * coincide with those of separate preconditioned CG solves. The solution vectors must not hold
+ * ghost values when calling solve().
+ *
+ * The operator needs to provide the function
+ *
+ *   vmult_multiple(std::vector<VectorType *> const & dst, std::vector<VectorType *> const & src),
+ *
+ * and the preconditioner is applied to each system separately via vmult(dst, src).
+ */
+template<typename VectorType>
+class MultipleRHSCG
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  MultipleRHSCG(dealii::ReductionControl const & solver_control) : solver_control(solver_control)
+  {
+  }
+
+  /*
+   * Returns the number of iterations of each system.
+   */
+  template<typename Operator, typename Preconditioner>
+  std::vector<unsigned int>
+  solve(Operator const &                        matrix,
+        std::vector<VectorType *> const &       x,
+        std::vector<VectorType const *> const & b,
+        Preconditioner const &                  preconditioner) const
+  {
+    AssertThrow(x.size() == b.size(),
+                dealii::ExcMessage("MultipleRHSCG requires one solution vector per right-hand "
+                                   "side."));
+
+    unsigned int const n_systems = b.size();
+    if(n_systems == 0)
+      return {};
+
+    MPI_Comm const     mpi_comm = b[0]->get_mpi_communicator();
+    unsigned int const size     = b[0]->locally_owned_size();
+
+    std::vector<VectorType> r(n_systems), z(n_systems), p(n_systems), v(n_systems);
+    for(unsigned int i = 0; i < n_systems; ++i)
+    {
+      r[i].reinit(*b[i]);
+      z[i].reinit(*b[i]);
+      p[i].reinit(*b[i]);
+      v[i].reinit(*b[i]);
+    }
+
+    std::vector<dealii::ReductionControl>     controls(n_systems, solver_control);
+    std::vector<dealii::SolverControl::State> states(n_systems);
+
+    // r = b - A x, z = P r
+    matrix.vmult_multiple(pointers(r, all_systems(n_systems)), x);
+
+    std::vector<double> sums(2 * n_systems, 0.0);
+    for(unsigned int i = 0; i < n_systems; ++i)
+    {
+      r[i].sadd(-1.0, 1.0, *b[i]);
+      preconditioner.vmult(z[i], r[i]);
+
+      for(unsigned int j = 0; j < size; ++j)
+      {
+        sums[2 * i] += r[i].local_element(j) * r[i].local_element(j);
+        sums[2 * i + 1] += r[i].local_element(j) * z[i].local_element(j);
+      }
+    }
+    sum(sums, mpi_comm);
+
+    std::vector<double> rz(n_systems), beta(n_systems, 0.0);
+
+    std::vector<unsigned int> active;
+    for(unsigned int i = 0; i < n_systems; ++i)
+    {
+      rz[i]     = sums[2 * i + 1];
+      states[i] = controls[i].check(0, std::sqrt(sums[2 * i]));
+      if(states[i] == dealii::SolverControl::iterate)
+        active.push_back(i);
+    }
+
+    for(unsigned int iteration = 1; not active.empty(); ++iteration)
+    {
+      // p = z + beta p, v = A p
+      for(unsigned int const i : active)
+        p[i].sadd(beta[i], 1.0, z[i]);
+
+      matrix.vmult_multiple(pointers(v, active), pointers(p, active));
+
+      // (p,v) of all active systems in one reduction
+      std::vector<double> p_dot_v(active.size(), 0.0);
+      for(unsigned int k = 0; k < active.size(); ++k)
+      {
+        unsigned int const i = active[k];
+        for(unsigned int j = 0; j < size; ++j)
+          p_dot_v[k] += p[i].local_element(j) * v[i].local_element(j);
+      }
+      sum(p_dot_v, mpi_comm);
+
+      // x += alpha p, r -= alpha v, z = P r, and the local parts of (r,r) and (r,z)
+      sums.assign(2 * active.size(), 0.0);
+      for(unsigned int k = 0; k < active.size(); ++k)
+      {
+        unsigned int const i = active[k];
+
+        AssertThrow(p_dot_v[k] > 0.0,
+                    dealii::ExcMessage("The operator of the CG method is not positive definite."));
+
+        double const alpha = rz[i] / p_dot_v[k];
+
+        for(unsigned int j = 0; j < size; ++j)
+        {
+          x[i]->local_element(j) += alpha * p[i].local_element(j);
+          Number const r_j = r[i].local_element(j) - alpha * v[i].local_element(j);
+          r[i].local_element(j) = r_j;
+          sums[2 * k] += r_j * r_j;
+        }
+
+        preconditioner.vmult(z[i], r[i]);
+
+        for(unsigned int j = 0; j < size; ++j)
+          sums[2 * k + 1] += r[i].local_element(j) * z[i].local_element(j);
+      }
+      sum(sums, mpi_comm);
+
+      std::vector<unsigned int> still_active;
+      for(unsigned int k = 0; k < active.size(); ++k)
+      {
+        unsigned int const i = active[k];
+
+        beta[i] = sums[2 * k + 1] / rz[i];
+        rz[i]   = sums[2 * k + 1];
+
+        states[i] = controls[i].check(iteration, std::sqrt(sums[2 * k]));
+        if(states[i] == dealii::SolverControl::iterate)
+          still_active.push_back(i);
+      }
+      active.swap(still_active);
+    }
+
+    std::vector<unsigned int> n_iterations(n_systems);
+    for(unsigned int i = 0; i < n_systems; ++i)
+    {
+      AssertThrow(states[i] == dealii::SolverControl::success,
+                  dealii::SolverControl::NoConvergence(controls[i].last_step(),
+                                                       controls[i].last_value()));
+
+      n_iterations[i] = controls[i].last_step();
+    }
+
+    return n_iterations;
+  }
+
+private:
+  static std::vector<unsigned int>
+  all_systems(unsigned int const n_systems)
+  {
+    std::vector<unsigned int> indices(n_systems);
+    for(unsigned int i = 0; i < n_systems; ++i)
+      indices[i] = i;
+
+    return indices;
+  }
+
+  static std::vector<VectorType *>
+  pointers(std::vector<VectorType> & vectors, std::vector<unsigned int> const & indices)
+  {
+    std::vector<VectorType *> result;
+    result.reserve(indices.size());
+    for(unsigned int const i : indices)
+      result.push_back(&vectors[i]);
+
+    return result;
+  }
+
+  static void
+  sum(std::vector<double> & values, MPI_Comm const & mpi_comm)
+  {
+    dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(values.data(), values.size()),
+                                mpi_comm,
+                                dealii::ArrayView<double>(values.data(), values.size()));
+  }
+
+  dealii::ReductionControl const solver_control;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIPLE_RHS_CG_H_ */
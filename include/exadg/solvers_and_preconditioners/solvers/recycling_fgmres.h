@@ -0,0 +1,294 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_RECYCLING_FGMRES_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_RECYCLING_FGMRES_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/solver_control.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Flexible GMRES with Krylov subspace recycling across a sequence of linear systems with slowly
+ * changing matrices (GCRO method with a recycled subspace, see Parks et al. (2006), "Recycling
+ * Krylov subspaces for sequences of linear systems"). The solver keeps a subspace U across calls
+ * of solve(). At the beginning of each solve, C = A U is computed for the current matrix and
+ * orthonormalized, the component of the residual in range(C) is eliminated, and the flexible
+ * GMRES iteration is applied to the deflated operator (I - C C^T) A. The recycled subspace
+ * consists of the latest solution corrections x - x_0 instead of the harmonic Ritz vectors
+ * selected by GCRO-DR, which avoids the solution of generalized eigenvalue problems and works
+ * with variable preconditioners.
+ *
+ * The costs per solve are n_recycled_vectors + 1 additional operator evaluations and the storage
+ * of 2 n_recycled_vectors vectors.
+ */
+template<typename VectorType>
+class RecyclingFGMRES
+{
+public:
+  struct AdditionalData
+  {
+    AdditionalData() : max_n_tmp_vectors(30), n_recycled_vectors(10)
+    {
+    }
+
+    unsigned int max_n_tmp_vectors;
+    unsigned int n_recycled_vectors;
+  };
+
+  RecyclingFGMRES(AdditionalData const & additional_data) : additional_data(additional_data)
+  {
+    AssertThrow(additional_data.max_n_tmp_vectors >= 2,
+                dealii::ExcMessage("GMRES needs at least two basis vectors."));
+  }
+
+  /*
+   * Removes the recycled subspace, e.g. if the next linear system is unrelated to the previous
+   * ones.
+   */
+  void
+  clear()
+  {
+    U.clear();
+    C.clear();
+  }
+
+  unsigned int
+  n_recycled_vectors() const
+  {
+    return U.size();
+  }
+
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(dealii::SolverControl & solver_control,
+        Operator const &        matrix,
+        VectorType &            x,
+        VectorType const &      b,
+        Preconditioner const &  preconditioner)
+  {
+    update_recycled_subspace(matrix);
+
+    unsigned int const max_size = additional_data.max_n_tmp_vectors - 1;
+    unsigned int const k        = U.size();
+
+    std::vector<VectorType> V(max_size + 1), Z(max_size);
+    for(VectorType & vector : V)
+      vector.reinit(b, true);
+    for(VectorType & vector : Z)
+      vector.reinit(b, true);
+
+    VectorType r, w, x_initial(x);
+    r.reinit(b, true);
+    w.reinit(b, true);
+
+    // Hessenberg matrix and coefficients C^T A Z (column-major), Givens rotations, right-hand side
+    // of the least-squares problem
+    std::vector<double> H((max_size + 1) * max_size), B(k * max_size), cosines(max_size),
+      sines(max_size), g(max_size + 1);
+
+    unsigned int                 iteration = 0;
+    dealii::SolverControl::State state     = dealii::SolverControl::iterate;
+    while(state == dealii::SolverControl::iterate)
+    {
+      // r = b - A x, followed by the elimination of the component in range(C)
+      matrix.vmult(r, x);
+      r.sadd(-1.0, 1.0, b);
+      for(unsigned int i = 0; i < k; ++i)
+      {
+        double const alpha = C[i] * r;
+        x.add(alpha, U[i]);
+        r.add(-alpha, C[i]);
+      }
+
+      double const norm_r = r.l2_norm();
+
+      state = solver_control.check(iteration, norm_r);
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      V[0].equ(1.0 / norm_r, r);
+      std::fill(g.begin(), g.end(), 0.0);
+      g[0] = norm_r;
+
+      unsigned int size = 0;
+      while(size < max_size and state == dealii::SolverControl::iterate)
+      {
+        unsigned int const j = size;
+
+        // w = (I - C C^T) A P v_j
+        preconditioner.vmult(Z[j], V[j]);
+        matrix.vmult(w, Z[j]);
+        for(unsigned int i = 0; i < k; ++i)
+        {
+          B[j * k + i] = C[i] * w;
+          w.add(-B[j * k + i], C[i]);
+        }
+
+        // Arnoldi process with modified Gram-Schmidt
+        double * h = &H[j * (max_size + 1)];
+        for(unsigned int l = 0; l <= j; ++l)
+        {
+          h[l] = V[l] * w;
+          w.add(-h[l], V[l]);
+        }
+        h[j + 1] = w.l2_norm();
+        if(h[j + 1] > 0.0)
+          V[j + 1].equ(1.0 / h[j + 1], w);
+
+        // Givens rotations
+        for(unsigned int l = 0; l < j; ++l)
+        {
+          double const tmp = cosines[l] * h[l] + sines[l] * h[l + 1];
+          h[l + 1]         = -sines[l] * h[l] + cosines[l] * h[l + 1];
+          h[l]             = tmp;
+        }
+        double const denominator = std::sqrt(h[j] * h[j] + h[j + 1] * h[j + 1]);
+        cosines[j]               = h[j] / denominator;
+        sines[j]                 = h[j + 1] / denominator;
+        h[j]                     = denominator;
+        h[j + 1]                 = 0.0;
+        g[j + 1]                 = -sines[j] * g[j];
+        g[j]                     = cosines[j] * g[j];
+
+        ++size;
+        ++iteration;
+
+        state = solver_control.check(iteration, std::abs(g[j + 1]));
+      }
+
+      // solve the upper triangular system H y = g and update x += Z y - U B y
+      std::vector<double> y(size);
+      for(int l = size - 1; l >= 0; --l)
+      {
+        double sum = g[l];
+        for(unsigned int m = l + 1; m < size; ++m)
+          sum -= H[m * (max_size + 1) + l] * y[m];
+        y[l] = sum / H[l * (max_size + 1) + l];
+      }
+
+      for(unsigned int l = 0; l < size; ++l)
+        x.add(y[l], Z[l]);
+      for(unsigned int i = 0; i < k; ++i)
+      {
+        double coefficient = 0.0;
+        for(unsigned int l = 0; l < size; ++l)
+          coefficient += B[l * k + i] * y[l];
+        x.add(-coefficient, U[i]);
+      }
+    }
+
+    // add the solution correction to the recycled subspace
+    if(additional_data.n_recycled_vectors > 0)
+    {
+      w = x;
+      w -= x_initial;
+      add_to_recycled_subspace(matrix, w);
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  /*
+   * Recomputes C = A U for the current matrix and orthonormalizes C by modified Gram-Schmidt,
+   * where U is transformed accordingly so that C = A U holds. Linearly dependent vectors are
+   * removed.
+   */
+  template<typename Operator>
+  void
+  update_recycled_subspace(Operator const & matrix)
+  {
+    std::vector<VectorType> U_old, C_old;
+    U_old.swap(U);
+    C_old.swap(C);
+
+    for(unsigned int i = 0; i < U_old.size(); ++i)
+    {
+      matrix.vmult(C_old[i], U_old[i]);
+      add_orthonormalized(U_old[i], C_old[i]);
+    }
+  }
+
+  template<typename Operator>
+  void
+  add_to_recycled_subspace(Operator const & matrix, VectorType const & u)
+  {
+    if(U.size() == additional_data.n_recycled_vectors)
+    {
+      U.erase(U.begin());
+      C.erase(C.begin());
+    }
+
+    VectorType u_new(u), c_new;
+    c_new.reinit(u, true);
+    matrix.vmult(c_new, u_new);
+    add_orthonormalized(u_new, c_new);
+  }
+
+  /*
+   * Orthonormalizes c against C (and applies the same operations to u) and adds the pair to the
+   * recycled subspace unless c is (numerically) contained in range(C).
+   */
+  void
+  add_orthonormalized(VectorType & u, VectorType & c)
+  {
+    double const norm_initial = c.l2_norm();
+
+    for(unsigned int i = 0; i < C.size(); ++i)
+    {
+      double const alpha = C[i] * c;
+      c.add(-alpha, C[i]);
+      u.add(-alpha, U[i]);
+    }
+
+    double const norm = c.l2_norm();
+    if(norm <= 1.e-10 * norm_initial or norm == 0.0)
+      return;
+
+    c /= norm;
+    u /= norm;
+
+    U.push_back(u);
+    C.push_back(c);
+  }
+
+  AdditionalData const additional_data;
+
+  // recycled subspace U and C = A U with orthonormal columns
+  std::vector<VectorType> U;
+  std::vector<VectorType> C;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_RECYCLING_FGMRES_H_ */
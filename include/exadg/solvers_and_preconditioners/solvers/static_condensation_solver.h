@@ -0,0 +1,375 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_STATIC_CONDENSATION_SOLVER_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_STATIC_CONDENSATION_SOLVER_H_
+
+// C/C++
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+#ifdef DEAL_II_WITH_TRILINOS
+/*
+ * Solver for symmetric interior penalty discretizations with nodal FE_DGQ elements (support points
+ * including the vertices of the cell) by static condensation of the cell interiors: The shape
+ * functions of the interior nodes vanish on all faces of the cell, so that the face integrals
+ * never couple interior unknowns of different cells and the block A_II of the interior unknowns
+ * is block-diagonal with one block per cell. The linear system is reduced to the Schur complement
+ *
+ *   S = A_FF - A_FI A_II^{-1} A_IF
+ *
+ * on the unknowns at the cell boundaries (the trace of the discrete solution), which is solved by
+ * the preconditioned CG method with algebraic multigrid applied to A_FF. The interior unknowns are
+ * recovered cell by cell afterwards. In contrast to hybridized methods, the discretization is not
+ * changed, i.e., the solution is the one of the original system. Since only (k+1)^d - (k-1)^d of
+ * the (k+1)^d unknowns of a cell remain in the condensed system, the savings grow with the
+ * polynomial degree k.
+ *
+ * The system matrix is assembled from the matrix-free operator, and S is applied via two
+ * products with the system matrix and the cell-wise inverses of A_II. For singular operators with
+ * constant kernel (pure Neumann problems), the condensed right-hand side is projected onto the
+ * range of S, i.e., the kernel of S are the constant trace functions.
+ */
+template<int dim, typename Operator, typename VectorType>
+class SolverStaticCondensation : public SolverBase<VectorType>
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorTypeDouble;
+
+  typedef dealii::TrilinosWrappers::PreconditionAMG::AdditionalData AMGData;
+
+  /*
+   * Schur complement S in the space of vectors with zero interior unknowns.
+   */
+  class SchurComplement
+  {
+  public:
+    SchurComplement(SolverStaticCondensation const & solver) : solver(solver)
+    {
+    }
+
+    void
+    vmult(VectorTypeDouble & dst, VectorTypeDouble const & src) const
+    {
+      // y_I = A_IF src, y_F = A_FF src
+      solver.system_matrix.vmult(solver.tmp_1, src);
+
+      // z_I = A_II^{-1} y_I, z_F = 0
+      solver.apply_inverse_interior(solver.tmp_2, solver.tmp_1);
+
+      // dst_F = A_FF src - A_FI z_I
+      solver.system_matrix.vmult(dst, solver.tmp_2);
+      dst.sadd(-1.0, 1.0, solver.tmp_1);
+
+      solver.set_interior_zero(dst);
+    }
+
+  private:
+    SolverStaticCondensation const & solver;
+  };
+
+  class TracePreconditioner
+  {
+  public:
+    TracePreconditioner(SolverStaticCondensation const & solver) : solver(solver)
+    {
+    }
+
+    void
+    vmult(VectorTypeDouble & dst, VectorTypeDouble const & src) const
+    {
+      solver.amg.vmult(dst, src);
+      solver.set_interior_zero(dst);
+    }
+
+  private:
+    SolverStaticCondensation const & solver;
+  };
+
+public:
+  SolverStaticCondensation(Operator const &     underlying_operator_in,
+                           SolverDataCG const & solver_data_in,
+                           AMGData const &      amg_data_in = AMGData())
+    : underlying_operator(underlying_operator_in),
+      solver_data(solver_data_in),
+      amg_data(amg_data_in),
+      is_set_up(false),
+      n_trace_unknowns(0)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(update_preconditioner or not is_set_up)
+      setup();
+  }
+
+  void
+  set_relative_tolerance(double const tolerance) override
+  {
+    solver_data.solver_tolerance_rel = tolerance;
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    ProfilingRegion region(this->timer_tree, {"SolverStaticCondensation"});
+
+    if(not is_set_up)
+      setup();
+
+    rhs_full.copy_locally_owned_data_from(rhs);
+    solution.copy_locally_owned_data_from(dst);
+    set_interior_zero(solution);
+
+    // condensed right-hand side g = b_F - A_FI A_II^{-1} b_I
+    apply_inverse_interior(tmp_2, rhs_full);
+    system_matrix.vmult(rhs_trace, tmp_2);
+    rhs_trace.sadd(-1.0, 1.0, rhs_full);
+    set_interior_zero(rhs_trace);
+
+    if(underlying_operator.operator_is_singular())
+    {
+      double const mean = rhs_trace.mean_value() * rhs_trace.size() / n_trace_unknowns;
+      rhs_trace.add(-mean);
+      set_interior_zero(rhs_trace);
+    }
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    dealii::SolverCG<VectorTypeDouble> solver(solver_control);
+    solver.solve(SchurComplement(*this), solution, rhs_trace, TracePreconditioner(*this));
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    // interior unknowns x_I = A_II^{-1} (b_I - A_IF x_F)
+    system_matrix.vmult(tmp_1, solution);
+    tmp_1.sadd(-1.0, 1.0, rhs_full);
+    apply_inverse_interior(tmp_2, tmp_1);
+    solution += tmp_2;
+
+    dst.copy_locally_owned_data_from(solution);
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    return solver_control.last_step();
+  }
+
+private:
+  /*
+   * Assembles the system matrix, classifies the unknowns of each cell into interior and trace
+   * unknowns, and computes the Cholesky factors of the interior blocks and the AMG preconditioner
+   * of the trace block.
+   */
+  void
+  setup() const
+  {
+    auto const & dof_handler =
+      underlying_operator.get_matrix_free().get_dof_handler(underlying_operator.get_dof_index());
+    MPI_Comm const mpi_comm = dof_handler.get_communicator();
+
+    auto const &       fe            = dof_handler.get_fe();
+    unsigned int const dofs_per_cell = fe.n_dofs_per_cell();
+
+    AssertThrow(fe.has_support_points(),
+                dealii::ExcMessage("Static condensation requires nodal finite elements."));
+
+    std::vector<bool> is_interior(dofs_per_cell, false);
+    unsigned int      n_interior_per_cell = 0;
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+    {
+      dealii::Point<dim> const & point = fe.get_unit_support_points()[i];
+
+      bool interior = true;
+      for(unsigned int d = 0; d < dim; ++d)
+        if(point[d] < 1.e-10 or point[d] > 1.0 - 1.e-10)
+          interior = false;
+
+      is_interior[i] = interior;
+      if(interior)
+        ++n_interior_per_cell;
+    }
+
+    AssertThrow(dofs_per_cell ==
+                    dealii::Utilities::pow(fe.degree + 1, dim) and
+                  n_interior_per_cell ==
+                    dealii::Utilities::pow(fe.degree - 1, dim),
+                dealii::ExcMessage("Static condensation requires FE_DGQ elements with support "
+                                   "points at the vertices on hypercube meshes."));
+    AssertThrow(n_interior_per_cell > 0,
+                dealii::ExcMessage("Static condensation requires polynomial degrees of at least "
+                                   "2, since there are no interior unknowns otherwise."));
+
+    // system matrix
+    system_matrix.clear();
+    underlying_operator.init_system_matrix(system_matrix, mpi_comm);
+    underlying_operator.calculate_system_matrix(system_matrix);
+
+    dealii::IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+    dealii::IndexSet         locally_relevant_dofs;
+    dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+
+    VectorTypeDouble interior_indicator(locally_owned_dofs, locally_relevant_dofs, mpi_comm);
+
+    // interior blocks
+    interior_indices.clear();
+    interior_inverses.clear();
+
+    std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(not cell->is_locally_owned())
+        continue;
+
+      cell->get_dof_indices(dof_indices);
+
+      std::vector<dealii::types::global_dof_index> indices;
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        if(is_interior[i])
+          indices.push_back(dof_indices[i]);
+
+      dealii::LAPACKFullMatrix<double> matrix(n_interior_per_cell, n_interior_per_cell);
+      for(unsigned int i = 0; i < n_interior_per_cell; ++i)
+      {
+        interior_indicator(indices[i]) = 1.0;
+        for(unsigned int j = 0; j < n_interior_per_cell; ++j)
+          matrix(i, j) = system_matrix.el(indices[i], indices[j]);
+      }
+      matrix.compute_cholesky_factorization();
+
+      interior_indices.push_back(indices);
+      interior_inverses.push_back(std::move(matrix));
+    }
+
+    interior_indicator.update_ghost_values();
+
+    n_trace_unknowns = dof_handler.n_dofs() - dealii::Utilities::MPI::sum(
+                                                static_cast<dealii::types::global_dof_index>(
+                                                  interior_indices.size() * n_interior_per_cell),
+                                                mpi_comm);
+
+    // trace block A_FF, with the interior unknowns decoupled by unit rows and columns
+    trace_matrix.clear();
+    trace_matrix.copy_from(system_matrix);
+    for(auto const row : locally_owned_dofs)
+    {
+      bool const row_is_interior = interior_indicator(row) > 0.5;
+      for(auto entry = trace_matrix.begin(row); entry != trace_matrix.end(row); ++entry)
+      {
+        if(row_is_interior or interior_indicator(entry->column()) > 0.5)
+          entry->value() = (entry->column() == row) ? 1.0 : 0.0;
+      }
+    }
+    trace_matrix.compress(dealii::VectorOperation::insert);
+
+    amg.initialize(trace_matrix, amg_data);
+
+    // vectors
+    for(VectorTypeDouble * vector : {&rhs_full, &rhs_trace, &solution, &tmp_1, &tmp_2})
+      vector->reinit(locally_owned_dofs, mpi_comm);
+
+    is_set_up = true;
+  }
+
+  /*
+   * dst_I = A_II^{-1} src_I and dst_F = 0
+   */
+  void
+  apply_inverse_interior(VectorTypeDouble & dst, VectorTypeDouble const & src) const
+  {
+    dst = 0.0;
+
+    dealii::Vector<double> local_vector;
+    for(unsigned int c = 0; c < interior_indices.size(); ++c)
+    {
+      std::vector<dealii::types::global_dof_index> const & indices = interior_indices[c];
+
+      local_vector.reinit(indices.size());
+      for(unsigned int i = 0; i < indices.size(); ++i)
+        local_vector(i) = src(indices[i]);
+
+      interior_inverses[c].solve(local_vector);
+
+      for(unsigned int i = 0; i < indices.size(); ++i)
+        dst(indices[i]) = local_vector(i);
+    }
+  }
+
+  void
+  set_interior_zero(VectorTypeDouble & vector) const
+  {
+    for(auto const & indices : interior_indices)
+      for(auto const index : indices)
+        vector(index) = 0.0;
+  }
+
+  Operator const & underlying_operator;
+
+  SolverDataCG solver_data;
+
+  AMGData const amg_data;
+
+  mutable bool is_set_up;
+
+  mutable dealii::TrilinosWrappers::SparseMatrix system_matrix;
+  mutable dealii::TrilinosWrappers::SparseMatrix trace_matrix;
+
+  mutable dealii::TrilinosWrappers::PreconditionAMG amg;
+
+  // global indices and Cholesky factors of the interior unknowns of the locally owned cells
+  mutable std::vector<std::vector<dealii::types::global_dof_index>> interior_indices;
+  mutable std::vector<dealii::LAPACKFullMatrix<double>>             interior_inverses;
+
+  mutable dealii::types::global_dof_index n_trace_unknowns;
+
+  mutable VectorTypeDouble rhs_full, rhs_trace, solution, tmp_1, tmp_2;
+};
+#endif
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_STATIC_CONDENSATION_SOLVER_H_ */
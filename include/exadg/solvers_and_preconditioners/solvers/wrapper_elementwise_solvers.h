@@ -22,7 +22,12 @@
 #ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_WRAPPER_ELEMENTWISE_SOLVERS_H_
 #define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_WRAPPER_ELEMENTWISE_SOLVERS_H_
 
+// C/C++
+#include <cmath>
+
 // deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/operators.h>
 
@@ -67,8 +72,14 @@ public:
   IterativeSolver(Operator &                operator_in,
                   Preconditioner &          preconditioner_in,
                   IterativeSolverData const solver_data_in)
-    : op(operator_in), preconditioner(preconditioner_in), iterative_solver_data(solver_data_in)
+    : n_iterations_sum(0),
+      n_cell_batches(0),
+      op(operator_in),
+      preconditioner(preconditioner_in),
+      iterative_solver_data(solver_data_in)
   {
+    // allocate the workspace of the calling thread already at setup
+    get_workspace(op.get_matrix_free().get_dofs_per_cell(op.get_dof_index()));
   }
 
   virtual ~IterativeSolver()
@@ -85,19 +96,77 @@ public:
   }
 
   /**
-   * Solve function. This function may be called with identical dst, src vectors.
+   * Solve function. This function may be called with identical dst, src vectors. Returns the
+   * average number of iterations per cell batch over all processes (rounded up) as a measure of
+   * the cost of the elementwise solution.
    */
   unsigned int
   solve(VectorType & dst, VectorType const & src) const override
   {
     dst = 0;
 
+    n_iterations_sum = 0;
+    n_cell_batches   = 0;
+
     op.get_matrix_free().cell_loop(&THIS::solve_elementwise, this, dst, src);
 
-    return 0;
+    double const n_iterations_global =
+      dealii::Utilities::MPI::sum(static_cast<double>(n_iterations_sum),
+                                  dst.get_mpi_communicator());
+    double const n_cell_batches_global =
+      dealii::Utilities::MPI::sum(static_cast<double>(n_cell_batches), dst.get_mpi_communicator());
+
+    if(n_cell_batches_global > 0.0)
+      return static_cast<unsigned int>(std::ceil(n_iterations_global / n_cell_batches_global));
+    else
+      return 0;
   }
 
 private:
+  /*
+   * Memory needed to solve the elementwise problems of a cell batch. The workspace is allocated
+   * once per thread and reused for all cell batches and all calls to solve(), such that no memory
+   * is allocated in the cell loop.
+   */
+  struct Workspace
+  {
+    std::shared_ptr<
+      Elementwise::SolverBase<dealii::VectorizedArray<Number>, Operator, Preconditioner>>
+      solver;
+
+    dealii::AlignedVector<dealii::VectorizedArray<Number>> solution;
+  };
+
+  Workspace &
+  get_workspace(unsigned int const dofs_per_cell) const
+  {
+    Workspace & workspace = workspace_per_thread.get();
+
+    if(workspace.solver.get() == nullptr or workspace.solution.size() != dofs_per_cell)
+    {
+      workspace.solution.resize(dofs_per_cell);
+
+      if(iterative_solver_data.solver_type == Solver::CG)
+      {
+        workspace.solver = std::make_shared<
+          Elementwise::SolverCG<dealii::VectorizedArray<Number>, Operator, Preconditioner>>(
+          dofs_per_cell, iterative_solver_data.solver_data);
+      }
+      else if(iterative_solver_data.solver_type == Solver::GMRES)
+      {
+        workspace.solver = std::make_shared<
+          Elementwise::SolverGMRES<dealii::VectorizedArray<Number>, Operator, Preconditioner>>(
+          dofs_per_cell, iterative_solver_data.solver_data);
+      }
+      else
+      {
+        AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      }
+    }
+
+    return workspace;
+  }
+
   void
   solve_elementwise(dealii::MatrixFree<dim, Number> const &       matrix_free,
                     VectorType &                                  dst,
@@ -110,25 +179,9 @@ private:
 
     unsigned int const dofs_per_cell = integrator.dofs_per_cell;
 
-    dealii::AlignedVector<dealii::VectorizedArray<Number>> solution(dofs_per_cell);
+    Workspace & workspace = get_workspace(dofs_per_cell);
 
-    // setup elementwise solver
-    if(iterative_solver_data.solver_type == Solver::CG)
-    {
-      solver = std::make_shared<
-        Elementwise::SolverCG<dealii::VectorizedArray<Number>, Operator, Preconditioner>>(
-        dofs_per_cell, iterative_solver_data.solver_data);
-    }
-    else if(iterative_solver_data.solver_type == Solver::GMRES)
-    {
-      solver = std::make_shared<
-        Elementwise::SolverGMRES<dealii::VectorizedArray<Number>, Operator, Preconditioner>>(
-        dofs_per_cell, iterative_solver_data.solver_data);
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
+    dealii::AlignedVector<dealii::VectorizedArray<Number>> & solution = workspace.solution;
 
     // loop over all cells and solve local problem iteratively on each cell
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
@@ -141,7 +194,11 @@ private:
       preconditioner.setup(cell);
 
       // call iterative solver and solve on current cell
-      solver->solve(&op, solution.begin(), integrator.begin_dof_values(), &preconditioner);
+      n_iterations_sum += workspace.solver->solve(&op,
+                                                  solution.begin(),
+                                                  integrator.begin_dof_values(),
+                                                  &preconditioner);
+      ++n_cell_batches;
 
       // write solution on current element to global dof vector
       for(unsigned int j = 0; j < dofs_per_cell; ++j)
@@ -150,9 +207,11 @@ private:
     }
   }
 
-  mutable std::shared_ptr<
-    Elementwise::SolverBase<dealii::VectorizedArray<Number>, Operator, Preconditioner>>
-    solver;
+  mutable dealii::Threads::ThreadLocalStorage<Workspace> workspace_per_thread;
+
+  // statistics of the last call to solve()
+  mutable unsigned long long n_iterations_sum;
+  mutable unsigned long long n_cell_batches;
 
   Operator & op;
 
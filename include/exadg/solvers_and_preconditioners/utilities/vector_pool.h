@@ -0,0 +1,237 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_VECTOR_POOL_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_VECTOR_POOL_H_
+
+// C/C++
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/partitioner.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/thread_affinity.h>
+
+namespace ExaDG
+{
+/*
+ * Pool of temporary DoF vectors shared by the solvers and time integrators. Temporary vectors,
+ * e.g. right-hand side vectors of a time step or the increment of a Newton iteration, are
+ * otherwise allocated and freed in every time step or iteration, which involves the allocation of
+ * the memory and the first touch of all pages. The pool stores released vectors per partitioner
+ * and hands them out again for vectors with the same partitioner. The pool keeps a reference to
+ * the partitioner, such that the key remains unique, and drops the vectors of a partitioner once
+ * the partitioner is not used outside of the pool anymore, e.g. after adaptive mesh refinement.
+ */
+template<typename Number>
+class VectorPool
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  static VectorPool &
+  get()
+  {
+    static VectorPool pool;
+    return pool;
+  }
+
+  /*
+   * Returns a vector with the parallel layout of model, which is set to zero unless
+   * omit_zeroing_entries is true. The ghost values are not set.
+   */
+  std::unique_ptr<VectorType>
+  acquire(VectorType const & model, bool const omit_zeroing_entries = false)
+  {
+    std::unique_ptr<VectorType> vector;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      auto it = free_vectors.find(model.get_partitioner().get());
+      if(it != free_vectors.end() and not it->second.vectors.empty())
+      {
+        vector = std::move(it->second.vectors.back());
+        it->second.vectors.pop_back();
+      }
+    }
+
+    if(vector)
+    {
+      vector->zero_out_ghost_values();
+      if(not omit_zeroing_entries)
+        *vector = 0.0;
+    }
+    else
+    {
+      // allocate without zeroing such that the memory is touched first by the threads
+      vector = std::make_unique<VectorType>();
+      vector->reinit(model, true);
+      first_touch(*vector);
+    }
+
+    return vector;
+  }
+
+  /*
+   * Returns a vector to the pool.
+   */
+  void
+  release(std::unique_ptr<VectorType> vector)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Entry & entry = free_vectors[vector->get_partitioner().get()];
+    if(not entry.partitioner)
+      entry.partitioner = vector->get_partitioner();
+    entry.vectors.push_back(std::move(vector));
+
+    // drop the vectors of partitioners that are only referenced by the pool
+    for(auto it = free_vectors.begin(); it != free_vectors.end();)
+    {
+      if(it->second.partitioner.use_count() == long(it->second.vectors.size()) + 1)
+        it = free_vectors.erase(it);
+      else
+        ++it;
+    }
+  }
+
+  /*
+   * Frees all vectors of the pool.
+   */
+  void
+  clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    free_vectors.clear();
+  }
+
+  unsigned int
+  n_free_vectors() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    unsigned int n = 0;
+    for(auto const & it : free_vectors)
+      n += it.second.vectors.size();
+
+    return n;
+  }
+
+private:
+  VectorPool()
+  {
+  }
+
+  struct Entry
+  {
+    std::shared_ptr<dealii::Utilities::MPI::Partitioner const> partitioner;
+
+    std::vector<std::unique_ptr<VectorType>> vectors;
+  };
+
+  std::map<dealii::Utilities::MPI::Partitioner const *, Entry> free_vectors;
+
+  mutable std::mutex mutex;
+};
+
+/*
+ * Temporary vector with the parallel layout of a given vector, which is set to zero unless
+ * omit_zeroing_entries is true. Distributed vectors are taken from the VectorPool and returned to
+ * the pool at the end of the scope, other vector types, e.g. block vectors, are allocated.
+ */
+template<typename VectorType>
+class TemporaryVector
+{
+public:
+  TemporaryVector(VectorType const & model, bool const omit_zeroing_entries = false)
+  {
+    vector.reinit(model, omit_zeroing_entries);
+  }
+
+  TemporaryVector(TemporaryVector const &) = delete;
+
+  TemporaryVector &
+  operator=(TemporaryVector const &) = delete;
+
+  VectorType &
+  operator*()
+  {
+    return vector;
+  }
+
+  VectorType *
+  operator->()
+  {
+    return &vector;
+  }
+
+private:
+  VectorType vector;
+};
+
+template<typename Number>
+class TemporaryVector<dealii::LinearAlgebra::distributed::Vector<Number>>
+{
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  TemporaryVector(VectorType const & model, bool const omit_zeroing_entries = false)
+    : vector(VectorPool<Number>::get().acquire(model, omit_zeroing_entries))
+  {
+  }
+
+  ~TemporaryVector()
+  {
+    VectorPool<Number>::get().release(std::move(vector));
+  }
+
+  TemporaryVector(TemporaryVector const &) = delete;
+
+  TemporaryVector &
+  operator=(TemporaryVector const &) = delete;
+
+  VectorType &
+  operator*()
+  {
+    return *vector;
+  }
+
+  VectorType *
+  operator->()
+  {
+    return vector.get();
+  }
+
+private:
+  std::unique_ptr<VectorType> vector;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_VECTOR_POOL_H_ */
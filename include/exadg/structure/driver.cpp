@@ -28,6 +28,7 @@
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 #include <exadg/operators/throughput_parameters.h>
 #include <exadg/structure/driver.h>
+#include <exadg/utilities/memory_report.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -104,6 +105,9 @@ Driver<dim, Number>::setup()
   }
 
   timer_tree.insert({"Elasticity", "Setup"}, timer.wall_time());
+
+  if(not(is_test))
+    MemoryReport::get().print(pcout, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -147,7 +151,8 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     pcout << std::endl << "Average number of iterations:" << std::endl;
     driver_quasi_static->print_iterations();
   }
-  else if(application->get_parameters().problem_type == ProblemType::Unsteady)
+  else if(application->get_parameters().problem_type == ProblemType::Unsteady and
+          not application->get_parameters().explicit_time_integration)
   {
     pcout << std::endl << "Average number of iterations:" << std::endl;
     time_integrator->print_iterations();
@@ -178,6 +183,11 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Load imbalance for level 2:" << std::endl;
+  timer_tree.print_imbalance(pcout, 2);
+
+  PerformanceReport::get().add_wall_times(timer_tree.get_average_wall_times());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -213,17 +223,46 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
 {
   pcout << std::endl << "Computing matrix-vector product ..." << std::endl;
 
-  dealii::LinearAlgebra::distributed::Vector<Number> dst, src, linearization;
+  Parameters const & param = application->get_parameters();
+
+  bool const linearized = operator_type == OperatorType::ApplyStoredLinearization or
+                          operator_type == OperatorType::ApplyRecomputedLinearization;
+
+  if(operator_type == OperatorType::EvaluateResidual or linearized)
+  {
+    AssertThrow(param.large_deformation,
+                dealii::ExcMessage("This operator type requires a nonlinear problem."));
+  }
+  else if(operator_type == OperatorType::ApplyMass)
+  {
+    AssertThrow(param.problem_type == ProblemType::Unsteady,
+                dealii::ExcMessage("The mass operator requires an unsteady problem."));
+  }
+  else if(operator_type == OperatorType::ApplyDamping)
+  {
+    AssertThrow(param.problem_type == ProblemType::Unsteady and param.weak_damping_active,
+                dealii::ExcMessage("The damping operator requires an unsteady problem with "
+                                   "weak damping."));
+  }
+
+  dealii::LinearAlgebra::distributed::Vector<Number> dst, src, linearization, const_vector;
   pde_operator->initialize_dof_vector(src);
   pde_operator->initialize_dof_vector(dst);
   src = 1.0;
 
-  if(application->get_parameters().large_deformation and operator_type == OperatorType::Apply)
+  if(param.large_deformation and (operator_type == OperatorType::Apply or linearized))
   {
     pde_operator->initialize_dof_vector(linearization);
     linearization = 1.0;
   }
 
+  // the linearization data is computed outside of the measurements
+  if(linearized)
+    pde_operator->set_solution_linearization(linearization);
+
+  if(operator_type == OperatorType::EvaluateResidual)
+    pde_operator->initialize_dof_vector(const_vector);
+
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::Evaluate)
     {
@@ -233,6 +272,23 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
     {
       pde_operator->apply_elasticity_operator(dst, src, linearization, 1.0, 0.0);
     }
+    else if(operator_type == OperatorType::EvaluateResidual)
+    {
+      pde_operator->evaluate_nonlinear_residual(dst, src, const_vector, 1.0, 0.0);
+    }
+    else if(linearized)
+    {
+      pde_operator->apply_linearized_operator(dst, src, 1.0, 0.0);
+    }
+    else if(operator_type == OperatorType::ApplyMass)
+    {
+      pde_operator->evaluate_mass_operator(dst, src);
+    }
+    else if(operator_type == OperatorType::ApplyDamping)
+    {
+      dst = 0.0;
+      pde_operator->apply_add_damping_operator(dst, src);
+    }
   };
 
   // do the measurements
@@ -249,13 +305,24 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
 
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
+  // Memory per DoF of the data structures accessed by the operator, i.e., the src and dst vectors,
+  // the MatrixFree data, and the stored linearization data. This is an upper bound of the memory
+  // transfer per DoF and operator application since MatrixFree holds data not accessed by all
+  // operators.
+  double memory = 2.0 * sizeof(Number) * src.locally_owned_size() +
+                  pde_operator->get_matrix_free()->memory_consumption();
+  if(param.large_deformation and (operator_type == OperatorType::Apply or linearized))
+    memory += pde_operator->memory_consumption_linearization_data();
+  double const bytes_per_dof = dealii::Utilities::MPI::sum(memory, mpi_comm) / (double)dofs;
+
   if(not(is_test))
   {
     // clang-format off
     pcout << std::endl
           << std::scientific << std::setprecision(4)
           << "DoFs/sec:        " << throughput << std::endl
-          << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
+          << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl
+          << "Bytes/DoF:       " << bytes_per_dof << std::endl;
     // clang-format on
   }
 
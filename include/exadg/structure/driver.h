@@ -43,10 +43,24 @@ namespace Structure
 {
 enum class OperatorType
 {
-  Evaluate, // includes inhomogeneous boundary conditions, where the nonlinear operator is evaluated
-            // in case of nonlinear problems
-  Apply     // homogeneous action of operator, where the linearized operator is applied in case of
-            // nonlinear problems
+  // includes inhomogeneous boundary conditions, where the nonlinear operator is evaluated in case
+  // of nonlinear problems
+  Evaluate,
+  // homogeneous action of operator, where the linearized operator is applied in case of nonlinear
+  // problems
+  Apply,
+  // nonlinear residual as evaluated by the Newton solver (nonlinear problems only)
+  EvaluateResidual,
+  // linearized operator of nonlinear problems with stored linearization data, where the
+  // linearization point is only set once
+  ApplyStoredLinearization,
+  // linearized operator of nonlinear problems recomputing the linearization at the quadrature
+  // points in each application, where the linearization point is only set once
+  ApplyRecomputedLinearization,
+  // mass operator (unsteady problems only)
+  ApplyMass,
+  // weak damping operator (unsteady problems with weak damping only)
+  ApplyDamping
 };
 
 template<int dim, typename Number>
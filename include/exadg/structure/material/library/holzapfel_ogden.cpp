@@ -0,0 +1,227 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/structure/material/library/holzapfel_ogden.h>
+#include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim, typename Number>
+HolzapfelOgden<dim, Number>::HolzapfelOgden(HolzapfelOgdenData<dim> const & data,
+                                            bool const                      large_deformation)
+  : accuracy(std::numeric_limits<Number>::epsilon())
+{
+  AssertThrow(large_deformation,
+              dealii::ExcMessage("The Holzapfel-Ogden material requires "
+                                 "large_deformation = true."));
+
+  AssertThrow(dim == 3 or data.type_two_dim == Type2D::PlaneStrain,
+              dealii::ExcMessage("The Holzapfel-Ogden material is only implemented for plane "
+                                 "strain in 2D."));
+
+  AssertThrow(data.a > 0.0 and data.b > 0.0 and data.b_f > 0.0 and data.b_s > 0.0 and
+                data.b_fs > 0.0 and data.lambda > 0.0,
+              dealii::ExcMessage("Material parameters of the Holzapfel-Ogden material have to "
+                                 "satisfy a, b, b_f, b_s, b_fs, lambda > 0."));
+
+  AssertThrow(data.fiber_direction.norm() > 0.0 and data.sheet_direction.norm() > 0.0,
+              dealii::ExcMessage("Fiber and sheet directions must not vanish."));
+
+  dealii::Tensor<1, dim> const fiber = data.fiber_direction / data.fiber_direction.norm();
+  dealii::Tensor<1, dim> const sheet = data.sheet_direction / data.sheet_direction.norm();
+
+  AssertThrow(std::abs(fiber * sheet) < 1.e-12,
+              dealii::ExcMessage("Fiber and sheet directions have to be orthogonal."));
+
+  a      = dealii::make_vectorized_array<Number>(data.a);
+  b      = dealii::make_vectorized_array<Number>(data.b);
+  a_f    = dealii::make_vectorized_array<Number>(data.a_f);
+  b_f    = dealii::make_vectorized_array<Number>(data.b_f);
+  a_s    = dealii::make_vectorized_array<Number>(data.a_s);
+  b_s    = dealii::make_vectorized_array<Number>(data.b_s);
+  a_fs   = dealii::make_vectorized_array<Number>(data.a_fs);
+  b_fs   = dealii::make_vectorized_array<Number>(data.b_fs);
+  lambda = dealii::make_vectorized_array<Number>(data.lambda);
+
+  for(unsigned int i = 0; i < dim; ++i)
+  {
+    f[i] = dealii::make_vectorized_array<Number>(fiber[i]);
+    s[i] = dealii::make_vectorized_array<Number>(sheet[i]);
+  }
+
+  f_f = outer_product(f, f);
+  s_s = outer_product(s, s);
+  f_s = outer_product(f, s) + outer_product(s, f);
+}
+
+template<int dim, typename Number>
+void
+HolzapfelOgden<dim, Number>::fiber_derivatives(
+  dealii::VectorizedArray<Number> &       first_derivative,
+  dealii::VectorizedArray<Number> &       second_derivative,
+  dealii::VectorizedArray<Number> const & I_4,
+  dealii::VectorizedArray<Number> const & a_i,
+  dealii::VectorizedArray<Number> const & b_i) const
+{
+  dealii::VectorizedArray<Number> const stretch = I_4 - static_cast<Number>(1.0);
+  dealii::VectorizedArray<Number> const exponential =
+    VectorizedMath::exp(b_i * stretch * stretch, accuracy);
+
+  dealii::VectorizedArray<Number> const zero = dealii::make_vectorized_array<Number>(0.0);
+
+  first_derivative = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+    stretch, zero, a_i * stretch * exponential, zero);
+  second_derivative = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+    stretch, zero, a_i * exponential * (1.0 + 2.0 * b_i * stretch * stretch), zero);
+}
+
+template<int dim, typename Number>
+dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+HolzapfelOgden<dim, Number>::second_piola_kirchhoff_stress(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)cell;
+  (void)q;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const F =
+    get_F<dim, Number>(gradient_displacement);
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const C = transpose(F) * F;
+
+  dealii::VectorizedArray<Number> const J     = determinant(F);
+  dealii::VectorizedArray<Number> const log_J = VectorizedMath::log(J, accuracy);
+
+  // plane strain: the out-of-plane component of C equals 1
+  dealii::VectorizedArray<Number> const I_1 = trace(C) + static_cast<Number>(dim == 2 ? 1.0 : 0.0);
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const C_f = C * f;
+
+  dealii::VectorizedArray<Number> const I_4f  = f * C_f;
+  dealii::VectorizedArray<Number> const I_4s  = s * (C * s);
+  dealii::VectorizedArray<Number> const I_8fs = s * C_f;
+
+  dealii::VectorizedArray<Number> psi_f, psi_s, psi_f_2, psi_s_2;
+  fiber_derivatives(psi_f, psi_f_2, I_4f, a_f, b_f);
+  fiber_derivatives(psi_s, psi_s_2, I_4s, a_s, b_s);
+
+  dealii::VectorizedArray<Number> const psi_fs =
+    a_fs * I_8fs * VectorizedMath::exp(b_fs * I_8fs * I_8fs, accuracy);
+
+  // S = a exp(b (I_1 - 3)) I + (lambda ln(J) - a) C^{-1} + 2 psi_f' f x f + 2 psi_s' s x s
+  //     + psi_fs' (f x s + s x f)
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> S =
+    (lambda * log_J - a) * get_C_inverse<dim, Number>(C, J) + 2.0 * psi_f * f_f +
+    2.0 * psi_s * s_s + psi_fs * f_s;
+
+  dealii::VectorizedArray<Number> const isotropic =
+    a * VectorizedMath::exp(b * (I_1 - static_cast<Number>(3.0)), accuracy);
+  for(unsigned int i = 0; i < dim; ++i)
+    S[i][i] += isotropic;
+
+  return S;
+}
+
+template<int dim, typename Number>
+dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+HolzapfelOgden<dim, Number>::second_piola_kirchhoff_stress_displacement_derivative(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)cell;
+  (void)q;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & F = deformation_gradient;
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const   C = transpose(F) * F;
+
+  dealii::VectorizedArray<Number> const J     = determinant(F);
+  dealii::VectorizedArray<Number> const log_J = VectorizedMath::log(J, accuracy);
+
+  dealii::VectorizedArray<Number> const I_1 = trace(C) + static_cast<Number>(dim == 2 ? 1.0 : 0.0);
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const C_f = C * f;
+
+  dealii::VectorizedArray<Number> const I_4f  = f * C_f;
+  dealii::VectorizedArray<Number> const I_4s  = s * (C * s);
+  dealii::VectorizedArray<Number> const I_8fs = s * C_f;
+
+  dealii::VectorizedArray<Number> psi_f, psi_s, psi_f_2, psi_s_2;
+  fiber_derivatives(psi_f, psi_f_2, I_4f, a_f, b_f);
+  fiber_derivatives(psi_s, psi_s_2, I_4s, a_s, b_s);
+
+  dealii::VectorizedArray<Number> const exponential_fs =
+    VectorizedMath::exp(b_fs * I_8fs * I_8fs, accuracy);
+  dealii::VectorizedArray<Number> const psi_fs_2 =
+    a_fs * exponential_fs * (1.0 + 2.0 * b_fs * I_8fs * I_8fs);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const C_inv =
+    get_C_inverse<dim, Number>(C, J);
+
+  // F^T * Grad(delta d), the increment of C is delta C = F_T_grad + F_T_grad^T
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const F_T_grad =
+    transpose(F) * gradient_increment;
+
+  // increments of the invariants
+  dealii::VectorizedArray<Number> const delta_I_1  = 2.0 * trace(F_T_grad);
+  dealii::VectorizedArray<Number> const delta_I_4f = 2.0 * (f * (F_T_grad * f));
+  dealii::VectorizedArray<Number> const delta_I_4s = 2.0 * (s * (F_T_grad * s));
+  dealii::VectorizedArray<Number> const delta_I_8fs =
+    f * (F_T_grad * s) + s * (F_T_grad * f);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> delta_S =
+    (lambda * scalar_product(C_inv, F_T_grad)) * C_inv -
+    (2.0 * (lambda * log_J - a)) *
+      get_C_inverse_times_delta_E_times_C_inverse<dim, Number>(C_inv, F_T_grad) +
+    (2.0 * psi_f_2 * delta_I_4f) * f_f + (2.0 * psi_s_2 * delta_I_4s) * s_s +
+    (psi_fs_2 * delta_I_8fs) * f_s;
+
+  dealii::VectorizedArray<Number> const isotropic =
+    a * b * VectorizedMath::exp(b * (I_1 - static_cast<Number>(3.0)), accuracy) * delta_I_1;
+  for(unsigned int i = 0; i < dim; ++i)
+    delta_S[i][i] += isotropic;
+
+  return delta_S;
+}
+
+template<int dim, typename Number>
+std::array<dealii::VectorizedArray<Number>, 2>
+HolzapfelOgden<dim, Number>::get_linearized_lame_parameters(unsigned int const cell) const
+{
+  (void)cell;
+
+  // isotropic and volumetric parts, the fiber and sheet terms vanish in the reference
+  // configuration
+  return {{lambda + 2.0 * a * b, a}};
+}
+
+template class HolzapfelOgden<2, float>;
+template class HolzapfelOgden<2, double>;
+
+template class HolzapfelOgden<3, float>;
+template class HolzapfelOgden<3, double>;
+
+} // namespace Structure
+} // namespace ExaDG
@@ -0,0 +1,150 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef STRUCTURE_MATERIAL_LIBRARY_HOLZAPFELOGDEN
+#define STRUCTURE_MATERIAL_LIBRARY_HOLZAPFELOGDEN
+
+// deal.II
+#include <deal.II/base/tensor.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/structure/material/material.h>
+#include <exadg/utilities/vectorized_math.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim>
+struct HolzapfelOgdenData : public MaterialData
+{
+  HolzapfelOgdenData(MaterialType const &           type,
+                     double const &                 a,
+                     double const &                 b,
+                     double const &                 a_f,
+                     double const &                 b_f,
+                     double const &                 a_s,
+                     double const &                 b_s,
+                     double const &                 a_fs,
+                     double const &                 b_fs,
+                     double const &                 lambda,
+                     dealii::Tensor<1, dim> const & fiber_direction,
+                     dealii::Tensor<1, dim> const & sheet_direction,
+                     Type2D const &                 type_two_dim)
+    : MaterialData(type),
+      a(a),
+      b(b),
+      a_f(a_f),
+      b_f(b_f),
+      a_s(a_s),
+      b_s(b_s),
+      a_fs(a_fs),
+      b_fs(b_fs),
+      lambda(lambda),
+      fiber_direction(fiber_direction),
+      sheet_direction(sheet_direction),
+      type_two_dim(type_two_dim)
+  {
+  }
+
+  // isotropic part
+  double a;
+  double b;
+
+  // fiber, sheet, and fiber-sheet interaction
+  double a_f;
+  double b_f;
+  double a_s;
+  double b_s;
+  double a_fs;
+  double b_fs;
+
+  // volumetric part
+  double lambda;
+
+  // directions in the reference configuration, normalized by the material
+  dealii::Tensor<1, dim> fiber_direction;
+  dealii::Tensor<1, dim> sheet_direction;
+
+  Type2D type_two_dim;
+};
+
+/*
+ * Orthotropic Holzapfel-Ogden material for myocardial tissue (Holzapfel, Ogden (2009),
+ * "Constitutive modelling of passive myocardium") with the strain energy density
+ *
+ *  Psi = a/(2b) exp(b (I_1 - 3)) + sum_{i=f,s} a_i/(2b_i) (exp(b_i (I_4i - 1)^2) - 1)
+ *        + a_fs/(2b_fs) (exp(b_fs I_8fs^2) - 1) - a ln(J) + lambda/2 ln(J)^2 ,
+ *
+ * with I_1 = tr(C), I_4f = f * C f, I_4s = s * C s, I_8fs = f * C s for the fiber and sheet
+ * directions f and s in the reference configuration. The fiber and sheet terms only contribute
+ * under tension, I_4i > 1. The compressible formulation uses the same logarithmic volumetric term
+ * as the Neo-Hookean material, where lambda >> a renders the material nearly incompressible. The
+ * exponentials and logarithms are evaluated for all lanes of a vectorized array at once.
+ */
+template<int dim, typename Number>
+class HolzapfelOgden : public Material<dim, Number>
+{
+public:
+  HolzapfelOgden(HolzapfelOgdenData<dim> const & data, bool const large_deformation);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  second_piola_kirchhoff_stress(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+    unsigned int const                                              cell,
+    unsigned int const                                              q) const final;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  second_piola_kirchhoff_stress_displacement_derivative(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+    unsigned int const                                              cell,
+    unsigned int const                                              q) const final;
+
+  std::array<dealii::VectorizedArray<Number>, 2>
+  get_linearized_lame_parameters(unsigned int const cell) const final;
+
+private:
+  /*
+   * First and second derivative of a_i/(2b_i) (exp(b_i (I_4 - 1)^2) - 1) with respect to I_4,
+   * which vanish under compression, I_4 <= 1.
+   */
+  void
+  fiber_derivatives(dealii::VectorizedArray<Number> &       first_derivative,
+                    dealii::VectorizedArray<Number> &       second_derivative,
+                    dealii::VectorizedArray<Number> const & I_4,
+                    dealii::VectorizedArray<Number> const & a_i,
+                    dealii::VectorizedArray<Number> const & b_i) const;
+
+  dealii::VectorizedArray<Number> a, b, a_f, b_f, a_s, b_s, a_fs, b_fs, lambda;
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> f, s;
+
+  // structural tensors f x f, s x s, and f x s + s x f
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> f_f, s_s, f_s;
+
+  VectorizedMath::Accuracy<Number> const accuracy;
+};
+} // namespace Structure
+} // namespace ExaDG
+
+#endif
@@ -0,0 +1,134 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim, typename Number>
+MooneyRivlin<dim, Number>::MooneyRivlin(MooneyRivlinData<dim> const & data,
+                                        bool const                    large_deformation)
+  : accuracy(std::numeric_limits<Number>::epsilon())
+{
+  AssertThrow(large_deformation,
+              dealii::ExcMessage("The Mooney-Rivlin material requires large_deformation = true."));
+
+  AssertThrow(dim == 3 or data.type_two_dim == Type2D::PlaneStrain,
+              dealii::ExcMessage("The Mooney-Rivlin material is only implemented for plane strain "
+                                 "in 2D."));
+
+  AssertThrow(data.c1 + 2.0 * data.c2 > 0.0 and data.lambda > 0.0,
+              dealii::ExcMessage("Material parameters of the Mooney-Rivlin material have to "
+                                 "satisfy c1 + 2 c2 > 0 and lambda > 0."));
+
+  c1     = dealii::make_vectorized_array<Number>(data.c1);
+  c2     = dealii::make_vectorized_array<Number>(data.c2);
+  mu     = dealii::make_vectorized_array<Number>(2.0 * (data.c1 + 2.0 * data.c2));
+  lambda = dealii::make_vectorized_array<Number>(data.lambda);
+}
+
+template<int dim, typename Number>
+dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+MooneyRivlin<dim, Number>::second_piola_kirchhoff_stress(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)cell;
+  (void)q;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const F =
+    get_F<dim, Number>(gradient_displacement);
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const C = transpose(F) * F;
+
+  dealii::VectorizedArray<Number> const J     = determinant(F);
+  dealii::VectorizedArray<Number> const log_J = VectorizedMath::log(J, accuracy);
+
+  // plane strain: the out-of-plane component of C equals 1
+  dealii::VectorizedArray<Number> const I_1 = trace(C) + static_cast<Number>(dim == 2 ? 1.0 : 0.0);
+
+  // S = 2 c1 I + 2 c2 (I_1 I - C) + (lambda ln(J) - mu) C^{-1}
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> S =
+    (lambda * log_J - mu) * get_C_inverse<dim, Number>(C, J) - 2.0 * c2 * C;
+  for(unsigned int i = 0; i < dim; ++i)
+    S[i][i] += 2.0 * (c1 + c2 * I_1);
+
+  return S;
+}
+
+template<int dim, typename Number>
+dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+MooneyRivlin<dim, Number>::second_piola_kirchhoff_stress_displacement_derivative(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)cell;
+  (void)q;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & F = deformation_gradient;
+
+  dealii::VectorizedArray<Number> const J     = determinant(F);
+  dealii::VectorizedArray<Number> const log_J = VectorizedMath::log(J, accuracy);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const C_inv =
+    get_C_inverse<dim, Number>(transpose(F) * F, J);
+
+  // F^T * Grad(delta d), the increment of C is delta C = F_T_grad + F_T_grad^T
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const F_T_grad =
+    transpose(F) * gradient_increment;
+
+  // delta S = 2 c2 (delta I_1 I - delta C) + lambda (C^{-1} : delta E) C^{-1}
+  //           - 2 (lambda ln(J) - mu) C^{-1} * delta E * C^{-1}
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> delta_S =
+    (lambda * scalar_product(C_inv, F_T_grad)) * C_inv -
+    (2.0 * (lambda * log_J - mu)) *
+      get_C_inverse_times_delta_E_times_C_inverse<dim, Number>(C_inv, F_T_grad) -
+    2.0 * c2 * (F_T_grad + transpose(F_T_grad));
+  for(unsigned int i = 0; i < dim; ++i)
+    delta_S[i][i] += 4.0 * c2 * trace(F_T_grad);
+
+  return delta_S;
+}
+
+template<int dim, typename Number>
+std::array<dealii::VectorizedArray<Number>, 2>
+MooneyRivlin<dim, Number>::get_linearized_lame_parameters(unsigned int const cell) const
+{
+  (void)cell;
+
+  // linearization of S in the reference configuration: 2 mu_0 E + lambda_0 tr(E) I
+  return {{lambda + 4.0 * c2, 2.0 * (c1 + c2)}};
+}
+
+template class MooneyRivlin<2, float>;
+template class MooneyRivlin<2, double>;
+
+template class MooneyRivlin<3, float>;
+template class MooneyRivlin<3, double>;
+
+} // namespace Structure
+} // namespace ExaDG
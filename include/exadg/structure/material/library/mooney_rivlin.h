@@ -0,0 +1,101 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef STRUCTURE_MATERIAL_LIBRARY_MOONEYRIVLIN
+#define STRUCTURE_MATERIAL_LIBRARY_MOONEYRIVLIN
+
+// deal.II
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/structure/material/material.h>
+#include <exadg/utilities/vectorized_math.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim>
+struct MooneyRivlinData : public MaterialData
+{
+  MooneyRivlinData(MaterialType const & type,
+                   double const &       c1,
+                   double const &       c2,
+                   double const &       lambda,
+                   Type2D const &       type_two_dim)
+    : MaterialData(type), c1(c1), c2(c2), lambda(lambda), type_two_dim(type_two_dim)
+  {
+  }
+
+  double c1;
+  double c2;
+  double lambda;
+  Type2D type_two_dim;
+};
+
+/*
+ * Compressible Mooney-Rivlin material with the strain energy density
+ *
+ *  Psi = c1 (I_1 - 3) + c2 (I_2 - 3) - mu ln(J) + lambda/2 ln(J)^2 ,  mu = 2 (c1 + 2 c2) ,
+ *
+ * with the invariants I_1 = tr(C) and I_2 = 1/2 (I_1^2 - tr(C^2)) of the right Cauchy-Green tensor
+ * C = F^T * F, and J = det(F). The factor mu of the logarithmic term ensures a stress-free
+ * reference configuration. The 2nd Piola-Kirchhoff stress reads
+ *
+ *  S = 2 c1 I + 2 c2 (I_1 I - C) + (lambda ln(J) - mu) C^{-1} .
+ *
+ * Nearly incompressible behavior is obtained for lambda >> mu. In 2D, the plane strain assumption
+ * is used, i.e., the out-of-plane component of C equals 1.
+ */
+template<int dim, typename Number>
+class MooneyRivlin : public Material<dim, Number>
+{
+public:
+  MooneyRivlin(MooneyRivlinData<dim> const & data, bool const large_deformation);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  second_piola_kirchhoff_stress(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+    unsigned int const                                              cell,
+    unsigned int const                                              q) const final;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  second_piola_kirchhoff_stress_displacement_derivative(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+    unsigned int const                                              cell,
+    unsigned int const                                              q) const final;
+
+  std::array<dealii::VectorizedArray<Number>, 2>
+  get_linearized_lame_parameters(unsigned int const cell) const final;
+
+private:
+  dealii::VectorizedArray<Number> c1;
+  dealii::VectorizedArray<Number> c2;
+  dealii::VectorizedArray<Number> mu;
+  dealii::VectorizedArray<Number> lambda;
+
+  VectorizedMath::Accuracy<Number> const accuracy;
+};
+} // namespace Structure
+} // namespace ExaDG
+
+#endif
@@ -0,0 +1,118 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/structure/material/library/neo_hookean.h>
+#include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim, typename Number>
+NeoHookean<dim, Number>::NeoHookean(NeoHookeanData<dim> const & data, bool const large_deformation)
+  : accuracy(std::numeric_limits<Number>::epsilon())
+{
+  AssertThrow(large_deformation,
+              dealii::ExcMessage("The Neo-Hookean material requires large_deformation = true."));
+
+  AssertThrow(dim == 3 or data.type_two_dim == Type2D::PlaneStrain,
+              dealii::ExcMessage("The Neo-Hookean material is only implemented for plane strain "
+                                 "in 2D."));
+
+  AssertThrow(data.nu < 0.5, dealii::ExcMessage("Poisson's ratio has to be smaller than 0.5."));
+
+  mu     = dealii::make_vectorized_array<Number>(data.E / (2.0 * (1.0 + data.nu)));
+  lambda = dealii::make_vectorized_array<Number>(data.E * data.nu /
+                                                 ((1.0 + data.nu) * (1.0 - 2.0 * data.nu)));
+}
+
+template<int dim, typename Number>
+dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+NeoHookean<dim, Number>::second_piola_kirchhoff_stress(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)cell;
+  (void)q;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const F =
+    get_F<dim, Number>(gradient_displacement);
+
+  dealii::VectorizedArray<Number> const J     = determinant(F);
+  dealii::VectorizedArray<Number> const log_J = VectorizedMath::log(J, accuracy);
+
+  // S = mu I + (lambda ln(J) - mu) C^{-1}
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> S =
+    (lambda * log_J - mu) * get_C_inverse<dim, Number>(transpose(F) * F, J);
+  for(unsigned int i = 0; i < dim; ++i)
+    S[i][i] += mu;
+
+  return S;
+}
+
+template<int dim, typename Number>
+dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+NeoHookean<dim, Number>::second_piola_kirchhoff_stress_displacement_derivative(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)cell;
+  (void)q;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & F = deformation_gradient;
+
+  dealii::VectorizedArray<Number> const J     = determinant(F);
+  dealii::VectorizedArray<Number> const log_J = VectorizedMath::log(J, accuracy);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const C_inv =
+    get_C_inverse<dim, Number>(transpose(F) * F, J);
+
+  // F^T * Grad(delta d), whose symmetric part is the strain increment delta E
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const F_T_grad =
+    transpose(F) * gradient_increment;
+
+  // delta S = lambda (C^{-1} : delta E) C^{-1} - 2 (lambda ln(J) - mu) C^{-1} * delta E * C^{-1}
+  return (lambda * scalar_product(C_inv, F_T_grad)) * C_inv -
+         (2.0 * (lambda * log_J - mu)) *
+           get_C_inverse_times_delta_E_times_C_inverse<dim, Number>(C_inv, F_T_grad);
+}
+
+template<int dim, typename Number>
+std::array<dealii::VectorizedArray<Number>, 2>
+NeoHookean<dim, Number>::get_linearized_lame_parameters(unsigned int const cell) const
+{
+  (void)cell;
+
+  return {{lambda, mu}};
+}
+
+template class NeoHookean<2, float>;
+template class NeoHookean<2, double>;
+
+template class NeoHookean<3, float>;
+template class NeoHookean<3, double>;
+
+} // namespace Structure
+} // namespace ExaDG
@@ -0,0 +1,98 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef STRUCTURE_MATERIAL_LIBRARY_NEOHOOKEAN
+#define STRUCTURE_MATERIAL_LIBRARY_NEOHOOKEAN
+
+// deal.II
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/structure/material/material.h>
+#include <exadg/utilities/vectorized_math.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim>
+struct NeoHookeanData : public MaterialData
+{
+  NeoHookeanData(MaterialType const & type,
+                 double const &       E,
+                 double const &       nu,
+                 Type2D const &       type_two_dim)
+    : MaterialData(type), E(E), nu(nu), type_two_dim(type_two_dim)
+  {
+  }
+
+  double E;
+  double nu;
+  Type2D type_two_dim;
+};
+
+/*
+ * Compressible Neo-Hookean material with the strain energy density
+ *
+ *  Psi = mu/2 (I_1 - 3) - mu ln(J) + lambda/2 ln(J)^2 ,
+ *
+ * with Lamee parameters mu and lambda computed from Young's modulus E and Poisson's ratio nu, the
+ * first invariant I_1 = tr(C) of the right Cauchy-Green tensor C = F^T * F, and J = det(F). The
+ * 2nd Piola-Kirchhoff stress reads
+ *
+ *  S = mu I + (lambda ln(J) - mu) C^{-1} .
+ *
+ * Nearly incompressible behavior is obtained for nu -> 0.5. In 2D, the plane strain assumption is
+ * used. The logarithm is evaluated for all lanes of a vectorized array at once, and C^{-1} is
+ * computed via the adjugate of C since det(C) = J^2 is known.
+ */
+template<int dim, typename Number>
+class NeoHookean : public Material<dim, Number>
+{
+public:
+  NeoHookean(NeoHookeanData<dim> const & data, bool const large_deformation);
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  second_piola_kirchhoff_stress(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+    unsigned int const                                              cell,
+    unsigned int const                                              q) const final;
+
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  second_piola_kirchhoff_stress_displacement_derivative(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+    unsigned int const                                              cell,
+    unsigned int const                                              q) const final;
+
+  std::array<dealii::VectorizedArray<Number>, 2>
+  get_linearized_lame_parameters(unsigned int const cell) const final;
+
+private:
+  dealii::VectorizedArray<Number> mu;
+  dealii::VectorizedArray<Number> lambda;
+
+  VectorizedMath::Accuracy<Number> const accuracy;
+};
+} // namespace Structure
+} // namespace ExaDG
+
+#endif
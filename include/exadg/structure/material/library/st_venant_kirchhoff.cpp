@@ -19,6 +19,12 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <cmath>
+#include <limits>
+#include <map>
+
+// ExaDG
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/structure/material/library/st_venant_kirchhoff.h>
 #include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
@@ -38,31 +44,31 @@ StVenantKirchhoff<dim, Number>::StVenantKirchhoff(
     quad_index(quad_index),
     data(data),
     large_deformation(large_deformation),
-    E_is_variable(data.E_function != nullptr)
+    f0_factor(get_f0_factor()),
+    f1_factor(get_f1_factor()),
+    f2_factor(get_f2_factor()),
+    E_is_variable(data.E_function != nullptr),
+    E_storage(CoefficientStorage::Constant)
 {
   // initialize (potentially variable) factors
   Number const E = data.E;
-  f0             = dealii::make_vectorized_array<Number>(get_f0_factor() * E);
-  f1             = dealii::make_vectorized_array<Number>(get_f1_factor() * E);
-  f2             = dealii::make_vectorized_array<Number>(get_f2_factor() * E);
+  f0             = dealii::make_vectorized_array<Number>(f0_factor * E);
+  f1             = dealii::make_vectorized_array<Number>(f1_factor * E);
+  f2             = dealii::make_vectorized_array<Number>(f2_factor * E);
 
   if(E_is_variable)
   {
     // allocate vectors for variable coefficients and initialize with constant values
-    f0_coefficients.initialize(matrix_free, quad_index, false, false);
-    f0_coefficients.set_coefficients(get_f0_factor() * E);
-
-    f1_coefficients.initialize(matrix_free, quad_index, false, false);
-    f1_coefficients.set_coefficients(get_f1_factor() * E);
-
-    f2_coefficients.initialize(matrix_free, quad_index, false, false);
-    f2_coefficients.set_coefficients(get_f2_factor() * E);
+    E_coefficients.initialize(matrix_free, quad_index, false, false);
+    E_coefficients.set_coefficients(dealii::make_vectorized_array<Number>(E));
 
     VectorType dummy;
     matrix_free.cell_loop(&StVenantKirchhoff<dim, Number>::cell_loop_set_coefficients,
                           this,
                           dummy,
                           dummy);
+
+    compress_coefficients(matrix_free);
   }
 }
 
@@ -114,10 +120,6 @@ StVenantKirchhoff<dim, Number>::cell_loop_set_coefficients(
 {
   IntegratorCell integrator(matrix_free, dof_index, quad_index);
 
-  auto const f0_factor = get_f0_factor();
-  auto const f1_factor = get_f1_factor();
-  auto const f2_factor = get_f2_factor();
-
   // loop over all cells
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
@@ -132,10 +134,118 @@ StVenantKirchhoff<dim, Number>::cell_loop_set_coefficients(
                                                  0.0 /*time*/);
 
       // set the coefficients
-      f0_coefficients.set_coefficient_cell(cell, q, f0_factor * E_vec);
-      f1_coefficients.set_coefficient_cell(cell, q, f1_factor * E_vec);
-      f2_coefficients.set_coefficient_cell(cell, q, f2_factor * E_vec);
+      E_coefficients.set_coefficient_cell(cell, q, E_vec);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+StVenantKirchhoff<dim, Number>::compress_coefficients(
+  dealii::MatrixFree<dim, Number> const & matrix_free)
+{
+  unsigned int const n_cell_batches = matrix_free.n_cell_batches();
+  unsigned int const n_q_points     = matrix_free.get_n_q_points(quad_index);
+
+  Number const tolerance = 8.0 * std::numeric_limits<Number>::epsilon();
+
+  auto const differs = [&](Number const a, Number const b) {
+    return std::abs(a - b) > tolerance * std::abs(b);
+  };
+
+  bool constant_per_cell        = true;
+  bool constant_per_material_id = true;
+
+  std::map<dealii::types::material_id, Number> E_per_material_id;
+
+  E_cell.resize(n_cell_batches);
+  for(unsigned int cell = 0; cell < n_cell_batches and constant_per_cell; ++cell)
+  {
+    unsigned int const n_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
+
+    dealii::VectorizedArray<Number> const E_0 = E_coefficients.get_coefficient_cell(cell, 0);
+    for(unsigned int q = 1; q < n_q_points; ++q)
+    {
+      dealii::VectorizedArray<Number> const E_q = E_coefficients.get_coefficient_cell(cell, q);
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        if(differs(E_q[v], E_0[v]))
+          constant_per_cell = false;
+    }
+
+    E_cell[cell] = E_0;
+
+    for(unsigned int v = 0; v < n_lanes; ++v)
+    {
+      dealii::types::material_id const id = matrix_free.get_cell_iterator(cell, v)->material_id();
+
+      auto const it = E_per_material_id.find(id);
+      if(it == E_per_material_id.end())
+        E_per_material_id.insert({id, E_0[v]});
+      else if(differs(E_0[v], it->second))
+        constant_per_material_id = false;
+    }
+  }
+
+  constant_per_material_id = constant_per_material_id and constant_per_cell and
+                             E_per_material_id.size() <= std::numeric_limits<unsigned char>::max();
+
+  if(constant_per_material_id)
+  {
+    E_storage = CoefficientStorage::MaterialId;
+
+    std::map<dealii::types::material_id, unsigned char> index_of_material_id;
+    for(auto const & [id, E] : E_per_material_id)
+    {
+      index_of_material_id.insert({id, static_cast<unsigned char>(E_material_id.size())});
+      E_material_id.push_back(E);
+    }
+
+    material_index.resize(n_cell_batches);
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      material_index[cell].fill(0);
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+        material_index[cell][v] =
+          index_of_material_id[matrix_free.get_cell_iterator(cell, v)->material_id()];
+    }
+
+    E_cell.clear();
+    E_coefficients = VariableCoefficients<dealii::VectorizedArray<Number>>();
+  }
+  else if(constant_per_cell)
+  {
+    E_storage = CoefficientStorage::Cell;
+
+    E_coefficients = VariableCoefficients<dealii::VectorizedArray<Number>>();
+  }
+  else
+  {
+    E_storage = CoefficientStorage::QuadraturePoint;
+
+    E_cell.clear();
+  }
+}
+
+template<int dim, typename Number>
+dealii::VectorizedArray<Number>
+StVenantKirchhoff<dim, Number>::get_youngs_modulus(unsigned int const cell,
+                                                   unsigned int const q) const
+{
+  switch(E_storage)
+  {
+    case CoefficientStorage::MaterialId:
+    {
+      dealii::VectorizedArray<Number> E;
+      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+        E[v] = E_material_id[material_index[cell][v]];
+      return E;
     }
+    case CoefficientStorage::Cell:
+      return E_cell[cell];
+    case CoefficientStorage::QuadraturePoint:
+      return E_coefficients.get_coefficient_cell(cell, q);
+    default:
+      return dealii::make_vectorized_array<Number>(data.E);
   }
 }
 
@@ -150,9 +260,11 @@ StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress_symmetrize(
 
   if(E_is_variable)
   {
-    f0 = f0_coefficients.get_coefficient_cell(cell, q);
-    f1 = f1_coefficients.get_coefficient_cell(cell, q);
-    f2 = f2_coefficients.get_coefficient_cell(cell, q);
+    dealii::VectorizedArray<Number> const E = get_youngs_modulus(cell, q);
+
+    f0 = f0_factor * E;
+    f1 = f1_factor * E;
+    f2 = f2_factor * E;
   }
 
   if(dim == 3)
@@ -210,6 +322,20 @@ StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress_displacement_deriv
     transpose(deformation_gradient) * gradient_increment, cell, q));
 }
 
+template<int dim, typename Number>
+std::array<dealii::VectorizedArray<Number>, 2>
+StVenantKirchhoff<dim, Number>::get_linearized_lame_parameters(unsigned int const cell) const
+{
+  // f1 = lambda and f2 = mu, also for plane stress with the effective parameter lambda
+  if(E_is_variable)
+  {
+    dealii::VectorizedArray<Number> const E = get_youngs_modulus(cell, 0);
+    return {{f1_factor * E, f2_factor * E}};
+  }
+  else
+    return {{f1, f2}};
+}
+
 template class StVenantKirchhoff<2, float>;
 template class StVenantKirchhoff<2, double>;
 
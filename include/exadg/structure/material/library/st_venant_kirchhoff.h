@@ -22,7 +22,12 @@
 #ifndef STRUCTURE_MATERIAL_LIBRARY_STVENANTKIRCHHOFF
 #define STRUCTURE_MATERIAL_LIBRARY_STVENANTKIRCHHOFF
 
+// C/C++
+#include <array>
+#include <vector>
+
 // deal.II
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/function.h>
 #include <deal.II/base/point.h>
 #include <deal.II/matrix_free/matrix_free.h>
@@ -82,7 +87,24 @@ public:
     unsigned int const                                              cell,
     unsigned int const                                              q) const final;
 
+  std::array<dealii::VectorizedArray<Number>, 2>
+  get_linearized_lame_parameters(unsigned int const cell) const final;
+
 private:
+  /*
+   * Storage of the Young's modulus in case of spatially varying material parameters, selected
+   * automatically according to the variation of the user function E_function: per material id if
+   * E is constant on the cells of each material id, per cell if E is constant within each cell, and
+   * per quadrature point otherwise.
+   */
+  enum class CoefficientStorage
+  {
+    Constant,
+    MaterialId,
+    Cell,
+    QuadraturePoint
+  };
+
   /*
    * Factor out coefficients for faster computation. Note that these factors do not contain the
    * (potentially variable) Young's modulus.
@@ -110,7 +132,7 @@ private:
     unsigned int const                                              q) const;
 
   /*
-   * Store factors involving (potentially variable) Young's modulus.
+   * Evaluate the (potentially variable) Young's modulus in all quadrature points.
    */
   void
   cell_loop_set_coefficients(dealii::MatrixFree<dim, Number> const & matrix_free,
@@ -118,6 +140,16 @@ private:
                              VectorType const & src,
                              Range const &      cell_range) const;
 
+  /*
+   * Replaces the quadrature point data of the Young's modulus by data per material id or per
+   * cell if possible.
+   */
+  void
+  compress_coefficients(dealii::MatrixFree<dim, Number> const & matrix_free);
+
+  dealii::VectorizedArray<Number>
+  get_youngs_modulus(unsigned int const cell, unsigned int const q) const;
+
   unsigned int dof_index;
   unsigned int quad_index;
 
@@ -125,15 +157,27 @@ private:
 
   bool large_deformation;
 
+  Number const f0_factor;
+  Number const f1_factor;
+  Number const f2_factor;
+
   mutable dealii::VectorizedArray<Number> f0;
   mutable dealii::VectorizedArray<Number> f1;
   mutable dealii::VectorizedArray<Number> f2;
 
-  // cache coefficients for spatially varying material parameters
-  bool                                                          E_is_variable;
-  mutable VariableCoefficients<dealii::VectorizedArray<Number>> f0_coefficients;
-  mutable VariableCoefficients<dealii::VectorizedArray<Number>> f1_coefficients;
-  mutable VariableCoefficients<dealii::VectorizedArray<Number>> f2_coefficients;
+  // Young's modulus for spatially varying material parameters
+  bool               E_is_variable;
+  CoefficientStorage E_storage;
+
+  // data per quadrature point
+  mutable VariableCoefficients<dealii::VectorizedArray<Number>> E_coefficients;
+
+  // data per cell batch, accessed in the same way as by dealii::FEEvaluation::read_cell_data()
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> E_cell;
+
+  // data per material id, where each lane of a cell batch holds an index into E_material_id
+  std::vector<Number>                                                             E_material_id;
+  std::vector<std::array<unsigned char, dealii::VectorizedArray<Number>::size()>> material_index;
 };
 } // namespace Structure
 } // namespace ExaDG
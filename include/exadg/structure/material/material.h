@@ -22,7 +22,11 @@
 #ifndef INCLUDE_EXADG_STRUCTURE_MATERIAL_MATERIAL_H_
 #define INCLUDE_EXADG_STRUCTURE_MATERIAL_MATERIAL_H_
 
+// C/C++
+#include <array>
+
 // deal.II
+#include <deal.II/base/exceptions.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/vectorization.h>
 
@@ -63,6 +67,23 @@ public:
     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
     unsigned int const                                              cell,
     unsigned int const                                              q) const = 0;
+
+  /*
+   * Lamee parameters lambda (first entry) and mu (second entry) of the isotropic linear elasticity
+   * tensor approximating the material in the reference configuration for small strains, as
+   * needed by preconditioners that are based on separable approximations of the operator.
+   */
+  virtual std::array<dealii::VectorizedArray<Number>, 2>
+  get_linearized_lame_parameters(unsigned int const cell) const
+  {
+    (void)cell;
+
+    AssertThrow(false,
+                dealii::ExcMessage("Linearized Lamee parameters are not implemented for this "
+                                   "material."));
+
+    return std::array<dealii::VectorizedArray<Number>, 2>();
+  }
 };
 
 } // namespace Structure
@@ -26,6 +26,9 @@
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
+#include <exadg/structure/material/library/holzapfel_ogden.h>
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/material/library/neo_hookean.h>
 #include <exadg/structure/material/library/st_venant_kirchhoff.h>
 #include <exadg/structure/material/material.h>
 #include <exadg/structure/user_interface/material_descriptor.h>
@@ -78,6 +81,30 @@ public:
                    matrix_free, dof_index, quad_index, *data_svk, large_deformation)));
           break;
         }
+        case MaterialType::NeoHookean:
+        {
+          std::shared_ptr<NeoHookeanData<dim>> data_nh =
+            std::static_pointer_cast<NeoHookeanData<dim>>(data);
+          material_map.insert(
+            Pair(id, new NeoHookean<dim, Number>(*data_nh, large_deformation)));
+          break;
+        }
+        case MaterialType::MooneyRivlin:
+        {
+          std::shared_ptr<MooneyRivlinData<dim>> data_mr =
+            std::static_pointer_cast<MooneyRivlinData<dim>>(data);
+          material_map.insert(
+            Pair(id, new MooneyRivlin<dim, Number>(*data_mr, large_deformation)));
+          break;
+        }
+        case MaterialType::HolzapfelOgden:
+        {
+          std::shared_ptr<HolzapfelOgdenData<dim>> data_ho =
+            std::static_pointer_cast<HolzapfelOgdenData<dim>>(data);
+          material_map.insert(
+            Pair(id, new HolzapfelOgden<dim, Number>(*data_ho, large_deformation)));
+          break;
+        }
         default:
         {
           AssertThrow(false, dealii::ExcMessage("Specified material type is not implemented."));
@@ -40,12 +40,15 @@ write_output(OutputDataBase const &          output_data,
              dealii::Mapping<dim> const &    mapping,
              VectorType const &              solution_vector,
              unsigned int const              output_counter,
-             MPI_Comm const &                mpi_comm)
+             double const                    time,
+             MPI_Comm const &                mpi_comm,
+             OutputWriter<dim> &             output_writer)
 {
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
+  flags.compression_level        = get_vtk_compression_level(output_data.compression);
 
-  dealii::DataOut<dim> data_out;
+  SnapshotDataOut<dim> data_out;
   data_out.set_flags(flags);
 
   std::vector<std::string> names(dim, "displacement");
@@ -54,10 +57,11 @@ write_output(OutputDataBase const &          output_data,
 
   data_out.add_data_vector(dof_handler, solution_vector, names, component_interpretation);
 
+  select_output_cells(data_out, output_data.material_ids);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(
-    output_data.directory, output_data.filename, output_counter, mpi_comm, 4);
+  output_writer.write(
+    data_out, output_data.directory, output_data.filename, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -77,6 +81,7 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
 
   time_control.setup(output_data_in.time_control_data);
 
+  output_writer.setup(output_data_in);
 
   if(output_data_in.time_control_data.is_active)
   {
@@ -125,8 +130,14 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & solution,
 {
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
-  write_output<dim>(
-    output_data, *dof_handler, *mapping, solution, time_control.get_counter(), mpi_comm);
+  write_output<dim>(output_data,
+                    *dof_handler,
+                    *mapping,
+                    solution,
+                    time_control.get_counter(),
+                    time,
+                    mpi_comm,
+                    output_writer);
 }
 
 template class OutputGenerator<2, float>;
@@ -26,6 +26,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/time_control.h>
 
@@ -57,6 +58,8 @@ private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
   OutputDataBase                                      output_data;
+
+  OutputWriter<dim> output_writer;
 };
 
 } // namespace Structure
@@ -30,7 +30,7 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & pp_data
                                           MPI_Comm const &               mpi_comm_in)
   : pp_data(pp_data_in),
     mpi_comm(mpi_comm_in),
-    output_generator(OutputGenerator<dim, Number>(mpi_comm_in)),
+    output_generator(mpi_comm_in),
     error_calculator(ErrorCalculator<dim, Number>(mpi_comm_in))
 {
 }
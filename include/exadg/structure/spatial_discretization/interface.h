@@ -59,6 +59,17 @@ public:
                                VectorType const & displacement,
                                double const       time) const = 0;
 
+  /*
+   * Explicit time integration: sets the Dirichlet degrees of freedom of the displacement to the
+   * boundary data at the given time and computes the acceleration from the momentum equation with
+   * the lumped mass matrix, which is set to zero for constrained degrees of freedom.
+   */
+  virtual void
+  compute_acceleration_explicit(VectorType &       acceleration,
+                                VectorType &       displacement,
+                                VectorType const & velocity,
+                                double const       time) const = 0;
+
   virtual void
   evaluate_mass_operator(VectorType & dst, VectorType const & src) const = 0;
 
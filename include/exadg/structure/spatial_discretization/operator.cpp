@@ -27,6 +27,7 @@
 #include <exadg/operators/constraints.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/quadrature.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/fast_diagonalization_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_amg.h>
 #include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
@@ -162,8 +163,9 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   // the values stored in the DirichletCached boundary condition can be directly
   // injected into the DoF vector. This allows to set constrained degrees of freedom
   // in case of continuous Galerkin discretizations with DirichletCached boundary
-  // conditions.
-  if(not(boundary_descriptor->dirichlet_cached_bc.empty()))
+  // conditions. The same quadrature rule yields a lumped mass matrix for explicit time
+  // integration.
+  if(not(boundary_descriptor->dirichlet_cached_bc.empty()) or param.explicit_time_integration)
   {
     AssertThrow(this->grid->triangulation->all_reference_cells_are_hyper_cube(),
                 ExcNotImplemented());
@@ -229,7 +231,11 @@ Operator<dim, Number>::setup_operators()
   operator_data.large_deformation   = param.large_deformation;
   if(param.large_deformation)
   {
-    operator_data.pull_back_traction = param.pull_back_traction;
+    operator_data.pull_back_traction       = param.pull_back_traction;
+    operator_data.store_linearization_data = param.store_linearization_data;
+    operator_data.store_linearization_data_in_reduced_precision =
+      param.store_linearization_data_in_reduced_precision;
+    operator_data.store_load_data = param.store_load_data;
   }
   else
   {
@@ -239,6 +245,17 @@ Operator<dim, Number>::setup_operators()
   if(param.large_deformation)
   {
     elasticity_operator_nonlinear.initialize(*matrix_free, affine_constraints, operator_data);
+
+    if(param.store_linearization_data)
+    {
+      double const memory = dealii::Utilities::MPI::sum(
+        static_cast<double>(elasticity_operator_nonlinear.memory_consumption_linearization_data()),
+        mpi_comm);
+
+      pcout << std::endl
+            << "Memory consumption of stored linearization data: " << memory / 1.e6 << " MB"
+            << std::endl;
+    }
   }
   else
   {
@@ -257,6 +274,21 @@ Operator<dim, Number>::setup_operators()
     mass_operator.initialize(*matrix_free, affine_constraints, mass_data);
 
     mass_operator.set_scaling_factor(param.density);
+
+    // The Gauss-Lobatto quadrature points coincide with the nodes of the discretization, so that
+    // the mass matrix evaluated with this quadrature rule is diagonal.
+    if(param.explicit_time_integration)
+    {
+      Structure::MassOperatorData<dim> lumped_mass_data = mass_data;
+      lumped_mass_data.quad_index                       = get_quad_index_gauss_lobatto();
+
+      Structure::MassOperator<dim, Number> lumped_mass_operator;
+      lumped_mass_operator.initialize(*matrix_free, affine_constraints, lumped_mass_data);
+      lumped_mass_operator.set_scaling_factor(param.density);
+
+      matrix_free->initialize_dof_vector(inverse_lumped_mass_matrix, get_dof_index());
+      lumped_mass_operator.calculate_inverse_diagonal(inverse_lumped_mass_matrix);
+    }
   }
 
   // setup rhs operator
@@ -265,10 +297,69 @@ Operator<dim, Number>::setup_operators()
   body_force_data.quad_index = get_quad_index();
   body_force_data.function   = field_functions->right_hand_side;
   if(param.large_deformation)
+  {
     body_force_data.pull_back_body_force = param.pull_back_body_force;
+    body_force_data.store_load_data      = param.store_load_data;
+  }
   else
+  {
     body_force_data.pull_back_body_force = false;
+  }
   body_force_operator.initialize(*matrix_free, body_force_data);
+
+  // operators evaluating the nonlinear residual in reduced precision, which do not need to store
+  // linearization data
+  if(param.large_deformation and param.newton_solver_data.reduced_precision_line_search)
+  {
+    setup_matrix_free_reduced_precision();
+
+    OperatorData<dim> operator_data_reduced_precision = operator_data;
+    operator_data_reduced_precision.store_linearization_data = false;
+
+    unsigned int const constraint_index = matrix_free_data->get_constraint_index(get_dof_name());
+
+    elasticity_operator_nonlinear_reduced_precision.initialize(
+      *matrix_free_reduced_precision,
+      *constraints_reduced_precision[constraint_index],
+      operator_data_reduced_precision);
+
+    body_force_operator_reduced_precision.initialize(*matrix_free_reduced_precision,
+                                                     body_force_data);
+  }
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::setup_matrix_free_reduced_precision()
+{
+  // the same DoFHandler and Quadrature objects as for the MatrixFree object in full precision
+  // ensure the same numbering of degrees of freedom, quadrature points, and faces
+  constraints_reduced_precision.clear();
+  std::vector<dealii::AffineConstraints<ReducedPrecisionNumber> const *> constraint_vector;
+  for(auto const & constraint : matrix_free_data->get_constraint_vector())
+  {
+    auto constraint_copy = std::make_shared<dealii::AffineConstraints<ReducedPrecisionNumber>>();
+    constraint_copy->copy_from(*constraint);
+    constraints_reduced_precision.push_back(constraint_copy);
+    constraint_vector.push_back(constraint_copy.get());
+  }
+
+  typedef dealii::MatrixFree<dim, ReducedPrecisionNumber> MatrixFreeReducedPrecision;
+
+  typename MatrixFreeReducedPrecision::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = MatrixFreeReducedPrecision::AdditionalData::none;
+  additional_data.mapping_update_flags  = matrix_free_data->data.mapping_update_flags;
+  additional_data.mapping_update_flags_inner_faces =
+    matrix_free_data->data.mapping_update_flags_inner_faces;
+  additional_data.mapping_update_flags_boundary_faces =
+    matrix_free_data->data.mapping_update_flags_boundary_faces;
+
+  matrix_free_reduced_precision = std::make_shared<MatrixFreeReducedPrecision>();
+  matrix_free_reduced_precision->reinit(get_mapping(),
+                                        matrix_free_data->get_dof_handler_vector(),
+                                        constraint_vector,
+                                        matrix_free_data->get_quadrature_vector(),
+                                        additional_data);
 }
 
 template<int dim, typename Number>
@@ -289,6 +380,8 @@ Operator<dim, Number>::setup()
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
+  memory_matrix_free.set(mf->memory_consumption());
+
   // Subsequently, call the other setup function with MatrixFree/MatrixFreeData objects as
   // arguments.
   this->setup(mf, mf_data);
@@ -357,6 +450,21 @@ Operator<dim, Number>::setup_preconditioner()
         elasticity_operator_linear, false);
     }
   }
+  else if(param.preconditioner == Preconditioner::FastDiagonalization)
+  {
+    if(param.large_deformation)
+    {
+      preconditioner =
+        std::make_shared<FastDiagonalizationPreconditioner<NonLinearOperator<dim, Number>>>(
+          elasticity_operator_nonlinear, false);
+    }
+    else
+    {
+      preconditioner =
+        std::make_shared<FastDiagonalizationPreconditioner<LinearOperator<dim, Number>>>(
+          elasticity_operator_linear, false);
+    }
+  }
   else if(param.preconditioner == Preconditioner::Multigrid)
   {
     if(param.large_deformation)
@@ -570,6 +678,9 @@ Operator<dim, Number>::setup_solver()
     residual_operator.initialize(*this);
     linearized_operator.initialize(*this);
 
+    if(param.newton_solver_data.jacobian_free)
+      linearized_operator.initialize_jacobian_free(residual_operator);
+
     newton_solver = std::make_shared<NewtonSolver>(param.newton_solver_data,
                                                    residual_operator,
                                                    linearized_operator,
@@ -700,6 +811,67 @@ Operator<dim, Number>::prescribe_initial_velocity(VectorType & velocity, double
   velocity = src_double;
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_forces(VectorType &       dst,
+                                       VectorType const & displacement,
+                                       double const       time) const
+{
+  dst = 0.0;
+
+  if(param.large_deformation) // nonlinear case
+  {
+    // elasticity operator
+
+    // NB: we have to deactivate the mass operator term
+    double const scaling_factor_mass =
+      elasticity_operator_nonlinear.get_scaling_factor_mass_operator();
+    elasticity_operator_nonlinear.set_scaling_factor_mass_operator(0.0);
+
+    // evaluate elasticity operator including inhomogeneous Dirichlet/Neumann boundary conditions,
+    // where the Dirichlet degrees of freedom of the displacement have to be set correctly
+    elasticity_operator_nonlinear.set_time(time);
+    elasticity_operator_nonlinear.evaluate_nonlinear(dst, displacement);
+    // shift to right-hand side
+    dst *= -1.0;
+
+    // revert scaling factor to initialized value
+    elasticity_operator_nonlinear.set_scaling_factor_mass_operator(scaling_factor_mass);
+
+    // body forces
+    if(param.body_force)
+    {
+      body_force_operator.evaluate_add(dst, displacement, time);
+    }
+  }
+  else // linear case
+  {
+    // elasticity operator
+    // NB: we have to deactivate the mass operator
+    double const scaling_factor_mass =
+      elasticity_operator_linear.get_scaling_factor_mass_operator();
+    elasticity_operator_linear.set_scaling_factor_mass_operator(0.0);
+
+    // evaluate elasticity operator including inhomogeneous Dirichlet/Neumann boundary conditions,
+    // where the Dirichlet degrees of freedom of the displacement have to be set correctly
+    elasticity_operator_linear.set_time(time);
+    elasticity_operator_linear.evaluate(dst, displacement);
+    // shift to right-hand side
+    dst *= -1.0;
+
+    // revert scaling factor to initialized value
+    elasticity_operator_linear.set_scaling_factor_mass_operator(scaling_factor_mass);
+
+    // body force
+    if(param.body_force)
+    {
+      // displacement is irrelevant for linear problem, since
+      // pull_back_body_force = false in this case.
+      body_force_operator.evaluate_add(dst, displacement, time);
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::compute_initial_acceleration(VectorType &       initial_acceleration,
@@ -724,67 +896,13 @@ Operator<dim, Number>::compute_initial_acceleration(VectorType &       initial_a
   else
   {
     VectorType rhs(initial_acceleration);
-    rhs = 0.0;
 
-    if(param.large_deformation) // nonlinear case
-    {
-      // elasticity operator
-
-      // NB: we have to deactivate the mass operator term
-      double const scaling_factor_mass =
-        elasticity_operator_nonlinear.get_scaling_factor_mass_operator();
-      elasticity_operator_nonlinear.set_scaling_factor_mass_operator(0.0);
-
-      // evaluate elasticity operator including inhomogeneous Dirichlet/Neumann boundary conditions:
-      // Note that we do not have to set inhomogeneous Dirichlet degrees of freedom explicitly since
-      // the function prescribe_initial_displacement() sets the initial displacement for all dofs
-      // (including Dirichlet dofs) and since the initial condition for the displacements needs to
-      // be consistent with the Dirichlet boundary data g(t=t0) at initial time, i.e. the vector
-      // initial_displacement already contains the correct Dirichlet data.
-      elasticity_operator_nonlinear.set_time(time);
-      elasticity_operator_nonlinear.evaluate_nonlinear(rhs, initial_displacement);
-      // shift to right-hand side
-      rhs *= -1.0;
-
-      // revert scaling factor to initialized value
-      elasticity_operator_nonlinear.set_scaling_factor_mass_operator(scaling_factor_mass);
-
-      // body forces
-      if(param.body_force)
-      {
-        body_force_operator.evaluate_add(rhs, initial_displacement, time);
-      }
-    }
-    else // linear case
-    {
-      // elasticity operator
-      // NB: we have to deactivate the mass operator
-      double const scaling_factor_mass =
-        elasticity_operator_linear.get_scaling_factor_mass_operator();
-      elasticity_operator_linear.set_scaling_factor_mass_operator(0.0);
-
-      // evaluate elasticity operator including inhomogeneous Dirichlet/Neumann boundary conditions:
-      // Note that we do not have to set inhomogeneous Dirichlet degrees of freedom explicitly since
-      // the function prescribe_initial_displacement() sets the initial displacement for all dofs
-      // (including Dirichlet dofs) and since the initial condition for the displacements needs to
-      // be consistent with the Dirichlet boundary data g(t=t0) at initial time, i.e. the vector
-      // initial_displacement already contains the correct Dirichlet data.
-      elasticity_operator_linear.set_time(time);
-      elasticity_operator_linear.evaluate(rhs, initial_displacement);
-      // shift to right-hand side
-      rhs *= -1.0;
-
-      // revert scaling factor to initialized value
-      elasticity_operator_linear.set_scaling_factor_mass_operator(scaling_factor_mass);
-
-      // body force
-      if(param.body_force)
-      {
-        // displacement is irrelevant for linear problem, since
-        // pull_back_body_force = false in this case.
-        body_force_operator.evaluate_add(rhs, initial_displacement, time);
-      }
-    }
+    // Note that we do not have to set inhomogeneous Dirichlet degrees of freedom explicitly since
+    // the function prescribe_initial_displacement() sets the initial displacement for all dofs
+    // (including Dirichlet dofs) and since the initial condition for the displacements needs to
+    // be consistent with the Dirichlet boundary data g(t=t0) at initial time, i.e. the vector
+    // initial_displacement already contains the correct Dirichlet data.
+    evaluate_forces(rhs, initial_displacement, time);
 
     // Shift inhomogeneous part of mass matrix operator (i.e. mass matrix applied to a dof vector
     // with the initial acceleration in Dirichlet degrees of freedom) to the right-hand side
@@ -799,6 +917,49 @@ Operator<dim, Number>::compute_initial_acceleration(VectorType &       initial_a
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::compute_acceleration_explicit(VectorType &       acceleration,
+                                                     VectorType &       displacement,
+                                                     VectorType const & velocity,
+                                                     double const       time) const
+{
+  AssertThrow(param.explicit_time_integration,
+              dealii::ExcMessage("The lumped mass matrix has not been set up."));
+
+  if(param.large_deformation)
+  {
+    elasticity_operator_nonlinear.set_time(time);
+    elasticity_operator_nonlinear.set_inhomogeneous_boundary_values(displacement);
+  }
+  else
+  {
+    elasticity_operator_linear.set_time(time);
+    elasticity_operator_linear.set_inhomogeneous_boundary_values(displacement);
+  }
+
+  VectorType rhs(acceleration);
+  evaluate_forces(rhs, displacement, time);
+
+  // damping term
+  if(param.weak_damping_active)
+  {
+    VectorType damping(acceleration);
+    damping = 0.0;
+    apply_add_damping_operator(damping, velocity);
+    rhs -= damping;
+  }
+
+  // invert lumped mass matrix
+  acceleration = rhs;
+  acceleration.scale(inverse_lumped_mass_matrix);
+
+  if(param.large_deformation)
+    elasticity_operator_nonlinear.set_constrained_dofs_to_zero(acceleration);
+  else
+    elasticity_operator_linear.set_constrained_dofs_to_zero(acceleration);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_mass_operator(VectorType & dst, VectorType const & src) const
@@ -855,6 +1016,49 @@ Operator<dim, Number>::evaluate_nonlinear_residual(VectorType &       dst,
   elasticity_operator_nonlinear.set_constrained_dofs_to_zero(dst);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_nonlinear_residual_reduced_precision(
+  VectorType &       dst,
+  VectorType const & src,
+  VectorType const & const_vector,
+  double const       factor,
+  double const       time) const
+{
+  AssertThrow(matrix_free_reduced_precision.get() != nullptr,
+              dealii::ExcMessage("The operators in reduced precision have not been set up."));
+
+  // inhomogeneous Dirichlet degrees of freedom are contained in src
+  VectorTypeReducedPrecision src_reduced_precision, dst_reduced_precision;
+  matrix_free_reduced_precision->initialize_dof_vector(src_reduced_precision, get_dof_index());
+  src_reduced_precision.copy_locally_owned_data_from(src);
+  dst_reduced_precision.reinit(src_reduced_precision, true);
+
+  elasticity_operator_nonlinear_reduced_precision.set_scaling_factor_mass_operator(factor);
+  elasticity_operator_nonlinear_reduced_precision.set_time(time);
+  elasticity_operator_nonlinear_reduced_precision.evaluate_nonlinear(dst_reduced_precision,
+                                                                     src_reduced_precision);
+
+  // body forces
+  if(param.body_force)
+  {
+    VectorTypeReducedPrecision body_forces;
+    body_forces.reinit(dst_reduced_precision);
+    body_force_operator_reduced_precision.evaluate_add(body_forces, src_reduced_precision, time);
+    dst_reduced_precision -= body_forces;
+  }
+
+  dst.copy_locally_owned_data_from(dst_reduced_precision);
+
+  // dynamic problems: the constant vector is added in full precision
+  if(param.problem_type == ProblemType::Unsteady)
+  {
+    dst.add(1.0, const_vector);
+  }
+
+  elasticity_operator_nonlinear.set_constrained_dofs_to_zero(dst);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::set_solution_linearization(VectorType const & vector) const
@@ -874,6 +1078,14 @@ Operator<dim, Number>::apply_linearized_operator(VectorType &       dst,
   elasticity_operator_nonlinear.vmult(dst, src);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::copy_constrained_dofs(VectorType & dst, VectorType const & src) const
+{
+  for(unsigned int const constrained_index : matrix_free->get_constrained_dofs(get_dof_index()))
+    dst.local_element(constrained_index) = src.local_element(constrained_index);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_elasticity_operator(VectorType &       dst,
@@ -942,6 +1154,15 @@ Operator<dim, Number>::solve_nonlinear(VectorType &       sol,
   update.update_every_newton_iter = param.update_preconditioner_every_newton_iterations;
   update.update_once_converged    = param.update_preconditioner_once_newton_converged;
 
+  // the adaptive strategy decides in every Newton iteration whether to update, irrespective of
+  // the schedule in terms of time steps
+  if(param.update_preconditioner_adaptively)
+  {
+    update.do_update                         = param.update_preconditioner;
+    update.update_adaptively                 = true;
+    update.linear_iterations_increase_factor = param.update_preconditioner_linear_iterations_factor;
+  }
+
   // solve nonlinear problem
   auto const iter = newton_solver->solve(sol, update);
 
@@ -1013,6 +1234,16 @@ Operator<dim, Number>::get_matrix_free() const
   return matrix_free;
 }
 
+template<int dim, typename Number>
+std::size_t
+Operator<dim, Number>::memory_consumption_linearization_data() const
+{
+  if(param.large_deformation and param.store_linearization_data)
+    return elasticity_operator_nonlinear.memory_consumption_linearization_data();
+  else
+    return 0;
+}
+
 template<int dim, typename Number>
 dealii::Mapping<dim> const &
 Operator<dim, Number>::get_mapping() const
@@ -40,6 +40,7 @@
 #include <exadg/structure/user_interface/boundary_descriptor.h>
 #include <exadg/structure/user_interface/field_functions.h>
 #include <exadg/structure/user_interface/parameters.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -92,6 +93,17 @@ public:
     pde_operator->evaluate_nonlinear_residual(dst, src, *const_vector, scaling_factor_mass, time);
   }
 
+  /*
+   * Cheaper evaluation of the residual used by the Newton solver to screen the trial steps of the
+   * line search.
+   */
+  void
+  evaluate_residual_reduced_precision(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->evaluate_nonlinear_residual_reduced_precision(
+      dst, src, *const_vector, scaling_factor_mass, time);
+  }
+
 private:
   PDEOperator const * pde_operator;
 
@@ -136,6 +148,22 @@ public:
     pde_operator->set_solution_linearization(solution_linearization);
   }
 
+  /*
+   * Jacobian-free Newton-Krylov mode: The linearized operator is applied via finite differences of
+   * the nonlinear residual evaluated by residual_operator.
+   */
+  void
+  initialize_jacobian_free(ResidualOperator<dim, Number> const & residual_operator)
+  {
+    jacobian_free_operator.initialize(residual_operator);
+  }
+
+  void
+  set_jacobian_free_linearization(VectorType const & solution, VectorType const & rhs)
+  {
+    jacobian_free_operator.set_linearization_point(solution, rhs);
+  }
+
   void
   update(double const scaling_factor_mass, double const time)
   {
@@ -150,7 +178,18 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const
   {
-    pde_operator->apply_linearized_operator(dst, src, scaling_factor_mass, time);
+    if(jacobian_free_operator.is_active())
+    {
+      jacobian_free_operator.vmult(dst, src);
+
+      // the residual vanishes for constrained degrees of freedom, while the linearized operator is
+      // the identity for constrained degrees of freedom
+      pde_operator->copy_constrained_dofs(dst, src);
+    }
+    else
+    {
+      pde_operator->apply_linearized_operator(dst, src, scaling_factor_mass, time);
+    }
   }
 
 private:
@@ -158,6 +197,8 @@ private:
 
   double scaling_factor_mass;
   double time;
+
+  Newton::JacobianFreeOperator<VectorType, ResidualOperator<dim, Number>> jacobian_free_operator;
 };
 
 template<int dim, typename Number>
@@ -166,8 +207,13 @@ class Operator : public dealii::Subscriptor, public Interface::Operator<Number>
 private:
   typedef float MultigridNumber;
 
+  typedef float ReducedPrecisionNumber;
+
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
+  typedef dealii::LinearAlgebra::distributed::Vector<ReducedPrecisionNumber>
+    VectorTypeReducedPrecision;
+
 public:
   /*
    * Constructor.
@@ -225,6 +271,12 @@ public:
                                VectorType const & initial_displacement,
                                double const       time) const final;
 
+  void
+  compute_acceleration_explicit(VectorType &       acceleration,
+                                VectorType &       displacement,
+                                VectorType const & velocity,
+                                double const       time) const final;
+
   void
   evaluate_mass_operator(VectorType & dst, VectorType const & src) const final;
 
@@ -243,6 +295,17 @@ public:
                               double const       factor,
                               double const       time) const;
 
+  /*
+   * Same as evaluate_nonlinear_residual(), but the operators are evaluated in reduced precision.
+   * This function is used to screen the trial steps of the line search of the Newton solver.
+   */
+  void
+  evaluate_nonlinear_residual_reduced_precision(VectorType &       dst,
+                                                VectorType const & src,
+                                                VectorType const & const_vector,
+                                                double const       factor,
+                                                double const       time) const;
+
   void
   set_solution_linearization(VectorType const & vector) const;
 
@@ -252,6 +315,12 @@ public:
                             double const       factor,
                             double const       time) const;
 
+  /*
+   * Sets the constrained degrees of freedom of dst to the values of src.
+   */
+  void
+  copy_constrained_dofs(VectorType & dst, VectorType const & src) const;
+
   void
   evaluate_elasticity_operator(VectorType &       dst,
                                VectorType const & src,
@@ -304,6 +373,13 @@ public:
   std::shared_ptr<dealii::MatrixFree<dim, Number> const>
   get_matrix_free() const;
 
+  /*
+   * Memory consumption in bytes of the linearization data stored by the nonlinear elasticity
+   * operator.
+   */
+  std::size_t
+  memory_consumption_linearization_data() const;
+
   dealii::Mapping<dim> const &
   get_mapping() const;
 
@@ -372,6 +448,16 @@ private:
   void
   setup_operators();
 
+  void
+  setup_matrix_free_reduced_precision();
+
+  /*
+   * Evaluates the right-hand side of the momentum equation without inertia and damping terms,
+   * i.e., body forces minus the elasticity operator including inhomogeneous boundary conditions.
+   */
+  void
+  evaluate_forces(VectorType & dst, VectorType const & displacement, double const time) const;
+
   /**
    * Initializes preconditioner.
    */
@@ -450,6 +536,9 @@ private:
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
 
+  // memory of the MatrixFree object created in setup(), see MemoryReport
+  MemoryReport::Entry memory_matrix_free{MemoryCategory::MatrixFree};
+
   /*
    * Interface coupling
    */
@@ -473,6 +562,22 @@ private:
   // problems and in the residual for nonlinear problems.
   Structure::MassOperator<dim, Number> mass_operator;
 
+  // inverse of the lumped mass matrix, only relevant for explicit time integration
+  VectorType inverse_lumped_mass_matrix;
+
+  /*
+   * Copies of MatrixFree and of the operators evaluating the nonlinear residual in reduced
+   * precision, which are only set up if the line search of the Newton solver is screened in
+   * reduced precision.
+   */
+  std::vector<std::shared_ptr<dealii::AffineConstraints<ReducedPrecisionNumber>>>
+    constraints_reduced_precision;
+
+  std::shared_ptr<dealii::MatrixFree<dim, ReducedPrecisionNumber>> matrix_free_reduced_precision;
+
+  NonLinearOperator<dim, ReducedPrecisionNumber> elasticity_operator_nonlinear_reduced_precision;
+  BodyForceOperator<dim, ReducedPrecisionNumber> body_force_operator_reduced_precision;
+
   /*
    * Solution of nonlinear systems of equations
    */
@@ -28,7 +28,11 @@ namespace ExaDG
 namespace Structure
 {
 template<int dim, typename Number>
-BodyForceOperator<dim, Number>::BodyForceOperator() : matrix_free(nullptr), time(0.0)
+BodyForceOperator<dim, Number>::BodyForceOperator()
+  : matrix_free(nullptr),
+    time(0.0),
+    body_force_values_time(0.0),
+    body_force_values_available(false)
 {
 }
 
@@ -39,6 +43,11 @@ BodyForceOperator<dim, Number>::initialize(dealii::MatrixFree<dim, Number> const
 {
   this->matrix_free = &matrix_free;
   this->data        = data;
+
+  if(data.store_load_data)
+    body_force_values.initialize(matrix_free, data.quad_index, false, false);
+
+  body_force_values_available = false;
 }
 
 template<int dim, typename Number>
@@ -62,9 +71,42 @@ BodyForceOperator<dim, Number>::evaluate_add(VectorType &       dst,
 {
   this->time = time;
 
+  if(data.store_load_data and not(body_force_values_available and body_force_values_time == time))
+  {
+    VectorType dummy;
+    matrix_free->cell_loop(&This::cell_loop_set_body_force, this, dummy, dummy);
+
+    body_force_values_time      = time;
+    body_force_values_available = true;
+  }
+
   matrix_free->cell_loop(&This::cell_loop, this, dst, src, false /*zero_dst_vector*/);
 }
 
+template<int dim, typename Number>
+void
+BodyForceOperator<dim, Number>::cell_loop_set_body_force(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &,
+  VectorType const &,
+  Range const & cell_range) const
+{
+  IntegratorCell integrator(matrix_free, data.dof_index, data.quad_index);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator.reinit(cell);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      body_force_values.set_coefficient_cell(
+        cell,
+        q,
+        FunctionEvaluator<1, dim, Number>::value(*(data.function),
+                                                 integrator.quadrature_point(q),
+                                                 time));
+  }
+}
+
 template<int dim, typename Number>
 void
 BodyForceOperator<dim, Number>::cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free,
@@ -86,8 +128,16 @@ BodyForceOperator<dim, Number>::cell_loop(dealii::MatrixFree<dim, Number> const
 
     for(unsigned int q = 0; q < integrator.n_q_points; ++q)
     {
-      auto q_points = integrator.quadrature_point(q);
-      auto b        = FunctionEvaluator<1, dim, Number>::value(*(data.function), q_points, time);
+      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> b;
+      if(data.store_load_data)
+      {
+        b = body_force_values.get_coefficient_cell(cell, q);
+      }
+      else
+      {
+        auto q_points = integrator.quadrature_point(q);
+        b = FunctionEvaluator<1, dim, Number>::value(*(data.function), q_points, time);
+      }
 
       if(data.pull_back_body_force)
       {
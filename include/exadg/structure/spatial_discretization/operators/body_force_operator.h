@@ -25,6 +25,7 @@
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/mapping_flags.h>
+#include <exadg/operators/variable_coefficients.h>
 
 namespace ExaDG
 {
@@ -33,7 +34,8 @@ namespace Structure
 template<int dim>
 struct BodyForceData
 {
-  BodyForceData() : dof_index(0), quad_index(0), pull_back_body_force(false)
+  BodyForceData()
+    : dof_index(0), quad_index(0), pull_back_body_force(false), store_load_data(false)
   {
   }
 
@@ -43,6 +45,9 @@ struct BodyForceData
   std::shared_ptr<dealii::Function<dim>> function;
 
   bool pull_back_body_force;
+
+  // evaluate the function once per time and store the values in all quadrature points
+  bool store_load_data;
 };
 
 template<int dim, typename Number>
@@ -85,11 +90,26 @@ private:
             VectorType const &                      src,
             Range const &                           cell_range) const;
 
+  /*
+   * Evaluates the body force in all quadrature points for the current time.
+   */
+  void
+  cell_loop_set_body_force(dealii::MatrixFree<dim, Number> const & matrix_free,
+                           VectorType &,
+                           VectorType const &,
+                           Range const & cell_range) const;
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   BodyForceData<dim> data;
 
   double mutable time;
+
+  // stored body force and the time for which it has been evaluated
+  mutable VariableCoefficients<dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>>
+                 body_force_values;
+  mutable double body_force_values_time;
+  mutable bool   body_force_values_available;
 };
 
 } // namespace Structure
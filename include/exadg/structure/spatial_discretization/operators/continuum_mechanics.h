@@ -66,6 +66,42 @@ inline DEAL_II_ALWAYS_INLINE //
   return 0.5 * subtract_identity(transpose(F) * F);
 }
 
+/*
+ * Inverse of the right Cauchy-Green tensor C = F^T * F computed via the adjugate of C, where the
+ * determinant det(C) = J^2 is already known from the Jacobian J = det(F).
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  get_C_inverse(dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & C,
+                dealii::VectorizedArray<Number> const &                         J)
+{
+  return adjugate(C) / (J * J);
+}
+
+/*
+ * Product C^{-1} * delta E * C^{-1} with the strain increment
+ *
+ *  delta E = 1/2 (F^T * Grad(delta d) + Grad(delta d)^T * F)
+ *
+ * given F_transpose_times_gradient_increment = F^T * Grad(delta d). Since C^{-1} is symmetric, the
+ * product equals 1/2 (X + X^T) with X = C^{-1} * F^T * Grad(delta d) * C^{-1}. The directional
+ * derivative of C^{-1} is delta C^{-1} = - 2 C^{-1} * delta E * C^{-1}.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  get_C_inverse_times_delta_E_times_C_inverse(
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & C_inverse,
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const &
+      F_transpose_times_gradient_increment)
+{
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const X =
+    C_inverse * F_transpose_times_gradient_increment * C_inverse;
+
+  return 0.5 * (X + transpose(X));
+}
+
 } // namespace Structure
 } // namespace ExaDG
 
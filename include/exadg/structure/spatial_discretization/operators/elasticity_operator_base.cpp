@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/structure/spatial_discretization/operators/boundary_conditions.h>
 #include <exadg/structure/spatial_discretization/operators/elasticity_operator_base.h>
 
 namespace ExaDG
@@ -31,7 +32,8 @@ namespace ExaDG
 namespace Structure
 {
 template<int dim, typename Number>
-ElasticityOperatorBase<dim, Number>::ElasticityOperatorBase() : scaling_factor_mass(1.0)
+ElasticityOperatorBase<dim, Number>::ElasticityOperatorBase()
+  : scaling_factor_mass(1.0), neumann_values_time(0.0), neumann_values_available(false)
 {
 }
 
@@ -195,6 +197,96 @@ ElasticityOperatorBase<dim, Number>::set_inhomogeneous_boundary_values(VectorTyp
   }
 }
 
+template<int dim, typename Number>
+dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+ElasticityOperatorBase<dim, Number>::get_neumann_value(
+  unsigned int const               q,
+  IntegratorFace const &           integrator,
+  BoundaryType const &             boundary_type,
+  dealii::types::boundary_id const boundary_id) const
+{
+  if(boundary_type == BoundaryType::Neumann and neumann_values_available)
+  {
+    return neumann_values(integrator.get_current_cell_index() -
+                            this->matrix_free->n_inner_face_batches(),
+                          q);
+  }
+  else
+  {
+    return calculate_neumann_value<dim, Number>(
+      q, integrator, boundary_type, boundary_id, operator_data.bc, this->time);
+  }
+}
+
+template<int dim, typename Number>
+void
+ElasticityOperatorBase<dim, Number>::update_neumann_values() const
+{
+  if(not operator_data.store_load_data or
+     (neumann_values_available and neumann_values_time == this->time))
+    return;
+
+  // evaluate the functions directly while filling the table
+  neumann_values_available = false;
+
+  unsigned int const n_inner_faces    = this->matrix_free->n_inner_face_batches();
+  unsigned int const n_boundary_faces = this->matrix_free->n_boundary_face_batches();
+
+  IntegratorFace integrator(*this->matrix_free,
+                            true,
+                            operator_data.dof_index,
+                            operator_data.quad_index);
+
+  neumann_values.reinit(n_boundary_faces, integrator.n_q_points);
+
+  for(unsigned int face = n_inner_faces; face < n_inner_faces + n_boundary_faces; ++face)
+  {
+    dealii::types::boundary_id const boundary_id = this->matrix_free->get_boundary_id(face);
+
+    if(operator_data.bc->get_boundary_type(boundary_id) == BoundaryType::Neumann)
+    {
+      integrator.reinit(face);
+
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        neumann_values(face - n_inner_faces, q) = calculate_neumann_value<dim, Number>(
+          q, integrator, BoundaryType::Neumann, boundary_id, operator_data.bc, this->time);
+    }
+  }
+
+  neumann_values_time      = this->time;
+  neumann_values_available = true;
+}
+
+template<int dim, typename Number>
+void
+ElasticityOperatorBase<dim, Number>::reinit_fast_diagonalization_kernel(
+  FastDiagonalizationKernel<dim, Number> & kernel) const
+{
+  unsigned int const n_cell_batches = this->matrix_free->n_cell_batches();
+
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> lambda(n_cell_batches), mu(n_cell_batches);
+  for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+  {
+    material_handler.reinit(*this->matrix_free, cell);
+
+    std::array<dealii::VectorizedArray<Number>, 2> const lame_parameters =
+      material_handler.get_material()->get_linearized_lame_parameters(cell);
+
+    lambda[cell] = lame_parameters[0];
+    mu[cell]     = lame_parameters[1];
+  }
+
+  double const mass_factor =
+    operator_data.unsteady ? scaling_factor_mass * operator_data.density : 0.0;
+
+  kernel.reinit_elasticity(*this->matrix_free,
+                           operator_data.dof_index,
+                           operator_data.quad_index,
+                           mass_factor,
+                           lambda,
+                           mu);
+}
+
 template<int dim, typename Number>
 void
 ElasticityOperatorBase<dim, Number>::reinit_cell_derived(IntegratorCell &   integrator,
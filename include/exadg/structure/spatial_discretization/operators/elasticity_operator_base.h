@@ -40,7 +40,10 @@ struct OperatorData : public OperatorBaseData
       pull_back_traction(false),
       unsteady(false),
       density(1.0),
-      quad_index_gauss_lobatto(0)
+      quad_index_gauss_lobatto(0),
+      store_linearization_data(false),
+      store_linearization_data_in_reduced_precision(false),
+      store_load_data(false)
   {
   }
 
@@ -64,6 +67,17 @@ struct OperatorData : public OperatorBaseData
   // for DirichletCached boundary conditions, another quadrature rule
   // is needed to set the constrained DoFs.
   unsigned int quad_index_gauss_lobatto;
+
+  // This parameter is only relevant for the nonlinear operator: store the deformation gradient
+  // and the 2nd Piola-Kirchhoff stress at the linearization point in all quadrature points instead
+  // of recomputing them in every application of the linearized operator, optionally in reduced
+  // precision.
+  bool store_linearization_data;
+  bool store_linearization_data_in_reduced_precision;
+
+  // This parameter is only relevant for the nonlinear operator: evaluate the tractions of Neumann
+  // boundaries once per time and store them in all quadrature points of the boundary faces.
+  bool store_load_data;
 };
 
 template<int dim, typename Number>
@@ -112,11 +126,46 @@ protected:
   void
   reinit_cell_derived(IntegratorCell & integrator, unsigned int const cell) const override;
 
+  /*
+   * Component-blocked separable approximation of the cell blocks based on the isotropic linear
+   * elasticity tensor of the materials in the reference configuration, see
+   * FastDiagonalizationKernel::reinit_elasticity(). For the nonlinear operator, the dependency of
+   * the tangent on the linearization point is neglected.
+   */
+  void
+  reinit_fast_diagonalization_kernel(
+    FastDiagonalizationKernel<dim, Number> & kernel) const override;
+
+  /*
+   * Traction at quadrature point q of the boundary face of integrator, see
+   * calculate_neumann_value(). For Neumann boundaries, the traction is taken from the table of
+   * stored load data if available.
+   */
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+  get_neumann_value(unsigned int const               q,
+                    IntegratorFace const &           integrator,
+                    BoundaryType const &             boundary_type,
+                    dealii::types::boundary_id const boundary_id) const;
+
+  /*
+   * Evaluates the tractions of Neumann boundaries in all quadrature points of the boundary faces
+   * if store_load_data is set and the time has changed since the last call.
+   */
+  void
+  update_neumann_values() const;
+
   OperatorData<dim> operator_data;
 
   mutable MaterialHandler<dim, Number> material_handler;
 
   mutable double scaling_factor_mass;
+
+private:
+  // tractions of Neumann boundaries with row index face - n_inner_face_batches()
+  mutable dealii::Table<2, dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>>
+                 neumann_values;
+  mutable double neumann_values_time;
+  mutable bool   neumann_values_available;
 };
 
 } // namespace Structure
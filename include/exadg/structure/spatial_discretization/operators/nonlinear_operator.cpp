@@ -42,12 +42,31 @@ NonLinearOperator<dim, Number>::initialize(
   // it should not make a difference here whether we use dof_index or dof_index_inhomogeneous
   this->matrix_free->initialize_dof_vector(displacement_lin, this->operator_data.dof_index);
   displacement_lin.update_ghost_values();
+
+  if(this->operator_data.store_linearization_data)
+  {
+    bool const reduced_precision =
+      this->operator_data.store_linearization_data_in_reduced_precision;
+
+    deformation_gradient_lin.initialize(
+      *this->matrix_free, this->operator_data.quad_index, false, false, reduced_precision);
+    second_piola_kirchhoff_stress_lin.initialize(
+      *this->matrix_free, this->operator_data.quad_index, false, false, reduced_precision);
+
+    VectorType dummy;
+    this->matrix_free->cell_loop(&This::cell_loop_linearization_data,
+                                 this,
+                                 dummy,
+                                 displacement_lin);
+  }
 }
 
 template<int dim, typename Number>
 void
 NonLinearOperator<dim, Number>::evaluate_nonlinear(VectorType & dst, VectorType const & src) const
 {
+  this->update_neumann_values();
+
   this->matrix_free->loop(&This::cell_loop_nonlinear,
                           &This::face_loop_nonlinear,
                           &This::boundary_face_loop_nonlinear,
@@ -89,6 +108,15 @@ NonLinearOperator<dim, Number>::set_solution_linearization(VectorType const & ve
   {
     displacement_lin = vector;
     displacement_lin.update_ghost_values();
+
+    if(this->operator_data.store_linearization_data)
+    {
+      VectorType dummy;
+      this->matrix_free->cell_loop(&This::cell_loop_linearization_data,
+                                   this,
+                                   dummy,
+                                   displacement_lin);
+    }
   }
 }
 
@@ -99,6 +127,14 @@ NonLinearOperator<dim, Number>::get_solution_linearization() const
   return displacement_lin;
 }
 
+template<int dim, typename Number>
+std::size_t
+NonLinearOperator<dim, Number>::memory_consumption_linearization_data() const
+{
+  return deformation_gradient_lin.memory_consumption() +
+         second_piola_kirchhoff_stress_lin.memory_consumption();
+}
+
 template<int dim, typename Number>
 void
 NonLinearOperator<dim, Number>::reinit_cell_nonlinear(IntegratorCell &   integrator,
@@ -181,6 +217,40 @@ NonLinearOperator<dim, Number>::cell_loop_valid_deformation(
   }
 }
 
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::cell_loop_linearization_data(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  (void)dst;
+
+  IntegratorCell integrator(matrix_free,
+                            this->operator_data.dof_index_inhomogeneous,
+                            this->operator_data.quad_index);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    reinit_cell_nonlinear(integrator, cell);
+
+    integrator.read_dof_values(src);
+    integrator.evaluate(dealii::EvaluationFlags::gradients);
+
+    std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      tensor const Grad_d_lin = integrator.get_gradient(q);
+
+      deformation_gradient_lin.set_coefficient_cell(cell, q, get_F<dim, Number>(Grad_d_lin));
+      second_piola_kirchhoff_stress_lin.set_coefficient_cell(
+        cell, q, material->second_piola_kirchhoff_stress(Grad_d_lin, cell, q));
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 NonLinearOperator<dim, Number>::face_loop_nonlinear(
@@ -281,8 +351,7 @@ NonLinearOperator<dim, Number>::do_boundary_integral_continuous(
 
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
-    auto traction = calculate_neumann_value<dim, Number>(
-      q, integrator, boundary_type, boundary_id, this->operator_data.bc, this->time);
+    auto traction = this->get_neumann_value(q, integrator, boundary_type, boundary_id);
 
     if(this->operator_data.pull_back_traction)
     {
@@ -306,10 +375,14 @@ NonLinearOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrato
 {
   Base::reinit_cell_derived(integrator, cell);
 
-  integrator_lin->reinit(cell);
+  // the linearization point is only evaluated if the linearization data are not stored
+  if(not this->operator_data.store_linearization_data)
+  {
+    integrator_lin->reinit(cell);
 
-  integrator_lin->read_dof_values(displacement_lin);
-  integrator_lin->evaluate(dealii::EvaluationFlags::gradients);
+    integrator_lin->read_dof_values(displacement_lin);
+    integrator_lin->evaluate(dealii::EvaluationFlags::gradients);
+  }
 }
 
 template<int dim, typename Number>
@@ -324,13 +397,23 @@ NonLinearOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) co
     // kinematics
     tensor const Grad_delta = integrator.get_gradient(q);
 
-    tensor const Grad_d_lin = integrator_lin->get_gradient(q);
+    tensor F_lin, S_lin;
+    if(this->operator_data.store_linearization_data)
+    {
+      F_lin = deformation_gradient_lin.get_coefficient_cell(integrator.get_current_cell_index(), q);
+      S_lin = second_piola_kirchhoff_stress_lin.get_coefficient_cell(
+        integrator.get_current_cell_index(), q);
+    }
+    else
+    {
+      tensor const Grad_d_lin = integrator_lin->get_gradient(q);
 
-    tensor const F_lin = get_F<dim, Number>(Grad_d_lin);
+      F_lin = get_F<dim, Number>(Grad_d_lin);
 
-    // 2nd Piola-Kirchhoff stresses
-    tensor const S_lin =
-      material->second_piola_kirchhoff_stress(Grad_d_lin, integrator.get_current_cell_index(), q);
+      // 2nd Piola-Kirchhoff stresses
+      S_lin =
+        material->second_piola_kirchhoff_stress(Grad_d_lin, integrator.get_current_cell_index(), q);
+    }
 
     // directional derivative of 1st Piola-Kirchhoff stresses P
 
@@ -22,6 +22,7 @@
 #ifndef INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 #define INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 
+#include <exadg/operators/variable_coefficients.h>
 #include <exadg/structure/spatial_discretization/operators/elasticity_operator_base.h>
 
 namespace ExaDG
@@ -85,6 +86,13 @@ public:
   VectorType const &
   get_solution_linearization() const;
 
+  /**
+   * Linearized operator: Returns the memory consumption in bytes of the deformation gradient and
+   * stress stored at the linearization point (zero if these data are recomputed).
+   */
+  std::size_t
+  memory_consumption_linearization_data() const;
+
 private:
   /*
    * Non-linear operator.
@@ -166,6 +174,16 @@ private:
   do_boundary_integral_continuous(IntegratorFace &                   integrator_m,
                                   dealii::types::boundary_id const & boundary_id) const final;
 
+  /*
+   * Linearized operator: computes the deformation gradient F and the 2nd Piola-Kirchhoff stress S
+   * at the linearization point in all quadrature points.
+   */
+  void
+  cell_loop_linearization_data(dealii::MatrixFree<dim, Number> const & matrix_free,
+                               VectorType &                            dst,
+                               VectorType const &                      src,
+                               Range const &                           range) const;
+
   /*
    * Linearized operator.
    */
@@ -202,6 +220,11 @@ private:
 
   mutable std::shared_ptr<IntegratorCell> integrator_lin;
   mutable VectorType                      displacement_lin;
+
+  // deformation gradient and 2nd Piola-Kirchhoff stress at the linearization point, only used if
+  // these data are stored instead of recomputed
+  mutable VariableCoefficients<tensor> deformation_gradient_lin;
+  mutable VariableCoefficients<tensor> second_piola_kirchhoff_stress_lin;
 };
 
 } // namespace Structure
@@ -37,9 +37,11 @@
 // utilities
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/hypercube_resolution_parameters.h>
+#include <exadg/operators/scaling_study.h>
 #include <exadg/operators/throughput_parameters.h>
 #include <exadg/utilities/enum_patterns.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/performance_report.h>
 
 // application
 #include <exadg/structure/user_interface/declare_get_application.h>
@@ -60,6 +62,9 @@ create_input_file(std::string const & input_file)
   ThroughputParameters<ExaDG::Structure::OperatorType> throughput;
   throughput.add_parameters(prm);
 
+  ScalingStudyParameters scaling;
+  scaling.add_parameters(prm);
+
   try
   {
     // we have to assume a default dimension and default Number type
@@ -92,6 +97,11 @@ run(ThroughputParameters<ExaDG::Structure::OperatorType> const & throughput,
 
   application->set_parameters_throughput_study(degree, refine_space, n_cells_1d);
 
+  if(throughput.operator_type == Structure::OperatorType::ApplyStoredLinearization)
+    application->set_store_linearization_data_throughput_study(true);
+  else if(throughput.operator_type == Structure::OperatorType::ApplyRecomputedLinearization)
+    application->set_store_linearization_data_throughput_study(false);
+
   std::shared_ptr<Structure::Driver<dim, Number>> driver =
     std::make_shared<Structure::Driver<dim, Number>>(mpi_comm, application, is_test, true);
 
@@ -147,6 +157,7 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters                                    general(input_file);
   ExaDG::HypercubeResolutionParameters                        resolution(input_file, general.dim);
   ExaDG::ThroughputParameters<ExaDG::Structure::OperatorType> throughput(input_file);
+  ExaDG::ScalingStudyParameters                               scaling(input_file);
 
   auto const lambda_get_dofs_per_element =
     [&](unsigned int const dim, unsigned int const degree, ExaDG::ElementType const element_type) {
@@ -154,42 +165,45 @@ main(int argc, char ** argv)
         element_type, false /* is_dg */, dim /* n_components */, degree, dim);
     };
 
-  // fill resolution vector depending on the operator_type
-  resolution.fill_resolution_vector(lambda_get_dofs_per_element);
-
-  // loop over resolutions vector and run simulations
-  for(auto iter = resolution.resolutions.begin(); iter != resolution.resolutions.end(); ++iter)
-  {
-    unsigned int const degree       = std::get<0>(*iter);
-    unsigned int const refine_space = std::get<1>(*iter);
-    unsigned int const n_cells_1d   = std::get<2>(*iter);
-
-    if(general.dim == 2 and general.precision == "float")
-    {
-      ExaDG::run<2, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 2 and general.precision == "double")
-    {
-      ExaDG::run<2, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 3 and general.precision == "float")
-    {
-      ExaDG::run<3, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 3 and general.precision == "double")
-    {
-      ExaDG::run<3, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else
+  // loop over resolutions vector and run simulations, possibly for a series of communicators
+  auto const run_resolutions = [&](ExaDG::ResolutionsVector const & resolutions,
+                                   MPI_Comm const &                 sub_comm) {
+    for(auto iter = resolutions.begin(); iter != resolutions.end(); ++iter)
     {
-      AssertThrow(false,
-                  dealii::ExcMessage("Only dim = 2|3 and precision = float|double implemented."));
+      unsigned int const degree       = std::get<0>(*iter);
+      unsigned int const refine_space = std::get<1>(*iter);
+      unsigned int const n_cells_1d   = std::get<2>(*iter);
+
+      if(general.dim == 2 and general.precision == "float")
+      {
+        ExaDG::run<2, float>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else if(general.dim == 2 and general.precision == "double")
+      {
+        ExaDG::run<2, double>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else if(general.dim == 3 and general.precision == "float")
+      {
+        ExaDG::run<3, float>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else if(general.dim == 3 and general.precision == "double")
+      {
+        ExaDG::run<3, double>(
+          throughput, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+      }
+      else
+      {
+        AssertThrow(false,
+                    dealii::ExcMessage("Only dim = 2|3 and precision = float|double implemented."));
+      }
     }
-  }
+  };
+
+  ExaDG::run_scaling_study(
+    scaling, resolution, lambda_get_dofs_per_element, throughput, run_resolutions, mpi_comm);
 
   if(not(general.is_test))
     throughput.print_results(mpi_comm);
@@ -198,6 +212,9 @@ main(int argc, char ** argv)
   LIKWID_MARKER_CLOSE;
 #endif
 
+  if(not general.performance_report.empty())
+    ExaDG::PerformanceReport::get().write_json(general.performance_report, mpi_comm);
+
   return 0;
 }
 
@@ -158,7 +158,14 @@ DriverQuasiStatic<dim, Number>::do_solve()
     // step can be solved successfully
     bool         success        = false;
     unsigned int re_try_counter = 0;
-    while(not(success) and re_try_counter < 10)
+    auto const   retry_possible = [&]() {
+      if(param.adaptive_load_increment)
+        return load_increment >= param.load_increment_min *
+                                   (step_number == 0 ? reduction_load_factor_step_0 : 1.0);
+      else
+        return re_try_counter < 10;
+    };
+    while(not(success) and retry_possible())
     {
       try
       {
@@ -201,9 +208,30 @@ DriverQuasiStatic<dim, Number>::do_solve()
 
     // re-init increment for next load step
     if(step_number == 0)
+    {
       load_increment = param.load_increment - last_load_increment;
+    }
+    else if(param.adaptive_load_increment)
+    {
+      // enlarge the increment if the Newton solver converged fast, reduce it otherwise
+      double const factor =
+        std::min(2.0,
+                 std::max(0.5,
+                          static_cast<double>(param.load_increment_target_newton_iterations) /
+                            std::max(1u, std::get<0>(iter))));
+
+      load_increment = std::min(param.load_increment_max,
+                                std::max(param.load_increment_min, factor * last_load_increment));
+
+      if(not(is_test))
+        pcout << std::endl
+              << "  Adapt load increment to " << load_increment << "." << std::endl
+              << std::flush;
+    }
     else
+    {
       load_increment = param.load_increment;
+    }
 
     // make sure to hit maximum load exactly
     if(load_factor + load_increment >= 1.0)
@@ -52,7 +52,8 @@ TimeIntGenAlpha<dim, Number>::TimeIntGenAlpha(
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_) == 0),
     use_extrapolation(true),
     store_solution(false),
-    iterations({0, {0, 0}})
+    iterations({0, {0, 0}}),
+    newton_iterations_last_time_step(std::numeric_limits<unsigned int>::max())
 {
 }
 
@@ -115,6 +116,12 @@ template<int dim, typename Number>
 void
 TimeIntGenAlpha<dim, Number>::do_timestep_solve()
 {
+  if(param.explicit_time_integration)
+  {
+    do_timestep_explicit();
+    return;
+  }
+
   // compute right-hand side in case of linear problems or "constant vector"
   // in case of nonlinear problems
   dealii::Timer timer;
@@ -149,14 +156,19 @@ TimeIntGenAlpha<dim, Number>::do_timestep_solve()
 
   // initial guess
   if(use_extrapolation)
-    displacement_np = displacement_n;
+    compute_initial_guess(displacement_np);
   else
     displacement_np = displacement_last_iter;
 
-  bool const update_preconditioner =
+  bool update_preconditioner =
     this->param.update_preconditioner &&
     ((this->time_step_number - 1) % this->param.update_preconditioner_every_time_steps == 0);
 
+  // keep the preconditioner as long as the Newton solver converges quickly
+  if(param.freeze_preconditioner_newton_iterations > 0 and
+     newton_iterations_last_time_step <= param.freeze_preconditioner_newton_iterations)
+    update_preconditioner = false;
+
   if(param.large_deformation) // nonlinear case
   {
     auto const iter = pde_operator->solve_nonlinear(displacement_np,
@@ -170,6 +182,8 @@ TimeIntGenAlpha<dim, Number>::do_timestep_solve()
     std::get<0>(iterations.second) += std::get<0>(iter);
     std::get<1>(iterations.second) += std::get<1>(iter);
 
+    newton_iterations_last_time_step = std::get<0>(iter);
+
     if(this->print_solver_info() and not(this->is_test))
     {
       this->pcout << std::endl << "Solve nonlinear elasticity problem:";
@@ -212,6 +226,70 @@ TimeIntGenAlpha<dim, Number>::do_timestep_solve()
   this->timer_tree->insert({"Timeloop", "Update vectors"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+TimeIntGenAlpha<dim, Number>::do_timestep_explicit()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  double const time_step = this->get_time_step_size();
+
+  displacement_np = displacement_n;
+  displacement_np.add(time_step, velocity_n, 0.5 * time_step * time_step, acceleration_n);
+
+  velocity_np = velocity_n;
+  velocity_np.add(0.5 * time_step, acceleration_n);
+
+  pde_operator->compute_acceleration_explicit(acceleration_np,
+                                              displacement_np,
+                                              velocity_np,
+                                              this->get_next_time());
+
+  velocity_np.add(0.5 * time_step, acceleration_np);
+
+  if(this->store_solution)
+    displacement_last_iter = displacement_np;
+
+  iterations.first += 1;
+
+  if(this->print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl << "Explicit time step:";
+    print_wall_time(pcout, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Explicit time step"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntGenAlpha<dim, Number>::compute_initial_guess(VectorType & displacement) const
+{
+  // d_{n+1-alpha_f} = d_n + (1 - alpha_f) (d_{n+1} - d_n) with d_{n+1} according to the predictor
+  displacement = displacement_n;
+
+  // (1 - alpha_f) dt
+  double const factor = this->get_mid_time() - this->get_time();
+
+  if(param.predictor == Predictor::ConstantVelocity)
+  {
+    displacement.add(factor, velocity_n);
+  }
+  else if(param.predictor == Predictor::ConstantAcceleration)
+  {
+    displacement.add(factor,
+                     velocity_n,
+                     0.5 * factor * this->get_time_step_size(),
+                     acceleration_n);
+  }
+  else
+  {
+    AssertThrow(param.predictor == Predictor::PreviousSolution,
+                dealii::ExcMessage("Not implemented."));
+  }
+}
+
 template<int dim, typename Number>
 typename TimeIntGenAlpha<dim, Number>::VectorType const &
 TimeIntGenAlpha<dim, Number>::get_displacement_np()
@@ -254,6 +332,9 @@ template<int dim, typename Number>
 void
 TimeIntGenAlpha<dim, Number>::set_displacement(VectorType const & displacement)
 {
+  AssertThrow(not param.explicit_time_integration,
+              dealii::ExcMessage("Not implemented for explicit time integration."));
+
   displacement_np = displacement;
 
   // velocity_np, acceleration_np depend on displacement_np, so we need to
@@ -274,15 +355,15 @@ TimeIntGenAlpha<dim, Number>::prepare_vectors_for_next_timestep()
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_write_restart(std::string const & filename) const
+TimeIntGenAlpha<dim, Number>::do_write_restart(std::ostream & stream) const
 {
-  (void)filename;
+  (void)stream;
   AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
 }
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_read_restart(std::ifstream & in)
+TimeIntGenAlpha<dim, Number>::do_read_restart(std::istream & in)
 {
   (void)in;
   AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
@@ -309,6 +390,13 @@ TimeIntGenAlpha<dim, Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<int dim, typename Number>
+bool
+TimeIntGenAlpha<dim, Number>::print_memory_consumption() const
+{
+  return param.solver_info_data.print_memory_consumption;
+}
+
 template<int dim, typename Number>
 void
 TimeIntGenAlpha<dim, Number>::print_iterations() const
@@ -316,6 +404,10 @@ TimeIntGenAlpha<dim, Number>::print_iterations() const
   std::vector<std::string> names;
   std::vector<double>      iterations_avg;
 
+  // no systems of equations are solved in case of explicit time integration
+  if(param.explicit_time_integration)
+    return;
+
   if(param.large_deformation)
   {
     names = {"Nonlinear iterations",
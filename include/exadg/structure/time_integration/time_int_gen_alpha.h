@@ -103,14 +103,33 @@ private:
   void
   do_timestep_solve() final;
 
+  /*
+   * Explicit central difference scheme
+   *
+   *   d_{n+1} = d_n + dt v_n + dt^2/2 a_n,
+   *   M_L a_{n+1} = f(t_{n+1}) - F(d_{n+1}) - C v_{n+1/2},
+   *   v_{n+1} = v_n + dt/2 (a_n + a_{n+1}),
+   *
+   * with the lumped mass matrix M_L and the damping term being evaluated with the velocity
+   * v_{n+1/2} = v_n + dt/2 a_n at half time step.
+   */
+  void
+  do_timestep_explicit();
+
+  /*
+   * Initial guess of the unknown displacement d_{n+1-alpha_f} according to param.predictor.
+   */
+  void
+  compute_initial_guess(VectorType & displacement) const;
+
   void
   prepare_vectors_for_next_timestep() final;
 
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::ostream & stream) const final;
 
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::istream & in) final;
 
   void
   postprocessing() const final;
@@ -118,6 +137,9 @@ private:
   bool
   print_solver_info() const final;
 
+  bool
+  print_memory_consumption() const final;
+
   std::shared_ptr<Interface::Operator<Number>> pde_operator;
 
   std::shared_ptr<PostProcessorBase<Number>> postprocessor;
@@ -146,6 +168,10 @@ private:
     unsigned int /* number of calls */,
     std::tuple<unsigned long long, unsigned long long> /* iteration counts {Newton, linear}*/>
     iterations;
+
+  // number of Newton iterations of the last time step, used to decide whether the preconditioner
+  // is kept fixed
+  unsigned int newton_iterations_last_time_step;
 };
 
 } // namespace Structure
@@ -104,6 +104,18 @@ public:
     this->n_subdivisions_1d_hypercube = n_subdivisions_1d_hypercube;
   }
 
+  /*
+   * Selects whether the linearized operator of nonlinear problems uses stored linearization data
+   * in throughput studies.
+   */
+  void
+  set_store_linearization_data_throughput_study(bool const store_linearization_data)
+  {
+    this->param.store_linearization_data = store_linearization_data;
+    if(not store_linearization_data)
+      this->param.store_linearization_data_in_reduced_precision = false;
+  }
+
   void
   set_parameters_convergence_study(unsigned int const degree,
                                    unsigned int const refine_space,
@@ -56,7 +56,10 @@ enum class Type2D
 enum class MaterialType
 {
   Undefined,
-  StVenantKirchhoff
+  StVenantKirchhoff,
+  NeoHookean,
+  MooneyRivlin,
+  HolzapfelOgden
 };
 
 /**************************************************************************************/
@@ -75,7 +78,20 @@ enum class MaterialType
 /*                                                                                    */
 /**************************************************************************************/
 
-// there are currently no enums for this section
+/*
+ *  Initial guess of the displacement d_{n+1} for the solution of the system of equations in each
+ *  time step, computed from the kinematic quantities at time t_n:
+ *
+ *  PreviousSolution:     d_{n+1} = d_n
+ *  ConstantVelocity:     d_{n+1} = d_n + dt v_n
+ *  ConstantAcceleration: d_{n+1} = d_n + dt v_n + dt^2/2 a_n
+ */
+enum class Predictor
+{
+  PreviousSolution,
+  ConstantVelocity,
+  ConstantAcceleration
+};
 
 
 
@@ -113,6 +129,7 @@ enum class Preconditioner
   None,
   PointJacobi,
   AdditiveSchwarz,
+  FastDiagonalization,
   Multigrid,
   AMG
 };
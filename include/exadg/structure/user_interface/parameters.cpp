@@ -51,14 +51,20 @@ Parameters::Parameters()
     time_step_size(1.0),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     n_refine_time(0),
+    explicit_time_integration(false),
     gen_alpha_type(GenAlphaType::GenAlpha),
     spectral_radius(1.0),
+    predictor(Predictor::PreviousSolution),
     solver_info_data(SolverInfoData()),
     restarted_simulation(false),
     restart_data(RestartData()),
 
     // quasi-static solver
     load_increment(1.0),
+    adaptive_load_increment(false),
+    load_increment_target_newton_iterations(5),
+    load_increment_min(1.e-6),
+    load_increment_max(1.0),
 
     // SPATIAL DISCRETIZATION
     grid(GridData()),
@@ -68,6 +74,9 @@ Parameters::Parameters()
 
     // SOLVER
     newton_solver_data(Newton::SolverData(1e4, 1.e-12, 1.e-6)),
+    store_linearization_data(false),
+    store_linearization_data_in_reduced_precision(false),
+    store_load_data(false),
     solver(Solver::Undefined),
     solver_data(SolverData(1e4, 1.e-12, 1.e-6, 100)),
     preconditioner(Preconditioner::AMG),
@@ -75,6 +84,9 @@ Parameters::Parameters()
     update_preconditioner_every_time_steps(1),
     update_preconditioner_every_newton_iterations(10),
     update_preconditioner_once_newton_converged(false),
+    update_preconditioner_adaptively(false),
+    update_preconditioner_linear_iterations_factor(1.5),
+    freeze_preconditioner_newton_iterations(0),
     multigrid_data(MultigridData())
 {
 }
@@ -99,6 +111,15 @@ Parameters::check() const
                 dealii::ExcMessage("Restart has not been implemented."));
   }
 
+  if(explicit_time_integration)
+  {
+    AssertThrow(problem_type == ProblemType::Unsteady,
+                dealii::ExcMessage("Explicit time integration requires ProblemType::Unsteady."));
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("The lumped mass matrix of the explicit time integration "
+                                   "requires hypercube elements."));
+  }
+
   if(weak_damping_active)
   {
     AssertThrow(problem_type == ProblemType::Unsteady,
@@ -107,6 +128,18 @@ Parameters::check() const
                 dealii::ExcMessage("Weak damping coefficient defined positive."));
   }
 
+  if(adaptive_load_increment)
+  {
+    AssertThrow(problem_type == ProblemType::QuasiStatic,
+                dealii::ExcMessage("Adaptive load increments require ProblemType::QuasiStatic."));
+    AssertThrow(load_increment_target_newton_iterations > 0,
+                dealii::ExcMessage("The target number of Newton iterations has to be positive."));
+    AssertThrow(load_increment_min > 0.0 and load_increment_min <= load_increment and
+                  load_increment <= load_increment_max,
+                dealii::ExcMessage("Load increments have to satisfy 0 < load_increment_min <= "
+                                   "load_increment <= load_increment_max."));
+  }
+
   // SPATIAL DISCRETIZATION
   grid.check();
 
@@ -114,6 +147,51 @@ Parameters::check() const
 
   // SOLVER
   AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("Parameter must be defined."));
+
+  if(store_linearization_data)
+  {
+    AssertThrow(large_deformation == true,
+                dealii::ExcMessage("Linearization data can only be stored for nonlinear "
+                                   "problems."));
+  }
+
+  if(store_linearization_data_in_reduced_precision)
+  {
+    AssertThrow(store_linearization_data == true,
+                dealii::ExcMessage("Storing linearization data in reduced precision requires "
+                                   "store_linearization_data = true."));
+  }
+
+  if(store_load_data)
+  {
+    AssertThrow(large_deformation == true,
+                dealii::ExcMessage("Load data can only be stored for nonlinear problems."));
+  }
+
+  if(newton_solver_data.reduced_precision_line_search)
+  {
+    AssertThrow(large_deformation == true,
+                dealii::ExcMessage("A line search in reduced precision requires a nonlinear "
+                                   "problem."));
+  }
+
+  if(update_preconditioner_adaptively)
+  {
+    AssertThrow(large_deformation == true,
+                dealii::ExcMessage("Adaptive preconditioner updates require a nonlinear problem."));
+    AssertThrow(update_preconditioner_linear_iterations_factor >= 1.0,
+                dealii::ExcMessage("The factor of linear iterations has to be at least 1."));
+  }
+
+  if(freeze_preconditioner_newton_iterations > 0)
+  {
+    AssertThrow(problem_type == ProblemType::Unsteady and large_deformation == true,
+                dealii::ExcMessage("Freezing the preconditioner over time steps requires an "
+                                   "unsteady, nonlinear problem."));
+    AssertThrow(not update_preconditioner_adaptively,
+                dealii::ExcMessage("Freezing the preconditioner over time steps can not be "
+                                   "combined with adaptive preconditioner updates."));
+  }
 }
 
 bool
@@ -188,6 +266,16 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
   if(problem_type == ProblemType::QuasiStatic)
   {
     print_parameter(pcout, "load_increment", load_increment);
+    print_parameter(pcout, "Adaptive load increment", adaptive_load_increment);
+
+    if(adaptive_load_increment)
+    {
+      print_parameter(pcout,
+                      "Target number of Newton iterations",
+                      load_increment_target_newton_iterations);
+      print_parameter(pcout, "Minimum load increment", load_increment_min);
+      print_parameter(pcout, "Maximum load increment", load_increment_max);
+    }
   }
 
   if(problem_type == ProblemType::Unsteady)
@@ -196,8 +284,13 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "End time", end_time);
     print_parameter(pcout, "Max. number of time steps", max_number_of_time_steps);
     print_parameter(pcout, "Temporal refinements", n_refine_time);
-    print_parameter(pcout, "Time integration type", gen_alpha_type);
-    print_parameter(pcout, "Spectral radius", spectral_radius);
+    print_parameter(pcout, "Explicit time integration", explicit_time_integration);
+    if(not explicit_time_integration)
+    {
+      print_parameter(pcout, "Time integration type", gen_alpha_type);
+      print_parameter(pcout, "Spectral radius", spectral_radius);
+      print_parameter(pcout, "Predictor", predictor);
+    }
     solver_info_data.print(pcout);
     if(restarted_simulation)
       restart_data.print(pcout);
@@ -229,6 +322,12 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
   {
     pcout << std::endl << "Newton:" << std::endl;
     newton_solver_data.print(pcout);
+    print_parameter(pcout, "Store linearization data", store_linearization_data);
+    if(store_linearization_data)
+      print_parameter(pcout,
+                      "Reduced precision linearization data",
+                      store_linearization_data_in_reduced_precision);
+    print_parameter(pcout, "Store load data", store_load_data);
   }
 
   // linear solver
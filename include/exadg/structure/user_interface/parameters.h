@@ -147,11 +147,20 @@ public:
   // number of refinements for temporal discretization
   unsigned int n_refine_time;
 
+  // Explicit central difference scheme with a lumped mass matrix obtained by Gauss-Lobatto
+  // quadrature, i.e., each time step requires one evaluation of the elasticity operator and no
+  // solution of systems of equations. The time step size has to satisfy the CFL condition of the
+  // elastic waves. The parameters of the generalized-alpha method below are not used in this case.
+  bool explicit_time_integration;
+
   GenAlphaType gen_alpha_type;
 
   // spectral radius rho_infty for generalized alpha time integration scheme
   double spectral_radius;
 
+  // description: see enum declaration
+  Predictor predictor;
+
   // configure printing of solver performance (wall time, number of iterations)
   SolverInfoData solver_info_data;
 
@@ -166,6 +175,16 @@ public:
   // choose a value in [0,1] where 1 = maximum load (Neumann or Dirichlet)
   double load_increment;
 
+  // Adapt the load increment to the convergence of the Newton solver: the increment is enlarged
+  // if the Newton solver converges in less than load_increment_target_newton_iterations
+  // iterations and reduced otherwise, where load_increment is the initial increment. If the
+  // Newton solver does not converge, the step is repeated with half the increment until the
+  // increment falls below load_increment_min.
+  bool         adaptive_load_increment;
+  unsigned int load_increment_target_newton_iterations;
+  double       load_increment_min;
+  double       load_increment_max;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                              SPATIAL DISCRETIZATION                                */
@@ -193,6 +212,23 @@ public:
   // Newton solver data (only relevant for nonlinear problems)
   Newton::SolverData newton_solver_data;
 
+  // Nonlinear problems: store the deformation gradient and the 2nd Piola-Kirchhoff stress at the
+  // linearization point in all quadrature points whenever the linearization point is updated,
+  // i.e., once per Newton iteration, instead of recomputing them in every application of the
+  // linearized operator by the linear solver. This requires 2 dim^2 additional numbers per
+  // quadrature point (the memory consumption is printed during setup), but makes the application
+  // of the linearized operator cheaper, which pays off if the linear solver dominates.
+  bool store_linearization_data;
+
+  // store the above linearization data in single precision
+  bool store_linearization_data_in_reduced_precision;
+
+  // Nonlinear problems: evaluate the body force and the tractions of Neumann boundaries once per
+  // time (load factor) and store them in all quadrature points instead of evaluating the
+  // functions in every evaluation of the nonlinear residual. NeumannCached boundaries are not
+  // affected since their data may change without a change of time.
+  bool store_load_data;
+
   // description: see enum declaration
   Solver solver;
 
@@ -217,6 +253,15 @@ public:
   // - or once the Newton solver converged successfully (this option is currently used
   // in order to avoid invalid deformation states in non-converged Newton iterations)
   bool update_preconditioner_once_newton_converged;
+  // - or adaptively, replacing the above schedules: the preconditioner is updated whenever the
+  // number of linear iterations exceeds the number of linear iterations directly after the last
+  // update by the factor update_preconditioner_linear_iterations_factor
+  bool   update_preconditioner_adaptively;
+  double update_preconditioner_linear_iterations_factor;
+  // Unsteady nonlinear problems: keep the preconditioner of the previous time step, i.e., skip a
+  // scheduled update of the preconditioner, if the Newton solver of the previous time step
+  // converged within the given number of iterations (0: never skip updates)
+  unsigned int freeze_preconditioner_newton_iterations;
 
   // description: see declaration of MultigridData
   MultigridData multigrid_data;
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_CONVECTION_DIFFUSION_EXPLICIT_RUNGE_KUTTA_H_
 #define INCLUDE_CONVECTION_DIFFUSION_EXPLICIT_RUNGE_KUTTA_H_
 
+// C/C++
+#include <functional>
+#include <vector>
+
 namespace ExaDG
 {
 template<typename Operator, typename VectorType>
@@ -42,8 +46,51 @@ public:
   virtual unsigned int
   get_order() const = 0;
 
+  /*
+   * Schemes with an embedded scheme of lower order provide an estimate of the local error of a
+   * time step, given by the difference between the solutions of the main and the embedded scheme.
+   */
+  virtual bool
+  has_embedded_scheme() const
+  {
+    return false;
+  }
+
+  virtual unsigned int
+  get_order_embedded_scheme() const
+  {
+    AssertThrow(false, dealii::ExcMessage("This time integrator has no embedded scheme."));
+
+    return 0;
+  }
+
+  /*
+   * Once enabled, solve_timestep() additionally computes the error estimate of the embedded
+   * scheme, which requires one additional register.
+   */
+  void
+  enable_error_estimate()
+  {
+    AssertThrow(has_embedded_scheme(),
+                dealii::ExcMessage("This time integrator has no embedded scheme."));
+
+    estimate_error = true;
+  }
+
+  VectorType const &
+  get_error_estimate() const
+  {
+    AssertThrow(estimate_error, dealii::ExcMessage("The error estimate has not been enabled."));
+
+    return error_estimate;
+  }
+
 protected:
   std::shared_ptr<Operator> underlying_operator;
+
+  bool estimate_error = false;
+
+  VectorType error_estimate;
 };
 
 /*
@@ -225,10 +272,26 @@ private:
  *                                                                                      *
  ****************************************************************************************/
 
+/*
+ *  Coefficients of a low-storage Runge-Kutta method with 2 registers of type 2R+, i.e., the
+ *  entries a_{i+1,i} of the Butcher table are stored in a, all other entries below the diagonal
+ *  are given by the weights b_j. The weights of the embedded scheme are stored in b_embedded.
+ */
+struct LowStorageRKReg2Coefficients
+{
+  unsigned int order;
+  unsigned int order_embedded;
+
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> b_embedded;
+};
+
 /*
  *  Low storage Runge-Kutta method of order 3 with 4 stages and 2 registers according to
  *  Kennedy et al. (2000), where this method is denoted as RK3(2)4[2R+]C,
- *  see Table 1 on page 189 for the coefficients.
+ *  see Table 1 on page 189 for the coefficients. The embedded scheme of order 2 is used to
+ *  estimate the local error for adaptive time stepping.
  */
 template<typename Operator, typename VectorType>
 class LowStorageRK3Stage4Reg2C : public ExplicitTimeIntegrator<Operator, VectorType>
@@ -239,6 +302,31 @@ public:
   {
   }
 
+  static LowStorageRKReg2Coefficients
+  get_coefficients()
+  {
+    LowStorageRKReg2Coefficients coefficients;
+
+    coefficients.order          = 3;
+    coefficients.order_embedded = 2;
+
+    coefficients.a = {11847461282814. / 36547543011857.,
+                      3943225443063. / 7078155732230.,
+                      -346793006927. / 4029903576067.};
+
+    coefficients.b = {1017324711453. / 9774461848756.,
+                      8237718856693. / 13685301971492.,
+                      57731312506979. / 19404895981398.,
+                      -101169746363290. / 37734290219643.};
+
+    coefficients.b_embedded = {15763415370699. / 46270243929542.,
+                               514528521746. / 5659431552419.,
+                               27030193851939. / 9429696342944.,
+                               -69544964788955. / 30262026368149.};
+
+    return coefficients;
+  }
+
   void
   solve_timestep(VectorType & vec_np,
                  VectorType & vec_n,
@@ -262,41 +350,63 @@ public:
      *
      */
 
-    double const a21 = 11847461282814. / 36547543011857.;
-    double const a32 = 3943225443063. / 7078155732230.;
-    double const a43 = -346793006927. / 4029903576067.;
+    LowStorageRKReg2Coefficients const coefficients = get_coefficients();
+
+    double const a21 = coefficients.a[0];
+    double const a32 = coefficients.a[1];
+    double const a43 = coefficients.a[2];
+
+    double const b1 = coefficients.b[0];
+    double const b2 = coefficients.b[1];
+    double const b3 = coefficients.b[2];
+    double const b4 = coefficients.b[3];
 
-    double const b1 = 1017324711453. / 9774461848756.;
-    double const b2 = 8237718856693. / 13685301971492.;
-    double const b3 = 57731312506979. / 19404895981398.;
-    double const b4 = -101169746363290. / 37734290219643.;
+    // weights of the embedded scheme of order 2
+    double const bh1 = coefficients.b_embedded[0];
+    double const bh2 = coefficients.b_embedded[1];
+    double const bh3 = coefficients.b_embedded[2];
+    double const bh4 = coefficients.b_embedded[3];
 
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = b1 + a32;
     double const c4 = b1 + b2 + a43;
 
+    if(this->estimate_error and
+       not this->error_estimate.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      this->error_estimate.reinit(vec_np);
+    }
+
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.equ((b1 - bh1) * time_step, vec_tmp1);
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.add((b2 - bh2) * time_step, vec_tmp1);
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.add((b3 - bh3) * time_step, vec_tmp1);
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_3 */, time + c4 * time_step);
     vec_np.add(b4 * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.add((b4 - bh4) * time_step, vec_tmp1);
   }
 
   unsigned int
@@ -305,6 +415,18 @@ public:
     return 3;
   }
 
+  bool
+  has_embedded_scheme() const final
+  {
+    return true;
+  }
+
+  unsigned int
+  get_order_embedded_scheme() const final
+  {
+    return 2;
+  }
+
 private:
   VectorType vec_tmp1;
 };
@@ -313,7 +435,8 @@ private:
 /*
  *  Low storage Runge-Kutta method of order 4 with 5 stages and 2 registers according to
  *  Kennedy et al. (2000), where this method is denoted as RK4(3)5[2R+]C,
- *  see Table 1 on page 189 for the coefficients.
+ *  see Table 1 on page 189 for the coefficients. The embedded scheme of order 3 is used to
+ *  estimate the local error for adaptive time stepping.
  */
 template<typename Operator, typename VectorType>
 class LowStorageRK4Stage5Reg2C : public ExplicitTimeIntegrator<Operator, VectorType>
@@ -324,6 +447,34 @@ public:
   {
   }
 
+  static LowStorageRKReg2Coefficients
+  get_coefficients()
+  {
+    LowStorageRKReg2Coefficients coefficients;
+
+    coefficients.order          = 4;
+    coefficients.order_embedded = 3;
+
+    coefficients.a = {970286171893. / 4311952581923.,
+                      6584761158862. / 12103376702013.,
+                      2251764453980. / 15575788980749.,
+                      26877169314380. / 34165994151039.};
+
+    coefficients.b = {1153189308089. / 22510343858157.,
+                      1772645290293. / 4653164025191.,
+                      -1672844663538. / 4480602732383.,
+                      2114624349019. / 3568978502595.,
+                      5198255086312. / 14908931495163.};
+
+    coefficients.b_embedded = {1016888040809. / 7410784769900.,
+                               11231460423587. / 58533540763752.,
+                               -1563879915014. / 6823010717585.,
+                               606302364029. / 971179775848.,
+                               1097981568119. / 3980877426909.};
+
+    return coefficients;
+  }
+
   void
   solve_timestep(VectorType & vec_np,
                  VectorType & vec_n,
@@ -348,16 +499,25 @@ public:
      *
      */
 
-    double const a21 = 970286171893. / 4311952581923.;
-    double const a32 = 6584761158862. / 12103376702013.;
-    double const a43 = 2251764453980. / 15575788980749.;
-    double const a54 = 26877169314380. / 34165994151039.;
+    LowStorageRKReg2Coefficients const coefficients = get_coefficients();
+
+    double const a21 = coefficients.a[0];
+    double const a32 = coefficients.a[1];
+    double const a43 = coefficients.a[2];
+    double const a54 = coefficients.a[3];
+
+    double const b1 = coefficients.b[0];
+    double const b2 = coefficients.b[1];
+    double const b3 = coefficients.b[2];
+    double const b4 = coefficients.b[3];
+    double const b5 = coefficients.b[4];
 
-    double const b1 = 1153189308089. / 22510343858157.;
-    double const b2 = 1772645290293. / 4653164025191.;
-    double const b3 = -1672844663538. / 4480602732383.;
-    double const b4 = 2114624349019. / 3568978502595.;
-    double const b5 = 5198255086312. / 14908931495163.;
+    // weights of the embedded scheme of order 3
+    double const bh1 = coefficients.b_embedded[0];
+    double const bh2 = coefficients.b_embedded[1];
+    double const bh3 = coefficients.b_embedded[2];
+    double const bh4 = coefficients.b_embedded[3];
+    double const bh5 = coefficients.b_embedded[4];
 
     double const c1 = 0.;
     double const c2 = a21;
@@ -365,34 +525,62 @@ public:
     double const c4 = b1 + b2 + a43;
     double const c5 = b1 + b2 + b3 + a54;
 
+    if(this->estimate_error and
+       not this->error_estimate.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      this->error_estimate.reinit(vec_np);
+    }
+
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.equ((b1 - bh1) * time_step, vec_tmp1);
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.add((b2 - bh2) * time_step, vec_tmp1);
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.add((b3 - bh3) * time_step, vec_tmp1);
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_3 */, time + c4 * time_step);
     vec_np.add(a54 * time_step, vec_tmp1); /* = u_5 */
     vec_n = vec_np;
     vec_n.add((b4 - a54) * time_step, vec_tmp1); /* = u_p */
+    if(this->estimate_error)
+      this->error_estimate.add((b4 - bh4) * time_step, vec_tmp1);
 
     // stage 5
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_4 */, time + c5 * time_step);
     vec_np = vec_n;
     vec_np.add(b5 * time_step, vec_tmp1);
+    if(this->estimate_error)
+      this->error_estimate.add((b5 - bh5) * time_step, vec_tmp1);
+  }
+
+  bool
+  has_embedded_scheme() const final
+  {
+    return true;
+  }
+
+  unsigned int
+  get_order_embedded_scheme() const final
+  {
+    return 3;
   }
 
   unsigned int
@@ -405,6 +593,125 @@ private:
   VectorType vec_tmp1;
 };
 
+/*
+ *  Low-storage Runge-Kutta methods with 2 registers of type 2R+, see LowStorageRK3Stage4Reg2C and
+ *  LowStorageRK4Stage5Reg2C, where the vector updates of each stage are fused with the operator
+ *  evaluation. The operator performs the updates on ranges of DoFs right after its result has been
+ *  computed for these DoFs, e.g., within the cell loop applying the inverse mass, such that the
+ *  registers are updated while the result resides in cache. This reduces the number of passes
+ *  through memory per stage compared to the separate vector updates of the schemes above.
+ *
+ *  The operator needs to provide the function
+ *
+ *    evaluate_and_update(dst, src, time, operation_after_loop),
+ *
+ *  which calls operation_after_loop(start_range, end_range) for all ranges of locally owned DoFs
+ *  of dst after dst has been computed for these DoFs and src is no longer accessed. dst and src
+ *  may be the same vector.
+ */
+template<typename Operator, typename VectorType>
+class LowStorageRKReg2Fused : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+  using Number = typename VectorType::value_type;
+
+public:
+  LowStorageRKReg2Fused(std::shared_ptr<Operator> const      operator_in,
+                        LowStorageRKReg2Coefficients const & coefficients_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), coefficients(coefficients_in)
+  {
+    AssertThrow(coefficients.b.size() == coefficients.a.size() + 1 and
+                  coefficients.b_embedded.size() == coefficients.b.size(),
+                dealii::ExcMessage("Invalid coefficients of low-storage Runge-Kutta method."));
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    if(not vec_tmp1.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      vec_tmp1.reinit(vec_np);
+    }
+
+    if(this->estimate_error and
+       not this->error_estimate.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      this->error_estimate.reinit(vec_np);
+    }
+
+    // vec_np is used as the register accumulating the solution u_p, and vec_tmp1 holds the
+    // solution of the stages. vec_n is only read in the first stage.
+    unsigned int const n_stages = coefficients.b.size();
+
+    double c     = 0.0;
+    double sum_b = 0.0;
+    for(unsigned int stage = 0; stage < n_stages; ++stage)
+    {
+      Number const factor_solution = coefficients.b[stage] * time_step;
+      Number const factor_stage =
+        stage + 1 < n_stages ? coefficients.a[stage] * time_step : Number(0.0);
+      Number const factor_error =
+        (coefficients.b[stage] - coefficients.b_embedded[stage]) * time_step;
+
+      bool const update_stage   = stage + 1 < n_stages;
+      bool const estimate_error = this->estimate_error;
+      bool const first_stage    = stage == 0;
+
+      this->underlying_operator->evaluate_and_update(
+        vec_tmp1,
+        first_stage ? vec_n : vec_tmp1,
+        time + c * time_step,
+        [&](unsigned int const start_range, unsigned int const end_range) {
+          VectorType const & vec_p = first_stage ? vec_n : vec_np;
+          for(unsigned int i = start_range; i < end_range; ++i)
+          {
+            Number const k_i      = vec_tmp1.local_element(i);
+            Number const solution = vec_p.local_element(i);
+
+            vec_np.local_element(i) = solution + factor_solution * k_i;
+
+            if(update_stage)
+              vec_tmp1.local_element(i) = solution + factor_stage * k_i;
+
+            if(estimate_error)
+              this->error_estimate.local_element(i) =
+                (first_stage ? Number(0.0) : this->error_estimate.local_element(i)) +
+                factor_error * k_i;
+          }
+        });
+
+      if(update_stage)
+        c = sum_b + coefficients.a[stage];
+      sum_b += coefficients.b[stage];
+    }
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return coefficients.order;
+  }
+
+  bool
+  has_embedded_scheme() const final
+  {
+    return true;
+  }
+
+  unsigned int
+  get_order_embedded_scheme() const final
+  {
+    return coefficients.order_embedded;
+  }
+
+private:
+  LowStorageRKReg2Coefficients const coefficients;
+
+  VectorType vec_tmp1;
+};
+
 /*
  *  Low storage Runge-Kutta method of order 4 with 5 stages and 3 registers according to
  *  Kennedy et al. (2000), where this method is denoted as RK4(3)5[3R+]C,
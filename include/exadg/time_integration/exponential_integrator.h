@@ -0,0 +1,329 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_EXPONENTIAL_INTEGRATOR_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_EXPONENTIAL_INTEGRATOR_H_
+
+// C/C++
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/identity_matrix.h>
+
+namespace ExaDG
+{
+/**
+ * Exponential integrator for linear problems du/dt = A u + b(t), where the operator provides the
+ * affine right-hand side evaluate(dst, src, time) = A src + b(time) with a time-independent linear
+ * part A. One time step reads
+ *
+ *   u_{n+1} = u_n + dt phi_1(dt A) F(u_n, t_n) + dt phi_2(dt A) (F(u_n, t_{n+1}) - F(u_n, t_n)),
+ *
+ * which is exact for source terms b(t) that are linear in time over the time step, i.e., the
+ * method is of second order and the time step size is not limited by the CFL condition. The
+ * phi-functions are computed in a single Krylov subspace of the augmented matrix
+ *
+ *   [A W]
+ *   [0 J],  W = [w_2, w_1], J = [0 1; 0 0],
+ *
+ * whose exponential applied to the vector (0, 0, 1) gives dt phi_1(dt A) w_1 + dt^2 phi_2(dt A) w_2
+ * in the first block (Al-Mohy, Higham (2011), "Computing the action of the matrix exponential").
+ * The exponential of the small Hessenberg matrix of the Arnoldi process is computed by scaling
+ * and squaring. If the a-posteriori error estimate of the Krylov approximation exceeds the
+ * tolerance, the time step is split into sub-steps that reuse the exponential of the augmented
+ * matrix, each with a new Krylov subspace (Sidje (1998), "Expokit").
+ *
+ * The operator needs to provide the functions
+ *
+ *   initialize_dof_vector(dst),
+ *   evaluate(dst, src, time).
+ */
+template<typename Operator, typename VectorType>
+class ExponentialIntegrator
+{
+  using Number = typename VectorType::value_type;
+
+  // coefficients of the vector in the augmented space, which has two additional dimensions
+  typedef std::array<double, 2> AugmentationType;
+
+public:
+  ExponentialIntegrator(std::shared_ptr<Operator const> pde_operator_in,
+                        unsigned int const              krylov_dimension_in,
+                        double const                    tolerance_in)
+    : pde_operator(pde_operator_in),
+      krylov_dimension(krylov_dimension_in),
+      tolerance(tolerance_in),
+      n_evaluations(0)
+  {
+    AssertThrow(krylov_dimension >= 2,
+                dealii::ExcMessage("Krylov dimension of the exponential integrator has to be at "
+                                   "least 2."));
+    AssertThrow(tolerance > 0.0,
+                dealii::ExcMessage("Tolerance of the exponential integrator has to be positive."));
+  }
+
+  void
+  initialize()
+  {
+    basis.resize(krylov_dimension + 1);
+    for(auto & vector : basis)
+      pde_operator->initialize_dof_vector(vector);
+    basis_augmentation.resize(krylov_dimension + 1);
+
+    pde_operator->initialize_dof_vector(zero);
+    pde_operator->initialize_dof_vector(source_n);
+    pde_operator->initialize_dof_vector(w_1);
+    pde_operator->initialize_dof_vector(w_2);
+    pde_operator->initialize_dof_vector(increment);
+  }
+
+  /*
+   * Advances the solution from time to time + time_step.
+   */
+  void
+  solve_timestep(VectorType & solution, double const time, double const time_step)
+  {
+    n_evaluations = 0;
+
+    // b(t_n), needed to apply the linear part A
+    zero = 0.0;
+    evaluate(source_n, zero, time);
+
+    // w_1 = F(u_n, t_n), w_2 = (F(u_n, t_{n+1}) - F(u_n, t_n)) / dt
+    evaluate(w_1, solution, time);
+    evaluate(w_2, solution, time + time_step);
+    w_2.sadd(1.0 / time_step, -1.0 / time_step, w_1);
+
+    // exp(dt * augmented matrix) applied to (0, 0, 1)
+    increment                               = 0.0;
+    AugmentationType increment_augmentation = {{0.0, 1.0}};
+
+    double remaining_time = time_step;
+    double sub_time_step  = time_step;
+    while(remaining_time > 1.e-12 * time_step)
+    {
+      sub_time_step = std::min(sub_time_step, remaining_time);
+
+      unsigned int const dimension = arnoldi(increment, increment_augmentation, time);
+
+      // reduce the sub-step size until the error estimate is below the tolerance
+      dealii::FullMatrix<double> exponential;
+      while(true)
+      {
+        exponential = compute_exponential(sub_time_step, dimension);
+
+        double const error_estimate =
+          dimension < krylov_dimension ?
+            0.0 :
+            beta * hessenberg(dimension, dimension - 1) * sub_time_step *
+              std::abs(exponential(dimension - 1, 0));
+
+        if(error_estimate <= tolerance * beta)
+          break;
+
+        sub_time_step *= 0.5;
+      }
+
+      // increment = beta V exp(tau H) e_1
+      increment              = 0.0;
+      increment_augmentation = {{0.0, 0.0}};
+      for(unsigned int j = 0; j < dimension; ++j)
+      {
+        double const factor = beta * exponential(j, 0);
+        increment.add(static_cast<Number>(factor), basis[j]);
+        increment_augmentation[0] += factor * basis_augmentation[j][0];
+        increment_augmentation[1] += factor * basis_augmentation[j][1];
+      }
+
+      remaining_time -= sub_time_step;
+
+      // try a larger sub-step for the remaining time
+      sub_time_step *= 2.0;
+    }
+
+    solution += increment;
+  }
+
+  /*
+   * Number of operator evaluations of the last time step.
+   */
+  unsigned int
+  get_n_evaluations() const
+  {
+    return n_evaluations;
+  }
+
+private:
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const time) const
+  {
+    pde_operator->evaluate(dst, src, time);
+    ++n_evaluations;
+  }
+
+  /*
+   * Applies the augmented matrix to the vector (src, src_augmentation).
+   */
+  void
+  apply_augmented(VectorType &             dst,
+                  AugmentationType &       dst_augmentation,
+                  VectorType const &       src,
+                  AugmentationType const & src_augmentation,
+                  double const             time) const
+  {
+    // A src = F(src, t_n) - b(t_n)
+    evaluate(dst, src, time);
+    dst -= source_n;
+
+    dst.add(static_cast<Number>(src_augmentation[0]),
+            w_2,
+            static_cast<Number>(src_augmentation[1]),
+            w_1);
+
+    dst_augmentation = {{src_augmentation[1], 0.0}};
+  }
+
+  double
+  inner_product(VectorType const &       vector_1,
+                AugmentationType const & augmentation_1,
+                VectorType const &       vector_2,
+                AugmentationType const & augmentation_2) const
+  {
+    return static_cast<double>(vector_1 * vector_2) + augmentation_1[0] * augmentation_2[0] +
+           augmentation_1[1] * augmentation_2[1];
+  }
+
+  /*
+   * Arnoldi process with modified Gram-Schmidt orthogonalization for the augmented matrix starting
+   * from (src, src_augmentation). Returns the dimension of the Krylov subspace, which is smaller
+   * than krylov_dimension in case of a breakdown (invariant subspace).
+   */
+  unsigned int
+  arnoldi(VectorType const & src, AugmentationType const & src_augmentation, double const time)
+  {
+    hessenberg.reinit(krylov_dimension + 1, krylov_dimension);
+
+    beta = std::sqrt(inner_product(src, src_augmentation, src, src_augmentation));
+
+    basis[0].equ(static_cast<Number>(1.0 / beta), src);
+    basis_augmentation[0] = {{src_augmentation[0] / beta, src_augmentation[1] / beta}};
+
+    for(unsigned int j = 0; j < krylov_dimension; ++j)
+    {
+      apply_augmented(
+        basis[j + 1], basis_augmentation[j + 1], basis[j], basis_augmentation[j], time);
+
+      for(unsigned int i = 0; i <= j; ++i)
+      {
+        hessenberg(i, j) = inner_product(basis[i],
+                                         basis_augmentation[i],
+                                         basis[j + 1],
+                                         basis_augmentation[j + 1]);
+        basis[j + 1].add(static_cast<Number>(-hessenberg(i, j)), basis[i]);
+        basis_augmentation[j + 1][0] -= hessenberg(i, j) * basis_augmentation[i][0];
+        basis_augmentation[j + 1][1] -= hessenberg(i, j) * basis_augmentation[i][1];
+      }
+
+      hessenberg(j + 1, j) = std::sqrt(inner_product(basis[j + 1],
+                                                     basis_augmentation[j + 1],
+                                                     basis[j + 1],
+                                                     basis_augmentation[j + 1]));
+
+      if(hessenberg(j + 1, j) < 1.e-12 * beta)
+        return j + 1;
+
+      basis[j + 1] *= static_cast<Number>(1.0 / hessenberg(j + 1, j));
+      basis_augmentation[j + 1][0] /= hessenberg(j + 1, j);
+      basis_augmentation[j + 1][1] /= hessenberg(j + 1, j);
+    }
+
+    return krylov_dimension;
+  }
+
+  /*
+   * Exponential of tau times the leading dimension x dimension block of the Hessenberg matrix by
+   * scaling and squaring with a truncated Taylor series.
+   */
+  dealii::FullMatrix<double>
+  compute_exponential(double const tau, unsigned int const dimension) const
+  {
+    dealii::FullMatrix<double> matrix(dimension, dimension);
+    for(unsigned int i = 0; i < dimension; ++i)
+      for(unsigned int j = 0; j < dimension; ++j)
+        matrix(i, j) = tau * hessenberg(i, j);
+
+    // scale such that the norm is at most 1/2
+    double const norm = matrix.linfty_norm();
+    unsigned int n_squarings =
+      norm > 0.5 ? static_cast<unsigned int>(std::ceil(std::log2(norm / 0.5))) : 0;
+    matrix *= std::pow(0.5, n_squarings);
+
+    // Taylor series, the truncation error is below 0.5^17/17! for the scaled matrix
+    dealii::FullMatrix<double> exponential(dealii::IdentityMatrix(dimension));
+    dealii::FullMatrix<double> term(dealii::IdentityMatrix(dimension)), tmp(dimension, dimension);
+    for(unsigned int k = 1; k <= 16; ++k)
+    {
+      term.mmult(tmp, matrix);
+      term.equ(1.0 / k, tmp);
+      exponential.add(1.0, term);
+    }
+
+    for(unsigned int s = 0; s < n_squarings; ++s)
+    {
+      exponential.mmult(tmp, exponential);
+      exponential = tmp;
+    }
+
+    return exponential;
+  }
+
+  std::shared_ptr<Operator const> pde_operator;
+
+  unsigned int const krylov_dimension;
+
+  double const tolerance;
+
+  mutable unsigned int n_evaluations;
+
+  // orthonormal basis of the Krylov subspace of the augmented matrix
+  std::vector<VectorType>       basis;
+  std::vector<AugmentationType> basis_augmentation;
+
+  dealii::FullMatrix<double> hessenberg;
+
+  // norm of the start vector of the Arnoldi process
+  double beta;
+
+  VectorType zero;
+  VectorType source_n;
+  VectorType w_1;
+  VectorType w_2;
+  VectorType increment;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_EXPONENTIAL_INTEGRATOR_H_ */
@@ -0,0 +1,140 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cmath>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/time_integration/imex_runge_kutta_constants.h>
+
+namespace ExaDG
+{
+IMEXRungeKuttaConstants::IMEXRungeKuttaConstants(unsigned int const order) : order(order)
+{
+  AssertThrow(order >= 1 and order <= 3,
+              dealii::ExcMessage("Specified order of IMEX Runge-Kutta scheme not implemented."));
+
+  switch(order)
+  {
+    case 1:
+    {
+      // forward-backward Euler
+      name       = "ARS(1,1,1)";
+      a_explicit = {{0.0, 0.0}, {1.0, 0.0}};
+      a_implicit = {{0.0, 0.0}, {0.0, 1.0}};
+      c          = {0.0, 1.0};
+      break;
+    }
+    case 2:
+    {
+      double const gamma = 1.0 - 0.5 * std::sqrt(2.0);
+      double const delta = 1.0 - 0.5 / gamma;
+
+      name       = "ARS(2,2,2)";
+      a_explicit = {{0.0, 0.0, 0.0}, {gamma, 0.0, 0.0}, {delta, 1.0 - delta, 0.0}};
+      a_implicit = {{0.0, 0.0, 0.0}, {0.0, gamma, 0.0}, {0.0, 1.0 - gamma, gamma}};
+      c          = {0.0, gamma, 1.0};
+      break;
+    }
+    case 3:
+    {
+      name       = "ARS(4,4,3)";
+      a_explicit = {{0.0, 0.0, 0.0, 0.0, 0.0},
+                    {1.0 / 2.0, 0.0, 0.0, 0.0, 0.0},
+                    {11.0 / 18.0, 1.0 / 18.0, 0.0, 0.0, 0.0},
+                    {5.0 / 6.0, -5.0 / 6.0, 1.0 / 2.0, 0.0, 0.0},
+                    {1.0 / 4.0, 7.0 / 4.0, 3.0 / 4.0, -7.0 / 4.0, 0.0}};
+      a_implicit = {{0.0, 0.0, 0.0, 0.0, 0.0},
+                    {0.0, 1.0 / 2.0, 0.0, 0.0, 0.0},
+                    {0.0, 1.0 / 6.0, 1.0 / 2.0, 0.0, 0.0},
+                    {0.0, -1.0 / 2.0, 1.0 / 2.0, 1.0 / 2.0, 0.0},
+                    {0.0, 3.0 / 2.0, -3.0 / 2.0, 1.0 / 2.0, 1.0 / 2.0}};
+      c          = {0.0, 1.0 / 2.0, 2.0 / 3.0, 1.0 / 2.0, 1.0};
+      break;
+    }
+    default:
+    {
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+    }
+  }
+}
+
+unsigned int
+IMEXRungeKuttaConstants::get_order() const
+{
+  return order;
+}
+
+unsigned int
+IMEXRungeKuttaConstants::get_n_stages() const
+{
+  return c.size();
+}
+
+double
+IMEXRungeKuttaConstants::get_a_explicit(unsigned int const i, unsigned int const j) const
+{
+  AssertThrow(i < get_n_stages() and j < get_n_stages(),
+              dealii::ExcMessage("Index of IMEX Runge-Kutta constants out of range."));
+
+  return a_explicit[i][j];
+}
+
+double
+IMEXRungeKuttaConstants::get_a_implicit(unsigned int const i, unsigned int const j) const
+{
+  AssertThrow(i < get_n_stages() and j < get_n_stages(),
+              dealii::ExcMessage("Index of IMEX Runge-Kutta constants out of range."));
+
+  return a_implicit[i][j];
+}
+
+double
+IMEXRungeKuttaConstants::get_c(unsigned int const i) const
+{
+  AssertThrow(i < get_n_stages(),
+              dealii::ExcMessage("Index of IMEX Runge-Kutta constants out of range."));
+
+  return c[i];
+}
+
+void
+IMEXRungeKuttaConstants::print(dealii::ConditionalOStream & pcout) const
+{
+  pcout << "IMEX Runge-Kutta scheme " << name << std::endl;
+
+  for(unsigned int i = 0; i < get_n_stages(); ++i)
+  {
+    pcout << "c[" << i << "] = " << c[i] << ", a_E[" << i << "] =";
+    for(unsigned int j = 0; j < i; ++j)
+      pcout << " " << a_explicit[i][j];
+    pcout << ", a_I[" << i << "] =";
+    for(unsigned int j = 1; j <= i; ++j)
+      pcout << " " << a_implicit[i][j];
+    pcout << std::endl;
+  }
+}
+
+} // namespace ExaDG
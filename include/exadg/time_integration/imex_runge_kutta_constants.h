@@ -0,0 +1,85 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_CONSTANTS_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_CONSTANTS_H_
+
+// C/C++
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+
+namespace ExaDG
+{
+/**
+ * Class that manages the Butcher tableaus of additive implicit-explicit Runge-Kutta schemes for
+ * the splitting du/dt = f_E(u,t) + f_I(u,t) with a non-stiff term f_E treated explicitly and a
+ * stiff term f_I treated implicitly. The schemes of Ascher, Ruuth, Spiteri (1997),
+ * "Implicit-explicit Runge-Kutta methods for time-dependent partial differential equations", are
+ * implemented for orders 1-3, i.e., ARS(1,1,1), ARS(2,2,2), and ARS(4,4,3).
+ *
+ * The stage values are given by
+ *
+ *  U_i = u^n + dt sum_{j<i} a^E_ij f_E(U_j,t_j) + dt sum_{j<=i} a^I_ij f_I(U_j,t_j),
+ *
+ * with t_j = t^n + c_j dt and U_0 = u^n. The implicit tableau is singly diagonally implicit with
+ * a first column of zeros, so that f_I does not have to be evaluated for the first stage. All
+ * schemes are globally stiffly accurate, i.e., the solution u^{n+1} is the last stage value.
+ */
+class IMEXRungeKuttaConstants
+{
+public:
+  IMEXRungeKuttaConstants(unsigned int const order);
+
+  unsigned int
+  get_order() const;
+
+  unsigned int
+  get_n_stages() const;
+
+  double
+  get_a_explicit(unsigned int const i, unsigned int const j) const;
+
+  double
+  get_a_implicit(unsigned int const i, unsigned int const j) const;
+
+  double
+  get_c(unsigned int const i) const;
+
+  void
+  print(dealii::ConditionalOStream & pcout) const;
+
+private:
+  unsigned int const order;
+
+  std::string name;
+
+  // coefficients including the first stage U_0 = u^n
+  std::vector<std::vector<double>> a_explicit;
+  std::vector<std::vector<double>> a_implicit;
+  std::vector<double>              c;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_CONSTANTS_H_ */
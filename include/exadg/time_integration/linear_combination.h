@@ -0,0 +1,137 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_LINEAR_COMBINATION_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_LINEAR_COMBINATION_H_
+
+// C/C++
+#include <cstddef>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/thread_affinity.h>
+
+namespace ExaDG
+{
+/*
+ * This function computes the linear combination
+ *
+ *  dst = sum_i factors[i] * vectors[i]        (add_to_dst = false),
+ *  dst = dst + sum_i factors[i] * vectors[i]  (add_to_dst = true),
+ *
+ * in a single pass over the locally owned entries of all vectors. Multistep time integration
+ * schemes need such linear combinations of the solution history, e.g. for the BDF time
+ * derivative or the extrapolation of the solution, and a sequence of equ()/add() calls would
+ * read and write dst once per history vector. The vectors have to share the same parallel
+ * layout, and ghost values of dst are discarded. The entries are processed by the threads in the
+ * static chunks of static_parallel_for(), such that vectors allocated without zeroing are touched
+ * first by the threads.
+ */
+template<typename Number>
+void
+compute_linear_combination(
+  dealii::LinearAlgebra::distributed::Vector<Number> &                    dst,
+  std::vector<double> const &                                             factors,
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number> const *> const & vectors,
+  bool const add_to_dst = false)
+{
+  AssertThrow(factors.size() == vectors.size(),
+              dealii::ExcMessage("Number of factors and vectors of linear combination differ."));
+
+  dst.zero_out_ghost_values();
+
+  unsigned int const n_vectors = vectors.size();
+  unsigned int const size      = dst.locally_owned_size();
+
+  std::vector<Number const *> src(n_vectors);
+  std::vector<Number>         factors_number(n_vectors);
+  for(unsigned int k = 0; k < n_vectors; ++k)
+  {
+    AssertThrow(vectors[k]->locally_owned_size() == size,
+                dealii::ExcMessage("Vectors of linear combination have different sizes."));
+
+    src[k]            = vectors[k]->begin();
+    factors_number[k] = static_cast<Number>(factors[k]);
+  }
+
+  Number * const dst_ptr = dst.begin();
+
+  static_parallel_for(size, [&](std::size_t const begin, std::size_t const end) {
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      Number sum = add_to_dst ? dst_ptr[i] : Number(0.0);
+      for(unsigned int k = 0; k < n_vectors; ++k)
+        sum += factors_number[k] * src[k][i];
+      dst_ptr[i] = sum;
+    }
+  });
+}
+
+/*
+ * Same as above for block vectors, where the linear combination is computed block by block.
+ */
+template<typename Number>
+void
+compute_linear_combination(
+  dealii::LinearAlgebra::distributed::BlockVector<Number> &                    dst,
+  std::vector<double> const &                                                  factors,
+  std::vector<dealii::LinearAlgebra::distributed::BlockVector<Number> const *> const & vectors,
+  bool const add_to_dst = false)
+{
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number> const *> blocks(vectors.size());
+  for(unsigned int b = 0; b < dst.n_blocks(); ++b)
+  {
+    for(unsigned int k = 0; k < vectors.size(); ++k)
+      blocks[k] = &vectors[k]->block(b);
+
+    compute_linear_combination(dst.block(b), factors, blocks, add_to_dst);
+  }
+}
+
+/*
+ * Same as above for the first factors.size() entries of a history of vectors, e.g., the solution
+ * vectors of a multistep scheme.
+ */
+template<typename VectorType>
+void
+compute_linear_combination(VectorType &                    dst,
+                           std::vector<double> const &     factors,
+                           std::vector<VectorType> const & vectors,
+                           bool const                      add_to_dst = false)
+{
+  AssertThrow(factors.size() <= vectors.size(),
+              dealii::ExcMessage("Number of factors exceeds number of vectors."));
+
+  std::vector<VectorType const *> vector_ptrs(factors.size());
+  for(unsigned int k = 0; k < factors.size(); ++k)
+    vector_ptrs[k] = &vectors[k];
+
+  compute_linear_combination(dst, factors, vector_ptrs, add_to_dst);
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_LINEAR_COMBINATION_H_ */
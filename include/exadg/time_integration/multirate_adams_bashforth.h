@@ -0,0 +1,223 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_ADAMS_BASHFORTH_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_ADAMS_BASHFORTH_H_
+
+// C/C++
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/quadrature_lib.h>
+
+// ExaDG
+#include <exadg/time_integration/push_back_vectors.h>
+
+namespace ExaDG
+{
+/**
+ * Multirate Adams--Bashforth method with two levels for local time stepping (Gear, Wells (1984)
+ * "Multirate linear multistep methods", Gödel et al. (2010) "GPU accelerated Adams-Bashforth
+ * multirate discontinuous Galerkin FEM simulation of high-frequency electromagnetic fields").
+ *
+ * The degrees of freedom are split into a coarse level advanced with the time step size dt and a
+ * fine level advanced with n_substeps sub-steps of size dt/n_substeps. The operator is evaluated
+ * for all cells at the beginning of each time step, providing the new entry of the history of the
+ * coarse level. In the remaining sub-steps, the operator is only evaluated for the cells of the
+ * fine level, where the values of the coarse level are obtained by integrating the
+ * Adams--Bashforth polynomial of the coarse level up to the time of the sub-step. Both levels use
+ * Adams--Bashforth schemes of the same order, starting with low order until enough history is
+ * available. The time step size has to be constant.
+ *
+ * The operator needs to provide the functions
+ *
+ *   initialize_dof_vector(dst),
+ *   evaluate(dst, src, time),
+ *   evaluate_fine_level(dst, src, time), which only needs to be correct for the fine level,
+ *   initialize_fine_level_mask(mask), which sets mask to one for the fine level and zero else.
+ */
+template<typename Operator, typename VectorType>
+class MultirateAdamsBashforth
+{
+  using Number = typename VectorType::value_type;
+
+public:
+  MultirateAdamsBashforth(std::shared_ptr<Operator const> pde_operator_in,
+                          unsigned int const              order_in,
+                          unsigned int const              n_substeps_in)
+    : pde_operator(pde_operator_in),
+      order(order_in),
+      n_substeps(n_substeps_in),
+      history_coarse(order_in),
+      history_fine(order_in),
+      n_history_coarse(0),
+      n_history_fine(0)
+  {
+    AssertThrow(order >= 1,
+                dealii::ExcMessage("Order of multirate Adams-Bashforth has to be at least 1."));
+    AssertThrow(n_substeps >= 1, dealii::ExcMessage("Invalid number of sub-steps."));
+  }
+
+  void
+  initialize()
+  {
+    for(auto & vector : history_coarse)
+      pde_operator->initialize_dof_vector(vector);
+    for(auto & vector : history_fine)
+      pde_operator->initialize_dof_vector(vector);
+
+    pde_operator->initialize_dof_vector(solution_n);
+    pde_operator->initialize_dof_vector(solution_coarse);
+
+    pde_operator->initialize_fine_level_mask(mask_fine);
+    mask_coarse.reinit(mask_fine, true);
+    mask_coarse = 1.0;
+    mask_coarse -= mask_fine;
+
+    n_history_coarse = 0;
+    n_history_fine   = 0;
+  }
+
+  unsigned int
+  get_n_substeps() const
+  {
+    return n_substeps;
+  }
+
+  /*
+   * Advances the solution from time to time + time_step.
+   */
+  void
+  solve_timestep(VectorType & solution, double const time, double const time_step)
+  {
+    double const sub_time_step = time_step / n_substeps;
+
+    solution_n = solution;
+
+    // coarse level: evaluate the operator for all cells
+    push_back(history_coarse);
+    pde_operator->evaluate(history_coarse[0], solution, time);
+    n_history_coarse = std::min(n_history_coarse + 1, order);
+
+    for(unsigned int m = 0; m < n_substeps; ++m)
+    {
+      double const theta = static_cast<double>(m) / n_substeps;
+
+      push_back(history_fine);
+      if(m == 0)
+      {
+        history_fine[0] = history_coarse[0];
+      }
+      else
+      {
+        // solution of the coarse level at the time of the sub-step
+        update_coarse_level(solution, time_step, theta);
+
+        pde_operator->evaluate_fine_level(history_fine[0], solution, time + theta * time_step);
+      }
+      n_history_fine = std::min(n_history_fine + 1, order);
+
+      // fine level: Adams--Bashforth step with the sub-step size. The coarse level is overwritten
+      // in update_coarse_level().
+      std::vector<double> const weights = compute_weights(n_history_fine, 0.0, 1.0);
+      for(unsigned int i = 0; i < n_history_fine; ++i)
+        solution.add(static_cast<Number>(sub_time_step * weights[i]), history_fine[i]);
+    }
+
+    update_coarse_level(solution, time_step, 1.0);
+  }
+
+private:
+  /*
+   * Sets the coarse level of the solution to the Adams--Bashforth polynomial of the coarse level
+   * integrated from time_n to time_n + theta * time_step, and keeps the fine level.
+   */
+  void
+  update_coarse_level(VectorType & solution, double const time_step, double const theta)
+  {
+    std::vector<double> const weights = compute_weights(n_history_coarse, 0.0, theta);
+
+    solution_coarse = solution_n;
+    for(unsigned int i = 0; i < n_history_coarse; ++i)
+      solution_coarse.add(static_cast<Number>(time_step * weights[i]), history_coarse[i]);
+
+    solution_coarse.scale(mask_coarse);
+    solution.scale(mask_fine);
+    solution += solution_coarse;
+  }
+
+  /*
+   * Integrals from theta_begin to theta_end of the Lagrange polynomials through the nodes
+   * s_i = -i, i = 0, ..., n_nodes - 1, i.e., the Adams--Bashforth weights for theta_begin = 0 and
+   * theta_end = 1.
+   */
+  static std::vector<double>
+  compute_weights(unsigned int const n_nodes, double const theta_begin, double const theta_end)
+  {
+    std::vector<double> weights(n_nodes, 0.0);
+
+    dealii::QGauss<1> const quadrature(std::max(n_nodes, 1u));
+    for(unsigned int q = 0; q < quadrature.size(); ++q)
+    {
+      double const s = theta_begin + (theta_end - theta_begin) * quadrature.point(q)[0];
+      double const w = (theta_end - theta_begin) * quadrature.weight(q);
+
+      for(unsigned int j = 0; j < n_nodes; ++j)
+      {
+        double lagrange = 1.0;
+        for(unsigned int i = 0; i < n_nodes; ++i)
+          if(i != j)
+            lagrange *= (s + static_cast<double>(i)) / (static_cast<double>(i) - j);
+
+        weights[j] += w * lagrange;
+      }
+    }
+
+    return weights;
+  }
+
+  std::shared_ptr<Operator const> pde_operator;
+
+  unsigned int const order;
+
+  unsigned int const n_substeps;
+
+  // evaluated operators at the previous time steps and sub-steps
+  std::vector<VectorType> history_coarse;
+  std::vector<VectorType> history_fine;
+
+  // number of valid entries of the history, i.e., the current order
+  unsigned int n_history_coarse;
+  unsigned int n_history_fine;
+
+  // one for the degrees of freedom of the respective level, zero else
+  VectorType mask_fine;
+  VectorType mask_coarse;
+
+  VectorType solution_n;
+  VectorType solution_coarse;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_ADAMS_BASHFORTH_H_ */
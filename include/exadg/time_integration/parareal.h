@@ -0,0 +1,302 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_
+
+// C/C++
+#include <algorithm>
+#include <functional>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Parameters of the parallel-in-time solution with the Parareal method. These parameters are read
+ * before the spatial problem is created since the MPI communicator has to be split into time
+ * slices first.
+ */
+struct PararealParameters
+{
+  PararealParameters()
+  {
+  }
+
+  PararealParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    prm.enter_subsection("Parareal");
+    {
+      prm.add_parameter("NTimeSlices",
+                        n_time_slices,
+                        "Number of time slices (1: no parallelization in time).",
+                        dealii::Patterns::Integer(1),
+                        true);
+      prm.add_parameter("MaxIterations",
+                        max_iterations,
+                        "Maximum number of Parareal iterations.",
+                        dealii::Patterns::Integer(1),
+                        true);
+      prm.add_parameter("Tolerance",
+                        tolerance,
+                        "Tolerance of the l2-norm of the update of the slice initial values.",
+                        dealii::Patterns::Double(0.0),
+                        true);
+      prm.add_parameter("CoarseTimeStepFactor",
+                        coarse_time_step_factor,
+                        "Ratio of the time step sizes of the coarse and fine propagators.",
+                        dealii::Patterns::Double(1.0),
+                        true);
+    }
+    prm.leave_subsection();
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    pcout << std::endl << "Parareal:" << std::endl;
+
+    print_parameter(pcout, "Number of time slices", n_time_slices);
+    print_parameter(pcout, "Maximum number of iterations", max_iterations);
+    print_parameter(pcout, "Tolerance", tolerance);
+    print_parameter(pcout, "Coarse time step factor", coarse_time_step_factor);
+  }
+
+  unsigned int n_time_slices           = 1;
+  unsigned int max_iterations          = 10;
+  double       tolerance               = 1.e-10;
+  double       coarse_time_step_factor = 10.0;
+};
+
+/**
+ * Parareal method (Lions, Maday, Turinici (2001), "Résolution d'EDP par un schéma en temps
+ * pararéel") for the parallelization in time. The time interval is split into n_time_slices
+ * slices of equal length, each of which is assigned to a group of MPI processes with its own
+ * spatial problem created on the space communicator. Given a fine propagator F and a cheap coarse
+ * propagator G, the initial values of the time slices are iterated according to
+ *
+ *   U_{j+1}^{k+1} = G(U_j^{k+1}) + F(U_j^k) - G(U_j^k),
+ *
+ * where the fine propagators of all time slices run in parallel, and the coarse propagators are
+ * applied sequentially. The method converges to the solution of the fine propagator after at most
+ * n_time_slices iterations. The spatial problems of all time slices need to have the same
+ * parallel partitioning so that the processes with the same rank in the space communicators can
+ * exchange the locally owned parts of the solution vectors.
+ */
+template<typename Number>
+class Parareal
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  /*
+   * Propagates the solution from start_time to end_time.
+   */
+  typedef std::function<void(VectorType &, double const, double const)> Propagator;
+
+  Parareal(MPI_Comm const & mpi_comm, PararealParameters const & parameters_in)
+    : parameters(parameters_in)
+  {
+    unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+    unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    AssertThrow(parameters.n_time_slices >= 1 and n_ranks % parameters.n_time_slices == 0,
+                dealii::ExcMessage("The number of MPI processes has to be a multiple of the "
+                                   "number of time slices."));
+
+    unsigned int const n_ranks_space = n_ranks / parameters.n_time_slices;
+
+    time_slice = rank / n_ranks_space;
+
+    int ierr = MPI_Comm_split(mpi_comm, time_slice, rank, &comm_space);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Comm_split(mpi_comm, rank % n_ranks_space, rank, &comm_time);
+    AssertThrowMPI(ierr);
+  }
+
+  ~Parareal()
+  {
+    MPI_Comm_free(&comm_space);
+    MPI_Comm_free(&comm_time);
+  }
+
+  /*
+   * The spatial problems have to be created on this communicator.
+   */
+  MPI_Comm const &
+  get_space_communicator() const
+  {
+    return comm_space;
+  }
+
+  unsigned int
+  get_time_slice() const
+  {
+    return time_slice;
+  }
+
+  bool
+  is_last_time_slice() const
+  {
+    return time_slice + 1 == parameters.n_time_slices;
+  }
+
+  /*
+   * On input, solution holds the initial condition at start_time on the first time slice. On
+   * output, solution holds the solution at the end of the own time slice. Returns the number of
+   * Parareal iterations.
+   */
+  unsigned int
+  solve(VectorType &       solution,
+        Propagator const & fine_propagator,
+        Propagator const & coarse_propagator,
+        double const       start_time,
+        double const       end_time) const
+  {
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(comm_space) == 0 and
+                                       time_slice == 0);
+
+    double const slice_length     = (end_time - start_time) / parameters.n_time_slices;
+    double const slice_start_time = start_time + time_slice * slice_length;
+    double const slice_end_time   = slice_start_time + slice_length;
+
+    // initial value U_j of the own time slice, the coarse solution G(U_j), and the fine solution
+    // F(U_j)
+    VectorType initial_value(solution), coarse_solution(solution), fine_solution(solution);
+
+    // initial prediction by sequential coarse propagation
+    if(time_slice > 0)
+      receive(initial_value);
+
+    coarse_solution = initial_value;
+    coarse_propagator(coarse_solution, slice_start_time, slice_end_time);
+
+    if(not is_last_time_slice())
+      send(coarse_solution);
+
+    solution = coarse_solution;
+
+    unsigned int const max_iterations =
+      std::min(parameters.max_iterations, parameters.n_time_slices);
+
+    unsigned int iteration = 0;
+    while(iteration < max_iterations)
+    {
+      ++iteration;
+
+      // fine propagation, in parallel for all time slices
+      fine_solution = initial_value;
+      fine_propagator(fine_solution, slice_start_time, slice_end_time);
+
+      // sequential correction, the initial value of the first time slice is exact
+      double update_norm = 0.0;
+      if(time_slice > 0)
+      {
+        VectorType new_initial_value(initial_value);
+        receive(new_initial_value);
+
+        initial_value -= new_initial_value;
+        update_norm = initial_value.l2_norm();
+
+        initial_value = new_initial_value;
+      }
+
+      // solution = G(U_j^{k+1}) + F(U_j^k) - G(U_j^k)
+      solution = fine_solution;
+      solution -= coarse_solution;
+
+      coarse_solution = initial_value;
+      coarse_propagator(coarse_solution, slice_start_time, slice_end_time);
+
+      solution += coarse_solution;
+
+      if(not is_last_time_slice())
+        send(solution);
+
+      update_norm = dealii::Utilities::MPI::max(update_norm, comm_time);
+
+      pcout << "  Parareal iteration " << iteration << ": update of initial values "
+            << update_norm << std::endl;
+
+      if(update_norm < parameters.tolerance)
+        break;
+    }
+
+    return iteration;
+  }
+
+private:
+  void
+  send(VectorType const & vector) const
+  {
+    int const ierr = MPI_Send(vector.begin(),
+                              vector.locally_owned_size(),
+                              dealii::Utilities::MPI::mpi_type_id_for_type<Number>,
+                              time_slice + 1,
+                              0,
+                              comm_time);
+    AssertThrowMPI(ierr);
+  }
+
+  void
+  receive(VectorType & vector) const
+  {
+    int const ierr = MPI_Recv(vector.begin(),
+                              vector.locally_owned_size(),
+                              dealii::Utilities::MPI::mpi_type_id_for_type<Number>,
+                              time_slice - 1,
+                              0,
+                              comm_time,
+                              MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  PararealParameters const parameters;
+
+  unsigned int time_slice;
+
+  // processes of the own time slice
+  MPI_Comm comm_space;
+
+  // processes with the same rank in the space communicator in all time slices, ordered by the
+  // time slices
+  MPI_Comm comm_time;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_ */
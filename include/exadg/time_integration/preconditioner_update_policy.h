@@ -0,0 +1,145 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_PRECONDITIONER_UPDATE_POLICY_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_PRECONDITIONER_UPDATE_POLICY_H_
+
+// C/C++
+#include <algorithm>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/*
+ * Decides automatically when to update the preconditioner of a linear solver called once per time
+ * step, as an alternative to a fixed number of time steps between updates. The policy compares
+ * the cost of an update with the cost of the additional iterations caused by an outdated
+ * preconditioner: The number of iterations of the solve with an updated preconditioner serves as
+ * baseline, and the iterations exceeding this baseline in the subsequent solves are accumulated in
+ * terms of wall time using the measured time per iteration. Once the accumulated time exceeds the
+ * measured time of the last update, the preconditioner is updated again (break-even rule). For
+ * statistically stationary or time-periodic problems, where the iteration counts hardly change,
+ * updates are hence only triggered rarely, while quickly changing problems trigger updates more
+ * often.
+ *
+ * The cost of an update is obtained as the wall time of the solve with update minus the iterations
+ * of this solve times the time per iteration of the subsequent solve without update. The wall
+ * times are maximized over all processes such that all processes take the same decisions.
+ */
+class PreconditionerUpdatePolicy
+{
+public:
+  PreconditionerUpdatePolicy()
+    : n_solves(0),
+      baseline_iterations(0),
+      wall_time_last_update(0.0),
+      time_per_iteration(-1.0),
+      update_cost(-1.0),
+      accumulated_cost(0.0),
+      n_updates(0)
+  {
+  }
+
+  /*
+   * Returns whether the preconditioner should be updated in the next solve.
+   */
+  bool
+  update_needed() const
+  {
+    // first solve
+    if(n_solves == 0)
+      return true;
+
+    // the cost of the last update is not known yet
+    if(update_cost < 0.0)
+      return false;
+
+    return accumulated_cost > update_cost;
+  }
+
+  /*
+   * Reports the number of iterations and the wall time (on the calling process) of a solve, as
+   * well as whether the preconditioner has been updated in this solve.
+   */
+  void
+  report(unsigned int const n_iterations,
+         double const       wall_time,
+         bool const         updated,
+         MPI_Comm const &   mpi_comm)
+  {
+    double const max_wall_time = dealii::Utilities::MPI::max(wall_time, mpi_comm);
+
+    ++n_solves;
+
+    if(updated)
+    {
+      ++n_updates;
+
+      baseline_iterations   = n_iterations;
+      wall_time_last_update = max_wall_time;
+      accumulated_cost      = 0.0;
+      update_cost           = -1.0;
+    }
+    else
+    {
+      time_per_iteration = max_wall_time / std::max(n_iterations, 1u);
+
+      if(update_cost < 0.0)
+      {
+        update_cost =
+          std::max(0.0, wall_time_last_update - baseline_iterations * time_per_iteration);
+      }
+
+      if(n_iterations > baseline_iterations)
+        accumulated_cost += (n_iterations - baseline_iterations) * time_per_iteration;
+    }
+  }
+
+  unsigned int
+  get_number_of_updates() const
+  {
+    return n_updates;
+  }
+
+private:
+  unsigned int n_solves;
+
+  // iterations and wall time of the solve with the last update
+  unsigned int baseline_iterations;
+  double       wall_time_last_update;
+
+  double time_per_iteration;
+
+  // estimated cost of the last update, negative if not known yet
+  double update_cost;
+
+  // cost of the iterations exceeding the baseline since the last update
+  double accumulated_cost;
+
+  unsigned int n_updates;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_PRECONDITIONER_UPDATE_POLICY_H_ */
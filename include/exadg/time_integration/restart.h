@@ -23,8 +23,16 @@
 #define INCLUDE_EXADG_TIME_INTEGRATION_RESTART_H_
 
 // C/C++
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include <cstdint>
 #include <fstream>
-#include <sstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
 
 // deal.II
 #include <deal.II/base/mpi.h>
@@ -58,12 +66,219 @@ rename_restart_files(std::string const & filename)
   }
 }
 
+/*
+ * Restart data that can not be streamed directly into the restart file is serialized into a buffer
+ * of type RestartBuffer through an output stream of type RestartBufferOutStream, and is read back
+ * through an input stream of type RestartBufferInStream operating on the buffer in-place, i.e.,
+ * without intermediate copies of the data as needed by std::ostringstream and std::istringstream.
+ */
+typedef std::vector<char> RestartBuffer;
+
+typedef boost::iostreams::stream<boost::iostreams::back_insert_device<RestartBuffer>>
+  RestartBufferOutStream;
+
+typedef boost::iostreams::stream<boost::iostreams::array_source> RestartBufferInStream;
+
+/*
+ * Writes the restart file via a temporary file, which replaces the restart file only once it has
+ * been written completely. The previous restart file is kept as backup, see rename_restart_files().
+ * Hence, a valid restart file is available at any time, which allows to call this function in a
+ * background thread while the simulation continues.
+ */
+inline void
+write_restart_file_and_rotate(RestartBuffer const & data, std::string const & filename)
+{
+  std::string const tmp = filename + ".tmp";
+
+  {
+    std::ofstream stream(tmp.c_str(), std::ios::binary);
+    stream.write(data.data(), data.size());
+
+    AssertThrow(stream.good(), dealii::ExcMessage("Could not write file: " + tmp));
+  }
+
+  rename_restart_files(filename);
+
+  int const error = rename(tmp.c_str(), filename.c_str());
+
+  AssertThrow(error == 0, dealii::ExcMessage("Can not rename file: " + tmp + " -> " + filename));
+}
+
+/*
+ * Collective restart format: the serialized data of all MPI processes is written into one shared
+ * file via MPI-IO instead of one file per process. The file consists of a header with the number of
+ * processes and the size of the data block of each process (as 64-bit unsigned integers), followed
+ * by the data blocks in the order of the ranks.
+ */
+inline std::string
+restart_filename_shared(std::string const & name)
+{
+  return name + ".restart";
+}
+
 inline void
-write_restart_file(std::ostringstream & oss, std::string const & filename)
+write_restart_file_shared(RestartBuffer const & data,
+                          std::string const &   filename,
+                          MPI_Comm const &      mpi_comm)
 {
-  std::ofstream stream(filename.c_str());
+  AssertThrow(data.size() < static_cast<std::size_t>(std::numeric_limits<int>::max()),
+              dealii::ExcMessage("Restart data of one process exceeds the maximum size that can "
+                                 "be written by one MPI-IO call."));
+
+  std::uint64_t const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  std::uint64_t const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  std::uint64_t const size    = data.size();
+
+  // offset of the data block of this process within the data section
+  std::uint64_t offset = 0;
+  int           ierr   = MPI_Exscan(&size, &offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+  if(rank == 0)
+    offset = 0;
+
+  MPI_Offset const header_size = (1 + n_ranks) * sizeof(std::uint64_t);
+
+  MPI_File fh;
+  ierr = MPI_File_open(
+    mpi_comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
+  AssertThrow(ierr == MPI_SUCCESS, dealii::ExcMessage("Can not open file: " + filename));
+
+  // discard the contents of a possibly existing file
+  ierr = MPI_File_set_size(fh, 0);
+  AssertThrowMPI(ierr);
+
+  // header
+  if(rank == 0)
+  {
+    ierr = MPI_File_write_at(fh, 0, &n_ranks, 1, MPI_UINT64_T, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+  ierr = MPI_File_write_at_all(
+    fh, (1 + rank) * sizeof(std::uint64_t), &size, 1, MPI_UINT64_T, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  // data blocks
+  ierr = MPI_File_write_at_all(fh,
+                               header_size + offset,
+                               data.data(),
+                               static_cast<int>(size),
+                               MPI_BYTE,
+                               MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  ierr = MPI_File_close(&fh);
+  AssertThrowMPI(ierr);
+}
+
+inline RestartBuffer
+read_restart_file_shared(std::string const & filename, MPI_Comm const & mpi_comm)
+{
+  std::uint64_t const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  std::uint64_t const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  MPI_File fh;
+  int      ierr = MPI_File_open(mpi_comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+  AssertThrow(ierr == MPI_SUCCESS, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  std::uint64_t n_old_ranks = 0;
+  ierr = MPI_File_read_at_all(fh, 0, &n_old_ranks, 1, MPI_UINT64_T, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  AssertThrow(n_old_ranks == n_ranks,
+              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
+                                 " processes, but restart was written on " +
+                                 dealii::Utilities::to_string(n_old_ranks) + " processes."));
+
+  std::uint64_t size = 0;
+  ierr = MPI_File_read_at_all(
+    fh, (1 + rank) * sizeof(std::uint64_t), &size, 1, MPI_UINT64_T, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  std::uint64_t offset = 0;
+  ierr = MPI_Exscan(&size, &offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+  if(rank == 0)
+    offset = 0;
+
+  MPI_Offset const header_size = (1 + n_ranks) * sizeof(std::uint64_t);
+
+  RestartBuffer data(size);
+  ierr = MPI_File_read_at_all(fh,
+                              header_size + offset,
+                              data.data(),
+                              static_cast<int>(size),
+                              MPI_BYTE,
+                              MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  ierr = MPI_File_close(&fh);
+  AssertThrowMPI(ierr);
+
+  return data;
+}
+
+/*
+ * Reads the data blocks of a shared restart file written with an arbitrary number of processes.
+ * The blocks of the original processes are distributed cyclically among the current processes.
+ * Processes that do not get a block read the block of process 0 instead, such that every process
+ * obtains at least one block, e.g., to read information that is identical on all processes. The
+ * data read from the blocks hence needs to be processed in a partition-independent way, see
+ * CellwiseRestartReader.
+ */
+inline std::vector<RestartBuffer>
+read_restart_file_shared_blocks(std::string const & filename, MPI_Comm const & mpi_comm)
+{
+  std::uint64_t const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  std::uint64_t const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  MPI_File fh;
+  int      ierr = MPI_File_open(mpi_comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+  AssertThrow(ierr == MPI_SUCCESS, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  std::uint64_t n_old_ranks = 0;
+  ierr = MPI_File_read_at_all(fh, 0, &n_old_ranks, 1, MPI_UINT64_T, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  std::vector<std::uint64_t> sizes(n_old_ranks);
+  ierr = MPI_File_read_at_all(fh,
+                              sizeof(std::uint64_t),
+                              sizes.data(),
+                              static_cast<int>(n_old_ranks),
+                              MPI_UINT64_T,
+                              MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  MPI_Offset const header_size = (1 + n_old_ranks) * sizeof(std::uint64_t);
+
+  std::vector<std::uint64_t> offsets(n_old_ranks + 1, 0);
+  for(std::uint64_t r = 0; r < n_old_ranks; ++r)
+    offsets[r + 1] = offsets[r] + sizes[r];
+
+  std::vector<std::uint64_t> old_ranks;
+  for(std::uint64_t r = rank; r < n_old_ranks; r += n_ranks)
+    old_ranks.push_back(r);
+  if(old_ranks.empty())
+    old_ranks.push_back(0);
+
+  std::vector<RestartBuffer> blocks;
+  for(auto const r : old_ranks)
+  {
+    RestartBuffer data(sizes[r]);
+    ierr = MPI_File_read_at(fh,
+                            header_size + offsets[r],
+                            data.data(),
+                            static_cast<int>(sizes[r]),
+                            MPI_BYTE,
+                            MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+
+    blocks.push_back(std::move(data));
+  }
+
+  ierr = MPI_File_close(&fh);
+  AssertThrowMPI(ierr);
 
-  stream << oss.str() << std::endl;
+  return blocks;
 }
 
 } // namespace ExaDG
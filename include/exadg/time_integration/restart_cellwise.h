@@ -0,0 +1,302 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_RESTART_CELLWISE_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_RESTART_CELLWISE_H_
+
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/grid/cell_id.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+namespace ExaDG
+{
+/*
+ * Partition-independent restart data: instead of the locally owned part of a DoF vector, whose
+ * layout depends on the number of MPI processes and the mesh partitioning, the DoF values of each
+ * locally owned cell are stored together with the CellId of the cell. Provided that the mesh is
+ * recreated identically (same coarse mesh and refinement) when restarting, the values can be
+ * assigned to the cells of an arbitrary partitioning, see CellwiseRestartReader.
+ */
+template<int dim, typename Number>
+void
+write_restart_vector_cellwise(boost::archive::binary_oarchive &                        oa,
+                              dealii::DoFHandler<dim> const &                          dof_handler,
+                              dealii::LinearAlgebra::distributed::Vector<Number> const & vector)
+{
+  bool const has_ghost_elements = vector.has_ghost_elements();
+  if(not has_ghost_elements)
+    vector.update_ghost_values();
+
+  unsigned int n_cells = 0;
+  for(auto const & cell : dof_handler.active_cell_iterators())
+    if(cell->is_locally_owned())
+      ++n_cells;
+
+  oa & n_cells;
+
+  dealii::Vector<Number> local_values(dof_handler.get_fe().n_dofs_per_cell());
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      cell->get_dof_values(vector, local_values);
+
+      std::string const   cell_id = cell->id().to_string();
+      std::vector<Number> values(local_values.begin(), local_values.end());
+
+      oa & cell_id;
+      oa & values;
+    }
+  }
+
+  if(not has_ghost_elements)
+    vector.zero_out_ghost_values();
+}
+
+/*
+ * Reads the data written by write_restart_vector_cellwise() from restart data that might have
+ * been written with a different number of MPI processes. The data of one process of the original
+ * run might be read by any process, and the same data might be read several times. The values are
+ * assigned to the DoF vectors by distribute(), which redistributes the cell-wise data to the
+ * processes owning the cells in the current partitioning. To this end, each cell is mapped to a
+ * rendezvous process via the hash of its CellId, which avoids collecting the whole data on any
+ * process.
+ *
+ * The data may stem from a finite element of the same type but of lower polynomial degree than the
+ * finite element of the DoFHandler, e.g., from a startup phase simulated at low degree. In that
+ * case, the cell-wise values are interpolated to the finite element of the DoFHandler, which is
+ * the embedding of the polynomial spaces also used by the p-transfer of the multigrid
+ * preconditioners for discontinuous elements.
+ */
+template<int dim, typename Number>
+class CellwiseRestartReader
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  /*
+   * Reads the cell-wise data of one vector from the archive. The data is assigned to the vector
+   * dst (defined on dof_handler) when calling distribute().
+   */
+  void
+  read(boost::archive::binary_iarchive & ia,
+       dealii::DoFHandler<dim> const &   dof_handler,
+       VectorType &                      dst)
+  {
+    unsigned int slot = 0;
+    auto         it   = std::find(destinations.begin(), destinations.end(), &dst);
+    if(it == destinations.end())
+    {
+      slot = destinations.size();
+      destinations.push_back(&dst);
+      dof_handlers.push_back(&dof_handler);
+    }
+    else
+    {
+      slot = std::distance(destinations.begin(), it);
+    }
+
+    unsigned int n_cells = 0;
+    ia &         n_cells;
+
+    for(unsigned int i = 0; i < n_cells; ++i)
+    {
+      std::string         cell_id;
+      std::vector<Number> values;
+
+      ia & cell_id;
+      ia & values;
+
+      records.emplace_back(Key(slot, cell_id), std::move(values));
+    }
+  }
+
+  /*
+   * Collective operation assigning the cell-wise data read by all processes to the DoF vectors.
+   */
+  void
+  distribute(MPI_Comm const & mpi_comm)
+  {
+    unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    auto const rendezvous_rank = [&](Key const & key) {
+      return static_cast<unsigned int>(std::hash<std::string>()(key.second) % n_ranks);
+    };
+
+    // send the data read on this process to the rendezvous processes of the cells
+    std::map<unsigned int, RecordList> records_to_send;
+    for(auto & record : records)
+      records_to_send[rendezvous_rank(record.first)].push_back(std::move(record));
+    records.clear();
+
+    std::map<Key, std::vector<Number>> directory;
+    for(auto & received : dealii::Utilities::MPI::some_to_some(mpi_comm, records_to_send))
+      for(auto & record : received.second)
+        directory[record.first] = std::move(record.second);
+    records_to_send.clear();
+
+    // request the data of the locally owned cells of the current partitioning
+    std::map<unsigned int, KeyList> requests;
+    std::map<Key, typename dealii::DoFHandler<dim>::active_cell_iterator> cells;
+    for(unsigned int slot = 0; slot < destinations.size(); ++slot)
+    {
+      for(auto const & cell : dof_handlers[slot]->active_cell_iterators())
+      {
+        if(cell->is_locally_owned())
+        {
+          Key const key(slot, cell->id().to_string());
+          requests[rendezvous_rank(key)].push_back(key);
+          cells[key] = cell;
+        }
+      }
+    }
+
+    std::map<unsigned int, RecordList> answers;
+    for(auto const & received : dealii::Utilities::MPI::some_to_some(mpi_comm, requests))
+    {
+      RecordList & answer = answers[received.first];
+      for(auto const & key : received.second)
+      {
+        auto const it = directory.find(key);
+        AssertThrow(it != directory.end(),
+                    dealii::ExcMessage("Cell " + key.second +
+                                       " not found in restart data. The mesh has to be identical "
+                                       "to the mesh used when writing the restart data."));
+        answer.emplace_back(key, it->second);
+      }
+    }
+    directory.clear();
+
+    // assign the values to the DoF vectors
+    for(auto & dst : destinations)
+      dst->zero_out_ghost_values();
+
+    for(auto const & received : dealii::Utilities::MPI::some_to_some(mpi_comm, answers))
+    {
+      for(auto const & record : received.second)
+      {
+        unsigned int const slot = record.first.first;
+
+        dealii::FiniteElement<dim> const & fe = dof_handlers[slot]->get_fe();
+
+        dealii::Vector<Number> local_values(record.second.begin(), record.second.end());
+        if(local_values.size() != fe.n_dofs_per_cell())
+        {
+          dealii::Vector<Number> const values_source = local_values;
+          local_values.reinit(fe.n_dofs_per_cell());
+          get_interpolation_matrix(fe, values_source.size()).vmult(local_values, values_source);
+        }
+
+        cells.at(record.first)->set_dof_values(local_values, *destinations[slot]);
+      }
+    }
+
+    for(auto & dst : destinations)
+      dst->compress(dealii::VectorOperation::insert);
+
+    destinations.clear();
+    dof_handlers.clear();
+  }
+
+private:
+  /*
+   * Returns the matrix interpolating from the finite element of the same type as fe with
+   * n_dofs_source DoFs per cell to fe. The finite element of the restart data is identified by
+   * replacing the polynomial degree in the name of fe by all lower degrees.
+   */
+  dealii::FullMatrix<double> const &
+  get_interpolation_matrix(dealii::FiniteElement<dim> const & fe, unsigned int const n_dofs_source)
+  {
+    std::pair<std::string, unsigned int> const key(fe.get_name(), n_dofs_source);
+
+    auto it = interpolation_matrices.find(key);
+    if(it == interpolation_matrices.end())
+    {
+      dealii::FullMatrix<double> matrix;
+      for(unsigned int degree = 1; degree < fe.degree and matrix.m() == 0; ++degree)
+      {
+        std::string const name = std::regex_replace(fe.get_name(),
+                                                    std::regex("\\([0-9]+\\)"),
+                                                    "(" + std::to_string(degree) + ")");
+
+        std::unique_ptr<dealii::FiniteElement<dim>> const fe_source =
+          dealii::FETools::get_fe_by_name<dim>(name);
+
+        if(fe_source->n_dofs_per_cell() == n_dofs_source)
+        {
+          matrix.reinit(fe.n_dofs_per_cell(), n_dofs_source);
+          dealii::FETools::get_interpolation_matrix(*fe_source, fe, matrix);
+        }
+      }
+
+      AssertThrow(matrix.m() > 0,
+                  dealii::ExcMessage("The finite element has to be identical to the finite "
+                                     "element used when writing the restart data, or of the same "
+                                     "type with lower polynomial degree."));
+
+      it = interpolation_matrices.emplace(key, std::move(matrix)).first;
+    }
+
+    return it->second;
+  }
+
+  // index of the destination vector and CellId
+  typedef std::pair<unsigned int, std::string> Key;
+
+  typedef std::vector<std::pair<Key, std::vector<Number>>> RecordList;
+  typedef std::vector<Key>                                  KeyList;
+
+  RecordList records;
+
+  std::vector<VectorType *>                    destinations;
+  std::vector<dealii::DoFHandler<dim> const *> dof_handlers;
+
+  std::map<std::pair<std::string, unsigned int>, dealii::FullMatrix<double>>
+    interpolation_matrices;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_RESTART_CELLWISE_H_ */
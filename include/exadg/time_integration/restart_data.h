@@ -42,6 +42,9 @@ struct RestartData
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
       filename("restart"),
+      shared_file(false),
+      partition_independent(false),
+      asynchronous(false),
       counter(1)
   {
   }
@@ -58,6 +61,9 @@ struct RestartData
       print_parameter(pcout, "Interval wall time", interval_wall_time);
       print_parameter(pcout, "Interval time steps", interval_time_steps);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Shared file", shared_file);
+      print_parameter(pcout, "Partition independent", partition_independent);
+      print_parameter(pcout, "Asynchronous", asynchronous);
     }
   }
 
@@ -97,6 +103,18 @@ struct RestartData
   // filename for restart files
   std::string filename;
 
+  // write the data of all MPI processes collectively into one shared file (MPI-IO) instead of
+  // one file per process
+  bool shared_file;
+
+  // store the DoF vectors cell by cell, such that the simulation can be restarted with a
+  // different number of MPI processes (on an identical mesh). Implies shared_file = true.
+  bool partition_independent;
+
+  // serialize the restart data into a buffer and write the buffer to file in a background thread
+  // while the time loop continues (only with one file per process)
+  bool asynchronous;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 };
@@ -0,0 +1,218 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_ROSENBROCK_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_ROSENBROCK_H_
+
+// C/C++
+#include <cmath>
+#include <limits>
+#include <memory>
+
+// deal.II
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/**
+ * Linearly implicit Rosenbrock-W method ROS2 of order 2 with 2 stages for du/dt = F(u, t)
+ * (Verwer, Spee, Blom, Hundsdorfer (1999), "A second-order Rosenbrock method applied to
+ * photochemical dispersion problems"). With gamma = 1 + 1/sqrt(2) and the Jacobian J of F at the
+ * old time, one time step reads
+ *
+ *   (I - gamma dt J) k_1 = F(u_n, t_n),
+ *   (I - gamma dt J) k_2 = F(u_n + dt k_1, t_n + dt) - 2 k_1,
+ *   u_{n+1} = u_n + 3/2 dt k_1 + 1/2 dt k_2.
+ *
+ * The method is L-stable, such that the time step size is not restricted by stiff parts of F such
+ * as the acoustic waves at low Mach numbers. As a W-method, it retains second order for arbitrary
+ * approximations of the Jacobian, which justifies neglecting the explicit time dependence of F in
+ * J. The linear systems are solved by GMRES without assembling J, the Jacobian is applied by the
+ * finite difference J v = (F(u_n + eps v, t_n) - F(u_n, t_n)) / eps. The linearly implicit Euler
+ * method u_n + dt k_1 serves as embedded scheme of order 1.
+ *
+ * The operator needs to provide the functions
+ *
+ *   initialize_dof_vector(dst),
+ *   evaluate(dst, src, time).
+ */
+template<typename Operator, typename VectorType>
+class RosenbrockW2 : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+  using Number = typename VectorType::value_type;
+
+public:
+  RosenbrockW2(std::shared_ptr<Operator> const operator_in, SolverData const & solver_data_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      solver_data(solver_data_in),
+      gamma(1.0 + 1.0 / std::sqrt(2.0)),
+      n_iterations(0)
+  {
+    this->underlying_operator->initialize_dof_vector(f_n);
+    this->underlying_operator->initialize_dof_vector(k_1);
+    this->underlying_operator->initialize_dof_vector(k_2);
+    this->underlying_operator->initialize_dof_vector(rhs);
+    this->underlying_operator->initialize_dof_vector(linearization_point);
+    this->underlying_operator->initialize_dof_vector(perturbed_solution);
+    this->underlying_operator->initialize_dof_vector(perturbed_evaluation);
+  }
+
+  void
+  solve_timestep(VectorType & dst,
+                 VectorType & src,
+                 double const time,
+                 double const time_step) final
+  {
+    if(this->estimate_error and
+       not this->error_estimate.partitioners_are_globally_compatible(*src.get_partitioner()))
+    {
+      this->error_estimate.reinit(dst);
+    }
+
+    linearization_point = src;
+    linearization_time  = time;
+    system_factor       = gamma * time_step;
+
+    // stage 1
+    this->underlying_operator->evaluate(f_n, src, time);
+    n_iterations += solve(k_1, f_n);
+
+    // stage 2
+    dst = src;
+    dst.add(time_step, k_1);
+    this->underlying_operator->evaluate(rhs, dst, time + time_step);
+    rhs.add(-2.0, k_1);
+    n_iterations += solve(k_2, rhs);
+
+    // u_{n+1} = u_n + 3/2 dt k_1 + 1/2 dt k_2
+    dst = src;
+    dst.add(1.5 * time_step, k_1, 0.5 * time_step, k_2);
+
+    // difference to the linearly implicit Euler method u_n + dt k_1
+    if(this->estimate_error)
+      this->error_estimate.equ(0.5 * time_step, k_1, 0.5 * time_step, k_2);
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return 2;
+  }
+
+  bool
+  has_embedded_scheme() const final
+  {
+    return true;
+  }
+
+  unsigned int
+  get_order_embedded_scheme() const final
+  {
+    return 1;
+  }
+
+  /*
+   * Accumulated number of GMRES iterations of all time steps.
+   */
+  unsigned int
+  get_n_iterations() const
+  {
+    return n_iterations;
+  }
+
+  /*
+   * Applies the system matrix (I - gamma dt J) of the current time step, needed by GMRES.
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    double const src_norm = src.l2_norm();
+
+    dst = src;
+
+    if(src_norm == 0.0)
+      return;
+
+    double const epsilon = std::sqrt(std::numeric_limits<Number>::epsilon()) *
+                           (1.0 + linearization_point.l2_norm()) / src_norm;
+
+    perturbed_solution = linearization_point;
+    perturbed_solution.add(epsilon, src);
+
+    this->underlying_operator->evaluate(perturbed_evaluation,
+                                        perturbed_solution,
+                                        linearization_time);
+
+    // dst = src - gamma dt (F(u_n + eps src) - F(u_n)) / eps
+    dst.add(-system_factor / epsilon, perturbed_evaluation, system_factor / epsilon, f_n);
+  }
+
+private:
+  unsigned int
+  solve(VectorType & dst, VectorType const & b)
+  {
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.abs_tol,
+                                            solver_data.rel_tol);
+
+    typename dealii::SolverGMRES<VectorType>::AdditionalData additional_data;
+    additional_data.max_n_tmp_vectors = solver_data.max_krylov_size;
+
+    dealii::SolverGMRES<VectorType> solver(solver_control, additional_data);
+
+    dst = 0.0;
+    solver.solve(*this, dst, b, dealii::PreconditionIdentity());
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    return solver_control.last_step();
+  }
+
+  SolverData const solver_data;
+
+  double const gamma;
+
+  unsigned int n_iterations;
+
+  // Jacobian of the current time step is evaluated at (linearization_point, linearization_time)
+  VectorType linearization_point;
+  double     linearization_time = 0.0;
+  double     system_factor      = 0.0;
+
+  VectorType f_n;
+  VectorType k_1;
+  VectorType k_2;
+  VectorType rhs;
+
+  mutable VectorType perturbed_solution;
+  mutable VectorType perturbed_evaluation;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_ROSENBROCK_H_ */
@@ -40,6 +40,7 @@ struct SolverInfoData
     : interval_time(std::numeric_limits<double>::max()),
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
+      print_memory_consumption(false),
       counter(0),
       do_output_in_this_time_step(false),
       old_time_step_number(0)
@@ -53,6 +54,7 @@ struct SolverInfoData
     print_parameter(pcout, "Interval physical time", interval_time);
     print_parameter(pcout, "Interval wall time", interval_wall_time);
     print_parameter(pcout, "Interval time steps", interval_time_steps);
+    print_parameter(pcout, "Print memory consumption", print_memory_consumption);
   }
 
   bool
@@ -104,6 +106,9 @@ struct SolverInfoData
   // number of time steps after which to write restart
   unsigned int interval_time_steps;
 
+  // print the memory report (see MemoryReport) together with the solver information
+  bool print_memory_consumption;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 
@@ -0,0 +1,120 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature_lib.h>
+
+// ExaDG
+#include <exadg/time_integration/spectral_deferred_correction_constants.h>
+
+namespace ExaDG
+{
+SpectralDeferredCorrectionConstants::SpectralDeferredCorrectionConstants(unsigned int const order)
+  : order(order), n_sweeps(order)
+{
+  AssertThrow(order >= 1 and order <= 8,
+              dealii::ExcMessage("Specified order of spectral deferred correction not "
+                                 "implemented."));
+
+  // M + 1 Gauss-Lobatto nodes give order 2M, at least two nodes are needed
+  unsigned int const n_nodes = std::max(2U, (order + 1) / 2 + 1);
+
+  dealii::QGaussLobatto<1> const lobatto(n_nodes);
+  nodes.resize(n_nodes);
+  for(unsigned int m = 0; m < n_nodes; ++m)
+    nodes[m] = lobatto.point(m)[0];
+
+  // integrals of the Lagrange polynomials of degree n_nodes - 1 between neighboring nodes, which
+  // are integrated exactly by Gauss quadrature with n_nodes points
+  dealii::QGauss<1> const gauss(n_nodes);
+
+  integration_matrix.resize(n_nodes - 1, std::vector<double>(n_nodes, 0.0));
+  for(unsigned int m = 0; m < n_nodes - 1; ++m)
+  {
+    double const length = nodes[m + 1] - nodes[m];
+    for(unsigned int q = 0; q < gauss.size(); ++q)
+    {
+      double const s = nodes[m] + length * gauss.point(q)[0];
+
+      for(unsigned int j = 0; j < n_nodes; ++j)
+      {
+        double lagrange = 1.0;
+        for(unsigned int i = 0; i < n_nodes; ++i)
+          if(i != j)
+            lagrange *= (s - nodes[i]) / (nodes[j] - nodes[i]);
+
+        integration_matrix[m][j] += length * gauss.weight(q) * lagrange;
+      }
+    }
+  }
+}
+
+unsigned int
+SpectralDeferredCorrectionConstants::get_order() const
+{
+  return order;
+}
+
+unsigned int
+SpectralDeferredCorrectionConstants::get_n_nodes() const
+{
+  return nodes.size();
+}
+
+unsigned int
+SpectralDeferredCorrectionConstants::get_n_sweeps() const
+{
+  return n_sweeps;
+}
+
+double
+SpectralDeferredCorrectionConstants::get_node(unsigned int const m) const
+{
+  AssertIndexRange(m, nodes.size());
+
+  return nodes[m];
+}
+
+double
+SpectralDeferredCorrectionConstants::get_integration_weight(unsigned int const m,
+                                                            unsigned int const j) const
+{
+  AssertIndexRange(m, integration_matrix.size());
+  AssertIndexRange(j, nodes.size());
+
+  return integration_matrix[m][j];
+}
+
+void
+SpectralDeferredCorrectionConstants::print(dealii::ConditionalOStream & pcout) const
+{
+  pcout << "Spectral deferred correction with " << get_n_nodes() << " Gauss-Lobatto nodes and "
+        << n_sweeps << " sweeps" << std::endl;
+
+  for(unsigned int m = 0; m < get_n_nodes(); ++m)
+    pcout << "tau[" << m << "] = " << nodes[m] << std::endl;
+}
+
+} // namespace ExaDG
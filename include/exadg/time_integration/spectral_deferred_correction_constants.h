@@ -0,0 +1,87 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_SPECTRAL_DEFERRED_CORRECTION_CONSTANTS_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_SPECTRAL_DEFERRED_CORRECTION_CONSTANTS_H_
+
+// C/C++
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+
+namespace ExaDG
+{
+/**
+ * Class that manages the collocation nodes and the integration matrix of spectral deferred
+ * correction (SDC) methods (Dutt, Greengard, Rokhlin (2000), "Spectral deferred correction methods
+ * for ordinary differential equations"). The time step [t^n, t^n + dt] is subdivided by the
+ * Gauss-Lobatto nodes t_m = t^n + tau_m dt, m = 0, ..., M, and the integration matrix contains
+ *
+ *  S_mj = int_{tau_m}^{tau_{m+1}} l_j(s) ds,
+ *
+ * with the Lagrange polynomials l_j through the nodes, i.e., the integral of the collocation
+ * polynomial of f from t_m to t_{m+1} is dt sum_j S_mj f(t_j).
+ *
+ * Starting from the initial value spread to all nodes, each sweep increases the order by one up
+ * to the order 2M of the underlying collocation scheme. For a given order, the number of nodes is
+ * chosen as the minimum number of Gauss-Lobatto nodes providing this order, and the number of
+ * sweeps equals the order.
+ */
+class SpectralDeferredCorrectionConstants
+{
+public:
+  SpectralDeferredCorrectionConstants(unsigned int const order);
+
+  unsigned int
+  get_order() const;
+
+  /*
+   * Number of nodes including both end points, i.e., M + 1.
+   */
+  unsigned int
+  get_n_nodes() const;
+
+  unsigned int
+  get_n_sweeps() const;
+
+  double
+  get_node(unsigned int const m) const;
+
+  double
+  get_integration_weight(unsigned int const m, unsigned int const j) const;
+
+  void
+  print(dealii::ConditionalOStream & pcout) const;
+
+private:
+  unsigned int const order;
+
+  unsigned int n_sweeps;
+
+  std::vector<double> nodes;
+
+  std::vector<std::vector<double>> integration_matrix;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_SPECTRAL_DEFERRED_CORRECTION_CONSTANTS_H_ */
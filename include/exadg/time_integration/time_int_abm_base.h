@@ -25,6 +25,9 @@
 
 #include <exadg/time_integration/ab_constants.h>
 #include <exadg/time_integration/am_constants.h>
+#include <exadg/time_integration/exponential_integrator.h>
+#include <exadg/time_integration/linear_combination.h>
+#include <exadg/time_integration/multirate_adams_bashforth.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_int_multistep_base.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -88,6 +91,34 @@ public:
     return solution;
   }
 
+  /*
+   * Replaces the Adams--Bashforth--Moulton method by the multirate Adams--Bashforth method of the
+   * same order with n_substeps sub-steps on the fine level, see MultirateAdamsBashforth. This
+   * function has to be called before setup(). The operator has to provide the functions required
+   * by MultirateAdamsBashforth.
+   */
+  void
+  enable_local_time_stepping(unsigned int const n_substeps)
+  {
+    multirate_ab = std::make_shared<MultirateAdamsBashforth<Operator, VectorType>>(pde_operator,
+                                                                                   am.get_order(),
+                                                                                   n_substeps);
+  }
+
+  /*
+   * Replaces the Adams--Bashforth--Moulton method by the exponential integrator, see
+   * ExponentialIntegrator, which requires the operator to be affine with a time-independent linear
+   * part. This function has to be called before setup().
+   */
+  void
+  enable_exponential_integrator(unsigned int const krylov_dimension, double const tolerance)
+  {
+    exponential_integrator =
+      std::make_shared<ExponentialIntegrator<Operator, VectorType>>(pde_operator,
+                                                                    krylov_dimension,
+                                                                    tolerance);
+  }
+
 protected:
   Operator const &
   get_underlying_operator() const
@@ -112,6 +143,20 @@ private:
     pde_operator->initialize_dof_vector(evaluated_operator_np);
     for(auto & evaluated_operator : vec_evaluated_operators)
       pde_operator->initialize_dof_vector(evaluated_operator);
+
+    if(multirate_ab)
+      multirate_ab->initialize();
+
+    if(exponential_integrator)
+      exponential_integrator->initialize();
+  }
+
+  std::size_t
+  memory_consumption_vectors() const final
+  {
+    return solution.memory_consumption() + prediction.memory_consumption() +
+           evaluated_operator_np.memory_consumption() +
+           dealii::MemoryConsumption::memory_consumption(vec_evaluated_operators);
   }
 
   void
@@ -180,11 +225,61 @@ private:
     timer_tree->insert({"Timeloop", "Adams-Bashforth-Moulton"}, timer.wall_time());
   }
 
+  void
+  do_timestep_multirate()
+  {
+    dealii::Timer timer;
+    timer.restart();
+
+    multirate_ab->solve_timestep(solution, get_time(), get_time_step_size());
+
+    // write output
+    if(this->print_solver_info() and not(this->is_test))
+    {
+      pcout << std::endl
+            << "Multirate Adams-Bashforth (" << multirate_ab->get_n_substeps() << " sub-steps):";
+      print_wall_time(pcout, timer.wall_time());
+    }
+
+    timer_tree->insert({"Timeloop", "Multirate Adams-Bashforth"}, timer.wall_time());
+  }
+
+  void
+  do_timestep_exponential()
+  {
+    dealii::Timer timer;
+    timer.restart();
+
+    exponential_integrator->solve_timestep(solution, get_time(), get_time_step_size());
+
+    // write output
+    if(this->print_solver_info() and not(this->is_test))
+    {
+      pcout << std::endl
+            << "Exponential integrator (" << exponential_integrator->get_n_evaluations()
+            << " operator evaluations):";
+      print_wall_time(pcout, timer.wall_time());
+    }
+
+    timer_tree->insert({"Timeloop", "Exponential integrator"}, timer.wall_time());
+  }
+
   void
   do_timestep_solve() final
   {
-    do_timestep_predict();
-    do_timestep_correct();
+    if(multirate_ab)
+    {
+      do_timestep_multirate();
+    }
+    else if(exponential_integrator)
+    {
+      do_timestep_exponential();
+    }
+    else
+    {
+      do_timestep_predict();
+      do_timestep_correct();
+    }
   }
 
   void
@@ -192,9 +287,18 @@ private:
                    VectorType const &              op_np,
                    std::vector<VectorType> const & ops) const
   {
-    dst.add(static_cast<Number>(get_time_step_size() * am.get_gamma0()), op_np);
+    std::vector<double>             factors(this->am.get_order());
+    std::vector<VectorType const *> vectors(this->am.get_order());
+
+    factors[0] = get_time_step_size() * am.get_gamma0();
+    vectors[0] = &op_np;
     for(unsigned int i = 0; i < this->am.get_order() - 1; ++i)
-      dst.add(static_cast<Number>(get_time_step_size() * am.get_alpha(i)), ops[i]);
+    {
+      factors[i + 1] = get_time_step_size() * am.get_alpha(i);
+      vectors[i + 1] = &ops[i];
+    }
+
+    compute_linear_combination(dst, factors, vectors, true);
   }
 
   void
@@ -202,9 +306,18 @@ private:
                     VectorType const &              src,
                     std::vector<VectorType> const & ops) const
   {
-    dst = src;
+    std::vector<double>             factors(this->ab.get_order() + 1);
+    std::vector<VectorType const *> vectors(this->ab.get_order() + 1);
+
+    factors[0] = 1.0;
+    vectors[0] = &src;
     for(unsigned int i = 0; i < this->ab.get_order(); ++i)
-      dst.add(static_cast<Number>(get_time_step_size() * ab.get_alpha(i)), ops[i]);
+    {
+      factors[i + 1] = get_time_step_size() * ab.get_alpha(i);
+      vectors[i + 1] = &ops[i];
+    }
+
+    compute_linear_combination(dst, factors, vectors);
   }
 
   void
@@ -252,6 +365,12 @@ private:
   // store evaluated operators from previous time steps
   VectorType              evaluated_operator_np;
   std::vector<VectorType> vec_evaluated_operators;
+
+  // local time stepping
+  std::shared_ptr<MultirateAdamsBashforth<Operator, VectorType>> multirate_ab;
+
+  // exponential integration
+  std::shared_ptr<ExponentialIntegrator<Operator, VectorType>> exponential_integrator;
 };
 
 } // namespace ExaDG
@@ -20,6 +20,7 @@
  */
 
 #include <exadg/time_integration/time_int_base.h>
+#include <exadg/utilities/memory_report.h>
 #include <iostream>
 
 namespace ExaDG
@@ -40,7 +41,10 @@ TimeIntBase::TimeIntBase(double const &      start_time_,
     restart_data(restart_data_),
     mpi_comm(mpi_comm_),
     timer_tree(new TimerTree()),
-    is_test(is_test_)
+    is_test(is_test_),
+    defer_time_step_reduction(false),
+    state_transfer(false),
+    postprocessing_pending(false)
 {
 }
 
@@ -63,6 +67,8 @@ TimeIntBase::timeloop()
   {
     advance_one_timestep();
   }
+
+  wait_for_restart_output();
 }
 
 void
@@ -114,6 +120,14 @@ TimeIntBase::advance_one_timestep_solve()
 
 void
 TimeIntBase::advance_one_timestep_post_solve()
+{
+  advance_one_timestep_post_solve_update();
+
+  advance_one_timestep_post_solve_postprocessing();
+}
+
+void
+TimeIntBase::advance_one_timestep_post_solve_update()
 {
   dealii::Timer timer;
   timer.restart();
@@ -122,7 +136,7 @@ TimeIntBase::advance_one_timestep_post_solve()
   {
     do_timestep_post_solve();
 
-    postprocessing();
+    postprocessing_pending = true;
   }
   else
   {
@@ -133,6 +147,28 @@ TimeIntBase::advance_one_timestep_post_solve()
   timer_tree->insert({"Timeloop"}, timer.wall_time());
 }
 
+void
+TimeIntBase::advance_one_timestep_post_solve_postprocessing()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  if(postprocessing_pending)
+  {
+    postprocessing();
+
+    postprocessing_pending = false;
+  }
+
+  timer_tree->insert({"Timeloop"}, timer.wall_time());
+}
+
+void
+TimeIntBase::enable_deferred_time_step_reduction()
+{
+  defer_time_step_reduction = true;
+}
+
 void
 TimeIntBase::reset_time(double const & current_time)
 {
@@ -209,16 +245,125 @@ TimeIntBase::write_restart() const
           << std::endl
           << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
 
-    std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+    AssertThrow(not restart_data.partition_independent or
+                  supports_partition_independent_restart(),
+                dealii::ExcMessage(
+                  "Partition-independent restart is not implemented for this time integrator."));
 
-    rename_restart_files(filename);
+    AssertThrow(not restart_data.asynchronous or
+                  not(restart_data.shared_file or restart_data.partition_independent),
+                dealii::ExcMessage("Asynchronous restart output requires one file per process, "
+                                   "since MPI-IO is not called from a background thread."));
 
-    do_write_restart(restart_filename(restart_data.filename, mpi_comm));
+    // the previous restart file has to be complete before writing the next one
+    wait_for_restart_output();
+
+    if(restart_data.asynchronous)
+    {
+      // The serialized data serves as staging buffer, i.e., the solution vectors may change while
+      // the buffer is written to file.
+      RestartBuffer buffer;
+      serialize_restart_data(buffer);
+
+      std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+
+      restart_output = std::async(std::launch::async, [buffer = std::move(buffer), filename]() {
+        write_restart_file_and_rotate(buffer, filename);
+      });
+    }
+    else if(restart_data.shared_file or restart_data.partition_independent)
+    {
+      // the size of the data has to be known before writing to the shared file
+      RestartBuffer buffer;
+      serialize_restart_data(buffer);
+
+      std::string const filename = restart_filename_shared(restart_data.filename);
+
+      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+        rename_restart_files(filename);
+
+      int const ierr = MPI_Barrier(mpi_comm);
+      AssertThrowMPI(ierr);
+
+      write_restart_file_shared(buffer, filename, mpi_comm);
+    }
+    else
+    {
+      std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+
+      rename_restart_files(filename);
+
+      // serialize directly into the file without buffering the data in memory
+      std::ofstream stream(filename, std::ios::binary);
+      do_write_restart(stream);
+
+      AssertThrow(stream.good(), dealii::ExcMessage("Could not write file: " + filename));
+    }
 
     pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
   }
 }
 
+void
+TimeIntBase::serialize_restart_data(RestartBuffer & buffer) const
+{
+  RestartBufferOutStream stream(buffer);
+
+  do_write_restart(stream);
+
+  // write the data remaining in the stream buffer into the restart buffer
+  stream.flush();
+}
+
+void
+TimeIntBase::transfer_state(TimeIntBase & target) const
+{
+  AssertThrow(supports_partition_independent_restart() and
+                target.supports_partition_independent_restart(),
+              dealii::ExcMessage(
+                "The transfer of the state requires the partition-independent restart format, "
+                "which is not implemented for this time integrator."));
+
+  pcout << std::endl
+        << print_horizontal_line() << std::endl
+        << std::endl
+        << " Transferring solution at time t = " << time << " to new time integrator:" << std::endl;
+
+  RestartBuffer buffer;
+
+  state_transfer = true;
+  serialize_restart_data(buffer);
+  state_transfer = false;
+
+  RestartBufferInStream in(buffer.data(), buffer.size());
+
+  target.state_transfer = true;
+  target.do_read_restart(in);
+  target.finalize_read_restart();
+  target.state_transfer = false;
+
+  pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
+}
+
+bool
+TimeIntBase::use_cellwise_restart_format() const
+{
+  return restart_data.partition_independent or state_transfer;
+}
+
+bool
+TimeIntBase::state_transfer_in_progress() const
+{
+  return state_transfer;
+}
+
+void
+TimeIntBase::wait_for_restart_output() const
+{
+  if(restart_output.valid())
+    restart_output.get();
+}
+
 void
 TimeIntBase::read_restart()
 {
@@ -227,11 +372,42 @@ TimeIntBase::read_restart()
         << std::endl
         << " Reading restart file:" << std::endl;
 
-  std::string   filename = restart_filename(restart_data.filename, mpi_comm);
-  std::ifstream in(filename);
-  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+  if(restart_data.partition_independent)
+  {
+    AssertThrow(supports_partition_independent_restart(),
+                dealii::ExcMessage(
+                  "Partition-independent restart is not implemented for this time integrator."));
+
+    // the data written by one process of the original run might be read by several processes
+    std::vector<RestartBuffer> const blocks =
+      read_restart_file_shared_blocks(restart_filename_shared(restart_data.filename), mpi_comm);
+
+    for(auto const & block : blocks)
+    {
+      RestartBufferInStream in(block.data(), block.size());
+
+      do_read_restart(in);
+    }
+  }
+  else if(restart_data.shared_file)
+  {
+    RestartBuffer const buffer =
+      read_restart_file_shared(restart_filename_shared(restart_data.filename), mpi_comm);
 
-  do_read_restart(in);
+    RestartBufferInStream in(buffer.data(), buffer.size());
+
+    do_read_restart(in);
+  }
+  else
+  {
+    std::string   filename = restart_filename(restart_data.filename, mpi_comm);
+    std::ifstream in(filename, std::ios::binary);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+    do_read_restart(in);
+  }
+
+  finalize_read_restart();
 
   pcout << std::endl
         << " ... done!" << std::endl
@@ -277,4 +453,14 @@ TimeIntBase::output_remaining_time() const
   }
 }
 
+void
+TimeIntBase::output_memory_consumption(bool const print) const
+{
+  if(not(this->is_test))
+  {
+    if(dealii::Utilities::MPI::max(static_cast<unsigned int>(print), mpi_comm) == 1)
+      MemoryReport::get().print(pcout, mpi_comm);
+  }
+}
+
 } // namespace ExaDG
@@ -27,6 +27,7 @@
 #include <boost/archive/binary_oarchive.hpp>
 
 #include <fstream>
+#include <future>
 #include <sstream>
 
 // deal.II
@@ -54,6 +55,9 @@ public:
 
   virtual ~TimeIntBase()
   {
+    // do not leave the time integrator while a restart file is still being written
+    if(restart_output.valid())
+      restart_output.wait();
   }
 
   /*
@@ -99,6 +103,30 @@ public:
   void
   advance_one_timestep_post_solve();
 
+  /*
+   * The sub-routines of advance_one_timestep_post_solve(): the update of the solution and the time
+   * (including the calculation of the new time step size in case of adaptive time stepping), and
+   * the postprocessing of the solution. Calling them separately allows to do work in between,
+   * e.g., to overlap a reduction of the time step sizes of coupled solvers with the
+   * postprocessing.
+   */
+  void
+  advance_one_timestep_post_solve_update();
+
+  void
+  advance_one_timestep_post_solve_postprocessing();
+
+  /*
+   * In case of adaptive time stepping, the new time step size computed in
+   * advance_one_timestep_post_solve() is only the minimum over the locally owned cells of the
+   * current process if this function has been called, i.e., the reduction over all processes is
+   * skipped. The caller is then responsible for computing the minimum over all processes, e.g.
+   * combined with the time step sizes of other solvers in a single non-blocking reduction, and to
+   * set it via set_current_time_step_size() before the next time step.
+   */
+  void
+  enable_deferred_time_step_reduction();
+
   /*
    * Reset the current time.
    */
@@ -115,6 +143,17 @@ public:
   virtual void
   interpolate_after_coarsening_and_refinement();
 
+  /*
+   * Transfers the state of this time integrator, i.e., the current time, the time step sizes, and
+   * the solution history, to the time integrator target, which has been set up for the same
+   * triangulation. The state is serialized in memory in the format of the partition-independent
+   * restart, such that the spatial discretization of target may use a higher polynomial degree,
+   * see CellwiseRestartReader. This allows to start a simulation at low polynomial degree, e.g.,
+   * to wash out the initial condition, and to continue it at the production degree.
+   */
+  void
+  transfer_state(TimeIntBase & target) const;
+
   /*
    * Get the time step size.
    */
@@ -203,6 +242,38 @@ protected:
   void
   read_restart();
 
+  /*
+   * Called once after all restart data has been read, e.g., to assign partition-independent
+   * restart data to the DoF vectors (collective operation).
+   */
+  virtual void
+  finalize_read_restart()
+  {
+  }
+
+  /*
+   * Whether the time integrator writes its DoF vectors in a partition-independent way if
+   * requested by RestartData::partition_independent.
+   */
+  virtual bool
+  supports_partition_independent_restart() const
+  {
+    return false;
+  }
+
+  /*
+   * Whether the DoF vectors are serialized cell by cell, i.e., for a partition-independent restart
+   * or during transfer_state().
+   */
+  bool
+  use_cellwise_restart_format() const;
+
+  /*
+   * Whether the restart data is currently read or written by transfer_state().
+   */
+  bool
+  state_transfer_in_progress() const;
+
   /*
    * Output solver information before solving the time step.
    */
@@ -216,6 +287,24 @@ protected:
   void
   output_remaining_time() const;
 
+  /*
+   * Output the memory report (see MemoryReport) if print is true on any of the processes
+   * (collective operation). The decision is exchanged since the solver information, which the
+   * memory report accompanies, might be printed depending on the wall time of each process.
+   */
+  void
+  output_memory_consumption(bool const print) const;
+
+  /*
+   * Returns whether the memory report is printed together with the solver information, see
+   * SolverInfoData::print_memory_consumption.
+   */
+  virtual bool
+  print_memory_consumption() const
+  {
+    return false;
+  }
+
   /*
    * Start and end times.
    */
@@ -263,18 +352,49 @@ protected:
   std::shared_ptr<TimerTree> timer_tree;
   bool                       is_test;
 
+  /*
+   * Skip the reduction over all processes when recalculating the time step size, see
+   * enable_deferred_time_step_reduction().
+   */
+  bool defer_time_step_reduction;
+
 private:
   /*
-   * Write restart data.
+   * Write restart data, i.e., serialize the restart data into the stream, which is either the
+   * restart file itself or a buffer written to file(s) by write_restart().
    */
   virtual void
-  do_write_restart(std::string const & filename) const = 0;
+  do_write_restart(std::ostream & stream) const = 0;
+
+  /*
+   * Serializes the restart data into the buffer, see do_write_restart().
+   */
+  void
+  serialize_restart_data(RestartBuffer & buffer) const;
 
   /*
    * Read restart data.
    */
   virtual void
-  do_read_restart(std::ifstream & in) = 0;
+  do_read_restart(std::istream & in) = 0;
+
+  /*
+   * Waits until the restart file written in the background (RestartData::asynchronous) is
+   * complete, and rethrows exceptions that occurred while writing.
+   */
+  void
+  wait_for_restart_output() const;
+
+  mutable std::future<void> restart_output;
+
+  // see transfer_state()
+  mutable bool state_transfer;
+
+  /*
+   * Whether the postprocessing of the current time step is still to be done, see
+   * advance_one_timestep_post_solve_postprocessing().
+   */
+  bool postprocessing_pending;
 };
 
 } // namespace ExaDG
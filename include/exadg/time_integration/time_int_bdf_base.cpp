@@ -54,6 +54,27 @@ TimeIntBDFBase::get_scaling_factor_time_derivative_term() const
   return bdf.get_gamma0() / time_steps[0];
 }
 
+std::vector<double>
+TimeIntBDFBase::get_bdf_factors(unsigned int const n_vectors) const
+{
+  std::vector<double> factors(n_vectors);
+  for(unsigned int i = 0; i < n_vectors; ++i)
+    factors[i] = bdf.get_alpha(i) / time_steps[0];
+
+  return factors;
+}
+
+std::vector<double>
+TimeIntBDFBase::get_extrapolation_factors(unsigned int const n_vectors,
+                                          double const       scaling_factor) const
+{
+  std::vector<double> factors(n_vectors);
+  for(unsigned int i = 0; i < n_vectors; ++i)
+    factors[i] = scaling_factor * extra.get_beta(i);
+
+  return factors;
+}
+
 void
 TimeIntBDFBase::update_time_integrator_constants()
 {
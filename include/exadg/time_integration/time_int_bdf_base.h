@@ -25,6 +25,7 @@
 // ExaDG
 #include <exadg/time_integration/bdf_constants.h>
 #include <exadg/time_integration/extrapolation_constants.h>
+#include <exadg/time_integration/linear_combination.h>
 #include <exadg/time_integration/time_int_multistep_base.h>
 
 
@@ -50,6 +51,17 @@ protected:
   void
   update_time_integrator_constants() override;
 
+  /*
+   * Factors alpha_i/dt, i = 0, ..., n_vectors - 1, of the BDF time derivative term and factors
+   * scaling_factor * beta_i of the extrapolation scheme, to be used with
+   * compute_linear_combination() for the solution history.
+   */
+  std::vector<double>
+  get_bdf_factors(unsigned int const n_vectors) const;
+
+  std::vector<double>
+  get_extrapolation_factors(unsigned int const n_vectors, double const scaling_factor = 1.0) const;
+
   /*
    * Time integration constants. The extrapolation scheme is not necessarily used for a BDF time
    * integration scheme with fully implicit time stepping, implying a violation of the Liskov
@@ -19,6 +19,11 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+
+// ExaDG
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
 namespace ExaDG
@@ -38,7 +43,8 @@ TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &      start_time_,
                 mpi_comm_,
                 is_test_),
     time_step(1.0),
-    adaptive_time_stepping(adaptive_time_stepping_)
+    adaptive_time_stepping(adaptive_time_stepping_),
+    error_norm_last_accepted(-1.0)
 {
 }
 
@@ -56,6 +62,39 @@ TimeIntExplRKBase<Number>::set_current_time_step_size(double const & time_step_s
   time_step = time_step_size;
 }
 
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::propagate(VectorType &   solution,
+                                     double const & start_time_in,
+                                     double const & end_time_in,
+                                     double const & time_step_size)
+{
+  AssertThrow(end_time_in > start_time_in and time_step_size > 0.0,
+              dealii::ExcMessage("Invalid time interval or time step size."));
+
+  double const time_original      = this->time;
+  double const time_step_original = time_step;
+
+  unsigned int const n_time_steps =
+    std::max(1, static_cast<int>(std::ceil((end_time_in - start_time_in) / time_step_size - eps)));
+
+  time_step  = (end_time_in - start_time_in) / n_time_steps;
+  this->time = start_time_in;
+
+  solution_n = solution;
+  for(unsigned int i = 0; i < n_time_steps; ++i)
+  {
+    this->do_timestep_solve();
+
+    prepare_vectors_for_next_timestep();
+    this->time += time_step;
+  }
+  solution = solution_n;
+
+  this->time = time_original;
+  time_step  = time_step_original;
+}
+
 template<typename Number>
 void
 TimeIntExplRKBase<Number>::setup(bool const do_restart)
@@ -68,6 +107,8 @@ TimeIntExplRKBase<Number>::setup(bool const do_restart)
   // initialize global solution vectors (allocation)
   initialize_vectors();
 
+  memory_vectors.set(solution_n.memory_consumption() + solution_np.memory_consumption());
+
   if(do_restart)
   {
     // The solution vectors and the current time and the time step size have to be read from restart
@@ -113,10 +154,17 @@ TimeIntExplRKBase<Number>::do_timestep_post_solve()
     this->write_restart();
   }
 
-  if(this->print_solver_info())
+  bool const output_solver_info = this->print_solver_info();
+
+  if(output_solver_info)
   {
     this->output_remaining_time();
   }
+
+  if(this->print_memory_consumption())
+  {
+    this->output_memory_consumption(output_solver_info);
+  }
 }
 
 template<typename Number>
@@ -128,12 +176,71 @@ TimeIntExplRKBase<Number>::prepare_vectors_for_next_timestep()
 }
 
 template<typename Number>
-void
-TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
+double
+TimeIntExplRKBase<Number>::calculate_error_norm(VectorType const & error_estimate,
+                                                VectorType const & solution_old,
+                                                VectorType const & solution_new,
+                                                double const       abs_tol,
+                                                double const       rel_tol) const
 {
-  std::ostringstream oss;
+  double sum = 0.0;
+  for(unsigned int i = 0; i < error_estimate.locally_owned_size(); ++i)
+  {
+    double const scale =
+      abs_tol + rel_tol * std::max(std::abs(solution_old.local_element(i)),
+                                   std::abs(solution_new.local_element(i)));
+    double const error = error_estimate.local_element(i) / scale;
+    sum += error * error;
+  }
 
-  boost::archive::binary_oarchive oa(oss);
+  sum = dealii::Utilities::MPI::sum(sum, this->mpi_comm);
+
+  return std::sqrt(sum / static_cast<double>(error_estimate.size()));
+}
+
+template<typename Number>
+bool
+TimeIntExplRKBase<Number>::control_time_step_size(double const       error_norm,
+                                                  unsigned int const order_embedded_scheme,
+                                                  double const       factor_max,
+                                                  double &           time_step_new)
+{
+  AssertThrow(std::isfinite(error_norm),
+              dealii::ExcMessage("The error estimate of the time step is not finite."));
+
+  double const safety_factor = 0.9;
+
+  // avoid division by zero for vanishing errors
+  double const error = std::max(error_norm, 1.e-10);
+
+  double const k     = static_cast<double>(order_embedded_scheme + 1);
+  double const beta  = 0.4 / k;
+  double const alpha = 1.0 / k - 0.75 * beta;
+
+  bool const accepted = error <= 1.0;
+
+  double factor = safety_factor * std::pow(error, -alpha);
+  if(accepted)
+  {
+    // the proportional part requires the error of the last accepted time step
+    if(error_norm_last_accepted > 0.0)
+      factor *= std::pow(error_norm_last_accepted, beta);
+
+    error_norm_last_accepted = error;
+  }
+
+  factor = std::min(std::max(factor, 1.0 / factor_max), factor_max);
+
+  time_step_new = factor * this->time_step;
+
+  return accepted;
+}
+
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::do_write_restart(std::ostream & stream) const
+{
+  boost::archive::binary_oarchive oa(stream);
 
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
 
@@ -148,13 +255,11 @@ TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
 
   // 4. solution vectors
   oa << solution_n;
-
-  write_restart_file(oss, filename);
 }
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntExplRKBase<Number>::do_read_restart(std::istream & in)
 {
   boost::archive::binary_iarchive ia(in);
 
@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/time_integration/time_int_base.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -53,6 +54,18 @@ public:
   void
   set_current_time_step_size(double const & time_step_size) final;
 
+  /*
+   * Propagates the given solution from start_time_in to end_time_in with a constant time step size
+   * close to time_step_size that hits end_time_in, without postprocessing and restart output. This
+   * function allows to use the time integrator as propagator of parallel-in-time methods. The
+   * state of the time integrator is restored afterwards except for the solution vectors.
+   */
+  void
+  propagate(VectorType &   solution,
+            double const & start_time_in,
+            double const & end_time_in,
+            double const & time_step_size);
+
 protected:
   // solution vectors
   VectorType solution_n, solution_np;
@@ -63,6 +76,34 @@ protected:
   // use adaptive time stepping?
   bool const adaptive_time_stepping;
 
+  /*
+   * Weighted root-mean-square norm of the error estimate of an embedded Runge-Kutta scheme,
+   *
+   *   ||e|| = sqrt(1/N sum_i (e_i / (abs_tol + rel_tol * max(|u_old,i|, |u_new,i|)))^2),
+   *
+   * such that a time step is acceptable for ||e|| <= 1.
+   */
+  double
+  calculate_error_norm(VectorType const & error_estimate,
+                       VectorType const & solution_old,
+                       VectorType const & solution_new,
+                       double const       abs_tol,
+                       double const       rel_tol) const;
+
+  /*
+   * PI step size controller (Gustafsson (1991), Hairer, Wanner (1996), Section IV.2, "Solving
+   * Ordinary Differential Equations II") using the error norm of the current time step and the
+   * last accepted one. The time step is accepted for error_norm <= 1. Returns whether the time
+   * step is accepted and provides the time step size for the next step (accepted) or for
+   * repeating the current step (rejected). The exponents depend on the order of the embedded
+   * scheme. The change of the time step size is limited to [1/factor_max, factor_max].
+   */
+  bool
+  control_time_step_size(double const       error_norm,
+                         unsigned int const order_embedded_scheme,
+                         double const       factor_max,
+                         double &           time_step_new);
+
 private:
   void
   do_timestep_pre_solve(bool const print_header) final;
@@ -95,10 +136,17 @@ private:
   print_solver_info() const = 0;
 
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::ostream & stream) const final;
 
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::istream & in) final;
+
+  // error norm of the last accepted time step for the PI step size controller
+  double error_norm_last_accepted;
+
+  // memory of the solution vectors (the stage vectors of the Runge-Kutta schemes are not
+  // accounted for), see MemoryReport
+  MemoryReport::Entry memory_vectors{MemoryCategory::TimeIntegrationVectors};
 };
 
 } // namespace ExaDG
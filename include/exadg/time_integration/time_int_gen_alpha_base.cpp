@@ -208,10 +208,17 @@ TimeIntGenAlphaBase<Number>::do_timestep_post_solve()
     this->write_restart();
   }
 
-  if(this->print_solver_info())
+  bool const output_solver_info = this->print_solver_info();
+
+  if(output_solver_info)
   {
     this->output_remaining_time();
   }
+
+  if(this->print_memory_consumption())
+  {
+    this->output_memory_consumption(output_solver_info);
+  }
 }
 
 template class TimeIntGenAlphaBase<float>;
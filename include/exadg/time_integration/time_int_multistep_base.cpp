@@ -53,6 +53,8 @@ TimeIntMultistepBase::setup(bool const do_restart)
   // allocate global solution vectors
   allocate_vectors();
 
+  memory_vectors.set(memory_consumption_vectors());
+
   // initializes the solution and the time step size
   initialize_solution_and_time_step_size(do_restart);
 
@@ -232,25 +234,49 @@ TimeIntMultistepBase::do_timestep_post_solve()
     write_restart();
   }
 
-  if(this->print_solver_info())
+  bool const output_solver_info = this->print_solver_info();
+
+  if(output_solver_info)
   {
     output_remaining_time();
   }
+
+  if(this->print_memory_consumption())
+  {
+    this->output_memory_consumption(output_solver_info);
+  }
 }
 
 
 void
-TimeIntMultistepBase::do_read_restart(std::ifstream & in)
+TimeIntMultistepBase::do_read_restart(std::istream & in)
 {
   boost::archive::binary_iarchive ia(in);
   read_restart_preamble(ia);
   read_restart_vectors(ia);
+}
 
+void
+TimeIntMultistepBase::finalize_read_restart()
+{
   // In order to change the CFL number (or the time step calculation criterion in general),
   // start_with_low_order = true has to be used. Otherwise, the old solutions would not fit the
   // time step increments.
   if(start_with_low_order == true)
     time_steps[0] = calculate_time_step_size();
+
+  // After transfer_state(), the time step size of the new spatial discretization is used. The
+  // former time step sizes stem from the old discretization, which is only consistent if the time
+  // integrator constants account for variable time step sizes or if the time integrator restarts
+  // with first order.
+  if(state_transfer_in_progress() and start_with_low_order == false)
+  {
+    AssertThrow(adaptive_time_stepping,
+                dealii::ExcMessage("Transferring the state to a new time integrator requires "
+                                   "adaptive time stepping or start_with_low_order = true."));
+
+    time_steps[0] = calculate_time_step_size();
+  }
 }
 
 void
@@ -263,7 +289,7 @@ TimeIntMultistepBase::read_restart_preamble(boost::archive::binary_iarchive & ia
   ia &         n_old_ranks;
 
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
+  AssertThrow(n_old_ranks == n_ranks or use_cellwise_restart_format(),
               dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
                                  " processes, "
                                  "but restart was written on " +
@@ -288,15 +314,12 @@ TimeIntMultistepBase::read_restart_preamble(boost::archive::binary_iarchive & ia
 }
 
 void
-TimeIntMultistepBase::do_write_restart(std::string const & filename) const
+TimeIntMultistepBase::do_write_restart(std::ostream & stream) const
 {
-  std::ostringstream oss;
-
-  boost::archive::binary_oarchive oa(oss);
+  boost::archive::binary_oarchive oa(stream);
 
   write_restart_preamble(oa);
   write_restart_vectors(oa);
-  write_restart_file(oss, filename);
 }
 
 void
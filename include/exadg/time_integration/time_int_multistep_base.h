@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/time_integration/time_int_base.h>
+#include <exadg/utilities/memory_report.h>
 
 namespace ExaDG
 {
@@ -134,6 +135,12 @@ protected:
   virtual bool
   print_solver_info() const = 0;
 
+  /*
+   * Restart: update the time step size once all restart data has been read.
+   */
+  void
+  finalize_read_restart() override;
+
   /*
    * Order of time integration scheme.
    */
@@ -161,6 +168,13 @@ private:
   virtual void
   allocate_vectors() = 0;
 
+  /*
+   * Memory consumption of the vectors allocated in allocate_vectors() in bytes (has to be
+   * implemented by derived classes).
+   */
+  virtual std::size_t
+  memory_consumption_vectors() const = 0;
+
   /*
    * Initializes the solution vectors by prescribing initial conditions or reading data from
    * restart files and initializes the time step size.
@@ -210,7 +224,7 @@ private:
    * Restart: read solution vectors (has to be implemented in derived classes).
    */
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::istream & in) final;
 
   void
   read_restart_preamble(boost::archive::binary_iarchive & ia);
@@ -223,7 +237,7 @@ private:
    * state.
    */
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::ostream & stream) const final;
 
   void
   write_restart_preamble(boost::archive::binary_oarchive & oa) const;
@@ -236,6 +250,11 @@ private:
    */
   virtual double
   recalculate_time_step_size() const = 0;
+
+  /*
+   * Memory of the solution vectors, see MemoryReport.
+   */
+  MemoryReport::Entry memory_vectors{MemoryCategory::TimeIntegrationVectors};
 };
 
 } // namespace ExaDG
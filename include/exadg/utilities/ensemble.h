@@ -0,0 +1,204 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_ENSEMBLE_H_
+#define INCLUDE_EXADG_UTILITIES_ENSEMBLE_H_
+
+// C/C++
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/timer.h>
+
+namespace ExaDG
+{
+/*
+ * Ensemble runs execute many independent, small simulations (cases), each defined by its own
+ * input file, within one MPI job. The global communicator is split into groups of
+ * n_processes_per_case ranks, and the cases are assigned to the groups dynamically via a work
+ * queue: whenever a group has finished a case, it fetches the index of the next case that has not
+ * been started yet. Groups finishing early therefore take over more cases, which balances the
+ * load for cases of different costs.
+ */
+struct EnsembleParameters
+{
+  EnsembleParameters()
+  {
+  }
+
+  EnsembleParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    prm.enter_subsection("Ensemble");
+    {
+      prm.add_parameter("Cases",
+                        cases,
+                        "Comma-separated list of the input files of all cases.",
+                        dealii::Patterns::List(dealii::Patterns::FileName(),
+                                               1,
+                                               dealii::Patterns::List::max_int_value,
+                                               ","),
+                        true);
+      prm.add_parameter("ProcessesPerCase",
+                        n_processes_per_case,
+                        "Number of processes each case is run on.",
+                        dealii::Patterns::Integer(1),
+                        true);
+      prm.add_parameter("ReportFile",
+                        report_file,
+                        "Name of the CSV file to which the wall times of the cases are written.",
+                        dealii::Patterns::Anything(),
+                        true);
+    }
+    prm.leave_subsection();
+  }
+
+  std::vector<std::string> cases;
+
+  unsigned int n_processes_per_case = 1;
+
+  std::string report_file = "ensemble.csv";
+};
+
+/*
+ * Runs all cases of the ensemble, where run_case(input_file, group_comm) runs the simulation
+ * defined by the given input file on the communicator of the group. The counter of the work queue
+ * is stored on rank 0 of mpi_comm and is accessed by the first rank of each group via one-sided
+ * communication, so that no rank is reserved for the distribution of the cases. A report
+ * listing the group and the wall time of each case is written in CSV format.
+ */
+inline void
+run_ensemble(EnsembleParameters const &                                         ensemble,
+             std::function<void(std::string const &, MPI_Comm const &)> const & run_case,
+             MPI_Comm const &                                                   mpi_comm)
+{
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  AssertThrow(n_processes % ensemble.n_processes_per_case == 0,
+              dealii::ExcMessage("The number of processes has to be a multiple of "
+                                 "ProcessesPerCase."));
+
+  unsigned int const group = rank / ensemble.n_processes_per_case;
+
+  MPI_Comm group_comm;
+  int      ierr = MPI_Comm_split(mpi_comm, group, rank, &group_comm);
+  AssertThrowMPI(ierr);
+
+  bool const is_group_leader = dealii::Utilities::MPI::this_mpi_process(group_comm) == 0;
+
+  // counter of the work queue, i.e., index of the next case
+  unsigned int next_case = 0;
+  MPI_Win      window;
+  ierr = MPI_Win_create(&next_case,
+                        rank == 0 ? sizeof(unsigned int) : 0,
+                        sizeof(unsigned int),
+                        MPI_INFO_NULL,
+                        mpi_comm,
+                        &window);
+  AssertThrowMPI(ierr);
+
+  // tuples of the form (index of case, group, wall time)
+  std::vector<std::tuple<unsigned int, unsigned int, double>> results;
+
+  while(true)
+  {
+    unsigned int index = 0;
+    if(is_group_leader)
+    {
+      unsigned int const increment = 1;
+
+      ierr = MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, window);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Fetch_and_op(&increment, &index, MPI_UNSIGNED, 0, 0, MPI_SUM, window);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Win_unlock(0, window);
+      AssertThrowMPI(ierr);
+    }
+
+    ierr = MPI_Bcast(&index, 1, MPI_UNSIGNED, 0, group_comm);
+    AssertThrowMPI(ierr);
+
+    if(index >= ensemble.cases.size())
+      break;
+
+    if(is_group_leader)
+    {
+      std::cout << "Group " << group << " runs case " << index + 1 << " of "
+                << ensemble.cases.size() << ": " << ensemble.cases[index] << std::endl;
+    }
+
+    dealii::Timer timer;
+    timer.restart();
+
+    run_case(ensemble.cases[index], group_comm);
+
+    if(is_group_leader)
+      results.emplace_back(index, group, timer.wall_time());
+  }
+
+  // all groups have finished, i.e., the window is no longer accessed
+  ierr = MPI_Win_free(&window);
+  AssertThrowMPI(ierr);
+
+  ierr = MPI_Comm_free(&group_comm);
+  AssertThrowMPI(ierr);
+
+  std::vector<std::vector<std::tuple<unsigned int, unsigned int, double>>> const all_results =
+    dealii::Utilities::MPI::gather(mpi_comm, results, 0);
+
+  if(rank == 0)
+  {
+    std::vector<std::tuple<unsigned int, double>> wall_times(ensemble.cases.size());
+    for(auto const & results_rank : all_results)
+      for(auto const & [index, group_of_case, wall_time] : results_rank)
+        wall_times[index] = std::make_tuple(group_of_case, wall_time);
+
+    std::ofstream stream(ensemble.report_file);
+    AssertThrow(stream, dealii::ExcMessage("Could not open file " + ensemble.report_file));
+
+    stream << "case,input_file,group,wall_time" << std::endl;
+    for(unsigned int i = 0; i < ensemble.cases.size(); ++i)
+    {
+      stream << i << "," << ensemble.cases[i] << "," << std::get<0>(wall_times[i]) << ","
+             << std::scientific << std::setprecision(6) << std::get<1>(wall_times[i]) << std::endl;
+    }
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_ENSEMBLE_H_ */
@@ -58,6 +58,18 @@ struct GeneralParameters
                         "Set to true if the program is run as a test.",
                         dealii::Patterns::Bool(),
                         false);
+      prm.add_parameter("PerformanceReport",
+                        performance_report,
+                        "Name of the JSON file to which the performance data is written (no "
+                        "output if empty).",
+                        dealii::Patterns::Anything(),
+                        false);
+      prm.add_parameter("WorkPrecisionReport",
+                        work_precision_report,
+                        "Name of the CSV file to which the errors and wall times of all runs of "
+                        "a convergence study are written (no output if empty).",
+                        dealii::Patterns::Anything(),
+                        false);
     }
     prm.leave_subsection();
   }
@@ -67,6 +79,10 @@ struct GeneralParameters
   unsigned int dim = 2;
 
   bool is_test = false;
+
+  std::string performance_report = "";
+
+  std::string work_precision_report = "";
 };
 
 } // namespace ExaDG
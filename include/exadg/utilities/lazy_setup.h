@@ -0,0 +1,111 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_LAZY_SETUP_H_
+#define INCLUDE_EXADG_UTILITIES_LAZY_SETUP_H_
+
+// C/C++
+#include <functional>
+#include <string>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/timer.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Defers the setup of an object that is only needed in some code paths, e.g., a solver and its
+ * preconditioner, to its first use. Similar to lazy_ptr, the owner decides at which point the data
+ * behind the object becomes valid: The owner registers the setup function during its own setup
+ * and calls ensure_setup() before every use of the object. The setup function is executed at the
+ * first call only. Since the object is typically used inside collective operations such as linear
+ * solves, the first call happens on all processes simultaneously. Whether and how expensive the
+ * setup has been is reported by print(), which prints nothing if no setup has been registered.
+ */
+class LazySetup
+{
+public:
+  LazySetup() : is_done(false), wall_time(0.0)
+  {
+  }
+
+  void
+  initialize(std::string const & name_in, std::function<void()> const & setup_function_in)
+  {
+    name           = name_in;
+    setup_function = setup_function_in;
+    is_done        = false;
+    wall_time      = 0.0;
+  }
+
+  void
+  ensure_setup() const
+  {
+    if(is_done)
+      return;
+
+    AssertThrow(setup_function,
+                dealii::ExcMessage("Deferred setup of " + name + " has not been initialized."));
+
+    dealii::Timer timer;
+    timer.restart();
+
+    setup_function();
+
+    wall_time = timer.wall_time();
+    is_done   = true;
+  }
+
+  bool
+  is_set_up() const
+  {
+    return is_done;
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    if(not setup_function)
+      return;
+
+    if(is_done)
+      print_parameter(pcout, name + " [s]", wall_time);
+    else
+      print_parameter(pcout, name, std::string("not needed"));
+  }
+
+private:
+  std::string           name;
+  std::function<void()> setup_function;
+
+  mutable bool   is_done;
+  mutable double wall_time;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_LAZY_SETUP_H_ */
@@ -0,0 +1,190 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_MEMORY_REPORT_H_
+#define INCLUDE_EXADG_UTILITIES_MEMORY_REPORT_H_
+
+// C/C++
+#include <iomanip>
+#include <map>
+#include <string>
+#include <utility>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+// ExaDG
+#include <exadg/utilities/enum_utilities.h>
+
+namespace ExaDG
+{
+/*
+ * Subsystems distinguished in the memory report.
+ */
+enum class MemoryCategory
+{
+  MatrixFree,
+  TimeIntegrationVectors,
+  Multigrid,
+  VariableCoefficients,
+  BlockDiagonalMatrices,
+  Postprocessing
+};
+
+/*
+ * Accounts the memory of the large data structures of a simulation per subsystem, i.e., the
+ * MatrixFree objects of the PDE operators, the DoF vectors of the time integrators, the multigrid
+ * hierarchies (including the MatrixFree objects of the levels), the tables of variable
+ * coefficients, the matrices of block-diagonal preconditioners, and the DoF vectors of derived
+ * fields in postprocessing. The data structures register their memory consumption (in bytes,
+ * local to the process) via MemoryReport::Entry objects owned by the classes holding the data,
+ * such that the memory is accounted for as long as the data exists.
+ */
+class MemoryReport
+{
+public:
+  /*
+   * Memory consumption of one data structure. The entry is removed from the report when the
+   * object is destroyed. Copies of an entry are not registered until set() is called.
+   */
+  class Entry
+  {
+  public:
+    explicit Entry(MemoryCategory const category) : category(category)
+    {
+      // make sure that the report outlives the entry
+      MemoryReport::get();
+    }
+
+    Entry(Entry const & other) : category(other.category)
+    {
+    }
+
+    Entry &
+    operator=(Entry const &)
+    {
+      return *this;
+    }
+
+    ~Entry()
+    {
+      MemoryReport::get().entries.erase(this);
+    }
+
+    void
+    set(std::size_t const bytes)
+    {
+      MemoryReport::get().entries[this] = std::make_pair(category, bytes);
+    }
+
+  private:
+    MemoryCategory const category;
+  };
+
+  static MemoryReport &
+  get()
+  {
+    static MemoryReport report;
+    return report;
+  }
+
+  /*
+   * Memory consumption of the given category on the current process in bytes.
+   */
+  std::size_t
+  memory_consumption(MemoryCategory const category) const
+  {
+    std::size_t bytes = 0;
+    for(auto const & entry : entries)
+      if(entry.second.first == category)
+        bytes += entry.second.second;
+
+    return bytes;
+  }
+
+  /*
+   * Prints the minimum, average, and maximum memory consumption over all processes as well as the
+   * total memory consumption per category. The resident set size and its peak value of the
+   * processes are listed for comparison, the difference to the sum of the categories is the memory
+   * of the remaining data structures (e.g. the triangulation and the DoFHandlers) and of the
+   * libraries. This function has to be called by all processes of the communicator.
+   */
+  void
+  print(dealii::ConditionalOStream const & pcout, MPI_Comm const & mpi_comm) const
+  {
+    pcout << std::endl
+          << "Memory consumption [MB]:" << std::endl
+          << std::endl
+          << "  " << std::setw(28) << std::left << "Category" << std::setw(12) << std::right
+          << "min" << std::setw(12) << "avg" << std::setw(12) << "max" << std::setw(12) << "total"
+          << std::endl;
+
+    double sum = 0.0;
+    for(MemoryCategory const category : magic_enum::enum_values<MemoryCategory>())
+    {
+      double const memory = static_cast<double>(memory_consumption(category)) / 1.e6;
+      sum += memory;
+
+      print_line(pcout, Utilities::enum_to_string(category), memory, mpi_comm);
+    }
+
+    print_line(pcout, "Sum", sum, mpi_comm);
+
+    dealii::Utilities::System::MemoryStats stats;
+    dealii::Utilities::System::get_memory_stats(stats);
+
+    // the process memory is given in kB
+    print_line(pcout, "Process memory (VmRSS)", stats.VmRSS / 1.e3, mpi_comm);
+    print_line(pcout, "Peak process memory (VmHWM)", stats.VmHWM / 1.e3, mpi_comm);
+
+    pcout << std::defaultfloat;
+  }
+
+private:
+  MemoryReport()
+  {
+  }
+
+  static void
+  print_line(dealii::ConditionalOStream const & pcout,
+             std::string const &                name,
+             double const                       memory,
+             MPI_Comm const &                   mpi_comm)
+  {
+    dealii::Utilities::MPI::MinMaxAvg const data =
+      dealii::Utilities::MPI::min_max_avg(memory, mpi_comm);
+
+    pcout << "  " << std::setw(28) << std::left << name << std::right << std::scientific
+          << std::setprecision(3) << std::setw(12) << data.min << std::setw(12) << data.avg
+          << std::setw(12) << data.max << std::setw(12) << data.sum << std::endl;
+  }
+
+  // memory consumption (category, bytes) per registered entry
+  std::map<Entry const *, std::pair<MemoryCategory, std::size_t>> entries;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_MEMORY_REPORT_H_ */
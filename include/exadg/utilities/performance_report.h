@@ -0,0 +1,137 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_PERFORMANCE_REPORT_H_
+#define INCLUDE_EXADG_UTILITIES_PERFORMANCE_REPORT_H_
+
+// C/C++
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/*
+ * Collects the performance data printed at the end of a simulation, i.e., the average numbers of
+ * solver iterations (print_list_of_iterations()), the wall times of the timer tree (added by the
+ * drivers via add_wall_times()), and the throughput numbers (print_throughput_*()), in order to
+ * write them in machine-readable form (JSON) for regression tracking. There is one report per
+ * process, which is filled identically on all processes and written by rank 0. An entry added
+ * several times, e.g. in convergence studies consisting of several runs, holds the value of the
+ * last run.
+ */
+class PerformanceReport
+{
+public:
+  static PerformanceReport &
+  get()
+  {
+    static PerformanceReport report;
+    return report;
+  }
+
+  void
+  add(std::string const & section, std::string const & name, double const value)
+  {
+    sections[section][name] = value;
+  }
+
+  void
+  add_iterations(std::vector<std::string> const & names, std::vector<double> const & iterations)
+  {
+    for(unsigned int i = 0; i < iterations.size(); ++i)
+      add("iterations", names[i], iterations[i]);
+  }
+
+  void
+  add_wall_times(std::vector<std::pair<std::string, double>> const & wall_times)
+  {
+    for(auto const & wall_time : wall_times)
+      add("wall_times", wall_time.first, wall_time.second);
+  }
+
+  /*
+   * Writes the report as JSON object with one object per section, e.g.
+   * {"iterations": {"Pressure": 12.5}, "wall_times": {"Timeloop": 4.2e+01}}.
+   */
+  void
+  write_json(std::string const & filename, MPI_Comm const & mpi_comm) const
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+      return;
+
+    std::ofstream stream(filename);
+    AssertThrow(stream, dealii::ExcMessage("Could not open file " + filename));
+
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10) << "{";
+
+    for(auto section = sections.begin(); section != sections.end(); ++section)
+    {
+      stream << (section == sections.begin() ? "" : ",") << std::endl
+             << "  " << quote(section->first) << ": {";
+
+      for(auto entry = section->second.begin(); entry != section->second.end(); ++entry)
+      {
+        stream << (entry == section->second.begin() ? "" : ",") << std::endl
+               << "    " << quote(entry->first) << ": " << entry->second;
+      }
+
+      stream << std::endl << "  }";
+    }
+
+    stream << std::endl << "}" << std::endl;
+  }
+
+private:
+  PerformanceReport()
+  {
+  }
+
+  static std::string
+  quote(std::string const & in)
+  {
+    std::string out = "\"";
+    for(char const c : in)
+    {
+      if(c == '"' or c == '\\')
+        out += '\\';
+      out += c;
+    }
+    out += "\"";
+
+    return out;
+  }
+
+  std::map<std::string, std::map<std::string, double>> sections;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_PERFORMANCE_REPORT_H_ */
@@ -88,6 +88,32 @@ print_matrixfree_info(dealii::ConditionalOStream const & pcout)
   // clang-format on
 }
 
+/**
+ * Prints the load imbalance, i.e. the ratio of the maximum and the average sum of the cell weights
+ * over the processes, in case the triangulation has been partitioned with cell weights.
+ */
+template<int dim>
+inline void
+print_load_imbalance(dealii::ConditionalOStream const & pcout, Grid<dim> const & grid)
+{
+  if(not grid.cell_weight)
+    return;
+
+  double weight = 0.0;
+  for(auto const & cell : grid.triangulation->active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      weight += grid.cell_weight(cell);
+  }
+
+  dealii::Utilities::MPI::MinMaxAvg const weight_data =
+    dealii::Utilities::MPI::min_max_avg(weight, grid.triangulation->get_communicator());
+
+  print_parameter(pcout,
+                  "Load imbalance (max/avg cell weights)",
+                  weight_data.max / weight_data.avg);
+}
+
 template<int dim>
 inline void
 print_grid_info(dealii::ConditionalOStream const & pcout, Grid<dim> const & grid)
@@ -98,6 +124,8 @@ print_grid_info(dealii::ConditionalOStream const & pcout, Grid<dim> const & grid
 
   print_parameter(pcout, "Max. number of refinements", grid.triangulation->n_global_levels() - 1);
   print_parameter(pcout, "Number of cells", grid.triangulation->n_global_active_cells());
+
+  print_load_imbalance(pcout, grid);
 }
 
 template<typename Number>
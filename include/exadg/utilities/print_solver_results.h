@@ -31,6 +31,7 @@
 #include <deal.II/base/utilities.h>
 
 // ExaDG
+#include <exadg/utilities/performance_report.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -43,6 +44,13 @@ print_throughput(
 {
   unsigned int N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
+  for(auto const & wall_time : wall_times)
+  {
+    std::string const name = operator_type + ", k = " + std::to_string(std::get<0>(wall_time)) +
+                             ", DoFs = " + std::to_string(std::get<1>(wall_time));
+    PerformanceReport::get().add("throughput [DoFs/s]", name, std::get<2>(wall_time));
+  }
+
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
     // clang-format off
@@ -79,6 +87,14 @@ print_throughput_steady(dealii::ConditionalOStream const &    pcout,
                         double const                          overall_time_avg,
                         unsigned int const                    N_mpi_processes)
 {
+  PerformanceReport & report = PerformanceReport::get();
+  report.add("throughput", "Number of MPI processes", N_mpi_processes);
+  report.add("throughput", "Degrees of freedom", n_dofs);
+  report.add("throughput", "Wall time [s]", overall_time_avg);
+  report.add("throughput",
+             "Throughput [DoFs/s/core]",
+             n_dofs / (overall_time_avg * N_mpi_processes));
+
   // clang-format off
   pcout << std::endl
         << "Throughput:" << std::endl
@@ -98,6 +114,13 @@ print_throughput_10(dealii::ConditionalOStream const &    pcout,
 {
   double const tau_10 = t_10 * (double)N_mpi_processes / n_dofs;
 
+  PerformanceReport & report = PerformanceReport::get();
+  report.add("throughput", "Number of MPI processes", N_mpi_processes);
+  report.add("throughput", "Degrees of freedom", n_dofs);
+  report.add("throughput", "Wall time t_10 [s]", t_10);
+  report.add("throughput", "tau_10 [s*core/DoF]", tau_10);
+  report.add("throughput", "Throughput E_10 [DoF/s/core]", 1.0 / tau_10);
+
   // clang-format off
   pcout << std::endl
         << "Throughput of linear solver (numbers based on n_10):" << std::endl
@@ -119,6 +142,16 @@ print_throughput_unsteady(dealii::ConditionalOStream const &    pcout,
 {
   double const time_per_timestep = overall_time_avg / (double)N_time_steps;
 
+  PerformanceReport & report = PerformanceReport::get();
+  report.add("throughput", "Number of MPI processes", N_mpi_processes);
+  report.add("throughput", "Degrees of freedom", n_dofs);
+  report.add("throughput", "Wall time [s]", overall_time_avg);
+  report.add("throughput", "Time steps", N_time_steps);
+  report.add("throughput", "Wall time per time step [s]", time_per_timestep);
+  report.add("throughput",
+             "Throughput [DoFs/s/core]",
+             n_dofs / (time_per_timestep * N_mpi_processes));
+
   // clang-format off
   pcout << std::endl
         << "Throughput per time step:" << std::endl
@@ -141,6 +174,16 @@ print_throughput_unsteady(dealii::ConditionalOStream const & pcout,
 {
   double const time_per_timestep = overall_time_avg / (double)N_time_steps;
 
+  PerformanceReport & report = PerformanceReport::get();
+  report.add("throughput", "Number of MPI processes", N_mpi_processes);
+  report.add("throughput", "Average degrees of freedom", avg_n_dofs);
+  report.add("throughput", "Wall time [s]", overall_time_avg);
+  report.add("throughput", "Time steps", N_time_steps);
+  report.add("throughput", "Wall time per time step [s]", time_per_timestep);
+  report.add("throughput",
+             "Throughput [DoFs/s/core]",
+             avg_n_dofs / (time_per_timestep * N_mpi_processes));
+
   // clang-format off
   pcout << std::endl
         << "Throughput per time step:" << std::endl
@@ -220,6 +263,8 @@ print_list_of_iterations(dealii::ConditionalOStream const & pcout,
                          std::vector<std::string> const &   names,
                          std::vector<double> const &        iterations_avg)
 {
+  PerformanceReport::get().add_iterations(names, iterations_avg);
+
   unsigned int length = 1;
   for(unsigned int i = 0; i < names.size(); ++i)
   {
@@ -0,0 +1,166 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_PROFILING_H_
+#define INCLUDE_EXADG_UTILITIES_PROFILING_H_
+
+// likwid
+#ifdef EXADG_WITH_LIKWID
+#  include <likwid.h>
+#endif
+
+// C/C++
+#include <memory>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/timer.h>
+
+// ExaDG
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+/**
+ * Initializes the profiling backends enabled at configure time (currently LIKWID via
+ * EXADG_WITH_LIKWID) for the lifetime of this object. An object of this class is created at the
+ * beginning of main() after MPI has been initialized, such that the results of the backends are
+ * finalized before MPI.
+ */
+class ProfilingSession
+{
+public:
+  ProfilingSession()
+  {
+#ifdef EXADG_WITH_LIKWID
+    LIKWID_MARKER_INIT;
+#endif
+  }
+
+  ~ProfilingSession()
+  {
+#ifdef EXADG_WITH_LIKWID
+    LIKWID_MARKER_CLOSE;
+#endif
+  }
+};
+
+/**
+ * Scoped instrumentation region: the wall time between construction and destruction (or the call
+ * of stop()) is inserted into the timer tree under the given IDs, and the region is reported to the
+ * profiling backends enabled at configure time. For LIKWID, the name of the marker region is given
+ * by the IDs joined by ":", with spaces replaced by "_", e.g. "Multigrid:level_3:Pre-smoothing",
+ * such that hardware counters (memory bandwidth, flop rates) are attributed to the same code paths
+ * as the wall times.
+ *
+ * A disabled region (argument enabled = false or timer_tree = nullptr without backends) does
+ * neither measure the time nor call a backend, i.e., the overhead reduces to a branch.
+ */
+class ProfilingRegion
+{
+public:
+  ProfilingRegion(std::shared_ptr<TimerTree> const & timer_tree,
+                  std::vector<std::string> const &   ids_in,
+                  bool const                         enabled = true)
+    : timer_tree(timer_tree), active(false)
+  {
+#ifdef EXADG_WITH_LIKWID
+    active = enabled;
+#else
+    active = enabled and timer_tree != nullptr;
+#endif
+
+    if(active)
+    {
+      ids = ids_in;
+
+#ifdef EXADG_WITH_LIKWID
+      likwid_name = get_backend_name();
+      LIKWID_MARKER_START(likwid_name.c_str());
+#endif
+      timer.restart();
+    }
+  }
+
+  ProfilingRegion(ProfilingRegion const &) = delete;
+
+  ProfilingRegion &
+  operator=(ProfilingRegion const &) = delete;
+
+  ~ProfilingRegion()
+  {
+    stop();
+  }
+
+  /**
+   * Ends the region before the end of the scope. Subsequent calls have no effect.
+   */
+  void
+  stop()
+  {
+    if(active)
+    {
+      double const wall_time = timer.wall_time();
+
+#ifdef EXADG_WITH_LIKWID
+      LIKWID_MARKER_STOP(likwid_name.c_str());
+#endif
+
+      if(timer_tree != nullptr)
+        timer_tree->insert(ids, wall_time);
+
+      active = false;
+    }
+  }
+
+private:
+  std::string
+  get_backend_name() const
+  {
+    std::string name;
+    for(auto const & id : ids)
+      name += (name.empty() ? "" : ":") + id;
+
+    for(auto & c : name)
+      if(c == ' ')
+        c = '_';
+
+    return name;
+  }
+
+  std::shared_ptr<TimerTree> const timer_tree;
+
+  std::vector<std::string> ids;
+
+  bool active;
+
+  dealii::Timer timer;
+
+#ifdef EXADG_WITH_LIKWID
+  std::string likwid_name;
+#endif
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_PROFILING_H_ */
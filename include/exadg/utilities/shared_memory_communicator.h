@@ -0,0 +1,125 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_SHARED_MEMORY_COMMUNICATOR_H_
+#define INCLUDE_EXADG_UTILITIES_SHARED_MEMORY_COMMUNICATOR_H_
+
+// C/C++
+#include <map>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/*
+ * Provides the communicators of the processes sharing memory, i.e., the processes on the same
+ * compute node, to dealii::MatrixFree (AdditionalData::communicator_sm). With such a communicator,
+ * MatrixFree::initialize_dof_vector() allocates the vectors in MPI-3 shared-memory windows, and the
+ * matrix-free loops read the ghost values owned by processes on the same node directly from the
+ * window instead of copying them via MPI messages. Only MPI messages to other nodes remain.
+ *
+ * The usage is enabled once per process via enable() before the setup of the MatrixFree objects,
+ * and affects all MatrixFree objects set up via fill_additional_data(), including the ones of the
+ * multigrid levels, and hence the vectors of the time integrators and postprocessors, which are
+ * created from these MatrixFree objects. Vectors not created via initialize_dof_vector() (or via
+ * reinit() from such a vector) do not live in shared memory and must not be passed to the
+ * matrix-free loops.
+ *
+ * The shared-memory communicator is created once per parent communicator (which is a collective
+ * operation on the parent communicator) and freed when MPI is finalized.
+ */
+class SharedMemoryCommunicator
+{
+public:
+  static void
+  enable(bool const enable_in)
+  {
+    get_instance().is_enabled = enable_in;
+  }
+
+  static bool
+  enabled()
+  {
+    return get_instance().is_enabled;
+  }
+
+  /*
+   * Returns the communicator of the processes of comm on the same compute node.
+   */
+  static MPI_Comm
+  get(MPI_Comm const & comm)
+  {
+    std::map<MPI_Comm, MPI_Comm> & communicators = get_instance().communicators;
+
+    auto const it = communicators.find(comm);
+    if(it != communicators.end())
+      return it->second;
+
+    int const rank = dealii::Utilities::MPI::this_mpi_process(comm);
+
+    MPI_Comm comm_sm;
+    int const ierr = MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &comm_sm);
+    AssertThrowMPI(ierr);
+
+    communicators[comm] = comm_sm;
+
+    return comm_sm;
+  }
+
+  /*
+   * Sets the shared-memory communicator of the MatrixFree object if enabled.
+   */
+  template<typename AdditionalData>
+  static void
+  fill_additional_data(AdditionalData & data, MPI_Comm const & comm)
+  {
+    if(enabled())
+      data.communicator_sm = get(comm);
+  }
+
+private:
+  SharedMemoryCommunicator() : is_enabled(false)
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize::signals.at_mpi_finalize.connect([this]() {
+      for(auto & communicator : communicators)
+        MPI_Comm_free(&communicator.second);
+      communicators.clear();
+    });
+  }
+
+  static SharedMemoryCommunicator &
+  get_instance()
+  {
+    static SharedMemoryCommunicator instance;
+    return instance;
+  }
+
+  bool is_enabled;
+
+  std::map<MPI_Comm, MPI_Comm> communicators;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_SHARED_MEMORY_COMMUNICATOR_H_ */
@@ -57,6 +57,19 @@ public:
    */
   virtual Number
   compute_time_factor(double const time) const = 0;
+
+  /**
+   * Returns true if the function is zero at point p for all times. Functions with a compact
+   * support in space can override this function such that the evaluation of terms multiplied by
+   * this function can be skipped outside the support. The default implementation makes no
+   * assumption on the support.
+   */
+  virtual bool
+  vanishes_for_all_times(dealii::Point<dim> const & p) const
+  {
+    (void)p;
+    return false;
+  }
 };
 
 } // namespace Utilities
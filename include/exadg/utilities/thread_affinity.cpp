@@ -0,0 +1,111 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C/C++
+#include <vector>
+
+#ifdef __linux__
+#  include <sched.h>
+#endif
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+#ifdef DEAL_II_WITH_TBB
+#  include <tbb/task_arena.h>
+#  include <tbb/task_scheduler_observer.h>
+#endif
+
+// ExaDG
+#include <exadg/utilities/thread_affinity.h>
+
+namespace ExaDG
+{
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+namespace
+{
+/*
+ * Pins every thread that enters the task scheduler to one of the cores of the affinity mask the
+ * process has been started with.
+ */
+class ThreadPinningObserver : public tbb::task_scheduler_observer
+{
+public:
+  ThreadPinningObserver()
+  {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    AssertThrow(sched_getaffinity(0, sizeof(mask), &mask) == 0,
+                dealii::ExcMessage("Could not determine the affinity mask of the process."));
+
+    for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+      if(CPU_ISSET(cpu, &mask))
+        cpus.push_back(cpu);
+
+    observe(true);
+  }
+
+  void
+  on_scheduler_entry(bool const is_worker) override
+  {
+    (void)is_worker;
+
+    int const slot = tbb::this_task_arena::current_thread_index();
+    if(slot >= 0)
+      pin(slot);
+  }
+
+  /*
+   * Pins the calling thread.
+   */
+  void
+  pin(unsigned int const slot) const
+  {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpus[slot % cpus.size()], &mask);
+
+    AssertThrow(sched_setaffinity(0, sizeof(mask), &mask) == 0,
+                dealii::ExcMessage("Could not pin thread."));
+  }
+
+private:
+  std::vector<int> cpus;
+};
+
+} // namespace
+#endif
+
+void
+pin_threads()
+{
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+  static ThreadPinningObserver observer;
+
+  // the main thread occupies slot 0 of the task arena
+  observer.pin(0);
+#else
+  AssertThrow(false, dealii::ExcMessage("Pinning of threads requires deal.II with TBB and Linux."));
+#endif
+}
+
+} // namespace ExaDG
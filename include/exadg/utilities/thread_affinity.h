@@ -0,0 +1,102 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_THREAD_AFFINITY_H_
+#define INCLUDE_EXADG_UTILITIES_THREAD_AFFINITY_H_
+
+// C/C++
+#include <algorithm>
+#include <cstddef>
+
+// deal.II
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#ifdef DEAL_II_WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#  include <tbb/partitioner.h>
+#endif
+
+namespace ExaDG
+{
+/*
+ * Pins the threads of the TBB thread pool of this process, including the main thread, to the
+ * cores the process may run on, i.e., the cores assigned to the MPI rank by the launcher. The
+ * threads are assigned to the cores in the order of their slot in the task arena. Requires
+ * deal.II with TBB and Linux.
+ */
+void
+pin_threads();
+
+/*
+ * Applies the function f(begin, end) to the index range [0, size), which is split into
+ * contiguous chunks that are processed by the threads of this process. The chunks are assigned
+ * statically, such that a thread processes the same chunk in every call with the same size.
+ * Thereby, the pages of memory first touched within such a loop are placed on the NUMA domain of
+ * the thread that accesses them in the subsequent loops, provided that the threads are pinned.
+ */
+template<typename Function>
+void
+static_parallel_for(std::size_t const size, Function const & f)
+{
+#ifdef DEAL_II_WITH_TBB
+  // do not split the range into chunks smaller than a few pages of memory
+  std::size_t const min_chunk_size = 4096;
+
+  if(dealii::MultithreadInfo::n_threads() > 1 and size > min_chunk_size)
+  {
+    tbb::parallel_for(
+      tbb::blocked_range<std::size_t>(0, size, min_chunk_size),
+      [&](tbb::blocked_range<std::size_t> const & range) { f(range.begin(), range.end()); },
+      tbb::static_partitioner());
+
+    return;
+  }
+#endif
+
+  f(0, size);
+}
+
+/*
+ * Sets the locally owned and the ghost entries of a vector to zero, where the locally owned
+ * entries are touched by the threads in the chunks of static_parallel_for(). Used for vectors
+ * that have been allocated without zeroing, which would otherwise be touched first by the thread
+ * that happens to write them first.
+ */
+template<typename Number>
+void
+first_touch(dealii::LinearAlgebra::distributed::Vector<Number> & vector)
+{
+  Number * const data = vector.begin();
+
+  static_parallel_for(vector.locally_owned_size(),
+                      [&](std::size_t const begin, std::size_t const end) {
+                        std::fill(data + begin, data + end, Number(0.0));
+                      });
+
+  vector.zero_out_ghost_values();
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_THREAD_AFFINITY_H_ */
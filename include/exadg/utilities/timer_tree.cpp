@@ -35,6 +35,10 @@ TimerTree::TimerTree() : id("")
 {
 }
 
+TimerTree::TimerTree(std::string const & id) : id(id)
+{
+}
+
 void
 TimerTree::clear()
 {
@@ -193,6 +197,20 @@ TimerTree::print_level(dealii::ConditionalOStream const & pcout, unsigned int co
   }
 }
 
+void
+TimerTree::print_imbalance(dealii::ConditionalOStream const & pcout, unsigned int const level) const
+{
+  unsigned int const length = get_length();
+
+  pcout << std::endl
+        << std::setw(length) << std::left << "" << std::setw(12) << std::right << "min"
+        << std::setw(12) << std::right << "avg" << std::setw(12) << std::right << "max"
+        << std::setw(10) << std::right << "max rank" << std::setw(12) << std::right
+        << "imbalance" << std::endl;
+
+  do_print_imbalance(pcout, level, 0, length);
+}
+
 unsigned int
 TimerTree::get_max_level() const
 {
@@ -208,6 +226,48 @@ TimerTree::get_max_level() const
   return max_level;
 }
 
+std::vector<std::pair<std::string, double>>
+TimerTree::get_wall_times_of_children() const
+{
+  std::vector<std::pair<std::string, double>> wall_times;
+
+  for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
+  {
+    if((*it)->data.get() != nullptr)
+      wall_times.push_back(std::make_pair((*it)->id, (*it)->get_average_wall_time()));
+  }
+
+  return wall_times;
+}
+
+std::vector<std::pair<std::string, double>>
+TimerTree::get_average_wall_times() const
+{
+  std::vector<std::pair<std::string, double>> wall_times;
+
+  do_get_average_wall_times(wall_times, "");
+
+  return wall_times;
+}
+
+void
+TimerTree::do_get_average_wall_times(std::vector<std::pair<std::string, double>> & wall_times,
+                                     std::string const &                           prefix) const
+{
+  if(id.empty())
+    return;
+
+  std::string const path = prefix.empty() ? id : prefix + " / " + id;
+
+  if(data.get() != nullptr)
+    wall_times.push_back(std::make_pair(path, get_average_wall_time()));
+
+  for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
+  {
+    (*it)->do_get_average_wall_times(wall_times, path);
+  }
+}
+
 void
 TimerTree::copy_from(std::shared_ptr<TimerTree> other)
 {
@@ -306,6 +366,42 @@ TimerTree::do_print_level(dealii::ConditionalOStream const & pcout,
   }
 }
 
+void
+TimerTree::do_print_imbalance(dealii::ConditionalOStream const & pcout,
+                              unsigned int const                 level,
+                              unsigned int const                 offset,
+                              unsigned int const                 length) const
+{
+  if(id.empty())
+    return;
+
+  print_name(pcout, offset, length, false);
+
+  if(data.get())
+  {
+    dealii::Utilities::MPI::MinMaxAvg const time_data =
+      dealii::Utilities::MPI::min_max_avg(data->wall_time, MPI_COMM_WORLD);
+
+    double const imbalance = time_data.max > 0.0 ? 1.0 - time_data.avg / time_data.max : 0.0;
+
+    pcout << std::setprecision(precision) << std::scientific << std::setw(10) << std::right
+          << time_data.min << " s" << std::setw(10) << std::right << time_data.avg << " s"
+          << std::setw(10) << std::right << time_data.max << " s" << std::setw(10) << std::right
+          << time_data.max_index << std::setprecision(precision) << std::fixed << std::setw(10)
+          << std::right << imbalance * 100.0 << " %";
+  }
+
+  pcout << std::endl;
+
+  if(level > 0)
+  {
+    for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
+    {
+      (*it)->do_print_imbalance(pcout, level - 1, offset + offset_per_level, length);
+    }
+  }
+}
+
 void
 TimerTree::print_name(dealii::ConditionalOStream const & pcout,
                       unsigned int const                 offset,
@@ -25,6 +25,7 @@
 // C++
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // deal.II
@@ -40,6 +41,12 @@ public:
    */
   TimerTree();
 
+  /**
+   * Constructor. Initializes an empty tree with the given ID, e.g. as a root to which sub trees
+   * are attached via insert().
+   */
+  explicit TimerTree(std::string const & id);
+
   /**
    * This function clears the content of this tree. Sub trees inserted
    * into this tree via pointers to external trees are not touched.
@@ -88,12 +95,38 @@ public:
   void
   print_level(dealii::ConditionalOStream const & pcout, unsigned int const level) const;
 
+  /**
+   * Prints the statistics of the wall times over all MPI processes for all items of the tree up to
+   * the given level: the minimum, average and maximum wall time, the rank of the process with the
+   * maximum wall time, and the load imbalance 1 - t_avg / t_max. The load imbalance is the share of
+   * the wall time the average process waits for the slowest process at the next synchronization
+   * point, e.g. a ghost exchange or a reduction, and is hidden in the average wall times printed by
+   * print_plain() and print_level().
+   */
+  void
+  print_imbalance(dealii::ConditionalOStream const & pcout, unsigned int const level) const;
+
   /**
    * Returns the maximum number of levels of the timer tree.
    */
   unsigned int
   get_max_level() const;
 
+  /**
+   * Returns the IDs and the MPI-average wall times of those direct children of the root element
+   * for which a wall time has been inserted, e.g. the sub-steps of a time step.
+   */
+  std::vector<std::pair<std::string, double>>
+  get_wall_times_of_children() const;
+
+  /**
+   * Returns the MPI-average wall times of all items of the tree for which a wall time has been
+   * inserted, where the items are identified by the IDs from the root to the item separated by
+   * " / ", e.g. "Timeloop / Pressure step".
+   */
+  std::vector<std::pair<std::string, double>>
+  get_average_wall_times() const;
+
 private:
   /**
    * This function "copies" a tree, meaning that only the ID is copied, while
@@ -108,6 +141,14 @@ private:
   std::vector<std::string>
   erase_first(std::vector<std::string> const & in) const;
 
+  /**
+   * This function adds the wall times of the whole tree to wall_times, see
+   * get_average_wall_times(), where prefix is the path of the parent of this tree.
+   */
+  void
+  do_get_average_wall_times(std::vector<std::pair<std::string, double>> & wall_times,
+                            std::string const &                           prefix) const;
+
   /**
    * This function computes and returns the MPI-average wall time for the
    * underlying data object.
@@ -141,6 +182,16 @@ private:
                  unsigned int const                 offset,
                  unsigned int const                 length) const;
 
+  /**
+   * This function prints the wall time statistics of the whole tree up to a specified level, see
+   * print_imbalance().
+   */
+  void
+  do_print_imbalance(dealii::ConditionalOStream const & pcout,
+                     unsigned int const                 level,
+                     unsigned int const                 offset,
+                     unsigned int const                 length) const;
+
   /**
    * This function print the name ID of the root element of the present tree. The
    * boolean parameter new_line describes whether a line-break is applied after
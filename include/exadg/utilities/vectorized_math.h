@@ -0,0 +1,245 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_VECTORIZED_MATH_H_
+#define INCLUDE_EXADG_UTILITIES_VECTORIZED_MATH_H_
+
+// C/C++
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+/*
+ * Approximations of transcendental functions operating on all lanes of a VectorizedArray at once.
+ * The functions of the standard library called for a VectorizedArray fall back to a loop over the
+ * lanes, which dominates the cost of e.g. generalized Newtonian viscosity models. Here, the
+ * argument is reduced to a small interval by manipulating the exponent bits of the floating point
+ * representation, and the function is approximated by a truncated series on the reduced interval,
+ * which only requires vectorized additions, multiplications, and divisions.
+ */
+namespace VectorizedMath
+{
+namespace internal
+{
+template<typename Number>
+struct FloatingPointTraits;
+
+template<>
+struct FloatingPointTraits<double>
+{
+  typedef std::int64_t Integer;
+
+  static constexpr int n_mantissa_bits = 52;
+  static constexpr int exponent_bias   = 1023;
+
+  // exp(x) is evaluated for these bounds of the argument such that 2^k remains a normal number
+  static constexpr double min_exp_argument = -708.0;
+  static constexpr double max_exp_argument = 709.0;
+};
+
+template<>
+struct FloatingPointTraits<float>
+{
+  typedef std::int32_t Integer;
+
+  static constexpr int n_mantissa_bits = 23;
+  static constexpr int exponent_bias   = 127;
+
+  static constexpr double min_exp_argument = -87.0;
+  static constexpr double max_exp_argument = 88.0;
+};
+} // namespace internal
+
+/*
+ * Number of terms of the truncated series, chosen such that the truncation error is below the
+ * given tolerance: the relative error for exp(), the absolute error for log(). Tolerances below the
+ * machine precision of Number are replaced by the machine precision.
+ */
+template<typename Number>
+struct Accuracy
+{
+  Accuracy(double const tolerance_in = 1.e-12)
+  {
+    AssertThrow(tolerance_in > 0.0,
+                dealii::ExcMessage("Tolerance of the vectorized approximations has to be "
+                                   "positive."));
+
+    tolerance = std::max(tolerance_in, static_cast<double>(std::numeric_limits<Number>::epsilon()));
+
+    // exp(r) for |r| <= ln(2)/2: the remainder of the Taylor series with n terms is bounded by
+    // |r|^(n+1) / (n+1)! * exp(|r|)
+    double const r_max = 0.5 * std::log(2.0);
+    double       bound = std::sqrt(2.0) * r_max;
+    n_terms_exp        = 1;
+    while(bound > tolerance and n_terms_exp < max_n_terms)
+    {
+      ++n_terms_exp;
+      bound *= r_max / n_terms_exp;
+    }
+
+    // log(m) = 2 atanh(s) with s = (m-1)/(m+1) for m in [sqrt(1/2), sqrt(2)): the remainder of the
+    // series with n terms is bounded by 2 |s|^(2n+1) / ((2n+1)(1-s^2))
+    double const s_max = (std::sqrt(2.0) - 1.0) / (std::sqrt(2.0) + 1.0);
+    n_terms_log        = 1;
+    while(2.0 * std::pow(s_max, 2 * n_terms_log + 1) /
+              ((2 * n_terms_log + 1) * (1.0 - s_max * s_max)) >
+            tolerance and
+          n_terms_log < max_n_terms)
+    {
+      ++n_terms_log;
+    }
+  }
+
+  static unsigned int const max_n_terms = 30;
+
+  double tolerance;
+
+  unsigned int n_terms_exp;
+  unsigned int n_terms_log;
+};
+
+/*
+ * Exponential function. Arguments outside the range of normal numbers of Number are clipped.
+ */
+template<typename Number>
+inline dealii::VectorizedArray<Number>
+exp(dealii::VectorizedArray<Number> const & x, Accuracy<Number> const & accuracy)
+{
+  typedef internal::FloatingPointTraits<Number> Traits;
+  typedef typename Traits::Integer              Integer;
+  typedef dealii::VectorizedArray<Number>       scalar;
+
+  scalar const x_clipped =
+    std::min(std::max(x, scalar(static_cast<Number>(Traits::min_exp_argument))),
+             scalar(static_cast<Number>(Traits::max_exp_argument)));
+
+  // x = k ln(2) + r with integer k, where adding and subtracting 1.5 * 2^n_mantissa_bits rounds to
+  // the nearest integer (this requires compiling without value-unsafe optimizations)
+  Number const shifter = static_cast<Number>(1.5 * std::ldexp(1.0, Traits::n_mantissa_bits));
+  scalar const k =
+    (x_clipped * static_cast<Number>(1.0 / std::log(2.0)) + shifter) - scalar(shifter);
+
+  // ln(2) split into a part exactly representable with few bits and the remainder
+  Number const ln2_hi = static_cast<Number>(0.693145751953125);
+  Number const ln2_lo = static_cast<Number>(std::log(2.0) - 0.693145751953125);
+  scalar const r      = (x_clipped - k * ln2_hi) - k * ln2_lo;
+
+  // Taylor series in Horner form
+  scalar result = static_cast<Number>(1.0);
+  for(unsigned int j = accuracy.n_terms_exp; j > 0; --j)
+    result = static_cast<Number>(1.0) + r * result * static_cast<Number>(1.0 / j);
+
+  // multiply by 2^k, constructed from the exponent bits
+  scalar power_of_two;
+  for(unsigned int v = 0; v < scalar::size(); ++v)
+  {
+    Integer const bits = (static_cast<Integer>(k[v]) + Traits::exponent_bias)
+                         << Traits::n_mantissa_bits;
+    std::memcpy(&power_of_two[v], &bits, sizeof(Number));
+  }
+
+  return result * power_of_two;
+}
+
+/*
+ * Natural logarithm for positive normal numbers.
+ */
+template<typename Number>
+inline dealii::VectorizedArray<Number>
+log(dealii::VectorizedArray<Number> const & x, Accuracy<Number> const & accuracy)
+{
+  typedef internal::FloatingPointTraits<Number> Traits;
+  typedef typename Traits::Integer              Integer;
+  typedef dealii::VectorizedArray<Number>       scalar;
+
+  // x = 2^e m with m in [1,2), extracted from the bits of the floating point representation
+  Integer const mantissa_mask = (static_cast<Integer>(1) << Traits::n_mantissa_bits) - 1;
+  Integer const exponent_zero = static_cast<Integer>(Traits::exponent_bias)
+                                << Traits::n_mantissa_bits;
+
+  scalar e, m;
+  for(unsigned int v = 0; v < scalar::size(); ++v)
+  {
+    Integer bits;
+    std::memcpy(&bits, &x[v], sizeof(Number));
+    e[v] = static_cast<Number>((bits >> Traits::n_mantissa_bits) - Traits::exponent_bias);
+    bits = (bits & mantissa_mask) | exponent_zero;
+    std::memcpy(&m[v], &bits, sizeof(Number));
+  }
+
+  // shift m to [sqrt(1/2), sqrt(2)) to minimize the argument of the series
+  scalar const sqrt_two = static_cast<Number>(std::sqrt(2.0));
+  e = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than_or_equal>(
+    m, sqrt_two, e + static_cast<Number>(1.0), e);
+  m = dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than_or_equal>(
+    m, sqrt_two, m * static_cast<Number>(0.5), m);
+
+  // log(m) = 2 (s + s^3/3 + s^5/5 + ...) with s = (m-1)/(m+1)
+  scalar const s        = (m - static_cast<Number>(1.0)) / (m + static_cast<Number>(1.0));
+  scalar const s_square = s * s;
+
+  scalar series = static_cast<Number>(1.0 / (2 * accuracy.n_terms_log - 1));
+  for(unsigned int j = accuracy.n_terms_log - 1; j > 0; --j)
+    series = static_cast<Number>(1.0 / (2 * j - 1)) + s_square * series;
+
+  return e * static_cast<Number>(std::log(2.0)) + static_cast<Number>(2.0) * s * series;
+}
+
+/*
+ * Power function x^y for x >= 0, evaluated as exp(y log(x)). In contrast to std::pow(), the
+ * result is zero for x = 0 independently of the sign of y.
+ */
+template<typename Number>
+inline dealii::VectorizedArray<Number>
+pow(dealii::VectorizedArray<Number> const & x,
+    dealii::VectorizedArray<Number> const & y,
+    Accuracy<Number> const &                accuracy)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  scalar const min_normal = std::numeric_limits<Number>::min();
+
+  scalar const result = exp(y * log(std::max(x, min_normal), accuracy), accuracy);
+
+  return dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(x,
+                                                                              min_normal,
+                                                                              result,
+                                                                              scalar(0.0));
+}
+
+template<typename Number>
+inline dealii::VectorizedArray<Number>
+pow(dealii::VectorizedArray<Number> const & x, Number const y, Accuracy<Number> const & accuracy)
+{
+  return pow(x, dealii::VectorizedArray<Number>(y), accuracy);
+}
+
+} // namespace VectorizedMath
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_VECTORIZED_MATH_H_ */
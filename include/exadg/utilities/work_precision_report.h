@@ -0,0 +1,154 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_UTILITIES_WORK_PRECISION_REPORT_H_
+#define INCLUDE_EXADG_UTILITIES_WORK_PRECISION_REPORT_H_
+
+// C/C++
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/types.h>
+
+namespace ExaDG
+{
+/*
+ * Pairs the errors and the time-to-solution of the runs of a convergence study in order to compare
+ * the cost-effectiveness of different resolutions (h, p, dt). The error calculators record every
+ * error they compute via add_error(), such that the errors of an unsteady run are those of the last
+ * evaluation, typically at the end time. The solver finishes each run via finish_run(), which
+ * stores one row with the resolution, the number of unknowns, the wall time, and the errors of this
+ * run. The table is written in CSV format with one column per error, left empty for runs that did
+ * not compute this error. As for the PerformanceReport, there is one report per process, which is
+ * filled identically on all processes and written by rank 0.
+ */
+class WorkPrecisionReport
+{
+public:
+  static WorkPrecisionReport &
+  get()
+  {
+    static WorkPrecisionReport report;
+    return report;
+  }
+
+  void
+  add_error(std::string const & name, double const error)
+  {
+    current_errors[name] = error;
+  }
+
+  void
+  finish_run(unsigned int const                    degree,
+             unsigned int const                    refine_space,
+             unsigned int const                    refine_time,
+             dealii::types::global_dof_index const n_dofs,
+             double const                          wall_time)
+  {
+    rows.push_back({degree, refine_space, refine_time, n_dofs, wall_time, current_errors});
+
+    current_errors.clear();
+  }
+
+  void
+  write_csv(std::string const & filename, MPI_Comm const & mpi_comm) const
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+      return;
+
+    std::set<std::string> names;
+    for(Row const & row : rows)
+      for(auto const & error : row.errors)
+        names.insert(error.first);
+
+    std::ofstream stream(filename);
+    AssertThrow(stream, dealii::ExcMessage("Could not open file " + filename));
+
+    stream << "degree,refine_space,refine_time,n_dofs,wall_time";
+    for(std::string const & name : names)
+      stream << "," << quote(name);
+    stream << std::endl;
+
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for(Row const & row : rows)
+    {
+      stream << row.degree << "," << row.refine_space << "," << row.refine_time << ","
+             << row.n_dofs << "," << row.wall_time;
+
+      for(std::string const & name : names)
+      {
+        stream << ",";
+        auto const error = row.errors.find(name);
+        if(error != row.errors.end())
+          stream << error->second;
+      }
+
+      stream << std::endl;
+    }
+  }
+
+private:
+  WorkPrecisionReport()
+  {
+  }
+
+  static std::string
+  quote(std::string const & in)
+  {
+    std::string out = "\"";
+    for(char const c : in)
+    {
+      if(c == '"')
+        out += '"';
+      out += c;
+    }
+    out += "\"";
+
+    return out;
+  }
+
+  struct Row
+  {
+    unsigned int                    degree;
+    unsigned int                    refine_space;
+    unsigned int                    refine_time;
+    dealii::types::global_dof_index n_dofs;
+    double                          wall_time;
+    std::map<std::string, double>   errors;
+  };
+
+  std::map<std::string, double> current_errors;
+
+  std::vector<Row> rows;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_WORK_PRECISION_REPORT_H_ */
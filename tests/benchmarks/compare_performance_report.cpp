@@ -0,0 +1,169 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+/*
+ * Compares a performance report written by ExaDG::PerformanceReport against a reference report.
+ * The tolerance depends on the kind of entry:
+ *
+ *   - throughput numbers (DoFs/s) must not fall below (1 - tolerance) times the reference,
+ *   - wall times ([s] or section "wall_times") must not exceed (1 + tolerance) times the reference,
+ *   - average iteration counts (section "iterations") must not exceed (1 + tolerance_iterations)
+ *     times the reference,
+ *   - all other entries, e.g. the problem size or the number of MPI processes, define the benchmark
+ *     and have to match exactly.
+ *
+ * Entries of the reference missing in the report count as failures, additional entries of the
+ * report are only listed. The program returns 0 if no regression has been detected.
+ *
+ * usage: compare_performance_report <report> <reference> <tolerance> <tolerance_iterations>
+ */
+
+// C/C++
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <string>
+
+namespace
+{
+typedef std::map<std::string, double> Report;
+
+Report
+read_report(std::string const & filename)
+{
+  std::ifstream file(filename);
+  if(not file)
+  {
+    std::cerr << "Could not open file " << filename << std::endl;
+    std::exit(1);
+  }
+
+  // format of ExaDG::PerformanceReport::write_json(): one section or entry per line
+  std::regex const section_regex("^  \"((?:[^\"\\\\]|\\\\.)*)\": \\{$");
+  std::regex const entry_regex("^    \"((?:[^\"\\\\]|\\\\.)*)\": ([^,]+),?$");
+
+  Report      report;
+  std::string section, line;
+  std::smatch match;
+  while(std::getline(file, line))
+  {
+    if(std::regex_match(line, match, section_regex))
+      section = match[1];
+    else if(std::regex_match(line, match, entry_regex))
+      report[section + " / " + match[1].str()] = std::stod(match[2]);
+  }
+
+  return report;
+}
+
+enum class EntryType
+{
+  Throughput,
+  WallTime,
+  Iterations,
+  Exact
+};
+
+EntryType
+get_entry_type(std::string const & key)
+{
+  if(key.find("DoFs/s") != std::string::npos)
+    return EntryType::Throughput;
+  else if(key.rfind("wall_times / ", 0) == 0 or key.find("[s]") != std::string::npos)
+    return EntryType::WallTime;
+  else if(key.rfind("iterations / ", 0) == 0)
+    return EntryType::Iterations;
+  else
+    return EntryType::Exact;
+}
+} // namespace
+
+int
+main(int argc, char ** argv)
+{
+  if(argc != 5)
+  {
+    std::cerr << "usage: " << argv[0] << " <report> <reference> <tolerance> <tolerance_iterations>"
+              << std::endl;
+    return 1;
+  }
+
+  Report const report    = read_report(argv[1]);
+  Report const reference = read_report(argv[2]);
+
+  double const tolerance            = std::stod(argv[3]);
+  double const tolerance_iterations = std::stod(argv[4]);
+
+  unsigned int n_failures = 0;
+
+  std::cout << std::scientific << std::setprecision(4);
+
+  for(auto const & entry : reference)
+  {
+    auto const measured = report.find(entry.first);
+    if(measured == report.end())
+    {
+      std::cout << "MISSING  " << entry.first << std::endl;
+      ++n_failures;
+      continue;
+    }
+
+    double const ref   = entry.second;
+    double const value = measured->second;
+
+    bool passed = true;
+    switch(get_entry_type(entry.first))
+    {
+      case EntryType::Throughput:
+        passed = value >= (1.0 - tolerance) * ref;
+        break;
+      case EntryType::WallTime:
+        passed = value <= (1.0 + tolerance) * ref;
+        break;
+      case EntryType::Iterations:
+        passed = value <= (1.0 + tolerance_iterations) * ref;
+        break;
+      case EntryType::Exact:
+        passed = std::abs(value - ref) <= 1.e-12 * std::abs(ref);
+        break;
+    }
+
+    if(not passed)
+      ++n_failures;
+
+    std::cout << (passed ? "OK       " : "FAILED   ") << entry.first << ": " << value
+              << " (reference " << ref << ")" << std::endl;
+  }
+
+  for(auto const & entry : report)
+    if(reference.find(entry.first) == reference.end())
+      std::cout << "NEW      " << entry.first << ": " << entry.second << std::endl;
+
+  if(n_failures > 0)
+    std::cout << std::endl << n_failures << " entries exceed the tolerances." << std::endl;
+
+  return n_failures == 0 ? 0 : 1;
+}
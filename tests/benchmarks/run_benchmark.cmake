@@ -0,0 +1,61 @@
+#########################################################################
+# 
+#                 #######               ######  #######
+#                 ##                    ##   ## ##
+#                 #####   ##  ## #####  ##   ## ## ####
+#                 ##       ####  ## ##  ##   ## ##   ##
+#                 ####### ##  ## ###### ######  #######
+#
+#  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+#
+#  Copyright (C) 2021 by the ExaDG authors
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+#########################################################################
+
+# Runs a benchmark executed via ctest in script mode (cmake -P): runs the application with the
+# input file, which writes the performance report REPORT, and compares the report against the
+# reference REFERENCE. If the reference does not exist or UPDATE_REFERENCE is set, the report is
+# stored as new reference.
+#
+# variables: COMPARE, EXECUTABLE, INPUT, REPORT, REFERENCE, TOLERANCE, TOLERANCE_ITERATIONS,
+#            UPDATE_REFERENCE, MPIEXEC_COMMAND (optional, list)
+
+FILE(REMOVE ${REPORT})
+
+EXECUTE_PROCESS(COMMAND ${MPIEXEC_COMMAND} ${EXECUTABLE} ${INPUT}
+                RESULT_VARIABLE RESULT
+                OUTPUT_QUIET)
+
+IF(NOT RESULT EQUAL 0)
+  MESSAGE(FATAL_ERROR "Benchmark ${EXECUTABLE} ${INPUT} failed: ${RESULT}")
+ENDIF()
+
+IF(NOT EXISTS ${REPORT})
+  MESSAGE(FATAL_ERROR "Benchmark did not write the performance report ${REPORT}")
+ENDIF()
+
+IF(UPDATE_REFERENCE OR NOT EXISTS ${REFERENCE})
+  CONFIGURE_FILE(${REPORT} ${REFERENCE} COPYONLY)
+  MESSAGE(STATUS "Wrote reference ${REFERENCE}")
+  RETURN()
+ENDIF()
+
+EXECUTE_PROCESS(COMMAND ${COMPARE} ${REPORT} ${REFERENCE} ${TOLERANCE} ${TOLERANCE_ITERATIONS}
+                RESULT_VARIABLE RESULT)
+
+IF(NOT RESULT EQUAL 0)
+  MESSAGE(FATAL_ERROR "Performance regression with respect to ${REFERENCE}")
+ENDIF()